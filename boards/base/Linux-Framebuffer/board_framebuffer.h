@@ -34,6 +34,11 @@
 	#include <sys/types.h>
 	#include <unistd.h>
 
+	#if GDISP_NEED_DOUBLEBUFFER
+		static int							fb_dev;				// The frame buffer device (kept open for page flipping)
+		static struct fb_var_screeninfo		fb_pan;				// The screen info used for page flipping
+	#endif
+
 	#if VTDEV_PATH
 		static void board_revert2textmode(void) {
 			int tty;
@@ -67,6 +72,7 @@
 		int							fb;
 		char *						env;
 		size_t						fblen;
+		unsigned					pages;
 		struct fb_fix_screeninfo	fb_fix;
 		struct fb_var_screeninfo	fb_var;
 
@@ -135,6 +141,27 @@
 			exit(-1);
 		}
 
+		// For double buffering try to get a virtual display area big enough to flip between pages
+		pages = 1;
+		#if GDISP_NEED_DOUBLEBUFFER
+			if (fb_var.yres_virtual < fb_var.yres * GDISP_DOUBLEBUFFER_PAGES) {
+				fb_var.yres_virtual = fb_var.yres * GDISP_DOUBLEBUFFER_PAGES;
+				fb_var.xoffset = 0;
+				fb_var.yoffset = 0;
+				fb_var.activate = FB_ACTIVATE_NOW;
+				ioctl(fb, FBIOPUT_VSCREENINFO, &fb_var);
+				if (ioctl(fb, FBIOGET_VSCREENINFO, &fb_var) == -1 || ioctl(fb, FBIOGET_FSCREENINFO, &fb_fix) == -1) {
+					fprintf(stderr, "GDISP Framebuffer: Error getting screen info\n");
+					exit(-1);
+				}
+			}
+			pages = fb_var.yres_virtual / fb_var.yres;
+			if (pages > GDISP_DOUBLEBUFFER_PAGES)
+				pages = GDISP_DOUBLEBUFFER_PAGES;
+			if (pages < 2 || fb_fix.smem_len < pages * fb_var.yres * fb_fix.line_length)
+				pages = 1;
+		#endif
+
 		// Ensure we are at the origin of the virtual display area
 		if (fb_var.xoffset || fb_var.yoffset) {
 			fb_var.xoffset = 0;
@@ -148,7 +175,7 @@
 		#endif
 
 		// Calculate the frame buffer length
-		fblen = fb_var.yres * fb_fix.line_length;
+		fblen = fb_var.yres * fb_fix.line_length * pages;
 
 		// Different systems need mapping in slightly different ways - Yuck!
 		#ifdef ARCH_LINUX_SPARC
@@ -185,8 +212,16 @@
 		// If this program gets children they should not inherit this file descriptor
 		fcntl(fb, F_SETFD, FD_CLOEXEC);
 
-		// We are finished with the file descriptor
-		close(fb);
+		// Keep the file descriptor if we are flipping pages, otherwise we are finished with it
+		#if GDISP_NEED_DOUBLEBUFFER
+			if (pages >= 2) {
+				fb_dev = fb;
+				fb_pan = fb_var;
+				fbi->pages = pages;
+				fbi->pagelen = fb_var.yres * fb_fix.line_length;
+			} else
+		#endif
+			close(fb);
 
 		// Set the rest of the details of the frame buffer
 		g->g.Width = fb_var.xres;
@@ -196,12 +231,35 @@
 		fbi->linelen = fb_fix.line_length;
 	}
 
-	#if GDISP_HARDWARE_FLUSH
+	#if FB_BOARD_FLUSH
 		static void board_flush(GDisplay *g) {
 			(void) g;
 		}
 	#endif
 
+	#if GDISP_NEED_DOUBLEBUFFER
+		static void board_flip(GDisplay *g, unsigned page) {
+			#ifdef FBIO_WAITFORVSYNC
+				gU32	crtc = 0;
+			#endif
+			(void) g;
+
+			// Triple buffering - wait for the previous flip so the page before it is free to draw on
+			#if defined(FBIO_WAITFORVSYNC) && GDISP_DOUBLEBUFFER_PAGES > 2
+				ioctl(fb_dev, FBIO_WAITFORVSYNC, &crtc);
+			#endif
+
+			fb_pan.xoffset = 0;
+			fb_pan.yoffset = page * fb_pan.yres;
+			ioctl(fb_dev, FBIOPAN_DISPLAY, &fb_pan);
+
+			// Double buffering - wait until this page is being shown before drawing on the other one
+			#if defined(FBIO_WAITFORVSYNC) && GDISP_DOUBLEBUFFER_PAGES == 2
+				ioctl(fb_dev, FBIO_WAITFORVSYNC, &crtc);
+			#endif
+		}
+	#endif
+
 	#if GDISP_NEED_CONTROL
 		static void board_backlight(GDisplay *g, gU8 percent) {
 			(void) g;
@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/benchmarks/rendering
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
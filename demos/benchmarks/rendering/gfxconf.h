@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2012, 2013, Joel Bodenmann aka Tectu <joel@unormal.org>
+ * Copyright (c) 2012, 2013, Andrew Hannam aka inmarket
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of the <organization> nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _GFXCONF_H
+#define _GFXCONF_H
+
+/* The operating system to use. One of these must be defined - preferably in your Makefile */
+//#define GFX_USE_OS_CHIBIOS	GFXOFF
+//#define GFX_USE_OS_WIN32		GFXOFF
+//#define GFX_USE_OS_LINUX		GFXOFF
+//#define GFX_USE_OS_OSX		GFXOFF
+
+/* GFX sub-systems to turn on */
+#define GFX_USE_GDISP					GFXON
+#define GFX_USE_GWIN					GFXON
+#define GFX_USE_GINPUT					GFXON
+#define GFX_USE_GEVENT					GFXON
+#define GFX_USE_GTIMER					GFXON
+#define GFX_USE_GQUEUE					GFXON
+#define GFX_USE_GFILE					GFXON
+#define GFX_USE_GMISC					GFXON
+
+/* Features for the GDISP sub-system. */
+#define GDISP_NEED_VALIDATION			GFXON
+#define GDISP_NEED_CLIP					GFXON
+#define GDISP_NEED_CIRCLE				GFXON
+#define GDISP_NEED_DUALCIRCLE			GFXON
+#define GDISP_NEED_ELLIPSE				GFXON
+#define GDISP_NEED_ARC					GFXON
+#define GDISP_NEED_ARCSECTORS			GFXON
+#define GDISP_NEED_CONVEX_POLYGON		GFXON
+#define GDISP_NEED_POLYGON				GFXON
+#define GDISP_NEED_SCROLL				GFXON
+#define GDISP_NEED_COPYAREA				GFXON
+#define GDISP_NEED_PIXELREAD			GFXON
+#define GDISP_NEED_CONTROL				GFXON
+#define GDISP_NEED_MULTITHREAD			GFXON
+#define GDISP_NEED_PIXMAP				GFXON
+#define GDISP_NEED_COMPOSITE			GFXON
+#define GDISP_NEED_TRANSFORM			GFXON
+#define GDISP_NEED_PAINT				GFXON
+#define GDISP_NEED_STATS				GFXON
+#define GDISP_NEED_STARTUP_LOGO			GFXOFF
+
+/* The optional GDISP features. Build with BENCH_FEATURES=yes (see the Makefile) to turn them on. */
+#ifndef BENCH_FEATURES
+	#define BENCH_FEATURES				GFXOFF
+#endif
+#if BENCH_FEATURES
+	#define GDISP_NEED_PIXELKERNELS		GFXON
+	#define GDISP_NEED_DIRTYRECTS		GFXON
+	#define GDISP_NEED_DOUBLEBUFFER		GFXON
+	#define GDISP_NEED_CMDLIST			GFXON
+	#define GDISP_NEED_CLIPREGION		GFXON
+	#define GDISP_NEED_VIEWS			GFXON
+	#define GDISP_NEED_TILER			GFXON
+	#define GDISP_NEED_ASYNC			GFXON
+#endif
+
+/* The TestStub driver throws its pixels away so only the drawing code is measured */
+#define GDISP_SCREEN_WIDTH				320
+#define GDISP_SCREEN_HEIGHT				240
+
+/* Only count calls and pixels - the benchmark does its own timing */
+#define GDISP_STATS_CLOCK()				0
+
+/* Rotation in the transform benchmark */
+#define GMISC_NEED_FIXEDTRIG			GFXON
+#define GMISC_NEED_MATRIXFIXED2D		GFXON
+
+/* Text and builtin fonts */
+#define GDISP_NEED_TEXT					GFXON
+#define GDISP_NEED_ANTIALIAS			GFXON
+#define GDISP_NEED_TEXT_KERNING			GFXON
+#define GDISP_INCLUDE_FONT_UI1					GFXON
+#define GDISP_INCLUDE_FONT_UI2					GFXON
+#define GDISP_INCLUDE_FONT_LARGENUMBERS			GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS10			GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS12			GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS16			GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS20			GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS24			GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS32			GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANSBOLD12		GFXON
+#define GDISP_INCLUDE_FONT_FIXED_10X20			GFXON
+#define GDISP_INCLUDE_FONT_FIXED_7X14			GFXON
+#define GDISP_INCLUDE_FONT_FIXED_5X8			GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS12_AA		GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS16_AA		GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS20_AA		GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS24_AA		GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANS32_AA		GFXON
+#define GDISP_INCLUDE_FONT_DEJAVUSANSBOLD12_AA	GFXON
+
+/* Image decoders */
+#define GDISP_NEED_IMAGE				GFXON
+#define GDISP_NEED_IMAGE_NATIVE			GFXON
+#define GDISP_NEED_IMAGE_GIF			GFXON
+#define GDISP_NEED_IMAGE_BMP			GFXON
+#define GDISP_NEED_IMAGE_JPG			GFXON
+#define GDISP_NEED_IMAGE_PNG			GFXON
+
+/* The image files are in the ROMFS (see romfs_files.h). The native image is built in memory. */
+#define GFILE_NEED_ROMFS				GFXON
+#define GFILE_NEED_MEMFS				GFXON
+
+/* Features for the GWIN sub-system. */
+#define GWIN_NEED_WINDOWMANAGER			GFXON
+#define GWIN_NEED_WIDGET				GFXON
+#define GWIN_REDRAW_IMMEDIATE			GFXON		// Redraw in the calling thread so it can be timed
+#define GWIN_NEED_BUTTON				GFXON
+#define GWIN_NEED_CHECKBOX				GFXON
+#define GWIN_NEED_RADIO					GFXON
+#define GWIN_NEED_SLIDER				GFXON
+#define GWIN_NEED_PROGRESSBAR			GFXON
+#define GWIN_NEED_LABEL					GFXON
+#define GWIN_NEED_LIST					GFXON
+#define GQUEUE_NEED_ASYNC				GFXON
+
+#endif /* _GFXCONF_H */
@@ -0,0 +1,561 @@
+/*
+ * Copyright (c) 2012, 2013, Joel Bodenmann aka Tectu <joel@unormal.org>
+ * Copyright (c) 2012, 2013, Andrew Hannam aka inmarket
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of the <organization> nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * A host-side rendering benchmark.
+ *
+ * Every test is run on the TestStub driver (which throws its pixels away so only the
+ * uGFX drawing code is measured) and on a pixmap (which also measures the pixel writes).
+ * Each test is repeated until it has run for at least BENCH_TIME milliseconds.
+ *
+ * The results are printed as comma separated values, one line per test:
+ *		display,test,calls,pixels,ns_per_call,pixels_per_sec
+ * where pixels is the number of pixels sent to or read from the driver as counted by
+ * the GDISP statistics. Lines starting with '#' are comments.
+ *
+ * Build it with the Makefile in Example_Makefiles/linux and save the output of two runs
+ * to compare them. Building with BENCH_FEATURES=yes turns on the optional GDISP features
+ * (see gfxconf.h) and adds the tests for them.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "gfx.h"
+
+#ifndef BENCH_TIME
+	#define BENCH_TIME		250			// The minimum run time of each test in milliseconds
+#endif
+#define BENCH_BATCH			16			// The number of calls between clock checks
+
+#define NATIVE_WIDTH		64
+#define NATIVE_HEIGHT		64
+
+typedef void (*benchfn)(GDisplay *g, unsigned i);
+
+static gCoord		width, height;
+static gFont		font;
+static gImage		image;
+static gPixel		blitbuf[64*64];
+static gU32			argbbuf[64*64];
+static gU8 *		nativeimg;
+
+#if GDISP_NEED_CMDLIST
+	static gdispCmdList	cmdlist;
+	static gU8			cmdbuf[2048];
+#endif
+#if GDISP_NEED_TILER
+	static gdispTiler	tiler;
+#endif
+#if GDISP_NEED_ASYNC
+	static gdispFence	fence;
+#endif
+
+static const char	sample[] = "0123456789 The quick brown fox jumps over the lazy dog";
+
+static const char *fonts[] = {
+	"UI1", "UI2", "LargeNumbers",
+	"DejaVuSans10", "DejaVuSans12", "DejaVuSans16", "DejaVuSans20", "DejaVuSans24", "DejaVuSans32",
+	"DejaVuSansBold12", "fixed_5x8", "fixed_7x14", "fixed_10x20",
+	"DejaVuSans12_aa", "DejaVuSans16_aa", "DejaVuSans20_aa", "DejaVuSans24_aa", "DejaVuSans32_aa",
+	"DejaVuSansBold12_aa",
+};
+
+static const gPoint star[] = {
+	{ 50, 0 }, { 62, 35 }, { 100, 35 }, { 69, 57 }, { 81, 95 },
+	{ 50, 72 }, { 19, 95 }, { 31, 57 }, { 0, 35 }, { 38, 35 },
+};
+static const gPoint pentagram[] = {
+	{ 50, 0 }, { 81, 95 }, { 0, 35 }, { 100, 35 }, { 19, 95 },
+};
+
+// A cheap pseudo random coordinate within a range
+#define RND(i, n, range)	((gCoord)(((i) * (n)) % (unsigned)(range)))
+
+static gColor color(unsigned i) {
+	static const gColor colors[] = { GFX_RED, GFX_GREEN, GFX_BLUE, GFX_YELLOW, GFX_CYAN, GFX_MAGENTA, GFX_WHITE, GFX_GRAY };
+
+	return colors[i & 7];
+}
+
+/*===========================================================================*/
+/* The tests                                                                 */
+/*===========================================================================*/
+
+static void bench_clear(GDisplay *g, unsigned i) {
+	gdispGClear(g, color(i));
+}
+static void bench_pixel(GDisplay *g, unsigned i) {
+	gdispGDrawPixel(g, RND(i, 7919, width), RND(i, 104729, height), color(i));
+}
+static void bench_hline(GDisplay *g, unsigned i) {
+	gdispGDrawLine(g, 0, RND(i, 7919, height), width-1, RND(i, 7919, height), color(i));
+}
+static void bench_vline(GDisplay *g, unsigned i) {
+	gdispGDrawLine(g, RND(i, 7919, width), 0, RND(i, 7919, width), height-1, color(i));
+}
+static void bench_line(GDisplay *g, unsigned i) {
+	gdispGDrawLine(g, RND(i, 7919, width), 0, RND(i, 104729, width), height-1, color(i));
+}
+static void bench_lineaa(GDisplay *g, unsigned i) {
+	gdispGDrawLineAA(g, RND(i, 7919, width), 0, RND(i, 104729, width), height-1, color(i));
+}
+static void bench_thickline(GDisplay *g, unsigned i) {
+	gdispGDrawThickLine(g, RND(i, 7919, width), 0, RND(i, 104729, width), height-1, color(i), 5, gTrue);
+}
+static void bench_box(GDisplay *g, unsigned i) {
+	gdispGDrawBox(g, RND(i, 7919, width-64), RND(i, 104729, height-64), 64, 64, color(i));
+}
+static void bench_fill_small(GDisplay *g, unsigned i) {
+	gdispGFillArea(g, RND(i, 7919, width-16), RND(i, 104729, height-16), 16, 16, color(i));
+}
+static void bench_fill_large(GDisplay *g, unsigned i) {
+	gdispGFillArea(g, RND(i, 7919, width/2), RND(i, 104729, height/2), width/2, height/2, color(i));
+}
+static void bench_circle(GDisplay *g, unsigned i) {
+	gdispGDrawCircle(g, width/2, height/2, 20 + RND(i, 7919, 80), color(i));
+}
+static void bench_fill_circle(GDisplay *g, unsigned i) {
+	gdispGFillCircle(g, width/2, height/2, 20 + RND(i, 7919, 80), color(i));
+}
+static void bench_circleaa(GDisplay *g, unsigned i) {
+	gdispGDrawCircleAA(g, width/2, height/2, 20 + RND(i, 7919, 80), color(i));
+}
+static void bench_fill_circleaa(GDisplay *g, unsigned i) {
+	gdispGFillCircleAA(g, width/2, height/2, 20 + RND(i, 7919, 80), color(i));
+}
+static void bench_ellipse(GDisplay *g, unsigned i) {
+	gdispGDrawEllipse(g, width/2, height/2, 100, 20 + RND(i, 7919, 80), color(i));
+}
+static void bench_fill_ellipse(GDisplay *g, unsigned i) {
+	gdispGFillEllipse(g, width/2, height/2, 100, 20 + RND(i, 7919, 80), color(i));
+}
+static void bench_arc(GDisplay *g, unsigned i) {
+	gdispGDrawArc(g, width/2, height/2, 20 + RND(i, 7919, 80), RND(i, 7919, 360), 300, color(i));
+}
+static void bench_fill_arc(GDisplay *g, unsigned i) {
+	gdispGFillArc(g, width/2, height/2, 20 + RND(i, 7919, 80), RND(i, 7919, 360), 300, color(i));
+}
+static void bench_thickarc(GDisplay *g, unsigned i) {
+	gdispGDrawThickArc(g, width/2, height/2, 60, 80, RND(i, 7919, 360), 300, color(i));
+}
+static void bench_arcaa(GDisplay *g, unsigned i) {
+	gdispGDrawArcAA(g, width/2, height/2, 20 + RND(i, 7919, 80), RND(i, 7919, 360), 300, color(i));
+}
+static void bench_thickarcaa(GDisplay *g, unsigned i) {
+	gdispGDrawThickArcAA(g, width/2, height/2, 60, 80, RND(i, 7919, 360), 300, color(i));
+}
+static void bench_arcsectors(GDisplay *g, unsigned i) {
+	gdispGFillArcSectors(g, width/2, height/2, 20 + RND(i, 7919, 80), (gU8)(i | 0x11), color(i));
+}
+static void bench_fill_roundedbox(GDisplay *g, unsigned i) {
+	gdispGFillRoundedBox(g, RND(i, 7919, width-100), RND(i, 104729, height-100), 100, 100, 10, color(i));
+}
+static void bench_poly(GDisplay *g, unsigned i) {
+	gdispGDrawPoly(g, RND(i, 7919, width-100), RND(i, 104729, height-100), star, sizeof(star)/sizeof(star[0]), color(i));
+}
+static void bench_fill_convexpoly(GDisplay *g, unsigned i) {
+	static const gPoint hexagon[] = { { 25, 0 }, { 75, 0 }, { 100, 50 }, { 75, 100 }, { 25, 100 }, { 0, 50 } };
+
+	gdispGFillConvexPoly(g, RND(i, 7919, width-100), RND(i, 104729, height-100), hexagon, sizeof(hexagon)/sizeof(hexagon[0]), color(i));
+}
+static void bench_fill_poly(GDisplay *g, unsigned i) {
+	gdispGFillPoly(g, RND(i, 7919, width-100), RND(i, 104729, height-100), star, sizeof(star)/sizeof(star[0]), color(i), gPolyFillEvenOdd);
+}
+static void bench_fill_poly_nonzero(GDisplay *g, unsigned i) {
+	gdispGFillPoly(g, RND(i, 7919, width-100), RND(i, 104729, height-100), pentagram, sizeof(pentagram)/sizeof(pentagram[0]), color(i), gPolyFillNonZero);
+}
+static void bench_fill_polyaa(GDisplay *g, unsigned i) {
+	gdispGFillPoly(g, RND(i, 7919, width-100), RND(i, 104729, height-100), star, sizeof(star)/sizeof(star[0]), color(i), gPolyFillEvenOdd|gPolyFillAntiAlias);
+}
+static void bench_blit(GDisplay *g, unsigned i) {
+	gdispGBlitArea(g, RND(i, 7919, width-64), RND(i, 104729, height-64), 64, 64, 0, 0, 64, blitbuf);
+}
+static void bench_composite(GDisplay *g, unsigned i) {
+	gdispGCompositeArea(g, RND(i, 7919, width-64), RND(i, 104729, height-64), 64, 64, 0, 0, 64, argbbuf, gdispCompositeSrcOver, 255);
+}
+static void bench_fade(GDisplay *g, unsigned i) {
+	gdispGCompositeArea(g, RND(i, 7919, width-64), RND(i, 104729, height-64), 64, 64, 0, 0, 64, argbbuf, gdispCompositeSrcOver, (gU8)(i * 8));
+}
+static void bench_scale(GDisplay *g, unsigned i) {
+	MatrixFixed2D	m;
+
+	// 64x64 scaled up to 96x96
+	gmiscMatrixFixed2DApplyScale(&m, 0, FIXED(3)/2, FIXED(3)/2);
+	m.a02 = FIXED(RND(i, 7919, width-96));
+	m.a12 = FIXED(RND(i, 104729, height-96));
+	gdispGBlitAreaTransformed(g, 0, 0, 64, 64, 64, blitbuf, &m, gdispFilterNearest);
+}
+static void bench_rotate(GDisplay *g, unsigned i) {
+	MatrixFixed2D	m;
+
+	// 64x64 rotated around its center
+	gmiscMatrixFixed2DApplyRotation(&m, 0, (int)(i * 7) % 360);
+	m.a02 = FIXED(RND(i, 7919, width-92) + 46) - 32 * (m.a00 + m.a01);
+	m.a12 = FIXED(RND(i, 104729, height-92) + 46) - 32 * (m.a10 + m.a11);
+	gdispGBlitAreaTransformed(g, 0, 0, 64, 64, 64, blitbuf, &m, gdispFilterBilinear);
+}
+static void bench_gradient(GDisplay *g, unsigned i) {
+	gdispPaint	paint;
+	gCoord		x, y;
+
+	x = RND(i, 7919, width/2);
+	y = RND(i, 104729, height/2);
+	gdispPaintSetLinear(&paint, x, y, x+width/2, y+height/2, color(i), color(i+1));
+	gdispGFillAreaPaint(g, x, y, width/2, height/2, &paint);
+}
+static void bench_radial(GDisplay *g, unsigned i) {
+	gdispPaint	paint;
+	gCoord		r;
+
+	r = 20 + RND(i, 7919, 80);
+	gdispPaintSetRadial(&paint, width/2, height/2, r, color(i), color(i+1));
+	gdispGFillCirclePaint(g, width/2, height/2, r, &paint);
+}
+static void bench_scroll(GDisplay *g, unsigned i) {
+	gdispGVerticalScroll(g, 0, 0, width, height, (i & 1) ? 8 : -8, GFX_BLACK);
+}
+static void bench_copy(GDisplay *g, unsigned i) {
+	gdispGCopyArea(g, RND(i, 7919, width-64), RND(i, 104729, height-64), 64, 64, RND(i, 1299709, width-64), RND(i, 15485863, height-64));
+}
+static void bench_flush(GDisplay *g, unsigned i) {
+	gdispGFillArea(g, RND(i, 7919, width-16), RND(i, 104729, height-16), 16, 16, color(i));
+	gdispGFlush(g);
+}
+#if GDISP_NEED_ASYNC
+	static void bench_flush_async(GDisplay *g, unsigned i) {
+		gdispGFillArea(g, RND(i, 7919, width-16), RND(i, 104729, height-16), 16, 16, color(i));
+		gdispGFlushAsync(g, &fence, 0, 0);
+		gdispFenceWait(&fence, gDelayForever);
+	}
+	static void bench_blit_async(GDisplay *g, unsigned i) {
+		gdispGBlitAreaAsync(g, RND(i, 7919, width-64), RND(i, 104729, height-64), 64, 64, 0, 0, 64, blitbuf, &fence, 0, 0);
+		gdispFenceWait(&fence, gDelayForever);
+	}
+#endif
+#if GDISP_NEED_CMDLIST
+	// Record 16 fills and lines spread over the display
+	static void recordlist(GDisplay *g, unsigned i) {
+		unsigned	j;
+
+		gdispGCmdListBegin(g, &cmdlist, cmdbuf, sizeof(cmdbuf));
+		for(j = 0; j < 16; j++, i++) {
+			gdispCmdListFillArea(&cmdlist, RND(i, 7919, width-32), RND(i, 104729, height-32), 32, 32, color(i));
+			gdispCmdListDrawLine(&cmdlist, RND(i, 7919, width), 0, RND(i, 104729, width), height-1, color(i+1));
+		}
+	}
+	static void bench_cmdlist(GDisplay *g, unsigned i) {
+		recordlist(g, i);
+		gdispCmdListSubmit(&cmdlist);
+	}
+#endif
+#if GDISP_NEED_TILER
+	// The tiles are drawn through the tiler's own views so no pixels are counted
+	static void bench_tiler(GDisplay *g, unsigned i) {
+		recordlist(g, i);
+		gdispTilerSubmit(&tiler, &cmdlist);
+	}
+#endif
+static void bench_getpixel(GDisplay *g, unsigned i) {
+	gdispGGetPixelColor(g, RND(i, 7919, width), RND(i, 104729, height));
+}
+static void bench_text(GDisplay *g, unsigned i) {
+	gdispGDrawString(g, 0, RND(i, 7919, height-gdispGetFontMetric(font, gFontHeight)), sample, font, color(i));
+}
+static void bench_fill_text(GDisplay *g, unsigned i) {
+	gdispGFillString(g, 0, RND(i, 7919, height-gdispGetFontMetric(font, gFontHeight)), sample, font, color(i), GFX_BLACK);
+}
+static void bench_image(GDisplay *g, unsigned i) {
+	(void) i;
+
+	// Draw the whole image each time. Images that are not cached are decoded again.
+	gdispGImageDraw(g, &image, 0, 0, image.width, image.height, 0, 0);
+}
+static void bench_gwin(GDisplay *g, unsigned i) {
+	(void) i;
+
+	gwinRedrawDisplay(g, gFalse);
+}
+
+/*===========================================================================*/
+/* The test runner                                                           */
+/*===========================================================================*/
+
+static void bench(GDisplay *g, const char *dname, const char *tname, benchfn fn) {
+	gdispStats			st;
+	unsigned			calls, j, op;
+	unsigned long long	pixels;
+	gTicks				start, elapsed, end;
+	double				secs;
+
+	gdispGClear(g, GFX_BLACK);
+	gdispGGetStats(g, 0, gTrue);
+	calls = 0;
+	pixels = 0;
+	end = gfxMillisecondsToTicks(BENCH_TIME);
+	start = gfxSystemTicks();
+	do {
+		for(j = 0; j < BENCH_BATCH; j++)
+			fn(g, calls++);
+
+		// Collect the pixels often so the counters can't overflow
+		gdispGGetStats(g, &st, gTrue);
+		for(op = gdispStatLLDPixel; op < gdispStatCount; op++)
+			pixels += st.op[op].pixels;
+		elapsed = gfxSystemTicks() - start;
+	} while(elapsed < end);
+
+	secs = (double)elapsed / gfxMillisecondsToTicks(1000);
+	printf("%s,%s,%u,%llu,%.1f,%.0f\n", dname, tname, calls, pixels, secs * 1e9 / calls, pixels / secs);
+	fflush(stdout);
+}
+
+static void benchimage(GDisplay *g, const char *dname, const char *tname, GFILE *f) {
+	gdispImageError	err;
+
+	if ((err = gdispImageOpenGFile(&image, f)) != GDISP_IMAGE_ERR_OK) {
+		printf("# %s,%s: open failed (%d)\n", dname, tname, err);
+		return;
+	}
+	bench(g, dname, tname, bench_image);
+	gdispImageClose(&image);
+}
+
+static void benchgwin(GDisplay *g, const char *dname) {
+	static const char *items[] = { "Item 1", "Item 2", "Item 3", "Item 4", "Item 5", "Item 6", "Item 7", "Item 8" };
+	GWidgetInit		wi;
+	GHandle			gh[9];
+	unsigned		n, i;
+
+	gwinWidgetClearInit(&wi);
+	wi.g.show = gTrue;
+	n = 0;
+
+	wi.g.x = 10; wi.g.y = 10; wi.g.width = 120; wi.g.height = 30; wi.text = "Button";
+	gh[n++] = gwinGButtonCreate(g, 0, &wi);
+	wi.g.y = 50; wi.text = "Checkbox";
+	gh[n++] = gwinGCheckboxCreate(g, 0, &wi);
+	wi.g.y = 90; wi.g.height = 20; wi.text = "Radio 1";
+	gh[n++] = gwinGRadioCreate(g, 0, &wi, 0);
+	wi.g.y = 115; wi.text = "Radio 2";
+	gh[n++] = gwinGRadioCreate(g, 0, &wi, 0);
+	wi.g.y = 140; wi.text = "A label";
+	gh[n++] = gwinGLabelCreate(g, 0, &wi);
+	wi.g.y = 170; wi.g.height = 20; wi.text = "Slider";
+	gh[n++] = gwinGSliderCreate(g, 0, &wi);
+	wi.g.y = 200; wi.text = "Progress";
+	gh[n] = gwinGProgressbarCreate(g, 0, &wi);
+	gwinProgressbarSetPosition(gh[n++], 60);
+	wi.g.x = 150; wi.g.y = 10; wi.g.width = 160; wi.g.height = 210; wi.text = "List";
+	gh[n] = gwinGListCreate(g, 0, &wi, gFalse);
+	for(i = 0; i < sizeof(items)/sizeof(items[0]); i++)
+		gwinListAddItem(gh[n], items[i], gFalse);
+	n++;
+
+	bench(g, dname, "gwin_redraw", bench_gwin);
+
+	while(n)
+		gwinDestroy(gh[--n]);
+}
+
+#if GDISP_NEED_CLIPREGION
+	static void benchregion(GDisplay *g, const char *dname) {
+		gdispRegion		rgn;
+		unsigned		i;
+
+		// A checkerboard of 8 rectangles
+		gdispRegionInit(&rgn);
+		for(i = 0; i < 8; i++)
+			gdispRegionUnionRect(&rgn, i*width/8, (i & 1) ? height/2 : 0, width/8, height/2);
+		gdispGSetClipRegion(g, &rgn);
+		bench(g, dname, "clipregion_fill_quarter", bench_fill_large);
+		bench(g, dname, "clipregion_circle_aa", bench_fill_circleaa);
+		gdispGSetClip(g, 0, 0, width, height);
+		gdispRegionDeinit(&rgn);
+	}
+#endif
+
+#if GDISP_NEED_VIEWS
+	static void benchview(GDisplay *g, const char *dname) {
+		GDisplay	*v;
+
+		// A view of the whole display so the same tests can be used
+		if (!(v = gdispGViewCreate(g, 0, 0, width, height))) {
+			printf("# %s,view: views not supported\n", dname);
+			return;
+		}
+		bench(v, dname, "view_fill_16x16", bench_fill_small);
+		bench(v, dname, "view_line", bench_line);
+		bench(v, dname, "view_blit_64x64", bench_blit);
+		gdispViewDelete(v);
+	}
+#endif
+
+static void benchdisplay(GDisplay *g, const char *dname) {
+	char		tname[64];
+	unsigned	i;
+
+	width = gdispGGetWidth(g);
+	height = gdispGGetHeight(g);
+
+	bench(g, dname, "clear", bench_clear);
+	bench(g, dname, "pixel", bench_pixel);
+	bench(g, dname, "getpixel", bench_getpixel);
+	bench(g, dname, "hline", bench_hline);
+	bench(g, dname, "vline", bench_vline);
+	bench(g, dname, "line", bench_line);
+	bench(g, dname, "line_aa", bench_lineaa);
+	bench(g, dname, "thickline", bench_thickline);
+	bench(g, dname, "box", bench_box);
+	bench(g, dname, "fill_16x16", bench_fill_small);
+	bench(g, dname, "fill_quarter", bench_fill_large);
+	bench(g, dname, "circle", bench_circle);
+	bench(g, dname, "fill_circle", bench_fill_circle);
+	bench(g, dname, "circle_aa", bench_circleaa);
+	bench(g, dname, "fill_circle_aa", bench_fill_circleaa);
+	bench(g, dname, "ellipse", bench_ellipse);
+	bench(g, dname, "fill_ellipse", bench_fill_ellipse);
+	bench(g, dname, "arc", bench_arc);
+	bench(g, dname, "fill_arc", bench_fill_arc);
+	bench(g, dname, "thickarc", bench_thickarc);
+	bench(g, dname, "arc_aa", bench_arcaa);
+	bench(g, dname, "thickarc_aa", bench_thickarcaa);
+	bench(g, dname, "fill_arcsectors", bench_arcsectors);
+	bench(g, dname, "fill_roundedbox", bench_fill_roundedbox);
+	bench(g, dname, "poly", bench_poly);
+	bench(g, dname, "fill_convexpoly", bench_fill_convexpoly);
+	bench(g, dname, "fill_poly", bench_fill_poly);
+	bench(g, dname, "fill_poly_nonzero", bench_fill_poly_nonzero);
+	bench(g, dname, "fill_poly_aa", bench_fill_polyaa);
+	bench(g, dname, "blit_64x64", bench_blit);
+	bench(g, dname, "composite_64x64", bench_composite);
+	bench(g, dname, "fade_64x64", bench_fade);
+	bench(g, dname, "scale_64x64", bench_scale);
+	bench(g, dname, "rotate_64x64", bench_rotate);
+	bench(g, dname, "gradient_quarter", bench_gradient);
+	bench(g, dname, "radial_circle", bench_radial);
+	bench(g, dname, "scroll", bench_scroll);
+	bench(g, dname, "copy_64x64", bench_copy);
+	bench(g, dname, "flush_16x16", bench_flush);
+	#if GDISP_NEED_ASYNC
+		bench(g, dname, "flush_async_16x16", bench_flush_async);
+		bench(g, dname, "blit_async_64x64", bench_blit_async);
+	#endif
+	#if GDISP_NEED_CMDLIST
+		bench(g, dname, "cmdlist_32", bench_cmdlist);
+	#endif
+	#if GDISP_NEED_TILER
+		if (!gdispGTilerInit(g, &tiler, 0, 0))
+			printf("# %s,tiler_32: drawn without threads\n", dname);
+		bench(g, dname, "tiler_32", bench_tiler);
+		gdispTilerDeinit(&tiler);
+	#endif
+	#if GDISP_NEED_CLIPREGION
+		benchregion(g, dname);
+	#endif
+	#if GDISP_NEED_VIEWS
+		benchview(g, dname);
+	#endif
+
+	for(i = 0; i < sizeof(fonts)/sizeof(fonts[0]); i++) {
+		// gdispOpenFont() returns a default font if the font is not compiled in
+		font = gdispOpenFont(fonts[i]);
+		if (strcmp(gdispGetFontName(font), fonts[i])) {
+			printf("# %s,text_%s: font not included\n", dname, fonts[i]);
+			continue;
+		}
+		sprintf(tname, "text_%s", fonts[i]);
+		bench(g, dname, tname, bench_text);
+		sprintf(tname, "filltext_%s", fonts[i]);
+		bench(g, dname, tname, bench_fill_text);
+		gdispCloseFont(font);
+	}
+
+	benchimage(g, dname, "image_native", gfileOpenMemory(nativeimg, "rb"));
+	benchimage(g, dname, "image_bmp", gfileOpen("bench.bmp", "rb"));
+	benchimage(g, dname, "image_gif", gfileOpen("bench.gif", "rb"));
+	benchimage(g, dname, "image_jpg", gfileOpen("bench.jpg", "rb"));
+	benchimage(g, dname, "image_png", gfileOpen("bench.png", "rb"));
+
+	benchgwin(g, dname);
+}
+
+int main(void) {
+	GDisplay	*pixmap;
+	gPixel		*p;
+	unsigned	i;
+
+	// Initialize uGFX and the underlying system
+	gfxInit();
+
+	// The blit source
+	for(i = 0; i < 64*64; i++)
+		blitbuf[i] = gdispBlendColor(GFX_RED, GFX_BLUE, (gU8)(i/16));
+
+	// The composite source - the same colors fading out from left to right
+	for(i = 0; i < 64*64; i++)
+		argbbuf[i] = ((gU32)(255 - (i & 63)*4) << 24) | ((gU32)(255 - i/16) << 16) | (gU32)(i/16);
+
+	// A native image in the display pixel format
+	nativeimg = gfxAlloc(8 + NATIVE_WIDTH*NATIVE_HEIGHT*sizeof(gPixel));
+	nativeimg[0] = 'N';
+	nativeimg[1] = 'I';
+	nativeimg[2] = NATIVE_WIDTH >> 8;
+	nativeimg[3] = NATIVE_WIDTH & 0xFF;
+	nativeimg[4] = NATIVE_HEIGHT >> 8;
+	nativeimg[5] = NATIVE_HEIGHT & 0xFF;
+	nativeimg[6] = GDISP_PIXELFORMAT >> 8;
+	nativeimg[7] = GDISP_PIXELFORMAT & 0xFF;
+	p = (gPixel *)(nativeimg + 8);
+	for(i = 0; i < NATIVE_WIDTH*NATIVE_HEIGHT; i++)
+		p[i] = gdispBlendColor(GFX_GREEN, GFX_YELLOW, (gU8)(i/16));
+
+	gwinSetDefaultFont(gdispOpenFont("UI2"));
+	gwinSetDefaultStyle(&WhiteWidgetStyle, gFalse);
+
+	printf("# uGFX rendering benchmark: %d ms per test\n", BENCH_TIME);
+	#if GDISP_NEED_PIXELKERNELS
+		printf("# Pixel kernels: %s\n", gdispKernel->name);
+	#endif
+	#if GDISP_NEED_ASYNC
+		gdispFenceInit(&fence);
+	#endif
+	printf("display,test,calls,pixels,ns_per_call,pixels_per_sec\n");
+
+	benchdisplay(gdispGetDisplay(0), "teststub");
+
+	pixmap = gdispPixmapCreate(GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT);
+	benchdisplay(pixmap, "pixmap");
+	gdispPixmapDelete(pixmap);
+
+	#if GDISP_NEED_ASYNC
+		gdispFenceDeinit(&fence);
+	#endif
+	gfxFree(nativeimg);
+	return 0;
+}
@@ -0,0 +1,593 @@
+/**
+ * This file was generated from "bench.bmp" using...
+ *
+ *	file2c -dcsn bench_bmp bench.bmp romfs_bench_bmp.h
+ *
+ */
+static const char bench_bmp[] = {
+	0x42, 0x4D, 0x26, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x28, 0x00,
+	0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x13, 0x0B, 0x00, 0x00, 0x13, 0x0B, 0x00, 0x00, 0xFC, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x66, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2B,
+	0x00, 0x00, 0x00, 0x2B, 0x33, 0x00, 0x00, 0x2B, 0x66, 0x00, 0x00, 0x2B, 0x99, 0x00, 0x00, 0x2B,
+	0xCC, 0x00, 0x00, 0x2B, 0xFF, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 0x33, 0x00, 0x00, 0x55,
+	0x66, 0x00, 0x00, 0x55, 0x99, 0x00, 0x00, 0x55, 0xCC, 0x00, 0x00, 0x55, 0xFF, 0x00, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0x80, 0x66, 0x00, 0x00, 0x80, 0x99, 0x00, 0x00, 0x80,
+	0xCC, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, 0xAA, 0x33, 0x00, 0x00, 0xAA,
+	0x66, 0x00, 0x00, 0xAA, 0x99, 0x00, 0x00, 0xAA, 0xCC, 0x00, 0x00, 0xAA, 0xFF, 0x00, 0x00, 0xD5,
+	0x00, 0x00, 0x00, 0xD5, 0x33, 0x00, 0x00, 0xD5, 0x66, 0x00, 0x00, 0xD5, 0x99, 0x00, 0x00, 0xD5,
+	0xCC, 0x00, 0x00, 0xD5, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x33, 0x00, 0x00, 0xFF,
+	0x66, 0x00, 0x00, 0xFF, 0x99, 0x00, 0x00, 0xFF, 0xCC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x33, 0x00,
+	0x00, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x66, 0x00, 0x33, 0x00, 0x99, 0x00, 0x33, 0x00,
+	0xCC, 0x00, 0x33, 0x00, 0xFF, 0x00, 0x33, 0x2B, 0x00, 0x00, 0x33, 0x2B, 0x33, 0x00, 0x33, 0x2B,
+	0x66, 0x00, 0x33, 0x2B, 0x99, 0x00, 0x33, 0x2B, 0xCC, 0x00, 0x33, 0x2B, 0xFF, 0x00, 0x33, 0x55,
+	0x00, 0x00, 0x33, 0x55, 0x33, 0x00, 0x33, 0x55, 0x66, 0x00, 0x33, 0x55, 0x99, 0x00, 0x33, 0x55,
+	0xCC, 0x00, 0x33, 0x55, 0xFF, 0x00, 0x33, 0x80, 0x00, 0x00, 0x33, 0x80, 0x33, 0x00, 0x33, 0x80,
+	0x66, 0x00, 0x33, 0x80, 0x99, 0x00, 0x33, 0x80, 0xCC, 0x00, 0x33, 0x80, 0xFF, 0x00, 0x33, 0xAA,
+	0x00, 0x00, 0x33, 0xAA, 0x33, 0x00, 0x33, 0xAA, 0x66, 0x00, 0x33, 0xAA, 0x99, 0x00, 0x33, 0xAA,
+	0xCC, 0x00, 0x33, 0xAA, 0xFF, 0x00, 0x33, 0xD5, 0x00, 0x00, 0x33, 0xD5, 0x33, 0x00, 0x33, 0xD5,
+	0x66, 0x00, 0x33, 0xD5, 0x99, 0x00, 0x33, 0xD5, 0xCC, 0x00, 0x33, 0xD5, 0xFF, 0x00, 0x33, 0xFF,
+	0x00, 0x00, 0x33, 0xFF, 0x33, 0x00, 0x33, 0xFF, 0x66, 0x00, 0x33, 0xFF, 0x99, 0x00, 0x33, 0xFF,
+	0xCC, 0x00, 0x33, 0xFF, 0xFF, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0x00, 0x33, 0x00, 0x66, 0x00,
+	0x66, 0x00, 0x66, 0x00, 0x99, 0x00, 0x66, 0x00, 0xCC, 0x00, 0x66, 0x00, 0xFF, 0x00, 0x66, 0x2B,
+	0x00, 0x00, 0x66, 0x2B, 0x33, 0x00, 0x66, 0x2B, 0x66, 0x00, 0x66, 0x2B, 0x99, 0x00, 0x66, 0x2B,
+	0xCC, 0x00, 0x66, 0x2B, 0xFF, 0x00, 0x66, 0x55, 0x00, 0x00, 0x66, 0x55, 0x33, 0x00, 0x66, 0x55,
+	0x66, 0x00, 0x66, 0x55, 0x99, 0x00, 0x66, 0x55, 0xCC, 0x00, 0x66, 0x55, 0xFF, 0x00, 0x66, 0x80,
+	0x00, 0x00, 0x66, 0x80, 0x33, 0x00, 0x66, 0x80, 0x66, 0x00, 0x66, 0x80, 0x99, 0x00, 0x66, 0x80,
+	0xCC, 0x00, 0x66, 0x80, 0xFF, 0x00, 0x66, 0xAA, 0x00, 0x00, 0x66, 0xAA, 0x33, 0x00, 0x66, 0xAA,
+	0x66, 0x00, 0x66, 0xAA, 0x99, 0x00, 0x66, 0xAA, 0xCC, 0x00, 0x66, 0xAA, 0xFF, 0x00, 0x66, 0xD5,
+	0x00, 0x00, 0x66, 0xD5, 0x33, 0x00, 0x66, 0xD5, 0x66, 0x00, 0x66, 0xD5, 0x99, 0x00, 0x66, 0xD5,
+	0xCC, 0x00, 0x66, 0xD5, 0xFF, 0x00, 0x66, 0xFF, 0x00, 0x00, 0x66, 0xFF, 0x33, 0x00, 0x66, 0xFF,
+	0x66, 0x00, 0x66, 0xFF, 0x99, 0x00, 0x66, 0xFF, 0xCC, 0x00, 0x66, 0xFF, 0xFF, 0x00, 0x99, 0x00,
+	0x00, 0x00, 0x99, 0x00, 0x33, 0x00, 0x99, 0x00, 0x66, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+	0xCC, 0x00, 0x99, 0x00, 0xFF, 0x00, 0x99, 0x2B, 0x00, 0x00, 0x99, 0x2B, 0x33, 0x00, 0x99, 0x2B,
+	0x66, 0x00, 0x99, 0x2B, 0x99, 0x00, 0x99, 0x2B, 0xCC, 0x00, 0x99, 0x2B, 0xFF, 0x00, 0x99, 0x55,
+	0x00, 0x00, 0x99, 0x55, 0x33, 0x00, 0x99, 0x55, 0x66, 0x00, 0x99, 0x55, 0x99, 0x00, 0x99, 0x55,
+	0xCC, 0x00, 0x99, 0x55, 0xFF, 0x00, 0x99, 0x80, 0x00, 0x00, 0x99, 0x80, 0x33, 0x00, 0x99, 0x80,
+	0x66, 0x00, 0x99, 0x80, 0x99, 0x00, 0x99, 0x80, 0xCC, 0x00, 0x99, 0x80, 0xFF, 0x00, 0x99, 0xAA,
+	0x00, 0x00, 0x99, 0xAA, 0x33, 0x00, 0x99, 0xAA, 0x66, 0x00, 0x99, 0xAA, 0x99, 0x00, 0x99, 0xAA,
+	0xCC, 0x00, 0x99, 0xAA, 0xFF, 0x00, 0x99, 0xD5, 0x00, 0x00, 0x99, 0xD5, 0x33, 0x00, 0x99, 0xD5,
+	0x66, 0x00, 0x99, 0xD5, 0x99, 0x00, 0x99, 0xD5, 0xCC, 0x00, 0x99, 0xD5, 0xFF, 0x00, 0x99, 0xFF,
+	0x00, 0x00, 0x99, 0xFF, 0x33, 0x00, 0x99, 0xFF, 0x66, 0x00, 0x99, 0xFF, 0x99, 0x00, 0x99, 0xFF,
+	0xCC, 0x00, 0x99, 0xFF, 0xFF, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x33, 0x00, 0xCC, 0x00,
+	0x66, 0x00, 0xCC, 0x00, 0x99, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0xFF, 0x00, 0xCC, 0x2B,
+	0x00, 0x00, 0xCC, 0x2B, 0x33, 0x00, 0xCC, 0x2B, 0x66, 0x00, 0xCC, 0x2B, 0x99, 0x00, 0xCC, 0x2B,
+	0xCC, 0x00, 0xCC, 0x2B, 0xFF, 0x00, 0xCC, 0x55, 0x00, 0x00, 0xCC, 0x55, 0x33, 0x00, 0xCC, 0x55,
+	0x66, 0x00, 0xCC, 0x55, 0x99, 0x00, 0xCC, 0x55, 0xCC, 0x00, 0xCC, 0x55, 0xFF, 0x00, 0xCC, 0x80,
+	0x00, 0x00, 0xCC, 0x80, 0x33, 0x00, 0xCC, 0x80, 0x66, 0x00, 0xCC, 0x80, 0x99, 0x00, 0xCC, 0x80,
+	0xCC, 0x00, 0xCC, 0x80, 0xFF, 0x00, 0xCC, 0xAA, 0x00, 0x00, 0xCC, 0xAA, 0x33, 0x00, 0xCC, 0xAA,
+	0x66, 0x00, 0xCC, 0xAA, 0x99, 0x00, 0xCC, 0xAA, 0xCC, 0x00, 0xCC, 0xAA, 0xFF, 0x00, 0xCC, 0xD5,
+	0x00, 0x00, 0xCC, 0xD5, 0x33, 0x00, 0xCC, 0xD5, 0x66, 0x00, 0xCC, 0xD5, 0x99, 0x00, 0xCC, 0xD5,
+	0xCC, 0x00, 0xCC, 0xD5, 0xFF, 0x00, 0xCC, 0xFF, 0x00, 0x00, 0xCC, 0xFF, 0x33, 0x00, 0xCC, 0xFF,
+	0x66, 0x00, 0xCC, 0xFF, 0x99, 0x00, 0xCC, 0xFF, 0xCC, 0x00, 0xCC, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
+	0x00, 0x00, 0xFF, 0x00, 0x33, 0x00, 0xFF, 0x00, 0x66, 0x00, 0xFF, 0x00, 0x99, 0x00, 0xFF, 0x00,
+	0xCC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x2B, 0x00, 0x00, 0xFF, 0x2B, 0x33, 0x00, 0xFF, 0x2B,
+	0x66, 0x00, 0xFF, 0x2B, 0x99, 0x00, 0xFF, 0x2B, 0xCC, 0x00, 0xFF, 0x2B, 0xFF, 0x00, 0xFF, 0x55,
+	0x00, 0x00, 0xFF, 0x55, 0x33, 0x00, 0xFF, 0x55, 0x66, 0x00, 0xFF, 0x55, 0x99, 0x00, 0xFF, 0x55,
+	0xCC, 0x00, 0xFF, 0x55, 0xFF, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x80, 0x33, 0x00, 0xFF, 0x80,
+	0x66, 0x00, 0xFF, 0x80, 0x99, 0x00, 0xFF, 0x80, 0xCC, 0x00, 0xFF, 0x80, 0xFF, 0x00, 0xFF, 0xAA,
+	0x00, 0x00, 0xFF, 0xAA, 0x33, 0x00, 0xFF, 0xAA, 0x66, 0x00, 0xFF, 0xAA, 0x99, 0x00, 0xFF, 0xAA,
+	0xCC, 0x00, 0xFF, 0xAA, 0xFF, 0x00, 0xFF, 0xD5, 0x00, 0x00, 0xFF, 0xD5, 0x33, 0x00, 0xFF, 0xD5,
+	0x66, 0x00, 0xFF, 0xD5, 0x99, 0x00, 0xFF, 0xD5, 0xCC, 0x00, 0xFF, 0xD5, 0xFF, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0x33, 0x00, 0xFF, 0xFF, 0x66, 0x00, 0xFF, 0xFF, 0x99, 0x00, 0xFF, 0xFF,
+	0xCC, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x30, 0x30, 0x30, 0x30, 0x36,
+	0x36, 0x60, 0x60, 0x66, 0x66, 0x90, 0x66, 0x90, 0x90, 0x96, 0x96, 0x96, 0x96, 0xC6, 0xC0, 0xC6,
+	0xC6, 0xC6, 0xC6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+	0x2B, 0x56, 0x56, 0x56, 0x56, 0x81, 0x56, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xAC, 0xAC, 0xAC,
+	0xAC, 0xAC, 0xAC, 0xD7, 0xD7, 0xD7, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x0D,
+	0x0D, 0x0E, 0x0E, 0x14, 0x14, 0x15, 0x14, 0x15, 0x15, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x1C, 0x22,
+	0x22, 0x22, 0x22, 0x29, 0x29, 0x29, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+	0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+	0x62, 0x62, 0x62, 0x62, 0x62, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x06, 0x36, 0x30, 0x60, 0x30,
+	0x60, 0x36, 0x66, 0x60, 0x90, 0x66, 0x90, 0x66, 0x96, 0x90, 0xC0, 0x96, 0xC6, 0x96, 0xC6, 0xC0,
+	0xF0, 0xC6, 0xF6, 0xC6, 0xF6, 0xF6, 0x00, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x2B, 0x56, 0x2B,
+	0x56, 0x2B, 0x56, 0x56, 0x81, 0x56, 0x81, 0x56, 0x81, 0x81, 0xAC, 0x81, 0xAC, 0x81, 0xAC, 0xAC,
+	0xD7, 0xAC, 0xD7, 0xAC, 0xD7, 0xD7, 0x00, 0x00, 0x07, 0x00, 0x07, 0x06, 0x0D, 0x07, 0x0E, 0x07,
+	0x0E, 0x0D, 0x14, 0x0E, 0x15, 0x14, 0x15, 0x14, 0x1B, 0x15, 0x1C, 0x1B, 0x22, 0x1B, 0x22, 0x1C,
+	0x23, 0x22, 0x29, 0x22, 0x29, 0x29, 0x68, 0x37, 0x68, 0x62, 0x68, 0x61, 0x68, 0x62, 0x68, 0x61,
+	0x68, 0x62, 0x68, 0x61, 0x92, 0x62, 0x92, 0x61, 0x92, 0x62, 0x92, 0x61, 0x92, 0x62, 0x92, 0x61,
+	0x92, 0x62, 0x92, 0x61, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x30, 0x30, 0x30, 0x60,
+	0x36, 0x60, 0x60, 0x66, 0x60, 0x66, 0x66, 0x90, 0x90, 0x96, 0x96, 0xC0, 0x96, 0xC0, 0xC6, 0xC6,
+	0xC6, 0xC6, 0xC6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x56,
+	0x2B, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x81, 0x81, 0x81, 0x81, 0xAC, 0x81, 0xAC, 0xAC, 0xAC,
+	0xAC, 0xAC, 0xAC, 0xD7, 0xD7, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x07, 0x07, 0x0E,
+	0x0D, 0x0E, 0x0E, 0x14, 0x0E, 0x14, 0x14, 0x15, 0x15, 0x1B, 0x1B, 0x1C, 0x1B, 0x1C, 0x22, 0x22,
+	0x22, 0x22, 0x22, 0x29, 0x29, 0x29, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+	0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x8C, 0x62, 0x62, 0x62, 0x8C,
+	0x62, 0x62, 0x62, 0x8C, 0x62, 0x00, 0x01, 0x00, 0x06, 0x00, 0x31, 0x06, 0x30, 0x30, 0x61, 0x30,
+	0x60, 0x36, 0x67, 0x60, 0x66, 0x60, 0x97, 0x66, 0x96, 0x90, 0xC1, 0x96, 0xC6, 0x96, 0xC7, 0xC6,
+	0xC6, 0xC6, 0xF7, 0xC6, 0xF6, 0xF6, 0x06, 0x00, 0x00, 0x00, 0x31, 0x00, 0x2B, 0x2B, 0x5C, 0x2B,
+	0x56, 0x2B, 0x5C, 0x56, 0x56, 0x56, 0x87, 0x56, 0x81, 0x81, 0xB2, 0x81, 0xAC, 0x81, 0xB2, 0xAC,
+	0xAC, 0xAC, 0xDD, 0xAC, 0xD7, 0xD7, 0x2A, 0x00, 0x06, 0x00, 0x31, 0x06, 0x07, 0x07, 0x38, 0x07,
+	0x0E, 0x0D, 0x3E, 0x0E, 0x14, 0x0E, 0x45, 0x14, 0x1B, 0x15, 0x46, 0x1B, 0x22, 0x1B, 0x4C, 0x22,
+	0x22, 0x22, 0x53, 0x22, 0x29, 0x29, 0x68, 0x62, 0x68, 0x61, 0x68, 0x62, 0x68, 0x61, 0x92, 0x62,
+	0x68, 0x61, 0x92, 0x62, 0x68, 0x61, 0x92, 0x62, 0x92, 0x61, 0x92, 0x62, 0x92, 0x61, 0x92, 0x62,
+	0x92, 0x61, 0x92, 0x62, 0x92, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x30, 0x30, 0x30, 0x30, 0x36,
+	0x36, 0x60, 0x60, 0x66, 0x66, 0x66, 0x66, 0x90, 0x90, 0x96, 0x96, 0x96, 0x96, 0xC6, 0xC0, 0xC6,
+	0xC6, 0xF0, 0xC6, 0xF6, 0xF6, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+	0x2B, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xAC, 0xAC, 0xAC,
+	0xAC, 0xD7, 0xAC, 0xD7, 0xD7, 0xD7, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x0D,
+	0x0D, 0x0E, 0x0E, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x1C, 0x22,
+	0x22, 0x23, 0x22, 0x29, 0x29, 0x29, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+	0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x8C,
+	0x62, 0x8C, 0x62, 0x8C, 0x62, 0x00, 0x01, 0x00, 0x31, 0x00, 0x31, 0x06, 0x31, 0x30, 0x61, 0x30,
+	0x61, 0x36, 0x67, 0x60, 0x91, 0x66, 0x91, 0x66, 0x97, 0x90, 0xC1, 0x96, 0xC7, 0x96, 0xC7, 0xC0,
+	0xF1, 0xC6, 0xF7, 0xC6, 0xF7, 0xF6, 0x06, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x2B, 0x5C, 0x2B,
+	0x5C, 0x2B, 0x5C, 0x56, 0x87, 0x56, 0x87, 0x56, 0x87, 0x81, 0xB2, 0x81, 0xB2, 0x81, 0xB2, 0xAC,
+	0xDD, 0xAC, 0xDD, 0xAC, 0xDD, 0xD7, 0x2A, 0x00, 0x31, 0x00, 0x31, 0x06, 0x31, 0x07, 0x38, 0x07,
+	0x38, 0x0D, 0x3E, 0x0E, 0x3F, 0x14, 0x3F, 0x14, 0x45, 0x15, 0x46, 0x1B, 0x4C, 0x1B, 0x4C, 0x1C,
+	0x4D, 0x22, 0x53, 0x22, 0x53, 0x29, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62,
+	0x92, 0x62, 0x68, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62,
+	0x92, 0x62, 0x92, 0x62, 0x92, 0x00, 0x00, 0x01, 0x00, 0x00, 0x06, 0x30, 0x30, 0x30, 0x30, 0x61,
+	0x36, 0x60, 0x60, 0x66, 0x60, 0x66, 0x90, 0x91, 0x90, 0x96, 0x96, 0xC0, 0x96, 0xC0, 0xC6, 0xC7,
+	0xC6, 0xC6, 0xC6, 0xF6, 0xF6, 0xF6, 0x00, 0x06, 0x00, 0x00, 0x00, 0x31, 0x2B, 0x2B, 0x2B, 0x5C,
+	0x2B, 0x56, 0x56, 0x5C, 0x56, 0x56, 0x81, 0x87, 0x81, 0x81, 0x81, 0xB2, 0x81, 0xAC, 0xAC, 0xB2,
+	0xAC, 0xAC, 0xAC, 0xDD, 0xD7, 0xD7, 0x00, 0x2A, 0x00, 0x00, 0x06, 0x07, 0x07, 0x07, 0x07, 0x38,
+	0x0D, 0x0E, 0x0E, 0x14, 0x0E, 0x14, 0x15, 0x3F, 0x15, 0x1B, 0x1B, 0x1C, 0x1B, 0x1C, 0x22, 0x4C,
+	0x22, 0x22, 0x22, 0x29, 0x29, 0x29, 0x62, 0x68, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x68,
+	0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x92, 0x62, 0x62, 0x62, 0x92, 0x62, 0x62, 0x62, 0x92,
+	0x62, 0x8C, 0x62, 0x92, 0x62, 0x00, 0x01, 0x00, 0x07, 0x00, 0x31, 0x06, 0x31, 0x30, 0x61, 0x30,
+	0x61, 0x36, 0x67, 0x60, 0x67, 0x60, 0x97, 0x66, 0x97, 0x90, 0xC1, 0x96, 0xC1, 0x96, 0xC7, 0xC6,
+	0xC7, 0xC6, 0xF7, 0xC6, 0xF7, 0xF6, 0x06, 0x00, 0x06, 0x00, 0x31, 0x00, 0x31, 0x2B, 0x5C, 0x2B,
+	0x5C, 0x2B, 0x5C, 0x56, 0x5C, 0x56, 0x87, 0x56, 0x87, 0x81, 0xB2, 0x81, 0xB2, 0x81, 0xB2, 0xAC,
+	0xB2, 0xAC, 0xDD, 0xAC, 0xDD, 0xD7, 0x2A, 0x00, 0x30, 0x00, 0x31, 0x06, 0x31, 0x07, 0x38, 0x07,
+	0x38, 0x0D, 0x3E, 0x0E, 0x3E, 0x0E, 0x45, 0x14, 0x45, 0x15, 0x46, 0x1B, 0x46, 0x1B, 0x4C, 0x22,
+	0x4C, 0x22, 0x53, 0x22, 0x53, 0x29, 0x93, 0x62, 0x68, 0x62, 0x92, 0x62, 0x68, 0x62, 0x93, 0x62,
+	0x68, 0x62, 0x92, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x93, 0x62,
+	0x92, 0x62, 0x92, 0x62, 0x92, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x31, 0x30, 0x31, 0x30, 0x37,
+	0x36, 0x61, 0x60, 0x67, 0x66, 0x91, 0x66, 0x91, 0x90, 0x97, 0x96, 0x97, 0x96, 0xC7, 0xC0, 0xC7,
+	0xC6, 0xC7, 0xC6, 0xF7, 0xF6, 0xF7, 0x00, 0x06, 0x06, 0x06, 0x00, 0x31, 0x31, 0x31, 0x2B, 0x31,
+	0x31, 0x5C, 0x56, 0x5C, 0x5C, 0x87, 0x56, 0x87, 0x87, 0x87, 0x81, 0x87, 0x87, 0xB2, 0xAC, 0xB2,
+	0xB2, 0xB2, 0xAC, 0xDD, 0xDD, 0xDD, 0x00, 0x2A, 0x00, 0x30, 0x00, 0x31, 0x07, 0x31, 0x07, 0x37,
+	0x0D, 0x38, 0x0E, 0x3E, 0x14, 0x3F, 0x14, 0x3F, 0x15, 0x45, 0x1B, 0x45, 0x1B, 0x4C, 0x1C, 0x4C,
+	0x22, 0x4C, 0x22, 0x53, 0x29, 0x53, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62,
+	0x62, 0x68, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x92, 0x62, 0x8C,
+	0x62, 0x92, 0x62, 0x8C, 0x62, 0x00, 0x01, 0x00, 0x31, 0x00, 0x31, 0x06, 0x37, 0x30, 0x61, 0x30,
+	0x61, 0x36, 0x67, 0x60, 0x91, 0x66, 0x91, 0x66, 0x97, 0x90, 0xC1, 0x96, 0xC7, 0x96, 0xC7, 0xC0,
+	0xF1, 0xC6, 0xF7, 0xC6, 0xF7, 0xF6, 0x06, 0x00, 0x31, 0x00, 0x31, 0x00, 0x31, 0x2B, 0x5C, 0x2B,
+	0x5C, 0x2B, 0x5C, 0x56, 0x87, 0x56, 0x87, 0x56, 0x87, 0x81, 0xB2, 0x81, 0xB2, 0x81, 0xB2, 0xAC,
+	0xDD, 0xAC, 0xDD, 0xAC, 0xDD, 0xD7, 0x2A, 0x00, 0x31, 0x00, 0x31, 0x06, 0x37, 0x07, 0x38, 0x07,
+	0x38, 0x0D, 0x3E, 0x0E, 0x3F, 0x14, 0x3F, 0x14, 0x45, 0x15, 0x46, 0x1B, 0x4C, 0x1B, 0x4C, 0x1C,
+	0x4D, 0x22, 0x53, 0x22, 0x53, 0x29, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x92, 0x62, 0x92, 0x62,
+	0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62,
+	0x92, 0x62, 0x92, 0x62, 0x92, 0x00, 0x01, 0x01, 0x00, 0x01, 0x07, 0x31, 0x30, 0x31, 0x31, 0x61,
+	0x36, 0x61, 0x61, 0x67, 0x60, 0x67, 0x67, 0x91, 0x90, 0x97, 0x97, 0xC1, 0x96, 0xC1, 0xC7, 0xC7,
+	0xC6, 0xC7, 0xC7, 0xF7, 0xF6, 0xF7, 0x06, 0x06, 0x06, 0x06, 0x06, 0x31, 0x31, 0x31, 0x31, 0x5C,
+	0x31, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x87, 0x87, 0x87, 0x87, 0xB2, 0x87, 0xB2, 0xB2, 0xB2,
+	0xB2, 0xB2, 0xB2, 0xDD, 0xDD, 0xDD, 0x2A, 0x2A, 0x00, 0x2A, 0x30, 0x31, 0x07, 0x31, 0x31, 0x38,
+	0x0D, 0x38, 0x38, 0x3E, 0x0E, 0x3E, 0x3E, 0x3F, 0x15, 0x45, 0x45, 0x46, 0x1B, 0x46, 0x4C, 0x4C,
+	0x22, 0x4C, 0x4C, 0x53, 0x29, 0x53, 0x62, 0x68, 0x62, 0x62, 0x62, 0x68, 0x62, 0x62, 0x62, 0x68,
+	0x62, 0x62, 0x62, 0x92, 0x62, 0x62, 0x62, 0x92, 0x62, 0x62, 0x62, 0x92, 0x62, 0x8C, 0x62, 0x92,
+	0x62, 0x8C, 0x8C, 0x92, 0x62, 0x00, 0x01, 0x00, 0x07, 0x00, 0x31, 0x07, 0x31, 0x30, 0x61, 0x30,
+	0x61, 0x36, 0x67, 0x61, 0x67, 0x60, 0x97, 0x66, 0x97, 0x90, 0xC1, 0x97, 0xC7, 0x96, 0xC7, 0xC6,
+	0xC7, 0xC6, 0xF7, 0xC7, 0xF7, 0xF6, 0x06, 0x06, 0x06, 0x06, 0x37, 0x06, 0x31, 0x31, 0x5C, 0x31,
+	0x5C, 0x31, 0x62, 0x5C, 0x5C, 0x5C, 0x87, 0x5C, 0x87, 0x87, 0xB8, 0x87, 0xB2, 0x87, 0xB2, 0xB2,
+	0xB2, 0xB2, 0xE3, 0xB2, 0xDD, 0xDD, 0x2A, 0x00, 0x30, 0x00, 0x31, 0x30, 0x31, 0x07, 0x38, 0x07,
+	0x38, 0x0D, 0x3E, 0x38, 0x3E, 0x0E, 0x45, 0x14, 0x45, 0x15, 0x46, 0x45, 0x4C, 0x1B, 0x4C, 0x22,
+	0x4C, 0x22, 0x53, 0x4C, 0x53, 0x29, 0x93, 0x62, 0x68, 0x62, 0x93, 0x62, 0x68, 0x62, 0x93, 0x62,
+	0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62,
+	0x92, 0x62, 0x93, 0x62, 0x92, 0x00, 0x01, 0x01, 0x01, 0x07, 0x01, 0x31, 0x31, 0x31, 0x31, 0x37,
+	0x37, 0x61, 0x61, 0x67, 0x67, 0x67, 0x67, 0x91, 0x91, 0x97, 0x97, 0x97, 0x97, 0xC7, 0xC1, 0xC7,
+	0xC7, 0xF1, 0xC7, 0xF7, 0xF7, 0xF7, 0x06, 0x06, 0x06, 0x06, 0x06, 0x31, 0x31, 0x31, 0x31, 0x31,
+	0x31, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0xB2, 0xB2, 0xB2,
+	0xB2, 0xDD, 0xB2, 0xDD, 0xDD, 0xDD, 0x2A, 0x2A, 0x2A, 0x30, 0x2A, 0x31, 0x31, 0x31, 0x31, 0x37,
+	0x37, 0x38, 0x38, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x45, 0x45, 0x45, 0x45, 0x4C, 0x46, 0x4C,
+	0x4C, 0x4D, 0x4C, 0x53, 0x53, 0x53, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68,
+	0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92,
+	0x62, 0x92, 0x62, 0x92, 0x8C, 0x00, 0x01, 0x01, 0x31, 0x01, 0x31, 0x07, 0x31, 0x31, 0x61, 0x31,
+	0x61, 0x37, 0x67, 0x61, 0x91, 0x67, 0x91, 0x67, 0x97, 0x91, 0xC1, 0x97, 0xC7, 0x97, 0xC7, 0xC1,
+	0xF1, 0xC7, 0xF7, 0xC7, 0xF7, 0xF7, 0x0C, 0x06, 0x37, 0x06, 0x31, 0x06, 0x37, 0x31, 0x62, 0x31,
+	0x62, 0x31, 0x5C, 0x5C, 0x8D, 0x5C, 0x8D, 0x5C, 0x8D, 0x87, 0xB2, 0x87, 0xB8, 0x87, 0xB8, 0xB2,
+	0xE3, 0xB2, 0xDD, 0xB2, 0xE3, 0xDD, 0x2A, 0x2A, 0x31, 0x2A, 0x31, 0x30, 0x31, 0x31, 0x38, 0x31,
+	0x38, 0x37, 0x3E, 0x38, 0x3F, 0x3E, 0x3F, 0x3E, 0x45, 0x3F, 0x46, 0x45, 0x4C, 0x45, 0x4C, 0x46,
+	0x4D, 0x4C, 0x53, 0x4C, 0x53, 0x53, 0x68, 0x62, 0x93, 0x62, 0x68, 0x62, 0x92, 0x62, 0x92, 0x62,
+	0x93, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62,
+	0x93, 0x62, 0x92, 0x62, 0x92, 0x00, 0x01, 0x01, 0x01, 0x01, 0x07, 0x31, 0x31, 0x31, 0x31, 0x61,
+	0x37, 0x61, 0x61, 0x67, 0x61, 0x67, 0x91, 0x91, 0x91, 0x97, 0x97, 0xC1, 0x97, 0xC1, 0xC7, 0xC7,
+	0xC7, 0xC7, 0xC7, 0xF7, 0xF7, 0xF7, 0x06, 0x06, 0x06, 0x06, 0x06, 0x31, 0x31, 0x31, 0x31, 0x5C,
+	0x31, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x87, 0x87, 0x87, 0x87, 0x87, 0xB2, 0x87, 0xB2, 0xB2, 0xB2,
+	0xB2, 0xB2, 0xB2, 0xDD, 0xDD, 0xDD, 0x2A, 0x2A, 0x2A, 0x2A, 0x30, 0x31, 0x31, 0x31, 0x31, 0x38,
+	0x37, 0x38, 0x38, 0x3E, 0x38, 0x3E, 0x3F, 0x3F, 0x3F, 0x45, 0x45, 0x46, 0x45, 0x46, 0x4C, 0x4C,
+	0x4C, 0x4C, 0x4C, 0x53, 0x53, 0x53, 0x68, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x68, 0x92,
+	0x62, 0x68, 0x62, 0x92, 0x62, 0x68, 0x68, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x92, 0x92,
+	0x62, 0x92, 0x8C, 0x92, 0x62, 0x00, 0x02, 0x01, 0x07, 0x01, 0x32, 0x07, 0x31, 0x31, 0x62, 0x31,
+	0x61, 0x37, 0x68, 0x61, 0x67, 0x61, 0x98, 0x67, 0x97, 0x91, 0xC2, 0x97, 0xC1, 0x97, 0xC8, 0xC7,
+	0xC7, 0xC7, 0xF8, 0xC7, 0xF7, 0xF7, 0x0C, 0x06, 0x0C, 0x06, 0x37, 0x06, 0x37, 0x31, 0x62, 0x31,
+	0x62, 0x31, 0x62, 0x5C, 0x62, 0x5C, 0x8D, 0x5C, 0x8D, 0x87, 0xB8, 0x87, 0xB8, 0x87, 0xB8, 0xB2,
+	0xB8, 0xB2, 0xE3, 0xB2, 0xE3, 0xDD, 0x54, 0x2A, 0x30, 0x2A, 0x5B, 0x30, 0x31, 0x31, 0x62, 0x31,
+	0x38, 0x37, 0x68, 0x38, 0x3E, 0x38, 0x6F, 0x3E, 0x45, 0x3F, 0x70, 0x45, 0x46, 0x45, 0x76, 0x4C,
+	0x4C, 0x4C, 0x7D, 0x4C, 0x53, 0x53, 0x93, 0x62, 0x68, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62,
+	0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62,
+	0x92, 0x62, 0x93, 0x62, 0x92, 0x00, 0x01, 0x01, 0x01, 0x07, 0x01, 0x31, 0x31, 0x31, 0x31, 0x37,
+	0x37, 0x61, 0x61, 0x67, 0x67, 0x91, 0x67, 0x91, 0x91, 0x97, 0x97, 0x97, 0x97, 0xC7, 0xC1, 0xC7,
+	0xC7, 0xC7, 0xC7, 0xF7, 0xF7, 0xF7, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x37, 0x31, 0x37, 0x31, 0x37,
+	0x31, 0x62, 0x5C, 0x62, 0x5C, 0x8D, 0x5C, 0x8D, 0x87, 0x8D, 0x87, 0x8D, 0x87, 0xB8, 0xB2, 0xB8,
+	0xB2, 0xB8, 0xB2, 0xE3, 0xDD, 0xE3, 0x2A, 0x2A, 0x2A, 0x30, 0x2A, 0x31, 0x31, 0x31, 0x31, 0x37,
+	0x37, 0x38, 0x38, 0x3E, 0x3E, 0x3F, 0x3E, 0x3F, 0x3F, 0x45, 0x45, 0x45, 0x45, 0x4C, 0x46, 0x4C,
+	0x4C, 0x4C, 0x4C, 0x53, 0x53, 0x53, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68, 0x62, 0x68,
+	0x62, 0x68, 0x62, 0x68, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92, 0x62, 0x92,
+	0x8C, 0x92, 0x8C, 0x92, 0x8C, 0x00, 0x02, 0x01, 0x32, 0x01, 0x32, 0x07, 0x38, 0x31, 0x62, 0x31,
+	0x62, 0x37, 0x68, 0x61, 0x92, 0x67, 0x92, 0x67, 0x98, 0x91, 0xC2, 0x97, 0xC8, 0x97, 0xC8, 0xC1,
+	0xF2, 0xC7, 0xF8, 0xC7, 0xF8, 0xF7, 0x0C, 0x06, 0x37, 0x06, 0x37, 0x06, 0x37, 0x31, 0x62, 0x31,
+	0x62, 0x31, 0x62, 0x5C, 0x8D, 0x5C, 0x8D, 0x5C, 0x8D, 0x87, 0xB8, 0x87, 0xB8, 0x87, 0xB8, 0xB2,
+	0xE3, 0xB2, 0xE3, 0xB2, 0xE3, 0xDD, 0x54, 0x2A, 0x5B, 0x2A, 0x5B, 0x30, 0x61, 0x31, 0x62, 0x31,
+	0x62, 0x37, 0x68, 0x38, 0x69, 0x3E, 0x69, 0x3E, 0x6F, 0x3F, 0x70, 0x45, 0x76, 0x45, 0x76, 0x46,
+	0x77, 0x4C, 0x7D, 0x4C, 0x7D, 0x53, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62,
+	0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62,
+	0x93, 0x62, 0x93, 0x62, 0x93, 0x00, 0x01, 0x02, 0x01, 0x01, 0x07, 0x32, 0x31, 0x31, 0x31, 0x62,
+	0x37, 0x61, 0x61, 0x68, 0x61, 0x67, 0x67, 0x92, 0x91, 0x97, 0x97, 0xC2, 0x97, 0xC1, 0xC7, 0xC8,
+	0xC7, 0xC7, 0xC7, 0xF8, 0xF7, 0xF7, 0x0C, 0x0C, 0x06, 0x0C, 0x0C, 0x37, 0x31, 0x37, 0x37, 0x62,
+	0x31, 0x62, 0x62, 0x62, 0x5C, 0x62, 0x62, 0x8D, 0x87, 0x8D, 0x8D, 0xB8, 0x87, 0xB8, 0xB8, 0xB8,
+	0xB2, 0xB8, 0xB8, 0xE3, 0xDD, 0xE3, 0x2A, 0x54, 0x2A, 0x2A, 0x30, 0x5B, 0x31, 0x31, 0x31, 0x62,
+	0x37, 0x38, 0x38, 0x68, 0x38, 0x3E, 0x3E, 0x69, 0x3F, 0x45, 0x45, 0x70, 0x45, 0x46, 0x4C, 0x76,
+	0x4C, 0x4C, 0x4C, 0x7D, 0x53, 0x53, 0x68, 0x68, 0x62, 0x68, 0x68, 0x92, 0x62, 0x68, 0x68, 0x92,
+	0x62, 0x68, 0x68, 0x92, 0x62, 0x92, 0x68, 0x92, 0x62, 0x92, 0x92, 0x92, 0x62, 0x92, 0x92, 0x92,
+	0x62, 0x92, 0x92, 0x92, 0x8C, 0x00, 0x02, 0x01, 0x08, 0x01, 0x32, 0x07, 0x32, 0x31, 0x62, 0x31,
+	0x62, 0x37, 0x68, 0x61, 0x68, 0x61, 0x98, 0x67, 0x98, 0x91, 0xC2, 0x97, 0xC8, 0x97, 0xC8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x5C, 0x62, 0x5C, 0x8D, 0x5C, 0x8D, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xB8, 0xB2, 0xE3, 0xB2, 0xE3, 0xDD, 0x54, 0x2A, 0x5A, 0x2A, 0x5B, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x68, 0x38, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x76, 0x45, 0x76, 0x4C,
+	0x76, 0x4C, 0x7D, 0x4C, 0x7D, 0x53, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62,
+	0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62, 0x92, 0x62, 0x93, 0x62,
+	0x92, 0x62, 0x93, 0x8C, 0x92, 0x00, 0x01, 0x02, 0x01, 0x08, 0x01, 0x32, 0x31, 0x32, 0x31, 0x38,
+	0x37, 0x62, 0x61, 0x68, 0x67, 0x68, 0x67, 0x92, 0x91, 0x98, 0x97, 0x98, 0x97, 0xC8, 0xC1, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x62, 0x8D, 0x8D, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xB8, 0xE3, 0xB8, 0xE3, 0xE3, 0xE3, 0x2A, 0x54, 0x2A, 0x5A, 0x2A, 0x5B, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x68, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x45, 0x76, 0x46, 0x76,
+	0x4C, 0x77, 0x4C, 0x7D, 0x53, 0x7D, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x92,
+	0x68, 0x92, 0x68, 0x92, 0x68, 0x92, 0x68, 0x92, 0x68, 0x92, 0x68, 0x92, 0x92, 0x92, 0x92, 0x92,
+	0x92, 0x92, 0x92, 0x92, 0x92, 0x00, 0x02, 0x01, 0x32, 0x01, 0x32, 0x07, 0x32, 0x31, 0x62, 0x31,
+	0x62, 0x37, 0x68, 0x61, 0x92, 0x67, 0x92, 0x67, 0x98, 0x91, 0xC2, 0x97, 0xC8, 0x97, 0xC8, 0x00,
+	0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x8D, 0x62, 0x8D, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xE3, 0xB8, 0xE3, 0xB8, 0xE3, 0xE3, 0x54, 0x2A, 0x5B, 0x2A, 0x5B, 0x30, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x68, 0x38, 0x69, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x45, 0x76, 0x45, 0x76, 0x46,
+	0x77, 0x4C, 0x7D, 0x4C, 0x7D, 0x53, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62,
+	0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62,
+	0x93, 0x62, 0x93, 0x62, 0x93, 0x00, 0x02, 0x02, 0x01, 0x02, 0x08, 0x32, 0x31, 0x32, 0x32, 0x62,
+	0x37, 0x62, 0x62, 0x68, 0x61, 0x68, 0x92, 0x92, 0x91, 0x98, 0x98, 0xC2, 0x97, 0xC2, 0xC8, 0x00,
+	0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x8D, 0x8D, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xB8, 0xB8, 0xB8, 0xE3, 0xE3, 0xE3, 0x54, 0x54, 0x2A, 0x54, 0x5A, 0x5B, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x62, 0x68, 0x38, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x70, 0x45, 0x70, 0x76, 0x76,
+	0x4C, 0x76, 0x76, 0x7D, 0x53, 0x7D, 0x68, 0x93, 0x68, 0x68, 0x68, 0x92, 0x62, 0x68, 0x68, 0x93,
+	0x68, 0x92, 0x68, 0x92, 0x62, 0x92, 0x92, 0x93, 0x68, 0x92, 0x92, 0x92, 0x62, 0x92, 0x92, 0x93,
+	0x92, 0x92, 0x92, 0x92, 0x8C, 0x00, 0x02, 0x02, 0x08, 0x01, 0x32, 0x07, 0x32, 0x31, 0x62, 0x32,
+	0x62, 0x37, 0x68, 0x61, 0x68, 0x61, 0x98, 0x68, 0x98, 0x91, 0xC2, 0x97, 0xC2, 0x97, 0xC8, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x62, 0x8D, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xB8, 0xB8, 0xE9, 0xB8, 0xE3, 0xE3, 0x54, 0x54, 0x5A, 0x2A, 0x5B, 0x30, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x68, 0x38, 0x68, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x45, 0x70, 0x45, 0x76, 0x76,
+	0x76, 0x4C, 0x7D, 0x4C, 0x7D, 0x53, 0x93, 0x68, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x68,
+	0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x68, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x92,
+	0x93, 0x62, 0x93, 0x8C, 0x93, 0x00, 0x02, 0x02, 0x02, 0x08, 0x02, 0x32, 0x32, 0x32, 0x32, 0x38,
+	0x38, 0x62, 0x62, 0x68, 0x68, 0x92, 0x68, 0x92, 0x92, 0x98, 0x98, 0x98, 0x98, 0xC8, 0xC2, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x8D, 0x8D, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xB8, 0xB8, 0xB8, 0xE3, 0xE3, 0xE3, 0x54, 0x54, 0x54, 0x5A, 0x54, 0x5B, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x62, 0x68, 0x68, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x6F, 0x6F, 0x76, 0x70, 0x76,
+	0x76, 0x76, 0x76, 0x7D, 0x7D, 0x7D, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x92, 0x68, 0x92,
+	0x68, 0x92, 0x68, 0x92, 0x68, 0x92, 0x68, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+	0x92, 0x92, 0x92, 0x92, 0x92, 0x00, 0x02, 0x02, 0x32, 0x02, 0x32, 0x08, 0x38, 0x32, 0x62, 0x32,
+	0x62, 0x38, 0x68, 0x62, 0x92, 0x68, 0x92, 0x68, 0x98, 0x92, 0xC2, 0x98, 0xC8, 0x98, 0xC8, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xF8, 0x12, 0x0C, 0x3D, 0x0C, 0x3D, 0x0C, 0x3D, 0x37, 0x68, 0x37,
+	0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x62, 0x93, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xE9, 0xB8, 0xE9, 0xB8, 0xE9, 0xE3, 0x54, 0x54, 0x5B, 0x54, 0x5B, 0x5A, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x68, 0x62, 0x69, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x6F, 0x76, 0x6F, 0x76, 0x70,
+	0x77, 0x76, 0x7D, 0x76, 0x7D, 0x7D, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62,
+	0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62, 0x93, 0x62,
+	0x93, 0x8C, 0x93, 0x8C, 0x93, 0x00, 0x02, 0x02, 0x02, 0x02, 0x08, 0x32, 0x32, 0x32, 0x32, 0x62,
+	0x38, 0x62, 0x62, 0x68, 0x62, 0x68, 0x68, 0x92, 0x92, 0x98, 0x98, 0xC2, 0x98, 0xC2, 0xC8, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xF8, 0x0C, 0x12, 0x0C, 0x0C, 0x0C, 0x3D, 0x37, 0x37, 0x37, 0x68,
+	0x37, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x93, 0x8D, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xB8, 0xB8, 0xB8, 0xE9, 0xE3, 0xE3, 0x54, 0x54, 0x54, 0x54, 0x5A, 0x5B, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x62, 0x68, 0x62, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x70, 0x6F, 0x70, 0x76, 0x76,
+	0x76, 0x76, 0x76, 0x7D, 0x7D, 0x7D, 0x68, 0x93, 0x68, 0x68, 0x68, 0x93, 0x68, 0x92, 0x68, 0x93,
+	0x68, 0x92, 0x92, 0x93, 0x68, 0x92, 0x92, 0x93, 0x68, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x93,
+	0x92, 0x92, 0x92, 0x93, 0x92, 0x00, 0x03, 0x02, 0x08, 0x02, 0x33, 0x08, 0x32, 0x32, 0x63, 0x32,
+	0x62, 0x38, 0x69, 0x62, 0x68, 0x62, 0x99, 0x68, 0x98, 0x92, 0xC3, 0x98, 0xC8, 0x98, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xF8, 0x12, 0x0C, 0x12, 0x0C, 0x3D, 0x0C, 0x3D, 0x37, 0x68, 0x37,
+	0x68, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x62, 0x93, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xBE, 0xB8, 0xE9, 0xB8, 0xE9, 0xE3, 0x7E, 0x54, 0x5A, 0x54, 0x85, 0x5A, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x92, 0x62, 0x68, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x6F, 0x76, 0x6F, 0xA0, 0x76,
+	0x76, 0x76, 0xA7, 0x76, 0x7D, 0x7D, 0x93, 0x68, 0x93, 0x62, 0x93, 0x68, 0x93, 0x62, 0x93, 0x68,
+	0x93, 0x62, 0x93, 0x68, 0x93, 0x62, 0x93, 0x68, 0x93, 0x62, 0x93, 0x92, 0x93, 0x62, 0x93, 0x92,
+	0x93, 0x62, 0x93, 0x92, 0x93, 0x00, 0x02, 0x02, 0x02, 0x08, 0x02, 0x32, 0x32, 0x32, 0x32, 0x38,
+	0x38, 0x62, 0x62, 0x68, 0x68, 0x68, 0x68, 0x92, 0x92, 0x98, 0x98, 0x98, 0x98, 0xC8, 0xC2, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xF8, 0x0C, 0x12, 0x12, 0x12, 0x0C, 0x3D, 0x37, 0x3D, 0x37, 0x3D,
+	0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x93, 0x93, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xBE, 0xE9, 0xB8, 0xE9, 0xE3, 0xE9, 0x54, 0x54, 0x54, 0x5A, 0x54, 0x5B, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x62, 0x68, 0x68, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x6F, 0x6F, 0x76, 0x70, 0x76,
+	0x76, 0x77, 0x76, 0x7D, 0x7D, 0x7D, 0x68, 0x92, 0x68, 0x93, 0x68, 0x92, 0x68, 0x93, 0x68, 0x92,
+	0x68, 0x93, 0x68, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x93, 0x92, 0x92,
+	0x92, 0x93, 0x92, 0x92, 0x92, 0x00, 0x03, 0x02, 0x33, 0x02, 0x33, 0x08, 0x33, 0x32, 0x63, 0x32,
+	0x63, 0x38, 0x69, 0x62, 0x93, 0x68, 0x93, 0x68, 0x99, 0x92, 0xC3, 0x98, 0xC9, 0x98, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x93, 0x62, 0x93, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xE9, 0xB8, 0xE9, 0xB8, 0xE9, 0x00, 0x00, 0x54, 0x85, 0x54, 0x85, 0x5A, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x92, 0x62, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x93, 0x62, 0x93, 0x68, 0x93, 0x68,
+	0x93, 0x68, 0x93, 0x62, 0x93, 0x68, 0x93, 0x68, 0x93, 0x68, 0x93, 0x62, 0x93, 0x92, 0x93, 0x92,
+	0x93, 0x92, 0x93, 0x8C, 0x93, 0x00, 0x02, 0x03, 0x02, 0x02, 0x08, 0x33, 0x32, 0x32, 0x32, 0x63,
+	0x38, 0x62, 0x62, 0x69, 0x62, 0x68, 0x92, 0x93, 0x92, 0x98, 0x98, 0xC3, 0x98, 0xC2, 0xC8, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x93, 0x93, 0x93, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xBE, 0xBE, 0xBE, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x54, 0x54, 0x5A, 0x85, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x62, 0x92, 0x62, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x68, 0x92, 0x92, 0x93,
+	0x68, 0x92, 0x92, 0x93, 0x68, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x93, 0x92, 0x92, 0x92, 0x93,
+	0x92, 0x92, 0x92, 0x93, 0x92, 0x00, 0x03, 0x02, 0x09, 0x02, 0x33, 0x08, 0x33, 0x32, 0x63, 0x32,
+	0x63, 0x38, 0x69, 0x62, 0x69, 0x62, 0x99, 0x68, 0x99, 0x92, 0xC3, 0x98, 0xC3, 0x98, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0x00, 0x00, 0x68, 0x62, 0x93, 0x68, 0x93, 0x8D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xBE, 0xB8, 0xE9, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x54, 0x85, 0x5A, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x92, 0x62, 0x92, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x93, 0x62, 0x93, 0x68,
+	0x93, 0x68, 0x93, 0x68, 0x93, 0x62, 0x93, 0x92, 0x93, 0x68, 0x93, 0x92, 0x93, 0x62, 0x93, 0x92,
+	0x93, 0x92, 0x93, 0x92, 0x93, 0x00, 0x02, 0x03, 0x02, 0x09, 0x02, 0x33, 0x32, 0x33, 0x32, 0x39,
+	0x38, 0x63, 0x62, 0x69, 0x68, 0x93, 0x68, 0x93, 0x92, 0x99, 0x98, 0x99, 0x98, 0xC9, 0xC2, 0x00,
+	0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0x00, 0x00, 0x68, 0x93, 0x68, 0x93, 0x93, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xBE, 0xBE, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x54, 0x85, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x62, 0x92, 0x68, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x93, 0x68, 0x93,
+	0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93,
+	0x92, 0x93, 0x92, 0x93, 0x92, 0x00, 0x03, 0x02, 0x33, 0x02, 0x33, 0x08, 0x39, 0x32, 0x63, 0x32,
+	0x63, 0x38, 0x69, 0x62, 0x93, 0x68, 0x93, 0x68, 0x99, 0x92, 0xC3, 0x98, 0xC9, 0x98, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x93, 0x68, 0x99, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xEF, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x5A, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x92, 0x62, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x93, 0x68,
+	0x93, 0x68, 0x93, 0x68, 0x93, 0x68, 0x93, 0x68, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92,
+	0x93, 0x92, 0x93, 0x92, 0xBD, 0x00, 0x03, 0x03, 0x02, 0x03, 0x09, 0x33, 0x32, 0x33, 0x33, 0x63,
+	0x38, 0x63, 0x63, 0x69, 0x62, 0x69, 0x69, 0x93, 0x92, 0x99, 0x99, 0xC3, 0x98, 0xC3, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x93, 0x93, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x8C, 0x92, 0x62, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x93, 0x92, 0x93,
+	0x68, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93,
+	0x92, 0x93, 0x92, 0x93, 0x92, 0x00, 0x03, 0x02, 0x09, 0x02, 0x33, 0x08, 0x33, 0x32, 0x63, 0x32,
+	0x63, 0x38, 0x69, 0x62, 0x69, 0x62, 0x99, 0x68, 0x99, 0x92, 0xC3, 0x98, 0xC9, 0x98, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xF8, 0x18, 0x12, 0x18, 0x12, 0x43, 0x12, 0x43, 0x3D, 0x6E, 0x3D,
+	0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x99, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xE9, 0x7E, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x92, 0x62, 0x92, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x6F, 0xA0, 0x6F, 0xA0, 0x76,
+	0xA0, 0x76, 0xA7, 0x76, 0xA7, 0x7D, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x99, 0x68,
+	0x93, 0x68, 0x99, 0x92, 0x93, 0x68, 0x99, 0x92, 0x93, 0x68, 0x99, 0x92, 0x93, 0x92, 0x99, 0x92,
+	0x93, 0x92, 0xC3, 0x92, 0x93, 0x00, 0x03, 0x03, 0x03, 0x09, 0x03, 0x33, 0x33, 0x33, 0x33, 0x39,
+	0x39, 0x63, 0x63, 0x69, 0x69, 0x69, 0x69, 0x93, 0x93, 0x99, 0x99, 0x99, 0x99, 0xC9, 0xC3, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xF9, 0x12, 0x18, 0x12, 0x18, 0x12, 0x3D, 0x3D, 0x43, 0x3D, 0x43,
+	0x3D, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x99, 0x93, 0x99, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xFB, 0xFB, 0x00, 0x00, 0xE9, 0xEF, 0x7E, 0x7E, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x8C, 0x92, 0x92, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x99, 0x99, 0xA0, 0x9A, 0xA0,
+	0xA0, 0xA1, 0xA0, 0xA7, 0xA7, 0xA7, 0x68, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x93, 0x92, 0x93,
+	0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93,
+	0x92, 0x93, 0x92, 0x93, 0x92, 0x00, 0x03, 0x03, 0x33, 0x03, 0x33, 0x08, 0x33, 0x33, 0x63, 0x33,
+	0x63, 0x39, 0x69, 0x62, 0x93, 0x69, 0x93, 0x69, 0x99, 0x93, 0xC3, 0x98, 0xC9, 0x99, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xF9, 0x18, 0x12, 0x43, 0x12, 0x43, 0x12, 0x43, 0x3D, 0x6E, 0x3D,
+	0x6E, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x99, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0xFB,
+	0xFB, 0x00, 0x00, 0xBE, 0xEF, 0xE9, 0x7E, 0x7E, 0x85, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x92, 0x62, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x6F, 0xA0, 0x99, 0xA0, 0x9A,
+	0xA1, 0xA0, 0xA7, 0x76, 0xA7, 0xA7, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x93, 0x68,
+	0x99, 0x68, 0x93, 0x68, 0x93, 0x92, 0x93, 0x92, 0x99, 0x92, 0x93, 0x92, 0x93, 0x92, 0x93, 0x92,
+	0xC3, 0x92, 0x93, 0x92, 0xBD, 0x00, 0x03, 0x03, 0x03, 0x03, 0x09, 0x33, 0x33, 0x33, 0x33, 0x63,
+	0x39, 0x63, 0x63, 0x69, 0x63, 0x69, 0x93, 0x93, 0x93, 0x99, 0x99, 0xC3, 0x99, 0xC3, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0xF9, 0x18, 0x18, 0x12, 0x18, 0x18, 0x43, 0x3D, 0x43, 0x43, 0x6E,
+	0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x99, 0x93, 0x99, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB,
+	0x00, 0x00, 0xC4, 0xEF, 0xE9, 0xEF, 0x7E, 0x7E, 0x7E, 0x7E, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB,
+	0x00, 0x00, 0x8C, 0x92, 0x8C, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x9A, 0x99, 0x9A, 0xA0, 0xA0,
+	0xA0, 0xA0, 0xA0, 0xA7, 0xA7, 0xA7, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x93, 0x93, 0x93,
+	0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93,
+	0x92, 0x93, 0x93, 0x93, 0x92, 0x00, 0x04, 0x03, 0x09, 0x03, 0x34, 0x09, 0x33, 0x33, 0x64, 0x33,
+	0x63, 0x39, 0x6A, 0x63, 0x69, 0x63, 0x9A, 0x69, 0x99, 0x93, 0xC4, 0x99, 0xC3, 0x99, 0xCA, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x99, 0x93, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0x00,
+	0x00, 0xBE, 0xEF, 0xBE, 0xEF, 0xE9, 0xA8, 0x7E, 0x84, 0x7E, 0xAF, 0x00, 0x00, 0xFB, 0xFB, 0xFB,
+	0x00, 0x00, 0xBC, 0x8C, 0x92, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x68, 0x99, 0x92,
+	0x93, 0x68, 0x99, 0x92, 0x93, 0x68, 0x99, 0x92, 0x93, 0x92, 0x99, 0x92, 0x93, 0x92, 0xC3, 0x92,
+	0x93, 0x92, 0xC3, 0x92, 0x93, 0x00, 0x03, 0x03, 0x03, 0x09, 0x03, 0x33, 0x33, 0x33, 0x33, 0x39,
+	0x39, 0x63, 0x63, 0x69, 0x69, 0x93, 0x69, 0x93, 0x93, 0x99, 0x99, 0x99, 0x99, 0xC9, 0xC3, 0x00,
+	0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x99, 0x99, 0x99, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00,
+	0xC4, 0xC4, 0xC4, 0xEF, 0xEF, 0xEF, 0x7E, 0x7E, 0x7E, 0x84, 0x7E, 0x85, 0x00, 0x00, 0xFB, 0xFB,
+	0x00, 0x00, 0x8C, 0x92, 0x92, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x93, 0x92, 0x93,
+	0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93,
+	0x93, 0x93, 0x92, 0x93, 0x93, 0x00, 0x04, 0x03, 0x34, 0x03, 0x34, 0x09, 0x3A, 0x33, 0x64, 0x33,
+	0x64, 0x39, 0x6A, 0x63, 0x94, 0x69, 0x94, 0x69, 0x9A, 0x93, 0xC4, 0x99, 0xCA, 0x99, 0xCA, 0x00,
+	0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x68, 0x99, 0x99, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xBE,
+	0xEF, 0xC4, 0xEF, 0xBE, 0xEF, 0xEF, 0xA8, 0x7E, 0xAF, 0x7E, 0xAF, 0x84, 0xB5, 0x00, 0x00, 0xFB,
+	0x00, 0x00, 0xBC, 0x8C, 0xBD, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x68, 0x99, 0x68,
+	0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0xC3, 0x92, 0x99, 0x92,
+	0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x00, 0x03, 0x04, 0x03, 0x03, 0x09, 0x34, 0x33, 0x33, 0x33, 0x64,
+	0x39, 0x63, 0x63, 0x6A, 0x63, 0x69, 0x69, 0x94, 0x93, 0x99, 0x99, 0xC4, 0x99, 0xC3, 0xC9, 0x00,
+	0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x6E, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xC4,
+	0xC4, 0xC4, 0xC4, 0xEF, 0xEF, 0xEF, 0x7E, 0xA8, 0x7E, 0x7E, 0x84, 0xAF, 0x85, 0x85, 0x00, 0x00,
+	0x00, 0x00, 0x8C, 0xBC, 0x8C, 0x00, 0x00, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+	0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x92, 0x93, 0x93, 0x93,
+	0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x93,
+	0x92, 0x93, 0x93, 0x93, 0x92, 0x00, 0x04, 0x03, 0x0A, 0x03, 0x34, 0x09, 0x34, 0x33, 0x64, 0x33,
+	0x64, 0x39, 0x6A, 0x63, 0x6A, 0x63, 0x9A, 0x69, 0x9A, 0x93, 0xC4, 0x99, 0xCA, 0x99, 0xCA, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x9F, 0x6E, 0x99, 0x99, 0x00, 0x00, 0x00, 0x99, 0xCA, 0xC4,
+	0xC4, 0xC4, 0xF5, 0xC4, 0xEF, 0xEF, 0xA8, 0x7E, 0xAE, 0x7E, 0xAF, 0x84, 0xAF, 0x85, 0xB6, 0x00,
+	0x00, 0x00, 0xBC, 0x8C, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x99, 0x68, 0x99, 0x92,
+	0x99, 0x68, 0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0xC3, 0x92, 0x99, 0x92, 0xC3, 0x92,
+	0x99, 0x92, 0xC3, 0x92, 0xC3, 0x00, 0x03, 0x04, 0x03, 0x0A, 0x03, 0x34, 0x33, 0x34, 0x33, 0x3A,
+	0x39, 0x64, 0x63, 0x6A, 0x69, 0x6A, 0x69, 0x94, 0x93, 0x9A, 0x99, 0x9A, 0x99, 0xCA, 0xC3, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x6E, 0x6E, 0x6E, 0x6E, 0x99, 0x99, 0x99, 0x00, 0x00, 0x99, 0xC4, 0xC4, 0xC4,
+	0xC4, 0xEF, 0xC4, 0xEF, 0xEF, 0xEF, 0x7E, 0xA8, 0x7E, 0xAE, 0x7E, 0xAF, 0x85, 0xAF, 0x85, 0xB5,
+	0x00, 0x00, 0x8C, 0xBC, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+	0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+	0x93, 0x93, 0x93, 0x93, 0x93, 0x00, 0x04, 0x03, 0x34, 0x03, 0x34, 0x09, 0x34, 0x33, 0x64, 0x33,
+	0x64, 0x39, 0x6A, 0x63, 0x94, 0x69, 0x94, 0x69, 0x9A, 0x93, 0xC4, 0x99, 0xCA, 0x99, 0xCA, 0xC3,
+	0xF4, 0xC9, 0xFA, 0xC9, 0xFA, 0xF9, 0x1E, 0x18, 0x49, 0x18, 0x49, 0x18, 0x49, 0x43, 0x74, 0x43,
+	0x74, 0x43, 0x74, 0x6E, 0x9F, 0x6E, 0x9F, 0x6E, 0x9F, 0x99, 0xCA, 0x99, 0xCA, 0x99, 0xCA, 0xC4,
+	0xF5, 0xC4, 0xF5, 0xC4, 0xF5, 0xEF, 0xA8, 0x7E, 0xAF, 0x7E, 0xAF, 0x84, 0xAF, 0x85, 0xB6, 0x85,
+	0xB6, 0x8B, 0xBC, 0x8C, 0xBD, 0x92, 0xBD, 0x92, 0xC3, 0x93, 0xC4, 0x99, 0xCA, 0x99, 0xCA, 0x9A,
+	0xCB, 0xA0, 0xD1, 0xA0, 0xD1, 0xA7, 0x99, 0x68, 0x99, 0x68, 0x99, 0x68, 0x99, 0x92, 0x99, 0x92,
+	0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0xC3, 0x92, 0x99, 0x92, 0xC3, 0x92, 0xC3, 0x92,
+	0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x00, 0x04, 0x04, 0x03, 0x04, 0x0A, 0x34, 0x33, 0x34, 0x34, 0x64,
+	0x39, 0x64, 0x64, 0x6A, 0x63, 0x6A, 0x94, 0x94, 0x93, 0x9A, 0x9A, 0xC4, 0x99, 0xC4, 0xCA, 0xCA,
+	0xC9, 0xCA, 0xCA, 0xFA, 0xF9, 0xFA, 0x18, 0x1E, 0x18, 0x18, 0x18, 0x49, 0x43, 0x43, 0x43, 0x74,
+	0x43, 0x6E, 0x6E, 0x74, 0x6E, 0x6E, 0x99, 0x9F, 0x99, 0x99, 0x99, 0xCA, 0x99, 0xC4, 0xC4, 0xCA,
+	0xC4, 0xC4, 0xC4, 0xF5, 0xEF, 0xEF, 0xA8, 0xA8, 0x7E, 0xA8, 0xAE, 0xAF, 0x85, 0xAF, 0xAF, 0xB6,
+	0x8B, 0xB6, 0xB6, 0xBC, 0x8C, 0xBC, 0xBD, 0xBD, 0x93, 0xC3, 0xC3, 0xC4, 0x99, 0xC4, 0xCA, 0xCA,
+	0xA0, 0xCA, 0xCA, 0xD1, 0xA7, 0xD1, 0x93, 0x99, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x99,
+	0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x99, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x99,
+	0x93, 0x93, 0x93, 0xBD, 0x92, 0x00, 0x04, 0x03, 0x0A, 0x03, 0x34, 0x09, 0x34, 0x33, 0x64, 0x33,
+	0x64, 0x39, 0x6A, 0x63, 0x6A, 0x63, 0x9A, 0x69, 0x9A, 0x93, 0xC4, 0x99, 0xC4, 0x99, 0xCA, 0xC9,
+	0xCA, 0xC9, 0xFA, 0xC9, 0xFA, 0xF9, 0x1E, 0x18, 0x1E, 0x18, 0x49, 0x18, 0x49, 0x43, 0x74, 0x43,
+	0x74, 0x43, 0x74, 0x6E, 0x74, 0x6E, 0x9F, 0x6E, 0x9F, 0x99, 0xCA, 0x99, 0xCA, 0x99, 0xCA, 0xC4,
+	0xCA, 0xC4, 0xF5, 0xC4, 0xF5, 0xEF, 0xA8, 0x7E, 0xAE, 0x7E, 0xAF, 0x84, 0xAF, 0x85, 0xB6, 0x85,
+	0xB6, 0x8B, 0xBC, 0x8C, 0xBC, 0x8C, 0xC3, 0x92, 0xC3, 0x93, 0xC4, 0x99, 0xC4, 0x99, 0xCA, 0xA0,
+	0xCA, 0xA0, 0xD1, 0xA0, 0xD1, 0xA7, 0x99, 0x93, 0x99, 0x68, 0x99, 0x92, 0x99, 0x68, 0x99, 0x93,
+	0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0xC3, 0x93, 0x99, 0x92, 0xC3, 0x92, 0x99, 0x92, 0xC3, 0x93,
+	0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x00, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x34, 0x34, 0x34, 0x34, 0x3A,
+	0x3A, 0x64, 0x64, 0x6A, 0x6A, 0x94, 0x6A, 0x94, 0x94, 0x9A, 0x9A, 0x9A, 0x9A, 0xCA, 0xC4, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xFA, 0xFA, 0xFA, 0x18, 0x1E, 0x18, 0x1E, 0x18, 0x49, 0x43, 0x49, 0x43, 0x49,
+	0x43, 0x74, 0x6E, 0x74, 0x6E, 0x9F, 0x6E, 0x9F, 0x99, 0x9F, 0x99, 0x9F, 0x99, 0xCA, 0xC4, 0xCA,
+	0xC4, 0xCA, 0xC4, 0xF5, 0xEF, 0xF5, 0xA8, 0xA8, 0xA8, 0xAE, 0xA8, 0xAF, 0xAF, 0xAF, 0xAF, 0xB5,
+	0xB5, 0xB6, 0xB6, 0xBC, 0xBC, 0xBD, 0xBC, 0xBD, 0xBD, 0xC3, 0xC3, 0xC3, 0xC3, 0xCA, 0xC4, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xD1, 0xD1, 0xD1, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x99, 0x93, 0x93,
+	0x93, 0x93, 0x93, 0x93, 0x93, 0x99, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x99, 0x93, 0x93,
+	0x93, 0x93, 0x93, 0x93, 0x93, 0x00, 0x04, 0x03, 0x34, 0x04, 0x34, 0x09, 0x3A, 0x34, 0x64, 0x33,
+	0x64, 0x3A, 0x6A, 0x63, 0x94, 0x6A, 0x94, 0x69, 0x9A, 0x94, 0xC4, 0x99, 0xCA, 0x9A, 0xCA, 0xC3,
+	0xF4, 0xCA, 0xFA, 0xC9, 0xFA, 0xFA, 0x1E, 0x18, 0x49, 0x18, 0x49, 0x18, 0x49, 0x43, 0x74, 0x43,
+	0x74, 0x43, 0x74, 0x6E, 0x9F, 0x6E, 0x9F, 0x6E, 0x9F, 0x99, 0xCA, 0x99, 0xCA, 0x99, 0xCA, 0xC4,
+	0xF5, 0xC4, 0xF5, 0xC4, 0xF5, 0xEF, 0xA8, 0x7E, 0xAF, 0xA8, 0xAF, 0x84, 0xB5, 0xAF, 0xB6, 0x85,
+	0xB6, 0xB5, 0xBC, 0x8C, 0xBD, 0xBC, 0xBD, 0x92, 0xC3, 0xBD, 0xC4, 0x99, 0xCA, 0xC3, 0xCA, 0x9A,
+	0xCB, 0xCA, 0xD1, 0xA0, 0xD1, 0xD1, 0x99, 0x68, 0x99, 0x92, 0x99, 0x92, 0x99, 0x92, 0x99, 0x92,
+	0x99, 0x92, 0x99, 0x92, 0xC3, 0x92, 0x99, 0x92, 0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x92,
+	0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x00, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x34, 0x34, 0x34, 0x34, 0x64,
+	0x3A, 0x64, 0x64, 0x6A, 0x64, 0x6A, 0x6A, 0x94, 0x94, 0x9A, 0x9A, 0xC4, 0x9A, 0xC4, 0xCA, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xFA, 0xFA, 0xFA, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x49, 0x49, 0x49, 0x49, 0x74,
+	0x49, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 0xCA, 0x9F, 0xCA, 0xCA, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xF5, 0xF5, 0xF5, 0xA8, 0xA8, 0xA8, 0xA8, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB6,
+	0xB5, 0xB6, 0xB6, 0xBC, 0xB6, 0xBC, 0xBC, 0xBD, 0xBD, 0xC3, 0xC3, 0xC4, 0xC3, 0xC4, 0xCA, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xD1, 0xD1, 0xD1, 0x93, 0x99, 0x93, 0x93, 0x93, 0x99, 0x93, 0x93, 0x93, 0x99,
+	0x93, 0x93, 0x93, 0x99, 0x93, 0x93, 0x93, 0x99, 0x93, 0x93, 0x93, 0x99, 0x93, 0x93, 0x93, 0xC3,
+	0x93, 0x93, 0x93, 0xC3, 0x93, 0x00, 0x05, 0x04, 0x0A, 0x04, 0x35, 0x0A, 0x34, 0x34, 0x65, 0x34,
+	0x64, 0x3A, 0x6B, 0x64, 0x6A, 0x64, 0x9B, 0x6A, 0x9A, 0x94, 0xC5, 0x9A, 0xCA, 0x9A, 0xCB, 0xCA,
+	0xCA, 0xCA, 0xFB, 0xCA, 0xFA, 0xFA, 0x1E, 0x1E, 0x1E, 0x18, 0x49, 0x1E, 0x49, 0x43, 0x74, 0x49,
+	0x74, 0x43, 0x74, 0x74, 0x74, 0x6E, 0x9F, 0x74, 0x9F, 0x99, 0xCA, 0x9F, 0xCA, 0x99, 0xCA, 0xCA,
+	0xCA, 0xC4, 0xF5, 0xCA, 0xF5, 0xEF, 0xD2, 0xA8, 0xAE, 0xA8, 0xD9, 0xAE, 0xAF, 0xAF, 0xE0, 0xAF,
+	0xB6, 0xB5, 0xE6, 0xB6, 0xBC, 0xB6, 0xED, 0xBC, 0xC3, 0xBD, 0xEE, 0xC3, 0xCA, 0xC3, 0xF4, 0xCA,
+	0xCA, 0xCA, 0xFB, 0xCA, 0xD1, 0xD1, 0x99, 0x93, 0x99, 0x68, 0x99, 0x93, 0x99, 0x92, 0x99, 0x93,
+	0x99, 0x92, 0xC3, 0x93, 0x99, 0x92, 0xC3, 0x93, 0x99, 0x92, 0xC3, 0x93, 0xC3, 0x92, 0xC3, 0x93,
+	0xC3, 0x92, 0xC3, 0x93, 0xC3, 0x00, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x34, 0x34, 0x34, 0x34, 0x3A,
+	0x3A, 0x64, 0x64, 0x6A, 0x6A, 0x6A, 0x6A, 0x94, 0x94, 0x9A, 0x9A, 0x9A, 0x9A, 0xCA, 0xC4, 0xCA,
+	0xCA, 0xF4, 0xCA, 0xFA, 0xFA, 0xFA, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x49, 0x49, 0x49, 0x49, 0x49,
+	0x49, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xCA, 0xCA, 0xCA,
+	0xCA, 0xF5, 0xCA, 0xF5, 0xF5, 0xF5, 0xA8, 0xA8, 0xA8, 0xAE, 0xA8, 0xAF, 0xAF, 0xAF, 0xAF, 0xB5,
+	0xB5, 0xB6, 0xB6, 0xBC, 0xBC, 0xBC, 0xBC, 0xBD, 0xBD, 0xC3, 0xC3, 0xC3, 0xC3, 0xCA, 0xC4, 0xCA,
+	0xCA, 0xCB, 0xCA, 0xD1, 0xD1, 0xD1, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99,
+	0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99,
+	0x93, 0xC3, 0x93, 0x99, 0x93, 0x00, 0x05, 0x04, 0x35, 0x04, 0x35, 0x0A, 0x35, 0x34, 0x65, 0x34,
+	0x65, 0x3A, 0x6B, 0x64, 0x95, 0x6A, 0x95, 0x6A, 0x9B, 0x94, 0xC5, 0x9A, 0xCB, 0x9A, 0xCB, 0xC4,
+	0xF5, 0xCA, 0xFB, 0xCA, 0xFB, 0xFA, 0x1E, 0x1E, 0x49, 0x1E, 0x49, 0x1E, 0x49, 0x49, 0x74, 0x49,
+	0x74, 0x49, 0x74, 0x74, 0x9F, 0x74, 0x9F, 0x74, 0x9F, 0x9F, 0xCA, 0x9F, 0xCA, 0x9F, 0xCA, 0xCA,
+	0xF5, 0xCA, 0xF5, 0xCA, 0xF5, 0xF5, 0xD2, 0xA8, 0xD9, 0xA8, 0xD9, 0xAE, 0xD9, 0xAF, 0xE0, 0xAF,
+	0xE0, 0xB5, 0xE6, 0xB6, 0xE7, 0xBC, 0xE7, 0xBC, 0xED, 0xBD, 0xEE, 0xC3, 0xF4, 0xC3, 0xF4, 0xC4,
+	0xF5, 0xCA, 0xFB, 0xCA, 0xFB, 0xD1, 0x99, 0x93, 0x99, 0x93, 0x99, 0x92, 0x99, 0x93, 0x99, 0x93,
+	0xC3, 0x93, 0x99, 0x92, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x92, 0xC3, 0x93, 0xC3, 0x93,
+	0xC3, 0x93, 0xC3, 0x92, 0xC3, 0x00, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x34, 0x34, 0x34, 0x34, 0x64,
+	0x3A, 0x64, 0x64, 0x6A, 0x64, 0x6A, 0x94, 0x94, 0x94, 0x9A, 0x9A, 0xC4, 0x9A, 0xC4, 0xCA, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xFA, 0xFA, 0xFA, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x49, 0x49, 0x49, 0x49, 0x74,
+	0x49, 0x74, 0x74, 0x74, 0x74, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xCA, 0x9F, 0xCA, 0xCA, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xF5, 0xF5, 0xF5, 0xA8, 0xA8, 0xA8, 0xA8, 0xAE, 0xAF, 0xAF, 0xAF, 0xAF, 0xB6,
+	0xB5, 0xB6, 0xB6, 0xBC, 0xB6, 0xBC, 0xBD, 0xBD, 0xBD, 0xC3, 0xC3, 0xC4, 0xC3, 0xC4, 0xCA, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xD1, 0xD1, 0xD1, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x93, 0x93, 0x99,
+	0x93, 0x99, 0x93, 0x99, 0x93, 0x93, 0x93, 0x99, 0x93, 0x99, 0x93, 0xC3, 0x93, 0x93, 0x93, 0xC3,
+	0x93, 0x99, 0x93, 0xC3, 0x93, 0x00, 0x05, 0x04, 0x0B, 0x04, 0x35, 0x0A, 0x35, 0x34, 0x65, 0x34,
+	0x65, 0x3A, 0x6B, 0x64, 0x6B, 0x64, 0x9B, 0x6A, 0x9B, 0x94, 0xC5, 0x9A, 0xC5, 0x9A, 0xCB, 0xCA,
+	0xCB, 0xCA, 0xFB, 0xCA, 0xFB, 0xFA, 0x24, 0x1E, 0x24, 0x1E, 0x4F, 0x1E, 0x49, 0x49, 0x7A, 0x49,
+	0x7A, 0x49, 0x7A, 0x74, 0x74, 0x74, 0xA5, 0x74, 0xA5, 0x9F, 0xD0, 0x9F, 0xCA, 0x9F, 0xD0, 0xCA,
+	0xD0, 0xCA, 0xFB, 0xCA, 0xF5, 0xF5, 0xD2, 0xA8, 0xD8, 0xA8, 0xD9, 0xAE, 0xD9, 0xAF, 0xE0, 0xAF,
+	0xE0, 0xB5, 0xE6, 0xB6, 0xE6, 0xB6, 0xED, 0xBC, 0xED, 0xBD, 0xEE, 0xC3, 0xEE, 0xC3, 0xF4, 0xCA,
+	0xF4, 0xCA, 0xFB, 0xCA, 0xFB, 0xD1, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x92, 0xC3, 0x93,
+	0x99, 0x93, 0xC3, 0x93, 0x99, 0x92, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x92, 0xC3, 0x93,
+	0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x00, 0x04, 0x04, 0x04, 0x0B, 0x04, 0x35, 0x34, 0x35, 0x34, 0x3A,
+	0x3A, 0x65, 0x64, 0x6B, 0x6A, 0x95, 0x6A, 0x94, 0x94, 0x9B, 0x9A, 0x9B, 0x9A, 0xCB, 0xC4, 0xCA,
+	0xCA, 0xCB, 0xCA, 0xFB, 0xFA, 0xFB, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x49, 0x49, 0x49, 0x49, 0x49,
+	0x49, 0x74, 0x74, 0x74, 0x74, 0x9F, 0x74, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0xCA, 0xCA, 0xCA,
+	0xCA, 0xCA, 0xCA, 0xF5, 0xF5, 0xF5, 0xA8, 0xA8, 0xA8, 0xD8, 0xA8, 0xD9, 0xAF, 0xD9, 0xAF, 0xB5,
+	0xB5, 0xE0, 0xB6, 0xE6, 0xBC, 0xE7, 0xBC, 0xBD, 0xBD, 0xED, 0xC3, 0xED, 0xC3, 0xF4, 0xC4, 0xCA,
+	0xCA, 0xF4, 0xCA, 0xFB, 0xD1, 0xFB, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99,
+	0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0xC3, 0x93, 0xC3,
+	0x93, 0xC3, 0x93, 0xC3, 0x93, 0x00, 0x05, 0x04, 0x35, 0x04, 0x35, 0x0A, 0x3B, 0x34, 0x65, 0x34,
+	0x65, 0x3A, 0x6B, 0x64, 0x95, 0x6A, 0x95, 0x6A, 0x9B, 0x94, 0xC5, 0x9A, 0xCB, 0x9A, 0xCB, 0xC4,
+	0xF5, 0xCA, 0xFB, 0xCA, 0xFB, 0xFA, 0x24, 0x1E, 0x4F, 0x1E, 0x4F, 0x1E, 0x4F, 0x49, 0x7A, 0x49,
+	0x7A, 0x49, 0x7A, 0x74, 0xA5, 0x74, 0xA5, 0x74, 0xA5, 0x9F, 0xD0, 0x9F, 0xD0, 0x9F, 0xD0, 0xCA,
+	0xFB, 0xCA, 0xFB, 0xCA, 0xFB, 0xF5, 0xD2, 0xA8, 0xD9, 0xA8, 0xD9, 0xAE, 0xDF, 0xAF, 0xE0, 0xAF,
+	0xE0, 0xB5, 0xE6, 0xB6, 0xE7, 0xBC, 0xE7, 0xBC, 0xED, 0xBD, 0xEE, 0xC3, 0xF4, 0xC3, 0xF4, 0xC4,
+	0xF5, 0xCA, 0xFB, 0xCA, 0xFB, 0xD1, 0x99, 0x93, 0x99, 0x93, 0x99, 0x93, 0xC3, 0x93, 0x99, 0x93,
+	0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93,
+	0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x00, 0x05, 0x05, 0x04, 0x05, 0x0B, 0x35, 0x34, 0x35, 0x35, 0x65,
+	0x3A, 0x65, 0x65, 0x6B, 0x64, 0x6B, 0x6B, 0x95, 0x94, 0x9B, 0x9B, 0xC5, 0x9A, 0xC5, 0xCB, 0xCB,
+	0xCA, 0xCB, 0xCB, 0xFB, 0xFA, 0xFB, 0x1E, 0x24, 0x1E, 0x24, 0x1E, 0x4F, 0x49, 0x4F, 0x49, 0x7A,
+	0x49, 0x7A, 0x74, 0x7A, 0x74, 0x7A, 0x74, 0xA5, 0x9F, 0xA5, 0x9F, 0xD0, 0x9F, 0xD0, 0xCA, 0xD0,
+	0xCA, 0xD0, 0xCA, 0xFB, 0xF5, 0xFB, 0xD2, 0xD2, 0xA8, 0xD2, 0xD8, 0xD9, 0xAF, 0xD9, 0xD9, 0xE0,
+	0xB5, 0xE0, 0xE0, 0xE6, 0xB6, 0xE6, 0xE6, 0xE7, 0xBD, 0xED, 0xED, 0xEE, 0xC3, 0xEE, 0xF4, 0xF4,
+	0xCA, 0xF4, 0xF4, 0xFB, 0xD1, 0xFB, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99,
+	0x93, 0x99, 0x99, 0x99, 0x93, 0x99, 0x99, 0xC3, 0x93, 0x99, 0x99, 0xC3, 0x93, 0x99, 0x99, 0xC3,
+	0x93, 0xC3, 0x99, 0xC3, 0x93, 0x00, 0x05, 0x04, 0x0B, 0x04, 0x35, 0x0A, 0x35, 0x34, 0x65, 0x34,
+	0x65, 0x3A, 0x6B, 0x64, 0x6B, 0x64, 0x9B, 0x6A, 0x9B, 0x94, 0xC5, 0x9A, 0xCB, 0x9A, 0xCB, 0xCA,
+	0xCB, 0xCA, 0xFB, 0xCA, 0xFB, 0xFA, 0x24, 0x1E, 0x24, 0x1E, 0x4F, 0x1E, 0x4F, 0x49, 0x7A, 0x49,
+	0x7A, 0x49, 0x7A, 0x74, 0x7A, 0x74, 0xA5, 0x74, 0xA5, 0x9F, 0xD0, 0x9F, 0xD0, 0x9F, 0xD0, 0xCA,
+	0xD0, 0xCA, 0xFB, 0xCA, 0xFB, 0xF5, 0xD2, 0xA8, 0xD8, 0xA8, 0xD9, 0xAE, 0xD9, 0xAF, 0xE0, 0xAF,
+	0xE0, 0xB5, 0xE6, 0xB6, 0xE6, 0xB6, 0xED, 0xBC, 0xED, 0xBD, 0xEE, 0xC3, 0xF4, 0xC3, 0xF4, 0xCA,
+	0xF4, 0xCA, 0xFB, 0xCA, 0xFB, 0xD1, 0x99, 0x93, 0x99, 0x93, 0xC4, 0x93, 0x99, 0x93, 0xC3, 0x93,
+	0x99, 0x93, 0xC4, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC4, 0x93, 0xC3, 0x93, 0xC3, 0x93,
+	0xC3, 0x93, 0xC4, 0x93, 0xC3, 0x00, 0x05, 0x05, 0x05, 0x0B, 0x05, 0x35, 0x35, 0x35, 0x35, 0x3B,
+	0x3B, 0x65, 0x65, 0x6B, 0x6B, 0x6B, 0x6B, 0x95, 0x95, 0x9B, 0x9B, 0x9B, 0x9B, 0xCB, 0xC5, 0xCB,
+	0xCB, 0xF5, 0xCB, 0xFB, 0xFB, 0xFB, 0x24, 0x24, 0x24, 0x24, 0x24, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+	0x4F, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xD0, 0xD0, 0xD0,
+	0xD0, 0xFB, 0xD0, 0xFB, 0xFB, 0xFB, 0xD2, 0xD2, 0xD2, 0xD8, 0xD2, 0xD9, 0xD9, 0xD9, 0xD9, 0xDF,
+	0xDF, 0xE0, 0xE0, 0xE6, 0xE6, 0xE6, 0xE6, 0xE7, 0xE7, 0xED, 0xED, 0xED, 0xED, 0xF4, 0xEE, 0xF4,
+	0xF4, 0xF5, 0xF4, 0xFB, 0xFB, 0xFB, 0x93, 0x99, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0x93, 0x99,
+	0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0x93, 0x99, 0x99, 0xC3, 0x93, 0x99, 0x99, 0xC3, 0x93, 0xC3,
+	0x99, 0xC3, 0x93, 0xC3, 0x99, 0x00, 0x05, 0x04, 0x35, 0x05, 0x35, 0x0A, 0x35, 0x34, 0x65, 0x34,
+	0x65, 0x3B, 0x6B, 0x64, 0x95, 0x6A, 0x95, 0x6A, 0x9B, 0x95, 0xC5, 0x9A, 0xCB, 0x9A, 0xCB, 0xC4,
+	0xF5, 0xCB, 0xFB, 0xCA, 0xFB, 0xFA, 0x24, 0x1E, 0x4F, 0x1E, 0x4F, 0x1E, 0x4F, 0x49, 0x7A, 0x49,
+	0x7A, 0x49, 0x7A, 0x74, 0xA5, 0x74, 0xA5, 0x74, 0xA5, 0x9F, 0xD0, 0x9F, 0xD0, 0x9F, 0xD0, 0xCA,
+	0xFB, 0xCA, 0xFB, 0xCA, 0xFB, 0xF5, 0xD2, 0xA8, 0xD9, 0xD2, 0xD9, 0xAE, 0xD9, 0xAF, 0xE0, 0xAF,
+	0xE0, 0xDF, 0xE6, 0xB6, 0xE7, 0xBC, 0xE7, 0xBC, 0xED, 0xE7, 0xEE, 0xC3, 0xF4, 0xC3, 0xF4, 0xC4,
+	0xF5, 0xF4, 0xFB, 0xCA, 0xFB, 0xD1, 0x99, 0x93, 0xC3, 0x93, 0x99, 0x93, 0xC3, 0x93, 0xC3, 0x93,
+	0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x93,
+	0xC3, 0x93, 0xC3, 0x93, 0xC3, 0x00, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x35, 0x35, 0x35, 0x35, 0x65,
+	0x3B, 0x65, 0x65, 0x6B, 0x65, 0x6B, 0x95, 0x95, 0x95, 0x9B, 0x9B, 0xC5, 0x9B, 0xC5, 0xCB, 0xCB,
+	0xCB, 0xCB, 0xCB, 0xFB, 0xFB, 0xFB, 0x24, 0x24, 0x24, 0x24, 0x24, 0x4F, 0x4F, 0x4F, 0x4F, 0x7A,
+	0x4F, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xD0, 0xA5, 0xD0, 0xD0, 0xD0,
+	0xD0, 0xD0, 0xD0, 0xFB, 0xFB, 0xFB, 0xD2, 0xD2, 0xD2, 0xD2, 0xD8, 0xD9, 0xD9, 0xD9, 0xD9, 0xE0,
+	0xDF, 0xE0, 0xE0, 0xE6, 0xE0, 0xE6, 0xE7, 0xE7, 0xE7, 0xED, 0xED, 0xEE, 0xED, 0xEE, 0xF4, 0xF4,
+	0xF4, 0xF4, 0xF4, 0xFB, 0xFB, 0xFB, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99, 0x93, 0x99, 0x99, 0x99,
+	0x93, 0x99, 0x99, 0xC3, 0x93, 0x99, 0x99, 0xC3, 0x93, 0x99, 0x99, 0xC3, 0x93, 0xC3, 0xC3, 0xC3,
+	0x93, 0xC3, 0xC3, 0xC3, 0x93, 0x00, 0x05, 0x05, 0x0B, 0x05, 0x35, 0x0B, 0x35, 0x35, 0x65, 0x35,
+	0x65, 0x3B, 0x6B, 0x65, 0x6B, 0x65, 0x9B, 0x6B, 0x9B, 0x95, 0xC5, 0x9B, 0xC5, 0x9B, 0xCB, 0xCB,
+	0xCB, 0xCB, 0xFB, 0xCB, 0xFB, 0xFB, 0x24, 0x24, 0x24, 0x24, 0x4F, 0x24, 0x4F, 0x4F, 0x7A, 0x4F,
+	0x7A, 0x4F, 0x7A, 0x7A, 0x7A, 0x7A, 0xA5, 0x7A, 0xA5, 0xA5, 0xD0, 0xA5, 0xD0, 0xA5, 0xD0, 0xD0,
+	0xD0, 0xD0, 0xFB, 0xD0, 0xFB, 0xFB, 0xD2, 0xD2, 0xD8, 0xD2, 0xD9, 0xD8, 0xD9, 0xD9, 0xE0, 0xD9,
+	0xE0, 0xDF, 0xE6, 0xE0, 0xE6, 0xE0, 0xED, 0xE6, 0xED, 0xE7, 0xEE, 0xED, 0xEE, 0xED, 0xF4, 0xF4,
+	0xF4, 0xF4, 0xFB, 0xF4, 0xFB, 0xFB, 0xC4, 0x93, 0x99, 0x93, 0xC4, 0x93, 0x99, 0x93, 0xC4, 0x93,
+	0xC3, 0x93, 0xC4, 0x93, 0xC3, 0x93, 0xC4, 0x93, 0xC3, 0x93, 0xC4, 0x93, 0xC3, 0x93, 0xC4, 0x93,
+	0xC3, 0x93, 0xC4, 0x93, 0xC3, 0x00,
+};
+
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY bench_bmp_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "bench.bmp", 9254, bench_bmp };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &bench_bmp_dir
+#endif
@@ -0,0 +1,304 @@
+/**
+ * This file was generated from "bench.gif" using...
+ *
+ *	file2c -dcsn bench_gif bench.gif romfs_bench_gif.h
+ *
+ */
+static const char bench_gif[] = {
+	0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0xAE, 0x00, 0x32, 0x00, 0xE7, 0xFF, 0x00, 0x16, 0x00, 0xFF,
+	0x0E, 0x30, 0x52, 0x03, 0x34, 0x55, 0x08, 0x37, 0x59, 0x16, 0x35, 0x58, 0x0E, 0x3A, 0x5C, 0x02,
+	0x3E, 0x64, 0x13, 0x3B, 0x63, 0x07, 0x3D, 0x76, 0x1C, 0x3A, 0x5D, 0x18, 0x3C, 0x70, 0x21, 0x3A,
+	0x6A, 0x0E, 0x3F, 0x79, 0x00, 0x43, 0x7B, 0x19, 0x3E, 0x6C, 0x1B, 0x3E, 0x72, 0x0F, 0x43, 0x6A,
+	0x00, 0x47, 0x74, 0x02, 0x45, 0x84, 0x13, 0x41, 0x7B, 0x12, 0x44, 0x71, 0x16, 0x42, 0x82, 0x06,
+	0x48, 0x7B, 0x1F, 0x42, 0x71, 0x16, 0x44, 0x78, 0x1F, 0x44, 0x6D, 0x1B, 0x45, 0x85, 0x0E, 0x48,
+	0x8E, 0x19, 0x48, 0x76, 0x00, 0x4F, 0x88, 0x00, 0x4E, 0x93, 0x1E, 0x49, 0x6F, 0x0F, 0x4C, 0x7F,
+	0x27, 0x46, 0x7C, 0x02, 0x4E, 0xA0, 0x14, 0x4B, 0x8B, 0x14, 0x4C, 0x86, 0x15, 0x4A, 0x97, 0x21,
+	0x48, 0x89, 0x40, 0x40, 0x81, 0x1E, 0x4B, 0x79, 0x16, 0x4B, 0x92, 0x27, 0x4A, 0x74, 0x05, 0x52,
+	0x8B, 0x29, 0x4A, 0x79, 0x16, 0x4F, 0x82, 0x15, 0x50, 0x7D, 0x0D, 0x51, 0x9E, 0x24, 0x4D, 0x82,
+	0x00, 0x54, 0xA9, 0x23, 0x4F, 0x7D, 0x1E, 0x4F, 0x96, 0x0D, 0x55, 0x8E, 0x10, 0x53, 0x99, 0x1C,
+	0x52, 0x86, 0x0E, 0x57, 0x89, 0x11, 0x55, 0x94, 0x00, 0x57, 0xB6, 0x1C, 0x54, 0x82, 0x30, 0x4E,
+	0x84, 0x15, 0x52, 0xAC, 0x00, 0x5B, 0x99, 0x27, 0x52, 0x80, 0x31, 0x50, 0x81, 0x08, 0x58, 0xAB,
+	0x23, 0x52, 0x99, 0x2A, 0x52, 0x87, 0x04, 0x58, 0xBF, 0x15, 0x58, 0x91, 0x23, 0x55, 0x8F, 0x1A,
+	0x56, 0xA3, 0x23, 0x57, 0x8B, 0x00, 0x5C, 0xC1, 0x04, 0x5C, 0xB6, 0x29, 0x55, 0x9D, 0x36, 0x54,
+	0x85, 0x2F, 0x56, 0x8C, 0x2E, 0x57, 0x86, 0x0C, 0x5F, 0x9E, 0x0F, 0x5D, 0xA9, 0x2C, 0x55, 0xAA,
+	0x1D, 0x5C, 0x96, 0x11, 0x5D, 0xB0, 0x00, 0x63, 0xA7, 0x0E, 0x61, 0x9A, 0x11, 0x5F, 0xA5, 0x21,
+	0x5B, 0xA2, 0x20, 0x5C, 0x9D, 0x00, 0x62, 0xC1, 0x1E, 0x5E, 0x92, 0x23, 0x5B, 0xA9, 0x2C, 0x5B,
+	0x96, 0x2B, 0x5C, 0x91, 0x34, 0x5A, 0x90, 0x33, 0x5B, 0x8B, 0x18, 0x5E, 0xBE, 0x03, 0x67, 0xAD,
+	0x24, 0x60, 0x9A, 0x1D, 0x61, 0xB5, 0x0C, 0x66, 0xBF, 0x19, 0x65, 0xA5, 0x1F, 0x61, 0xBB, 0x31,
+	0x5F, 0x9A, 0x0E, 0x66, 0xC6, 0x3A, 0x5E, 0x95, 0x2B, 0x60, 0xAE, 0x56, 0x54, 0xAB, 0x0E, 0x68,
+	0xBA, 0x20, 0x64, 0xB0, 0x00, 0x6E, 0xB9, 0x3D, 0x5F, 0x9C, 0x33, 0x63, 0x98, 0x2A, 0x67, 0x9B,
+	0x37, 0x63, 0x9F, 0x2E, 0x65, 0xA6, 0x26, 0x66, 0xBA, 0x40, 0x61, 0x9F, 0x00, 0x72, 0xBD, 0x16,
+	0x6D, 0xB2, 0x27, 0x68, 0xB6, 0x3A, 0x64, 0xA7, 0x25, 0x6A, 0xAA, 0x2F, 0x68, 0xA2, 0x40, 0x64,
+	0x9B, 0x1B, 0x6B, 0xC5, 0x1A, 0x6C, 0xBF, 0x3B, 0x67, 0xA3, 0x2D, 0x68, 0xC4, 0x34, 0x69, 0xAB,
+	0x2C, 0x6A, 0xBE, 0x3A, 0x69, 0x9F, 0x39, 0x6A, 0x9A, 0x1F, 0x6F, 0xBC, 0x21, 0x6E, 0xC8, 0x40,
+	0x68, 0xAC, 0x22, 0x6F, 0xC3, 0x00, 0x81, 0x80, 0x2E, 0x6F, 0xB0, 0x11, 0x76, 0xC2, 0x14, 0x74,
+	0xCD, 0x00, 0x7B, 0xCC, 0x16, 0x74, 0xD4, 0x32, 0x6F, 0xBD, 0x2E, 0x72, 0xAC, 0x43, 0x6D, 0xAA,
+	0x3A, 0x70, 0xAC, 0x3C, 0x6F, 0xB2, 0x33, 0x71, 0xB9, 0x40, 0x70, 0xA0, 0x42, 0x6F, 0xA5, 0x2A,
+	0x73, 0xC7, 0x28, 0x75, 0xBC, 0x48, 0x6D, 0xB8, 0x2B, 0x75, 0xC3, 0x39, 0x73, 0xC2, 0x0C, 0x7E,
+	0xDD, 0x1E, 0x7B, 0xC7, 0x38, 0x75, 0xBD, 0x44, 0x74, 0xA4, 0x3F, 0x75, 0xB1, 0x00, 0x84, 0xDC,
+	0x39, 0x77, 0xB9, 0x43, 0x75, 0xB8, 0x24, 0x7C, 0xCF, 0x12, 0x81, 0xD3, 0x4B, 0x74, 0xB2, 0x32,
+	0x79, 0xCE, 0x32, 0x7A, 0xC8, 0x3D, 0x77, 0xC6, 0x32, 0x7B, 0xC2, 0x4A, 0x76, 0xAD, 0x4A, 0x75,
+	0xBC, 0x18, 0x82, 0xDB, 0x3F, 0x79, 0xC2, 0x52, 0x76, 0xA8, 0x00, 0x89, 0xE1, 0x2E, 0x80, 0xB3,
+	0x37, 0x7B, 0xD0, 0x5C, 0x74, 0xAE, 0x48, 0x79, 0xBD, 0x47, 0x7A, 0xB7, 0x37, 0x7D, 0xCC, 0x2C,
+	0x81, 0xCE, 0x51, 0x79, 0xB8, 0x2F, 0x80, 0xDA, 0x2E, 0x81, 0xD5, 0x4C, 0x7C, 0xC0, 0x3F, 0x80,
+	0xC2, 0x3B, 0x80, 0xCE, 0x3A, 0x81, 0xC9, 0x46, 0x7F, 0xC9, 0x31, 0x85, 0xD2, 0x60, 0x7B, 0xAF,
+	0x55, 0x7D, 0xBC, 0x27, 0x87, 0xE1, 0x3F, 0x82, 0xD1, 0x4D, 0x80, 0xBD, 0x27, 0x89, 0xDC, 0x5C,
+	0x7D, 0xB7, 0x15, 0x8E, 0xE6, 0x5B, 0x7F, 0xB1, 0x3F, 0x85, 0xCD, 0x56, 0x82, 0xAD, 0x55, 0x82,
+	0xBA, 0x39, 0x88, 0xDC, 0x38, 0x89, 0xD7, 0x44, 0x86, 0xD5, 0x43, 0x87, 0xD0, 0x7F, 0x81, 0x7E,
+	0x46, 0x8A, 0xD2, 0x52, 0x88, 0xC5, 0x40, 0x8C, 0xE1, 0x48, 0x8B, 0xD4, 0x3F, 0x8D, 0xDC, 0x4A,
+	0x8B, 0xDA, 0x5B, 0x8C, 0xB7, 0x4B, 0x8E, 0xD7, 0x44, 0x90, 0xDE, 0x4D, 0x90, 0xD9, 0x5D, 0x8E,
+	0xCC, 0x60, 0x8E, 0xC7, 0x83, 0x7F, 0xFE, 0x50, 0x92, 0xDB, 0x48, 0x94, 0xE2, 0x53, 0x94, 0xDD,
+	0x5B, 0x93, 0xD8, 0x54, 0x98, 0xDA, 0x56, 0x97, 0xE1, 0x5F, 0x96, 0xDB, 0x66, 0x96, 0xD5, 0x5A,
+	0x9A, 0xE4, 0x63, 0x9A, 0xCB, 0x62, 0x99, 0xDE, 0x59, 0x9C, 0xDF, 0x5E, 0x9D, 0xE8, 0x54, 0xA0,
+	0xE8, 0x5C, 0x9F, 0xE2, 0x6C, 0x9D, 0xD6, 0x67, 0x9E, 0xE3, 0x5F, 0xA1, 0xE5, 0x67, 0xA1, 0xDF,
+	0x69, 0xA0, 0xE5, 0x62, 0xA3, 0xE7, 0x64, 0xA5, 0xE9, 0x66, 0xA8, 0xEC, 0x6D, 0xA7, 0xE5, 0x75,
+	0xA7, 0xDF, 0x69, 0xAA, 0xEE, 0x72, 0xAB, 0xEA, 0x74, 0xAC, 0xEB, 0x75, 0xAD, 0xEC, 0x7F, 0xB1,
+	0xEA, 0x85, 0xB1, 0xE5, 0x8B, 0xB6, 0xEB, 0x8E, 0xBA, 0xE8, 0xFF, 0xFF, 0xFF, 0x21, 0xF9, 0x04,
+	0x01, 0x0A, 0x00, 0xFF, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x32, 0x00, 0x40, 0x08,
+	0xFE, 0x00, 0xFF, 0x09, 0x1C, 0x48, 0xB0, 0xA0, 0x40, 0x39, 0x78, 0x0C, 0x2A, 0x04, 0x20, 0xC7,
+	0x8F, 0x1E, 0x85, 0x10, 0x23, 0x4A, 0x9C, 0x48, 0xB1, 0xA2, 0xC5, 0x8B, 0x18, 0x33, 0x52, 0xDC,
+	0x62, 0x26, 0x8E, 0x19, 0x22, 0x34, 0x56, 0xD8, 0xE0, 0x10, 0x01, 0x02, 0x17, 0x82, 0x45, 0xCC,
+	0xF8, 0xF9, 0x74, 0xA9, 0x8D, 0x9D, 0x29, 0x3D, 0x68, 0x80, 0x18, 0x04, 0x4C, 0xA3, 0x4D, 0x8A,
+	0x43, 0x0A, 0x99, 0xCB, 0xC7, 0xB3, 0xA7, 0xB9, 0x43, 0x41, 0x2A, 0x4C, 0x98, 0xE0, 0xE1, 0x0E,
+	0xB6, 0x7B, 0x3D, 0xF3, 0xDD, 0x63, 0xB3, 0x60, 0xC1, 0x40, 0x06, 0x13, 0x82, 0x78, 0x4B, 0xDA,
+	0x93, 0x97, 0x11, 0x0D, 0x12, 0x84, 0x4E, 0xA8, 0x50, 0x74, 0x5C, 0x4F, 0x6D, 0x15, 0x14, 0x4C,
+	0x78, 0x72, 0x6A, 0x1E, 0x55, 0x9E, 0xEA, 0xB4, 0x4C, 0x78, 0xD0, 0x94, 0x41, 0x05, 0x47, 0x54,
+	0xB5, 0x39, 0x7A, 0x22, 0x81, 0xAD, 0xD3, 0x7F, 0x42, 0x98, 0x44, 0xA1, 0x11, 0x12, 0x04, 0x07,
+	0x08, 0x07, 0x08, 0x08, 0x10, 0x90, 0xA1, 0xD2, 0x3F, 0x16, 0x3F, 0x3E, 0xB5, 0x69, 0x33, 0xC5,
+	0x09, 0x8D, 0x0E, 0x16, 0x30, 0x34, 0x60, 0xD0, 0xC0, 0x70, 0xC6, 0x21, 0x69, 0x34, 0x61, 0x7B,
+	0x27, 0xAF, 0x73, 0x67, 0x70, 0x1B, 0x9A, 0x0E, 0x44, 0x92, 0x8D, 0x9E, 0x69, 0xD3, 0x9A, 0x18,
+	0xDC, 0x1D, 0xE2, 0xEC, 0x2C, 0x38, 0x13, 0xA2, 0x2B, 0x36, 0x9D, 0x7D, 0xF7, 0xDF, 0x10, 0x4D,
+	0x67, 0xDF, 0x69, 0xC3, 0x36, 0xCE, 0x5D, 0x4F, 0x70, 0x1A, 0x62, 0xFF, 0xA3, 0x5D, 0x5B, 0xE0,
+	0x04, 0x36, 0xF2, 0xCE, 0xF2, 0x74, 0x36, 0x63, 0xF6, 0x44, 0x14, 0x47, 0x28, 0x1C, 0x30, 0x30,
+	0x40, 0x40, 0x80, 0x04, 0x3E, 0xF6, 0x0C, 0x94, 0x23, 0x47, 0x52, 0x2A, 0x52, 0x8C, 0xEA, 0xFE,
+	0x80, 0xD1, 0x43, 0xA2, 0x88, 0x2A, 0x63, 0x03, 0x57, 0xB5, 0xD2, 0x55, 0x4E, 0x9E, 0xBA, 0x6F,
+	0xCC, 0x2C, 0xCD, 0xA2, 0x88, 0x65, 0x98, 0xB6, 0xFB, 0xDA, 0xC2, 0xF5, 0x61, 0x4B, 0x70, 0x8E,
+	0x36, 0x72, 0x00, 0x92, 0x83, 0x8D, 0x11, 0xC2, 0xBD, 0xD0, 0x0C, 0x39, 0xE2, 0x88, 0x83, 0x0E,
+	0x3A, 0xE9, 0xEC, 0x57, 0x1C, 0x41, 0x0B, 0x18, 0x81, 0x0D, 0x3B, 0x14, 0x52, 0x78, 0xCA, 0x04,
+	0xCE, 0xFD, 0x83, 0x85, 0x37, 0x9C, 0x79, 0x66, 0x0E, 0x81, 0x77, 0x49, 0x71, 0xC7, 0x1A, 0x20,
+	0x4E, 0xF4, 0x45, 0x2C, 0xF4, 0xF0, 0x64, 0x4E, 0x1A, 0x0A, 0x2C, 0x20, 0x81, 0x2F, 0x67, 0xDD,
+	0xA3, 0x09, 0x86, 0x19, 0xF9, 0x20, 0x44, 0x28, 0xC7, 0x1C, 0xF3, 0x0A, 0x23, 0x97, 0x90, 0x91,
+	0x85, 0x0E, 0x2E, 0xA0, 0x80, 0x82, 0x76, 0xFF, 0x30, 0xE1, 0x07, 0x3F, 0xFE, 0xEC, 0xA3, 0x8F,
+	0x7B, 0xD9, 0x30, 0x93, 0x0B, 0x2F, 0xA7, 0x84, 0x12, 0xCC, 0x44, 0x43, 0x88, 0xD1, 0x4A, 0x2F,
+	0xBD, 0xF8, 0x92, 0x89, 0x26, 0xAD, 0xF8, 0x82, 0x25, 0x96, 0xA7, 0x88, 0x61, 0xC4, 0x21, 0xA7,
+	0x7C, 0x59, 0xCB, 0x29, 0x7D, 0x18, 0x61, 0x57, 0x6D, 0x0B, 0x3C, 0x30, 0xC3, 0x1A, 0xA7, 0xF0,
+	0xF2, 0xCC, 0x9C, 0xD1, 0xCC, 0xC9, 0x8B, 0x25, 0x5A, 0xD4, 0x25, 0xC6, 0x2F, 0x7C, 0x5A, 0xD5,
+	0x54, 0x19, 0xBC, 0x0C, 0xD3, 0x4C, 0x33, 0xCE, 0x38, 0x33, 0xE8, 0xA1, 0x87, 0xF2, 0x12, 0xDC,
+	0x83, 0x03, 0x8D, 0xE1, 0x0C, 0x35, 0xD4, 0x60, 0x23, 0xE9, 0xA4, 0x92, 0x6A, 0xE3, 0xA0, 0xA3,
+	0xF8, 0xE1, 0xE7, 0xCD, 0xA6, 0x9C, 0x7A, 0x03, 0xCE, 0x21, 0xFC, 0x45, 0x84, 0x02, 0x17, 0x9C,
+	0x30, 0xD2, 0x06, 0x18, 0x8E, 0xF9, 0x45, 0x41, 0x13, 0x90, 0xC8, 0x32, 0x90, 0x0C, 0xFE, 0xC4,
+	0xC8, 0x63, 0xCE, 0x34, 0xB8, 0x34, 0xD2, 0xC8, 0x18, 0x77, 0x84, 0x72, 0xCB, 0x2E, 0x15, 0x95,
+	0x00, 0xC5, 0x1A, 0x6B, 0x88, 0x01, 0x04, 0x86, 0x8C, 0xDE, 0x64, 0xEC, 0xB1, 0xC8, 0x26, 0x5B,
+	0x10, 0x07, 0x7E, 0x44, 0x42, 0x0B, 0x34, 0x13, 0x7D, 0xB0, 0x04, 0x2D, 0xC4, 0x28, 0x6B, 0xED,
+	0xB5, 0xD8, 0x66, 0x9B, 0x2C, 0x1D, 0xDC, 0xC5, 0x11, 0xC5, 0x0A, 0x47, 0x58, 0x66, 0x10, 0x1E,
+	0x0D, 0x7D, 0x92, 0x48, 0x63, 0xAA, 0x68, 0x9B, 0xEC, 0x10, 0x5F, 0xF0, 0x61, 0x89, 0x37, 0xEA,
+	0xC4, 0x33, 0xCF, 0x3B, 0xEA, 0x80, 0x33, 0x0C, 0x1B, 0x33, 0x6C, 0x30, 0x84, 0x29, 0xBC, 0x38,
+	0x42, 0xE3, 0x40, 0x7F, 0xF0, 0x22, 0xF0, 0xC0, 0x04, 0x17, 0x6C, 0xB0, 0xC0, 0xA7, 0xC0, 0x36,
+	0x84, 0x25, 0x07, 0x1F, 0xFC, 0x84, 0x02, 0x81, 0x34, 0x3C, 0xF0, 0x29, 0xC1, 0x0D, 0x24, 0xC4,
+	0x16, 0x20, 0xF1, 0x45, 0x43, 0x0B, 0x11, 0x50, 0x60, 0x80, 0x01, 0x05, 0xF8, 0x00, 0x2D, 0x0C,
+	0x5D, 0x84, 0x52, 0x47, 0x1D, 0x8B, 0x35, 0xB6, 0x71, 0x64, 0x47, 0xA0, 0x97, 0xD1, 0x17, 0x63,
+	0xCC, 0x11, 0x48, 0x1F, 0xA8, 0x68, 0xA3, 0x0E, 0x52, 0x17, 0x16, 0x17, 0x88, 0x6F, 0x3D, 0xD1,
+	0xC3, 0xD4, 0x6A, 0x7C, 0xA8, 0x73, 0x56, 0xCE, 0xC2, 0x15, 0xA4, 0x80, 0x12, 0x3B, 0xE5, 0xA3,
+	0x4E, 0x73, 0x05, 0x0D, 0x61, 0x0D, 0x55, 0x3E, 0xC7, 0xC6, 0xC7, 0x99, 0x8E, 0xA8, 0xF6, 0xCF,
+	0x06, 0xBC, 0x2C, 0xF7, 0xEF, 0x3F, 0x13, 0x38, 0x82, 0x14, 0x55, 0x17, 0x6A, 0x60, 0x89, 0x59,
+	0xF9, 0xC8, 0xB3, 0x86, 0x6A, 0x45, 0x0F, 0xC4, 0x82, 0x10, 0x51, 0xB4, 0x40, 0x92, 0x01, 0x07,
+	0x54, 0x17, 0xC0, 0xDC, 0x07, 0xB8, 0x21, 0x10, 0x0B, 0x82, 0xE4, 0x21, 0x07, 0xFE, 0x24, 0xA1,
+	0x24, 0x22, 0x19, 0x03, 0x08, 0x20, 0x20, 0x84, 0x2B, 0xE7, 0xA4, 0x27, 0x89, 0x28, 0xBB, 0xB4,
+	0x32, 0xE5, 0x44, 0x63, 0x78, 0x93, 0xCE, 0xE3, 0xE9, 0x8C, 0xA3, 0x85, 0x70, 0x0B, 0x57, 0x48,
+	0xA1, 0x33, 0x12, 0x88, 0x36, 0xC4, 0x1C, 0xEF, 0x74, 0xDE, 0xE1, 0x3B, 0x62, 0xA4, 0x6D, 0x9B,
+	0x33, 0xA7, 0x95, 0x7E, 0xCF, 0xE9, 0xA7, 0x3B, 0xC2, 0x5F, 0x20, 0xC9, 0x25, 0x05, 0x4E, 0x0A,
+	0x5B, 0x3D, 0x91, 0xB4, 0x3A, 0x4A, 0x88, 0xAE, 0xD0, 0x10, 0x7C, 0x78, 0xA5, 0x5C, 0x3E, 0xF3,
+	0xDC, 0x11, 0x6A, 0x44, 0x2A, 0xF8, 0x00, 0xC1, 0x00, 0x09, 0x34, 0x41, 0x89, 0x40, 0x00, 0x14,
+	0x61, 0x64, 0x2F, 0xC7, 0x08, 0x03, 0x4A, 0x78, 0x64, 0x44, 0x71, 0x03, 0x17, 0xA5, 0x08, 0xD4,
+	0x85, 0x19, 0xB4, 0xB4, 0xC3, 0x8F, 0x3D, 0xF0, 0xD0, 0xFB, 0xCD, 0x34, 0xB9, 0xC8, 0xC7, 0xAB,
+	0x44, 0x43, 0x1C, 0x32, 0xE7, 0xF9, 0xCF, 0x0C, 0x43, 0xA2, 0x14, 0x63, 0x98, 0x0F, 0xE9, 0xFB,
+	0xD4, 0x3C, 0x93, 0xC6, 0x0C, 0x81, 0x88, 0x61, 0x35, 0x03, 0x5A, 0x50, 0x93, 0xE9, 0x7D, 0xA7,
+	0xCC, 0x50, 0xC1, 0x10, 0xB6, 0x19, 0xC2, 0x19, 0x0E, 0x81, 0x0D, 0x70, 0x04, 0x28, 0x41, 0xC3,
+	0x58, 0x54, 0x00, 0xF9, 0xA0, 0x8D, 0x04, 0x31, 0xE8, 0x71, 0xD8, 0x98, 0xC1, 0x03, 0x2C, 0x32,
+	0x04, 0x2C, 0xF0, 0x61, 0x18, 0x9E, 0x7B, 0x47, 0x3A, 0xC4, 0x60, 0x17, 0x82, 0xBC, 0xC0, 0x1B,
+	0xF3, 0x08, 0xA1, 0x08, 0xE9, 0x31, 0x8F, 0x53, 0x28, 0x61, 0x03, 0x25, 0xA8, 0xC8, 0x0F, 0xF4,
+	0x50, 0x8C, 0xE7, 0x89, 0x47, 0x7A, 0x2E, 0xE0, 0x00, 0x05, 0x1C, 0xB0, 0x87, 0x29, 0x91, 0x8C,
+	0x1B, 0xF6, 0x60, 0x07, 0x38, 0x9A, 0x91, 0x8B, 0x45, 0x2C, 0xE2, 0x10, 0xFE, 0x99, 0xE8, 0x44,
+	0x28, 0xAA, 0x45, 0xBE, 0x32, 0x64, 0xE2, 0x88, 0x99, 0x70, 0xC4, 0x0B, 0x6C, 0xA7, 0xAE, 0x26,
+	0x3A, 0x31, 0x23, 0x17, 0x90, 0x41, 0x22, 0x08, 0x51, 0x85, 0x2B, 0xE0, 0x20, 0x0E, 0xD5, 0x53,
+	0x08, 0x0A, 0x04, 0xE1, 0x0D, 0x5A, 0x2D, 0x42, 0x71, 0x4F, 0x0C, 0xA3, 0x18, 0xC7, 0x78, 0x91,
+	0x6E, 0x85, 0x21, 0x0C, 0x13, 0x69, 0x48, 0x24, 0x22, 0xF1, 0x08, 0x64, 0x90, 0xF1, 0x8D, 0x70,
+	0xD4, 0x16, 0x77, 0xFC, 0x10, 0x06, 0xBE, 0xB8, 0xAD, 0x09, 0x8F, 0x30, 0x88, 0x1C, 0x00, 0x11,
+	0x89, 0x50, 0x30, 0xC6, 0x09, 0x44, 0xE0, 0x82, 0x2B, 0xE2, 0x48, 0xBE, 0x80, 0xC5, 0x63, 0x77,
+	0xB9, 0x41, 0x4B, 0x0A, 0x6A, 0x53, 0x3E, 0x44, 0x3A, 0x92, 0x2A, 0x77, 0x58, 0x00, 0x10, 0x74,
+	0xF7, 0xC8, 0x71, 0x68, 0x60, 0x02, 0xAD, 0x49, 0x8A, 0x3E, 0x36, 0xC9, 0x49, 0x4D, 0xFC, 0xEE,
+	0x04, 0x4C, 0xE0, 0xC8, 0x5E, 0x42, 0x62, 0x03, 0x10, 0x94, 0xC4, 0x00, 0x1F, 0x30, 0x4C, 0x0C,
+	0x98, 0xD0, 0x85, 0x4A, 0x84, 0x82, 0x10, 0x8B, 0x41, 0x15, 0x11, 0x56, 0x60, 0x01, 0x10, 0x88,
+	0x0B, 0x59, 0x43, 0xC8, 0xA5, 0x41, 0x72, 0xC9, 0x4B, 0x5E, 0x1A, 0xE4, 0x0C, 0xD9, 0x38, 0x8B,
+	0x3A, 0xD2, 0xB0, 0xA6, 0x81, 0x34, 0x45, 0x02, 0x9A, 0x20, 0x5B, 0x3E, 0x78, 0xB1, 0x35, 0x81,
+	0x0C, 0x01, 0x2E, 0x54, 0x71, 0x06, 0xB1, 0x1E, 0xB4, 0x00, 0x0D, 0x64, 0x2D, 0x1F, 0x51, 0x9B,
+	0x4D, 0x0A, 0xA8, 0xA1, 0x9C, 0xD4, 0xDC, 0xE5, 0x0B, 0xBC, 0xF8, 0xDA, 0x3C, 0x34, 0xB1, 0xA8,
+	0x0C, 0xDD, 0x8D, 0x6D, 0x1A, 0xDB, 0xD8, 0x29, 0xE3, 0x56, 0x80, 0x93, 0xFC, 0xC3, 0x06, 0x82,
+	0xB8, 0x04, 0x21, 0x08, 0x81, 0xAA, 0x1E, 0xAC, 0x00, 0x04, 0x16, 0xFE, 0x98, 0x8C, 0x20, 0x6A,
+	0x82, 0x91, 0xF2, 0x95, 0xCE, 0x34, 0xA7, 0x9B, 0xC7, 0xCF, 0x06, 0xB2, 0x30, 0xAA, 0x8C, 0x03,
+	0x36, 0x77, 0xE1, 0x03, 0xCF, 0x92, 0x32, 0x0C, 0x62, 0x4D, 0x64, 0x01, 0x29, 0x70, 0x86, 0xBD,
+	0x26, 0xA7, 0xB3, 0x77, 0x18, 0x14, 0xA1, 0x43, 0xF8, 0x03, 0x38, 0xB0, 0x99, 0x86, 0xD8, 0x6C,
+	0xE0, 0x4C, 0x77, 0x18, 0x81, 0x70, 0x26, 0x70, 0x87, 0x14, 0x51, 0x05, 0x1B, 0x42, 0x53, 0x0A,
+	0x2A, 0xCA, 0x29, 0x11, 0x92, 0xF5, 0xE5, 0x2F, 0x07, 0x28, 0x80, 0xDC, 0x02, 0x20, 0x83, 0xBB,
+	0x79, 0x21, 0x11, 0x60, 0x68, 0x0C, 0x11, 0xF0, 0x29, 0x99, 0xC0, 0x31, 0xC1, 0x65, 0x04, 0x01,
+	0x04, 0x20, 0x0C, 0x21, 0x91, 0xA6, 0x6C, 0xC0, 0x1A, 0x96, 0x7B, 0x87, 0x37, 0xFB, 0x83, 0x0E,
+	0xCF, 0xC8, 0x23, 0x1D, 0x14, 0x15, 0xC8, 0x1C, 0xD8, 0x11, 0xC2, 0xD2, 0xA1, 0xC2, 0x6A, 0x4D,
+	0x2B, 0x84, 0x26, 0xB6, 0xCA, 0xD5, 0xAE, 0x6E, 0xD5, 0x11, 0x15, 0x70, 0x0A, 0x12, 0xA6, 0xF2,
+	0x48, 0x9E, 0x38, 0xA2, 0x45, 0x17, 0x11, 0xC1, 0x1D, 0xBE, 0x96, 0x94, 0x77, 0x3C, 0x81, 0x89,
+	0x05, 0x41, 0x81, 0x10, 0x64, 0x70, 0x4A, 0x99, 0xCE, 0x2D, 0x00, 0x19, 0x40, 0x83, 0x1A, 0x04,
+	0xB2, 0x03, 0x34, 0x00, 0x42, 0x14, 0x9C, 0xC8, 0x84, 0x1D, 0xA2, 0xD0, 0x00, 0x04, 0x34, 0x40,
+	0x10, 0xE9, 0x12, 0x08, 0x2C, 0x26, 0x21, 0x0A, 0x69, 0x90, 0x23, 0x1B, 0xB1, 0x68, 0x85, 0x34,
+	0xA8, 0x74, 0x08, 0x00, 0x89, 0x03, 0x40, 0xCD, 0x50, 0xA0, 0x40, 0xBE, 0xD0, 0x8C, 0x05, 0x41,
+	0xCE, 0x41, 0x03, 0x11, 0x83, 0x38, 0x1E, 0x57, 0x21, 0x74, 0x44, 0xB5, 0x20, 0x1A, 0xA8, 0x40,
+	0x10, 0x34, 0xD1, 0x21, 0xA7, 0x0E, 0x63, 0x0E, 0x26, 0x40, 0xFE, 0xDB, 0x10, 0x4E, 0xF1, 0x4F,
+	0x7A, 0x78, 0xD2, 0x29, 0x6A, 0x45, 0x0A, 0x33, 0xE1, 0xEA, 0xCC, 0x33, 0x64, 0x32, 0x1F, 0xCE,
+	0x30, 0x02, 0x37, 0xA1, 0xA6, 0xBA, 0x62, 0x0D, 0x04, 0x05, 0x3F, 0x40, 0x81, 0x01, 0x08, 0x30,
+	0x80, 0x01, 0xA8, 0x00, 0x0D, 0x03, 0xE1, 0x48, 0x1C, 0x44, 0x51, 0x0C, 0x61, 0x90, 0x42, 0x11,
+	0x76, 0x20, 0x83, 0x13, 0x20, 0x31, 0x48, 0x81, 0xC4, 0xE1, 0xAF, 0xD2, 0x68, 0x47, 0x3D, 0xDC,
+	0x03, 0x9F, 0x51, 0x74, 0x62, 0x71, 0x11, 0x19, 0xC2, 0x18, 0xE0, 0x07, 0x29, 0x29, 0x50, 0xEE,
+	0x10, 0xFB, 0xE3, 0x45, 0x58, 0x6B, 0x93, 0x83, 0x35, 0x5C, 0xD6, 0x80, 0x00, 0xD2, 0x86, 0x16,
+	0xD0, 0x6A, 0x90, 0x2F, 0x58, 0xC2, 0xB3, 0x8F, 0x93, 0x1C, 0xE5, 0xFA, 0x80, 0x0E, 0xCB, 0xB1,
+	0xC3, 0x19, 0xF3, 0x15, 0x08, 0x71, 0xD2, 0x8B, 0x85, 0x51, 0xBC, 0x23, 0x84, 0xEF, 0xE8, 0x83,
+	0x43, 0xFF, 0x61, 0x82, 0x61, 0xA0, 0xEE, 0x74, 0x3C, 0xD1, 0x86, 0x12, 0x14, 0x00, 0x11, 0x14,
+	0xF8, 0x40, 0x05, 0x74, 0x28, 0x88, 0x10, 0xFC, 0x50, 0x8C, 0x1C, 0xBD, 0xE2, 0xBA, 0x79, 0xA0,
+	0xC2, 0x0D, 0x80, 0xF4, 0x86, 0x55, 0xE0, 0xC5, 0x0C, 0xDC, 0xF0, 0xC7, 0xF6, 0xEA, 0xF1, 0x8E,
+	0x75, 0xC0, 0xE7, 0x49, 0xAD, 0x98, 0xCF, 0x44, 0xCA, 0x50, 0xA6, 0x2F, 0x25, 0xE3, 0xC7, 0xC9,
+	0x40, 0x9F, 0x90, 0x87, 0x9C, 0x0C, 0x0E, 0x3A, 0x05, 0xA2, 0xEE, 0x63, 0xEF, 0xFB, 0x28, 0x85,
+	0x8D, 0x68, 0xE8, 0x0F, 0x3F, 0x6B, 0x60, 0xCB, 0x6D, 0xB4, 0xE1, 0x0D, 0x00, 0x81, 0x03, 0xBF,
+	0x08, 0xB2, 0x2C, 0x36, 0x4E, 0xBB, 0x4B, 0x5E, 0x40, 0xEE, 0xCB, 0xA4, 0x3D, 0x70, 0x70, 0x72,
+	0x70, 0x8A, 0x74, 0x64, 0xF0, 0xCC, 0x4E, 0xD5, 0x86, 0xFE, 0x66, 0x21, 0x22, 0x83, 0x2E, 0xD8,
+	0xE2, 0x18, 0xAC, 0x80, 0x1E, 0x15, 0x80, 0x84, 0x02, 0x0E, 0xF8, 0xE0, 0x16, 0x02, 0x61, 0xC2,
+	0x32, 0xF8, 0xB1, 0x8F, 0x7A, 0xA0, 0xC3, 0x1B, 0xCD, 0x88, 0x85, 0x29, 0x46, 0x71, 0x8A, 0x4E,
+	0xE0, 0xD9, 0x44, 0x64, 0x3A, 0x85, 0xA2, 0xA5, 0xA0, 0x00, 0x05, 0x40, 0x65, 0x28, 0x6B, 0x9A,
+	0x4D, 0xA3, 0x17, 0x0C, 0x11, 0xDA, 0x38, 0x3A, 0xD2, 0xC4, 0xC9, 0xB4, 0xA6, 0x37, 0x6D, 0x4E,
+	0x83, 0x70, 0xFA, 0xD3, 0xA0, 0xA6, 0x74, 0x87, 0x7F, 0x10, 0x0A, 0xF0, 0x88, 0xC7, 0x09, 0x36,
+	0xA8, 0xF3, 0x0C, 0x61, 0x00, 0x09, 0x81, 0xC8, 0x40, 0x10, 0xF6, 0x90, 0x95, 0x35, 0x84, 0xD1,
+	0x88, 0x42, 0xF4, 0x81, 0x10, 0x93, 0x18, 0xE2, 0x32, 0x4C, 0xB4, 0x86, 0x79, 0xCE, 0x53, 0x0C,
+	0x13, 0x26, 0xA4, 0xB0, 0x9F, 0xC8, 0x02, 0x3D, 0x28, 0xE2, 0x8F, 0x38, 0xE8, 0x80, 0x0D, 0xF6,
+	0x70, 0x68, 0xB5, 0x31, 0x61, 0x1B, 0xE6, 0xA8, 0x46, 0xAD, 0x1A, 0xE1, 0x88, 0x59, 0xE8, 0x22,
+	0x23, 0x9A, 0x1E, 0xB6, 0xB6, 0x9D, 0xC8, 0x81, 0x2E, 0xBC, 0x84, 0x0C, 0x91, 0xC8, 0x62, 0x87,
+	0x69, 0x31, 0x0D, 0x5E, 0xE8, 0x62, 0xD7, 0xDB, 0x4E, 0xB7, 0xBA, 0x35, 0x02, 0x87, 0x86, 0xC4,
+	0x81, 0x22, 0xED, 0x86, 0xC4, 0x27, 0x12, 0xBB, 0xEE, 0x7A, 0xD7, 0x9B, 0x5C, 0xDE, 0x22, 0xC2,
+	0x1B, 0x24, 0xB2, 0x47, 0x73, 0x39, 0x41, 0x15, 0xE8, 0xB6, 0x37, 0x41, 0x87, 0x50, 0x86, 0x39,
+	0xCC, 0x41, 0x0C, 0x5A, 0x10, 0x01, 0x0F, 0x00, 0xE8, 0x4C, 0x5D, 0x36, 0xAD, 0x97, 0x10, 0x8F,
+	0xB8, 0xC4, 0x7D, 0x19, 0xC0, 0x89, 0x47, 0xBC, 0xE2, 0x16, 0x77, 0x78, 0x44, 0xB8, 0x23, 0x87,
+	0x30, 0x80, 0xA4, 0x05, 0x47, 0x20, 0xAA, 0x1E, 0xFE, 0xF7, 0xF6, 0x89, 0x97, 0x38, 0x21, 0x0A,
+	0xDD, 0xAD, 0x77, 0x2E, 0x0B, 0x61, 0x8D, 0x43, 0xEE, 0x8E, 0x1E, 0xDE, 0x70, 0x84, 0x18, 0x84,
+	0x06, 0x16, 0x9D, 0xB5, 0xAE, 0xAC, 0xBB, 0x7B, 0x87, 0x15, 0x16, 0x90, 0x83, 0xDF, 0x3A, 0xD2,
+	0x1D, 0x41, 0x60, 0xC0, 0x29, 0x38, 0x49, 0x74, 0xA2, 0xFB, 0xA2, 0x99, 0x03, 0x81, 0x42, 0x1C,
+	0xE4, 0xE0, 0xAD, 0x90, 0xB8, 0x2D, 0x02, 0x4D, 0x28, 0x88, 0x15, 0x54, 0xC2, 0x12, 0x7A, 0x3A,
+	0xC1, 0x9E, 0x59, 0x70, 0xE3, 0xBA, 0x71, 0x47, 0xD6, 0xA4, 0xDC, 0xC3, 0x1C, 0xD6, 0xE0, 0x05,
+	0x36, 0xCC, 0x61, 0xD2, 0xA4, 0xC4, 0x63, 0xE7, 0xAB, 0x99, 0xC3, 0x30, 0x52, 0xAA, 0x1C, 0x77,
+	0x8C, 0x03, 0x1C, 0xDE, 0xD8, 0x0D, 0xBC, 0xD8, 0x9A, 0x8F, 0x53, 0x30, 0xC0, 0x08, 0x18, 0x74,
+	0xE4, 0x38, 0x86, 0xE1, 0xAF, 0x0A, 0x68, 0xC2, 0x17, 0x0B, 0x4D, 0x8A, 0x3C, 0xB4, 0xD1, 0xD1,
+	0x07, 0x71, 0x81, 0x23, 0x1E, 0x27, 0x25, 0x0A, 0x28, 0x00, 0x81, 0x0F, 0x10, 0xA9, 0x48, 0x5B,
+	0x10, 0x84, 0xC9, 0x52, 0xE6, 0x18, 0xC8, 0x54, 0x42, 0x19, 0xEA, 0xC6, 0x1D, 0xDB, 0x7B, 0x32,
+	0x4C, 0x4C, 0x2B, 0xC0, 0x04, 0xB4, 0x4D, 0x4A, 0x71, 0x8D, 0xD9, 0x26, 0x68, 0x26, 0x85, 0x76,
+	0x9B, 0x7E, 0x00, 0x1B, 0xC8, 0xE6, 0x8E, 0x1A, 0xCC, 0x66, 0x02, 0x9A, 0xA0, 0x3B, 0x4F, 0xE4,
+	0x41, 0xD1, 0xD9, 0xCC, 0x40, 0x1B, 0x3D, 0xAB, 0x85, 0x04, 0x45, 0x9D, 0x97, 0x8F, 0x68, 0x6C,
+	0x05, 0x1C, 0x8B, 0x40, 0x4C, 0x51, 0x60, 0x18, 0x19, 0x30, 0xA1, 0x12, 0xF2, 0x84, 0x65, 0x4E,
+	0xED, 0x89, 0x4F, 0x1B, 0xA4, 0xDC, 0x26, 0xB9, 0x6C, 0xD7, 0x21, 0x0E, 0xD1, 0x87, 0xB0, 0x12,
+	0xE4, 0x0C, 0x96, 0x98, 0xBE, 0xF6, 0xC5, 0xFE, 0xC0, 0x5F, 0xDB, 0x8C, 0x42, 0xF6, 0xEF, 0x20,
+	0x66, 0xA7, 0x15, 0x2C, 0x81, 0x53, 0xF4, 0xC4, 0x1B, 0xD6, 0x27, 0xC8, 0x6C, 0xCF, 0x32, 0x7A,
+	0x8C, 0x0B, 0x44, 0x01, 0x5A, 0xB0, 0x68, 0x3E, 0xDA, 0xFF, 0x00, 0x25, 0x6C, 0x9E, 0x27, 0xEE,
+	0xA8, 0xDD, 0x02, 0x90, 0x10, 0x8B, 0xAF, 0xC5, 0xE3, 0x0E, 0xD3, 0xA4, 0x10, 0x6B, 0x53, 0x47,
+	0xBF, 0x67, 0x4A, 0x10, 0xB0, 0x5C, 0x05, 0x10, 0x75, 0x78, 0xF1, 0x06, 0x97, 0x80, 0x32, 0x7F,
+	0x44, 0x04, 0x90, 0x21, 0x19, 0x5C, 0x00, 0x54, 0x17, 0x11, 0x08, 0xBD, 0x21, 0x0F, 0x18, 0xD6,
+	0x13, 0xED, 0x67, 0x1B, 0x81, 0x50, 0x76, 0xF9, 0x90, 0x7F, 0xB1, 0x31, 0x04, 0xD7, 0x64, 0x76,
+	0xB5, 0x27, 0x11, 0x6F, 0x81, 0x14, 0xF2, 0xF0, 0x56, 0xC5, 0x71, 0x06, 0x49, 0xD3, 0x13, 0xEF,
+	0x10, 0x55, 0x0B, 0x83, 0x14, 0x67, 0xE5, 0x14, 0x13, 0x90, 0x06, 0x87, 0x34, 0x0E, 0x22, 0x65,
+	0x4C, 0x33, 0xD0, 0x75, 0x3D, 0x11, 0x0F, 0x5A, 0xC0, 0x06, 0xF2, 0x67, 0x5B, 0x01, 0x08, 0x11,
+	0x30, 0xA0, 0x17, 0xBF, 0x67, 0x01, 0x1E, 0x23, 0x53, 0x02, 0x90, 0x00, 0x96, 0x21, 0x04, 0x95,
+	0x80, 0x32, 0x2F, 0x11, 0x13, 0x3C, 0xD5, 0x00, 0x13, 0x70, 0x4B, 0x14, 0x54, 0x16, 0x22, 0x34,
+	0x42, 0xEA, 0x50, 0x22, 0xCE, 0x14, 0x4E, 0xA8, 0x03, 0x5C, 0x0E, 0x55, 0x3E, 0xB2, 0x27, 0x0F,
+	0x6C, 0xD0, 0x22, 0xC6, 0x45, 0x10, 0x13, 0x90, 0x02, 0x97, 0xD4, 0x41, 0x03, 0x11, 0x08, 0xB2,
+	0xE7, 0x0C, 0x1B, 0x30, 0x01, 0x58, 0x30, 0x06, 0xCD, 0x80, 0x7F, 0xAE, 0x77, 0x17, 0x43, 0xC1,
+	0x00, 0x66, 0x58, 0x1C, 0xDB, 0xE4, 0x48, 0xBC, 0xB0, 0x48, 0xBC, 0x85, 0x17, 0x4C, 0x00, 0x12,
+	0xF7, 0x54, 0x12, 0x31, 0x65, 0x1D, 0xFE, 0x02, 0x80, 0x02, 0x79, 0x64, 0x7C, 0x8A, 0x21, 0x4B,
+	0xB4, 0x84, 0x01, 0x18, 0x00, 0x38, 0x24, 0xF0, 0x7C, 0x17, 0xB1, 0x00, 0x0C, 0x90, 0x02, 0xDA,
+	0x70, 0x66, 0x0D, 0x25, 0x1C, 0x65, 0x30, 0x0E, 0x59, 0x38, 0x0F, 0x73, 0x10, 0x1B, 0x63, 0x40,
+	0x76, 0x17, 0x76, 0x0F, 0xD2, 0x24, 0x3A, 0x16, 0x27, 0x02, 0x10, 0xE7, 0x4C, 0xC3, 0x80, 0x73,
+	0xCB, 0x84, 0x74, 0x12, 0xA1, 0x01, 0xAD, 0x78, 0x16, 0x1F, 0x62, 0x86, 0x14, 0x21, 0x03, 0x3F,
+	0xF0, 0x2D, 0x1C, 0xE3, 0x31, 0xD4, 0x31, 0x18, 0x01, 0x40, 0x00, 0x4B, 0x70, 0x37, 0x6F, 0xF0,
+	0x6D, 0x7E, 0x20, 0x09, 0x20, 0xD0, 0x53, 0x81, 0xF3, 0x06, 0x98, 0x37, 0x10, 0x8F, 0x00, 0x08,
+	0x92, 0x30, 0x0B, 0x3A, 0x26, 0x11, 0x65, 0xA0, 0x0D, 0x5F, 0xC6, 0x0E, 0x73, 0xD0, 0x7D, 0x43,
+	0x10, 0x08, 0xEC, 0x90, 0x41, 0xE0, 0xD0, 0x1C, 0x77, 0xC1, 0x39, 0x9D, 0x91, 0x85, 0x7D, 0xD0,
+	0x7D, 0x04, 0x75, 0x0A, 0xA5, 0x28, 0x7B, 0xAF, 0xE8, 0x14, 0x63, 0x70, 0x7F, 0xF3, 0x60, 0x0D,
+	0xD6, 0xC0, 0x21, 0x3D, 0x33, 0x50, 0x15, 0x91, 0x13, 0x81, 0x97, 0x14, 0x98, 0x73, 0x86, 0x04,
+	0x81, 0x5C, 0x47, 0x20, 0x43, 0x1F, 0x23, 0x37, 0xD6, 0x71, 0x00, 0x4D, 0xE0, 0x09, 0x02, 0x81,
+	0x02, 0x91, 0xD0, 0x1D, 0x0D, 0xA8, 0x07, 0x93, 0x81, 0x00, 0x0C, 0x80, 0x06, 0xAA, 0x70, 0x0D,
+	0x03, 0x31, 0x09, 0x92, 0xB0, 0x0B, 0xDB, 0x90, 0x0B, 0xA7, 0xD0, 0x6C, 0x10, 0xB1, 0x39, 0xE3,
+	0x70, 0x59, 0x00, 0x82, 0x0D, 0x41, 0x40, 0x39, 0xB5, 0x00, 0x66, 0x39, 0xE3, 0x4C, 0xDA, 0xB8,
+	0x8D, 0x9E, 0x63, 0x5A, 0xA2, 0x83, 0x05, 0xBC, 0x30, 0x0E, 0xF2, 0xF0, 0x89, 0xF3, 0x60, 0x1A,
+	0xEF, 0x90, 0x0D, 0x85, 0xE7, 0xFE, 0x4F, 0x17, 0x96, 0x0F, 0x9B, 0xB8, 0x00, 0x13, 0x70, 0x4D,
+	0xC0, 0x11, 0x88, 0xB6, 0xF1, 0x07, 0xB8, 0xC7, 0x13, 0x20, 0x74, 0x16, 0xDA, 0x90, 0x83, 0x13,
+	0xC1, 0x02, 0xFB, 0x78, 0x80, 0x76, 0xF5, 0x8B, 0x2A, 0x20, 0x08, 0x03, 0xA1, 0x07, 0xDF, 0x35,
+	0x0B, 0xB6, 0x70, 0x6C, 0x76, 0x40, 0x02, 0x0C, 0x40, 0x02, 0x95, 0x00, 0x54, 0xA8, 0xD0, 0x09,
+	0xB3, 0xB0, 0x0D, 0xEF, 0x30, 0x0E, 0xCD, 0x60, 0x0A, 0xD1, 0x98, 0x5E, 0xA7, 0x10, 0x0E, 0x9B,
+	0x02, 0x20, 0x33, 0x22, 0x1C, 0x63, 0x80, 0x0D, 0x07, 0x34, 0x0E, 0xA1, 0x53, 0x1B, 0x5A, 0x40,
+	0x8D, 0x5F, 0x86, 0x0E, 0x6B, 0xA9, 0x10, 0x4D, 0xE1, 0x01, 0x99, 0x98, 0x41, 0xE3, 0x60, 0x04,
+	0x7B, 0xB8, 0x00, 0x43, 0x30, 0x0C, 0x9F, 0x28, 0x0F, 0x71, 0xF9, 0x0F, 0x6B, 0x20, 0x0F, 0xF4,
+	0xB0, 0x81, 0x11, 0x51, 0x1F, 0x5F, 0xE3, 0x0D, 0x78, 0xB9, 0x7A, 0x67, 0x31, 0x0E, 0x1D, 0x29,
+	0x11, 0x28, 0xC0, 0x02, 0x3E, 0xD0, 0x8F, 0x83, 0x91, 0x01, 0x5E, 0x10, 0x62, 0xFF, 0x80, 0x08,
+	0x4B, 0x27, 0x09, 0xB6, 0xF0, 0x3C, 0xD8, 0x45, 0x06, 0x7A, 0xF0, 0x06, 0xAE, 0x80, 0x09, 0x02,
+	0x81, 0x09, 0x92, 0xD0, 0x09, 0xC4, 0x20, 0x5E, 0xEF, 0x60, 0x0E, 0xD9, 0x90, 0x0B, 0x99, 0x70,
+	0x6D, 0x8C, 0xF3, 0x0C, 0x4C, 0xC6, 0x7D, 0x8C, 0x34, 0x07, 0x9C, 0x22, 0x96, 0xCE, 0x00, 0x88,
+	0x03, 0x21, 0x02, 0xA7, 0x60, 0x59, 0x01, 0x42, 0x31, 0x67, 0x38, 0x06, 0xE0, 0x00, 0x66, 0xD7,
+	0x58, 0x1C, 0x63, 0x30, 0x0E, 0x67, 0xA6, 0x0D, 0xA1, 0x71, 0x17, 0x8D, 0x36, 0x69, 0xF8, 0xF8,
+	0x05, 0xA6, 0xF0, 0x0E, 0xA7, 0xE3, 0x0E, 0x73, 0x60, 0x17, 0xC7, 0x71, 0x73, 0x3D, 0xE1, 0x0E,
+	0xFB, 0x65, 0x5C, 0xC1, 0xFE, 0x03, 0x18, 0x03, 0x50, 0x00, 0x32, 0x20, 0x2E, 0xA1, 0xE4, 0x07,
+	0xA9, 0xD0, 0x3C, 0xE0, 0xD1, 0x06, 0xD1, 0x13, 0x05, 0xAD, 0x26, 0x10, 0x2A, 0x51, 0x0A, 0xDB,
+	0x60, 0x0F, 0xDC, 0xC3, 0x0E, 0xE3, 0xD0, 0x24, 0xE6, 0x65, 0x91, 0xB7, 0xB3, 0x06, 0xD1, 0x70,
+	0x9F, 0x4E, 0x46, 0x0D, 0x87, 0x40, 0x23, 0x43, 0x80, 0x04, 0x63, 0x30, 0x0C, 0x91, 0x32, 0x29,
+	0xA7, 0x90, 0x39, 0x1A, 0x97, 0x02, 0xB5, 0x20, 0x96, 0x9B, 0x22, 0x96, 0xA7, 0xB0, 0x01, 0x1C,
+	0xD6, 0x34, 0x81, 0x50, 0x65, 0x08, 0x72, 0x59, 0x1C, 0x29, 0x1C, 0xE0, 0x04, 0x66, 0xE9, 0xB0,
+	0x5B, 0xFD, 0x74, 0x06, 0xBC, 0xD0, 0x5A, 0x8A, 0x92, 0x21, 0x35, 0xF8, 0x0E, 0xFF, 0x74, 0x3A,
+	0xC3, 0xE0, 0x01, 0xC5, 0x12, 0x3C, 0x07, 0x40, 0x99, 0x70, 0x60, 0x31, 0x4C, 0x00, 0x09, 0xBF,
+	0x90, 0x23, 0x2E, 0x94, 0x07, 0xD2, 0x33, 0x3D, 0x78, 0x56, 0x04, 0x5D, 0x40, 0x0B, 0xF6, 0xC0,
+	0x0F, 0xDB, 0x03, 0x0F, 0x91, 0xD3, 0x24, 0x14, 0xF9, 0x95, 0x10, 0xF1, 0x05, 0xA7, 0x30, 0x64,
+	0x73, 0xD2, 0x0B, 0x72, 0x22, 0x64, 0xF8, 0x59, 0x27, 0xBC, 0x40, 0x0D, 0x56, 0x81, 0x56, 0x1A,
+	0xD0, 0x07, 0x01, 0x4A, 0x29, 0xFD, 0x22, 0x06, 0x62, 0x30, 0x07, 0x87, 0x60, 0x1F, 0xB5, 0x29,
+	0x96, 0xE4, 0x90, 0x09, 0x18, 0x92, 0x03, 0x67, 0x30, 0x06, 0xA7, 0x40, 0x0D, 0x01, 0xC2, 0x9B,
+	0xE2, 0x70, 0x0A, 0x73, 0xA0, 0x05, 0x5C, 0xB8, 0x4B, 0xEE, 0x42, 0x0D, 0xE3, 0x60, 0x60, 0xEC,
+	0x30, 0x0C, 0x77, 0xA0, 0x05, 0x0A, 0xF3, 0x07, 0x54, 0x9A, 0x0E, 0x4E, 0x15, 0x8E, 0xF3, 0x20,
+	0x2B, 0xF7, 0x02, 0x1B, 0x6A, 0xF3, 0x03, 0xE9, 0x49, 0x10, 0x42, 0x10, 0x09, 0x39, 0x72, 0x0C,
+	0xA4, 0xC0, 0x09, 0xFE, 0x76, 0x40, 0x05, 0x3F, 0x12, 0x24, 0x82, 0xD0, 0x0D, 0x2F, 0xD6, 0x0E,
+	0xFE, 0xD0, 0x0F, 0x7D, 0xB6, 0x95, 0x3C, 0x7A, 0x0A, 0x60, 0x54, 0x44, 0xB5, 0xF0, 0x25, 0x96,
+	0x7A, 0xA9, 0x44, 0xFA, 0x63, 0x43, 0x16, 0x26, 0x13, 0xA6, 0x00, 0x12, 0xA0, 0x05, 0xA7, 0x80,
+	0x9F, 0x4A, 0x06, 0x29, 0xCF, 0x60, 0x09, 0x52, 0xE0, 0x08, 0x93, 0x42, 0x0D, 0x6B, 0x89, 0x04,
+	0xBC, 0x90, 0x29, 0xB5, 0x39, 0x96, 0xE4, 0x00, 0x0E, 0xD4, 0xE0, 0x8D, 0x10, 0x81, 0x05, 0x07,
+	0xA2, 0x20, 0x0F, 0x04, 0x92, 0x18, 0xF2, 0x05, 0xD4, 0x90, 0x0E, 0x6C, 0x4A, 0x92, 0x19, 0xB4,
+	0x5B, 0xF8, 0x68, 0x7C, 0xE3, 0x79, 0x0C, 0xA0, 0x80, 0x5D, 0x2A, 0xA6, 0x03, 0x75, 0x26, 0x03,
+	0xE9, 0xC9, 0x04, 0x9F, 0xC0, 0x0F, 0x8E, 0x5A, 0x0F, 0xEC, 0xE0, 0x0D, 0x4E, 0x42, 0x91, 0x99,
+	0x40, 0x0B, 0xAE, 0x42, 0x3E, 0x70, 0xD2, 0x0A, 0x8A, 0x26, 0x06, 0x1B, 0x20, 0x05, 0x73, 0xD0,
+	0x07, 0xD4, 0x27, 0x06, 0x2F, 0xF0, 0x00, 0x0A, 0xA0, 0x01, 0x46, 0x20, 0x05, 0xEA, 0x6A, 0x04,
+	0x71, 0xB8, 0x87, 0x05, 0xD1, 0x14, 0x13, 0xA0, 0x01, 0x33, 0x60, 0x04, 0x62, 0x10, 0x2C, 0x52,
+	0x60, 0x04, 0x33, 0x20, 0x01, 0x66, 0xB8, 0x01, 0x33, 0xD0, 0xAF, 0x33, 0x40, 0x2C, 0x2F, 0xE0,
+	0xAF, 0x02, 0x3B, 0xB0, 0xFE, 0xCA, 0x86, 0x06, 0x21, 0xB0, 0x41, 0x90, 0xB0, 0x0A, 0xAB, 0xB0,
+	0x08, 0x15, 0xB0, 0x33, 0xA0, 0xB0, 0x35, 0x10, 0xB1, 0x12, 0x3B, 0xB1, 0x29, 0x40, 0x8E, 0x0A,
+	0xF1, 0x03, 0x68, 0x50, 0x0C, 0xAF, 0x10, 0x67, 0x76, 0xE0, 0x04, 0x37, 0x10, 0x24, 0x32, 0xC4,
+	0x05, 0x78, 0x56, 0x84, 0x7B, 0x56, 0x0F, 0xE9, 0xA0, 0x0D, 0x5D, 0xB9, 0x08, 0x96, 0xA0, 0x68,
+	0xA1, 0xE0, 0xFE, 0xA3, 0x0A, 0x51, 0x06, 0x84, 0x80, 0x44, 0x99, 0x00, 0x04, 0x9C, 0xA6, 0x60,
+	0x99, 0x26, 0x1B, 0x9B, 0x06, 0x21, 0x94, 0x16, 0x6A, 0xB4, 0xF1, 0x50, 0x3C, 0x6B, 0xB3, 0x3C,
+	0xAB, 0x93, 0x3F, 0x10, 0x09, 0xA0, 0x70, 0x5D, 0x6D, 0x00, 0x48, 0x41, 0x42, 0x01, 0x14, 0x70,
+	0x01, 0x44, 0x02, 0x03, 0x68, 0x20, 0x5E, 0xEC, 0x00, 0x1F, 0xB5, 0x32, 0x7D, 0x99, 0x90, 0x6B,
+	0x44, 0x94, 0x5E, 0x62, 0xE0, 0x6B, 0x84, 0x70, 0x08, 0xB8, 0x29, 0x70, 0x5E, 0x7B, 0x11, 0x28,
+	0xB0, 0x04, 0xA9, 0xC0, 0x08, 0xC7, 0x36, 0x05, 0x44, 0xD0, 0x02, 0x8B, 0x17, 0x45, 0x7E, 0x70,
+	0x68, 0x32, 0xA0, 0x0A, 0xF0, 0x60, 0x63, 0xCC, 0xB0, 0x09, 0x8D, 0xC0, 0x07, 0xBD, 0xA6, 0x6B,
+	0x14, 0x11, 0x03, 0xBD, 0x36, 0x4F, 0x7D, 0x20, 0x02, 0xB6, 0xF8, 0xB5, 0x7E, 0x3B, 0x94, 0x68,
+	0xC0, 0x09, 0x84, 0x10, 0x85, 0xB4, 0x04, 0x02, 0xD0, 0x45, 0x10, 0x21, 0xF0, 0x03, 0xD2, 0x00,
+	0xB7, 0xB5, 0xC2, 0x07, 0x7D, 0x20, 0x0A, 0x57, 0x5B, 0x11, 0x13, 0xF0, 0x02, 0x2F, 0x30, 0x01,
+	0x7D, 0xFB, 0xB7, 0x98, 0x0B, 0x11, 0x2C, 0x20, 0x09, 0x84, 0xC0, 0x06, 0x55, 0xD0, 0x03, 0x38,
+	0xB0, 0x05, 0x90, 0x40, 0x6F, 0xC7, 0x85, 0x06, 0xE1, 0x00, 0x1F, 0x72, 0xDB, 0x9A, 0x0E, 0xA9,
+	0x11, 0x3D, 0x9B, 0xB9, 0xAE, 0x6B, 0x10, 0x2C, 0xB0, 0x04, 0xE7, 0x52, 0x45, 0x90, 0x40, 0x0B,
+	0xA2, 0xF2, 0x09, 0x4D, 0x12, 0x59, 0xAE, 0xF9, 0xBA, 0xBC, 0x7B, 0x2D, 0x2C, 0xF0, 0x06, 0x60,
+	0x90, 0x07, 0xA5, 0x20, 0x6E, 0x0A, 0x11, 0x3C, 0xBB, 0xE0, 0x0B, 0xBA, 0x20, 0x9A, 0xBD, 0xBB,
+	0xBC, 0xD6, 0xA2, 0x02, 0x6F, 0x40, 0xBC, 0x12, 0xA1, 0x02, 0x7D, 0xCA, 0xBC, 0xD4, 0x9B, 0x11,
+	0x01, 0x01, 0x01, 0x00, 0x3B,
+};
+
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY bench_gif_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "bench.gif", 4629, bench_gif };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &bench_gif_dir
+#endif
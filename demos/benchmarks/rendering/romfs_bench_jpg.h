@@ -0,0 +1,124 @@
+/**
+ * This file was generated from "bench.jpg" using...
+ *
+ *	file2c -dcsn bench_jpg bench.jpg romfs_bench_jpg.h
+ *
+ */
+static const char bench_jpg[] = {
+	0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x84, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08,
+	0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0A, 0x0C, 0x14, 0x0D, 0x0C, 0x0B, 0x0B, 0x0C, 0x19, 0x12,
+	0x13, 0x0F, 0x14, 0x1D, 0x1A, 0x1F, 0x1E, 0x1D, 0x1A, 0x1C, 0x1C, 0x20, 0x24, 0x2E, 0x27, 0x20,
+	0x22, 0x2C, 0x23, 0x1C, 0x1C, 0x28, 0x37, 0x29, 0x2C, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1F, 0x27,
+	0x39, 0x3D, 0x38, 0x32, 0x3C, 0x2E, 0x33, 0x34, 0x32, 0x01, 0x09, 0x09, 0x09, 0x0C, 0x0B, 0x0C,
+	0x18, 0x0D, 0x0D, 0x18, 0x32, 0x21, 0x1C, 0x21, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+	0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00,
+	0x40, 0x00, 0x80, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x01,
+	0xA2, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x10, 0x00,
+	0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7D, 0x01,
+	0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22,
+	0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0, 0x24,
+	0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x29,
+	0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A,
+	0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+	0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A,
+	0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8,
+	0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6,
+	0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2, 0xE3,
+	0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9,
+	0xFA, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x11, 0x00,
+	0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+	0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+	0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0, 0x15,
+	0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26, 0x27,
+	0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+	0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+	0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+	0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6,
+	0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4,
+	0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE2,
+	0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9,
+	0xFA, 0xFF, 0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0xF0,
+	0xC4, 0xB7, 0xF6, 0xA9, 0xD2, 0xDF, 0xDA, 0xAF, 0x25, 0xBF, 0xB5, 0x58, 0x4B, 0x7F, 0x6A, 0xE9,
+	0xA4, 0x8E, 0x78, 0x62, 0x0E, 0xD1, 0xE1, 0xF6, 0xAA, 0xEF, 0x0F, 0xB5, 0x6C, 0x3C, 0x3E, 0xD5,
+	0x03, 0xC3, 0xED, 0x5E, 0xBD, 0x5C, 0x59, 0xFA, 0x74, 0xEB, 0x1C, 0x1A, 0x5B, 0xFB, 0x54, 0xE9,
+	0x6F, 0xED, 0x57, 0x92, 0xDF, 0xDA, 0xAC, 0x25, 0xBF, 0xB5, 0x75, 0x52, 0x47, 0xC3, 0xC3, 0x10,
+	0x57, 0x78, 0x7D, 0xAA, 0xBB, 0xC3, 0xED, 0x5E, 0xA9, 0xA0, 0x7C, 0x3B, 0x59, 0xE2, 0x8E, 0xEF,
+	0x58, 0x69, 0x10, 0x37, 0xCC, 0x2D, 0x57, 0x83, 0x8C, 0x8C, 0x6E, 0x3D, 0xB3, 0xCF, 0x03, 0x9E,
+	0x47, 0x20, 0xF1, 0x5D, 0x84, 0x1E, 0x17, 0xD0, 0x6D, 0xE1, 0x58, 0x93, 0x48, 0xB3, 0x65, 0x5C,
+	0xE0, 0xC9, 0x10, 0x91, 0xBA, 0xE7, 0x96, 0x6C, 0x93, 0xF9, 0xD7, 0xE7, 0xB8, 0xCE, 0x24, 0xA1,
+	0x4E, 0x5C, 0xB0, 0xBC, 0x9F, 0x96, 0xC7, 0xBD, 0x53, 0x14, 0xAF, 0x64, 0x78, 0x62, 0x5B, 0xFB,
+	0x54, 0xEB, 0x00, 0x03, 0x27, 0x80, 0x3B, 0xD7, 0xB8, 0x3F, 0x87, 0xF4, 0x79, 0x23, 0x64, 0x3A,
+	0x5D, 0x98, 0x0C, 0x08, 0x3B, 0x61, 0x55, 0x3F, 0x81, 0x03, 0x23, 0xEA, 0x2B, 0x97, 0xF1, 0x07,
+	0xC3, 0xD8, 0xAE, 0x20, 0x79, 0x34, 0x89, 0x1A, 0x27, 0x51, 0x9F, 0xB3, 0x39, 0xCA, 0xB9, 0xE3,
+	0x80, 0xC7, 0x91, 0xDF, 0xAE, 0x79, 0x23, 0xA5, 0x7D, 0x1E, 0x1F, 0xC4, 0x1C, 0x0C, 0xA2, 0xD4,
+	0xA9, 0xCA, 0x32, 0xE9, 0x7B, 0x59, 0xFA, 0xBE, 0x9F, 0x71, 0x85, 0x3A, 0xDA, 0xD9, 0x9E, 0x39,
+	0x06, 0x9E, 0x21, 0x1B, 0xDC, 0x66, 0x43, 0xFA, 0x53, 0xDE, 0x1F, 0x6A, 0xD9, 0x9A, 0xD5, 0xE2,
+	0x91, 0xA3, 0x91, 0x19, 0x1D, 0x49, 0x56, 0x56, 0x18, 0x20, 0x8E, 0xA0, 0x8A, 0xAC, 0xF0, 0xFB,
+	0x57, 0xDD, 0xE1, 0xDD, 0x1C, 0x2D, 0x15, 0x4A, 0x86, 0x91, 0x5F, 0x8F, 0x9B, 0x3C, 0x4A, 0xB8,
+	0x87, 0x27, 0x76, 0x39, 0x2D, 0xFD, 0xAA, 0x74, 0xB7, 0xF6, 0xAB, 0xC9, 0x6F, 0xED, 0x56, 0x12,
+	0xDF, 0xDA, 0xBF, 0x33, 0xA4, 0x8F, 0xD0, 0x61, 0x88, 0x3C, 0xE5, 0xE1, 0xF6, 0xAA, 0xEF, 0x0F,
+	0xB5, 0x6C, 0x3C, 0x3E, 0xD5, 0x5D, 0xE1, 0xF6, 0xAF, 0xB5, 0xAB, 0x8B, 0x3F, 0x27, 0x9D, 0x63,
+	0xD9, 0x1E, 0x1F, 0x6A, 0x81, 0xE1, 0xF6, 0xAD, 0x77, 0x87, 0xDA, 0xA0, 0x78, 0x7D, 0xAB, 0xE6,
+	0x2A, 0xE2, 0xCF, 0xD2, 0x67, 0x58, 0xF3, 0x04, 0xB7, 0xF6, 0xA9, 0xD2, 0xDF, 0xDA, 0xAF, 0x25,
+	0xBF, 0xB5, 0x58, 0x4B, 0x7F, 0x6A, 0xF5, 0x29, 0x23, 0xF2, 0xB8, 0x62, 0x0B, 0x6F, 0x0F, 0xB5,
+	0x75, 0x5E, 0x0C, 0xD0, 0x62, 0x91, 0x9B, 0x53, 0xB9, 0x8B, 0x76, 0xC6, 0xC5, 0xB8, 0x6E, 0x99,
+	0x1D, 0x5B, 0x18, 0xE7, 0x1D, 0x01, 0xF5, 0x07, 0xB8, 0x15, 0x8A, 0xF0, 0xFB, 0x57, 0xA2, 0xE8,
+	0xD0, 0xA4, 0x1A, 0x35, 0x9A, 0x46, 0xB8, 0x1E, 0x52, 0xB1, 0x19, 0xEE, 0x46, 0x4F, 0xEA, 0x4D,
+	0x7E, 0x73, 0x9B, 0xE3, 0xA4, 0xA8, 0xF2, 0x45, 0xEF, 0xF9, 0x1F, 0x7B, 0x56, 0xAB, 0x6A, 0xC8,
+	0xBD, 0x45, 0x14, 0x57, 0xCA, 0x1C, 0xE1, 0x45, 0x14, 0x50, 0x07, 0x27, 0xE3, 0x2D, 0x06, 0x2B,
+	0xAB, 0x53, 0xA9, 0x41, 0x16, 0x2E, 0x62, 0xC7, 0x9A, 0x57, 0xF8, 0xD3, 0xA6, 0x48, 0xC7, 0x24,
+	0x71, 0xCF, 0xA6, 0x7D, 0x05, 0x70, 0xC9, 0x6F, 0xED, 0x5E, 0xC5, 0x2C, 0x49, 0x3C, 0x2F, 0x14,
+	0x8B, 0xB9, 0x1D, 0x4A, 0xB0, 0xCE, 0x32, 0x0F, 0x06, 0xBC, 0xCD, 0x2D, 0xFD, 0xAB, 0xEA, 0x72,
+	0x2A, 0xD2, 0x9D, 0x37, 0x4D, 0xFD, 0x9F, 0xC9, 0x9B, 0xD2, 0xAC, 0xE3, 0xA3, 0x38, 0xC7, 0x87,
+	0xDA, 0xA0, 0x78, 0x7D, 0xAB, 0x5D, 0xE1, 0xF6, 0xA8, 0x1E, 0x1F, 0x6A, 0xFD, 0x0E, 0xAE, 0x2C,
+	0xF8, 0x49, 0xD6, 0x3A, 0xB4, 0xB7, 0xF6, 0xA9, 0xD2, 0xDF, 0xDA, 0xAF, 0x25, 0xBF, 0xB5, 0x58,
+	0x4B, 0x7F, 0x6A, 0xE5, 0xA4, 0x8F, 0xD4, 0xA1, 0x88, 0x38, 0x14, 0xB7, 0xF6, 0xA9, 0xD2, 0xDF,
+	0xDA, 0xAF, 0x25, 0xBF, 0xB5, 0x58, 0x4B, 0x7F, 0x6A, 0x74, 0x91, 0xF8, 0x34, 0x31, 0x06, 0xF3,
+	0xC3, 0xED, 0x50, 0x3C, 0x3E, 0xD5, 0xAE, 0xF0, 0xFB, 0x54, 0x0F, 0x0F, 0xB5, 0x7C, 0x0D, 0x5C,
+	0x59, 0xFA, 0xDC, 0xEB, 0x1C, 0xCA, 0x5B, 0xFB, 0x57, 0xA3, 0x69, 0x85, 0x4E, 0x95, 0x69, 0xB4,
+	0x82, 0x04, 0x2A, 0x38, 0x3D, 0xC0, 0xC1, 0xAE, 0x39, 0x60, 0x00, 0x64, 0xF0, 0x07, 0x7A, 0xDD,
+	0xF0, 0xEE, 0xA4, 0x92, 0x2B, 0xD9, 0x13, 0x82, 0x87, 0x31, 0x67, 0xF8, 0x87, 0x7F, 0xF1, 0xFC,
+	0x7D, 0xAB, 0xE9, 0xF8, 0xD6, 0x10, 0x96, 0x0E, 0x9B, 0xE6, 0xF7, 0x93, 0xDB, 0xBA, 0xB6, 0xBF,
+	0x76, 0x87, 0xC8, 0xE4, 0x78, 0xA5, 0xED, 0x9C, 0x1F, 0x55, 0xF8, 0x9B, 0xF4, 0x51, 0x45, 0x7E,
+	0x66, 0x7D, 0x70, 0x51, 0x45, 0x14, 0x00, 0x8C, 0xCA, 0x88, 0x5D, 0xD8, 0x2A, 0xA8, 0xC9, 0x24,
+	0xE0, 0x01, 0x5E, 0x4C, 0xF0, 0xFB, 0x57, 0xA2, 0x6B, 0xF7, 0x82, 0x0B, 0x16, 0x81, 0x18, 0x79,
+	0xB3, 0x0D, 0xB8, 0xF4, 0x5E, 0xE7, 0xFA, 0x7E, 0x3E, 0xD5, 0xC5, 0xBC, 0x3E, 0xD5, 0xF5, 0xDC,
+	0x3C, 0xA5, 0x42, 0x8C, 0xEA, 0x3F, 0xB5, 0x6F, 0xC2, 0xFF, 0x00, 0xE6, 0x7C, 0xCE, 0x77, 0x89,
+	0x8F, 0xB4, 0x8D, 0x35, 0xD3, 0x7F, 0x99, 0xB0, 0x96, 0xFE, 0xD5, 0x3A, 0x5B, 0xFB, 0x55, 0xE4,
+	0xB7, 0xF6, 0xAB, 0x09, 0x6F, 0xED, 0x5F, 0x4D, 0x49, 0x1E, 0xF4, 0x31, 0x07, 0x91, 0xBC, 0x3E,
+	0xD5, 0x03, 0xC3, 0xED, 0x5A, 0xEF, 0x0F, 0xB5, 0x32, 0x3B, 0x26, 0x9D, 0xF6, 0xA8, 0xC0, 0xEE,
+	0x7D, 0x2B, 0xC3, 0x55, 0xAA, 0x56, 0xA8, 0xA9, 0xD3, 0x57, 0x93, 0xD9, 0x1F, 0x99, 0xD4, 0xAE,
+	0x92, 0xBB, 0x3D, 0x7D, 0xE1, 0xF6, 0xA8, 0x1E, 0x1F, 0x6A, 0xD7, 0x78, 0x7D, 0xAA, 0x07, 0x87,
+	0xDA, 0xBE, 0x52, 0xAE, 0x2C, 0xFD, 0x2A, 0x75, 0x8E, 0x19, 0x2D, 0xFD, 0xAA, 0x75, 0x80, 0x01,
+	0x93, 0xC0, 0x1D, 0xEA, 0xF2, 0xC0, 0x00, 0xC9, 0xE0, 0x0E, 0xF5, 0x4E, 0x76, 0x33, 0x1D, 0x89,
+	0xC4, 0x63, 0xF5, 0xAF, 0xD5, 0x73, 0x0C, 0xD2, 0x8E, 0x5D, 0x47, 0x9E, 0x7A, 0xC9, 0xEC, 0xBB,
+	0xFF, 0x00, 0xC0, 0xEE, 0xCF, 0xC8, 0x28, 0xD4, 0x73, 0x66, 0xEC, 0x1A, 0x78, 0x84, 0x6F, 0x71,
+	0x99, 0x0F, 0xE9, 0x4E, 0x68, 0x88, 0x39, 0x1C, 0x1A, 0xD7, 0x78, 0x7D, 0xAA, 0x07, 0x87, 0xDA,
+	0xB8, 0x68, 0xAA, 0x38, 0x4A, 0x2A, 0x8D, 0x25, 0x68, 0xAF, 0xC7, 0xCD, 0x9F, 0x73, 0x57, 0x10,
+	0xE4, 0xEE, 0xCC, 0x9B, 0x1D, 0x55, 0x64, 0x8D, 0x52, 0xE7, 0xE5, 0x93, 0xA6, 0xFC, 0x70, 0x7F,
+	0xC3, 0xF9, 0x56, 0x92, 0xB2, 0xBA, 0x86, 0x56, 0x0C, 0x0F, 0x70, 0x73, 0x58, 0x29, 0x6F, 0xED,
+	0x56, 0x12, 0xDF, 0xDA, 0xBE, 0x05, 0xE5, 0xF1, 0x9B, 0xBC, 0x5D, 0x8B, 0xC3, 0x67, 0xF5, 0x23,
+	0x1E, 0x5A, 0x8B, 0x9B, 0xF0, 0x66, 0xB1, 0x20, 0x02, 0x49, 0xC0, 0x1D, 0x49, 0xAA, 0x77, 0x5A,
+	0x8C, 0x70, 0xA9, 0x11, 0xFE, 0xF2, 0x4C, 0x71, 0x8E, 0x83, 0xEA, 0x6A, 0x07, 0x87, 0xDA, 0xA0,
+	0x78, 0x7D, 0xAB, 0xA2, 0x19, 0x65, 0x1A, 0x72, 0xBC, 0xE5, 0xCD, 0xF8, 0x06, 0x23, 0x88, 0x2A,
+	0x4A, 0x36, 0xA7, 0x1E, 0x5F, 0x3D, 0xFF, 0x00, 0xC8, 0x9B, 0xCA, 0x69, 0x1C, 0xB3, 0x12, 0x58,
+	0xF5, 0x35, 0x32, 0x5B, 0xFB, 0x55, 0xE4, 0xB7, 0xF6, 0xAB, 0x09, 0x6F, 0xED, 0x5F, 0x51, 0x46,
+	0x29, 0x24, 0x90, 0xA3, 0x88, 0xBE, 0xAD, 0x9E, 0x6C, 0xF0, 0xFB, 0x54, 0x0F, 0x0F, 0xB5, 0x6B,
+	0xBC, 0x3E, 0xD4, 0xC8, 0xEC, 0x9A, 0x77, 0xDA, 0xA3, 0x03, 0xB9, 0xF4, 0xAF, 0x99, 0x55, 0xAA,
+	0x56, 0xA8, 0xA9, 0xD3, 0x57, 0x93, 0xD9, 0x1F, 0x21, 0x52, 0xBA, 0x4A, 0xEC, 0xEE, 0x24, 0x55,
+	0x81, 0x37, 0x30, 0xC9, 0xEC, 0x3D, 0x6A, 0x8B, 0x46, 0xD2, 0xB9, 0x77, 0xE4, 0xFF, 0x00, 0x2A,
+	0xBC, 0xD1, 0xB4, 0xAE, 0x5D, 0xF9, 0x3F, 0xCA, 0xA5, 0x4B, 0x7F, 0x6A, 0xE2, 0xCD, 0xB3, 0xAA,
+	0x99, 0x85, 0x4E, 0x58, 0xE9, 0x4D, 0x6C, 0xBB, 0xF9, 0xBF, 0xEB, 0x43, 0xF5, 0x2A, 0x13, 0x50,
+	0x5E, 0x67, 0xFF, 0xD9,
+};
+
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY bench_jpg_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "bench.jpg", 1748, bench_jpg };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &bench_jpg_dir
+#endif
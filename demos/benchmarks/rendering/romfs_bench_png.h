@@ -0,0 +1,1183 @@
+/**
+ * This file was generated from "bench.png" using...
+ *
+ *	file2c -dcsn bench_png bench.png romfs_bench_png.h
+ *
+ */
+static const char bench_png[] = {
+	0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x08, 0x02, 0x00, 0x00, 0x00, 0x5D, 0xB4, 0xE8,
+	0x28, 0x00, 0x00, 0x48, 0xCA, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0xCC, 0xDB, 0xEF, 0x57, 0x92,
+	0x89, 0xFE, 0xEF, 0xFF, 0xCB, 0xA2, 0x24, 0xC3, 0xBA, 0x4A, 0x32, 0xAC, 0x2B, 0x25, 0xC3, 0x24,
+	0x45, 0xA3, 0x24, 0xC3, 0xA2, 0x44, 0xC3, 0xBC, 0x52, 0x34, 0x2C, 0x26, 0xC9, 0xA8, 0x98, 0x62,
+	0x8A, 0x1A, 0xDA, 0xB1, 0x27, 0xEB, 0x43, 0x27, 0x56, 0xA1, 0x83, 0x23, 0x63, 0x58, 0x94, 0x64,
+	0x58, 0x94, 0xE4, 0xE0, 0xC8, 0x28, 0x1A, 0x26, 0x29, 0x16, 0x25, 0x29, 0x1A, 0x16, 0x25, 0x29,
+	0x1A, 0x26, 0xF9, 0x2B, 0x4D, 0xD3, 0x34, 0xCD, 0x7E, 0xFF, 0x3C, 0xDF, 0xB5, 0xF6, 0x9D, 0xB3,
+	0xD6, 0xF7, 0xCE, 0x59, 0x67, 0x7D, 0x3E, 0x7B, 0xCF, 0x5A, 0xAF, 0xBF, 0xE0, 0xF1, 0xBC, 0xF3,
+	0xBE, 0xF3, 0x06, 0x00, 0x00, 0x98, 0x04, 0x4C, 0x46, 0x00, 0x53, 0xA7, 0x02, 0xD3, 0x90, 0x00,
+	0xCA, 0x03, 0x98, 0x89, 0x02, 0x66, 0xCF, 0x00, 0xE6, 0x80, 0x00, 0x66, 0x36, 0x30, 0x1F, 0x0D,
+	0xF8, 0x7A, 0x03, 0x0B, 0x31, 0x00, 0x6E, 0x1E, 0x10, 0x08, 0x01, 0x41, 0xBE, 0x40, 0x48, 0x17,
+	0xD0, 0xF4, 0x14, 0xB0, 0x75, 0x00, 0x8D, 0xED, 0x40, 0xC3, 0x63, 0xA0, 0xAE, 0x15, 0x30, 0xB7,
+	0x00, 0xB7, 0x1E, 0x01, 0x37, 0x9A, 0x80, 0xAA, 0x07, 0x80, 0xE1, 0x3E, 0x50, 0xDE, 0x08, 0x94,
+	0xDD, 0x05, 0x4A, 0xEA, 0x01, 0x6D, 0x1D, 0x50, 0x78, 0x07, 0x28, 0xA0, 0x02, 0x9C, 0x68, 0x60,
+	0x37, 0x0D, 0xD8, 0xB3, 0x1E, 0xD8, 0x07, 0x03, 0xFC, 0x38, 0xE0, 0x20, 0x1D, 0xF8, 0x25, 0x11,
+	0x38, 0xCC, 0x00, 0x84, 0x9B, 0x80, 0x63, 0x4C, 0xE0, 0xF8, 0x16, 0x20, 0x8D, 0x05, 0x48, 0x52,
+	0x80, 0x4C, 0x36, 0x90, 0xB5, 0x03, 0xC8, 0xCE, 0x07, 0x0E, 0x5E, 0x02, 0xF8, 0x17, 0x81, 0x7D,
+	0x79, 0xC0, 0x9E, 0xF3, 0xC0, 0xEE, 0x73, 0x00, 0x27, 0x07, 0xD8, 0x7E, 0x06, 0x48, 0x39, 0x0D,
+	0x24, 0x67, 0x03, 0xCC, 0x93, 0x40, 0xD2, 0xEF, 0x40, 0x62, 0x26, 0x10, 0x9F, 0x01, 0xC0, 0xBF,
+	0x02, 0x31, 0x69, 0x40, 0xB4, 0x18, 0x30, 0xA7, 0x03, 0x75, 0x12, 0xA0, 0xE1, 0x37, 0xA0, 0x51,
+	0x0A, 0xD8, 0xB2, 0x80, 0x26, 0x19, 0xD0, 0x7C, 0x0A, 0x68, 0x95, 0x03, 0xCE, 0xB3, 0x40, 0x87,
+	0x02, 0xE8, 0xCC, 0x05, 0x7A, 0x94, 0x40, 0xDF, 0x05, 0x60, 0x40, 0x05, 0x0C, 0x5D, 0x06, 0x46,
+	0x76, 0x02, 0x33, 0xB7, 0x03, 0xA8, 0x6D, 0xC0, 0xB4, 0xAD, 0xC0, 0xD4, 0x64, 0x60, 0xF2, 0x0F,
+	0x00, 0xB0, 0x19, 0xF8, 0x9A, 0x04, 0x7C, 0xDA, 0x08, 0xBC, 0x4F, 0x00, 0xDE, 0xC4, 0x03, 0xE3,
+	0x1B, 0x80, 0xD1, 0x58, 0x60, 0x38, 0x06, 0x18, 0x5C, 0x07, 0xF4, 0x47, 0x01, 0xBD, 0x66, 0x00,
+	0x5B, 0x0B, 0x2C, 0xB2, 0x00, 0x8B, 0x1B, 0x80, 0x25, 0x56, 0x80, 0x70, 0x0F, 0x58, 0x6A, 0x03,
+	0x96, 0x3F, 0x04, 0x56, 0xD8, 0x01, 0x72, 0x33, 0xB0, 0xDA, 0x01, 0xAC, 0x6D, 0x03, 0xA2, 0x9C,
+	0x00, 0xED, 0x09, 0x10, 0xEB, 0x02, 0xE2, 0x3A, 0x81, 0x04, 0x3F, 0xE0, 0xEA, 0x02, 0x40, 0x37,
+	0x1F, 0xF8, 0xCB, 0x07, 0xF8, 0x73, 0x2E, 0xF0, 0xC7, 0x1C, 0x40, 0xED, 0x05, 0x5C, 0x9A, 0x05,
+	0x5C, 0x98, 0x09, 0x9C, 0xF7, 0x04, 0x14, 0xD3, 0x81, 0x33, 0xD3, 0x80, 0x53, 0xEE, 0xC0, 0xC9,
+	0x29, 0x80, 0x74, 0x32, 0x90, 0xE1, 0x06, 0xA4, 0x03, 0x00, 0x62, 0xF2, 0x24, 0xC4, 0x54, 0x04,
+	0x62, 0xDA, 0x54, 0x04, 0x0A, 0x89, 0x98, 0xE9, 0x81, 0x98, 0x8D, 0x42, 0xCC, 0x99, 0x81, 0xC0,
+	0x80, 0x88, 0xF9, 0xB3, 0x11, 0xBE, 0x68, 0xC4, 0x42, 0x6F, 0x04, 0x0E, 0x83, 0x08, 0x9C, 0x87,
+	0x08, 0x82, 0x10, 0x21, 0xBE, 0x08, 0x62, 0x17, 0xC2, 0xF6, 0x14, 0xD1, 0xD8, 0x81, 0x68, 0x68,
+	0x47, 0xD4, 0x3D, 0x46, 0x98, 0x5B, 0x11, 0xB7, 0x5A, 0x10, 0x37, 0x1E, 0x21, 0xAA, 0x9A, 0x10,
+	0x86, 0x07, 0x88, 0xF2, 0xFB, 0x88, 0xB2, 0x46, 0x44, 0xC9, 0x5D, 0x84, 0xB6, 0x1E, 0x51, 0x58,
+	0x87, 0x28, 0xB8, 0x83, 0xC8, 0xA7, 0x22, 0x76, 0x47, 0x23, 0xF6, 0xD0, 0x10, 0xFB, 0xD6, 0x23,
+	0xF8, 0x30, 0xE2, 0x60, 0x1C, 0xE2, 0x17, 0x3A, 0xE2, 0x70, 0x22, 0x42, 0xC8, 0x40, 0x1C, 0xDB,
+	0x84, 0x38, 0xCE, 0x44, 0xA4, 0x6D, 0x41, 0x48, 0x58, 0x88, 0xCC, 0x14, 0x44, 0x16, 0x1B, 0x91,
+	0xBD, 0x03, 0x21, 0xCF, 0x47, 0xF0, 0x2F, 0x21, 0xF6, 0x5D, 0x44, 0xEC, 0xC9, 0x43, 0xEC, 0x3E,
+	0x8F, 0xE0, 0x9C, 0x43, 0x6C, 0xCF, 0x41, 0xA4, 0x9C, 0x41, 0x24, 0x9F, 0x46, 0x30, 0xB3, 0x11,
+	0x49, 0x27, 0x11, 0x89, 0xBF, 0x23, 0xE2, 0x33, 0x11, 0x70, 0x06, 0x22, 0xE6, 0x57, 0x44, 0x74,
+	0x1A, 0x22, 0x52, 0x8C, 0xA8, 0x4B, 0x47, 0x34, 0x48, 0x10, 0x8D, 0xBF, 0x21, 0x6C, 0x52, 0x44,
+	0x53, 0x16, 0xA2, 0x59, 0x86, 0x68, 0x3D, 0x85, 0x70, 0xCA, 0x11, 0x1D, 0x67, 0x11, 0x9D, 0x0A,
+	0x44, 0x4F, 0x2E, 0xA2, 0x4F, 0x89, 0x18, 0xB8, 0x80, 0x18, 0x52, 0x21, 0x46, 0x2E, 0x23, 0xC6,
+	0x76, 0x22, 0x50, 0xDB, 0x11, 0xD3, 0xB6, 0x21, 0xA6, 0x6E, 0x45, 0x4C, 0x4E, 0x46, 0x00, 0x3F,
+	0x20, 0xBE, 0x6E, 0x46, 0x7C, 0x4A, 0x42, 0xBC, 0xDF, 0x88, 0x78, 0x93, 0x80, 0x18, 0x8F, 0x47,
+	0x8C, 0x6E, 0x40, 0x0C, 0xC7, 0x22, 0x06, 0x63, 0x10, 0xFD, 0xEB, 0x10, 0xBD, 0x51, 0x88, 0x2E,
+	0x33, 0x62, 0x51, 0x2D, 0x62, 0xB1, 0x05, 0xB1, 0xA4, 0x01, 0x41, 0xB0, 0x22, 0x96, 0xDE, 0x43,
+	0x2C, 0xB7, 0x21, 0x56, 0x3C, 0x44, 0x90, 0xED, 0x88, 0xD5, 0xCD, 0x88, 0xB5, 0x0E, 0x44, 0x54,
+	0x1B, 0x82, 0xE6, 0x44, 0xC4, 0x3E, 0x41, 0xC4, 0xB9, 0x10, 0x09, 0x9D, 0x08, 0x86, 0x1F, 0x42,
+	0xB7, 0x00, 0xF1, 0xD7, 0x7C, 0xC4, 0x9F, 0x3E, 0x88, 0x3F, 0xE6, 0x22, 0xD4, 0x73, 0x10, 0x97,
+	0xBC, 0x10, 0x17, 0x66, 0x21, 0xCE, 0xCF, 0x44, 0x28, 0x3C, 0x11, 0x67, 0xA6, 0x23, 0x4E, 0x4D,
+	0x43, 0x9C, 0x74, 0x47, 0x48, 0xA7, 0x20, 0x32, 0x26, 0x23, 0xD2, 0xDD, 0x10, 0x27, 0x00, 0x00,
+	0x39, 0x75, 0x12, 0x72, 0x1A, 0x02, 0x89, 0x9A, 0x8A, 0x9C, 0x89, 0x44, 0xCE, 0xF6, 0x40, 0xCE,
+	0x41, 0x21, 0x31, 0x33, 0x90, 0xF3, 0x41, 0xA4, 0xEF, 0x6C, 0xE4, 0x42, 0x34, 0x12, 0xE7, 0x8D,
+	0x0C, 0xC4, 0x20, 0x83, 0xE6, 0x21, 0x43, 0x20, 0x24, 0xD1, 0x17, 0x19, 0xD6, 0x85, 0x6C, 0x7C,
+	0x8A, 0x6C, 0xE8, 0x40, 0xD6, 0xB5, 0x23, 0xCD, 0x8F, 0x91, 0xB7, 0x5A, 0x91, 0x37, 0x5A, 0x90,
+	0x55, 0x8F, 0x90, 0x86, 0x26, 0x64, 0xF9, 0x03, 0x64, 0xD9, 0x7D, 0x64, 0x49, 0x23, 0x52, 0x7B,
+	0x17, 0x59, 0x58, 0x8F, 0x2C, 0xA8, 0x43, 0xE6, 0xDF, 0x41, 0xAA, 0xA8, 0xC8, 0x3D, 0xD1, 0xC8,
+	0x7D, 0x34, 0x24, 0x7F, 0x3D, 0xF2, 0x20, 0x8C, 0xFC, 0x25, 0x0E, 0x79, 0x98, 0x8E, 0x14, 0x26,
+	0x22, 0x8F, 0x31, 0x90, 0xC7, 0x37, 0x21, 0xD3, 0x98, 0x48, 0xC9, 0x16, 0x64, 0x26, 0x0B, 0x99,
+	0x95, 0x82, 0xCC, 0x66, 0x23, 0xE5, 0x3B, 0x90, 0x39, 0xF9, 0xC8, 0x7D, 0x97, 0x90, 0x7B, 0x2E,
+	0x22, 0x77, 0xE7, 0x21, 0x39, 0xE7, 0x91, 0xDB, 0xCF, 0x21, 0x53, 0x72, 0x90, 0xC9, 0x67, 0x90,
+	0xCC, 0xD3, 0xC8, 0xA4, 0x6C, 0x64, 0xE2, 0x49, 0x64, 0xFC, 0xEF, 0x48, 0x38, 0x13, 0x19, 0x93,
+	0x81, 0x8C, 0xFE, 0x15, 0x19, 0x99, 0x86, 0xA4, 0x88, 0x91, 0x0D, 0xE9, 0xC8, 0x46, 0x09, 0xD2,
+	0xF6, 0x1B, 0xB2, 0x49, 0x8A, 0x6C, 0xCE, 0x42, 0xB6, 0xCA, 0x90, 0xCE, 0x53, 0xC8, 0x0E, 0x39,
+	0xB2, 0xF3, 0x2C, 0xB2, 0x47, 0x81, 0xEC, 0xCB, 0x45, 0x0E, 0x28, 0x91, 0x43, 0x17, 0x90, 0x23,
+	0x2A, 0xE4, 0xD8, 0x65, 0xE4, 0xC4, 0x4E, 0xE4, 0xB4, 0xED, 0xC8, 0xA9, 0xDB, 0x90, 0x93, 0xB7,
+	0x22, 0x81, 0x64, 0xE4, 0xD7, 0x1F, 0x90, 0x9F, 0x36, 0x23, 0xDF, 0x27, 0x21, 0xDF, 0x6C, 0x44,
+	0x8E, 0x27, 0x20, 0x47, 0xE3, 0x91, 0xC3, 0x1B, 0x90, 0x83, 0xB1, 0xC8, 0xFE, 0x18, 0x64, 0xEF,
+	0x3A, 0x64, 0x57, 0x14, 0xD2, 0x65, 0x46, 0x2E, 0xAE, 0x45, 0x2E, 0xB1, 0x20, 0x09, 0x0D, 0xC8,
+	0xA5, 0x56, 0xE4, 0xF2, 0x7B, 0xC8, 0x15, 0x36, 0x24, 0xF9, 0x21, 0x72, 0xB5, 0x1D, 0xB9, 0xB6,
+	0x19, 0x19, 0xE5, 0x40, 0xD2, 0xDA, 0x90, 0xB1, 0x4E, 0x64, 0xDC, 0x13, 0x64, 0x82, 0x0B, 0xC9,
+	0xE8, 0x44, 0x6E, 0xF6, 0x43, 0xFE, 0xB5, 0x00, 0xF9, 0xE7, 0x7C, 0xE4, 0x1F, 0x3E, 0x48, 0xF5,
+	0x5C, 0xE4, 0xA5, 0x39, 0xC8, 0x0B, 0x5E, 0xC8, 0xF3, 0xB3, 0x90, 0x8A, 0x99, 0xC8, 0x33, 0x9E,
+	0xC8, 0x53, 0xD3, 0x91, 0x27, 0xA7, 0x21, 0xA5, 0xEE, 0xC8, 0x8C, 0x29, 0xC8, 0xF4, 0xC9, 0xC8,
+	0x13, 0x6E, 0x48, 0x11, 0x00, 0xA0, 0xA6, 0x4D, 0x42, 0xA1, 0x10, 0xA8, 0x99, 0x53, 0x51, 0xB3,
+	0x91, 0xA8, 0x39, 0x1E, 0x28, 0x0C, 0x0A, 0x35, 0x7F, 0x06, 0xCA, 0x17, 0x44, 0x2D, 0x9C, 0x8D,
+	0xC2, 0xA1, 0x51, 0x81, 0xDE, 0xA8, 0x20, 0x0C, 0x2A, 0x64, 0x1E, 0x8A, 0x08, 0xA1, 0xC2, 0x7C,
+	0x51, 0xE1, 0x5D, 0xA8, 0x86, 0xA7, 0xA8, 0xBA, 0x0E, 0x94, 0xB9, 0x1D, 0x75, 0xEB, 0x31, 0xEA,
+	0x46, 0x2B, 0xAA, 0xAA, 0x05, 0x65, 0x78, 0x84, 0x2A, 0x6F, 0x42, 0x95, 0x3D, 0x40, 0x95, 0xDC,
+	0x47, 0x69, 0x1B, 0x51, 0x85, 0x77, 0x51, 0x05, 0xF5, 0xA8, 0xFC, 0x3A, 0x94, 0xEA, 0x0E, 0x2A,
+	0x8F, 0x8A, 0xDA, 0x17, 0x8D, 0xE2, 0xD3, 0x50, 0x07, 0xD7, 0xA3, 0x7E, 0x81, 0x51, 0x87, 0xE3,
+	0x50, 0x42, 0x3A, 0xEA, 0x58, 0x22, 0xEA, 0x38, 0x03, 0x95, 0xB6, 0x09, 0x25, 0x61, 0xA2, 0x32,
+	0xB7, 0xA0, 0xB2, 0x58, 0xA8, 0xEC, 0x14, 0x94, 0x9C, 0x8D, 0xCA, 0xD9, 0x81, 0xCA, 0xCD, 0x47,
+	0xED, 0xB9, 0x84, 0xDA, 0x7D, 0x11, 0xC5, 0xC9, 0x43, 0x6D, 0x3F, 0x8F, 0x4A, 0x39, 0x87, 0x4A,
+	0xCE, 0x41, 0x31, 0xCF, 0xA0, 0x92, 0x4E, 0xA3, 0x12, 0xB3, 0x51, 0xF1, 0x27, 0x51, 0xF0, 0xEF,
+	0xA8, 0x98, 0x4C, 0x54, 0x74, 0x06, 0x2A, 0xF2, 0x57, 0x14, 0x25, 0x0D, 0x15, 0x21, 0x46, 0x35,
+	0xA6, 0xA3, 0x6C, 0x12, 0x54, 0xD3, 0x6F, 0xA8, 0x66, 0x29, 0xAA, 0x35, 0x0B, 0xE5, 0x94, 0xA1,
+	0x3A, 0x4E, 0xA1, 0x3A, 0xE5, 0xA8, 0x9E, 0xB3, 0xA8, 0x3E, 0x05, 0x6A, 0x20, 0x17, 0x35, 0xA4,
+	0x44, 0x8D, 0x5C, 0x40, 0x8D, 0xA9, 0x50, 0x13, 0x97, 0x51, 0xEF, 0x76, 0xA2, 0xA6, 0x6E, 0x47,
+	0x4D, 0xDE, 0x86, 0x02, 0xB6, 0xA2, 0xBE, 0x26, 0xA3, 0x3E, 0xFD, 0x80, 0x7A, 0xBF, 0x19, 0xF5,
+	0x26, 0x09, 0x35, 0xBE, 0x11, 0x35, 0x9A, 0x80, 0x1A, 0x8E, 0x47, 0x0D, 0x6E, 0x40, 0xF5, 0xC7,
+	0xA2, 0x7A, 0x63, 0x50, 0x5D, 0xEB, 0x50, 0xAE, 0x28, 0x54, 0xBB, 0x19, 0xB5, 0xA4, 0x16, 0x45,
+	0xB0, 0xA0, 0x96, 0x36, 0xA0, 0x96, 0x5B, 0x51, 0x2B, 0xEE, 0xA1, 0xC8, 0x36, 0xD4, 0xEA, 0x87,
+	0xA8, 0xB5, 0x76, 0x54, 0x54, 0x33, 0x8A, 0xE6, 0x40, 0xC5, 0xB6, 0xA1, 0xE2, 0x9C, 0xA8, 0x84,
+	0x27, 0x28, 0x86, 0x0B, 0xB5, 0xB9, 0x13, 0xB5, 0xC5, 0x0F, 0xF5, 0xE7, 0x02, 0xD4, 0x1F, 0xF3,
+	0x51, 0x6A, 0x1F, 0xD4, 0xA5, 0xB9, 0xA8, 0x0B, 0x73, 0x50, 0xE7, 0xBD, 0x50, 0x8A, 0x59, 0xA8,
+	0x33, 0x33, 0x51, 0xA7, 0x3C, 0x51, 0x27, 0xA7, 0xA3, 0xA4, 0xD3, 0x50, 0x19, 0xEE, 0xA8, 0xF4,
+	0x29, 0xA8, 0x13, 0x93, 0x51, 0x22, 0x37, 0xD4, 0x51, 0x00, 0x00, 0x51, 0x93, 0xC0, 0x99, 0x08,
+	0x70, 0xF6, 0x54, 0x70, 0x0E, 0x12, 0xC4, 0x78, 0x80, 0xF3, 0x51, 0xA0, 0xEF, 0x0C, 0x70, 0x21,
+	0x08, 0xE2, 0x66, 0x83, 0x81, 0x68, 0x30, 0xC8, 0x1B, 0x0C, 0xC1, 0x80, 0xC4, 0x79, 0x60, 0x18,
+	0x04, 0x86, 0xFB, 0x82, 0x11, 0x5D, 0x60, 0xDD, 0x53, 0xD0, 0xDC, 0x01, 0xDE, 0x6A, 0x07, 0x6F,
+	0x3C, 0x06, 0xAB, 0x5A, 0x41, 0x43, 0x0B, 0x58, 0xFE, 0x08, 0x2C, 0x6B, 0x02, 0x4B, 0x1E, 0x80,
+	0xDA, 0xFB, 0x60, 0x61, 0x23, 0x58, 0x70, 0x17, 0xCC, 0xAF, 0x07, 0x55, 0x75, 0x60, 0xDE, 0x1D,
+	0x30, 0x97, 0x0A, 0xF2, 0xA3, 0xC1, 0x83, 0x34, 0xF0, 0x97, 0xF5, 0xE0, 0x61, 0x18, 0x14, 0xC6,
+	0x81, 0xC7, 0xE8, 0xE0, 0xF1, 0x44, 0x30, 0x8D, 0x01, 0x4A, 0x36, 0x81, 0x99, 0x4C, 0x30, 0x6B,
+	0x0B, 0x98, 0xCD, 0x02, 0xE5, 0x29, 0x60, 0x0E, 0x1B, 0xCC, 0xDD, 0x01, 0xE6, 0xE5, 0x83, 0xBB,
+	0x2F, 0x81, 0x9C, 0x8B, 0xE0, 0xF6, 0x3C, 0x30, 0xE5, 0x3C, 0x98, 0x7C, 0x0E, 0x64, 0xE6, 0x80,
+	0x49, 0x67, 0xC0, 0xC4, 0xD3, 0x60, 0x7C, 0x36, 0x08, 0x9F, 0x04, 0x63, 0x7E, 0x07, 0xA3, 0x33,
+	0xC1, 0xC8, 0x0C, 0x90, 0xF2, 0x2B, 0x18, 0x91, 0x06, 0x86, 0x8B, 0x41, 0x5B, 0x3A, 0xD8, 0x24,
+	0x01, 0x9B, 0x7F, 0x03, 0x5B, 0xA5, 0xA0, 0x33, 0x0B, 0xEC, 0x90, 0x81, 0x9D, 0xA7, 0xC0, 0x1E,
+	0x39, 0xD8, 0x77, 0x16, 0x1C, 0x50, 0x80, 0x43, 0xB9, 0xE0, 0x88, 0x12, 0x1C, 0xBB, 0x00, 0x4E,
+	0xA8, 0xC0, 0x77, 0x97, 0xC1, 0x8F, 0x3B, 0xC1, 0xC9, 0xDB, 0x41, 0x60, 0x1B, 0xF8, 0x75, 0x2B,
+	0xF8, 0x29, 0x19, 0x7C, 0xFF, 0x03, 0xF8, 0x66, 0x33, 0x38, 0x9E, 0x04, 0x8E, 0x6E, 0x04, 0x87,
+	0x13, 0xC0, 0xC1, 0x78, 0xB0, 0x7F, 0x03, 0xD8, 0x1B, 0x0B, 0x76, 0xC5, 0x80, 0xAE, 0x75, 0x60,
+	0x7B, 0x14, 0xD8, 0x66, 0x06, 0x09, 0xB5, 0xE0, 0x52, 0x0B, 0xB8, 0xBC, 0x01, 0x5C, 0x61, 0x05,
+	0xC9, 0xF7, 0xC0, 0xD5, 0x36, 0x70, 0xED, 0x43, 0x30, 0xCA, 0x0E, 0xD2, 0x9A, 0xC1, 0x58, 0x07,
+	0x18, 0xD7, 0x06, 0x26, 0x38, 0x41, 0xC6, 0x13, 0x70, 0xB3, 0x0B, 0xDC, 0xD2, 0x09, 0x6E, 0xF5,
+	0x03, 0xFF, 0x58, 0x00, 0xAA, 0xE7, 0x83, 0x97, 0x7C, 0xC0, 0x0B, 0x73, 0xC1, 0xF3, 0x73, 0x40,
+	0x85, 0x17, 0x78, 0x66, 0x16, 0x78, 0x6A, 0x26, 0x78, 0xD2, 0x13, 0x94, 0x4E, 0x07, 0x33, 0xA6,
+	0x81, 0xE9, 0xEE, 0xE0, 0x89, 0x29, 0xA0, 0x68, 0x32, 0x78, 0xD4, 0x0D, 0x3C, 0x02, 0x00, 0xE8,
+	0x99, 0x93, 0xD0, 0xB3, 0x11, 0xE8, 0x39, 0x53, 0xD1, 0x18, 0x24, 0x7A, 0xBE, 0x07, 0xDA, 0x17,
+	0x85, 0x5E, 0x38, 0x03, 0x8D, 0x03, 0xD1, 0x81, 0xB3, 0xD1, 0x41, 0x68, 0x74, 0x88, 0x37, 0x9A,
+	0x88, 0x41, 0x87, 0xCD, 0x43, 0x87, 0x43, 0xE8, 0x08, 0x5F, 0x34, 0xA5, 0x0B, 0x6D, 0x7E, 0x8A,
+	0xBE, 0xD5, 0x81, 0xBE, 0xD1, 0x8E, 0xAE, 0x7A, 0x8C, 0x36, 0xB4, 0xA2, 0xCB, 0x5B, 0xD0, 0x65,
+	0x8F, 0xD0, 0x25, 0x4D, 0x68, 0xED, 0x03, 0x74, 0xE1, 0x7D, 0x74, 0x41, 0x23, 0x3A, 0xFF, 0x2E,
+	0x5A, 0x55, 0x8F, 0xCE, 0xAB, 0x43, 0xE7, 0xDE, 0x41, 0xE7, 0x50, 0xD1, 0x07, 0xA3, 0xD1, 0xBF,
+	0xD0, 0xD0, 0x87, 0xD7, 0xA3, 0x85, 0x30, 0xFA, 0x58, 0x1C, 0xFA, 0x38, 0x1D, 0x9D, 0x96, 0x88,
+	0x96, 0x30, 0xD0, 0x99, 0x9B, 0xD0, 0x59, 0x4C, 0x74, 0xF6, 0x16, 0xB4, 0x9C, 0x85, 0xCE, 0x49,
+	0x41, 0xE7, 0xB2, 0xD1, 0x79, 0x3B, 0xD0, 0xAA, 0x7C, 0x34, 0xE7, 0x12, 0x7A, 0xFB, 0x45, 0x74,
+	0x4A, 0x1E, 0x3A, 0xF9, 0x3C, 0x9A, 0x79, 0x0E, 0x9D, 0x94, 0x83, 0x4E, 0x3C, 0x83, 0x8E, 0x3F,
+	0x8D, 0x86, 0xB3, 0xD1, 0x31, 0x27, 0xD1, 0xD1, 0xBF, 0xA3, 0x23, 0x33, 0xD1, 0x94, 0x0C, 0x74,
+	0xC4, 0xAF, 0xE8, 0xF0, 0x34, 0x74, 0x98, 0x18, 0xDD, 0x94, 0x8E, 0x6E, 0x96, 0xA0, 0x5B, 0x7F,
+	0x43, 0x3B, 0xA5, 0xE8, 0x8E, 0x2C, 0x74, 0xA7, 0x0C, 0xDD, 0x73, 0x0A, 0xDD, 0x27, 0x47, 0x0F,
+	0x9C, 0x45, 0x0F, 0x29, 0xD0, 0x23, 0xB9, 0xE8, 0x31, 0x25, 0x7A, 0xE2, 0x02, 0xFA, 0x9D, 0x0A,
+	0xFD, 0xF1, 0x32, 0xFA, 0xCB, 0x4E, 0x34, 0xB0, 0x1D, 0xFD, 0x75, 0x1B, 0xFA, 0xD3, 0x56, 0xF4,
+	0xFB, 0x64, 0xF4, 0x9B, 0x1F, 0xD0, 0xE3, 0x9B, 0xD1, 0xA3, 0x49, 0xE8, 0xE1, 0x8D, 0xE8, 0xC1,
+	0x04, 0x74, 0x7F, 0x3C, 0xBA, 0x77, 0x03, 0xBA, 0x2B, 0x16, 0xED, 0x8A, 0x41, 0xB7, 0xAF, 0x43,
+	0xB7, 0x45, 0xA1, 0x5B, 0xCC, 0xE8, 0xA5, 0xB5, 0xE8, 0xE5, 0x16, 0xF4, 0x8A, 0x06, 0x34, 0xD9,
+	0x8A, 0x5E, 0x7D, 0x0F, 0xBD, 0xD6, 0x86, 0x8E, 0x7A, 0x88, 0xA6, 0xD9, 0xD1, 0xB1, 0xCD, 0xE8,
+	0x38, 0x07, 0x3A, 0xA1, 0x0D, 0xCD, 0x70, 0xA2, 0x37, 0x3F, 0x41, 0x6F, 0x71, 0xA1, 0xB7, 0x76,
+	0xA2, 0xD9, 0x7E, 0x68, 0xF5, 0x02, 0xF4, 0xA5, 0xF9, 0xE8, 0x0B, 0x3E, 0xE8, 0xF3, 0x73, 0xD1,
+	0x8A, 0x39, 0xE8, 0x33, 0x5E, 0xE8, 0x53, 0xB3, 0xD0, 0x27, 0x67, 0xA2, 0xA5, 0x9E, 0xE8, 0x8C,
+	0xE9, 0xE8, 0xF4, 0x69, 0xE8, 0x13, 0xEE, 0x68, 0xD1, 0x14, 0xF4, 0xD1, 0xC9, 0xE8, 0x23, 0x6E,
+	0xE8, 0x43, 0xC0, 0xFF, 0x77, 0xEC, 0x4C, 0xC2, 0xCC, 0x41, 0x60, 0x30, 0x53, 0x31, 0xF3, 0x91,
+	0x18, 0x5F, 0x0F, 0xCC, 0x42, 0x14, 0x06, 0x37, 0x03, 0x13, 0x08, 0x62, 0x82, 0x66, 0x63, 0x42,
+	0xD0, 0x18, 0xA2, 0x37, 0x26, 0x0C, 0x83, 0x09, 0x9F, 0x87, 0x89, 0x80, 0x30, 0x14, 0x5F, 0x4C,
+	0x64, 0x17, 0xE6, 0xD6, 0x53, 0xCC, 0x8D, 0x0E, 0x4C, 0x55, 0x3B, 0xC6, 0xF0, 0x18, 0x53, 0xDE,
+	0x8A, 0x29, 0x6B, 0xC1, 0x94, 0x3C, 0xC2, 0x68, 0x9B, 0x30, 0x85, 0x0F, 0x30, 0x05, 0xF7, 0x31,
+	0xF9, 0x8D, 0x18, 0xD5, 0x5D, 0x4C, 0x5E, 0x3D, 0x26, 0xB7, 0x0E, 0x93, 0x73, 0x07, 0x23, 0xA7,
+	0x62, 0x7E, 0x89, 0xC6, 0x1C, 0xA6, 0x61, 0x84, 0xEB, 0x31, 0xC7, 0x60, 0xCC, 0xF1, 0x38, 0x4C,
+	0x1A, 0x1D, 0x23, 0x49, 0xC4, 0x64, 0x32, 0x30, 0x59, 0x9B, 0x30, 0xD9, 0x4C, 0x8C, 0x7C, 0x0B,
+	0x26, 0x87, 0x85, 0xC9, 0x4D, 0xC1, 0xE4, 0xB1, 0x31, 0xAA, 0x1D, 0x98, 0xFC, 0x7C, 0xCC, 0xF6,
+	0x4B, 0x98, 0x94, 0x8B, 0x98, 0xE4, 0x3C, 0x0C, 0xF3, 0x3C, 0x26, 0xE9, 0x1C, 0x26, 0x31, 0x07,
+	0x13, 0x7F, 0x06, 0x03, 0x9F, 0xC6, 0xC4, 0x64, 0x63, 0xA2, 0x4F, 0x62, 0x22, 0x7F, 0xC7, 0x50,
+	0x32, 0x31, 0x11, 0x19, 0x98, 0xF0, 0x5F, 0x31, 0x61, 0x69, 0x18, 0xA2, 0x18, 0xD3, 0x9C, 0x8E,
+	0x69, 0x95, 0x60, 0x9C, 0xBF, 0x61, 0x3A, 0xA4, 0x98, 0xCE, 0x2C, 0x4C, 0x8F, 0x0C, 0xD3, 0x77,
+	0x0A, 0x33, 0x20, 0xC7, 0x0C, 0x9D, 0xC5, 0x8C, 0x28, 0x30, 0x63, 0xB9, 0x98, 0x09, 0x25, 0xE6,
+	0xDD, 0x05, 0xCC, 0x47, 0x15, 0xE6, 0xCB, 0x65, 0xCC, 0xF7, 0x9D, 0x98, 0xAF, 0xDB, 0x31, 0x9F,
+	0xB6, 0x61, 0xDE, 0x6F, 0xC5, 0xBC, 0x49, 0xC6, 0x8C, 0xFF, 0x80, 0x19, 0xDD, 0x8C, 0x19, 0x4E,
+	0xC2, 0x0C, 0x6E, 0xC4, 0xF4, 0x27, 0x60, 0x7A, 0xE3, 0x31, 0x5D, 0x1B, 0x30, 0xAE, 0x58, 0x4C,
+	0x7B, 0x0C, 0xA6, 0x6D, 0x1D, 0xA6, 0x25, 0x0A, 0x63, 0x37, 0x63, 0x96, 0xD7, 0x62, 0x56, 0x58,
+	0x30, 0xE4, 0x06, 0xCC, 0x6A, 0x2B, 0x66, 0xED, 0x3D, 0x4C, 0x94, 0x0D, 0x43, 0x7B, 0x88, 0x89,
+	0xB5, 0x63, 0xE2, 0x9A, 0x31, 0x09, 0x0E, 0x0C, 0xA3, 0x0D, 0xB3, 0xD9, 0x89, 0xD9, 0xF2, 0x04,
+	0xB3, 0xD5, 0x85, 0x61, 0x77, 0x62, 0x76, 0xFA, 0x61, 0x2E, 0x2D, 0xC0, 0x5C, 0x98, 0x8F, 0x39,
+	0xEF, 0x83, 0x51, 0xCC, 0xC5, 0x9C, 0x99, 0x83, 0x39, 0xE5, 0x85, 0x39, 0x39, 0x0B, 0x23, 0x9D,
+	0x89, 0xC9, 0xF0, 0xC4, 0xA4, 0x4F, 0xC7, 0x9C, 0x98, 0x86, 0x11, 0xB9, 0x63, 0x8E, 0x4E, 0xC1,
+	0x1C, 0x99, 0x8C, 0x39, 0xE4, 0x86, 0x11, 0x00, 0x00, 0x34, 0x67, 0x12, 0x84, 0x41, 0x40, 0xF3,
+	0xA7, 0x42, 0xBE, 0x48, 0x68, 0xA1, 0x07, 0x84, 0x43, 0x41, 0x81, 0x33, 0xA0, 0x20, 0x10, 0x0A,
+	0x99, 0x0D, 0x11, 0xD1, 0x50, 0x98, 0x37, 0x14, 0x8E, 0x81, 0x22, 0xE6, 0x41, 0x14, 0x08, 0x8A,
+	0xF4, 0x85, 0xA2, 0xBB, 0xA0, 0x1B, 0x4F, 0xA1, 0xAA, 0x0E, 0xC8, 0xD0, 0x0E, 0x95, 0x3F, 0x86,
+	0xCA, 0x5A, 0xA1, 0x92, 0x16, 0x48, 0xFB, 0x08, 0x2A, 0x6C, 0x82, 0x0A, 0x1E, 0x40, 0xF9, 0xF7,
+	0x21, 0x55, 0x23, 0x94, 0x77, 0x17, 0xCA, 0xAD, 0x87, 0x72, 0xEA, 0x20, 0xF9, 0x1D, 0x28, 0x9B,
+	0x0A, 0x1D, 0x8E, 0x86, 0x84, 0x34, 0xE8, 0xD8, 0x7A, 0xE8, 0x38, 0x0C, 0xA5, 0xC5, 0x41, 0x12,
+	0x3A, 0x94, 0x99, 0x08, 0x65, 0x31, 0xA0, 0xEC, 0x4D, 0x90, 0x9C, 0x09, 0xE5, 0x6C, 0x81, 0x72,
+	0x59, 0x50, 0x5E, 0x0A, 0xA4, 0x62, 0x43, 0xF9, 0x3B, 0xA0, 0x82, 0x7C, 0x28, 0xE5, 0x12, 0x94,
+	0x7C, 0x11, 0x62, 0xE6, 0x41, 0x49, 0xE7, 0xA1, 0xC4, 0x73, 0x50, 0x7C, 0x0E, 0x04, 0x9F, 0x81,
+	0x62, 0x4E, 0x43, 0xD1, 0xD9, 0x50, 0xE4, 0x49, 0x88, 0xF2, 0x3B, 0x14, 0x91, 0x09, 0x85, 0x67,
+	0x40, 0x61, 0xBF, 0x42, 0xC4, 0x34, 0x28, 0x44, 0x0C, 0xB5, 0xA6, 0x43, 0x4E, 0x09, 0xD4, 0xF1,
+	0x1B, 0xD4, 0x29, 0x85, 0x7A, 0xB2, 0xA0, 0x3E, 0x19, 0x34, 0x70, 0x0A, 0x1A, 0x92, 0x43, 0x23,
+	0x67, 0xA1, 0x31, 0x05, 0x34, 0x91, 0x0B, 0xBD, 0x53, 0x42, 0x1F, 0x2F, 0x40, 0x5F, 0x54, 0xD0,
+	0xF7, 0xCB, 0xD0, 0xA4, 0x9D, 0xD0, 0xA7, 0xED, 0xD0, 0xFB, 0x6D, 0xD0, 0x9B, 0xAD, 0xD0, 0x78,
+	0x32, 0x34, 0xFA, 0x03, 0x34, 0xBC, 0x19, 0x1A, 0x4C, 0x82, 0xFA, 0x37, 0x42, 0xBD, 0x09, 0x50,
+	0x57, 0x3C, 0xE4, 0xDA, 0x00, 0xB5, 0xC7, 0x42, 0x6D, 0x31, 0x50, 0xCB, 0x3A, 0xC8, 0x1E, 0x05,
+	0x3D, 0x30, 0x43, 0x2B, 0x6A, 0x21, 0xB2, 0x05, 0x5A, 0xDD, 0x00, 0xAD, 0xB5, 0x42, 0x51, 0xF7,
+	0x20, 0x9A, 0x0D, 0x8A, 0x7D, 0x08, 0xC5, 0xD9, 0xA1, 0x84, 0x66, 0x88, 0xE1, 0x80, 0x36, 0xB7,
+	0x41, 0x5B, 0x9C, 0xD0, 0xD6, 0x27, 0x10, 0xDB, 0x05, 0xED, 0xEC, 0x84, 0x76, 0xF9, 0x41, 0x17,
+	0x16, 0x40, 0xE7, 0xE7, 0x43, 0x0A, 0x1F, 0xE8, 0xCC, 0x5C, 0xE8, 0xD4, 0x1C, 0xE8, 0xA4, 0x17,
+	0x24, 0x9D, 0x05, 0x65, 0xCC, 0x84, 0xD2, 0x3D, 0xA1, 0x13, 0xD3, 0x21, 0xD1, 0x34, 0xE8, 0xA8,
+	0x3B, 0x74, 0x64, 0x0A, 0x74, 0x68, 0x32, 0x24, 0x70, 0x83, 0x0E, 0x00, 0x00, 0x16, 0x33, 0x09,
+	0x3B, 0x1F, 0x81, 0xF5, 0x9D, 0x8A, 0x5D, 0x88, 0xC4, 0xE2, 0x3C, 0xB0, 0x81, 0x28, 0x6C, 0xD0,
+	0x0C, 0x6C, 0x08, 0x88, 0x25, 0xCE, 0xC6, 0x86, 0xA1, 0xB1, 0xE1, 0xDE, 0xD8, 0x08, 0x0C, 0x96,
+	0x32, 0x0F, 0x1B, 0x09, 0x61, 0xA3, 0x7D, 0xB1, 0x31, 0x5D, 0xD8, 0xAA, 0xA7, 0x58, 0x43, 0x07,
+	0xB6, 0xBC, 0x1D, 0x5B, 0xF6, 0x18, 0x5B, 0xD2, 0x8A, 0xD5, 0xB6, 0x60, 0x0B, 0x1F, 0x61, 0x0B,
+	0x9A, 0xB0, 0xF9, 0x0F, 0xB0, 0xAA, 0xFB, 0xD8, 0xBC, 0x46, 0x6C, 0xEE, 0x5D, 0x6C, 0x4E, 0x3D,
+	0x56, 0x5E, 0x87, 0xCD, 0xBE, 0x83, 0xCD, 0xA2, 0x62, 0x85, 0xD1, 0xD8, 0x63, 0x34, 0xEC, 0xF1,
+	0xF5, 0xD8, 0x34, 0x18, 0x2B, 0x89, 0xC3, 0x66, 0xD2, 0xB1, 0x59, 0x89, 0xD8, 0x6C, 0x06, 0x56,
+	0xBE, 0x09, 0x9B, 0xC3, 0xC4, 0xE6, 0x6E, 0xC1, 0xE6, 0xB1, 0xB0, 0xAA, 0x14, 0x6C, 0x3E, 0x1B,
+	0x5B, 0xB0, 0x03, 0x5B, 0x98, 0x8F, 0x4D, 0xBE, 0x84, 0x65, 0x5E, 0xC4, 0x26, 0xE5, 0x61, 0x13,
+	0xCF, 0x63, 0xE3, 0xCF, 0x61, 0xE1, 0x1C, 0x6C, 0xCC, 0x19, 0x6C, 0xF4, 0x69, 0x6C, 0x64, 0x36,
+	0x96, 0x72, 0x12, 0x1B, 0xF1, 0x3B, 0x36, 0x3C, 0x13, 0x1B, 0x96, 0x81, 0x25, 0xFE, 0x8A, 0x0D,
+	0x49, 0xC3, 0x06, 0x89, 0xB1, 0xCE, 0x74, 0x6C, 0x87, 0x04, 0xDB, 0xF9, 0x1B, 0xB6, 0x47, 0x8A,
+	0xED, 0xCB, 0xC2, 0x0E, 0xC8, 0xB0, 0x43, 0xA7, 0xB0, 0x23, 0x72, 0xEC, 0xD8, 0x59, 0xEC, 0x84,
+	0x02, 0xFB, 0x2E, 0x17, 0xFB, 0x51, 0x89, 0xFD, 0x72, 0x01, 0xFB, 0x5D, 0x85, 0x9D, 0x74, 0x19,
+	0x3B, 0x65, 0x27, 0xF6, 0xFD, 0x76, 0xEC, 0x9B, 0x6D, 0xD8, 0xF1, 0xAD, 0xD8, 0xD1, 0x64, 0xEC,
+	0xF0, 0x0F, 0xD8, 0xC1, 0xCD, 0xD8, 0xFE, 0x24, 0x6C, 0xEF, 0x46, 0x6C, 0x57, 0x02, 0xD6, 0x15,
+	0x8F, 0x6D, 0xDF, 0x80, 0x6D, 0x8B, 0xC5, 0xB6, 0xC4, 0x60, 0xED, 0xEB, 0xB0, 0x0F, 0xA2, 0xB0,
+	0xF7, 0xCC, 0x58, 0x72, 0x2D, 0x76, 0xB5, 0x05, 0xBB, 0xB6, 0x01, 0x1B, 0x65, 0xC5, 0xD2, 0xEE,
+	0x61, 0x63, 0x6D, 0xD8, 0xB8, 0x87, 0xD8, 0x04, 0x3B, 0x96, 0xD1, 0x8C, 0xDD, 0xEC, 0xC0, 0x6E,
+	0x69, 0xC3, 0x6E, 0x75, 0x62, 0xD9, 0x4F, 0xB0, 0x3B, 0x5D, 0xD8, 0x5D, 0x9D, 0xD8, 0x9F, 0xFC,
+	0xB0, 0xE7, 0x17, 0x60, 0x15, 0xF3, 0xB1, 0x67, 0x7C, 0xB0, 0xA7, 0xE6, 0x62, 0x4F, 0xCE, 0xC1,
+	0x4A, 0xBD, 0xB0, 0x19, 0xB3, 0xB0, 0xE9, 0x33, 0xB1, 0x27, 0x3C, 0xB1, 0xA2, 0xE9, 0xD8, 0xA3,
+	0xD3, 0xB0, 0x47, 0xDC, 0xB1, 0x87, 0xA6, 0x60, 0x05, 0x93, 0xB1, 0x07, 0xDC, 0xB0, 0xFB, 0x01,
+	0x00, 0x37, 0x7F, 0x12, 0xCE, 0x17, 0x81, 0x5B, 0x38, 0x15, 0x87, 0x43, 0xE2, 0x02, 0x3D, 0x70,
+	0x41, 0x28, 0x5C, 0xC8, 0x0C, 0x1C, 0x11, 0xC4, 0x85, 0xCD, 0xC6, 0x85, 0xA3, 0x71, 0x11, 0xDE,
+	0x38, 0x0A, 0x06, 0x17, 0x39, 0x0F, 0x17, 0x0D, 0xE1, 0x62, 0x7C, 0x71, 0x70, 0x17, 0xCE, 0xF0,
+	0x14, 0x57, 0xDE, 0x81, 0x2B, 0x6B, 0xC7, 0x95, 0x3C, 0xC6, 0x69, 0x5B, 0x71, 0x85, 0x2D, 0xB8,
+	0x82, 0x47, 0xB8, 0xFC, 0x26, 0x9C, 0xEA, 0x01, 0x2E, 0xEF, 0x3E, 0x2E, 0xB7, 0x11, 0x97, 0x73,
+	0x17, 0x27, 0xAF, 0xC7, 0x65, 0xD7, 0xE1, 0xB2, 0xEE, 0xE0, 0x32, 0xA9, 0xB8, 0x63, 0xD1, 0xB8,
+	0xE3, 0x34, 0x5C, 0xDA, 0x7A, 0x9C, 0x04, 0xC6, 0x65, 0xC6, 0xE1, 0xB2, 0xE8, 0xB8, 0xEC, 0x44,
+	0x9C, 0x9C, 0x81, 0xCB, 0xD9, 0x84, 0xCB, 0x65, 0xE2, 0xF2, 0xB6, 0xE0, 0x54, 0x2C, 0x5C, 0x7E,
+	0x0A, 0xAE, 0x80, 0x8D, 0x2B, 0xDC, 0x81, 0xD3, 0xE6, 0xE3, 0x98, 0x97, 0x70, 0x49, 0x17, 0x71,
+	0x89, 0x79, 0xB8, 0xF8, 0xF3, 0x38, 0xF8, 0x1C, 0x2E, 0x26, 0x07, 0x17, 0x7D, 0x06, 0x17, 0x79,
+	0x1A, 0x47, 0xC9, 0xC6, 0x45, 0x7C, 0x77, 0xE1, 0xFF, 0x6F, 0x76, 0x0A, 0x37, 0x26, 0xC7, 0x4D,
+	0x9C, 0xC5, 0xBD, 0x53, 0xE0, 0x3E, 0xE6, 0xE2, 0xBE, 0x28, 0x71, 0xDF, 0x2F, 0xE0, 0x26, 0xA9,
+	0x70, 0x53, 0x2E, 0xE3, 0x90, 0x3B, 0x71, 0x6F, 0xB6, 0xE3, 0xC6, 0xB7, 0xE1, 0x46, 0xB7, 0xE2,
+	0x86, 0x93, 0x71, 0x83, 0x3F, 0xE0, 0xFA, 0x37, 0xE3, 0x7A, 0x93, 0x70, 0x5D, 0x1B, 0x71, 0xAE,
+	0x04, 0x5C, 0x7B, 0x3C, 0xAE, 0x6D, 0x03, 0xAE, 0x25, 0x16, 0x67, 0x8F, 0xC1, 0x3D, 0x58, 0x87,
+	0xBB, 0x17, 0x85, 0xBB, 0x6B, 0xC6, 0xAD, 0xAE, 0xC5, 0xAD, 0xB5, 0xE0, 0xA2, 0x1A, 0x70, 0x34,
+	0x2B, 0x2E, 0xF6, 0x1E, 0x2E, 0xCE, 0x86, 0x4B, 0x78, 0x88, 0x63, 0xD8, 0x71, 0x9B, 0x9B, 0x71,
+	0x5B, 0x1C, 0xB8, 0xAD, 0x6D, 0x38, 0xB6, 0x13, 0xB7, 0xF3, 0x09, 0x6E, 0x97, 0x0B, 0xF7, 0x53,
+	0x27, 0x8E, 0xE7, 0x87, 0x53, 0x2C, 0xC0, 0x9D, 0x99, 0x8F, 0x3B, 0xE5, 0x83, 0x3B, 0x39, 0x17,
+	0x27, 0x9D, 0x83, 0xCB, 0xF0, 0xC2, 0xA5, 0xCF, 0xC2, 0x9D, 0x98, 0x89, 0x13, 0x79, 0xE2, 0x8E,
+	0x4E, 0xC7, 0x1D, 0x99, 0x86, 0x3B, 0xE4, 0x8E, 0x13, 0x4C, 0xC1, 0x1D, 0x98, 0x8C, 0xDB, 0xEF,
+	0x86, 0xDB, 0x0B, 0x00, 0x78, 0xDF, 0x49, 0xF8, 0x85, 0x08, 0x3C, 0x6E, 0x2A, 0x3E, 0x10, 0x89,
+	0x0F, 0xF2, 0xC0, 0x87, 0xA0, 0xF0, 0xC4, 0x19, 0xF8, 0x30, 0x10, 0x1F, 0x3E, 0x1B, 0x1F, 0x81,
+	0xC6, 0x53, 0xBC, 0xF1, 0x91, 0x18, 0x7C, 0xF4, 0x3C, 0x7C, 0x0C, 0x84, 0x87, 0x7D, 0xF1, 0xF1,
+	0x5D, 0xF8, 0xF2, 0xA7, 0xF8, 0xB2, 0x0E, 0x7C, 0x49, 0x3B, 0x5E, 0xFB, 0x18, 0x5F, 0xD8, 0x8A,
+	0x2F, 0x68, 0xC1, 0xE7, 0x3F, 0xC2, 0xAB, 0x9A, 0xF0, 0x79, 0x0F, 0xF0, 0xB9, 0xF7, 0xF1, 0x39,
+	0x8D, 0x78, 0xF9, 0x5D, 0x7C, 0x76, 0x3D, 0x3E, 0xAB, 0x0E, 0x9F, 0x79, 0x07, 0x2F, 0xA1, 0xE2,
+	0x8F, 0x47, 0xE3, 0xD3, 0x68, 0x78, 0xC9, 0x7A, 0x7C, 0x26, 0x8C, 0xCF, 0x8A, 0xC3, 0x67, 0xD3,
+	0xF1, 0xF2, 0x44, 0x7C, 0x0E, 0x03, 0x9F, 0xBB, 0x09, 0x9F, 0xC7, 0xC4, 0xAB, 0xB6, 0xE0, 0xF3,
+	0x59, 0xF8, 0x82, 0x14, 0x7C, 0x21, 0x1B, 0xAF, 0xDD, 0x81, 0x2F, 0xC9, 0xC7, 0x27, 0x5D, 0xC2,
+	0x27, 0x5E, 0xC4, 0xC7, 0xE7, 0xE1, 0xE1, 0xF3, 0xF8, 0x98, 0x73, 0xF8, 0xE8, 0x1C, 0x7C, 0xE4,
+	0xFF, 0xA5, 0xFB, 0xFF, 0x7F, 0x0A, 0xFC, 0x97, 0x5C, 0xFC, 0x77, 0x25, 0x7E, 0xD2, 0x05, 0xFC,
+	0x14, 0x15, 0x1E, 0x79, 0x19, 0x3F, 0x7D, 0x27, 0x7E, 0x7C, 0x3B, 0x7E, 0x74, 0x1B, 0x7E, 0x78,
+	0x2B, 0x7E, 0x30, 0x19, 0xDF, 0xFF, 0x03, 0xBE, 0x77, 0x33, 0xBE, 0x2B, 0x09, 0xEF, 0xDA, 0x88,
+	0x6F, 0x4F, 0xC0, 0xB7, 0xC5, 0xE3, 0x5B, 0x36, 0xE0, 0xED, 0xB1, 0xF8, 0x07, 0x31, 0xF8, 0x7B,
+	0xEB, 0xF0, 0x77, 0xA3, 0xF0, 0x16, 0x33, 0x7E, 0x6D, 0x2D, 0x3E, 0xCA, 0x82, 0xA7, 0x35, 0xE0,
+	0x63, 0xAD, 0xF8, 0xB8, 0x7B, 0xF8, 0x04, 0x1B, 0x9E, 0xF1, 0x10, 0xBF, 0xD9, 0x8E, 0xDF, 0xD2,
+	0x8C, 0xDF, 0xEA, 0xC0, 0xB3, 0xDB, 0xF0, 0x3B, 0x9D, 0xF8, 0x5D, 0x4F, 0xF0, 0x3F, 0xB9, 0xF0,
+	0xBC, 0x4E, 0xFC, 0xCF, 0x7E, 0xF8, 0x33, 0x0B, 0xF0, 0xA7, 0xE6, 0xE3, 0x4F, 0xFA, 0xE0, 0xA5,
+	0x73, 0xF1, 0x19, 0x73, 0xF0, 0xE9, 0x5E, 0xF8, 0x13, 0xB3, 0xF0, 0xA2, 0x99, 0xF8, 0xA3, 0x9E,
+	0xF8, 0x23, 0xD3, 0xF1, 0x87, 0xA6, 0xE1, 0x05, 0xEE, 0xF8, 0x03, 0x53, 0xF0, 0xFB, 0x27, 0xE3,
+	0xF7, 0xBA, 0xE1, 0xB9, 0x00, 0x40, 0x58, 0x38, 0x89, 0x80, 0x43, 0x10, 0x02, 0xA7, 0x12, 0x82,
+	0x90, 0x84, 0x10, 0x0F, 0x02, 0x11, 0x45, 0x08, 0x9B, 0x41, 0x08, 0x07, 0x09, 0x11, 0xB3, 0x09,
+	0x14, 0x34, 0x21, 0xD2, 0x9B, 0x10, 0x8D, 0x21, 0xC4, 0xCC, 0x23, 0xC0, 0x10, 0x21, 0xDE, 0x97,
+	0x90, 0xD8, 0x45, 0x28, 0x7B, 0x4A, 0x28, 0xE9, 0x20, 0x68, 0xDB, 0x09, 0x85, 0x8F, 0x09, 0x05,
+	0xAD, 0x84, 0xFC, 0x16, 0x82, 0xEA, 0x11, 0x21, 0xAF, 0x89, 0x90, 0xFB, 0x80, 0x90, 0x73, 0x9F,
+	0x20, 0x6F, 0x24, 0x64, 0xDF, 0x25, 0x64, 0xD5, 0x13, 0x32, 0xEB, 0x08, 0x92, 0x3B, 0x84, 0x34,
+	0x2A, 0x21, 0x2D, 0x9A, 0x20, 0xA1, 0x11, 0x32, 0xD7, 0x13, 0xB2, 0x60, 0x42, 0x76, 0x1C, 0x41,
+	0x4E, 0x27, 0xE4, 0x24, 0x12, 0x72, 0x19, 0x84, 0xBC, 0x4D, 0x04, 0x15, 0x93, 0x90, 0xBF, 0x85,
+	0x50, 0xC0, 0x22, 0x14, 0xA6, 0x10, 0xB4, 0x6C, 0x42, 0xC9, 0x0E, 0x42, 0x59, 0x3E, 0x21, 0xF1,
+	0x12, 0x21, 0xFE, 0x22, 0x01, 0xCE, 0x23, 0xC4, 0x9C, 0x27, 0x44, 0xFF, 0x3F, 0xD3, 0xFF, 0x9F,
+	0x53, 0x12, 0xA6, 0x5C, 0x20, 0x20, 0x55, 0x84, 0xE9, 0x97, 0x09, 0x33, 0x76, 0x12, 0x46, 0xB7,
+	0x13, 0x86, 0xB7, 0x11, 0x06, 0xB7, 0x12, 0xFA, 0x93, 0x09, 0xBD, 0x3F, 0x10, 0xBA, 0x36, 0x13,
+	0x5C, 0x49, 0x84, 0xF6, 0x8D, 0x84, 0xB6, 0x04, 0x42, 0x4B, 0x3C, 0xC1, 0xBE, 0x81, 0xF0, 0x20,
+	0x96, 0x70, 0x2F, 0x86, 0x70, 0x77, 0x1D, 0xC1, 0x12, 0x45, 0xB8, 0x63, 0x26, 0x44, 0xD5, 0x12,
+	0x68, 0x16, 0x42, 0x6C, 0x03, 0x21, 0xCE, 0x4A, 0x48, 0xB8, 0x47, 0x60, 0xD8, 0x08, 0x9B, 0x1F,
+	0x12, 0xB6, 0xD8, 0x09, 0x5B, 0x9B, 0x09, 0x6C, 0x07, 0x61, 0x67, 0x1B, 0x61, 0x97, 0x93, 0xF0,
+	0xD3, 0x13, 0x02, 0xCF, 0x45, 0xF8, 0xB9, 0x93, 0xF0, 0x0F, 0x3F, 0xC2, 0xA9, 0x05, 0x84, 0x93,
+	0xF3, 0x09, 0x52, 0x1F, 0x42, 0xC6, 0x5C, 0x42, 0xFA, 0x1C, 0xC2, 0x09, 0x2F, 0x82, 0x68, 0x16,
+	0xE1, 0xE8, 0x4C, 0xC2, 0x11, 0x4F, 0xC2, 0xA1, 0xE9, 0x04, 0xC1, 0x34, 0xC2, 0x01, 0x77, 0xC2,
+	0xFE, 0x29, 0x84, 0xBD, 0x93, 0x09, 0x5C, 0x37, 0xC2, 0x8F, 0x00, 0x40, 0xC4, 0x4D, 0x22, 0x06,
+	0x22, 0x88, 0x41, 0x53, 0x89, 0x21, 0x48, 0x22, 0xD1, 0x83, 0x18, 0x86, 0x22, 0x86, 0xCF, 0x20,
+	0x46, 0x80, 0x44, 0xCA, 0x6C, 0x62, 0x24, 0x9A, 0x18, 0xED, 0x4D, 0x8C, 0xC1, 0x10, 0xE1, 0x79,
+	0xC4, 0x78, 0x88, 0x98, 0xE8, 0x4B, 0x4C, 0xEA, 0x22, 0x96, 0x3C, 0x25, 0x6A, 0x3B, 0x88, 0x85,
+	0xED, 0xC4, 0x82, 0xC7, 0xC4, 0xFC, 0x56, 0xA2, 0xAA, 0x85, 0x98, 0xF7, 0x88, 0x98, 0xDB, 0x44,
+	0xCC, 0x79, 0x40, 0x94, 0xDF, 0x27, 0x66, 0x37, 0x12, 0xB3, 0xEE, 0x12, 0x33, 0xEB, 0x89, 0x92,
+	0x3A, 0x62, 0xDA, 0x1D, 0xE2, 0x71, 0x2A, 0x51, 0x12, 0x4D, 0xCC, 0xA4, 0x11, 0xB3, 0xD6, 0x13,
+	0xB3, 0x61, 0xA2, 0x3C, 0x8E, 0x98, 0x43, 0x27, 0xE6, 0x26, 0x12, 0xF3, 0x18, 0x44, 0xD5, 0x26,
+	0x62, 0x3E, 0x93, 0x58, 0xB0, 0x85, 0x58, 0xC8, 0x22, 0x6A, 0x53, 0x88, 0x25, 0x6C, 0x62, 0xD9,
+	0x0E, 0x62, 0x79, 0x3E, 0x31, 0xFE, 0x12, 0x11, 0xBE, 0x48, 0x8C, 0xF9, 0x6F, 0xA1, 0xFF, 0x3F,
+	0xA7, 0x22, 0xCE, 0xB8, 0x4C, 0x9C, 0xB5, 0x93, 0x38, 0xBC, 0x9D, 0x38, 0xB8, 0x8D, 0xD8, 0xBF,
+	0x95, 0xD8, 0x9B, 0x4C, 0xEC, 0xFA, 0x81, 0xE8, 0xDA, 0x4C, 0x6C, 0x4F, 0x22, 0xB6, 0x6D, 0x24,
+	0xB6, 0x24, 0x10, 0xED, 0xF1, 0xC4, 0x07, 0x1B, 0x88, 0xF7, 0x62, 0x89, 0x77, 0x63, 0x88, 0x96,
+	0x75, 0xC4, 0x3B, 0x51, 0xC4, 0xDB, 0x66, 0x22, 0xAD, 0x96, 0x18, 0x6B, 0x21, 0xC6, 0x35, 0x10,
+	0x13, 0xAC, 0x44, 0xC6, 0x3D, 0xE2, 0x66, 0x1B, 0x71, 0xCB, 0x43, 0xE2, 0x56, 0x3B, 0x91, 0xDD,
+	0x4C, 0xDC, 0xE9, 0x20, 0xEE, 0x6A, 0x23, 0xFE, 0xE4, 0x24, 0xF2, 0x9E, 0x10, 0x7F, 0x76, 0x11,
+	0xFF, 0xD1, 0x49, 0xFC, 0xA7, 0x1F, 0xF1, 0xE4, 0x02, 0xA2, 0x74, 0x3E, 0x31, 0xC3, 0x87, 0x98,
+	0x3E, 0x97, 0x78, 0x62, 0x0E, 0x51, 0xE4, 0x45, 0x3C, 0x3A, 0x8B, 0x78, 0x64, 0x26, 0xF1, 0x90,
+	0x27, 0x51, 0x30, 0x9D, 0x78, 0x60, 0x1A, 0x71, 0xBF, 0x3B, 0x71, 0xEF, 0x14, 0x22, 0x77, 0x32,
+	0xF1, 0x47, 0x37, 0xE2, 0x0E, 0x00, 0x20, 0x05, 0x4E, 0x22, 0x05, 0x21, 0x48, 0x21, 0x53, 0x49,
+	0x44, 0x24, 0x29, 0xCC, 0x83, 0x14, 0x8E, 0x22, 0x45, 0xCC, 0x20, 0x51, 0x40, 0x52, 0xE4, 0x6C,
+	0x52, 0x34, 0x9A, 0x14, 0xE3, 0x4D, 0x82, 0x31, 0xA4, 0xF8, 0x79, 0xA4, 0x44, 0x88, 0x94, 0xE4,
+	0x4B, 0x62, 0x76, 0x91, 0xB4, 0x4F, 0x49, 0x85, 0x1D, 0xA4, 0x82, 0x76, 0x52, 0xFE, 0x63, 0x92,
+	0xAA, 0x95, 0x94, 0xD7, 0x42, 0xCA, 0x7D, 0x44, 0xCA, 0x69, 0x22, 0xC9, 0x1F, 0x90, 0xB2, 0xEF,
+	0x93, 0xB2, 0x1A, 0x49, 0x99, 0x77, 0x49, 0x92, 0x7A, 0x52, 0x5A, 0x1D, 0xE9, 0xF8, 0x1D, 0xD2,
+	0x31, 0x2A, 0x29, 0x33, 0x9A, 0x94, 0x45, 0x23, 0x65, 0xAF, 0x27, 0xC9, 0x61, 0x52, 0x4E, 0x1C,
+	0x29, 0x97, 0x4E, 0xCA, 0x4B, 0x24, 0xA9, 0x18, 0xA4, 0xFC, 0x4D, 0xA4, 0x02, 0x26, 0xA9, 0x70,
+	0x0B, 0x49, 0xCB, 0x22, 0x95, 0xA4, 0x90, 0xCA, 0xD8, 0xA4, 0xF2, 0x1D, 0x24, 0x43, 0x3E, 0x09,
+	0xBE, 0x44, 0xFA, 0xEF, 0xD7, 0xFF, 0xD7, 0x2E, 0x93, 0xD0, 0x3B, 0x49, 0x83, 0xDB, 0x49, 0xFD,
+	0xDB, 0x48, 0xBD, 0x5B, 0x49, 0x5D, 0xC9, 0x24, 0xD7, 0x0F, 0xA4, 0xF6, 0xCD, 0xA4, 0xB6, 0x24,
+	0x52, 0xCB, 0x46, 0x92, 0x3D, 0x81, 0xF4, 0x20, 0x9E, 0x74, 0x6F, 0x03, 0xE9, 0x6E, 0x2C, 0xC9,
+	0x12, 0x43, 0xBA, 0xB3, 0x8E, 0x74, 0x3B, 0x8A, 0x74, 0xD3, 0x4C, 0x8A, 0xAD, 0x25, 0xC5, 0x59,
+	0x48, 0x09, 0x0D, 0x24, 0x86, 0x95, 0xB4, 0xF9, 0x1E, 0x69, 0x8B, 0x8D, 0xB4, 0xF5, 0x21, 0x89,
+	0x6D, 0x27, 0xED, 0x6C, 0x26, 0xED, 0x72, 0x90, 0x7E, 0x6A, 0x23, 0xF1, 0x9C, 0xA4, 0x9F, 0x9F,
+	0x90, 0xFE, 0xE1, 0x22, 0xFD, 0xB3, 0x93, 0x94, 0xEA, 0x47, 0x92, 0x2E, 0x20, 0x65, 0xCC, 0x27,
+	0xA5, 0xFB, 0x90, 0x4E, 0xCC, 0x25, 0x89, 0xE6, 0x90, 0x8E, 0x7A, 0x91, 0x8E, 0xCC, 0x22, 0x1D,
+	0x9A, 0x49, 0x12, 0x78, 0x92, 0x0E, 0x4C, 0x27, 0xED, 0x9F, 0x46, 0xDA, 0xEB, 0x4E, 0xE2, 0x4E,
+	0x21, 0xFD, 0x38, 0x99, 0xB4, 0xC3, 0x8D, 0xB4, 0x0D, 0x00, 0xC8, 0x41, 0x93, 0xC8, 0x21, 0x08,
+	0x32, 0x71, 0x2A, 0x39, 0x0C, 0x49, 0x0E, 0xF7, 0x20, 0x47, 0xA0, 0xC8, 0x94, 0x19, 0xE4, 0x48,
+	0x90, 0x1C, 0x3D, 0x9B, 0x1C, 0x83, 0x26, 0xC3, 0xDE, 0xE4, 0x78, 0x0C, 0x39, 0x71, 0x1E, 0x39,
+	0x09, 0x22, 0x33, 0x7D, 0xC9, 0xC9, 0x5D, 0xE4, 0xC2, 0xA7, 0xE4, 0x82, 0x0E, 0x72, 0x7E, 0x3B,
+	0x59, 0xF5, 0x98, 0x9C, 0xD7, 0x4A, 0xCE, 0x6D, 0x21, 0xE7, 0x3C, 0x22, 0xCB, 0x9B, 0xC8, 0xD9,
+	0x0F, 0xC8, 0x59, 0xF7, 0xC9, 0x99, 0x8D, 0x64, 0xC9, 0x5D, 0x72, 0x5A, 0x3D, 0xF9, 0x78, 0x1D,
+	0xF9, 0xD8, 0x1D, 0xB2, 0x90, 0x4A, 0xCE, 0x8A, 0x26, 0x67, 0xD3, 0xC8, 0xF2, 0xF5, 0xE4, 0x1C,
+	0x98, 0x9C, 0x1B, 0x47, 0xCE, 0xA3, 0x93, 0x55, 0x89, 0xE4, 0x7C, 0x06, 0xB9, 0x60, 0x13, 0xB9,
+	0x90, 0x49, 0xD6, 0x6E, 0x21, 0x97, 0xB0, 0xC8, 0x65, 0x29, 0xE4, 0x72, 0x36, 0xD9, 0xB0, 0x83,
+	0x5C, 0x95, 0x4F, 0xFE, 0x9F, 0xD2, 0xFF, 0xD7, 0x76, 0x92, 0xFB, 0xB7, 0x93, 0x7B, 0xB7, 0x91,
+	0xBB, 0xB6, 0x92, 0x5D, 0xC9, 0xE4, 0xF6, 0x1F, 0xC8, 0x6D, 0x9B, 0xC9, 0x2D, 0x49, 0x64, 0xFB,
+	0x46, 0xF2, 0x83, 0x04, 0xF2, 0xBD, 0x78, 0xF2, 0xDD, 0x0D, 0x64, 0x4B, 0x2C, 0xF9, 0x4E, 0x0C,
+	0xF9, 0xF6, 0x3A, 0xF2, 0xCD, 0x28, 0xB2, 0xD1, 0x4C, 0x8E, 0xAB, 0x25, 0x27, 0x58, 0xC8, 0x8C,
+	0x06, 0xF2, 0x66, 0x2B, 0x79, 0xCB, 0x3D, 0xF2, 0x56, 0x1B, 0x99, 0xFD, 0x90, 0xBC, 0xD3, 0x4E,
+	0xDE, 0xD5, 0x4C, 0xFE, 0xC9, 0x41, 0xE6, 0xB5, 0x91, 0x7F, 0x76, 0x92, 0xFF, 0xF1, 0x84, 0xFC,
+	0x4F, 0x17, 0x39, 0xB5, 0x93, 0xFC, 0x5F, 0x7E, 0xE4, 0x8C, 0x05, 0xE4, 0xF4, 0xF9, 0xE4, 0x13,
+	0x3E, 0x64, 0xD1, 0x5C, 0xF2, 0xD1, 0x39, 0xE4, 0x23, 0x5E, 0xE4, 0x43, 0xB3, 0xC8, 0x82, 0x99,
+	0xE4, 0x03, 0x9E, 0xE4, 0xFD, 0xD3, 0xC9, 0x7B, 0xA7, 0x91, 0xB9, 0xEE, 0xE4, 0x1F, 0xA7, 0x90,
+	0x77, 0x4C, 0x26, 0x6F, 0x73, 0x23, 0xB3, 0x00, 0x80, 0x12, 0x32, 0x89, 0x42, 0x44, 0x50, 0xC2,
+	0xA6, 0x52, 0xC2, 0x91, 0x94, 0x08, 0x0F, 0x0A, 0x05, 0x45, 0x89, 0x9C, 0x41, 0x89, 0x06, 0x29,
+	0x31, 0xB3, 0x29, 0x30, 0x9A, 0x12, 0xEF, 0x4D, 0x49, 0xC4, 0x50, 0x92, 0xE6, 0x51, 0x98, 0x10,
+	0x25, 0xD9, 0x97, 0x92, 0xD2, 0x45, 0x29, 0x78, 0x4A, 0xC9, 0xEF, 0xA0, 0xA8, 0xDA, 0x29, 0x79,
+	0x8F, 0x29, 0xB9, 0xAD, 0x94, 0x9C, 0x16, 0x8A, 0xFC, 0x11, 0x25, 0xBB, 0x89, 0x92, 0xF5, 0x80,
+	0x92, 0x79, 0x9F, 0x22, 0x69, 0xA4, 0xA4, 0xDD, 0xA5, 0x1C, 0xAF, 0xA7, 0x1C, 0xAB, 0xA3, 0x08,
+	0xEF, 0x50, 0x0E, 0x53, 0x29, 0xD9, 0xD1, 0x14, 0x39, 0x8D, 0x92, 0xB3, 0x9E, 0x92, 0x0B, 0x53,
+	0xF2, 0xE2, 0x28, 0x2A, 0x3A, 0x25, 0x3F, 0x91, 0x52, 0xC0, 0xA0, 0x14, 0x6E, 0xA2, 0x68, 0x99,
+	0x94, 0x92, 0x2D, 0x94, 0x32, 0x16, 0xA5, 0x3C, 0x85, 0x62, 0x60, 0x53, 0xAA, 0x76, 0x50, 0x6E,
+	0xFC, 0x8F, 0xEA, 0xFF, 0x6B, 0xDB, 0x29, 0x5D, 0xDB, 0x28, 0xAE, 0xAD, 0x94, 0xF6, 0x64, 0x4A,
+	0xDB, 0x0F, 0x94, 0x96, 0xCD, 0x14, 0x7B, 0x12, 0xE5, 0xC1, 0x46, 0xCA, 0xBD, 0x04, 0xCA, 0xDD,
+	0x78, 0x8A, 0x65, 0x03, 0xE5, 0x4E, 0x2C, 0xE5, 0x76, 0x0C, 0xE5, 0xE6, 0x3A, 0x8A, 0x31, 0x8A,
+	0x72, 0xDD, 0x4C, 0x49, 0xA8, 0xA5, 0x30, 0x2C, 0x94, 0xCD, 0x0D, 0x94, 0x2D, 0x56, 0xCA, 0xD6,
+	0x7B, 0x14, 0xB6, 0x8D, 0xB2, 0xF3, 0x21, 0x65, 0x97, 0x9D, 0xF2, 0x53, 0x33, 0x85, 0xE7, 0xA0,
+	0xFC, 0xDC, 0x46, 0xF9, 0x87, 0x93, 0xF2, 0xCF, 0x27, 0x94, 0x54, 0x17, 0xE5, 0xBF, 0x3A, 0x29,
+	0xFF, 0xCB, 0x8F, 0x92, 0xBE, 0x80, 0x72, 0x62, 0x3E, 0x45, 0xE4, 0x43, 0x39, 0x3A, 0x97, 0x72,
+	0x64, 0x0E, 0xE5, 0x90, 0x17, 0x45, 0x30, 0x8B, 0x72, 0x60, 0x26, 0x65, 0xBF, 0x27, 0x65, 0xEF,
+	0x74, 0x0A, 0x77, 0x1A, 0xE5, 0x47, 0x77, 0xCA, 0x8E, 0x29, 0x94, 0x6D, 0x93, 0x29, 0x2C, 0x37,
+	0xCA, 0x0F, 0xC0, 0x77, 0x6A, 0xD3, 0x57, 0xAA, 0xED, 0x33, 0xB5, 0xF1, 0x23, 0xB5, 0xE1, 0x3D,
+	0xB5, 0xEE, 0x2D, 0xD5, 0x3C, 0x41, 0xBD, 0x35, 0x4E, 0xBD, 0xF1, 0x8A, 0x5A, 0x35, 0x42, 0x35,
+	0x0C, 0x53, 0xCB, 0x5F, 0x50, 0xCB, 0x06, 0xA8, 0x25, 0xFD, 0x54, 0xED, 0x33, 0x6A, 0x61, 0x0F,
+	0xB5, 0x00, 0x4B, 0xE5, 0xF8, 0x53, 0x77, 0xE3, 0xA8, 0x7B, 0x16, 0x53, 0xF7, 0xE1, 0xA9, 0xFC,
+	0x20, 0xEA, 0x41, 0x02, 0xF5, 0x97, 0x50, 0xEA, 0x61, 0x22, 0x55, 0xB8, 0x9C, 0x7A, 0x8C, 0x44,
+	0x3D, 0x1E, 0x4E, 0x4D, 0x23, 0x53, 0x25, 0xAB, 0xA8, 0x99, 0x14, 0x6A, 0xD6, 0x5A, 0x6A, 0x76,
+	0x0D, 0xF5, 0xE0, 0x2D, 0x2A, 0xFF, 0x26, 0x75, 0x5F, 0x35, 0x75, 0x4F, 0x15, 0x75, 0xF7, 0x75,
+	0x2A, 0xA7, 0x82, 0xBA, 0xBD, 0x9C, 0x9A, 0x72, 0x95, 0x9A, 0x5C, 0x4A, 0x65, 0x96, 0x50, 0x93,
+	0xFE, 0xA2, 0x26, 0x16, 0x51, 0xE3, 0x0B, 0xA9, 0xF0, 0x1F, 0xD4, 0x98, 0x7F, 0x83, 0xFE, 0xBF,
+	0xA6, 0xA1, 0x2E, 0xFE, 0x93, 0xBA, 0x44, 0x4B, 0x25, 0x14, 0x53, 0x97, 0xEA, 0xA8, 0xCB, 0xCB,
+	0xA8, 0x2B, 0xF4, 0x54, 0xF2, 0x35, 0xEA, 0x6A, 0x03, 0x75, 0x6D, 0x25, 0x35, 0xCA, 0x48, 0xA5,
+	0xDD, 0xA0, 0xC6, 0x9A, 0xA8, 0x71, 0xB7, 0xA9, 0x09, 0x91, 0xD4, 0xAB, 0x6B, 0xA8, 0xBA, 0xD5,
+	0xD4, 0xBF, 0x22, 0xA8, 0x7F, 0xAE, 0xA4, 0xFE, 0xB1, 0x82, 0xAA, 0x0E, 0xA3, 0x5E, 0x5A, 0x46,
+	0xBD, 0xB0, 0x94, 0x7A, 0x3E, 0x84, 0xAA, 0x08, 0xA6, 0x9E, 0x59, 0x42, 0x3D, 0x15, 0x48, 0x3D,
+	0x19, 0x40, 0x95, 0x2E, 0xA2, 0x66, 0x2C, 0xA4, 0xA6, 0x77, 0x53, 0xC5, 0xBD, 0xD4, 0x5F, 0xFB,
+	0xA8, 0xBF, 0x3D, 0xA7, 0xFE, 0x3E, 0x48, 0x95, 0x0D, 0x51, 0x4F, 0xBF, 0xA4, 0x9E, 0x1D, 0xA5,
+	0x9E, 0x1B, 0xA3, 0x2A, 0x5F, 0x53, 0x2F, 0xBE, 0xA1, 0x5E, 0x7E, 0x47, 0xBD, 0xF2, 0x81, 0xAA,
+	0xF9, 0x44, 0x2D, 0xFA, 0x42, 0x2D, 0xFE, 0x46, 0x2D, 0x05, 0xBE, 0xD3, 0x6C, 0x5F, 0x69, 0x8D,
+	0x9F, 0x69, 0x0D, 0x1F, 0x69, 0x75, 0xEF, 0x69, 0xE6, 0xB7, 0xB4, 0x5B, 0x13, 0xB4, 0x1B, 0xE3,
+	0xB4, 0xAA, 0x57, 0x34, 0xC3, 0x08, 0xAD, 0x7C, 0x98, 0x56, 0xF6, 0x82, 0x56, 0x32, 0x40, 0xD3,
+	0xF6, 0xD3, 0x0A, 0x9F, 0xD1, 0x0A, 0x7A, 0x68, 0xF9, 0x58, 0xDA, 0x6E, 0x7F, 0xDA, 0x1E, 0x1C,
+	0x6D, 0xDF, 0x62, 0x1A, 0x1F, 0x4F, 0x3B, 0x18, 0x44, 0xFB, 0x85, 0x40, 0x3B, 0x1C, 0x4A, 0x13,
+	0x12, 0x69, 0xC7, 0x96, 0xD3, 0x8E, 0x93, 0x68, 0x69, 0xE1, 0x34, 0x09, 0x99, 0x96, 0xB9, 0x8A,
+	0x96, 0x45, 0xA1, 0x65, 0xAF, 0xA5, 0xC9, 0x6B, 0x68, 0xFC, 0x5B, 0xB4, 0x7D, 0x37, 0x69, 0x7B,
+	0xAA, 0x69, 0xBB, 0xAB, 0x68, 0x9C, 0xEB, 0xB4, 0xED, 0x15, 0xB4, 0x94, 0x72, 0x5A, 0xF2, 0x55,
+	0x1A, 0xB3, 0x94, 0x96, 0x54, 0x42, 0x4B, 0xFC, 0x8B, 0x16, 0x5F, 0x44, 0x83, 0x0B, 0x69, 0xFF,
+	0x3E, 0xFD, 0x7F, 0xED, 0x4F, 0x1A, 0x41, 0x4B, 0x5B, 0x5A, 0x4C, 0x5B, 0xAE, 0xA3, 0xAD, 0x28,
+	0xA3, 0x91, 0xF5, 0xB4, 0xD5, 0xD7, 0x68, 0x6B, 0x0D, 0xB4, 0xA8, 0x4A, 0x1A, 0xCD, 0x48, 0x8B,
+	0xBD, 0x41, 0x8B, 0x33, 0xD1, 0x12, 0x6E, 0xD3, 0x18, 0x91, 0x34, 0xDD, 0x1A, 0xDA, 0x5F, 0xAB,
+	0x69, 0x7F, 0x46, 0xD0, 0xFE, 0x58, 0x49, 0x53, 0xAF, 0xA0, 0x5D, 0x0A, 0xA3, 0x5D, 0x58, 0x46,
+	0x3B, 0xBF, 0x94, 0xA6, 0x08, 0xA1, 0x9D, 0x09, 0xA6, 0x9D, 0x5A, 0x42, 0x3B, 0x19, 0x48, 0x93,
+	0x06, 0xD0, 0x32, 0x16, 0xD1, 0xD2, 0x17, 0xD2, 0x4E, 0x74, 0xD3, 0x7E, 0xED, 0xA5, 0xFD, 0xD6,
+	0x47, 0xFB, 0xFD, 0x39, 0x4D, 0x36, 0x48, 0x3B, 0x3D, 0x44, 0x3B, 0xFB, 0x92, 0x76, 0x6E, 0x94,
+	0xA6, 0x1C, 0xA3, 0x5D, 0x7C, 0x4D, 0xBB, 0xFC, 0x86, 0x76, 0xE5, 0x1D, 0x4D, 0xF3, 0x81, 0x56,
+	0xF4, 0x89, 0x56, 0xFC, 0x85, 0x56, 0xFA, 0x8D, 0xA6, 0x07, 0xBE, 0xC3, 0x8D, 0x5F, 0xE1, 0x86,
+	0xCF, 0x70, 0xDD, 0x47, 0xD8, 0xFC, 0x1E, 0xBE, 0xF5, 0x16, 0xBE, 0x31, 0x01, 0x57, 0x8D, 0xC3,
+	0x86, 0x57, 0x70, 0xF9, 0x08, 0x5C, 0x36, 0x0C, 0x97, 0xBC, 0x80, 0xB5, 0x03, 0x70, 0x61, 0x3F,
+	0x5C, 0xF0, 0x0C, 0xCE, 0xEF, 0x81, 0x55, 0x58, 0x78, 0x8F, 0x3F, 0xBC, 0x0F, 0x07, 0xF3, 0x17,
+	0xC3, 0x07, 0xF1, 0xF0, 0x2F, 0x41, 0xF0, 0x61, 0x02, 0x2C, 0x0C, 0x85, 0x8F, 0x11, 0xE1, 0xE3,
+	0xCB, 0xE1, 0x34, 0x12, 0x2C, 0x09, 0x87, 0x33, 0xC9, 0x70, 0xD6, 0x2A, 0x38, 0x9B, 0x02, 0xCB,
+	0xD7, 0xC2, 0x39, 0x35, 0xF0, 0xBE, 0x5B, 0xF0, 0x9E, 0x9B, 0xF0, 0xEE, 0x6A, 0x98, 0x53, 0x05,
+	0x6F, 0xBF, 0x0E, 0xA7, 0x54, 0xC0, 0xC9, 0xE5, 0x30, 0xF3, 0x2A, 0x9C, 0x54, 0x0A, 0x27, 0x96,
+	0xC0, 0xF1, 0x7F, 0xC1, 0x70, 0x11, 0xFC, 0xEF, 0xD6, 0xFF, 0xD7, 0xB4, 0xF0, 0xF2, 0x62, 0x78,
+	0x85, 0x0E, 0x26, 0x97, 0xC1, 0xAB, 0xF5, 0xF0, 0xDA, 0x6B, 0x70, 0x94, 0x01, 0xA6, 0x55, 0xC2,
+	0xB1, 0x46, 0x38, 0xEE, 0x06, 0x9C, 0x60, 0x82, 0x19, 0xB7, 0xE1, 0xCD, 0x91, 0xF0, 0x5F, 0x6B,
+	0xE0, 0x3F, 0x57, 0xC3, 0x7F, 0x44, 0xC0, 0xEA, 0x95, 0xF0, 0xA5, 0x15, 0xF0, 0x85, 0x30, 0xF8,
+	0xFC, 0x32, 0x58, 0xB1, 0x14, 0x3E, 0x13, 0x02, 0x9F, 0x0A, 0x86, 0x4F, 0x2E, 0x81, 0xA5, 0x81,
+	0x70, 0x46, 0x00, 0x9C, 0xBE, 0x08, 0x3E, 0xB1, 0x10, 0x16, 0x75, 0xC3, 0xBF, 0xF5, 0xC2, 0xBF,
+	0xF7, 0xC1, 0xB2, 0xE7, 0xF0, 0xE9, 0x41, 0xF8, 0xEC, 0x10, 0x7C, 0xEE, 0x25, 0xAC, 0x1C, 0x85,
+	0x2F, 0x8E, 0xC1, 0x97, 0x5F, 0xC3, 0x57, 0xDE, 0xC0, 0x9A, 0x77, 0x70, 0xD1, 0x07, 0xB8, 0xF8,
+	0x13, 0x5C, 0xFA, 0x05, 0xD6, 0x7F, 0x83, 0x2B, 0x80, 0xEF, 0xF4, 0x86, 0xAF, 0xF4, 0xBA, 0xCF,
+	0x74, 0xF3, 0x47, 0xFA, 0xAD, 0xF7, 0xF4, 0x1B, 0x6F, 0xE9, 0x55, 0x13, 0x74, 0xC3, 0x38, 0xBD,
+	0xFC, 0x15, 0xBD, 0x6C, 0x84, 0x5E, 0x32, 0x4C, 0xD7, 0xBE, 0xA0, 0x17, 0x0E, 0xD0, 0x0B, 0xFA,
+	0xE9, 0xF9, 0xCF, 0xE8, 0xAA, 0x1E, 0x7A, 0x1E, 0x96, 0xBE, 0xCF, 0x9F, 0xCE, 0xC7, 0xD1, 0x0F,
+	0x2E, 0xA6, 0xFF, 0x82, 0xA7, 0x1F, 0x0E, 0xA2, 0x0B, 0x09, 0xF4, 0x63, 0xA1, 0xF4, 0xE3, 0x44,
+	0x7A, 0xDA, 0x72, 0xBA, 0x84, 0x44, 0xCF, 0x0C, 0xA7, 0x67, 0x91, 0xE9, 0xD9, 0xAB, 0xE8, 0x72,
+	0x0A, 0x3D, 0x67, 0x2D, 0x3D, 0xB7, 0x86, 0xBE, 0xE7, 0x16, 0x7D, 0xF7, 0x4D, 0x3A, 0xA7, 0x9A,
+	0xBE, 0xBD, 0x8A, 0x9E, 0x72, 0x9D, 0x9E, 0x5C, 0x41, 0x67, 0x96, 0xD3, 0x93, 0xAE, 0xD2, 0x13,
+	0x4B, 0xE9, 0xF1, 0x25, 0x74, 0xF8, 0x2F, 0xFA, 0x7F, 0x46, 0xFF, 0x5F, 0x2B, 0xA6, 0x93, 0x75,
+	0xF4, 0xD5, 0x65, 0xF4, 0xB5, 0x7A, 0x7A, 0xD4, 0x35, 0x3A, 0xCD, 0x40, 0x8F, 0xAD, 0xA4, 0xC7,
+	0x19, 0xE9, 0x09, 0x37, 0xE8, 0x0C, 0x13, 0x7D, 0xF3, 0x6D, 0xFA, 0x96, 0x48, 0xFA, 0x9F, 0x6B,
+	0xE8, 0x7F, 0xAC, 0xA6, 0xAB, 0x23, 0xE8, 0x97, 0x56, 0xD2, 0x2F, 0xAC, 0xA0, 0x9F, 0x0F, 0xA3,
+	0x2B, 0x96, 0xD1, 0xCF, 0x2C, 0xA5, 0x9F, 0x0A, 0xA1, 0x9F, 0x0C, 0xA6, 0x4B, 0x97, 0xD0, 0x33,
+	0x02, 0xE9, 0xE9, 0x01, 0xF4, 0x13, 0x8B, 0xE8, 0xA2, 0x85, 0xF4, 0xA3, 0xDD, 0xF4, 0xDF, 0x7B,
+	0xE9, 0xB2, 0x3E, 0xFA, 0xE9, 0xE7, 0xF4, 0xB3, 0x83, 0xF4, 0x73, 0x43, 0x74, 0xE5, 0x4B, 0xFA,
+	0xC5, 0x51, 0xFA, 0xE5, 0x31, 0xFA, 0x95, 0xD7, 0x74, 0xCD, 0x1B, 0x7A, 0xD1, 0x3B, 0x7A, 0xF1,
+	0x07, 0x7A, 0xE9, 0x27, 0xBA, 0xFE, 0x0B, 0xBD, 0xE2, 0x1B, 0xBD, 0x12, 0xF8, 0xCE, 0xA8, 0xFB,
+	0xCA, 0x30, 0x7F, 0x66, 0xDC, 0xFA, 0xC8, 0xB8, 0xF1, 0x9E, 0x51, 0xF5, 0x96, 0x61, 0x98, 0x60,
+	0x94, 0x8F, 0x33, 0xCA, 0x5E, 0x31, 0x4A, 0x46, 0x18, 0xDA, 0x61, 0x46, 0xE1, 0x0B, 0x46, 0xC1,
+	0x00, 0x23, 0xBF, 0x9F, 0xA1, 0x7A, 0xC6, 0xC8, 0xEB, 0x61, 0xE4, 0x62, 0x19, 0x7C, 0x7F, 0xC6,
+	0x41, 0x1C, 0xE3, 0x97, 0xC5, 0x8C, 0xC3, 0x78, 0x86, 0x30, 0x88, 0x71, 0x8C, 0xC0, 0x38, 0x1E,
+	0xCA, 0x48, 0x23, 0x32, 0x24, 0xCB, 0x19, 0x99, 0x24, 0x46, 0x56, 0x38, 0x23, 0x9B, 0xCC, 0x90,
+	0xAF, 0x62, 0xE4, 0x50, 0x18, 0xB9, 0x6B, 0x19, 0x79, 0x35, 0x8C, 0xDD, 0xB7, 0x18, 0x9C, 0x9B,
+	0x8C, 0xED, 0xD5, 0x8C, 0x94, 0x2A, 0x46, 0xF2, 0x75, 0x06, 0xB3, 0x82, 0x91, 0x54, 0xCE, 0x48,
+	0xBC, 0xCA, 0x88, 0x2F, 0x65, 0xC0, 0x25, 0x8C, 0x98, 0xBF, 0x18, 0xD1, 0xFF, 0xC9, 0x00, 0x8C,
+	0xD5, 0x3A, 0xC6, 0xDA, 0x32, 0x46, 0x94, 0x9E, 0x41, 0xBB, 0xC6, 0x88, 0x35, 0x30, 0xE2, 0x2A,
+	0x19, 0x09, 0x46, 0x06, 0xE3, 0x06, 0x63, 0xB3, 0x89, 0xB1, 0xE5, 0x36, 0x63, 0x6B, 0x24, 0xE3,
+	0x8F, 0x35, 0x0C, 0xF5, 0x6A, 0xC6, 0xA5, 0x08, 0xC6, 0x85, 0x95, 0x8C, 0xF3, 0x2B, 0x18, 0x8A,
+	0x30, 0xC6, 0x99, 0x65, 0x8C, 0x53, 0x4B, 0x19, 0x27, 0x43, 0x18, 0xD2, 0x60, 0x46, 0xC6, 0x12,
+	0x46, 0x7A, 0x20, 0xE3, 0x44, 0x00, 0x43, 0xB4, 0x88, 0x71, 0x74, 0x21, 0xE3, 0x48, 0x37, 0x43,
+	0xD6, 0xCB, 0x38, 0xDD, 0xC7, 0x38, 0xFB, 0x9C, 0x71, 0x6E, 0x90, 0xA1, 0x1C, 0x62, 0x5C, 0x7C,
+	0xC9, 0xB8, 0x3C, 0xCA, 0xB8, 0x32, 0xC6, 0xD0, 0xBC, 0x66, 0x14, 0xBD, 0x61, 0x14, 0xBF, 0x63,
+	0x94, 0x7E, 0x60, 0xE8, 0x3F, 0x31, 0x2A, 0xBE, 0x30, 0x2A, 0xBF, 0x31, 0xAA, 0x81, 0xEF, 0x4C,
+	0xF3, 0x57, 0xE6, 0xAD, 0xCF, 0xCC, 0x1B, 0x1F, 0x99, 0x55, 0xEF, 0x99, 0x86, 0xB7, 0xCC, 0xF2,
+	0x09, 0x66, 0xD9, 0x38, 0xB3, 0xE4, 0x15, 0x53, 0x3B, 0xC2, 0x2C, 0x1C, 0x66, 0x16, 0xBC, 0x60,
+	0xE6, 0x0F, 0x30, 0x55, 0xFD, 0xCC, 0xBC, 0x67, 0xCC, 0xDC, 0x1E, 0x66, 0x0E, 0x96, 0x79, 0xD0,
+	0x9F, 0xF9, 0x0B, 0x8E, 0x79, 0x78, 0x31, 0x53, 0x88, 0x67, 0x1E, 0x0B, 0x62, 0x1E, 0x27, 0x30,
+	0xD3, 0x42, 0x99, 0x12, 0x22, 0x33, 0x73, 0x39, 0x33, 0x8B, 0xC4, 0xCC, 0x0E, 0x67, 0xCA, 0xC9,
+	0xCC, 0x9C, 0x55, 0xCC, 0x5C, 0x0A, 0x33, 0x6F, 0x2D, 0x53, 0x55, 0xC3, 0xE4, 0xDC, 0x62, 0x6E,
+	0xBF, 0xC9, 0x4C, 0xA9, 0x66, 0x26, 0x57, 0x31, 0x99, 0xD7, 0x99, 0x49, 0x15, 0xCC, 0xC4, 0x72,
+	0x66, 0xFC, 0x55, 0x26, 0x5C, 0xCA, 0x8C, 0x29, 0x61, 0xFE, 0x27, 0xF5, 0xFF, 0x35, 0x1D, 0x33,
+	0xAA, 0x8C, 0x49, 0xD3, 0x33, 0x63, 0xAF, 0x31, 0xE3, 0x0C, 0xCC, 0x84, 0x4A, 0x26, 0xC3, 0xC8,
+	0xDC, 0x7C, 0x83, 0xB9, 0xC5, 0xC4, 0xDC, 0x7A, 0x9B, 0xC9, 0x8E, 0x64, 0xAA, 0xD7, 0x30, 0x2F,
+	0xAD, 0x66, 0x5E, 0x88, 0x60, 0x9E, 0x5F, 0xC9, 0x54, 0xAC, 0x60, 0x9E, 0x09, 0x63, 0x9E, 0x5A,
+	0xC6, 0x3C, 0xB9, 0x94, 0x29, 0x0D, 0x61, 0x66, 0x04, 0x33, 0xD3, 0x97, 0x30, 0x4F, 0x04, 0x32,
+	0x45, 0x01, 0xCC, 0xA3, 0x8B, 0x98, 0x47, 0x16, 0x32, 0x0F, 0x75, 0x33, 0x4F, 0xF7, 0x32, 0xCF,
+	0xF6, 0x31, 0xCF, 0x3D, 0x67, 0x2A, 0x07, 0x99, 0x17, 0x87, 0x98, 0x97, 0x5F, 0x32, 0xAF, 0x8C,
+	0x32, 0x35, 0x63, 0xCC, 0xA2, 0xD7, 0xCC, 0xE2, 0x37, 0xCC, 0xD2, 0x77, 0x4C, 0xFD, 0x07, 0x66,
+	0xC5, 0x27, 0x66, 0xE5, 0x17, 0x66, 0xF5, 0x37, 0xA6, 0x09, 0xF8, 0xCE, 0xBA, 0xF5, 0x95, 0x75,
+	0xE3, 0x33, 0xAB, 0xEA, 0x23, 0xCB, 0xF0, 0x9E, 0x55, 0xFE, 0x96, 0x55, 0x36, 0xC1, 0x2A, 0x19,
+	0x67, 0x69, 0x5F, 0xB1, 0x0A, 0x47, 0x58, 0x05, 0xC3, 0xAC, 0xFC, 0x17, 0x2C, 0xD5, 0x00, 0x2B,
+	0xAF, 0x9F, 0x95, 0xFB, 0x8C, 0x95, 0xD3, 0xC3, 0x92, 0x63, 0x59, 0xBF, 0xF8, 0xB3, 0x0E, 0xE3,
+	0x58, 0xC2, 0xC5, 0xAC, 0x63, 0x78, 0xD6, 0xF1, 0x20, 0x56, 0x1A, 0x81, 0x25, 0x09, 0x65, 0x65,
+	0x12, 0x59, 0x59, 0xCB, 0x59, 0xD9, 0x24, 0x96, 0x3C, 0x9C, 0x95, 0x43, 0x66, 0xE5, 0xAE, 0x62,
+	0xE5, 0x51, 0x58, 0xAA, 0xB5, 0xAC, 0xFC, 0x1A, 0xD6, 0xF6, 0x5B, 0xAC, 0x94, 0x9B, 0xAC, 0xE4,
+	0x6A, 0x16, 0xB3, 0x8A, 0x95, 0x74, 0x9D, 0x95, 0x58, 0xC1, 0x8A, 0x2F, 0x67, 0xC1, 0x57, 0x59,
+	0x31, 0xA5, 0xAC, 0xE8, 0x12, 0x56, 0xE4, 0x7F, 0x3E, 0x00, 0x8B, 0x56, 0xC6, 0x8A, 0xD5, 0xB3,
+	0xE2, 0xAE, 0xB1, 0x12, 0x0C, 0x2C, 0x46, 0x25, 0x6B, 0xB3, 0x91, 0xB5, 0xE5, 0x06, 0x6B, 0xAB,
+	0x89, 0xC5, 0xBE, 0xCD, 0xDA, 0x19, 0xC9, 0xBA, 0xB4, 0x86, 0x75, 0x61, 0x35, 0xEB, 0x7C, 0x04,
+	0x4B, 0xB1, 0x92, 0x75, 0x66, 0x05, 0xEB, 0x54, 0x18, 0xEB, 0xE4, 0x32, 0x96, 0x74, 0x29, 0x2B,
+	0x23, 0x84, 0x95, 0x1E, 0xCC, 0x3A, 0xB1, 0x84, 0x25, 0x0A, 0x64, 0x1D, 0x0D, 0x60, 0x1D, 0x59,
+	0xC4, 0x3A, 0xB4, 0x90, 0x25, 0xE8, 0x66, 0x9D, 0xED, 0x65, 0x9D, 0xEB, 0x63, 0x29, 0x9F, 0xB3,
+	0x2E, 0x0E, 0xB2, 0x2E, 0x0F, 0xB1, 0xAE, 0xBC, 0x64, 0x69, 0x46, 0x59, 0x45, 0x63, 0xAC, 0xE2,
+	0xD7, 0xAC, 0xD2, 0x37, 0x2C, 0xFD, 0x3B, 0x56, 0xC5, 0x07, 0x56, 0xE5, 0x27, 0x56, 0xF5, 0x17,
+	0x96, 0xE9, 0x1B, 0xAB, 0x06, 0xF8, 0xCE, 0xBE, 0xF1, 0x95, 0x5D, 0xF5, 0x99, 0x6D, 0xF8, 0xC8,
+	0x2E, 0x7F, 0xCF, 0x2E, 0x7B, 0xCB, 0x2E, 0x99, 0x60, 0x6B, 0xC7, 0xD9, 0x85, 0xAF, 0xD8, 0x05,
+	0x23, 0xEC, 0xFC, 0x61, 0xB6, 0xEA, 0x05, 0x3B, 0x6F, 0x80, 0x9D, 0xDB, 0xCF, 0xCE, 0x79, 0xC6,
+	0x96, 0xF7, 0xB0, 0xB3, 0xB1, 0xEC, 0xC3, 0xFE, 0x6C, 0x21, 0x8E, 0x7D, 0x6C, 0x31, 0xFB, 0x38,
+	0x9E, 0x9D, 0x16, 0xC4, 0x96, 0x10, 0xD8, 0x99, 0xA1, 0xEC, 0x2C, 0x22, 0x3B, 0x7B, 0x39, 0x5B,
+	0x4E, 0x62, 0xE7, 0x84, 0xB3, 0x73, 0xC9, 0xEC, 0xBC, 0x55, 0x6C, 0x15, 0x85, 0x9D, 0xBF, 0x96,
+	0x5D, 0x50, 0xC3, 0x4E, 0xB9, 0xC5, 0x4E, 0xBE, 0xC9, 0x66, 0x56, 0xB3, 0x93, 0xAA, 0xD8, 0x89,
+	0xD7, 0xD9, 0xF1, 0x15, 0x6C, 0xB8, 0x9C, 0x1D, 0x73, 0x95, 0x1D, 0x5D, 0xCA, 0xFE, 0xCF, 0xEB,
+	0xFF, 0x6B, 0x65, 0xEC, 0x38, 0x3D, 0x3B, 0xE1, 0x1A, 0x9B, 0x61, 0x60, 0x6F, 0xAE, 0x64, 0x6F,
+	0x31, 0xB2, 0xB7, 0xDE, 0x60, 0xB3, 0x4D, 0xEC, 0x9D, 0xB7, 0xD9, 0xBB, 0x22, 0xD9, 0x17, 0xD6,
+	0xB0, 0xCF, 0xAF, 0x66, 0x2B, 0x22, 0xD8, 0x67, 0x56, 0xB2, 0x4F, 0xAD, 0x60, 0x9F, 0x0C, 0x63,
+	0x4B, 0x97, 0xB1, 0x33, 0x96, 0xB2, 0xD3, 0x43, 0xD8, 0x27, 0x82, 0xD9, 0xA2, 0x25, 0xEC, 0xA3,
+	0x81, 0xEC, 0x23, 0x01, 0xEC, 0x43, 0x8B, 0xD8, 0x82, 0x85, 0xEC, 0x03, 0xDD, 0xEC, 0x73, 0xBD,
+	0x6C, 0x65, 0x1F, 0xFB, 0xE2, 0x73, 0xF6, 0xE5, 0x41, 0xF6, 0x95, 0x21, 0xB6, 0xE6, 0x25, 0xBB,
+	0x68, 0x94, 0x5D, 0x3C, 0xC6, 0x2E, 0x7D, 0xCD, 0xD6, 0xBF, 0x61, 0x57, 0xBC, 0x63, 0x57, 0x7E,
+	0x60, 0x57, 0x7F, 0x62, 0x9B, 0xBE, 0xB0, 0x6B, 0xBE, 0xB1, 0x6B, 0x81, 0xEF, 0x9C, 0xAA, 0xAF,
+	0x1C, 0xC3, 0x67, 0x4E, 0xF9, 0x47, 0x4E, 0xD9, 0x7B, 0x4E, 0xC9, 0x5B, 0x8E, 0x76, 0x82, 0x53,
+	0x38, 0xCE, 0x29, 0x78, 0xC5, 0xC9, 0x1F, 0xE1, 0xA8, 0x86, 0x39, 0x79, 0x2F, 0x38, 0xB9, 0x03,
+	0x9C, 0x9C, 0x7E, 0x8E, 0xFC, 0x19, 0x27, 0xBB, 0x87, 0x93, 0x85, 0xE5, 0x08, 0xFD, 0x39, 0xC7,
+	0x70, 0x9C, 0xE3, 0x8B, 0x39, 0x69, 0x78, 0x8E, 0x24, 0x88, 0x93, 0x49, 0xE0, 0x64, 0x85, 0x72,
+	0xB2, 0x89, 0x1C, 0xF9, 0x72, 0x4E, 0x0E, 0x89, 0x93, 0x1B, 0xCE, 0xC9, 0x23, 0x73, 0x54, 0xAB,
+	0x38, 0xF9, 0x14, 0x4E, 0xC1, 0x5A, 0x4E, 0x61, 0x0D, 0x27, 0xF9, 0x16, 0x87, 0x79, 0x93, 0x93,
+	0x54, 0xCD, 0x49, 0xAC, 0xE2, 0xC4, 0x5F, 0xE7, 0xC0, 0x15, 0x9C, 0x98, 0x72, 0x4E, 0xF4, 0x55,
+	0x4E, 0x64, 0x29, 0x87, 0xF2, 0x77, 0x09, 0xC0, 0x49, 0xD0, 0x73, 0x18, 0xD7, 0x38, 0x9B, 0x0D,
+	0x9C, 0x2D, 0x95, 0x9C, 0xAD, 0x46, 0x0E, 0xFB, 0x06, 0x67, 0xA7, 0x89, 0xB3, 0xEB, 0x36, 0xE7,
+	0xA7, 0x48, 0xCE, 0xF9, 0x35, 0x1C, 0xC5, 0x6A, 0xCE, 0x99, 0x08, 0xCE, 0xA9, 0x95, 0x9C, 0x93,
+	0x2B, 0x38, 0xD2, 0x30, 0x4E, 0xC6, 0x32, 0x4E, 0xFA, 0x52, 0xCE, 0x89, 0x10, 0x8E, 0x28, 0x98,
+	0x73, 0x74, 0x09, 0xE7, 0x48, 0x20, 0xE7, 0x50, 0x00, 0x47, 0xB0, 0x88, 0x73, 0x60, 0x21, 0x67,
+	0x7F, 0x37, 0x47, 0xD9, 0xCB, 0xB9, 0xD8, 0xC7, 0xB9, 0xFC, 0x9C, 0x73, 0x65, 0x90, 0xA3, 0x19,
+	0xE2, 0x14, 0xBD, 0xE4, 0x14, 0x8F, 0x72, 0x4A, 0xC7, 0x38, 0xFA, 0xD7, 0x9C, 0x8A, 0x37, 0x9C,
+	0xCA, 0x77, 0x9C, 0xEA, 0x0F, 0x1C, 0xD3, 0x27, 0x4E, 0xCD, 0x17, 0x4E, 0xED, 0x37, 0x4E, 0x3D,
+	0xF0, 0x9D, 0x6B, 0xF8, 0xCA, 0x2D, 0xFF, 0xCC, 0x2D, 0xFB, 0xC8, 0x2D, 0x79, 0xCF, 0xD5, 0xBE,
+	0xE5, 0x16, 0x4E, 0x70, 0x0B, 0xC6, 0xB9, 0xF9, 0xAF, 0xB8, 0xAA, 0x11, 0x6E, 0xDE, 0x30, 0x37,
+	0xF7, 0x05, 0x37, 0x67, 0x80, 0x2B, 0xEF, 0xE7, 0x66, 0x3F, 0xE3, 0x66, 0xF5, 0x70, 0x33, 0xB1,
+	0xDC, 0x63, 0xFE, 0xDC, 0xE3, 0x38, 0x6E, 0xDA, 0x62, 0xAE, 0x04, 0xCF, 0xCD, 0x0C, 0xE2, 0x66,
+	0x11, 0xB8, 0xD9, 0xA1, 0x5C, 0x39, 0x91, 0x9B, 0xB3, 0x9C, 0x9B, 0x4B, 0xE2, 0xE6, 0x85, 0x73,
+	0x55, 0x64, 0x6E, 0xFE, 0x2A, 0x6E, 0x01, 0x85, 0x5B, 0xB8, 0x96, 0xAB, 0xAD, 0xE1, 0x32, 0x6F,
+	0x71, 0x93, 0x6E, 0x72, 0x13, 0xAB, 0xB9, 0xF1, 0x55, 0x5C, 0xF8, 0x3A, 0x37, 0xA6, 0x82, 0x1B,
+	0x5D, 0xCE, 0x8D, 0xBC, 0xCA, 0xA5, 0x94, 0x72, 0x23, 0xFE, 0x2E, 0x01, 0xB8, 0x0C, 0x3D, 0x77,
+	0xF3, 0x35, 0xEE, 0x16, 0x03, 0x77, 0x6B, 0x25, 0x97, 0x6D, 0xE4, 0xEE, 0xBC, 0xC1, 0xDD, 0x65,
+	0xE2, 0xFE, 0x74, 0x9B, 0xCB, 0x8B, 0xE4, 0x2A, 0xD6, 0x70, 0xCF, 0xAC, 0xE6, 0x9E, 0x8A, 0xE0,
+	0x9E, 0x5C, 0xC9, 0x95, 0xAE, 0xE0, 0x66, 0x84, 0x71, 0xD3, 0x97, 0x71, 0x4F, 0x2C, 0xE5, 0x8A,
+	0x42, 0xB8, 0x47, 0x83, 0xB9, 0x47, 0x96, 0x70, 0x0F, 0x05, 0x72, 0x05, 0x01, 0xDC, 0x03, 0x8B,
+	0xB8, 0xFB, 0x17, 0x72, 0xF7, 0x76, 0x73, 0x2F, 0xF6, 0x72, 0x2F, 0xF7, 0x71, 0xAF, 0x3C, 0xE7,
+	0x6A, 0x06, 0xB9, 0x45, 0x43, 0xDC, 0xE2, 0x97, 0xDC, 0xD2, 0x51, 0xAE, 0x7E, 0x8C, 0x5B, 0xF1,
+	0x9A, 0x5B, 0xF9, 0x86, 0x5B, 0xFD, 0x8E, 0x6B, 0xFA, 0xC0, 0xAD, 0xF9, 0xC4, 0xAD, 0xFD, 0xC2,
+	0xAD, 0xFF, 0xC6, 0xB5, 0x02, 0xDF, 0x79, 0xE5, 0x5F, 0x79, 0x65, 0x9F, 0x79, 0x25, 0x1F, 0x79,
+	0xDA, 0xF7, 0xBC, 0xC2, 0xB7, 0xBC, 0x82, 0x09, 0x5E, 0xFE, 0x38, 0x4F, 0xF5, 0x8A, 0x97, 0x37,
+	0xC2, 0xCB, 0x1D, 0xE6, 0xE5, 0xBC, 0xE0, 0xC9, 0x07, 0x78, 0xD9, 0xFD, 0xBC, 0xAC, 0x67, 0xBC,
+	0xCC, 0x1E, 0x9E, 0x04, 0xCB, 0x3B, 0xEE, 0xCF, 0x4B, 0xC3, 0xF1, 0x24, 0x8B, 0x79, 0x99, 0x78,
+	0x5E, 0x56, 0x10, 0x2F, 0x9B, 0xC0, 0x93, 0x87, 0xF2, 0x72, 0x88, 0xBC, 0xDC, 0xE5, 0xBC, 0x3C,
+	0x12, 0x4F, 0x15, 0xCE, 0xCB, 0x27, 0xF3, 0x0A, 0x56, 0xF1, 0x0A, 0x29, 0x3C, 0xED, 0x5A, 0x5E,
+	0x49, 0x0D, 0x2F, 0xE9, 0x16, 0x2F, 0xF1, 0x26, 0x2F, 0xBE, 0x9A, 0x07, 0x57, 0xF1, 0x62, 0xAE,
+	0xF3, 0xA2, 0x2B, 0x78, 0x91, 0xE5, 0x3C, 0xCA, 0x55, 0xDE, 0xDF, 0x45, 0xFF, 0x5F, 0xD3, 0xF3,
+	0xB6, 0x5C, 0xE3, 0x6D, 0x35, 0xF0, 0xD8, 0x95, 0xBC, 0x9D, 0x46, 0xDE, 0xAE, 0x1B, 0xBC, 0x9F,
+	0x4C, 0x3C, 0xDE, 0x6D, 0xDE, 0xCF, 0x91, 0xBC, 0x33, 0x6B, 0x78, 0xA7, 0x56, 0xF3, 0x4E, 0x46,
+	0xF0, 0xA4, 0x2B, 0x79, 0x19, 0x2B, 0x78, 0xE9, 0x61, 0xBC, 0x13, 0xCB, 0x78, 0xA2, 0xA5, 0xBC,
+	0xA3, 0x21, 0xBC, 0x23, 0xC1, 0xBC, 0x43, 0x4B, 0x78, 0x82, 0x40, 0xDE, 0x81, 0x00, 0xDE, 0xFE,
+	0x45, 0xBC, 0xBD, 0x0B, 0x79, 0xDC, 0x6E, 0xDE, 0xE5, 0x5E, 0xDE, 0x95, 0x3E, 0x9E, 0xE6, 0x39,
+	0xAF, 0x68, 0x90, 0x57, 0x3C, 0xC4, 0x2B, 0x7D, 0xC9, 0xD3, 0x8F, 0xF2, 0x2A, 0xC6, 0x78, 0x95,
+	0xAF, 0x79, 0xD5, 0x6F, 0x78, 0xA6, 0x77, 0xBC, 0x9A, 0x0F, 0xBC, 0xDA, 0x4F, 0xBC, 0xFA, 0x2F,
+	0x3C, 0xEB, 0x37, 0xDE, 0x7D, 0xE0, 0x3B, 0xBF, 0xEC, 0x2B, 0xBF, 0xE4, 0x33, 0x5F, 0xFB, 0x91,
+	0x5F, 0xF8, 0x9E, 0x5F, 0xF0, 0x96, 0x9F, 0x3F, 0xC1, 0x57, 0x8D, 0xF3, 0xF3, 0x5E, 0xF1, 0x73,
+	0x47, 0xF8, 0x39, 0xC3, 0x7C, 0xF9, 0x0B, 0x7E, 0xF6, 0x00, 0x3F, 0xAB, 0x9F, 0x9F, 0xF9, 0x8C,
+	0x2F, 0xE9, 0xE1, 0xA7, 0x61, 0xF9, 0x69, 0xFE, 0x7C, 0x09, 0x8E, 0x9F, 0xB9, 0x98, 0x9F, 0x85,
+	0xE7, 0x67, 0x07, 0xF1, 0xE5, 0x04, 0x7E, 0x4E, 0x28, 0x3F, 0x97, 0xC8, 0xCF, 0x5B, 0xCE, 0x57,
+	0x91, 0xF8, 0xF9, 0xE1, 0xFC, 0x02, 0x32, 0xBF, 0x70, 0x15, 0x5F, 0x4B, 0xE1, 0x97, 0xAC, 0xE5,
+	0x97, 0xD5, 0xF0, 0x13, 0x6F, 0xF1, 0xE3, 0x6F, 0xF2, 0xE1, 0x6A, 0x7E, 0x4C, 0x15, 0x3F, 0xFA,
+	0x3A, 0x3F, 0xB2, 0x82, 0x4F, 0x29, 0xE7, 0x47, 0x5C, 0xE5, 0x87, 0xFF, 0xBD, 0x02, 0xF0, 0xB7,
+	0x5E, 0xE3, 0xB3, 0x0D, 0xFC, 0x9D, 0x95, 0xFC, 0x5D, 0x46, 0xFE, 0x4F, 0x37, 0xF8, 0x3C, 0x13,
+	0xFF, 0xE7, 0xDB, 0xFC, 0x7F, 0x44, 0xF2, 0x4F, 0xAD, 0xE1, 0x9F, 0x5C, 0xCD, 0x97, 0x46, 0xF0,
+	0x33, 0x56, 0xF2, 0xD3, 0x57, 0xF0, 0x4F, 0x84, 0xF1, 0x45, 0xCB, 0xF8, 0x47, 0x97, 0xF2, 0x8F,
+	0x84, 0xF0, 0x0F, 0x05, 0xF3, 0x05, 0x4B, 0xF8, 0x07, 0x02, 0xF9, 0xFB, 0x03, 0xF8, 0x7B, 0x17,
+	0xF1, 0xB9, 0x0B, 0xF9, 0x3F, 0x76, 0xF3, 0xAF, 0xF4, 0xF2, 0x35, 0x7D, 0xFC, 0xA2, 0xE7, 0xFC,
+	0xE2, 0x41, 0x7E, 0xE9, 0x10, 0x5F, 0xFF, 0x92, 0x5F, 0x31, 0xCA, 0xAF, 0x1C, 0xE3, 0x57, 0xBF,
+	0xE6, 0x9B, 0xDE, 0xF0, 0x6B, 0xDE, 0xF1, 0x6B, 0x3F, 0xF0, 0xEB, 0x3F, 0xF1, 0xAD, 0x5F, 0xF8,
+	0xF7, 0xBF, 0xF1, 0x1F, 0x02, 0xDF, 0x05, 0x25, 0x5F, 0x05, 0xDA, 0xCF, 0x82, 0xC2, 0x8F, 0x82,
+	0x82, 0xF7, 0x82, 0xFC, 0xB7, 0x02, 0xD5, 0x84, 0x20, 0x6F, 0x5C, 0x90, 0xFB, 0x4A, 0x90, 0x33,
+	0x22, 0x90, 0x0F, 0x0B, 0xB2, 0x5F, 0x08, 0xB2, 0x06, 0x04, 0x99, 0xFD, 0x02, 0xC9, 0x33, 0x41,
+	0x5A, 0x8F, 0xE0, 0x38, 0x56, 0x20, 0xF1, 0x17, 0x64, 0xE2, 0x04, 0x59, 0x8B, 0x05, 0xD9, 0x78,
+	0x81, 0x3C, 0x48, 0x90, 0x43, 0x10, 0xE4, 0x86, 0x0A, 0xF2, 0x88, 0x02, 0xD5, 0x72, 0x41, 0x3E,
+	0x49, 0x50, 0x10, 0x2E, 0x28, 0x24, 0x0B, 0xB4, 0xAB, 0x04, 0x25, 0x14, 0x41, 0xD9, 0x5A, 0x41,
+	0x79, 0x8D, 0x20, 0xFE, 0x96, 0x00, 0xBE, 0x29, 0x88, 0xA9, 0x16, 0x44, 0x57, 0x09, 0x22, 0xAF,
+	0x0B, 0x28, 0x15, 0x82, 0x88, 0x72, 0x41, 0xF8, 0x55, 0x41, 0xD8, 0xDF, 0x2B, 0x80, 0x80, 0x7D,
+	0x4D, 0xB0, 0xD3, 0x20, 0xD8, 0x55, 0x29, 0xF8, 0xC9, 0x28, 0xE0, 0xDD, 0x10, 0xFC, 0x6C, 0x12,
+	0xFC, 0xE3, 0xB6, 0xE0, 0x9F, 0x91, 0x82, 0x93, 0x6B, 0x04, 0xD2, 0xD5, 0x82, 0x8C, 0x08, 0x41,
+	0xFA, 0x4A, 0xC1, 0x89, 0x15, 0x02, 0x51, 0x98, 0xE0, 0xE8, 0x32, 0xC1, 0x91, 0xA5, 0x82, 0x43,
+	0x21, 0x02, 0x41, 0xB0, 0xE0, 0xC0, 0x12, 0xC1, 0xFE, 0x40, 0xC1, 0xDE, 0x00, 0x01, 0x77, 0x91,
+	0xE0, 0xC7, 0x85, 0x82, 0x1D, 0xDD, 0x02, 0x4D, 0xAF, 0xA0, 0xA8, 0x4F, 0x50, 0xFC, 0x5C, 0x50,
+	0x3A, 0x28, 0xD0, 0x0F, 0x09, 0x2A, 0x5E, 0x0A, 0x2A, 0x47, 0x05, 0xD5, 0x63, 0x02, 0xD3, 0x6B,
+	0x41, 0xCD, 0x1B, 0x41, 0xED, 0x3B, 0x41, 0xFD, 0x07, 0x81, 0xF5, 0x93, 0xE0, 0xFE, 0x17, 0xC1,
+	0xC3, 0x6F, 0x82, 0x47, 0xC0, 0xF7, 0x54, 0xED, 0xD7, 0xD4, 0xC2, 0xCF, 0xA9, 0x05, 0x1F, 0x53,
+	0xF3, 0xDF, 0xA7, 0xAA, 0xDE, 0xA6, 0xE6, 0x4D, 0xA4, 0xE6, 0x8E, 0xA7, 0xE6, 0xBC, 0x4A, 0x95,
+	0x8F, 0xA4, 0x66, 0x0F, 0xA7, 0x66, 0xBD, 0x48, 0xCD, 0x1C, 0x48, 0x95, 0xF4, 0xA7, 0xA6, 0x3D,
+	0x4B, 0x3D, 0xDE, 0x93, 0x7A, 0x0C, 0x9B, 0x9A, 0xE9, 0x9F, 0x9A, 0x85, 0x4B, 0xCD, 0x5E, 0x9C,
+	0x2A, 0xC7, 0xA7, 0xE6, 0x04, 0xA5, 0xE6, 0x12, 0x52, 0xF3, 0x42, 0x53, 0x55, 0xC4, 0xD4, 0xFC,
+	0xE5, 0xA9, 0x05, 0xA4, 0xD4, 0xC2, 0xF0, 0x54, 0x2D, 0x39, 0xB5, 0x64, 0x55, 0x6A, 0x19, 0x25,
+	0xB5, 0x7C, 0x6D, 0xAA, 0xA1, 0x26, 0x15, 0xBE, 0x95, 0x1A, 0x73, 0x33, 0x35, 0xBA, 0x3A, 0x35,
+	0xB2, 0x2A, 0x95, 0x72, 0x3D, 0x35, 0xA2, 0x22, 0x35, 0xBC, 0x3C, 0x35, 0xEC, 0x6A, 0x2A, 0xF1,
+	0xEF, 0x15, 0x20, 0x75, 0xE7, 0xB5, 0xD4, 0x5D, 0x86, 0xD4, 0x9F, 0x2A, 0x53, 0x79, 0xC6, 0xD4,
+	0x9F, 0x6F, 0xA4, 0xFE, 0xC3, 0x94, 0xFA, 0xCF, 0xDB, 0xA9, 0xA9, 0x91, 0xA9, 0xD2, 0x35, 0xA9,
+	0x19, 0xAB, 0x53, 0xD3, 0x23, 0x52, 0x4F, 0xAC, 0x4C, 0x15, 0xAD, 0x48, 0x3D, 0x1A, 0x96, 0x7A,
+	0x64, 0x59, 0xEA, 0xA1, 0xA5, 0xA9, 0x82, 0x90, 0xD4, 0x03, 0xC1, 0xA9, 0xFB, 0x97, 0xA4, 0xEE,
+	0x0D, 0x4C, 0xE5, 0x06, 0xA4, 0xFE, 0xB8, 0x28, 0x75, 0xC7, 0xC2, 0xD4, 0x6D, 0xDD, 0xA9, 0x45,
+	0xBD, 0xA9, 0xC5, 0x7D, 0xA9, 0xA5, 0xCF, 0x53, 0xF5, 0x83, 0xA9, 0x15, 0x43, 0xA9, 0x95, 0x2F,
+	0x53, 0xAB, 0x47, 0x53, 0x4D, 0x63, 0xA9, 0x35, 0xAF, 0x53, 0x6B, 0xDF, 0xA4, 0xD6, 0xBF, 0x4B,
+	0xB5, 0x7E, 0x48, 0xBD, 0xFF, 0x29, 0xF5, 0xE1, 0x97, 0xD4, 0x47, 0xDF, 0x52, 0x1D, 0xC0, 0x77,
+	0x61, 0xE1, 0x57, 0x61, 0xC1, 0x67, 0x61, 0xFE, 0x47, 0xA1, 0xEA, 0xBD, 0x30, 0xEF, 0xAD, 0x30,
+	0x77, 0x42, 0x98, 0x33, 0x2E, 0x94, 0xBF, 0x12, 0x66, 0x8F, 0x08, 0xB3, 0x86, 0x85, 0x99, 0x2F,
+	0x84, 0x92, 0x01, 0x61, 0x5A, 0xBF, 0xF0, 0xF8, 0x33, 0xE1, 0xB1, 0x1E, 0xA1, 0x10, 0x2B, 0xCC,
+	0xF2, 0x17, 0x66, 0xE3, 0x84, 0xF2, 0xC5, 0xC2, 0x1C, 0xBC, 0x30, 0x37, 0x48, 0x98, 0x47, 0x10,
+	0xAA, 0x42, 0x85, 0xF9, 0x44, 0x61, 0xC1, 0x72, 0x61, 0x21, 0x49, 0xA8, 0x0D, 0x17, 0x96, 0x90,
+	0x85, 0x65, 0xAB, 0x84, 0xE5, 0x14, 0xA1, 0x61, 0xAD, 0xB0, 0xAA, 0x46, 0x18, 0x73, 0x4B, 0x18,
+	0x7D, 0x53, 0x18, 0x59, 0x2D, 0xA4, 0x54, 0x09, 0x23, 0xAE, 0x0B, 0xC3, 0x2B, 0x84, 0x61, 0xE5,
+	0x42, 0xE2, 0x55, 0x61, 0xC8, 0xDF, 0x2B, 0x80, 0x70, 0xD7, 0x35, 0xE1, 0x4F, 0x06, 0x21, 0xAF,
+	0x52, 0xF8, 0xB3, 0x51, 0xF8, 0x8F, 0x1B, 0xC2, 0x7F, 0x9A, 0x84, 0xA9, 0xB7, 0x85, 0xFF, 0x15,
+	0x29, 0xCC, 0x58, 0x23, 0x4C, 0x5F, 0x2D, 0x3C, 0x11, 0x21, 0x14, 0xAD, 0x14, 0x1E, 0x5D, 0x21,
+	0x3C, 0x12, 0x26, 0x3C, 0xB4, 0x4C, 0x28, 0x58, 0x2A, 0x3C, 0x10, 0x22, 0xDC, 0x1F, 0x2C, 0xDC,
+	0xBB, 0x44, 0xC8, 0x0D, 0x14, 0xFE, 0x18, 0x20, 0xDC, 0xB1, 0x48, 0xB8, 0x6D, 0xA1, 0x90, 0xD5,
+	0x2D, 0x2C, 0xEE, 0x15, 0x96, 0xF6, 0x09, 0xF5, 0xCF, 0x85, 0x15, 0x83, 0xC2, 0xCA, 0x21, 0x61,
+	0xF5, 0x4B, 0xA1, 0x69, 0x54, 0x58, 0x33, 0x26, 0xAC, 0x7D, 0x2D, 0xAC, 0x7F, 0x23, 0xB4, 0xBE,
+	0x13, 0xDE, 0xFF, 0x20, 0x7C, 0xF8, 0x49, 0xF8, 0xE8, 0x8B, 0xD0, 0xF1, 0x4D, 0xF8, 0x18, 0xF8,
+	0x2E, 0x2A, 0xF8, 0x2A, 0xCA, 0xFF, 0x2C, 0x52, 0x7D, 0x14, 0xE5, 0xBD, 0x17, 0xE5, 0xBE, 0x15,
+	0xE5, 0x4C, 0x88, 0xE4, 0xE3, 0xA2, 0xEC, 0x57, 0xA2, 0xAC, 0x11, 0x51, 0xE6, 0xB0, 0x48, 0xF2,
+	0x42, 0x94, 0x36, 0x20, 0x3A, 0xDE, 0x2F, 0x3A, 0xF6, 0x4C, 0x24, 0xEC, 0x11, 0x1D, 0xC6, 0x8A,
+	0xB2, 0xFD, 0x45, 0x72, 0x9C, 0x28, 0x67, 0xB1, 0x28, 0x17, 0x2F, 0xCA, 0x0B, 0x12, 0xA9, 0x08,
+	0xA2, 0xFC, 0x50, 0x51, 0x01, 0x51, 0x54, 0xB8, 0x5C, 0xA4, 0x25, 0x89, 0x4A, 0xC2, 0x45, 0x65,
+	0x64, 0x51, 0xF9, 0x2A, 0x91, 0x81, 0x22, 0xAA, 0x5A, 0x2B, 0xBA, 0x51, 0x23, 0x8A, 0xBE, 0x25,
+	0x8A, 0xBC, 0x29, 0xA2, 0x54, 0x8B, 0x22, 0xAA, 0x44, 0xE1, 0xD7, 0x45, 0x61, 0x15, 0x22, 0x62,
+	0xB9, 0x28, 0xE4, 0xAA, 0x28, 0xE8, 0xEF, 0x15, 0x40, 0xF4, 0xD3, 0x35, 0x11, 0xCF, 0x20, 0xFA,
+	0xB9, 0x52, 0xF4, 0x0F, 0xA3, 0xE8, 0x9F, 0x37, 0x44, 0xA9, 0x26, 0xD1, 0x7F, 0xDD, 0x16, 0xFD,
+	0xAF, 0x48, 0x51, 0xFA, 0x1A, 0xD1, 0x89, 0xD5, 0x22, 0x51, 0x84, 0xE8, 0xE8, 0x4A, 0xD1, 0x91,
+	0x15, 0xA2, 0x43, 0x61, 0x22, 0xC1, 0x32, 0xD1, 0x81, 0xA5, 0xA2, 0xFD, 0x21, 0xA2, 0xBD, 0xC1,
+	0x22, 0xEE, 0x12, 0xD1, 0x8F, 0x81, 0xA2, 0x1D, 0x01, 0xA2, 0x6D, 0x8B, 0x44, 0xAC, 0x85, 0xA2,
+	0x1F, 0xBA, 0x45, 0xA5, 0xBD, 0x22, 0x7D, 0x9F, 0xA8, 0xE2, 0xB9, 0xA8, 0x72, 0x50, 0x54, 0x3D,
+	0x24, 0x32, 0xBD, 0x14, 0xD5, 0x8C, 0x8A, 0x6A, 0xC7, 0x44, 0xF5, 0xAF, 0x45, 0xD6, 0x37, 0xA2,
+	0xFB, 0xEF, 0x44, 0x0F, 0x3F, 0x88, 0x1E, 0x7D, 0x12, 0x39, 0xBE, 0x88, 0x1E, 0x7F, 0x13, 0x3D,
+	0x01, 0x00, 0x31, 0x67, 0x92, 0x78, 0x37, 0x42, 0xBC, 0x67, 0xAA, 0x78, 0x1F, 0x52, 0xCC, 0xF7,
+	0x10, 0x1F, 0x44, 0x89, 0x7F, 0x99, 0x21, 0x3E, 0x0C, 0x8A, 0x85, 0xB3, 0xC5, 0xC7, 0xD0, 0xE2,
+	0xE3, 0xDE, 0xE2, 0x34, 0x8C, 0x58, 0x32, 0x4F, 0x9C, 0x09, 0x89, 0xB3, 0x7C, 0xC5, 0xD9, 0x5D,
+	0xE2, 0x83, 0x4F, 0xC5, 0xFC, 0x0E, 0xF1, 0xBE, 0x76, 0xF1, 0x9E, 0xC7, 0xE2, 0xDD, 0xAD, 0x62,
+	0x4E, 0x8B, 0x78, 0xFB, 0x23, 0x71, 0x4A, 0x93, 0x38, 0xF9, 0x81, 0x98, 0x79, 0x5F, 0x9C, 0xD4,
+	0x28, 0x4E, 0xBC, 0x2B, 0x8E, 0xAF, 0x17, 0xC3, 0x75, 0xE2, 0x98, 0x3B, 0xE2, 0x68, 0xAA, 0xD8,
+	0x1C, 0x2D, 0xAE, 0xA3, 0x89, 0x1B, 0xD6, 0x8B, 0x1B, 0x61, 0xB1, 0x2D, 0x4E, 0xDC, 0x44, 0x17,
+	0x37, 0x27, 0x8A, 0x5B, 0x19, 0x62, 0xE7, 0xDF, 0x2A, 0xC0, 0x46, 0xF1, 0xF9, 0x04, 0xB1, 0x22,
+	0x5E, 0x7C, 0x66, 0x83, 0xF8, 0x54, 0xAC, 0xF8, 0x64, 0x8C, 0x58, 0xBA, 0x4E, 0x9C, 0x11, 0x25,
+	0x4E, 0x37, 0x8B, 0xC5, 0xB5, 0xE2, 0x5F, 0x2D, 0xE2, 0xDF, 0x1A, 0xC4, 0xBF, 0x5B, 0xC5, 0xB2,
+	0x7B, 0xE2, 0xD3, 0x36, 0xF1, 0xD9, 0x87, 0xE2, 0x73, 0x76, 0xB1, 0xB2, 0x59, 0x7C, 0xD1, 0x21,
+	0xBE, 0xDC, 0x26, 0xBE, 0xE2, 0x14, 0x6B, 0x9E, 0x88, 0x8B, 0x5C, 0xE2, 0xE2, 0x4E, 0x71, 0xA9,
+	0x9F, 0x78, 0xE3, 0x02, 0x31, 0x7D, 0xBE, 0x78, 0x83, 0x8F, 0x78, 0xFD, 0x5C, 0xF1, 0xBA, 0x39,
+	0x62, 0xAA, 0x97, 0x78, 0xCD, 0x2C, 0xF1, 0xAA, 0x99, 0xE2, 0x95, 0x9E, 0x62, 0xD2, 0x74, 0xF1,
+	0xB2, 0x69, 0xE2, 0x50, 0x77, 0x71, 0xF0, 0x14, 0x31, 0x7E, 0xB2, 0x38, 0xC0, 0x4D, 0xEC, 0x0F,
+	0x00, 0x92, 0xDD, 0x93, 0x24, 0x7B, 0x10, 0x92, 0x7D, 0x53, 0x25, 0x7C, 0xA4, 0xE4, 0xA0, 0x87,
+	0xE4, 0x17, 0x94, 0xE4, 0xF0, 0x0C, 0x89, 0x10, 0x94, 0x1C, 0x9B, 0x2D, 0x39, 0x8E, 0x96, 0xA4,
+	0x79, 0x4B, 0x24, 0x18, 0x49, 0xE6, 0x3C, 0x49, 0x16, 0x24, 0xC9, 0xF6, 0x95, 0xC8, 0xBB, 0x24,
+	0xFC, 0xA7, 0x92, 0x7D, 0x1D, 0x92, 0x3D, 0xED, 0x92, 0xDD, 0x8F, 0x25, 0x9C, 0x56, 0xC9, 0xF6,
+	0x16, 0x49, 0xCA, 0x23, 0x49, 0x72, 0x93, 0x84, 0xF9, 0x40, 0x92, 0x74, 0x5F, 0x92, 0xD8, 0x28,
+	0x89, 0xBF, 0x2B, 0x81, 0xEB, 0x25, 0x31, 0x75, 0x92, 0xE8, 0x3B, 0x92, 0x48, 0xAA, 0xA4, 0x2E,
+	0x5A, 0xD2, 0x40, 0x93, 0x34, 0xAE, 0x97, 0xD8, 0x60, 0x49, 0x53, 0x9C, 0xA4, 0x99, 0x2E, 0x69,
+	0x4D, 0x94, 0x38, 0x19, 0x92, 0x8E, 0xBF, 0x57, 0x00, 0x89, 0x22, 0x41, 0x72, 0x26, 0x5E, 0x72,
+	0x6A, 0x83, 0xE4, 0x64, 0xAC, 0x44, 0x1A, 0x23, 0xC9, 0x58, 0x27, 0x49, 0x8F, 0x92, 0x9C, 0x30,
+	0x4B, 0x7E, 0xAD, 0x95, 0xFC, 0x66, 0x91, 0xFC, 0xDE, 0x20, 0x91, 0x59, 0x25, 0xA7, 0xEF, 0x49,
+	0xCE, 0xDA, 0x24, 0xE7, 0x1E, 0x4A, 0x94, 0x76, 0xC9, 0xC5, 0x66, 0xC9, 0x65, 0x87, 0xE4, 0x4A,
+	0x9B, 0x44, 0xE3, 0x94, 0x14, 0x3D, 0x91, 0x14, 0xBB, 0x24, 0xA5, 0x9D, 0x12, 0xBD, 0x9F, 0x84,
+	0xBE, 0x40, 0xB2, 0x61, 0xBE, 0x64, 0xBD, 0x8F, 0x64, 0xDD, 0x5C, 0x09, 0x75, 0x8E, 0x64, 0x8D,
+	0x97, 0x64, 0xD5, 0x2C, 0xC9, 0xCA, 0x99, 0x12, 0x92, 0xA7, 0x64, 0xD9, 0x74, 0x49, 0xE8, 0x34,
+	0x49, 0xB0, 0xBB, 0x04, 0x3F, 0x45, 0x12, 0x30, 0x59, 0xE2, 0xEF, 0x26, 0xF1, 0x03, 0x00, 0xE9,
+	0x9E, 0x49, 0xD2, 0x7D, 0x08, 0x29, 0x7F, 0xAA, 0xF4, 0x20, 0x52, 0xFA, 0x8B, 0x87, 0xF4, 0x30,
+	0x4A, 0x2A, 0x9C, 0x21, 0x3D, 0x06, 0x4A, 0x8F, 0xCF, 0x96, 0xA6, 0xA1, 0xA5, 0x12, 0x6F, 0x69,
+	0x26, 0x46, 0x9A, 0x35, 0x4F, 0x9A, 0x0D, 0x49, 0xE5, 0xBE, 0xD2, 0x9C, 0x2E, 0xE9, 0xBE, 0xA7,
+	0xD2, 0x3D, 0x1D, 0xD2, 0xDD, 0xED, 0x52, 0xCE, 0x63, 0xE9, 0xF6, 0x56, 0x69, 0x4A, 0x8B, 0x34,
+	0xF9, 0x91, 0x94, 0xD9, 0x24, 0x4D, 0x7A, 0x20, 0x4D, 0xBC, 0x2F, 0x8D, 0x6F, 0x94, 0xC2, 0x77,
+	0xA5, 0x31, 0xF5, 0xD2, 0xE8, 0x3A, 0x69, 0xE4, 0x1D, 0x29, 0x85, 0x2A, 0x6D, 0x88, 0x96, 0x36,
+	0xD2, 0xA4, 0xB6, 0xF5, 0xD2, 0x26, 0x58, 0xDA, 0x1C, 0x27, 0x6D, 0xA5, 0x4B, 0x9D, 0x89, 0xD2,
+	0x0E, 0x86, 0xB4, 0xF3, 0xEF, 0x15, 0x40, 0x7A, 0x26, 0x41, 0x7A, 0x2A, 0x5E, 0x7A, 0x72, 0x83,
+	0x54, 0x1A, 0x2B, 0xCD, 0x88, 0x91, 0xA6, 0xAF, 0x93, 0x9E, 0x88, 0x92, 0x8A, 0xCC, 0xD2, 0xDF,
+	0x6A, 0xA5, 0xBF, 0x5B, 0xA4, 0xB2, 0x06, 0xE9, 0x69, 0xAB, 0xF4, 0xEC, 0x3D, 0xE9, 0x39, 0x9B,
+	0x54, 0xF9, 0x50, 0x7A, 0xD1, 0x2E, 0xBD, 0xDC, 0x2C, 0xBD, 0xE2, 0x90, 0x6A, 0xDA, 0xA4, 0x45,
+	0x4E, 0x69, 0xF1, 0x13, 0x69, 0xA9, 0x4B, 0xAA, 0xEF, 0x94, 0x56, 0xF8, 0x49, 0x37, 0x2C, 0x90,
+	0xAE, 0x9F, 0x2F, 0x5D, 0xE7, 0x23, 0xA5, 0xCE, 0x95, 0xAE, 0x99, 0x23, 0x5D, 0xE5, 0x25, 0x5D,
+	0x39, 0x4B, 0x4A, 0x9A, 0x29, 0x5D, 0xE6, 0x29, 0x0D, 0x9D, 0x2E, 0x0D, 0x9E, 0x26, 0xC5, 0xBB,
+	0x4B, 0x03, 0xA6, 0x48, 0xFD, 0x27, 0x4B, 0xFD, 0xDC, 0xA4, 0x10, 0x00, 0xC8, 0xF6, 0x4D, 0x92,
+	0xF1, 0x11, 0xB2, 0x83, 0x53, 0x65, 0xBF, 0x20, 0x65, 0x87, 0x3D, 0x64, 0x42, 0x94, 0xEC, 0xD8,
+	0x0C, 0xD9, 0x71, 0x50, 0x96, 0x36, 0x5B, 0x26, 0x41, 0xCB, 0x32, 0xBD, 0x65, 0x59, 0x18, 0x59,
+	0xF6, 0x3C, 0x99, 0x1C, 0x92, 0xE5, 0xF8, 0xCA, 0x72, 0xBB, 0x64, 0x7B, 0x9E, 0xCA, 0x76, 0x77,
+	0xC8, 0x38, 0xED, 0xB2, 0xED, 0x8F, 0x65, 0x29, 0xAD, 0xB2, 0xE4, 0x16, 0x19, 0xF3, 0x91, 0x2C,
+	0xA9, 0x49, 0x96, 0xF8, 0x40, 0x16, 0x7F, 0x5F, 0x06, 0x37, 0xCA, 0x62, 0xEE, 0xCA, 0xA2, 0xEB,
+	0x65, 0x91, 0x75, 0x32, 0xCA, 0x1D, 0x59, 0x04, 0x55, 0xD6, 0x18, 0x2D, 0xB3, 0xD1, 0x64, 0x4D,
+	0xEB, 0x65, 0xCD, 0xB0, 0xAC, 0x35, 0x4E, 0xE6, 0xA4, 0xCB, 0x3A, 0x12, 0x65, 0x9D, 0x0C, 0x59,
+	0xCF, 0xDF, 0x2B, 0x80, 0xEC, 0x54, 0x82, 0xEC, 0x64, 0xBC, 0x4C, 0xBA, 0x41, 0x96, 0x11, 0x2B,
+	0x4B, 0x8F, 0x91, 0x9D, 0x58, 0x27, 0x13, 0x45, 0xC9, 0x8E, 0x9A, 0x65, 0xBF, 0xD7, 0xCA, 0x64,
+	0x16, 0xD9, 0xE9, 0x06, 0xD9, 0x59, 0xAB, 0xEC, 0xDC, 0x3D, 0x99, 0xD2, 0x26, 0xBB, 0xF8, 0x50,
+	0x76, 0xD9, 0x2E, 0xBB, 0xD2, 0x2C, 0xD3, 0x38, 0x64, 0x45, 0x6D, 0xB2, 0x62, 0xA7, 0xAC, 0xF4,
+	0x89, 0x4C, 0xEF, 0x92, 0x55, 0x74, 0xCA, 0x2A, 0xFD, 0x64, 0xEB, 0x17, 0xC8, 0xD6, 0xCD, 0x97,
+	0x51, 0x7D, 0x64, 0x6B, 0xE6, 0xCA, 0x56, 0xCD, 0x91, 0xAD, 0xF4, 0x92, 0x91, 0x66, 0xC9, 0x96,
+	0xCD, 0x94, 0x85, 0x7A, 0xCA, 0x82, 0xA7, 0xCB, 0xF0, 0xD3, 0x64, 0x01, 0xEE, 0x32, 0xFF, 0x29,
+	0x32, 0xBF, 0xC9, 0x32, 0xC8, 0x4D, 0xE6, 0x03, 0x00, 0x72, 0xFE, 0x24, 0xF9, 0x41, 0x84, 0xFC,
+	0x97, 0xA9, 0xF2, 0xC3, 0x48, 0xB9, 0xD0, 0x43, 0x7E, 0x0C, 0x25, 0x3F, 0x3E, 0x43, 0x9E, 0x06,
+	0xCA, 0x25, 0xB3, 0xE5, 0x99, 0x68, 0x79, 0x96, 0xB7, 0x3C, 0x1B, 0x23, 0x97, 0xCF, 0x93, 0xE7,
+	0x40, 0xF2, 0x5C, 0x5F, 0x79, 0x5E, 0x97, 0x7C, 0xF7, 0x53, 0x39, 0xA7, 0x43, 0xBE, 0xBD, 0x5D,
+	0x9E, 0xF2, 0x58, 0x9E, 0xDC, 0x2A, 0x67, 0xB6, 0xC8, 0x93, 0x1E, 0xC9, 0x13, 0x9B, 0xE4, 0xF1,
+	0x0F, 0xE4, 0xF0, 0x7D, 0x79, 0x4C, 0xA3, 0x3C, 0xFA, 0xAE, 0x3C, 0xB2, 0x5E, 0x4E, 0xA9, 0x93,
+	0x47, 0xDC, 0x91, 0x87, 0x53, 0xE5, 0xB6, 0x68, 0x79, 0x13, 0x4D, 0xDE, 0xBC, 0x5E, 0xDE, 0x0A,
+	0xCB, 0x9D, 0x71, 0xF2, 0x0E, 0xBA, 0xBC, 0x33, 0x51, 0xDE, 0xC3, 0x90, 0xF7, 0xFD, 0xBD, 0x02,
+	0xC8, 0x4F, 0x26, 0xC8, 0xA5, 0xF1, 0xF2, 0x8C, 0x0D, 0xF2, 0xF4, 0x58, 0xF9, 0x89, 0x18, 0xB9,
+	0x68, 0x9D, 0xFC, 0x68, 0x94, 0xFC, 0x88, 0x59, 0x2E, 0xAB, 0x95, 0x9F, 0xB6, 0xC8, 0xCF, 0x36,
+	0xC8, 0xCF, 0x59, 0xE5, 0xCA, 0x7B, 0xF2, 0x8B, 0x36, 0xF9, 0xE5, 0x87, 0xF2, 0x2B, 0x76, 0xB9,
+	0xA6, 0x59, 0x5E, 0xE4, 0x90, 0x17, 0xB7, 0xC9, 0x4B, 0x9D, 0x72, 0xFD, 0x13, 0x79, 0x85, 0x4B,
+	0x5E, 0xD9, 0x29, 0xAF, 0xF6, 0x93, 0xAF, 0x5B, 0x20, 0xA7, 0xCE, 0x97, 0xAF, 0xF1, 0x91, 0xAF,
+	0x9A, 0x2B, 0x5F, 0x39, 0x47, 0x4E, 0xF2, 0x92, 0x2F, 0x9B, 0x25, 0x0F, 0x9D, 0x29, 0x0F, 0xF6,
+	0x94, 0xE3, 0xA7, 0xCB, 0x03, 0xA6, 0xC9, 0xFD, 0xDD, 0xE5, 0x7E, 0x53, 0xE4, 0xD0, 0x64, 0xB9,
+	0x8F, 0x9B, 0xDC, 0x1B, 0x00, 0x14, 0x07, 0x27, 0x29, 0x7E, 0x41, 0x28, 0x0E, 0x4F, 0x55, 0x08,
+	0x91, 0x8A, 0x63, 0x1E, 0x8A, 0xE3, 0x28, 0x45, 0xDA, 0x0C, 0x85, 0x04, 0x54, 0x64, 0xCE, 0x56,
+	0x64, 0xA1, 0x15, 0xD9, 0xDE, 0x0A, 0x39, 0x46, 0x91, 0x33, 0x4F, 0x91, 0x0B, 0x29, 0xF2, 0x7C,
+	0x15, 0xAA, 0x2E, 0x05, 0xE7, 0xA9, 0x62, 0x7B, 0x87, 0x22, 0xA5, 0x5D, 0x91, 0xFC, 0x58, 0xC1,
+	0x6C, 0x55, 0x24, 0xB5, 0x28, 0x12, 0x1F, 0x29, 0xE2, 0x9B, 0x14, 0xF0, 0x03, 0x45, 0xCC, 0x7D,
+	0x45, 0x74, 0xA3, 0x22, 0xF2, 0xAE, 0x82, 0x52, 0xAF, 0x88, 0xA8, 0x53, 0x84, 0xDF, 0x51, 0x84,
+	0x51, 0x15, 0x4D, 0xD1, 0x8A, 0x66, 0x9A, 0xA2, 0x75, 0xBD, 0xC2, 0x09, 0x2B, 0x3A, 0xE2, 0x14,
+	0x9D, 0x74, 0x45, 0x4F, 0xA2, 0xA2, 0x8F, 0xA1, 0x18, 0xF8, 0x7B, 0x05, 0x50, 0x48, 0x13, 0x14,
+	0x19, 0xF1, 0x8A, 0xF4, 0x0D, 0x8A, 0x13, 0xB1, 0x0A, 0x51, 0x8C, 0xE2, 0xE8, 0x3A, 0xC5, 0x91,
+	0x28, 0xC5, 0x21, 0xB3, 0xE2, 0x74, 0xAD, 0xE2, 0xAC, 0x45, 0x71, 0xAE, 0x41, 0xA1, 0xB4, 0x2A,
+	0x2E, 0xDE, 0x53, 0x5C, 0xB6, 0x29, 0xAE, 0x3C, 0x54, 0x68, 0xEC, 0x8A, 0xA2, 0x66, 0x45, 0xB1,
+	0x43, 0x51, 0xDA, 0xA6, 0xD0, 0x3B, 0x15, 0x15, 0x4F, 0x14, 0x95, 0x2E, 0x45, 0x75, 0xA7, 0xC2,
+	0xE4, 0xA7, 0xA0, 0x2E, 0x50, 0xAC, 0x99, 0xAF, 0x58, 0xE5, 0xA3, 0x58, 0x39, 0x57, 0x41, 0x9A,
+	0xA3, 0x58, 0xE6, 0xA5, 0x08, 0x9D, 0xA5, 0x08, 0x9E, 0xA9, 0xC0, 0x7B, 0x2A, 0x02, 0xA6, 0x2B,
+	0xFC, 0xA7, 0x29, 0xFC, 0xDC, 0x15, 0xD0, 0x14, 0x85, 0xCF, 0x64, 0x85, 0xB7, 0x9B, 0xC2, 0x0B,
+	0x00, 0x94, 0xBF, 0x4C, 0x52, 0x1E, 0x46, 0x28, 0x85, 0x53, 0x95, 0xC7, 0x90, 0xCA, 0xE3, 0x1E,
+	0xCA, 0x34, 0x94, 0x52, 0x32, 0x43, 0x99, 0x09, 0x2A, 0xB3, 0x66, 0x2B, 0xB3, 0xD1, 0x4A, 0xB9,
+	0xB7, 0x32, 0x07, 0xA3, 0xCC, 0x9D, 0xA7, 0xCC, 0x83, 0x94, 0x2A, 0x5F, 0x65, 0x7E, 0x97, 0x72,
+	0xFB, 0x53, 0x65, 0x4A, 0x87, 0x32, 0xB9, 0x5D, 0xC9, 0x7C, 0xAC, 0x4C, 0x6A, 0x55, 0x26, 0xB6,
+	0x28, 0xE3, 0x1F, 0x29, 0xE1, 0x26, 0x65, 0xCC, 0x03, 0x65, 0xF4, 0x7D, 0x65, 0x64, 0xA3, 0x92,
+	0x72, 0x57, 0x19, 0x51, 0xAF, 0x0C, 0xAF, 0x53, 0x86, 0xDD, 0x51, 0x12, 0xA9, 0xCA, 0xE6, 0x68,
+	0x65, 0x2B, 0x4D, 0xE9, 0x5C, 0xAF, 0xEC, 0x80, 0x95, 0x9D, 0x71, 0xCA, 0x1E, 0xBA, 0xB2, 0x2F,
+	0x51, 0x39, 0xC0, 0x50, 0x0E, 0xFD, 0xBD, 0x02, 0x28, 0x33, 0x12, 0x94, 0xE9, 0xF1, 0xCA, 0x13,
+	0x1B, 0x94, 0xA2, 0x58, 0xE5, 0xD1, 0x18, 0xE5, 0x91, 0x75, 0xCA, 0x43, 0x51, 0x4A, 0x81, 0x59,
+	0x79, 0xB6, 0x56, 0x79, 0xCE, 0xA2, 0x54, 0x36, 0x28, 0x2F, 0x5A, 0x95, 0x97, 0xEF, 0x29, 0xAF,
+	0xD8, 0x94, 0x9A, 0x87, 0xCA, 0x22, 0xBB, 0xB2, 0xB8, 0x59, 0x59, 0xEA, 0x50, 0xEA, 0xDB, 0x94,
+	0x15, 0x4E, 0x65, 0xE5, 0x13, 0x65, 0xB5, 0x4B, 0x69, 0xEA, 0x54, 0xD6, 0xF8, 0x29, 0xD7, 0x2C,
+	0x50, 0xAE, 0x9A, 0xAF, 0x5C, 0xE9, 0xA3, 0x24, 0xCD, 0x55, 0x2E, 0x9B, 0xA3, 0x0C, 0xF5, 0x52,
+	0x06, 0xCF, 0x52, 0xE2, 0x67, 0x2A, 0x03, 0x3C, 0x95, 0xFE, 0xD3, 0x95, 0x7E, 0xD3, 0x94, 0x90,
+	0xBB, 0xD2, 0x67, 0x8A, 0xD2, 0x7B, 0xB2, 0xD2, 0xCB, 0x4D, 0x09, 0x02, 0x80, 0xEA, 0xF0, 0x24,
+	0x95, 0x10, 0xA1, 0x3A, 0x36, 0x55, 0x75, 0x1C, 0xA9, 0x4A, 0xF3, 0x50, 0x49, 0x50, 0xAA, 0xCC,
+	0x19, 0xAA, 0x2C, 0x50, 0x95, 0x3D, 0x5B, 0x25, 0x47, 0xAB, 0x72, 0xBC, 0x55, 0xB9, 0x18, 0x55,
+	0xDE, 0x3C, 0x95, 0x0A, 0x52, 0xE5, 0xFB, 0xAA, 0x0A, 0xBA, 0x54, 0x29, 0x4F, 0x55, 0xC9, 0x1D,
+	0x2A, 0x66, 0xBB, 0x2A, 0xE9, 0xB1, 0x2A, 0xB1, 0x55, 0x15, 0xDF, 0xA2, 0x82, 0x1F, 0xA9, 0x62,
+	0x9A, 0x54, 0xD1, 0x0F, 0x54, 0x91, 0xF7, 0x55, 0x94, 0x46, 0x55, 0xC4, 0x5D, 0x55, 0x78, 0xBD,
+	0x2A, 0xAC, 0x4E, 0x45, 0xBC, 0xA3, 0x0A, 0xA1, 0xAA, 0x5A, 0xA3, 0x55, 0x4E, 0x9A, 0xAA, 0x63,
+	0xBD, 0xAA, 0x13, 0x56, 0xF5, 0xC4, 0xA9, 0xFA, 0xE8, 0xAA, 0x81, 0x44, 0xD5, 0x10, 0x43, 0x35,
+	0xB2, 0x49, 0x35, 0xF6, 0x37, 0xD1, 0x4F, 0x52, 0x65, 0x6C, 0x54, 0xA5, 0x27, 0xA8, 0x4E, 0xC4,
+	0xAB, 0x44, 0x1B, 0x54, 0x47, 0x63, 0x55, 0x47, 0x62, 0x54, 0x87, 0xD6, 0xA9, 0x04, 0x51, 0xAA,
+	0x03, 0x66, 0xD5, 0xB9, 0x5A, 0x95, 0xD2, 0xA2, 0xBA, 0xD8, 0xA0, 0xBA, 0x6C, 0x55, 0x5D, 0xB9,
+	0xA7, 0xD2, 0xD8, 0x54, 0x45, 0x0F, 0x55, 0xC5, 0x76, 0x55, 0x69, 0xB3, 0x4A, 0xEF, 0x50, 0x55,
+	0xB4, 0xA9, 0x2A, 0x9D, 0xAA, 0xEA, 0x27, 0x2A, 0x93, 0x4B, 0x55, 0xD3, 0xA9, 0xAA, 0xF5, 0x53,
+	0xAD, 0x5A, 0xA0, 0x5A, 0x39, 0x5F, 0x45, 0xF2, 0x51, 0x2D, 0x9B, 0xAB, 0x0A, 0x9D, 0xA3, 0x0A,
+	0xF6, 0x52, 0xE1, 0x67, 0xA9, 0x02, 0x66, 0xAA, 0xFC, 0x3D, 0x55, 0x7E, 0xD3, 0x55, 0xD0, 0x34,
+	0x95, 0x8F, 0xBB, 0xCA, 0x7B, 0x8A, 0xCA, 0x6B, 0xB2, 0x0A, 0x74, 0x53, 0x79, 0x02, 0x80, 0x5A,
+	0x38, 0x49, 0x7D, 0x0C, 0xA1, 0x3E, 0x3E, 0x55, 0x9D, 0x86, 0x54, 0x4B, 0x3C, 0xD4, 0x99, 0x28,
+	0x75, 0xD6, 0x0C, 0x75, 0x36, 0xA8, 0x96, 0xCF, 0x56, 0xE7, 0xA0, 0xD5, 0xB9, 0xDE, 0xEA, 0x3C,
+	0x8C, 0x5A, 0x35, 0x4F, 0x9D, 0x0F, 0xA9, 0x0B, 0x7C, 0xD5, 0x85, 0x5D, 0xEA, 0xE4, 0xA7, 0x6A,
+	0x66, 0x87, 0x3A, 0xA9, 0x5D, 0x9D, 0xF8, 0x58, 0x1D, 0xDF, 0xAA, 0x86, 0x5B, 0xD4, 0x31, 0x8F,
+	0xD4, 0xD1, 0x4D, 0xEA, 0xC8, 0x07, 0x6A, 0xCA, 0x7D, 0x75, 0x44, 0xA3, 0x3A, 0xFC, 0xAE, 0x3A,
+	0xAC, 0x5E, 0x4D, 0xAC, 0x53, 0x87, 0xDC, 0x51, 0x07, 0x51, 0xD5, 0xCE, 0x68, 0x75, 0x07, 0x4D,
+	0xDD, 0xB9, 0x5E, 0xDD, 0x03, 0xAB, 0xFB, 0xE2, 0xD4, 0x03, 0x74, 0xF5, 0x50, 0xA2, 0x7A, 0x84,
+	0xA1, 0x1E, 0xDB, 0xA4, 0x9E, 0xF8, 0xBB, 0x04, 0x50, 0xA7, 0x6F, 0x54, 0x9F, 0x48, 0x50, 0x8B,
+	0xE2, 0xD5, 0x47, 0x37, 0xA8, 0x8F, 0xC4, 0xAA, 0x0F, 0xC5, 0xA8, 0x05, 0xEB, 0xD4, 0x07, 0xA2,
+	0xD4, 0xFB, 0xCD, 0x6A, 0x65, 0xAD, 0xFA, 0xA2, 0x45, 0x7D, 0xB9, 0x41, 0x7D, 0xC5, 0xAA, 0xD6,
+	0xDC, 0x53, 0x17, 0xD9, 0xD4, 0xC5, 0x0F, 0xD5, 0xA5, 0x76, 0xB5, 0xBE, 0x59, 0x5D, 0xE1, 0x50,
+	0x57, 0xB6, 0xA9, 0xAB, 0x9D, 0x6A, 0xD3, 0x13, 0x75, 0x8D, 0x4B, 0x5D, 0xDB, 0xA9, 0xAE, 0xF7,
+	0x53, 0xAF, 0x5C, 0xA0, 0x26, 0xCD, 0x57, 0x2F, 0xF3, 0x51, 0x87, 0xCE, 0x55, 0x07, 0xCF, 0x51,
+	0xE3, 0xBD, 0xD4, 0x01, 0xB3, 0xD4, 0xFE, 0x33, 0xD5, 0x7E, 0x9E, 0x6A, 0x68, 0xBA, 0xDA, 0x67,
+	0x9A, 0xDA, 0xDB, 0x5D, 0xED, 0x35, 0x45, 0x0D, 0x4E, 0x56, 0x7B, 0xBA, 0xA9, 0x3D, 0x00, 0x40,
+	0x73, 0x6C, 0x92, 0xE6, 0x38, 0x42, 0x93, 0x36, 0x55, 0x23, 0x41, 0x6A, 0x32, 0x3D, 0x34, 0x59,
+	0x28, 0x4D, 0xF6, 0x0C, 0x8D, 0x1C, 0xD4, 0xE4, 0xCC, 0xD6, 0xE4, 0xA2, 0x35, 0x79, 0xDE, 0x1A,
+	0x15, 0x46, 0x93, 0x3F, 0x4F, 0x53, 0x00, 0x69, 0x0A, 0x7D, 0x35, 0xDA, 0x2E, 0x0D, 0xF3, 0xA9,
+	0x26, 0xA9, 0x43, 0x93, 0xD8, 0xAE, 0x89, 0x7F, 0xAC, 0x81, 0x5B, 0x35, 0x31, 0x2D, 0x9A, 0xE8,
+	0x47, 0x9A, 0xC8, 0x26, 0x0D, 0xE5, 0x81, 0x26, 0xE2, 0xBE, 0x26, 0xBC, 0x51, 0x13, 0x76, 0x57,
+	0x43, 0xAC, 0xD7, 0x84, 0xD4, 0x69, 0x82, 0xEE, 0x68, 0x02, 0xA9, 0x9A, 0x8E, 0x68, 0x4D, 0x27,
+	0x4D, 0xD3, 0xB3, 0x5E, 0xD3, 0x07, 0x6B, 0x06, 0xE2, 0x34, 0x43, 0x74, 0xCD, 0x48, 0xA2, 0x66,
+	0x8C, 0xA1, 0x99, 0xD8, 0xA4, 0x79, 0xF7, 0x77, 0x09, 0xA0, 0x39, 0xB1, 0x51, 0x23, 0x4A, 0xD0,
+	0x1C, 0x8D, 0xD7, 0x1C, 0xD9, 0xA0, 0x39, 0x14, 0xAB, 0x11, 0xC4, 0x68, 0x0E, 0xAC, 0xD3, 0xEC,
+	0x8F, 0xD2, 0xEC, 0x35, 0x6B, 0x2E, 0xD6, 0x6A, 0x2E, 0x5B, 0x34, 0x57, 0x1A, 0x34, 0x1A, 0xAB,
+	0xA6, 0xE8, 0x9E, 0xA6, 0xD8, 0xA6, 0x29, 0x7D, 0xA8, 0xD1, 0xDB, 0x35, 0x15, 0xCD, 0x9A, 0x4A,
+	0x87, 0xA6, 0xBA, 0x4D, 0x63, 0x72, 0x6A, 0x6A, 0x9E, 0x68, 0x6A, 0x5D, 0x9A, 0xFA, 0x4E, 0x8D,
+	0xD5, 0x4F, 0x43, 0x5A, 0xA0, 0x59, 0x36, 0x5F, 0x13, 0xEA, 0xA3, 0x09, 0x9E, 0xAB, 0xC1, 0xCF,
+	0xD1, 0x04, 0x78, 0x69, 0xFC, 0x67, 0x69, 0xFC, 0x66, 0x6A, 0x20, 0x4F, 0x8D, 0xCF, 0x74, 0x8D,
+	0xF7, 0x34, 0x8D, 0x97, 0xBB, 0x06, 0x9C, 0xA2, 0xF1, 0x9C, 0xAC, 0xF1, 0x70, 0xD3, 0xB8, 0x03,
+	0x80, 0xF6, 0xF8, 0x24, 0x6D, 0x1A, 0x42, 0x2B, 0x99, 0xAA, 0xCD, 0x44, 0x6A, 0xB3, 0x3C, 0xB4,
+	0xD9, 0x28, 0xAD, 0x7C, 0x86, 0x36, 0x07, 0xD4, 0xE6, 0xCE, 0xD6, 0xE6, 0xA1, 0xB5, 0x2A, 0x6F,
+	0x6D, 0x3E, 0x46, 0x5B, 0x30, 0x4F, 0x5B, 0x08, 0x69, 0xB5, 0xBE, 0xDA, 0x92, 0x2E, 0x6D, 0xD2,
+	0x53, 0x6D, 0x62, 0x87, 0x36, 0xBE, 0x5D, 0x0B, 0x3F, 0xD6, 0xC6, 0xB4, 0x6A, 0xA3, 0x5B, 0xB4,
+	0x91, 0x8F, 0xB4, 0x94, 0x26, 0x6D, 0xC4, 0x03, 0x6D, 0xF8, 0x7D, 0x6D, 0x58, 0xA3, 0x96, 0x78,
+	0x57, 0x1B, 0x52, 0xAF, 0x0D, 0xAA, 0xD3, 0x06, 0xDE, 0xD1, 0xE2, 0xA8, 0xDA, 0xCE, 0x68, 0x6D,
+	0x0F, 0x4D, 0xDB, 0xB7, 0x5E, 0x3B, 0x00, 0x6B, 0x87, 0xE2, 0xB4, 0x23, 0x74, 0xED, 0x58, 0xA2,
+	0x76, 0x82, 0xA1, 0x7D, 0xB7, 0x49, 0xFB, 0x91, 0xA9, 0xFD, 0xF2, 0x1F, 0xD7, 0xDF, 0xAC, 0x3D,
+	0x91, 0xA4, 0x15, 0x6D, 0xD4, 0x1E, 0x4D, 0xD0, 0x1E, 0x89, 0xD7, 0x1E, 0xDA, 0xA0, 0x15, 0xC4,
+	0x6A, 0x0F, 0xC4, 0x68, 0xF7, 0xAF, 0xD3, 0xEE, 0x8D, 0xD2, 0x72, 0xCD, 0xDA, 0xCB, 0xB5, 0xDA,
+	0x2B, 0x16, 0xAD, 0xA6, 0x41, 0x5B, 0x64, 0xD5, 0x16, 0xDF, 0xD3, 0x96, 0xDA, 0xB4, 0xFA, 0x87,
+	0xDA, 0x0A, 0xBB, 0xB6, 0xB2, 0x59, 0x5B, 0xED, 0xD0, 0x9A, 0xDA, 0xB4, 0x35, 0x4E, 0x6D, 0xED,
+	0x13, 0x6D, 0xBD, 0x4B, 0x6B, 0xED, 0xD4, 0xDE, 0xF7, 0xD3, 0x2E, 0x5B, 0xA0, 0x0D, 0x9D, 0xAF,
+	0x0D, 0xF6, 0xD1, 0xE2, 0xE7, 0x6A, 0x03, 0xE6, 0x68, 0xFD, 0xBD, 0xB4, 0x7E, 0xB3, 0xB4, 0xD0,
+	0x4C, 0xAD, 0x8F, 0xA7, 0xD6, 0x7B, 0xBA, 0xD6, 0x6B, 0x9A, 0x16, 0x74, 0xD7, 0x7A, 0x4E, 0xD1,
+	0x7A, 0x4C, 0xD6, 0xBA, 0xBB, 0x69, 0x11, 0x00, 0xA0, 0x4B, 0x9B, 0xA4, 0x93, 0x20, 0x74, 0x99,
+	0x53, 0x75, 0x59, 0x48, 0x5D, 0xB6, 0x87, 0x4E, 0x8E, 0xD2, 0xE5, 0xCC, 0xD0, 0xE5, 0x82, 0xBA,
+	0xBC, 0xD9, 0x3A, 0x15, 0x5A, 0x97, 0xEF, 0xAD, 0x2B, 0xC0, 0xE8, 0x0A, 0xE7, 0xE9, 0xB4, 0x90,
+	0xAE, 0xC4, 0x57, 0x57, 0xD6, 0xA5, 0x4B, 0x7C, 0xAA, 0x8B, 0xEF, 0xD0, 0xC1, 0xED, 0xBA, 0x98,
+	0xC7, 0xBA, 0xE8, 0x56, 0x5D, 0x64, 0x8B, 0x8E, 0xF2, 0x48, 0x17, 0xD1, 0xA4, 0x0B, 0x7F, 0xA0,
+	0x0B, 0xBB, 0xAF, 0x23, 0x36, 0xEA, 0x42, 0xEE, 0xEA, 0x82, 0xEA, 0x75, 0x81, 0x75, 0x3A, 0xDC,
+	0x1D, 0xDD, 0x42, 0xAA, 0xAE, 0x27, 0x5A, 0xD7, 0x47, 0xD3, 0x0D, 0xAC, 0xD7, 0x0D, 0xC1, 0xBA,
+	0x91, 0x38, 0xDD, 0x18, 0x5D, 0x37, 0x91, 0xA8, 0x7B, 0xC7, 0xD0, 0x7D, 0xDC, 0xA4, 0xFB, 0xC2,
+	0xD4, 0x7D, 0xFF, 0xCF, 0x07, 0xD0, 0x89, 0x92, 0x74, 0x47, 0x37, 0xEA, 0x8E, 0x24, 0xE8, 0x0E,
+	0xC5, 0xEB, 0x04, 0x1B, 0x74, 0x07, 0x62, 0x75, 0xFB, 0x63, 0x74, 0x7B, 0xD7, 0xE9, 0xB8, 0x51,
+	0xBA, 0x1F, 0xCD, 0xBA, 0x2B, 0xB5, 0x3A, 0x8D, 0x45, 0x57, 0xD4, 0xA0, 0x2B, 0xB6, 0xEA, 0x4A,
+	0xEF, 0xE9, 0xF4, 0x36, 0x5D, 0xC5, 0x43, 0x5D, 0xA5, 0x5D, 0x57, 0xDD, 0xAC, 0x33, 0x39, 0x74,
+	0x35, 0x6D, 0xBA, 0x5A, 0xA7, 0xAE, 0xFE, 0x89, 0xCE, 0xEA, 0xD2, 0xDD, 0xEF, 0xD4, 0x3D, 0xF4,
+	0xD3, 0x85, 0x2E, 0xD0, 0x05, 0xCF, 0xD7, 0xE1, 0x7D, 0x74, 0x01, 0x73, 0x75, 0xFE, 0x73, 0x74,
+	0x7E, 0x5E, 0x3A, 0x68, 0x96, 0xCE, 0x67, 0xA6, 0xCE, 0xDB, 0x53, 0xE7, 0x35, 0x5D, 0x07, 0x4E,
+	0xD3, 0x79, 0xBA, 0xEB, 0x3C, 0xA6, 0xE8, 0xDC, 0x27, 0xEB, 0x10, 0x6E, 0x3A, 0x37, 0x00, 0xD0,
+	0x4B, 0x26, 0xE9, 0x33, 0x11, 0xFA, 0xAC, 0xA9, 0xFA, 0x6C, 0xA4, 0x5E, 0xEE, 0xA1, 0xCF, 0x41,
+	0xE9, 0x73, 0x67, 0xE8, 0xF3, 0x40, 0xBD, 0x6A, 0xB6, 0x3E, 0x1F, 0xAD, 0x2F, 0xF0, 0xD6, 0x17,
+	0x62, 0xF4, 0xDA, 0x79, 0xFA, 0x12, 0x48, 0x5F, 0xE6, 0xAB, 0x2F, 0xEF, 0xD2, 0xC7, 0x3F, 0xD5,
+	0xC3, 0x1D, 0xFA, 0x98, 0x76, 0x7D, 0xF4, 0x63, 0x7D, 0x64, 0xAB, 0x9E, 0xD2, 0xA2, 0x8F, 0x78,
+	0xA4, 0x0F, 0x6F, 0xD2, 0x87, 0x3D, 0xD0, 0x13, 0xEF, 0xEB, 0x43, 0x1A, 0xF5, 0x41, 0x77, 0xF5,
+	0x81, 0xF5, 0x7A, 0x5C, 0x9D, 0x7E, 0xE1, 0x1D, 0xBD, 0x2F, 0x55, 0xDF, 0x17, 0xAD, 0x1F, 0xA0,
+	0xE9, 0x87, 0xD6, 0xEB, 0x47, 0x60, 0xFD, 0x58, 0x9C, 0x7E, 0x82, 0xAE, 0x7F, 0x97, 0xA8, 0xFF,
+	0xC8, 0xD0, 0x7F, 0xD9, 0xA4, 0xFF, 0xCE, 0xD4, 0x4F, 0xDA, 0xA2, 0x9F, 0xF2, 0x1F, 0xD4, 0xFF,
+	0x41, 0x2F, 0xDA, 0xAC, 0x3F, 0x9A, 0xA4, 0x3F, 0xB2, 0x51, 0x7F, 0x28, 0x41, 0x2F, 0x88, 0xD7,
+	0x1F, 0xD8, 0xA0, 0xDF, 0x1F, 0xAB, 0xDF, 0x1B, 0xA3, 0xE7, 0xAE, 0xD3, 0xFF, 0x18, 0xA5, 0xDF,
+	0x61, 0xD6, 0x6B, 0x6A, 0xF5, 0x45, 0x16, 0x7D, 0x71, 0x83, 0xBE, 0xD4, 0xAA, 0xD7, 0xDF, 0xD3,
+	0x57, 0xD8, 0xF4, 0x95, 0x0F, 0xF5, 0xD5, 0x76, 0xBD, 0xA9, 0x59, 0x5F, 0xE3, 0xD0, 0xD7, 0xB6,
+	0xE9, 0xEB, 0x9D, 0x7A, 0xEB, 0x13, 0xFD, 0x7D, 0x97, 0xFE, 0x61, 0xA7, 0xFE, 0x91, 0x9F, 0x3E,
+	0x78, 0x81, 0x1E, 0x3F, 0x5F, 0x1F, 0xE0, 0xA3, 0xF7, 0x9F, 0xAB, 0xF7, 0x9B, 0xA3, 0x87, 0xBC,
+	0xF4, 0x3E, 0xB3, 0xF4, 0xDE, 0x33, 0xF5, 0x5E, 0x9E, 0x7A, 0x70, 0xBA, 0xDE, 0x73, 0x9A, 0xDE,
+	0xC3, 0x5D, 0xEF, 0x3E, 0x45, 0x8F, 0x98, 0xAC, 0x77, 0x73, 0xD3, 0x7F, 0x03, 0x00, 0x43, 0xE6,
+	0x24, 0x43, 0x16, 0xC2, 0x90, 0x3D, 0xD5, 0x20, 0x47, 0x1A, 0x72, 0x3C, 0x0C, 0xB9, 0x28, 0x43,
+	0xDE, 0x0C, 0x83, 0x0A, 0x34, 0xE4, 0xCF, 0x36, 0x14, 0xA0, 0x0D, 0x85, 0xDE, 0x06, 0x2D, 0xC6,
+	0x50, 0x32, 0xCF, 0x50, 0x06, 0x19, 0xCA, 0x7D, 0x0D, 0x86, 0x2E, 0x03, 0xFC, 0xD4, 0x10, 0xD3,
+	0x61, 0x88, 0x6E, 0x37, 0x44, 0x3E, 0x36, 0x50, 0x5A, 0x0D, 0x11, 0x2D, 0x86, 0xF0, 0x47, 0x86,
+	0xB0, 0x26, 0x03, 0xF1, 0x81, 0x21, 0xE4, 0xBE, 0x21, 0xA8, 0xD1, 0x10, 0x78, 0xD7, 0x80, 0xAB,
+	0x37, 0x2C, 0xAC, 0x33, 0xF8, 0xDE, 0x31, 0xCC, 0xA7, 0x1A, 0x06, 0xA2, 0x0D, 0x43, 0x34, 0xC3,
+	0xC8, 0x7A, 0xC3, 0x18, 0x6C, 0x98, 0x88, 0x33, 0xBC, 0xA3, 0x1B, 0x3E, 0x26, 0x1A, 0xBE, 0x30,
+	0x0C, 0xDF, 0x37, 0x19, 0x26, 0x31, 0x0D, 0x53, 0xB6, 0x18, 0x90, 0xFF, 0xC9, 0x00, 0x86, 0xA3,
+	0x9B, 0x0D, 0x47, 0x92, 0x0C, 0x87, 0x36, 0x1A, 0x04, 0x09, 0x86, 0x03, 0xF1, 0x86, 0xFD, 0x1B,
+	0x0C, 0x7B, 0x63, 0x0D, 0xDC, 0x18, 0xC3, 0x8F, 0xEB, 0x0C, 0x3B, 0xA2, 0x0C, 0xDB, 0xCC, 0x86,
+	0xA2, 0x5A, 0x43, 0xB1, 0xC5, 0x50, 0xDA, 0x60, 0xD0, 0x5B, 0x0D, 0x15, 0xF7, 0x0C, 0x95, 0x36,
+	0x43, 0xF5, 0x43, 0x83, 0xC9, 0x6E, 0xA8, 0x69, 0x36, 0xD4, 0x3A, 0x0C, 0xF5, 0x6D, 0x06, 0xAB,
+	0xD3, 0x70, 0xFF, 0x89, 0xE1, 0xA1, 0xCB, 0xF0, 0xA8, 0xD3, 0xE0, 0xF0, 0x33, 0xE0, 0x17, 0x18,
+	0x02, 0xE6, 0x1B, 0xFC, 0x7D, 0x0C, 0x7E, 0x73, 0x0D, 0xD0, 0x1C, 0x83, 0x8F, 0x97, 0xC1, 0x7B,
+	0x96, 0xC1, 0x6B, 0xA6, 0x01, 0xF4, 0x34, 0x78, 0x4E, 0x37, 0x78, 0x4C, 0x33, 0xB8, 0xBB, 0x1B,
+	0x10, 0x53, 0x0C, 0x6E, 0x93, 0x0D, 0xDF, 0xDC, 0x0C, 0x9F, 0x01, 0xC0, 0x98, 0x35, 0xC9, 0x98,
+	0x8D, 0x30, 0xCA, 0xA7, 0x1A, 0x73, 0x90, 0xC6, 0x5C, 0x0F, 0x63, 0x1E, 0xCA, 0xA8, 0x9A, 0x61,
+	0xCC, 0x07, 0x8D, 0x05, 0xB3, 0x8D, 0x85, 0x68, 0xA3, 0xD6, 0xDB, 0x58, 0x82, 0x31, 0x96, 0xCD,
+	0x33, 0x96, 0x43, 0x46, 0x83, 0xAF, 0xB1, 0xAA, 0xCB, 0x18, 0xF3, 0xD4, 0x18, 0xDD, 0x61, 0x8C,
+	0x6C, 0x37, 0x52, 0x1E, 0x1B, 0x23, 0x5A, 0x8D, 0xE1, 0x2D, 0xC6, 0xB0, 0x47, 0x46, 0x62, 0x93,
+	0x31, 0xE4, 0x81, 0x31, 0xE8, 0xBE, 0x31, 0xB0, 0xD1, 0x88, 0xBB, 0x6B, 0x5C, 0x58, 0x6F, 0xF4,
+	0xAD, 0x33, 0xCE, 0xBF, 0x63, 0xC4, 0x50, 0x8D, 0x43, 0xD1, 0xC6, 0x11, 0x9A, 0x71, 0x6C, 0xBD,
+	0x71, 0x02, 0x36, 0xBE, 0x8B, 0x33, 0x7E, 0xA4, 0x1B, 0xBF, 0x24, 0x1A, 0xBF, 0x33, 0x8C, 0x93,
+	0x36, 0x19, 0xA7, 0x30, 0x8D, 0xC8, 0x2D, 0xC6, 0xE9, 0x2C, 0xE3, 0x8C, 0xFF, 0x88, 0x7E, 0xB2,
+	0xF1, 0xE8, 0x0F, 0xC6, 0x23, 0x9B, 0x8D, 0x87, 0x92, 0x8C, 0x82, 0x8D, 0xC6, 0x03, 0x09, 0xC6,
+	0xFD, 0xF1, 0xC6, 0xBD, 0x1B, 0x8C, 0xDC, 0x58, 0xE3, 0x8F, 0x31, 0xC6, 0x1D, 0xEB, 0x8C, 0xDB,
+	0xA2, 0x8C, 0x2C, 0xB3, 0xB1, 0xB8, 0xD6, 0x58, 0x6A, 0x31, 0xEA, 0x1B, 0x8C, 0x15, 0x56, 0x63,
+	0xE5, 0x3D, 0x63, 0xB5, 0xCD, 0x68, 0x7A, 0x68, 0xAC, 0xB1, 0x1B, 0x6B, 0x9B, 0x8D, 0xF5, 0x0E,
+	0xA3, 0xB5, 0xCD, 0x78, 0xDF, 0x69, 0x7C, 0xF8, 0xC4, 0xF8, 0xC8, 0x65, 0x74, 0x74, 0x1A, 0x1F,
+	0xFB, 0x19, 0x03, 0x16, 0x18, 0xFD, 0xE7, 0x1B, 0xFD, 0x7C, 0x8C, 0xD0, 0x5C, 0xA3, 0xCF, 0x1C,
+	0xA3, 0xB7, 0x97, 0xD1, 0x6B, 0x96, 0x11, 0x9C, 0x69, 0xF4, 0xF4, 0x34, 0x7A, 0x4C, 0x37, 0xBA,
+	0x4F, 0x33, 0x22, 0xDC, 0x8D, 0x6E, 0x53, 0x8C, 0xDF, 0x26, 0x1B, 0x3F, 0xBB, 0x19, 0x3F, 0x00,
+	0x80, 0x29, 0x7B, 0x92, 0x49, 0x8E, 0x30, 0xE5, 0x4C, 0x35, 0xE5, 0x22, 0x4D, 0x79, 0x1E, 0x26,
+	0x15, 0xCA, 0x94, 0x3F, 0xC3, 0x54, 0x00, 0x9A, 0x0A, 0x67, 0x9B, 0xB4, 0x68, 0x53, 0x89, 0xB7,
+	0xA9, 0x0C, 0x63, 0x2A, 0x9F, 0x67, 0x32, 0x40, 0xA6, 0x2A, 0x5F, 0xD3, 0x8D, 0x2E, 0x53, 0xF4,
+	0x53, 0x53, 0x64, 0x87, 0x89, 0xD2, 0x6E, 0x8A, 0x78, 0x6C, 0x0A, 0x6F, 0x35, 0x85, 0xB5, 0x98,
+	0x88, 0x8F, 0x4C, 0x21, 0x4D, 0xA6, 0xA0, 0x07, 0xA6, 0xC0, 0xFB, 0x26, 0x5C, 0xA3, 0x69, 0xE1,
+	0x5D, 0x93, 0x6F, 0xBD, 0x69, 0x7E, 0x9D, 0x09, 0x73, 0xC7, 0x34, 0x87, 0x6A, 0x1A, 0x89, 0x36,
+	0x8D, 0xD1, 0x4C, 0x13, 0xEB, 0x4D, 0xEF, 0x60, 0xD3, 0xC7, 0x38, 0xD3, 0x17, 0xBA, 0xE9, 0x7B,
+	0xA2, 0x69, 0x12, 0xC3, 0x34, 0x65, 0x93, 0x09, 0xC9, 0x34, 0x4D, 0xDF, 0x62, 0x9A, 0xC1, 0x32,
+	0xCD, 0x4A, 0x31, 0xA1, 0xFF, 0xCD, 0xFA, 0x5B, 0x4D, 0x47, 0x93, 0x4D, 0x47, 0x7E, 0x30, 0x1D,
+	0xDA, 0x6C, 0x12, 0x24, 0x99, 0x0E, 0x6C, 0x34, 0xED, 0x4F, 0x30, 0xED, 0x8D, 0x37, 0x71, 0x37,
+	0x98, 0x7E, 0x8C, 0x35, 0xED, 0x88, 0x31, 0x6D, 0x5B, 0x67, 0x62, 0x45, 0x99, 0x7E, 0x30, 0x9B,
+	0x4A, 0x6B, 0x4D, 0x7A, 0x8B, 0xA9, 0xA2, 0xC1, 0x54, 0x69, 0x35, 0x55, 0xDF, 0x33, 0x99, 0x6C,
+	0xA6, 0x9A, 0x87, 0xA6, 0x5A, 0xBB, 0xA9, 0xBE, 0xD9, 0x64, 0x75, 0x98, 0xEE, 0xB7, 0x99, 0x1E,
+	0x3A, 0x4D, 0x8F, 0x9E, 0x98, 0x1C, 0x2E, 0xD3, 0xE3, 0x4E, 0xD3, 0x13, 0x3F, 0x93, 0xFF, 0x02,
+	0x93, 0xDF, 0x7C, 0x13, 0xE4, 0x63, 0xF2, 0x99, 0x6B, 0xF2, 0x9E, 0x63, 0xF2, 0xF2, 0x32, 0x81,
+	0xB3, 0x4C, 0x9E, 0x33, 0x4D, 0x1E, 0x9E, 0x26, 0xF7, 0xE9, 0x26, 0xC4, 0x34, 0x93, 0x9B, 0xBB,
+	0xE9, 0xDB, 0x14, 0xD3, 0xE7, 0xC9, 0xA6, 0x0F, 0x6E, 0xA6, 0xB7, 0xC0, 0x77, 0xF3, 0xC1, 0xAF,
+	0x66, 0xFE, 0x67, 0xF3, 0xBE, 0x8F, 0xE6, 0x3D, 0xEF, 0xCD, 0xBB, 0xDF, 0x9A, 0x39, 0x13, 0xE6,
+	0xED, 0xE3, 0xE6, 0x94, 0x57, 0xE6, 0xE4, 0x11, 0x33, 0x73, 0xD8, 0x9C, 0xF4, 0xC2, 0x9C, 0x38,
+	0x60, 0x8E, 0xEF, 0x37, 0xC3, 0xCF, 0xCC, 0x31, 0x3D, 0xE6, 0x68, 0xAC, 0xD9, 0xEC, 0x6F, 0xAE,
+	0xC3, 0x99, 0x1B, 0x16, 0x9B, 0x1B, 0xF1, 0x66, 0x5B, 0x90, 0xB9, 0x89, 0x60, 0x6E, 0x0E, 0x35,
+	0xB7, 0x12, 0xCD, 0xCE, 0xE5, 0xE6, 0x0E, 0x92, 0xB9, 0x33, 0xDC, 0xDC, 0x43, 0x36, 0xF7, 0xAD,
+	0x32, 0x0F, 0x50, 0xCC, 0x43, 0x6B, 0xCD, 0x23, 0x35, 0xE6, 0x99, 0xB7, 0xCC, 0xA8, 0x9B, 0xE6,
+	0x69, 0xD5, 0xE6, 0xA9, 0x55, 0xE6, 0xC9, 0xD7, 0xCD, 0x40, 0x85, 0xF9, 0x6B, 0xB9, 0xF9, 0xD3,
+	0x55, 0xF3, 0xFB, 0x52, 0xF3, 0x9B, 0x12, 0xF3, 0xF8, 0x5F, 0xE6, 0xD1, 0x22, 0xF3, 0x70, 0xA1,
+	0x79, 0xF0, 0x0F, 0x73, 0xFF, 0xBF, 0xEF, 0x3F, 0xC0, 0xFC, 0xDB, 0x9F, 0xE6, 0xDF, 0xB5, 0x66,
+	0x59, 0xB1, 0xF9, 0xB4, 0xCE, 0x7C, 0xB6, 0xCC, 0x7C, 0x4E, 0x6F, 0x56, 0x5E, 0x33, 0x5F, 0x34,
+	0x98, 0x2F, 0x57, 0x9A, 0xAF, 0x18, 0xCD, 0x9A, 0x1B, 0xE6, 0x22, 0x93, 0xB9, 0xF8, 0xB6, 0xB9,
+	0x34, 0xD2, 0xBC, 0x71, 0x8D, 0x99, 0xBE, 0xDA, 0xBC, 0x21, 0xC2, 0xBC, 0x7E, 0xA5, 0x79, 0xDD,
+	0x0A, 0x33, 0x35, 0xCC, 0xBC, 0x66, 0x99, 0x79, 0xD5, 0x52, 0xF3, 0xCA, 0x10, 0x33, 0x29, 0xD8,
+	0xBC, 0x6C, 0x89, 0x39, 0x34, 0xD0, 0x1C, 0x1C, 0x60, 0xC6, 0x2F, 0x32, 0x07, 0x2C, 0x34, 0xFB,
+	0x77, 0x9B, 0xBB, 0x7B, 0xCD, 0xCF, 0xFA, 0xCC, 0xCF, 0x9F, 0x9B, 0x5F, 0x0C, 0x9A, 0x5F, 0x0E,
+	0x99, 0x5F, 0xBD, 0x34, 0xBF, 0x1E, 0x35, 0xBF, 0x1D, 0x33, 0x7F, 0x78, 0x6D, 0xFE, 0xFC, 0xC6,
+	0xFC, 0xED, 0x9D, 0xD9, 0xED, 0x83, 0x19, 0xF1, 0xC9, 0xEC, 0xFE, 0xC5, 0xEC, 0xF1, 0xCD, 0xEC,
+	0x09, 0x7C, 0xB7, 0xF0, 0xBF, 0x5A, 0xF6, 0x7D, 0xB6, 0xEC, 0xF9, 0x68, 0xD9, 0xFD, 0xDE, 0xC2,
+	0x79, 0x6B, 0xD9, 0x3E, 0x61, 0x49, 0x19, 0xB7, 0x24, 0xBF, 0xB2, 0x30, 0x47, 0x2C, 0x49, 0xC3,
+	0x96, 0xC4, 0x17, 0x96, 0xF8, 0x01, 0x0B, 0xDC, 0x6F, 0x89, 0x79, 0x66, 0x89, 0xEE, 0xB1, 0x44,
+	0x62, 0x2D, 0x75, 0xFE, 0x96, 0x06, 0x9C, 0xA5, 0x71, 0xB1, 0xC5, 0x86, 0xB7, 0x34, 0x05, 0x59,
+	0x9A, 0x09, 0x96, 0xD6, 0x50, 0x8B, 0x93, 0x68, 0xE9, 0x58, 0x6E, 0xE9, 0x24, 0x59, 0x7A, 0xC2,
+	0x2D, 0x7D, 0x64, 0xCB, 0xC0, 0x2A, 0xCB, 0x10, 0xC5, 0x32, 0xB2, 0xD6, 0x32, 0x56, 0x63, 0x41,
+	0xDD, 0xB2, 0x4C, 0xBB, 0x69, 0x99, 0x5A, 0x6D, 0x99, 0x5C, 0x65, 0x01, 0xAE, 0x5B, 0xBE, 0x56,
+	0x58, 0x3E, 0x95, 0x5B, 0xDE, 0x5F, 0xB5, 0xBC, 0x29, 0xB5, 0x8C, 0x97, 0x58, 0x46, 0xFF, 0xB2,
+	0x0C, 0x17, 0x59, 0x06, 0x0B, 0x2D, 0xFD, 0x7F, 0x58, 0x7A, 0xAF, 0x58, 0xBA, 0xFE, 0x0D, 0xFA,
+	0x05, 0x96, 0xDF, 0x34, 0x96, 0xDF, 0xFF, 0xB4, 0xC8, 0xB4, 0x96, 0xD3, 0xC5, 0x96, 0xB3, 0x3A,
+	0xCB, 0xB9, 0x32, 0x8B, 0x52, 0x6F, 0xB9, 0x78, 0xCD, 0x72, 0xD9, 0x60, 0xB9, 0x52, 0x69, 0xD1,
+	0x18, 0x2D, 0x45, 0x37, 0x2C, 0xC5, 0x26, 0x4B, 0xE9, 0x6D, 0x8B, 0x3E, 0xD2, 0x42, 0x5F, 0x63,
+	0xD9, 0xB0, 0xDA, 0xB2, 0x3E, 0xC2, 0xB2, 0x6E, 0xA5, 0x85, 0xBA, 0xC2, 0xB2, 0x26, 0xCC, 0xB2,
+	0x6A, 0x99, 0x65, 0xE5, 0x52, 0x0B, 0x29, 0xC4, 0xB2, 0x2C, 0xD8, 0x12, 0xBA, 0xC4, 0x12, 0x1C,
+	0x68, 0xC1, 0x07, 0x58, 0x02, 0x16, 0x59, 0xFC, 0x17, 0x5A, 0xFC, 0xBA, 0x2D, 0xCF, 0x7A, 0x2D,
+	0xCF, 0xFB, 0x2C, 0x2F, 0x9E, 0x5B, 0x5E, 0x0E, 0x5A, 0x5E, 0x0D, 0x59, 0x5E, 0xBF, 0xB4, 0xBC,
+	0x1D, 0xB5, 0x7C, 0x18, 0xB3, 0x7C, 0x7E, 0x6D, 0xF9, 0xF6, 0xC6, 0xE2, 0xF6, 0xCE, 0x82, 0xF8,
+	0x60, 0x71, 0xFF, 0x64, 0xF1, 0xF8, 0x62, 0xF1, 0xFC, 0x66, 0x01, 0x81, 0xEF, 0xD6, 0x7D, 0x5F,
+	0xAD, 0x7B, 0x3E, 0x5B, 0x77, 0x7F, 0xB4, 0x72, 0xDE, 0x5B, 0xB7, 0xBF, 0xB5, 0xA6, 0x4C, 0x58,
+	0x93, 0xC7, 0xAD, 0xCC, 0x57, 0xD6, 0xA4, 0x11, 0x6B, 0xE2, 0xB0, 0x35, 0xFE, 0x85, 0x15, 0x1E,
+	0xB0, 0xC6, 0xF4, 0x5B, 0xA3, 0x9F, 0x59, 0x23, 0x7B, 0xAC, 0x14, 0xAC, 0xB5, 0xC1, 0xDF, 0xDA,
+	0x88, 0xB3, 0xDA, 0x16, 0x5B, 0x9B, 0xF0, 0xD6, 0xE6, 0x20, 0x6B, 0x2B, 0xC1, 0xEA, 0x0C, 0xB5,
+	0x76, 0x10, 0xAD, 0x9D, 0xCB, 0xAD, 0x3D, 0x24, 0x6B, 0x5F, 0xB8, 0x75, 0x80, 0x6C, 0x1D, 0x5A,
+	0x65, 0x1D, 0xA1, 0x58, 0xC7, 0xD6, 0x5A, 0x27, 0x6A, 0xAC, 0xD3, 0x6E, 0x59, 0xA7, 0xDE, 0xB4,
+	0x4E, 0xAE, 0xB6, 0x02, 0x55, 0xD6, 0xAF, 0xD7, 0xAD, 0x9F, 0x2A, 0xAC, 0xEF, 0xCB, 0xAD, 0x6F,
+	0xAE, 0x5A, 0xC7, 0x4B, 0xAD, 0xA3, 0x25, 0xD6, 0xE1, 0xBF, 0xAC, 0x83, 0x45, 0xD6, 0xFE, 0x42,
+	0x6B, 0xEF, 0x1F, 0xD6, 0xAE, 0x2B, 0x56, 0x17, 0xC7, 0xBA, 0xF8, 0x7F, 0x54, 0x5F, 0x6D, 0xFD,
+	0xAD, 0xC0, 0xFA, 0xBB, 0xC6, 0x2A, 0xFB, 0xD3, 0x7A, 0x5A, 0x6B, 0x3D, 0x5B, 0x6C, 0x3D, 0xA7,
+	0xB3, 0x2A, 0xCB, 0xAC, 0x17, 0xF5, 0xD6, 0xCB, 0xD7, 0xAC, 0x57, 0x0C, 0x56, 0x4D, 0xA5, 0xB5,
+	0xC8, 0x68, 0x2D, 0xBE, 0x61, 0x2D, 0x35, 0x59, 0xF5, 0xB7, 0xAD, 0x15, 0x91, 0xD6, 0x0D, 0x6B,
+	0xAC, 0xEB, 0x57, 0x5B, 0xD7, 0x45, 0x58, 0xA9, 0x2B, 0xAD, 0x6B, 0x56, 0x58, 0x57, 0x85, 0x59,
+	0x57, 0x2E, 0xB3, 0x92, 0x96, 0x5A, 0x97, 0x85, 0x58, 0x43, 0x83, 0xAD, 0xC1, 0x4B, 0xAC, 0xF8,
+	0x40, 0x6B, 0x40, 0x80, 0xD5, 0x7F, 0x91, 0xD5, 0x6F, 0xA1, 0x15, 0xEA, 0xB6, 0x3E, 0xEF, 0xB5,
+	0xBE, 0xE8, 0xB3, 0xBE, 0x7C, 0x6E, 0x7D, 0x35, 0x68, 0x7D, 0x3D, 0x64, 0x7D, 0xFB, 0xD2, 0xFA,
+	0x61, 0xD4, 0xFA, 0x79, 0xCC, 0xFA, 0xED, 0xB5, 0xD5, 0xED, 0x8D, 0x15, 0xF1, 0xCE, 0xEA, 0xFE,
+	0xC1, 0xEA, 0xF1, 0xC9, 0xEA, 0xF9, 0xC5, 0x0A, 0x7E, 0xB3, 0x7A, 0x01, 0xDF, 0x6D, 0x7B, 0xBE,
+	0xDA, 0x76, 0x7F, 0xB6, 0x71, 0x3E, 0xDA, 0xB6, 0xBF, 0xB7, 0xA5, 0xBC, 0xB5, 0x25, 0x4F, 0xD8,
+	0x98, 0xE3, 0xB6, 0xA4, 0x57, 0xB6, 0xC4, 0x11, 0x5B, 0xFC, 0xB0, 0x0D, 0x7E, 0x61, 0x8B, 0x19,
+	0xB0, 0x45, 0xF7, 0xDB, 0x22, 0x9F, 0xD9, 0x28, 0x3D, 0xB6, 0x08, 0xAC, 0xAD, 0xD1, 0xDF, 0x66,
+	0xC3, 0xD9, 0x9A, 0x16, 0xDB, 0x9A, 0xF1, 0xB6, 0xD6, 0x20, 0x9B, 0x93, 0x60, 0xEB, 0x08, 0xB5,
+	0x75, 0x12, 0x6D, 0x3D, 0xCB, 0x6D, 0x7D, 0x24, 0xDB, 0x40, 0xB8, 0x6D, 0x88, 0x6C, 0x1B, 0x59,
+	0x65, 0x1B, 0xA3, 0xD8, 0x26, 0xD6, 0xDA, 0xDE, 0xD5, 0xD8, 0xA6, 0xDE, 0xB2, 0x4D, 0xBE, 0x69,
+	0x03, 0xAA, 0x6D, 0x5F, 0xAB, 0x6C, 0x9F, 0xAE, 0xDB, 0xDE, 0x57, 0xD8, 0xDE, 0x94, 0xDB, 0xC6,
+	0xAF, 0xDA, 0x46, 0x4B, 0x6D, 0xC3, 0x25, 0xB6, 0xC1, 0xBF, 0x6C, 0xFD, 0x45, 0xB6, 0xDE, 0x42,
+	0x5B, 0xD7, 0x1F, 0x36, 0xD7, 0x15, 0x5B, 0x3B, 0xC7, 0xB6, 0x64, 0x97, 0x8D, 0xF0, 0x3F, 0xA4,
+	0xFF, 0xA3, 0xED, 0xA8, 0xDA, 0xF6, 0x7B, 0x81, 0x4D, 0xA6, 0xB1, 0x9D, 0xFE, 0xD3, 0x76, 0x56,
+	0x6B, 0x3B, 0x57, 0x6C, 0x53, 0xEA, 0x6C, 0x17, 0xCB, 0x6C, 0x97, 0xF5, 0xB6, 0x2B, 0xD7, 0x6C,
+	0x1A, 0x83, 0xAD, 0xA8, 0xD2, 0x56, 0x6C, 0xB4, 0x95, 0xDE, 0xB0, 0xE9, 0x4D, 0xB6, 0x8A, 0xDB,
+	0xB6, 0xCA, 0x48, 0xDB, 0xFA, 0x35, 0xB6, 0x75, 0xAB, 0x6D, 0xD4, 0x08, 0xDB, 0x9A, 0x95, 0xB6,
+	0x55, 0x2B, 0x6C, 0x2B, 0xC3, 0x6C, 0xA4, 0x65, 0xB6, 0x65, 0x4B, 0x6D, 0xA1, 0x21, 0xB6, 0xE0,
+	0x60, 0x1B, 0x7E, 0x89, 0x2D, 0x20, 0xD0, 0xE6, 0x1F, 0x60, 0xF3, 0x5B, 0x64, 0x83, 0x16, 0xDA,
+	0x7C, 0xBA, 0x6D, 0x2F, 0x7A, 0x6D, 0x2F, 0xFB, 0x6C, 0xAF, 0x9E, 0xDB, 0x5E, 0x0F, 0xDA, 0xDE,
+	0x0E, 0xD9, 0x3E, 0xBC, 0xB4, 0x7D, 0x1E, 0xB5, 0x7D, 0x1B, 0xB3, 0xB9, 0xBD, 0xB6, 0x21, 0xDE,
+	0xD8, 0xDC, 0xDF, 0xD9, 0x3C, 0x3E, 0xD8, 0x3C, 0x3F, 0xD9, 0xC0, 0x2F, 0x36, 0xAF, 0x6F, 0x36,
+	0x6F, 0xE0, 0xBB, 0x7D, 0xF7, 0x57, 0x3B, 0xE7, 0xB3, 0x7D, 0xFB, 0x47, 0x7B, 0xCA, 0x7B, 0x7B,
+	0xF2, 0x5B, 0x3B, 0x73, 0xC2, 0x9E, 0x34, 0x6E, 0x4F, 0x7C, 0x65, 0x8F, 0x1F, 0xB1, 0xC3, 0xC3,
+	0xF6, 0x98, 0x17, 0xF6, 0xE8, 0x01, 0x7B, 0x64, 0xBF, 0x9D, 0xF2, 0xCC, 0x1E, 0xD1, 0x63, 0x0F,
+	0xC7, 0xDA, 0x6D, 0xFE, 0xF6, 0x26, 0x9C, 0xBD, 0x79, 0xB1, 0xBD, 0x15, 0x6F, 0x77, 0x06, 0xD9,
+	0x3B, 0x08, 0xF6, 0xCE, 0x50, 0x7B, 0x0F, 0xD1, 0xDE, 0xB7, 0xDC, 0x3E, 0x40, 0xB2, 0x0F, 0x85,
+	0xDB, 0x47, 0xC8, 0xF6, 0xB1, 0x55, 0xF6, 0x09, 0x8A, 0xFD, 0xDD, 0x5A, 0xFB, 0xC7, 0x1A, 0xFB,
+	0xE4, 0x5B, 0x76, 0xE0, 0xA6, 0xFD, 0x6B, 0xB5, 0xFD, 0x53, 0x95, 0xFD, 0xFD, 0x75, 0xFB, 0x9B,
+	0x0A, 0xFB, 0x78, 0xB9, 0x7D, 0xF4, 0xAA, 0x7D, 0xB8, 0xD4, 0x3E, 0x58, 0x62, 0xEF, 0xFF, 0xCB,
+	0xDE, 0x5B, 0x64, 0xEF, 0x2A, 0xB4, 0xBB, 0xFE, 0xB0, 0xB7, 0x5F, 0xB1, 0xB7, 0x71, 0xEC, 0x84,
+	0x5D, 0xF6, 0xA5, 0x5C, 0xFB, 0xF2, 0xFF, 0x76, 0xFD, 0xDD, 0xF6, 0xA3, 0x3F, 0xDA, 0x8F, 0xA8,
+	0xED, 0xB2, 0x02, 0xFB, 0x69, 0x8D, 0xFD, 0xEC, 0x9F, 0xF6, 0x73, 0x5A, 0xBB, 0xB2, 0xD8, 0x7E,
+	0x51, 0x67, 0xBF, 0x5C, 0x66, 0xBF, 0xA2, 0xB7, 0x6B, 0xAE, 0xD9, 0x8B, 0x0C, 0xF6, 0xE2, 0x4A,
+	0x7B, 0xA9, 0xD1, 0xAE, 0xBF, 0x61, 0xAF, 0x30, 0xD9, 0x2B, 0x6F, 0xDB, 0xAB, 0x23, 0xED, 0xEB,
+	0xD6, 0xD8, 0xA9, 0xAB, 0xED, 0x6B, 0x22, 0xEC, 0xAB, 0x56, 0xDA, 0x57, 0xAE, 0xB0, 0x93, 0xC2,
+	0xEC, 0xCB, 0x96, 0xD9, 0x43, 0x97, 0xDA, 0x83, 0x43, 0xEC, 0xF8, 0x60, 0x7B, 0xC0, 0x12, 0xBB,
+	0x7F, 0xA0, 0xDD, 0x2F, 0xC0, 0x0E, 0x2D, 0xB2, 0xFB, 0x2C, 0xB4, 0x7B, 0x77, 0xDB, 0x5F, 0xF6,
+	0xDA, 0x5F, 0xF5, 0xD9, 0x5F, 0x3F, 0xB7, 0xBF, 0x1D, 0xB4, 0x7F, 0x18, 0xB2, 0x7F, 0x7E, 0x69,
+	0xFF, 0x36, 0x6A, 0x77, 0x1B, 0xB3, 0x23, 0x5E, 0xDB, 0xDD, 0xDF, 0xD8, 0x3D, 0xDE, 0xD9, 0x3D,
+	0x3F, 0xD8, 0xC1, 0x4F, 0x76, 0xAF, 0x2F, 0x76, 0xEF, 0x6F, 0x76, 0x1F, 0xE0, 0xBB, 0x83, 0xF3,
+	0xD5, 0xB1, 0xFD, 0xB3, 0x23, 0xE5, 0xA3, 0x23, 0xF9, 0xBD, 0x83, 0xF9, 0xD6, 0x91, 0x34, 0xE1,
+	0x48, 0x1C, 0x77, 0xC4, 0xBF, 0x72, 0xC0, 0x23, 0x8E, 0x98, 0x61, 0x47, 0xF4, 0x0B, 0x47, 0xE4,
+	0x80, 0x83, 0xD2, 0xEF, 0x88, 0x78, 0xE6, 0x08, 0xEF, 0x71, 0x84, 0x61, 0x1D, 0x4D, 0xFE, 0x8E,
+	0x66, 0x9C, 0xA3, 0x75, 0xB1, 0xC3, 0x89, 0x77, 0x74, 0x04, 0x39, 0x3A, 0x09, 0x8E, 0x9E, 0x50,
+	0x47, 0x1F, 0xD1, 0x31, 0xB0, 0xDC, 0x31, 0x44, 0x72, 0x8C, 0x84, 0x3B, 0xC6, 0xC8, 0x8E, 0x89,
+	0x55, 0x8E, 0x77, 0x14, 0xC7, 0xC7, 0xB5, 0x8E, 0x2F, 0x35, 0x0E, 0xE0, 0x96, 0xE3, 0xEB, 0x4D,
+	0xC7, 0xA7, 0x6A, 0xC7, 0xFB, 0x2A, 0xC7, 0x9B, 0xEB, 0x8E, 0xF1, 0x0A, 0xC7, 0x68, 0xB9, 0x63,
+	0xF8, 0xAA, 0x63, 0xB0, 0xD4, 0xD1, 0x5F, 0xE2, 0xE8, 0xFD, 0xCB, 0xD1, 0x55, 0xE4, 0x70, 0x15,
+	0x3A, 0xDA, 0xFF, 0x70, 0xB4, 0x5D, 0x71, 0xB4, 0x70, 0x1C, 0x4B, 0x77, 0x39, 0x96, 0x73, 0x1D,
+	0x2B, 0xF6, 0x38, 0xC8, 0x3C, 0xC7, 0xEA, 0xFF, 0x16, 0xFA, 0xBD, 0x0E, 0xD1, 0x4F, 0x8E, 0xA3,
+	0xBB, 0x1D, 0x47, 0x7E, 0x74, 0x1C, 0x52, 0x3B, 0x4E, 0x17, 0x38, 0xCE, 0x6A, 0x1C, 0xE7, 0xFE,
+	0x74, 0x28, 0xB5, 0x8E, 0x8B, 0xC5, 0x8E, 0xCB, 0x3A, 0xC7, 0x95, 0x32, 0x87, 0x46, 0xEF, 0x28,
+	0xBA, 0xE6, 0x28, 0x36, 0x38, 0x4A, 0x2B, 0x1D, 0x7A, 0xA3, 0xA3, 0xE2, 0x86, 0xA3, 0xD2, 0xE4,
+	0xA8, 0xBE, 0xED, 0x30, 0x45, 0x3A, 0xA8, 0x6B, 0x1C, 0x6B, 0x56, 0x3B, 0x56, 0x45, 0x38, 0x56,
+	0xAE, 0x74, 0x90, 0x56, 0x38, 0x96, 0x85, 0x39, 0x42, 0x97, 0x39, 0x82, 0x97, 0x3A, 0xF0, 0x21,
+	0x8E, 0x80, 0x60, 0x87, 0xFF, 0x12, 0x87, 0x5F, 0xA0, 0x03, 0x0A, 0x70, 0xF8, 0x2C, 0x72, 0x78,
+	0x2F, 0x74, 0x78, 0x75, 0x3B, 0x5E, 0xF5, 0x3A, 0x5E, 0xF7, 0x39, 0xDE, 0x3E, 0x77, 0x7C, 0x18,
+	0x74, 0x7C, 0x1E, 0x72, 0x7C, 0x7B, 0xE9, 0x70, 0x1B, 0x75, 0x20, 0xC6, 0x1C, 0xEE, 0xAF, 0x1D,
+	0x1E, 0x6F, 0x1C, 0x9E, 0xEF, 0x1C, 0xE0, 0x07, 0x87, 0xD7, 0x27, 0x87, 0xF7, 0x17, 0x87, 0xCF,
+	0x37, 0x07, 0x04, 0x7C, 0x77, 0x6E, 0xFF, 0xEA, 0x4C, 0xF9, 0xEC, 0x4C, 0xFE, 0xE8, 0x64, 0xBE,
+	0x77, 0x26, 0xBD, 0x75, 0x26, 0x4E, 0x38, 0xE3, 0xC7, 0x9D, 0xF0, 0x2B, 0x67, 0xCC, 0x88, 0x33,
+	0x7A, 0xD8, 0x19, 0xF9, 0xC2, 0x49, 0x19, 0x70, 0x46, 0xF4, 0x3B, 0xC3, 0x9F, 0x39, 0xC3, 0x7A,
+	0x9C, 0x44, 0xAC, 0xB3, 0xD9, 0xDF, 0xD9, 0x8A, 0x73, 0x3A, 0x17, 0x3B, 0x3B, 0xF0, 0xCE, 0xCE,
+	0x20, 0x67, 0x0F, 0xC1, 0xD9, 0x17, 0xEA, 0x1C, 0x20, 0x3A, 0x87, 0x96, 0x3B, 0x47, 0x48, 0xCE,
+	0xB1, 0x70, 0xE7, 0x04, 0xD9, 0xF9, 0x6E, 0x95, 0xF3, 0x23, 0xC5, 0xF9, 0x65, 0xAD, 0xF3, 0x7B,
+	0x8D, 0xF3, 0xEB, 0x2D, 0xE7, 0xA7, 0x9B, 0xCE, 0xF7, 0xD5, 0xCE, 0x37, 0x55, 0xCE, 0xF1, 0xEB,
+	0xCE, 0xD1, 0x0A, 0xE7, 0x70, 0xB9, 0x73, 0xF0, 0xAA, 0xB3, 0xBF, 0xD4, 0xD9, 0x5B, 0xE2, 0xEC,
+	0xFA, 0xCB, 0xE9, 0x2A, 0x72, 0xB6, 0x17, 0x3A, 0xDB, 0xFE, 0x70, 0xB6, 0x5C, 0x71, 0xDA, 0x39,
+	0xCE, 0xE5, 0xBB, 0x9C, 0x2B, 0xB8, 0x4E, 0xF2, 0x1E, 0xE7, 0x6A, 0x9E, 0x73, 0xED, 0x7E, 0x67,
+	0x14, 0xDF, 0x49, 0xFB, 0x7F, 0xA6, 0xFF, 0xD9, 0x79, 0x62, 0x9F, 0x53, 0xB4, 0xD7, 0x79, 0xF4,
+	0x27, 0xE7, 0x91, 0xDD, 0xCE, 0x43, 0x3F, 0x3A, 0x05, 0x6A, 0xE7, 0xD9, 0x02, 0xE7, 0x39, 0x8D,
+	0x53, 0xF9, 0xA7, 0xF3, 0xA2, 0xD6, 0x79, 0xB9, 0xD8, 0x79, 0x45, 0xE7, 0xD4, 0x94, 0x39, 0x8B,
+	0xF4, 0xCE, 0xE2, 0x6B, 0xCE, 0x52, 0x83, 0x53, 0x5F, 0xE9, 0xAC, 0x30, 0x3A, 0x2B, 0x6F, 0x38,
+	0xAB, 0x4D, 0x4E, 0xD3, 0x6D, 0x67, 0x4D, 0xA4, 0x73, 0xCD, 0x1A, 0xE7, 0xAA, 0xD5, 0xCE, 0x95,
+	0x11, 0x4E, 0xD2, 0x4A, 0xE7, 0xB2, 0x15, 0xCE, 0xD0, 0x30, 0x67, 0xF0, 0x32, 0x27, 0x7E, 0xA9,
+	0x33, 0x20, 0xC4, 0xE9, 0x1F, 0xEC, 0xF4, 0x5B, 0xE2, 0x84, 0x02, 0x9D, 0x3E, 0x01, 0x4E, 0xEF,
+	0x45, 0x4E, 0xAF, 0x85, 0x4E, 0xB0, 0xDB, 0xF9, 0xBA, 0xD7, 0xF9, 0xB6, 0xCF, 0xF9, 0xE1, 0xB9,
+	0xF3, 0xF3, 0xA0, 0xF3, 0xDB, 0x90, 0xD3, 0xED, 0xA5, 0x13, 0x31, 0xEA, 0x74, 0x1F, 0x73, 0x7A,
+	0xBC, 0x76, 0x7A, 0xBE, 0x71, 0x82, 0xEF, 0x9C, 0x5E, 0x1F, 0x9C, 0xDE, 0x9F, 0x9C, 0x3E, 0x5F,
+	0x9C, 0xD0, 0x37, 0xA7, 0x1F, 0xF0, 0xDD, 0x95, 0xF2, 0xD5, 0x95, 0xFC, 0xD9, 0xC5, 0xFC, 0xE8,
+	0x4A, 0x7A, 0xEF, 0x4A, 0x7C, 0xEB, 0x8A, 0x9F, 0x70, 0xC1, 0xE3, 0xAE, 0x98, 0x57, 0xAE, 0xE8,
+	0x11, 0x57, 0xE4, 0xB0, 0x8B, 0xF2, 0xC2, 0x15, 0x31, 0xE0, 0x0A, 0xEF, 0x77, 0x85, 0x3D, 0x73,
+	0x11, 0x7B, 0x5C, 0x21, 0x58, 0x57, 0xAB, 0xBF, 0xCB, 0x89, 0x73, 0x75, 0x2C, 0x76, 0x75, 0xE2,
+	0x5D, 0x3D, 0x41, 0xAE, 0x3E, 0x82, 0x6B, 0x20, 0xD4, 0x35, 0x44, 0x74, 0x8D, 0x2C, 0x77, 0x8D,
+	0x91, 0x5C, 0x13, 0xE1, 0xAE, 0x77, 0x64, 0xD7, 0xC7, 0x55, 0xAE, 0x2F, 0x14, 0xD7, 0xF7, 0xB5,
+	0xAE, 0x49, 0x35, 0xAE, 0x4F, 0xB7, 0x5C, 0xEF, 0x6F, 0xBA, 0xDE, 0x54, 0xBB, 0xC6, 0xAB, 0x5C,
+	0xA3, 0xD7, 0x5D, 0xC3, 0x15, 0xAE, 0xC1, 0x72, 0x57, 0xFF, 0x55, 0x57, 0x6F, 0xA9, 0xAB, 0xAB,
+	0xC4, 0xE5, 0xFA, 0xCB, 0xD5, 0x5E, 0xE4, 0x6A, 0x2B, 0x74, 0xB5, 0xFC, 0xE1, 0xB2, 0x5F, 0x71,
+	0x3D, 0xE0, 0xB8, 0x56, 0xEC, 0x72, 0x91, 0xB9, 0xAE, 0xD5, 0x7B, 0x5C, 0x6B, 0x79, 0xAE, 0xA8,
+	0xFD, 0x2E, 0x1A, 0xDF, 0x15, 0xFB, 0x0F, 0x57, 0x9C, 0xC0, 0x95, 0xF0, 0x8B, 0x8B, 0xF1, 0x7F,
+	0xE9, 0xFE, 0x4F, 0x57, 0xC6, 0x41, 0x57, 0xFA, 0x01, 0xD7, 0x89, 0x9F, 0x5D, 0xA2, 0x7D, 0xAE,
+	0xA3, 0x7B, 0x5D, 0x47, 0x7E, 0x72, 0x1D, 0xDA, 0xED, 0x12, 0xFC, 0xE8, 0x3A, 0xA0, 0x76, 0x9D,
+	0x2B, 0x70, 0x29, 0x35, 0xAE, 0x8B, 0x7F, 0xBA, 0x2E, 0x6B, 0x5D, 0x57, 0x8A, 0x5D, 0x1A, 0x9D,
+	0xAB, 0xA8, 0xCC, 0x55, 0xAC, 0x77, 0x95, 0x5E, 0x73, 0xE9, 0x0D, 0xAE, 0x8A, 0x4A, 0x57, 0xA5,
+	0xD1, 0x55, 0x7D, 0xC3, 0x65, 0x32, 0xB9, 0x6A, 0x6E, 0xBB, 0x6A, 0x23, 0x5D, 0xAB, 0xD6, 0xB8,
+	0x56, 0xAE, 0x76, 0x91, 0x22, 0x5C, 0xCB, 0x56, 0xBA, 0x42, 0x57, 0xB8, 0x82, 0xC3, 0x5C, 0xF8,
+	0x65, 0xAE, 0x80, 0xA5, 0x2E, 0xFF, 0x10, 0x97, 0x5F, 0xB0, 0x0B, 0x5A, 0xE2, 0xF2, 0x09, 0x74,
+	0x79, 0x07, 0xB8, 0xBC, 0x16, 0xB9, 0xC0, 0x85, 0x2E, 0xCF, 0x6E, 0xD7, 0xDB, 0x5E, 0xD7, 0x87,
+	0x3E, 0xD7, 0xE7, 0xE7, 0xAE, 0x6F, 0x83, 0x2E, 0xB7, 0x21, 0x17, 0xE2, 0xA5, 0xCB, 0x7D, 0xD4,
+	0xE5, 0x31, 0xE6, 0xF2, 0x7C, 0xED, 0x02, 0xDF, 0xB8, 0xBC, 0xDE, 0xB9, 0xBC, 0x3F, 0xB8, 0x7C,
+	0x3E, 0xB9, 0xA0, 0x2F, 0x2E, 0xBF, 0x6F, 0x2E, 0x7F, 0xE0, 0x7B, 0x77, 0xF2, 0xD7, 0x6E, 0xE6,
+	0xE7, 0xEE, 0xA4, 0x8F, 0xDD, 0x89, 0xEF, 0xBB, 0xE3, 0xDF, 0x76, 0xC3, 0x13, 0xDD, 0x31, 0xE3,
+	0xDD, 0xD1, 0xAF, 0xBA, 0x23, 0x47, 0xBA, 0x29, 0xC3, 0xDD, 0x11, 0x2F, 0xBA, 0xC3, 0x07, 0xBA,
+	0xC3, 0xFA, 0xBB, 0x89, 0xCF, 0xBA, 0x43, 0x7A, 0xBA, 0x83, 0xB0, 0xDD, 0x4E, 0xFF, 0xEE, 0x0E,
+	0x5C, 0x77, 0xE7, 0xE2, 0xEE, 0x1E, 0x7C, 0x77, 0x5F, 0x50, 0xF7, 0x00, 0xA1, 0x7B, 0x28, 0xB4,
+	0x7B, 0x84, 0xD8, 0x3D, 0xB6, 0xBC, 0x7B, 0x82, 0xD4, 0xFD, 0x2E, 0xBC, 0xFB, 0x23, 0xB9, 0xFB,
+	0xCB, 0xAA, 0xEE, 0xEF, 0x94, 0xEE, 0x49, 0x6B, 0xBB, 0xA7, 0xD4, 0x74, 0xBF, 0xBF, 0xD5, 0xFD,
+	0xE6, 0x66, 0xF7, 0x78, 0x75, 0xF7, 0x68, 0x55, 0xF7, 0xF0, 0xF5, 0xEE, 0xC1, 0x8A, 0xEE, 0xFE,
+	0xF2, 0xEE, 0xDE, 0xAB, 0xDD, 0x5D, 0xA5, 0xDD, 0xAE, 0x92, 0xEE, 0xF6, 0xBF, 0xBA, 0xDB, 0x8A,
+	0xBA, 0x5B, 0x0A, 0xBB, 0xED, 0x7F, 0x74, 0x3F, 0xB8, 0xD2, 0x7D, 0x8F, 0xD3, 0x4D, 0xDE, 0xD5,
+	0xBD, 0x9A, 0xDB, 0xBD, 0x76, 0x4F, 0x77, 0xD4, 0xFF, 0x6E, 0x90, 0x0E, 0x5C, 0xBA, 0xB0, 0xB3,
+	0x00, 0x80, 0x67, 0x18, 0x86, 0x61, 0x38, 0xDC, 0xB9, 0xF3, 0x26, 0x33, 0x7F, 0xF9, 0xCB, 0x5F,
+	0xFE, 0xD2, 0x34, 0x4D, 0x33, 0x4D, 0x59, 0x14, 0x45, 0xD1, 0x68, 0x74, 0x17, 0x17, 0x8B, 0x95,
+	0xA6, 0x69, 0x9A, 0xA6, 0x69, 0x9A, 0x66, 0x09, 0x41, 0x10, 0x04, 0x83, 0xC1, 0xC1, 0x1D, 0x1C,
+	0x8C, 0x2C, 0xCB, 0xB2, 0x2C, 0xCB, 0x32, 0x4D, 0x53, 0x8A, 0xA2, 0x28, 0x8A, 0x46, 0xA3, 0xD1,
+	0x5D, 0xAC, 0xAF, 0xF6, 0xCC, 0x97, 0x3E, 0xED, 0x99, 0x2F, 0x7B, 0xE6, 0x4B, 0xEF, 0x3E, 0x7F,
+	0xC3, 0xA7, 0xD0, 0xAD, 0x29, 0x72, 0xEB, 0xF6, 0xBA, 0x0D, 0xA5, 0x6E, 0x53, 0x99, 0xDB, 0xBC,
+	0xDF, 0x6D, 0xA9, 0x74, 0x5B, 0xAB, 0xDC, 0xB6, 0x83, 0x6E, 0x7B, 0xAD, 0xDB, 0x51, 0xE7, 0x72,
+	0x8F, 0xB8, 0xFC, 0x7A, 0xF7, 0xCF, 0xC3, 0xEE, 0x1F, 0x87, 0xDC, 0xCF, 0x35, 0xEE, 0xA7, 0x6A,
+	0x77, 0xE2, 0x80, 0x3B, 0x5E, 0xE1, 0x8E, 0x95, 0xBB, 0xA3, 0xFB, 0x5C, 0x7D, 0x89, 0xAB, 0x2B,
+	0x76, 0x35, 0x7B, 0x5C, 0x55, 0x81, 0xAB, 0xC8, 0x77, 0x65, 0xBB, 0x5C, 0x49, 0x8E, 0x2B, 0x3A,
+	0xE9, 0xFE, 0x75, 0xCA, 0xFD, 0xBB, 0xD1, 0xFD, 0x72, 0xD6, 0x35, 0x9C, 0x73, 0x8D, 0xCD, 0xAE,
+	0xE9, 0xA2, 0x6B, 0xBE, 0xE4, 0x5A, 0x5A, 0x5D, 0xEB, 0x55, 0xD7, 0x76, 0xCD, 0xB5, 0xB7, 0xBB,
+	0xCE, 0x0E, 0xD7, 0x7D, 0xD3, 0xF5, 0x76, 0xBB, 0x3B, 0x3D, 0xEE, 0x5E, 0xB6, 0x4B, 0x5B, 0xE5,
+	0x52, 0x32, 0x5C, 0x52, 0xBA, 0x4B, 0x48, 0x73, 0xFE, 0xE5, 0xCE, 0x97, 0xEC, 0xBC, 0x49, 0xCE,
+	0xB3, 0xD4, 0x45, 0xC5, 0xBB, 0x48, 0xBF, 0x8B, 0x58, 0xEC, 0xC2, 0x63, 0x5D, 0x98, 0xD7, 0x85,
+	0x2E, 0x74, 0x21, 0xD1, 0x2E, 0xD8, 0x39, 0xED, 0x77, 0x53, 0xE0, 0xA6, 0xDF, 0xB8, 0x00, 0x74,
+	0x81, 0x43, 0x2E, 0x88, 0x5C, 0xF0, 0xA8, 0x0B, 0x61, 0x17, 0xFA, 0xDE, 0x85, 0x89, 0x0B, 0x9F,
+	0x70, 0x11, 0xEA, 0x22, 0x3F, 0xB9, 0x28, 0x73, 0x9E, 0x69, 0xE7, 0x9D, 0x35, 0x03, 0x7F, 0xFD,
+	0x0C, 0xDF, 0x4F, 0xC1, 0x77, 0x93, 0xB0, 0xF1, 0x23, 0xAC, 0xFF, 0x00, 0x6B, 0xC7, 0x61, 0xF5,
+	0x18, 0x64, 0xBF, 0x83, 0xCC, 0x11, 0x48, 0x1F, 0x86, 0xD4, 0xB7, 0x90, 0x3C, 0x08, 0x89, 0x03,
+	0x10, 0xFF, 0x1A, 0xE2, 0xFA, 0x20, 0x76, 0x01, 0xFC, 0xD7, 0x03, 0x7F, 0xC4, 0x40, 0xDF, 0x22,
+	0x00, 0x1F, 0x0C, 0xC6, 0xC1, 0xD0, 0x12, 0x18, 0x49, 0x00, 0x4E, 0x84, 0xF1, 0x65, 0x30, 0x91,
+	0x02, 0x93, 0xA9, 0x60, 0x2B, 0x60, 0x66, 0x25, 0xCC, 0xCE, 0x84, 0x39, 0x59, 0x30, 0xB7, 0x17,
+	0xE4, 0x16, 0x8C, 0x75, 0xC1, 0x68, 0x27, 0x0C, 0xDF, 0x00, 0xBC, 0x0E, 0x03, 0x6D, 0xD0, 0x7F,
+	0x05, 0x5E, 0x5D, 0x86, 0x97, 0x2D, 0xF0, 0xE2, 0x02, 0x3C, 0x3F, 0x0F, 0xCF, 0x9A, 0xE0, 0xE9,
+	0x19, 0x78, 0x7C, 0x1A, 0x1E, 0x36, 0xC0, 0xFD, 0x9D, 0x90, 0x91, 0x0B, 0x59, 0x79, 0xF0, 0xED,
+	0x6E, 0x58, 0x53, 0x08, 0xEB, 0x8A, 0x60, 0xC3, 0x5E, 0xD8, 0x54, 0x0A, 0x9B, 0xCB, 0x60, 0xCB,
+	0x7E, 0xD8, 0x5A, 0x09, 0xDB, 0xAA, 0x60, 0xFB, 0x41, 0xD8, 0x51, 0x0B, 0xB9, 0x75, 0x90, 0x7F,
+	0x04, 0x0A, 0xEB, 0xE1, 0x1F, 0x87, 0xE1, 0xE7, 0x43, 0xF0, 0x53, 0x0D, 0x9C, 0xA8, 0x86, 0xE3,
+	0x07, 0xE0, 0x58, 0x05, 0x1C, 0x2D, 0x87, 0xFA, 0x7D, 0x50, 0x57, 0x02, 0x35, 0xC5, 0x50, 0xB5,
+	0x07, 0x2A, 0x0A, 0xA0, 0x2C, 0x1F, 0x4A, 0x76, 0x41, 0x51, 0x0E, 0x14, 0x9C, 0x84, 0x7F, 0x9F,
+	0x82, 0x5F, 0x1A, 0xA1, 0xE1, 0x2C, 0x34, 0x9E, 0x83, 0xA6, 0x66, 0x68, 0xBE, 0x08, 0x2D, 0x97,
+	0xA0, 0xB5, 0x15, 0xDA, 0xAE, 0x42, 0xFB, 0x35, 0xE8, 0x6C, 0x87, 0xEE, 0x0E, 0xE8, 0xBD, 0x09,
+	0x77, 0xBA, 0xE1, 0x5E, 0x0F, 0x3C, 0xC8, 0x86, 0x94, 0x55, 0x90, 0x94, 0x01, 0x09, 0xE9, 0xE0,
+	0x4F, 0x03, 0xDF, 0x72, 0xF0, 0x26, 0x83, 0x27, 0x09, 0xA2, 0x96, 0x42, 0x64, 0x3C, 0x44, 0xF8,
+	0x21, 0x7C, 0x31, 0x84, 0xC5, 0x42, 0xA8, 0x17, 0x42, 0x16, 0x42, 0x70, 0x34, 0x04, 0x39, 0x98,
+	0xEA, 0x87, 0x69, 0x80, 0x80, 0x37, 0x10, 0x88, 0x10, 0x34, 0x04, 0xC1, 0x04, 0x21, 0xA3, 0x10,
+	0xCA, 0x10, 0xF6, 0x1E, 0xC2, 0x05, 0x22, 0x26, 0x20, 0x52, 0x21, 0xEA, 0x13, 0x78, 0x0C, 0xBC,
+	0xD3, 0xE0, 0x9B, 0x35, 0x83, 0xDF, 0x7F, 0xC6, 0xEF, 0xA6, 0x70, 0xE3, 0x24, 0xAE, 0xFF, 0x88,
+	0x6B, 0x3F, 0xE0, 0xEA, 0x71, 0xCC, 0x1E, 0xC3, 0xCC, 0x77, 0x98, 0x3E, 0x82, 0xA9, 0xC3, 0x98,
+	0xFC, 0x16, 0x13, 0x07, 0x31, 0x7E, 0x00, 0xE3, 0x5E, 0x63, 0x6C, 0x1F, 0xC6, 0x2C, 0xC0, 0x3F,
+	0x3C, 0xD8, 0x17, 0x83, 0xB0, 0x08, 0x07, 0x7D, 0x38, 0x14, 0x87, 0x23, 0x4B, 0x90, 0x13, 0x70,
+	0x3C, 0x11, 0x27, 0x96, 0xE1, 0x64, 0x0A, 0x5A, 0x2A, 0xCE, 0xAC, 0xC0, 0xD9, 0x2B, 0x71, 0x4E,
+	0x26, 0xCE, 0xCD, 0xC2, 0x79, 0xBD, 0x38, 0x76, 0x0B, 0x47, 0xBB, 0x70, 0xB8, 0x13, 0xF1, 0x06,
+	0x0E, 0x5C, 0xC7, 0xFE, 0x36, 0x7C, 0x75, 0x05, 0x5F, 0x5E, 0xC6, 0x17, 0x2D, 0xF8, 0xFC, 0x02,
+	0x3E, 0x3B, 0x8F, 0x4F, 0x9B, 0xF0, 0xF1, 0x19, 0x7C, 0x78, 0x1A, 0xEF, 0x37, 0xE0, 0xDD, 0x9D,
+	0x98, 0x95, 0x8B, 0xDF, 0xE6, 0xE1, 0x9A, 0xDD, 0xB8, 0xAE, 0x10, 0x37, 0x14, 0xE1, 0xA6, 0xBD,
+	0xB8, 0xB9, 0x14, 0xB7, 0x94, 0xE1, 0xD6, 0xFD, 0xB8, 0xAD, 0x12, 0xB7, 0x57, 0xE1, 0x8E, 0x83,
+	0x98, 0x5B, 0x8B, 0xF9, 0x75, 0x58, 0x78, 0x04, 0x8B, 0xEB, 0xF1, 0xE7, 0xC3, 0xF8, 0xD3, 0x21,
+	0x3C, 0x51, 0x83, 0xC7, 0xAB, 0xF1, 0xD8, 0x01, 0x3C, 0x5A, 0x81, 0xF5, 0xE5, 0x58, 0xB7, 0x0F,
+	0x6B, 0x4A, 0xB0, 0xAA, 0x18, 0x2B, 0xF6, 0x60, 0x59, 0x01, 0x96, 0xE4, 0x63, 0xD1, 0x2E, 0x2C,
+	0xC8, 0xC1, 0xBC, 0x93, 0xF8, 0xCB, 0x29, 0x6C, 0x68, 0xC4, 0xC6, 0xB3, 0xD8, 0x74, 0x0E, 0x9B,
+	0x9B, 0xB1, 0xE5, 0x22, 0xB6, 0x5E, 0xC2, 0xB6, 0x56, 0x6C, 0xBF, 0x8A, 0x9D, 0xD7, 0xB0, 0xBB,
+	0x1D, 0x7B, 0x3B, 0xF0, 0xCE, 0x4D, 0xBC, 0xD7, 0x8D, 0x0F, 0x7A, 0xF0, 0x51, 0x36, 0x26, 0xAD,
+	0xC2, 0x84, 0x0C, 0xF4, 0xA7, 0xA3, 0x2F, 0x0D, 0xBD, 0xCB, 0xD1, 0x93, 0x8C, 0x51, 0x49, 0x18,
+	0xB9, 0x14, 0x23, 0xE2, 0x31, 0xDC, 0x8F, 0x61, 0x8B, 0x31, 0x34, 0x16, 0x43, 0xBC, 0x18, 0xBC,
+	0x10, 0x83, 0xA2, 0x31, 0xD0, 0xE1, 0x74, 0x3F, 0x06, 0x00, 0x06, 0xBE, 0xC1, 0x20, 0xC4, 0xE0,
+	0x21, 0x0C, 0x21, 0x0C, 0x1D, 0xC5, 0x30, 0xC6, 0xF0, 0xF7, 0x18, 0x21, 0x18, 0x39, 0x81, 0x51,
+	0x8A, 0x9E, 0x4F, 0xE8, 0x35, 0xF4, 0x4D, 0xA3, 0x7F, 0xD6, 0x0C, 0x7D, 0xF7, 0x99, 0x36, 0x4E,
+	0xD1, 0xFA, 0x49, 0x5A, 0xFB, 0x91, 0x56, 0x7F, 0xA0, 0xEC, 0x71, 0xCA, 0x1C, 0xA3, 0xF4, 0x77,
+	0x94, 0x3A, 0x42, 0xC9, 0xC3, 0x94, 0xF8, 0x96, 0xE2, 0x07, 0x29, 0x6E, 0x80, 0x62, 0x5F, 0x53,
+	0x4C, 0x1F, 0x45, 0x2F, 0xA0, 0x3E, 0x0F, 0x41, 0x0C, 0x0D, 0x2E, 0xA2, 0x21, 0x1F, 0x8D, 0xC4,
+	0x11, 0x2F, 0xA1, 0xF1, 0x04, 0x9A, 0x48, 0xA4, 0xC9, 0x65, 0x64, 0x29, 0x34, 0x93, 0x4A, 0xB3,
+	0x57, 0xD0, 0x9C, 0x95, 0x34, 0x37, 0x93, 0xE6, 0x65, 0xD1, 0xFC, 0x5E, 0x1A, 0xBD, 0x45, 0xC3,
+	0x5D, 0x84, 0x9D, 0x34, 0x70, 0x83, 0xFA, 0xAF, 0xD3, 0xAB, 0x36, 0x7A, 0x79, 0x85, 0x5E, 0x5C,
+	0xA6, 0xE7, 0x2D, 0xF4, 0xEC, 0x02, 0x3D, 0x3D, 0x4F, 0x8F, 0x9B, 0xE8, 0xE1, 0x19, 0xBA, 0x7F,
+	0x9A, 0xEE, 0x36, 0xD0, 0xED, 0x9D, 0xF4, 0x6D, 0x2E, 0xAD, 0xC9, 0xA3, 0x75, 0xBB, 0x69, 0x43,
+	0x21, 0x6D, 0x2A, 0xA2, 0xCD, 0x7B, 0x69, 0x4B, 0x29, 0x6D, 0x2D, 0xA3, 0x6D, 0xFB, 0x69, 0x7B,
+	0x25, 0xED, 0xA8, 0xA2, 0xDC, 0x83, 0x94, 0x5F, 0x4B, 0x85, 0x75, 0x54, 0x7C, 0x84, 0x4A, 0xEB,
+	0xE9, 0xA7, 0xC3, 0x74, 0xE2, 0x10, 0x1D, 0xAF, 0xA1, 0x63, 0xD5, 0x74, 0xF4, 0x00, 0xD5, 0x57,
+	0x50, 0x5D, 0x39, 0xD5, 0xEC, 0xA3, 0xAA, 0x12, 0xAA, 0x28, 0xA6, 0xB2, 0x3D, 0x54, 0x52, 0x40,
+	0x45, 0xF9, 0x54, 0xB0, 0x8B, 0xF2, 0x72, 0x28, 0xE7, 0x24, 0x35, 0x9C, 0xA2, 0xC6, 0x46, 0x6A,
+	0x3A, 0x4B, 0xCD, 0xE7, 0xA8, 0xA5, 0x99, 0x5A, 0x2F, 0x52, 0xDB, 0x25, 0x6A, 0x6F, 0xA5, 0xCE,
+	0xAB, 0xD4, 0x7D, 0x8D, 0x7A, 0xDB, 0xE9, 0x4E, 0x07, 0xDD, 0xBB, 0x49, 0x0F, 0xBA, 0xE9, 0x51,
+	0x0F, 0x3D, 0xC9, 0xA6, 0x84, 0x55, 0xE4, 0xCF, 0x20, 0x5F, 0x3A, 0x79, 0xD3, 0xC8, 0xB3, 0x9C,
+	0xA2, 0x92, 0x29, 0x32, 0x89, 0x22, 0x96, 0x52, 0x78, 0x3C, 0x85, 0xF9, 0x29, 0x74, 0x31, 0x85,
+	0xC4, 0x52, 0xB0, 0x97, 0x82, 0x16, 0x52, 0x60, 0x34, 0x05, 0x38, 0x0A, 0xE8, 0xA7, 0x40, 0xA0,
+	0xA0, 0x37, 0x14, 0x8C, 0x14, 0x32, 0x44, 0xA1, 0x44, 0x61, 0xA3, 0x14, 0xCE, 0x14, 0xF1, 0x9E,
+	0x22, 0x85, 0xA2, 0x26, 0xC8, 0xA3, 0xE4, 0xFD, 0x44, 0x3E, 0x23, 0xFF, 0x34, 0x25, 0xCC, 0x9A,
+	0xE1, 0x8D, 0x9F, 0x79, 0xFD, 0x14, 0xAF, 0x9D, 0xE4, 0xD5, 0x1F, 0x39, 0xFB, 0x03, 0x67, 0x8E,
+	0x73, 0xFA, 0x18, 0xA7, 0xBE, 0xE3, 0xE4, 0x11, 0x4E, 0x1C, 0xE6, 0xF8, 0xB7, 0x1C, 0x37, 0xC8,
+	0xB1, 0x03, 0x1C, 0xF3, 0x9A, 0xA3, 0xFB, 0xF8, 0x9B, 0x05, 0x0C, 0x1E, 0x1E, 0x8C, 0xE1, 0xA1,
+	0x45, 0x3C, 0xE2, 0x63, 0x8E, 0xE3, 0xF1, 0x25, 0x3C, 0x91, 0xC0, 0x93, 0x89, 0x6C, 0xCB, 0x78,
+	0x26, 0x85, 0x67, 0xA7, 0xF2, 0x9C, 0x15, 0x3C, 0x77, 0x25, 0xCF, 0xCB, 0xE4, 0xF9, 0x59, 0xFC,
+	0x45, 0x2F, 0x0F, 0xDF, 0x62, 0xEC, 0xE2, 0x81, 0x4E, 0xEE, 0xBF, 0xC1, 0xAF, 0xAE, 0xF3, 0xCB,
+	0x36, 0x7E, 0x71, 0x85, 0x9F, 0x5F, 0xE6, 0x67, 0x2D, 0xFC, 0xF4, 0x02, 0x3F, 0x3E, 0xCF, 0x0F,
+	0x9B, 0xF8, 0xFE, 0x19, 0xBE, 0x7B, 0x9A, 0x6F, 0x37, 0x70, 0xCF, 0x4E, 0x5E, 0x93, 0xCB, 0xEB,
+	0xF2, 0x78, 0xC3, 0x6E, 0xDE, 0x54, 0xC8, 0x9B, 0x8B, 0x78, 0xCB, 0x5E, 0xDE, 0x5A, 0xCA, 0xDB,
+	0xCA, 0x78, 0xFB, 0x7E, 0xDE, 0x51, 0xC9, 0xB9, 0x55, 0x9C, 0x7F, 0x90, 0x0B, 0x6B, 0xB9, 0xB8,
+	0x8E, 0x4B, 0x8F, 0x70, 0x79, 0x3D, 0x9F, 0x38, 0xCC, 0xC7, 0x0F, 0xF1, 0xB1, 0x1A, 0x3E, 0x5A,
+	0xCD, 0xF5, 0x07, 0xB8, 0xAE, 0x82, 0x6B, 0xCA, 0xB9, 0x6A, 0x1F, 0x57, 0x94, 0x70, 0x59, 0x31,
+	0x97, 0xEC, 0xE1, 0xA2, 0x02, 0x2E, 0xC8, 0xE7, 0xBC, 0x5D, 0x9C, 0x93, 0xC3, 0x3F, 0x9E, 0xE4,
+	0xC6, 0x53, 0xDC, 0xD4, 0xC8, 0xCD, 0x67, 0xB9, 0xE5, 0x1C, 0xB7, 0x36, 0x73, 0xDB, 0x45, 0x6E,
+	0xBF, 0xC4, 0x9D, 0xAD, 0xDC, 0x7D, 0x95, 0x7B, 0xAF, 0xF1, 0x9D, 0x76, 0xBE, 0xD7, 0xC1, 0x0F,
+	0x6E, 0xF2, 0xA3, 0x6E, 0x7E, 0xD2, 0xC3, 0xBF, 0x66, 0xB3, 0x7F, 0x15, 0xFB, 0x32, 0xD8, 0x9B,
+	0xCE, 0x9E, 0x34, 0x8E, 0x5A, 0xCE, 0x91, 0xC9, 0x1C, 0x91, 0xC4, 0xE1, 0x4B, 0x39, 0x2C, 0x9E,
+	0x43, 0xFD, 0x1C, 0xB2, 0x98, 0x83, 0x63, 0x39, 0xC8, 0xCB, 0x81, 0x0B, 0x39, 0x20, 0x9A, 0xA7,
+	0x1D, 0x07, 0xF6, 0x73, 0x10, 0x70, 0xF0, 0x1B, 0x0E, 0x41, 0x0E, 0x1D, 0xE2, 0x30, 0xE2, 0xF0,
+	0x51, 0x8E, 0x60, 0x8E, 0x7C, 0xCF, 0x51, 0xC2, 0x9E, 0x09, 0xF6, 0x2A, 0xFB, 0x3E, 0xB1, 0xDF,
+	0x38, 0x61, 0x9A, 0x93, 0x66, 0xCD, 0xC8, 0xFA, 0xCF, 0xB2, 0x76, 0x4A, 0x56, 0x4F, 0x4A, 0xF6,
+	0x47, 0xC9, 0xFC, 0x20, 0xE9, 0xE3, 0x92, 0x3A, 0x26, 0xC9, 0xEF, 0x24, 0x71, 0x44, 0xE2, 0x87,
+	0x25, 0xEE, 0xAD, 0xC4, 0x0E, 0x4A, 0xCC, 0x80, 0x44, 0xBF, 0x96, 0x6F, 0xFA, 0xE4, 0xEB, 0x05,
+	0x32, 0xE8, 0x91, 0xA1, 0x18, 0x19, 0x59, 0x24, 0xEC, 0x93, 0xF1, 0x38, 0x99, 0x58, 0x22, 0x93,
+	0x09, 0x62, 0x89, 0x32, 0xB3, 0x4C, 0x66, 0xA7, 0xC8, 0x9C, 0x54, 0x99, 0xBB, 0x42, 0xE6, 0xAD,
+	0x94, 0xF9, 0x99, 0xF2, 0x45, 0x96, 0x7C, 0xD9, 0x2B, 0x78, 0x4B, 0x06, 0xBA, 0xA4, 0xBF, 0x53,
+	0x5E, 0xDD, 0x90, 0x97, 0xD7, 0xE5, 0x45, 0x9B, 0x3C, 0xBF, 0x22, 0xCF, 0x2E, 0xCB, 0xD3, 0x16,
+	0x79, 0x7C, 0x41, 0x1E, 0x9E, 0x97, 0xFB, 0x4D, 0x72, 0xF7, 0x8C, 0xDC, 0x3E, 0x2D, 0x3D, 0x0D,
+	0xD2, 0xB5, 0x53, 0xD6, 0xE5, 0xCA, 0x86, 0x3C, 0xD9, 0xB4, 0x5B, 0x36, 0x17, 0xCA, 0x96, 0x22,
+	0xD9, 0xBA, 0x57, 0xB6, 0x95, 0xCA, 0xF6, 0x32, 0xD9, 0xB1, 0x5F, 0x72, 0x2B, 0x25, 0xBF, 0x4A,
+	0x0A, 0x0F, 0x4A, 0x71, 0xAD, 0x94, 0xD6, 0x49, 0xF9, 0x11, 0xA9, 0xAC, 0x97, 0xE3, 0x87, 0xE5,
+	0xD8, 0x21, 0x39, 0x5A, 0x23, 0xF5, 0xD5, 0x52, 0x77, 0x40, 0x6A, 0x2A, 0xA4, 0xAA, 0x5C, 0x2A,
+	0xF6, 0x49, 0x59, 0x89, 0x94, 0x14, 0x4B, 0xD1, 0x1E, 0x29, 0x28, 0x90, 0xBC, 0x7C, 0xC9, 0xD9,
+	0x25, 0x3F, 0xE6, 0xC8, 0x0F, 0x27, 0xA5, 0xE9, 0x94, 0x34, 0x37, 0x4A, 0xCB, 0x59, 0x69, 0x3D,
+	0x27, 0x6D, 0xCD, 0xD2, 0x7E, 0x51, 0x3A, 0x2F, 0x49, 0x77, 0xAB, 0xF4, 0x5E, 0x95, 0x3B, 0xD7,
+	0xE4, 0x5E, 0xBB, 0x3C, 0xE8, 0x90, 0x47, 0x37, 0xE5, 0x49, 0xB7, 0xFC, 0xDA, 0x23, 0xBF, 0x65,
+	0x8B, 0x6F, 0x95, 0x78, 0x33, 0xC4, 0x93, 0x2E, 0x51, 0x69, 0x12, 0xB9, 0x5C, 0x22, 0x92, 0x25,
+	0x3C, 0x49, 0xC2, 0x96, 0x4A, 0x68, 0xBC, 0x84, 0xF8, 0x25, 0x78, 0xB1, 0x04, 0xC5, 0x4A, 0xA0,
+	0x57, 0x02, 0x16, 0xCA, 0x74, 0xB4, 0x4C, 0x39, 0x09, 0xEA, 0x97, 0x60, 0x90, 0x90, 0x37, 0x12,
+	0x8A, 0x12, 0x36, 0x24, 0xE1, 0x24, 0x11, 0xA3, 0x12, 0xC9, 0x12, 0xF5, 0x5E, 0x3C, 0x22, 0xDE,
+	0x09, 0xF1, 0xA9, 0xF8, 0x3F, 0x49, 0x82, 0x49, 0xD2, 0xB4, 0xA4, 0xCC, 0x9A, 0xD1, 0xB5, 0x9F,
+	0x75, 0xF5, 0x94, 0x66, 0x4F, 0x6A, 0xE6, 0x47, 0x4D, 0xFF, 0xA0, 0xA9, 0xE3, 0x9A, 0x3C, 0xA6,
+	0x89, 0xEF, 0x34, 0x7E, 0x44, 0xE3, 0x86, 0x35, 0xF6, 0xAD, 0xC6, 0x0C, 0x6A, 0xF4, 0x80, 0x7E,
+	0xF3, 0x5A, 0xBF, 0xEE, 0xD3, 0x3F, 0x2F, 0xD0, 0x21, 0x8F, 0x8E, 0xC4, 0x28, 0x2F, 0xD2, 0x71,
+	0x9F, 0x4E, 0xC4, 0xE9, 0xE4, 0x12, 0xB5, 0x04, 0x9D, 0x49, 0xD4, 0xD9, 0xCB, 0x74, 0x4E, 0x8A,
+	0xCE, 0x4D, 0xD5, 0x79, 0x2B, 0x74, 0xFE, 0x4A, 0xFD, 0x22, 0x53, 0xBF, 0xCC, 0xD2, 0xAF, 0x7A,
+	0x75, 0xE0, 0x96, 0xF6, 0x77, 0xE9, 0xAB, 0x4E, 0x7D, 0x79, 0x43, 0x5F, 0x5C, 0xD7, 0xE7, 0x6D,
+	0xFA, 0xEC, 0x8A, 0x3E, 0xBD, 0xAC, 0x8F, 0x5B, 0xF4, 0xE1, 0x05, 0xBD, 0x7F, 0x5E, 0xEF, 0x36,
+	0xE9, 0xED, 0x33, 0xDA, 0x73, 0x5A, 0xBB, 0x1A, 0xB4, 0x63, 0xA7, 0x6E, 0xC8, 0xD5, 0x4D, 0x79,
+	0xBA, 0x79, 0xB7, 0x6E, 0x29, 0xD4, 0xAD, 0x45, 0xBA, 0x6D, 0xAF, 0x6E, 0x2F, 0xD5, 0x1D, 0x65,
+	0x9A, 0xBB, 0x5F, 0xF3, 0x2B, 0xB5, 0xB0, 0x4A, 0x8B, 0x0F, 0x6A, 0x69, 0xAD, 0x96, 0xD7, 0x69,
+	0xE5, 0x11, 0xAD, 0xAE, 0xD7, 0x63, 0x87, 0xF5, 0xE8, 0x21, 0xAD, 0xAF, 0xD1, 0xBA, 0x6A, 0xAD,
+	0x39, 0xA0, 0x55, 0x15, 0x5A, 0x51, 0xAE, 0x65, 0xFB, 0xB4, 0xA4, 0x44, 0x8B, 0x8A, 0xB5, 0x60,
+	0x8F, 0xE6, 0x15, 0x68, 0x4E, 0xBE, 0xFE, 0xB8, 0x4B, 0x7F, 0xC8, 0xD1, 0xBF, 0x9F, 0xD4, 0xE6,
+	0x53, 0xDA, 0xD2, 0xA8, 0xAD, 0x67, 0xB5, 0xED, 0x9C, 0xB6, 0x37, 0x6B, 0xE7, 0x45, 0xED, 0xBE,
+	0xA4, 0xBD, 0xAD, 0x7A, 0xE7, 0xAA, 0xDE, 0xBB, 0xA6, 0x0F, 0xDA, 0xF5, 0x51, 0x87, 0x3E, 0xB9,
+	0xA9, 0xBF, 0x76, 0xEB, 0x6F, 0x3D, 0xFA, 0x7B, 0xB6, 0x7A, 0x57, 0xA9, 0x27, 0x43, 0xA3, 0xD2,
+	0x35, 0x32, 0x4D, 0x23, 0x96, 0x6B, 0x78, 0xB2, 0x86, 0x25, 0x69, 0xE8, 0x52, 0x0D, 0x89, 0xD7,
+	0x60, 0xBF, 0x06, 0x2D, 0xD6, 0xC0, 0x58, 0x0D, 0xF0, 0xEA, 0xF4, 0x42, 0x9D, 0x8A, 0x56, 0x75,
+	0x1A, 0xDC, 0xAF, 0x21, 0xA0, 0xA1, 0x6F, 0x34, 0x0C, 0x35, 0x7C, 0x48, 0x23, 0x48, 0x23, 0x47,
+	0x35, 0x8A, 0xD5, 0xF3, 0x5E, 0xBD, 0xA2, 0xBE, 0x09, 0xF5, 0xAB, 0x26, 0x7C, 0xD2, 0x24, 0xD3,
+	0x94, 0x69, 0x4D, 0x9B, 0x35, 0x63, 0xAB, 0x3F, 0x5B, 0xF6, 0x94, 0x65, 0x4E, 0x5A, 0xFA, 0x47,
+	0x4B, 0xFD, 0x60, 0xC9, 0xE3, 0x96, 0x38, 0x66, 0xF1, 0xEF, 0x2C, 0x6E, 0xC4, 0x62, 0x87, 0x2D,
+	0xE6, 0xAD, 0x45, 0x0F, 0xDA, 0x37, 0x03, 0xF6, 0xF5, 0x6B, 0xFB, 0x73, 0x9F, 0xFD, 0x69, 0x81,
+	0x8D, 0x78, 0x8C, 0x63, 0x6C, 0x7C, 0x91, 0x4D, 0xF8, 0x6C, 0x32, 0xCE, 0x6C, 0x89, 0xCD, 0x24,
+	0xD8, 0xEC, 0x44, 0x9B, 0xB3, 0xCC, 0xE6, 0xA6, 0xD8, 0xBC, 0x54, 0x9B, 0xBF, 0xC2, 0xBE, 0x58,
+	0x69, 0x5F, 0x66, 0xDA, 0x57, 0x59, 0xF6, 0x97, 0x5E, 0xEB, 0xBF, 0x65, 0xAF, 0xBA, 0xEC, 0x65,
+	0xA7, 0xBD, 0xB8, 0x61, 0xCF, 0xAF, 0xDB, 0xB3, 0x36, 0x7B, 0x7A, 0xC5, 0x1E, 0x5F, 0xB6, 0x87,
+	0x2D, 0x76, 0xFF, 0x82, 0xDD, 0x3D, 0x6F, 0xB7, 0x9B, 0xAC, 0xE7, 0x8C, 0x75, 0x9D, 0xB6, 0x8E,
+	0x06, 0xBB, 0xBE, 0xD3, 0x36, 0xE5, 0xDA, 0xE6, 0x3C, 0xDB, 0xB2, 0xDB, 0xB6, 0x16, 0xDA, 0xB6,
+	0x22, 0xDB, 0xBE, 0xD7, 0x76, 0x94, 0x5A, 0x6E, 0x99, 0xE5, 0xEF, 0xB7, 0xC2, 0x4A, 0x2B, 0xAE,
+	0xB2, 0xD2, 0x83, 0x56, 0x5E, 0x6B, 0x95, 0x75, 0x56, 0x7D, 0xC4, 0x6A, 0xEB, 0xED, 0xE8, 0x61,
+	0xAB, 0x3F, 0x64, 0x75, 0x35, 0x56, 0x53, 0x6D, 0x55, 0x07, 0xAC, 0xA2, 0xC2, 0xCA, 0xCA, 0xAD,
+	0x64, 0x9F, 0x15, 0x95, 0x58, 0x41, 0xB1, 0xE5, 0xED, 0xB1, 0x9C, 0x02, 0xFB, 0x31, 0xDF, 0x7E,
+	0xD8, 0x65, 0x7F, 0xCF, 0xB1, 0xBF, 0x9D, 0xB4, 0x96, 0x53, 0xD6, 0xDA, 0x68, 0x6D, 0x67, 0xAD,
+	0xFD, 0x9C, 0x75, 0x36, 0x5B, 0xF7, 0x45, 0xEB, 0xBD, 0x64, 0x77, 0x5A, 0xED, 0xDE, 0x55, 0x7B,
+	0x70, 0xCD, 0x1E, 0xB5, 0xDB, 0x93, 0x0E, 0xFB, 0xF5, 0xA6, 0xFD, 0xD6, 0x6D, 0xBF, 0xF7, 0xD8,
+	0x7F, 0xB2, 0xCD, 0xB3, 0xCA, 0xA2, 0x32, 0x2C, 0x32, 0xDD, 0x22, 0xD2, 0x2C, 0x7C, 0xB9, 0x85,
+	0x25, 0x5B, 0x68, 0x92, 0x85, 0x2C, 0xB5, 0xE0, 0x78, 0x0B, 0xF2, 0x5B, 0xE0, 0x62, 0x0B, 0x88,
+	0xB5, 0x69, 0xAF, 0x4D, 0x2D, 0x34, 0x8D, 0xB6, 0x0F, 0xCE, 0x42, 0xFA, 0x2D, 0x14, 0x2C, 0xEC,
+	0x8D, 0x85, 0xA3, 0x45, 0x0C, 0x59, 0x24, 0x59, 0xD4, 0xA8, 0x79, 0xD8, 0xBC, 0xEF, 0xCD, 0x27,
+	0xE6, 0x9F, 0xF8, 0x7F, 0x57, 0x4B, 0xFA, 0x64, 0x29, 0x66, 0x69, 0xD3, 0xB6, 0xF2, 0x7F, 0xA2,
+	0x1C, 0x1C, 0xF1, 0xC6, 0x9A, 0x99, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE,
+	0x42, 0x60, 0x82,
+};
+
+#ifdef ROMFS_DIRENTRY_HEAD
+	static const ROMFS_DIRENTRY bench_png_dir = { 0, 0, ROMFS_DIRENTRY_HEAD, "bench.png", 18691, bench_png };
+	#undef ROMFS_DIRENTRY_HEAD
+	#define ROMFS_DIRENTRY_HEAD &bench_png_dir
+#endif
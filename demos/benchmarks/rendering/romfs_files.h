@@ -0,0 +1,10 @@
+/**
+ * This file contains the list of files for the ROMFS.
+ *
+ * The files have been converted using...
+ * 		file2c -dcs infile outfile
+ */
+#include "romfs_bench_bmp.h"
+#include "romfs_bench_gif.h"
+#include "romfs_bench_jpg.h"
+#include "romfs_bench_png.h"
@@ -61,12 +61,14 @@ int main(void) {
 	gCoord		minx, miny, maxx, maxy;
 	gCoord		ballcx, ballcy;
 	gColor		colour;
+	gColor		*line;
 	float		ii, spin, dy, spinspeed, h, f, g;
 
 	gfxInit();
 
 	width = gdispGetWidth();
 	height = gdispGetHeight();
+	line = gfxAlloc(width * sizeof(gColor));	// One line of pixels is sent to the LCD at a time
 
 	radius=height/5+height%2+1;	// The ball radius
 	ii = 1.0/radius;			// radius as easy math
@@ -112,8 +114,9 @@ int main(void) {
 					if (g*(g+.4)+h*(h+.1) < 1)
 						colour = gdispBlendColor(colour, GFX_BLACK, SHADOWALPHA);
 				}
-				gdispStreamColor(colour);	/* pixel to the LCD */
+				line[x-minx] = colour;
 			}
+			gdispStreamWrite(line, maxx-minx);	/* line to the LCD */
 		}
 		gdispStreamStop();
 
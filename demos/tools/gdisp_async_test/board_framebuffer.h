@@ -0,0 +1,73 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+// A frame buffer in RAM that remembers which page is being shown.
+//	The test can hold up board_flush() to prove the driver is showing frames in the background.
+
+#define GDISP_LLD_PIXELFORMAT		GDISP_PIXELFORMAT_RGB888
+#define GDISP_HARDWARE_FLUSH		GFXON
+
+#define BOARD_WIDTH		64
+#define BOARD_HEIGHT	48
+
+// The number of display pages. 0 draws in memory and copies each frame to a single page.
+//	2 is not useful here as the driver has to finish each flush before it returns.
+#ifndef BOARD_PAGES
+	#define BOARD_PAGES	3
+#endif
+#if BOARD_PAGES == 1 || BOARD_PAGES == 2
+	#error "Async test board: BOARD_PAGES must be 0 or at least 3"
+#endif
+
+#ifdef GDISP_DRIVER_VMT
+
+	extern gU32				boardpixels[];			// The display pages
+	extern gU32 *			boardshown;				// The page being shown
+	extern unsigned			boardflushes;			// The number of times board_flush() has been called
+	extern volatile gBool	boardhold;				// Hold board_flush() until boardgate is signalled
+	extern gSem				boardgate;
+
+	static void board_init(GDisplay *g, fbInfo *fbi) {
+		g->g.Width = BOARD_WIDTH;
+		g->g.Height = BOARD_HEIGHT;
+		g->g.Backlight = 100;
+		g->g.Contrast = 50;
+		fbi->linelen = BOARD_WIDTH * sizeof(LLDCOLOR_TYPE);
+		fbi->pixels = boardpixels;
+		fbi->pages = BOARD_PAGES;
+		fbi->pagelen = BOARD_WIDTH * BOARD_HEIGHT * sizeof(LLDCOLOR_TYPE);
+		boardshown = boardpixels;
+	}
+
+	static void board_flip(GDisplay *g, unsigned page) {
+		(void) g;
+		boardshown = boardpixels + page * (BOARD_WIDTH * BOARD_HEIGHT);
+	}
+
+	static void board_flush(GDisplay *g) {
+		(void) g;
+		if (boardhold)
+			gfxSemWait(&boardgate, gDelayForever);
+		boardflushes++;
+	}
+
+	static void board_backlight(GDisplay *g, gU8 percent) {
+		(void) g;
+		(void) percent;
+	}
+
+	static void board_contrast(GDisplay *g, gU8 percent) {
+		(void) g;
+		(void) percent;
+	}
+
+	static void board_power(GDisplay *g, gPowermode pwr) {
+		(void) g;
+		(void) pwr;
+	}
+
+#endif /* GDISP_DRIVER_VMT */
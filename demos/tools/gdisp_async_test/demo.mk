@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/tools/gdisp_async_test
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
@@ -0,0 +1,233 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * Checks asynchronous flushes and blits complete in the background.
+ *
+ * The frame buffer driver shows frames and blits on its own thread. This runs it on a
+ * frame buffer in RAM whose board_flush() can be held up. While it is held the flush (and
+ * any blit queued behind it) must not have completed and drawing must carry on. Once it is
+ * released the callbacks must be called, the fences signalled and the right pixels shown.
+ *
+ * Build it with make CPPFLAGS=-DBOARD_PAGES=0 to test a back buffer copied to a single page
+ * instead of flipping between three pages.
+ *
+ * The exit code is 0 if everything worked.
+ */
+
+#include <stdio.h>
+#include "gfx.h"
+
+#define FRAMES			500						// The number of frames in the stress test
+#define BLIT_CX			16
+#define BLIT_CY			12
+
+// The board
+gU32			boardpixels[(BOARD_PAGES ? BOARD_PAGES : 1) * BOARD_WIDTH * BOARD_HEIGHT];
+gU32 *			boardshown;
+unsigned		boardflushes;
+volatile gBool	boardhold;
+gSem			boardgate;
+
+typedef struct done_t {
+	unsigned		calls;						// The number of times the callback has been called
+	gdispFence *	fence;						// The fence the operation signals
+	gBool			early;						// The fence was signalled before the callback
+	} done_t;
+
+static unsigned		errors;
+static gdispFence	flushfence, blitfence;
+static done_t		flushdone, blitdone;
+static gPixel		blitbuf[BLIT_CY][BLIT_CX];
+
+#define CHECK(cond, ...)	do { if (!(cond) && ++errors <= 20) { printf("  orientation %u: ", gdispGetOrientation()); printf(__VA_ARGS__); printf("\n"); } } while(0)
+
+static void done(GDisplay *g, void *param) {
+	done_t	*d;
+
+	(void) g;
+	d = (done_t *)param;
+	d->calls++;
+	if (gdispFencePoll(d->fence))
+		d->early = gTrue;
+}
+
+static void holdboard(void) {
+	boardhold = gTrue;
+}
+
+static void releaseboard(void) {
+	boardhold = gFalse;
+	gfxSemSignal(&boardgate);
+}
+
+// The pixel being shown at a display (rotated) position
+static gColor shownpixel(gCoord x, gCoord y) {
+	gCoord	px, py;
+
+	switch(gdispGetOrientation()) {
+	case gOrientation0:
+	default:
+		px = x; py = y;
+		break;
+	case gOrientation90:
+		px = y; py = gdispGetWidth() - x - 1;
+		break;
+	case gOrientation180:
+		px = gdispGetWidth() - x - 1; py = gdispGetHeight() - y - 1;
+		break;
+	case gOrientation270:
+		px = gdispGetHeight() - y - 1; py = x;
+		break;
+	}
+	return (gColor)boardshown[py * BOARD_WIDTH + px];
+}
+
+static gBool shownarea(gCoord x, gCoord y, gCoord cx, gCoord cy, gColor c) {
+	gCoord	i, j;
+
+	for(j = 0; j < cy; j++) {
+		for(i = 0; i < cx; i++) {
+			if (shownpixel(x+i, y+j) != c)
+				return gFalse;
+		}
+	}
+	return gTrue;
+}
+
+static void testflush(void) {
+	unsigned	flushes;
+
+	gdispClear(GFX_BLACK);
+	gdispFlush();
+
+	// The flush must wait for the board
+	gdispFillArea(10, 5, 20, 10, GFX_RED);
+	flushes = boardflushes;
+	flushdone.calls = 0;
+	flushdone.early = gFalse;
+	holdboard();
+	gdispFlushAsync(&flushfence, done, &flushdone);
+	gfxSleepMilliseconds(20);
+	CHECK(!gdispFencePoll(&flushfence), "flush fence signalled while the board was busy");
+	CHECK(!flushdone.calls, "flush callback called while the board was busy");
+
+	// Drawing carries on while it is being shown
+	gdispFillArea(40, 20, 8, 8, GFX_BLUE);
+
+	releaseboard();
+	CHECK(gdispFenceWait(&flushfence, 1000), "flush fence not signalled");
+	CHECK(flushdone.calls == 1, "flush callback called %u times", flushdone.calls);
+	CHECK(!flushdone.early, "flush fence signalled before the callback");
+	CHECK(boardflushes == flushes+1, "board flushed %u times", boardflushes - flushes);
+	CHECK(shownarea(10, 5, 20, 10, GFX_RED), "flushed area not shown");
+	CHECK(shownarea(40, 20, 8, 8, GFX_BLACK), "area drawn after the flush was shown");
+
+	// Waiting again returns straight away
+	CHECK(gdispFenceWait(&flushfence, gDelayNone), "flush fence not left signalled");
+
+	gdispFlush();
+	CHECK(shownarea(40, 20, 8, 8, GFX_BLUE), "area drawn after the flush not shown by the next one");
+}
+
+static void testblit(void) {
+	gCoord	i, j;
+	gColor	c;
+
+	for(j = 0; j < BLIT_CY; j++) {
+		for(i = 0; i < BLIT_CX; i++)
+			blitbuf[j][i] = RGB2COLOR(i * 16, j * 20, (i + j) * 8);
+	}
+	gdispClear(GFX_BLACK);
+	gdispFlush();
+
+	// Keep the driver's thread busy with a flush so the blit is queued behind it
+	flushdone.calls = 0;
+	blitdone.calls = 0;
+	blitdone.early = gFalse;
+	holdboard();
+	gdispFlushAsync(&flushfence, 0, 0);
+	gdispBlitAreaAsync(5, 6, BLIT_CX, BLIT_CY, 0, 0, BLIT_CX, &blitbuf[0][0], &blitfence, done, &blitdone);
+	gfxSleepMilliseconds(20);
+	CHECK(!gdispFencePoll(&blitfence), "blit fence signalled while the driver was busy");
+	CHECK(!blitdone.calls, "blit callback called while the driver was busy");
+
+	releaseboard();
+	CHECK(gdispFenceWait(&flushfence, 1000), "flush fence not signalled");
+	CHECK(gdispFenceWait(&blitfence, 1000), "blit fence not signalled");
+	CHECK(blitdone.calls == 1, "blit callback called %u times", blitdone.calls);
+	CHECK(!blitdone.early, "blit fence signalled before the callback");
+
+	// The blit is drawn but not shown until the next flush
+	for(j = 0; j < BLIT_CY; j++) {
+		for(i = 0; i < BLIT_CX; i++) {
+			if ((c = gdispGetPixelColor(5+i, 6+j)) != blitbuf[j][i]) {
+				CHECK(gFalse, "blit pixel %d,%d is %08X not %08X", i, j, (unsigned)c, (unsigned)blitbuf[j][i]);
+				return;
+			}
+		}
+	}
+	CHECK(shownarea(5, 6, BLIT_CX, BLIT_CY, GFX_BLACK), "blit shown before a flush");
+	gdispFlush();
+	for(j = 0; j < BLIT_CY; j++) {
+		for(i = 0; i < BLIT_CX; i++) {
+			if (shownpixel(5+i, 6+j) != blitbuf[j][i]) {
+				CHECK(gFalse, "blit pixel %d,%d not shown", i, j);
+				return;
+			}
+		}
+	}
+}
+
+// Lots of frames passing the fence on while the last one is still in progress
+static void teststress(void) {
+	unsigned	n;
+	gColor		c;
+
+	flushdone.calls = 0;
+	blitdone.calls = 0;
+	for(n = 0; n < FRAMES; n++) {
+		c = RGB2COLOR(n, n * 3, n * 7);
+		gdispFillArea(0, 0, gdispGetWidth(), gdispGetHeight()/2, c);
+		gdispBlitAreaAsync(n % (gdispGetWidth() - BLIT_CX), gdispGetHeight()/2, BLIT_CX, BLIT_CY, 0, 0, BLIT_CX, &blitbuf[0][0], &blitfence, done, &blitdone);
+		gdispFlushAsync(&flushfence, done, &flushdone);
+	}
+	CHECK(gdispFenceWait(&flushfence, 1000), "flush fence not signalled after %u frames", FRAMES);
+	CHECK(gdispFenceWait(&blitfence, 1000), "blit fence not signalled after %u frames", FRAMES);
+	CHECK(flushdone.calls == FRAMES, "%u flush callbacks for %u frames", flushdone.calls, FRAMES);
+	CHECK(blitdone.calls == FRAMES, "%u blit callbacks for %u frames", blitdone.calls, FRAMES);
+	CHECK(shownarea(0, 0, gdispGetWidth(), gdispGetHeight()/2, c), "last frame not shown");
+	n = (FRAMES-1) % (gdispGetWidth() - BLIT_CX);
+	CHECK(shownpixel(n, gdispGetHeight()/2) == blitbuf[0][0] && shownpixel(n+BLIT_CX-1, gdispGetHeight()/2+BLIT_CY-1) == blitbuf[BLIT_CY-1][BLIT_CX-1], "last blit not shown");
+}
+
+int main(void) {
+	unsigned	o, before;
+
+	gfxInit();
+
+	gfxSemInit(&boardgate, 0, 1);
+	gdispFenceInit(&flushfence);
+	gdispFenceInit(&blitfence);
+	flushdone.fence = &flushfence;
+	blitdone.fence = &blitfence;
+
+	printf("Display pages: %u\n", BOARD_PAGES);
+	for(o = 0; o < 360; o += 90) {
+		gdispSetOrientation((gOrientation)o);
+		before = errors;
+		testflush();
+		testblit();
+		teststress();
+		printf("Orientation %3u: %s\n", o, errors == before ? "ok" : "FAILED");
+	}
+
+	gdispFenceDeinit(&blitfence);
+	gdispFenceDeinit(&flushfence);
+	gfxSemDestroy(&boardgate);
+	return errors ? 1 : 0;
+}
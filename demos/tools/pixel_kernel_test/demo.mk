@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/tools/pixel_kernel_test
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
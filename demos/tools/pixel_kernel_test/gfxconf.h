@@ -0,0 +1,29 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+#ifndef _GFXCONF_H
+#define _GFXCONF_H
+
+/* The operating system to use. One of these must be defined - preferably in your Makefile */
+//#define GFX_USE_OS_CHIBIOS	GFXOFF
+//#define GFX_USE_OS_WIN32		GFXOFF
+//#define GFX_USE_OS_LINUX		GFXOFF
+//#define GFX_USE_OS_OSX		GFXOFF
+
+/* GFX sub-systems to turn on */
+#define GFX_USE_GDISP					GFXON
+
+/* Features for the GDISP sub-system. */
+#define GDISP_NEED_PIXELKERNELS			GFXON
+#define GDISP_NEED_STARTUP_LOGO			GFXOFF
+
+/* The blend kernels depend on the pixel format. Test the others by defining this in the Makefile. */
+#ifndef GDISP_PIXELFORMAT
+	#define GDISP_PIXELFORMAT			GDISP_PIXELFORMAT_RGB565
+#endif
+
+#endif /* _GFXCONF_H */
@@ -0,0 +1,228 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * Checks every pixel kernel set the CPU can run against the portable C kernels.
+ *
+ * Each kernel is run over random pixels with every start offset up to a whole
+ * AVX2 register and with odd, even and SIMD boundary pixel counts. The whole
+ * buffer, including the pixels either side of the row, must match what the C
+ * kernel produced.
+ *
+ * The blend kernels depend on GDISP_PIXELFORMAT so build it once for each format
+ * of interest eg. make CPPFLAGS=-DGDISP_PIXELFORMAT=GDISP_PIXELFORMAT_BGR888
+ *
+ * The exit code is 0 if all the kernels match.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "gfx.h"
+
+#define MAX_COUNT		300							// The largest row to test
+#define MAX_OFFSET		33							// The largest start offset (in pixels) + 1
+#define BUF_WORDS		(MAX_COUNT+MAX_OFFSET+8)	// The buffer size in 32 bit words
+
+static const gdispKernels	*ref, *k;
+static unsigned				errors;
+static gU32					seed = 0x12345678;
+
+// Both buffers are 32 byte aligned so that the offsets really do cover every alignment
+static gU32		refbuf[BUF_WORDS] __attribute__((aligned(32)));
+static gU32		kbuf[BUF_WORDS] __attribute__((aligned(32)));
+static gU32		srcbuf[BUF_WORDS] __attribute__((aligned(32)));
+static gU32		bgbuf[BUF_WORDS] __attribute__((aligned(32)));
+static gU8		alphabuf[MAX_COUNT+MAX_OFFSET] __attribute__((aligned(32)));
+
+static const unsigned counts[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 31, 32, 33, 35, 47, 48, 49, 63, 64, 65, 67, 127, 128, 129, 255, 256, 257, MAX_COUNT,
+};
+static const gU8 alphas[] = { 0, 1, 2, 127, 128, 129, 200, 254, 255 };
+
+#define NUM(a)		(sizeof(a)/sizeof((a)[0]))
+
+static gU32 rnd(void) {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static gPixel rndpixel(void) {
+	gU32	r;
+
+	r = rnd();
+	#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
+		// The alpha hacked format - include some transparency
+		return (gPixel)r;
+	#else
+		return RGB2COLOR(r & 0xFF, (r >> 8) & 0xFF, (r >> 16) & 0xFF);
+	#endif
+}
+
+static void rndbytes(void *buf, size_t len) {
+	gU8	*p;
+
+	for(p = (gU8 *)buf; len; len--)
+		*p++ = (gU8)rnd();
+}
+
+static void rndpixels(gU32 *buf) {
+	gPixel	*p;
+	size_t	i;
+
+	for(p = (gPixel *)buf, i = 0; i < sizeof(refbuf)/sizeof(gPixel); i++)
+		*p++ = rndpixel();
+}
+
+static void check(const char *what, unsigned offset, unsigned cnt) {
+	if (!memcmp(refbuf, kbuf, sizeof(refbuf)))
+		return;
+	if (++errors <= 20)
+		printf("  %s: %s differs with offset %u count %u\n", k->name, what, offset, cnt);
+}
+
+/*===========================================================================*/
+/* Fills.                                                                    */
+/*===========================================================================*/
+
+static void testfills(void) {
+	unsigned	off, i, cnt;
+	gU32		c;
+
+	for(off = 0; off < MAX_OFFSET; off++) {
+		for(i = 0; i < NUM(counts); i++) {
+			cnt = counts[i];
+			c = rnd();
+
+			rndbytes(refbuf, sizeof(refbuf));
+			memcpy(kbuf, refbuf, sizeof(refbuf));
+			ref->fill8((gU8 *)refbuf + off, (gU8)c, cnt);
+			k->fill8((gU8 *)kbuf + off, (gU8)c, cnt);
+			check("fill8", off, cnt);
+
+			rndbytes(refbuf, sizeof(refbuf));
+			memcpy(kbuf, refbuf, sizeof(refbuf));
+			ref->fill16((gU16 *)refbuf + off, (gU16)c, cnt);
+			k->fill16((gU16 *)kbuf + off, (gU16)c, cnt);
+			check("fill16", off, cnt);
+
+			rndbytes(refbuf, sizeof(refbuf));
+			memcpy(kbuf, refbuf, sizeof(refbuf));
+			ref->fill32(refbuf + off, c, cnt);
+			k->fill32(kbuf + off, c, cnt);
+			check("fill32", off, cnt);
+		}
+	}
+}
+
+/*===========================================================================*/
+/* Color conversions.                                                        */
+/*===========================================================================*/
+
+static void testconv(const char *what, gdispKernelConvertFn reffn, gdispKernelConvertFn kfn, unsigned dstsize, unsigned srcsize) {
+	unsigned	off, srcoff, i, cnt;
+
+	for(off = 0; off < MAX_OFFSET; off++) {
+		// Use a different alignment for the source
+		srcoff = (off * 5) % MAX_OFFSET;
+		for(i = 0; i < NUM(counts); i++) {
+			cnt = counts[i];
+
+			rndbytes(srcbuf, sizeof(srcbuf));
+			rndbytes(refbuf, sizeof(refbuf));
+			memcpy(kbuf, refbuf, sizeof(refbuf));
+			reffn((gU8 *)refbuf + off * dstsize, (gU8 *)srcbuf + srcoff * srcsize, cnt);
+			kfn((gU8 *)kbuf + off * dstsize, (gU8 *)srcbuf + srcoff * srcsize, cnt);
+			check(what, off, cnt);
+		}
+	}
+}
+
+static void testconvs(void) {
+	testconv("conv888to565", ref->conv888to565, k->conv888to565, 2, 4);
+	testconv("conv888to565swap", ref->conv888to565swap, k->conv888to565swap, 2, 4);
+	testconv("conv565to888", ref->conv565to888, k->conv565to888, 4, 2);
+	testconv("conv565to888swap", ref->conv565to888swap, k->conv565to888swap, 4, 2);
+	testconv("swap888", ref->swap888, k->swap888, 4, 4);
+	testconv("swap565", ref->swap565, k->swap565, 2, 2);
+}
+
+/*===========================================================================*/
+/* Blends.                                                                   */
+/*===========================================================================*/
+
+static void testblends(void) {
+	unsigned	off, srcoff, i, a, cnt;
+	gPixel		fg;
+	gU8			alpha;
+
+	for(off = 0; off < MAX_OFFSET; off++) {
+		srcoff = (off * 5) % MAX_OFFSET;
+		for(i = 0; i < NUM(counts); i++) {
+			cnt = counts[i];
+			for(a = 0; a <= NUM(alphas); a++) {
+				alpha = a < NUM(alphas) ? alphas[a] : (gU8)rnd();
+				fg = rndpixel();
+
+				rndpixels(refbuf);
+				memcpy(kbuf, refbuf, sizeof(refbuf));
+				ref->blend((gPixel *)refbuf + off, fg, alpha, cnt);
+				k->blend((gPixel *)kbuf + off, fg, alpha, cnt);
+				check("blend", off, cnt);
+
+				// Into a separate destination
+				rndpixels(srcbuf);
+				rndpixels(bgbuf);
+				rndpixels(refbuf);
+				memcpy(kbuf, refbuf, sizeof(refbuf));
+				ref->blendrow((gPixel *)refbuf + off, (gPixel *)srcbuf + srcoff, (gPixel *)bgbuf + off, alpha, cnt);
+				k->blendrow((gPixel *)kbuf + off, (gPixel *)srcbuf + srcoff, (gPixel *)bgbuf + off, alpha, cnt);
+				check("blendrow", off, cnt);
+
+				// In place over the background
+				rndpixels(refbuf);
+				memcpy(kbuf, refbuf, sizeof(refbuf));
+				ref->blendrow((gPixel *)refbuf + off, (gPixel *)srcbuf + srcoff, (gPixel *)refbuf + off, alpha, cnt);
+				k->blendrow((gPixel *)kbuf + off, (gPixel *)srcbuf + srcoff, (gPixel *)kbuf + off, alpha, cnt);
+				check("blendrow in place", off, cnt);
+			}
+
+			// A random alpha for each pixel with plenty of fully transparent and opaque ones
+			rndbytes(alphabuf, sizeof(alphabuf));
+			for(a = 0; a < sizeof(alphabuf); a += 7)
+				alphabuf[a] = (a & 8) ? 255 : 0;
+			fg = rndpixel();
+			rndpixels(refbuf);
+			memcpy(kbuf, refbuf, sizeof(refbuf));
+			ref->blendmask((gPixel *)refbuf + off, fg, alphabuf + srcoff, cnt);
+			k->blendmask((gPixel *)kbuf + off, fg, alphabuf + srcoff, cnt);
+			check("blendmask", off, cnt);
+		}
+	}
+}
+
+int main(void) {
+	unsigned	n, before;
+
+	gfxInit();
+
+	printf("Pixel kernels in use: %s\n", gdispKernel->name);
+	ref = gdispKernelGetSet(0);
+	for(n = 0; (k = gdispKernelGetSet(n)); n++) {
+		before = errors;
+		testfills();
+		testconvs();
+		testblends();
+		printf("%-6s %s\n", k->name, errors == before ? "ok" : "FAILED");
+	}
+	if (n == 1)
+		printf("No SIMD kernels are available - only the C kernels were checked\n");
+
+	return errors ? 1 : 0;
+}
@@ -27,6 +27,7 @@
 #define GDISP_NEED_SCROLL			GFXON
 #define GDISP_NEED_PIXELREAD		GFXON
 #define GDISP_NEED_STREAMING		GFXON
+#define GDISP_NEED_COPYAREA			GFXON
 
 /* Builtin Fonts */
 #define GDISP_INCLUDE_FONT_UI2		GFXON
@@ -30,8 +30,8 @@
 	#define EMBEDED_OS	GFXON
 #endif
 
-#if GNETCODE_VERSION != GNETCODE_VERSION_1_0
-	#error "This uGFXnet display only supports protocol V1.0"
+#if GNETCODE_VERSION != GNETCODE_VERSION_2_0
+	#error "This uGFXnet display only supports protocol V1.0 and V2.0"
 #endif
 #if GDISP_PIXELFORMAT != GNETCODE_PIXELFORMAT
 	#error "Oops - The uGFXnet protocol requires a different pixel format. Try defining GDISP_PIXELFORMAT in your gfxconf.h file."
@@ -64,6 +64,7 @@
 	#include <sys/types.h>
 	#include <sys/socket.h>
 	#include <netinet/in.h>
+	#include <netinet/tcp.h>
 	#include <arpa/inet.h>
 	#include <netdb.h>
 
@@ -112,6 +113,10 @@
 #endif
 static SOCKET_TYPE				netfd = (SOCKET_TYPE)-1;
 static gFont					font;
+static gU8						rxbuf[1024];				// Received data not yet used
+static unsigned					rxpos, rxlen;
+static gPixel *					line;						// One decoded line of pixels (or an area read reply)
+static unsigned					linesize;
 
 #define STRINGOF_RAW(s)		#s
 #define STRINGOF(s)			STRINGOF_RAW(s)
@@ -139,25 +144,40 @@ static gFont					font;
  */
 static gBool getpkt(gU16 *pkt, int len) {
 	int		got;
-	int		have;
 
-	// Get the packet of data
-	len *= sizeof(gU16);
-	have = 0;
-	while(len && (got = recv(netfd, ((char *)pkt)+have, len, 0)) > 0) {
-		have += got;
-		len -= got;
-	}
-	if (len)
-		return gFalse;
-
-	// Convert each gU16 to host order
-	for(got = 0, have /= 2; got < have; got++)
-		pkt[got] = ntohs(pkt[got]);
+	while(len--) {
+		// Read as much as we can in one go
+		while(rxlen - rxpos < sizeof(gU16)) {
+			if (rxpos) {
+				memmove(rxbuf, rxbuf+rxpos, rxlen-rxpos);
+				rxlen -= rxpos;
+				rxpos = 0;
+			}
+			if ((got = recv(netfd, (char *)rxbuf+rxlen, sizeof(rxbuf)-rxlen, 0)) <= 0)
+				return gFalse;
+			rxlen += got;
+		}
 
+		// The data arrives in network order
+		*pkt++ = (gU16)((rxbuf[rxpos] << 8) | rxbuf[rxpos+1]);
+		rxpos += sizeof(gU16);
+	}
 	return gTrue;
 }
 
+/**
+ * Make sure the line buffer can hold cx pixels.
+ */
+static void growline(unsigned cx) {
+	if (cx <= linesize)
+		return;
+	if (line)
+		gfxFree(line);
+	if (!(line = gfxAlloc(cx * sizeof(gPixel))))
+		gfxHalt("Oops - Out of memory");
+	linesize = cx;
+}
+
 /**
  * Send a whole packet of data.
  * Len is specified in the number of gU16's we want to send as our protocol only talks gU16's.
@@ -327,7 +347,9 @@ static SOCKET_TYPE doConnect(proto_args) {
  * There are two prototypes - one for systems with a command line and one for embedded systems without one.
  */
 int main(proto_args) {
-	gU16			cmd[5];
+	gU16			cmd[GNETCODE_PALETTE_MAX];
+	gU16			pal[GNETCODE_PALETTE_MAX];
+	gCoord				i, j, bits;
 	unsigned			cnt;
 
 
@@ -341,11 +363,18 @@ int main(proto_args) {
 	netfd = doConnect(cmd_args);
 	if (netfd == (SOCKET_TYPE)-1)
 		gfxHalt("Could not connect to the specified server");
+	#ifdef TCP_NODELAY
+	{
+		// Send each reply straight away. The host may be waiting for a whole row of them.
+		int		one = 1;
+		setsockopt(netfd, IPPROTO_TCP, TCP_NODELAY, (const char *)&one, sizeof(one));
+	}
+	#endif
 	gdispClear(GFX_BLACK);
 
 	// Get the initial packet from the host
 	if (!getpkt(cmd, 2)) goto alldone;
-	if (cmd[0] != GNETCODE_INIT || cmd[1] != GNETCODE_VERSION)
+	if (cmd[0] != GNETCODE_INIT || cmd[1] < GNETCODE_VERSION_1_0 || cmd[1] > GNETCODE_VERSION)
 		gfxHalt("Oops - The protocol doesn't look like one we understand");
 
 	// Get the rest of the initial arguments
@@ -355,6 +384,11 @@ int main(proto_args) {
 	if (cmd[2] != GDISP_PIXELFORMAT)
 		gfxHalt("Oops - The remote display is using a different pixel format to us.\nTry defining GDISP_PIXELFORMAT in your gfxconf.h file.");
 
+	// Ask for the newest protocol we know. The host replies with the version it will use.
+	cmd[0] = GNETCODE_UPGRADE;
+	cmd[1] = GNETCODE_VERSION;
+	if (!sendpkt(cmd, 2)) goto alldone;
+
 	#if GFX_USE_GINPUT && GINPUT_NEED_MOUSE
 		// Start the mouse thread if needed
 		if (cmd[3])
@@ -377,12 +411,67 @@ int main(proto_args) {
 			break;
 		case GNETCODE_BLIT:
 			if (!getpkt(cmd, 4)) goto alldone;				// cmd[] = x, y, cx, cy		- Followed by cx * cy pixels
-			gdispStreamStart(cmd[0],cmd[1],cmd[2],cmd[3]);
-			for(cnt = (unsigned)cmd[2] * cmd[3]; cnt; cnt--) {
-				if (!getpkt(cmd, 1)) goto alldone;
-				gdispStreamColor(cmd[0]);
+			growline(cmd[2]);
+			for(j = 0; j < cmd[3]; j++) {
+				for(i = 0; i < cmd[2]; i++) {
+					if (!getpkt(pal, 1)) goto alldone;
+					line[i] = pal[0];
+				}
+				gdispBlitAreaEx(cmd[0], cmd[1]+j, cmd[2], 1, 0, 0, cmd[2], line);
 			}
-			gdispStreamStop();
+			break;
+		case GNETCODE_RLE:
+			if (!getpkt(cmd, 4)) goto alldone;				// cmd[] = x, y, cx, cy		- Followed by count,color pairs
+			growline(cmd[2]);
+			for(i = j = 0, cnt = 0; j < cmd[3]; cnt--) {
+				if (!cnt) {
+					if (!getpkt(pal, 2)) goto alldone;
+					if (!(cnt = pal[0]))
+						gfxHalt("Oops - The host has sent invalid commands");
+				}
+				line[i] = pal[1];
+				if (++i == cmd[2]) {
+					gdispBlitAreaEx(cmd[0], cmd[1]+j, cmd[2], 1, 0, 0, cmd[2], line);
+					i = 0;
+					j++;
+				}
+			}
+			break;
+		case GNETCODE_PALETTE:
+			if (!getpkt(cmd, 5)) goto alldone;				// cmd[] = x, y, cx, cy, colors	- Followed by the colors and the packed indexes
+			if (cmd[4] < 2 || cmd[4] > GNETCODE_PALETTE_MAX)
+				gfxHalt("Oops - The host has sent invalid commands");
+			if (!getpkt(pal, cmd[4])) goto alldone;
+			bits = cmd[4] <= 2 ? 1 : (cmd[4] <= 4 ? 2 : 4);
+			growline(cmd[2]);
+			for(j = 0; j < cmd[3]; j++) {
+				// Each line starts in a new block
+				for(i = 0, cnt = 0; i < cmd[2]; i++) {
+					if (!cnt) {
+						if (!getpkt(&cmd[5], 1)) goto alldone;
+						cnt = 16;
+					}
+					cnt -= bits;
+					line[i] = pal[(cmd[5] >> cnt) & ((1 << bits) - 1)];
+				}
+				gdispBlitAreaEx(cmd[0], cmd[1]+j, cmd[2], 1, 0, 0, cmd[2], line);
+			}
+			break;
+		#if GDISP_NEED_COPYAREA
+			case GNETCODE_COPY:
+				if (!getpkt(cmd, 6)) goto alldone;				// cmd[] = x, y, cx, cy, srcx, srcy
+				gdispCopyArea(cmd[4], cmd[5], cmd[2], cmd[3], cmd[0], cmd[1]);
+				break;
+		#endif
+		case GNETCODE_FRAME:
+			if (!getpkt(cmd, 1)) goto alldone;				// cmd[] = frame			- Response is GNETCODE_FRAME,frame
+			gdispFlush();
+			cmd[1] = cmd[0];
+			cmd[0] = GNETCODE_FRAME;
+			if (!sendpkt(cmd, 2)) goto alldone;
+			break;
+		case GNETCODE_UPGRADE:
+			if (!getpkt(cmd, 1)) goto alldone;				// cmd[] = version			- The host's answer to our upgrade request
 			break;
 		#if GDISP_NEED_PIXELREAD
 			case GNETCODE_READ:
@@ -391,11 +480,25 @@ int main(proto_args) {
 				cmd[0] = GNETCODE_READ;
 				if (!sendpkt(cmd, 2)) goto alldone;
 				break;
+			case GNETCODE_READ_AREA:
+				if (!getpkt(cmd, 4)) goto alldone;				// cmd[] = x, y, cx, cy		- Response is GNETCODE_READ_AREA,count followed by count colors
+				// The reply is sent in one go so the mouse thread can't get in the middle of it.
+				//	Our pixels are the same size as the protocol words (RGB565).
+				cnt = (unsigned)cmd[2] * cmd[3];
+				growline(cnt + 2);
+				line[0] = GNETCODE_READ_AREA;
+				line[1] = (gPixel)cnt;
+				for(cnt = 2, j = 0; j < cmd[3]; j++) {
+					for(i = 0; i < cmd[2]; i++)
+						line[cnt++] = gdispGetPixelColor(cmd[0]+i, cmd[1]+j);
+				}
+				if (!sendpkt((gU16 *)line, cnt)) goto alldone;
+				break;
 		#endif
 		#if GDISP_NEED_SCROLL
 			case GNETCODE_SCROLL:
 				if (!getpkt(cmd, 5)) goto alldone;				// cmd[] = x, y, cx, cy, lines
-				gdispVerticalScroll(cmd[0], cmd[1], cmd[2], cmd[3], cmd[4], GFX_BLACK);
+				gdispVerticalScroll(cmd[0], cmd[1], cmd[2], cmd[3], (gI16)cmd[4], GFX_BLACK);
 				break;
 		#endif
 		case GNETCODE_CONTROL:
@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/tools/uGFXnetLoopback
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
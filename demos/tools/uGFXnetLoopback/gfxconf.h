@@ -0,0 +1,39 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+#ifndef _GFXCONF_H
+#define _GFXCONF_H
+
+/* The operating system to use. One of these must be defined - preferably in your Makefile */
+//#define GFX_USE_OS_CHIBIOS	GFXOFF
+//#define GFX_USE_OS_WIN32		GFXOFF
+//#define GFX_USE_OS_LINUX		GFXOFF
+//#define GFX_USE_OS_OSX		GFXOFF
+
+/* GFX sub-systems to turn on */
+#define GFX_USE_GDISP					GFXON
+
+/* Features for the GDISP sub-system. */
+#define GDISP_NEED_VALIDATION			GFXON
+#define GDISP_NEED_CLIP					GFXON
+#define GDISP_NEED_CONTROL				GFXON
+#define GDISP_NEED_SCROLL				GFXON
+#define GDISP_NEED_PIXELREAD			GFXON
+#define GDISP_NEED_COPYAREA				GFXON
+#define GDISP_NEED_STARTUP_LOGO			GFXOFF
+
+/* The uGFXnet driver. The display size isn't a whole number of tiles so the edge tiles get tested too. */
+#define GDISP_SCREEN_WIDTH				200
+#define GDISP_SCREEN_HEIGHT				150
+#define GDISP_GFXNET_FRAMEBUFFER		GFXON
+#define GDISP_DONT_WAIT_FOR_NET_DISPLAY	GFXON			// The test draws before its display connects
+#define GDISP_GFXNET_PORT				13077			// Not the default port so a real display doesn't connect instead
+
+/* The colors read back must be the colors sent */
+#define GDISP_PIXELFORMAT				GDISP_PIXELFORMAT_RGB565
+
+#endif /* _GFXCONF_H */
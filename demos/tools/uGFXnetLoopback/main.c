@@ -0,0 +1,559 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * Checks what the uGFXnet driver sends to a V2.0 display.
+ *
+ * The driver (with GDISP_GFXNET_FRAMEBUFFER) is connected over a loopback socket to a
+ * display decoder in this program that keeps its own copy of the pixels. Fills, run length
+ * and palette encoded blits, raw blits, copies, scrolls and rotations are drawn and after
+ * each frame the decoder's pixels must match what the driver reads back. Each step also
+ * checks that the encoding it is meant to produce was used and that a frame only carries
+ * the tiles that have changed.
+ *
+ * The exit code is 0 if everything matched.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "gfx.h"
+#include "drivers/multiple/uGFXnet/uGFXnetProtocol.h"
+
+#if GFX_USE_OS_LINUX || GFX_USE_OS_OSX
+	#include <sys/types.h>
+	#include <sys/socket.h>
+	#include <netinet/in.h>
+	#include <netinet/tcp.h>
+	#include <arpa/inet.h>
+	#include <unistd.h>
+#else
+	#error "uGFXnet loopback test: Only Linux and OSX sockets are supported"
+#endif
+
+#if GDISP_PIXELFORMAT != GNETCODE_PIXELFORMAT
+	#error "uGFXnet loopback test: GDISP_PIXELFORMAT must be the uGFXnet pixel format"
+#endif
+
+#define TILE			16						// The driver's frame buffer tile size
+#define MIXED_OPS		400						// The number of random operations in the mixed test
+#define BUF_SIZE		64						// The largest blit
+
+#define NUM(a)			(sizeof(a)/sizeof((a)[0]))
+
+// The display decoder
+static int				netfd = -1;
+static gThread			decoder;
+static gU8				rxbuf[1024];
+static unsigned			rxpos, rxlen;
+static gU16				shown[GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT];	// What the display shows (in physical order)
+static gU16				area[GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT];		// An area being copied
+static gOrientation		orient;					// The orientation the display has been told to use
+static unsigned			cmds[GNETCODE_READ_AREA+1];	// How many of each command arrived in this step
+static unsigned			sent;					// How many pixels they drew
+static gSem				framesem;				// Signalled when a frame has been shown
+
+// The test
+static const char *		stepname;
+static unsigned			errors;
+static gU32				seed = 0x12345678;
+static gPixel			blitbuf[BUF_SIZE * BUF_SIZE];
+static gU16				picture[GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT];	// The display before it was rotated
+
+#define CHECK(cond, ...)	do { if (!(cond) && ++errors <= 20) { printf("  %s: ", stepname); printf(__VA_ARGS__); printf("\n"); } } while(0)
+
+/*===========================================================================*/
+/* The display decoder.                                                      */
+/*===========================================================================*/
+
+// Get len words from the driver
+static gBool getpkt(gU16 *pkt, int len) {
+	int		got;
+
+	while(len--) {
+		while(rxlen - rxpos < sizeof(gU16)) {
+			if (rxpos) {
+				memmove(rxbuf, rxbuf+rxpos, rxlen-rxpos);
+				rxlen -= rxpos;
+				rxpos = 0;
+			}
+			if ((got = recv(netfd, (char *)rxbuf+rxlen, sizeof(rxbuf)-rxlen, 0)) <= 0)
+				return gFalse;
+			rxlen += got;
+		}
+		*pkt++ = (gU16)((rxbuf[rxpos] << 8) | rxbuf[rxpos+1]);
+		rxpos += sizeof(gU16);
+	}
+	return gTrue;
+}
+
+// Send len words to the driver
+static gBool sendpkt(gU16 *pkt, int len) {
+	int		i;
+
+	for(i = 0; i < len; i++)
+		pkt[i] = htons(pkt[i]);
+	len *= sizeof(gU16);
+	return send(netfd, (const char *)pkt, len, 0) == len;
+}
+
+// The display's pixel at a position in the current orientation. This is the frame buffer driver's mapping.
+static gU16 *shownat(gCoord x, gCoord y) {
+	switch(orient) {
+	case gOrientation0:
+	default:
+		return &shown[y * GDISP_SCREEN_WIDTH + x];
+	case gOrientation90:
+		return &shown[(GDISP_SCREEN_HEIGHT - 1 - x) * GDISP_SCREEN_WIDTH + y];
+	case gOrientation180:
+		return &shown[(GDISP_SCREEN_HEIGHT - 1 - y) * GDISP_SCREEN_WIDTH + GDISP_SCREEN_WIDTH - 1 - x];
+	case gOrientation270:
+		return &shown[x * GDISP_SCREEN_WIDTH + GDISP_SCREEN_WIDTH - 1 - y];
+	}
+}
+
+// Is an area completely on the display?
+static gBool onscreen(gU16 x, gU16 y, gU16 cx, gU16 cy) {
+	unsigned	w, h;
+
+	if (orient == gOrientation90 || orient == gOrientation270) {
+		w = GDISP_SCREEN_HEIGHT;
+		h = GDISP_SCREEN_WIDTH;
+	} else {
+		w = GDISP_SCREEN_WIDTH;
+		h = GDISP_SCREEN_HEIGHT;
+	}
+	return cx && cy && (unsigned)x + cx <= w && (unsigned)y + cy <= h;
+}
+
+static GFX_THREAD_STACK(waDecoder, 4096);
+static GFX_THREAD_FUNCTION(Decoder, param) {
+	gU16		cmd[6];
+	gU16		pal[GNETCODE_PALETTE_MAX];
+	gU16		code, w;
+	gCoord		i, j;
+	unsigned	left, bits;
+	(void)		param;
+
+	while(getpkt(&code, 1)) {
+		if (code < NUM(cmds))
+			cmds[code]++;
+		switch(code) {
+		case GNETCODE_INIT:
+			if (!getpkt(cmd, 5)) goto done;					// cmd[] = version, width, height, pixelformat, hasmouse
+			if (cmd[0] != GNETCODE_VERSION_1_0 || cmd[1] != GDISP_SCREEN_WIDTH || cmd[2] != GDISP_SCREEN_HEIGHT || cmd[3] != GNETCODE_PIXELFORMAT)
+				goto bad;
+			cmd[0] = GNETCODE_UPGRADE;
+			cmd[1] = GNETCODE_VERSION_2_0;
+			if (!sendpkt(cmd, 2)) goto done;
+			break;
+		case GNETCODE_UPGRADE:
+			if (!getpkt(cmd, 1)) goto done;					// cmd[] = version
+			if (cmd[0] != GNETCODE_VERSION_2_0)
+				goto bad;
+			break;
+		case GNETCODE_PIXEL:
+			if (!getpkt(cmd, 3)) goto done;					// cmd[] = x, y, color
+			if (!onscreen(cmd[0], cmd[1], 1, 1))
+				goto bad;
+			*shownat(cmd[0], cmd[1]) = cmd[2];
+			sent++;
+			break;
+		case GNETCODE_FILL:
+			if (!getpkt(cmd, 5)) goto done;					// cmd[] = x, y, cx, cy, color
+			if (!onscreen(cmd[0], cmd[1], cmd[2], cmd[3]))
+				goto bad;
+			for(j = 0; j < cmd[3]; j++) {
+				for(i = 0; i < cmd[2]; i++)
+					*shownat(cmd[0]+i, cmd[1]+j) = cmd[4];
+			}
+			sent += (unsigned)cmd[2] * cmd[3];
+			break;
+		case GNETCODE_BLIT:
+			if (!getpkt(cmd, 4)) goto done;					// cmd[] = x, y, cx, cy		- Followed by cx * cy pixels
+			if (!onscreen(cmd[0], cmd[1], cmd[2], cmd[3]))
+				goto bad;
+			for(j = 0; j < cmd[3]; j++) {
+				for(i = 0; i < cmd[2]; i++) {
+					if (!getpkt(&w, 1)) goto done;
+					*shownat(cmd[0]+i, cmd[1]+j) = w;
+				}
+			}
+			sent += (unsigned)cmd[2] * cmd[3];
+			break;
+		case GNETCODE_RLE:
+			if (!getpkt(cmd, 4)) goto done;					// cmd[] = x, y, cx, cy		- Followed by count,color pairs
+			if (!onscreen(cmd[0], cmd[1], cmd[2], cmd[3]))
+				goto bad;
+			for(left = 0, j = 0; j < cmd[3]; j++) {
+				for(i = 0; i < cmd[2]; i++, left--) {
+					if (!left) {
+						if (!getpkt(pal, 2)) goto done;
+						if (!(left = pal[0]))
+							goto bad;
+					}
+					*shownat(cmd[0]+i, cmd[1]+j) = pal[1];
+				}
+			}
+			// A run must not go past the end of the area
+			if (left)
+				goto bad;
+			sent += (unsigned)cmd[2] * cmd[3];
+			break;
+		case GNETCODE_PALETTE:
+			if (!getpkt(cmd, 5)) goto done;					// cmd[] = x, y, cx, cy, colors	- Followed by the colors and the packed indexes
+			if (!onscreen(cmd[0], cmd[1], cmd[2], cmd[3]) || cmd[4] < 2 || cmd[4] > GNETCODE_PALETTE_MAX)
+				goto bad;
+			if (!getpkt(pal, cmd[4])) goto done;
+			bits = cmd[4] <= 2 ? 1 : (cmd[4] <= 4 ? 2 : 4);
+			for(j = 0; j < cmd[3]; j++) {
+				// Each line starts in a new block
+				for(i = 0, left = 0; i < cmd[2]; i++) {
+					if (!left) {
+						if (!getpkt(&w, 1)) goto done;
+						left = 16;
+					}
+					left -= bits;
+					if (((w >> left) & ((1 << bits) - 1)) >= cmd[4])
+						goto bad;
+					*shownat(cmd[0]+i, cmd[1]+j) = pal[(w >> left) & ((1 << bits) - 1)];
+				}
+			}
+			sent += (unsigned)cmd[2] * cmd[3];
+			break;
+		case GNETCODE_COPY:
+			if (!getpkt(cmd, 6)) goto done;					// cmd[] = x, y, cx, cy, srcx, srcy
+			if (!onscreen(cmd[0], cmd[1], cmd[2], cmd[3]) || !onscreen(cmd[4], cmd[5], cmd[2], cmd[3]))
+				goto bad;
+			// The areas may overlap
+			for(j = 0; j < cmd[3]; j++) {
+				for(i = 0; i < cmd[2]; i++)
+					area[j * cmd[2] + i] = *shownat(cmd[4]+i, cmd[5]+j);
+			}
+			for(j = 0; j < cmd[3]; j++) {
+				for(i = 0; i < cmd[2]; i++)
+					*shownat(cmd[0]+i, cmd[1]+j) = area[j * cmd[2] + i];
+			}
+			break;
+		case GNETCODE_CONTROL:
+			if (!getpkt(cmd, 2)) goto done;					// cmd[] = what, data		- Response is GNETCODE_CONTROL, success
+			if (cmd[0] == GDISP_CONTROL_ORIENTATION) {
+				if (cmd[1] != gOrientation0 && cmd[1] != gOrientation90 && cmd[1] != gOrientation180 && cmd[1] != gOrientation270)
+					goto bad;
+				orient = (gOrientation)cmd[1];
+			}
+			cmd[0] = GNETCODE_CONTROL;
+			cmd[1] = 1;
+			if (!sendpkt(cmd, 2)) goto done;
+			break;
+		case GNETCODE_FRAME:
+			if (!getpkt(cmd, 1)) goto done;					// cmd[] = frame			- Response is GNETCODE_FRAME, frame
+			cmd[1] = cmd[0];
+			cmd[0] = GNETCODE_FRAME;
+			if (!sendpkt(cmd, 2)) goto done;
+			gfxSemSignal(&framesem);
+			break;
+		default:
+			// Nothing else should be sent to a V2.0 display when the driver has a frame buffer
+			goto bad;
+		}
+	}
+	goto done;
+
+bad:
+	printf("  %s: the display was sent an invalid or unexpected command %04X\n", stepname, code);
+	errors++;
+done:
+	close(netfd);
+	return 0;
+}
+
+static void connectdisplay(void) {
+	struct sockaddr_in	addr;
+	int					i, one;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(GDISP_GFXNET_PORT);
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	// The driver's network thread may not be listening yet
+	for(i = 0; i < 20; i++) {
+		if ((netfd = socket(AF_INET, SOCK_STREAM, 0)) == -1)
+			gfxHalt("uGFXnet loopback test: Socket failed");
+		if (connect(netfd, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+			break;
+		close(netfd);
+		netfd = -1;
+		gfxSleepMilliseconds(100);
+	}
+	if (netfd == -1)
+		gfxHalt("uGFXnet loopback test: Could not connect to the driver");
+	one = 1;
+	setsockopt(netfd, IPPROTO_TCP, TCP_NODELAY, (const char *)&one, sizeof(one));
+
+	// A new display shows nothing until it is sent the frame buffer
+	rxpos = rxlen = 0;
+	orient = gOrientation0;
+	memset(shown, 0, sizeof(shown));
+	decoder = gfxThreadCreate(waDecoder, sizeof(waDecoder), gThreadpriorityNormal, Decoder, 0);
+}
+
+static void disconnectdisplay(void) {
+	shutdown(netfd, SHUT_RDWR);
+	gfxThreadWait(decoder);
+}
+
+/*===========================================================================*/
+/* The test.                                                                 */
+/*===========================================================================*/
+
+static gU32 rnd(void) {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static gColor rndcolor(void) {
+	return (gColor)rnd();
+}
+
+// Fill the blit buffer using n random colors or any colors if n is 0
+static void rndbuf(unsigned n) {
+	gColor		pal[GNETCODE_PALETTE_MAX];
+	unsigned	i;
+
+	for(i = 0; i < n; i++)
+		pal[i] = rndcolor();
+	for(i = 0; i < NUM(blitbuf); i++)
+		blitbuf[i] = n ? pal[rnd() % n] : rndcolor();
+}
+
+static void step(const char *name) {
+	stepname = name;
+	memset(cmds, 0, sizeof(cmds));
+	sent = 0;
+}
+
+// Flush and check the display shows what the driver has
+static void checkframe(void) {
+	gCoord	x, y;
+	gColor	c;
+
+	gdispFlush();
+	if (!gfxSemWait(&framesem, 2000)) {
+		CHECK(gFalse, "the frame was not shown");
+		return;
+	}
+	for(y = 0; y < gdispGetHeight(); y++) {
+		for(x = 0; x < gdispGetWidth(); x++) {
+			if ((c = gdispGetPixelColor(x, y)) != *shownat(x, y)) {
+				CHECK(gFalse, "pixel %d,%d is %04X on the display instead of %04X", x, y, *shownat(x, y), c);
+				return;
+			}
+		}
+	}
+}
+
+static void testencodings(void) {
+	gCoord		j;
+	unsigned	i;
+
+	// Whole tiles of one color are fills. Nothing else needs sending.
+	step("fill");
+	gdispFillArea(16, 96, 64, 32, GFX_GREEN);
+	checkframe();
+	CHECK(cmds[GNETCODE_FILL] == 2 && sent == 64*32, "%u fills drawing %u pixels", cmds[GNETCODE_FILL], sent);
+
+	// Lines of one color are runs
+	step("rle");
+	for(j = 0; j < 20; j++) {
+		for(i = 0; i < 64; i++)
+			blitbuf[j * 64 + i] = RGB2COLOR(j * 12, 255 - j * 12, j * 6);
+	}
+	gdispBlitArea(10, 70, 64, 20, blitbuf);
+	checkframe();
+	CHECK(cmds[GNETCODE_RLE] && !cmds[GNETCODE_PALETTE] && !cmds[GNETCODE_BLIT], "%u runs, %u palette and %u raw blits", cmds[GNETCODE_RLE], cmds[GNETCODE_PALETTE], cmds[GNETCODE_BLIT]);
+
+	// A few colors (that exactly cover some tiles) are palette blits of 1, 2 and 4 bits
+	step("palette");
+	for(i = 2, j = 0; i <= GNETCODE_PALETTE_MAX; i *= 2, j += 16) {
+		rndbuf(i - (i == 4));
+		gdispBlitArea(128, j, 64, 16, blitbuf);
+	}
+	checkframe();
+	CHECK(cmds[GNETCODE_PALETTE] == 4 && !cmds[GNETCODE_RLE] && !cmds[GNETCODE_BLIT], "%u palette blits, %u runs and %u raw blits", cmds[GNETCODE_PALETTE], cmds[GNETCODE_RLE], cmds[GNETCODE_BLIT]);
+
+	// Any colors are sent as they are
+	step("raw");
+	rndbuf(0);
+	gdispBlitAreaEx(136, 64, 40, 32, 0, 0, BUF_SIZE, blitbuf);
+	checkframe();
+	CHECK(cmds[GNETCODE_BLIT] == 2 && !cmds[GNETCODE_RLE] && !cmds[GNETCODE_PALETTE], "%u raw blits, %u runs and %u palette blits", cmds[GNETCODE_BLIT], cmds[GNETCODE_RLE], cmds[GNETCODE_PALETTE]);
+}
+
+static void testcopies(void) {
+	// Copying what the display already has sends no pixels
+	step("copy");
+	gdispCopyArea(128, 0, 64, 64, 20, 5);
+	checkframe();
+	CHECK(cmds[GNETCODE_COPY] == 1 && !sent, "%u copies and %u pixels sent", cmds[GNETCODE_COPY], sent);
+
+	step("overlapping copy");
+	gdispCopyArea(20, 5, 64, 64, 27, 9);
+	gdispCopyArea(27, 9, 64, 64, 22, 4);
+	checkframe();
+	CHECK(cmds[GNETCODE_COPY] == 2 && !sent, "%u copies and %u pixels sent", cmds[GNETCODE_COPY], sent);
+
+	// The destination is sent when the source hadn't been
+	step("copy of unsent pixels");
+	gdispFillArea(0, 130, 20, 20, GFX_YELLOW);
+	gdispCopyArea(0, 130, 20, 20, 170, 125);
+	checkframe();
+
+	// Scrolls are copies and a fill
+	step("scroll");
+	gdispVerticalScroll(16, 96, 64, 48, 10, GFX_BLACK);
+	checkframe();
+	CHECK(cmds[GNETCODE_COPY] == 1, "%u copies", cmds[GNETCODE_COPY]);
+	step("scroll back");
+	gdispVerticalScroll(20, 30, 90, 60, -7, GFX_BLUE);
+	checkframe();
+	CHECK(cmds[GNETCODE_COPY] == 1, "%u copies", cmds[GNETCODE_COPY]);
+}
+
+static void testframes(void) {
+	unsigned	i;
+	gCoord		x, y, cx, cy;
+
+	// Only the tiles that change are sent
+	step("frame delta");
+	gdispDrawPixel(100, 100, GFX_WHITE);
+	checkframe();
+	CHECK(sent == TILE*TILE, "%u pixels sent for a tile", sent);
+
+	step("edge tile");
+	gdispDrawPixel(gdispGetWidth()-1, gdispGetHeight()-1, GFX_WHITE);
+	checkframe();
+	CHECK(sent == (GDISP_SCREEN_WIDTH % TILE) * (GDISP_SCREEN_HEIGHT % TILE), "%u pixels sent for an edge tile", sent);
+
+	// Drawing what is already there sends an empty frame
+	step("unchanged");
+	gdispDrawPixel(100, 100, GFX_WHITE);
+	checkframe();
+	CHECK(!sent, "%u pixels sent when nothing changed", sent);
+
+	// Lots of different drawing with frames in between
+	step("mixed");
+	for(i = 0; i < MIXED_OPS; i++) {
+		x = rnd() % gdispGetWidth();
+		y = rnd() % gdispGetHeight();
+		cx = 1 + rnd() % BUF_SIZE;
+		cy = 1 + rnd() % BUF_SIZE;
+		switch(rnd() % 6) {
+		case 0:
+			gdispFillArea(x, y, cx, cy, rndcolor());
+			break;
+		case 1:
+			rndbuf(0);
+			gdispBlitAreaEx(x, y, cx, cy, 0, 0, BUF_SIZE, blitbuf);
+			break;
+		case 2:
+			rndbuf(2 + rnd() % 6);
+			gdispBlitAreaEx(x, y, cx, cy, 0, 0, BUF_SIZE, blitbuf);
+			break;
+		case 3:
+			gdispVerticalScroll(x, y, cx, cy, (int)(rnd() % 40) - 20, rndcolor());
+			break;
+		case 4:
+			gdispCopyArea(x, y, cx, cy, rnd() % gdispGetWidth(), rnd() % gdispGetHeight());
+			break;
+		case 5:
+			gdispDrawPixel(x, y, rndcolor());
+			break;
+		}
+		if (!(i % 37))
+			checkframe();
+	}
+	checkframe();
+}
+
+static void testrotation(void) {
+	static char	name[32];
+	unsigned	o;
+
+	for(o = 90; o <= 360; o += 90) {
+		// The picture must stay where it is on the display
+		sprintf(name, "rotate to %u", o % 360);
+		step(name);
+		memcpy(picture, shown, sizeof(shown));
+		gdispSetOrientation((gOrientation)(o % 360));
+		CHECK(orient == (gOrientation)(o % 360), "the display wasn't rotated");
+		checkframe();
+		CHECK(!memcmp(picture, shown, sizeof(shown)), "the picture moved");
+
+		// Draw in the new orientation
+		sprintf(name, "draw at %u", o % 360);
+		step(name);
+		gdispFillArea(5, 5, 30, 20, rndcolor());
+		rndbuf(4);
+		gdispBlitAreaEx(gdispGetWidth()-50, gdispGetHeight()-40, 45, 35, 0, 0, BUF_SIZE, blitbuf);
+		gdispCopyArea(0, 0, 40, 30, gdispGetWidth()-40, 0);
+		gdispVerticalScroll(0, 40, gdispGetWidth(), 40, 5, GFX_RED);
+		checkframe();
+	}
+}
+
+static void testreconnect(void) {
+	// A display that connects later is told the orientation and sent everything
+	step("reconnect");
+	gdispSetOrientation(gOrientation90);
+	checkframe();
+	disconnectdisplay();
+	gfxSleepMilliseconds(300);
+	gdispFillArea(10, 10, 50, 50, GFX_CYAN);
+	connectdisplay();
+	checkframe();
+	CHECK(orient == gOrientation90, "the display wasn't told the orientation");
+	gdispSetOrientation(gOrientation0);
+	checkframe();
+}
+
+int main(void) {
+	unsigned	before;
+
+	gfxInit();
+	gfxSemInit(&framesem, 0, 100);
+
+	// Draw before the display connects. Its first frame must have it all.
+	step("connect");
+	gdispClear(GFX_BLUE);
+	gdispFillArea(30, 25, 70, 50, GFX_RED);
+	connectdisplay();
+	checkframe();
+	printf("Connect     %s\n", errors ? "FAILED" : "ok");
+
+	before = errors;
+	testencodings();
+	printf("Encodings   %s\n", errors == before ? "ok" : "FAILED");
+	before = errors;
+	testcopies();
+	printf("Copies      %s\n", errors == before ? "ok" : "FAILED");
+	before = errors;
+	testframes();
+	printf("Frames      %s\n", errors == before ? "ok" : "FAILED");
+	before = errors;
+	testrotation();
+	printf("Rotation    %s\n", errors == before ? "ok" : "FAILED");
+	before = errors;
+	testreconnect();
+	printf("Reconnect   %s\n", errors == before ? "ok" : "FAILED");
+
+	disconnectdisplay();
+	gfxSemDestroy(&framesem);
+	return errors ? 1 : 0;
+}
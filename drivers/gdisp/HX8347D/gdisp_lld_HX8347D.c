@@ -164,6 +164,14 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	LLDSPEC	void gdisp_lld_write_color(GDisplay *g) {
 		write_ram16(g, gdispColor2Native(g->p.color));
 	}
+	LLDSPEC	void gdisp_lld_write_colors(GDisplay *g) {
+		const gColor	*p;
+		gCoord			n;
+
+		p = (const gColor *)g->p.ptr;
+		for(n = g->p.x2; n; n--)
+			write_ram16(g, gdispColor2Native(*p++));
+	}
 	LLDSPEC	void gdisp_lld_write_stop(GDisplay *g) {
 		busmode8(g);
 		release_bus(g);
@@ -13,6 +13,7 @@
 /*===========================================================================*/
 
 #define GDISP_HARDWARE_STREAM_WRITE		GFXON
+#define GDISP_HARDWARE_STREAM_WRITECOLORS	GFXON
 #define GDISP_HARDWARE_CONTROL			GFXON
 #define GDISP_HARDWARE_STREAM_POS		GFXON
 #define GDISP_HARDWARE_FILLS			GFXON
@@ -15,6 +15,7 @@
 /*===========================================================================*/
 
 #define GDISP_HARDWARE_STREAM_WRITE		GFXON
+#define GDISP_HARDWARE_STREAM_WRITECOLORS	GFXON
 //#define GDISP_HARDWARE_STREAM_READ		GFXON
 #define GDISP_HARDWARE_CONTROL			GFXON
 
@@ -247,6 +247,14 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	LLDSPEC	void gdisp_lld_write_color(GDisplay *g) {
 		write_pixel(g, gdispColor2Native(g->p.color));
 	}
+	LLDSPEC	void gdisp_lld_write_colors(GDisplay *g) {
+		const gColor	*p;
+		gCoord			n;
+
+		p = (const gColor *)g->p.ptr;
+		for(n = g->p.x2; n; n--)
+			write_pixel(g, gdispColor2Native(*p++));
+	}
 	LLDSPEC	void gdisp_lld_write_stop(GDisplay *g) {
 		release_bus(g);
 	}
@@ -156,6 +156,16 @@ LLDSPEC	void gdisp_lld_write_color(GDisplay *g)
 	write_data(g, gdispColor2Native(g->p.color));
 }
 
+LLDSPEC	void gdisp_lld_write_colors(GDisplay *g)
+{
+	const gColor	*p;
+	gCoord			n;
+
+	p = (const gColor *)g->p.ptr;
+	for(n = g->p.x2; n; n--)
+		write_data(g, gdispColor2Native(*p++));
+}
+
 LLDSPEC	void gdisp_lld_write_stop(GDisplay *g)
 {
 	release_bus(g);
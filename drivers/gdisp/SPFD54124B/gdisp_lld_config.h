@@ -22,6 +22,7 @@
 
 #define GDISP_HARDWARE_CONTROL		GFXON
 #define GDISP_HARDWARE_STREAM_WRITE	GFXON
+#define GDISP_HARDWARE_STREAM_WRITECOLORS	GFXON
 
 #define GDISP_LLD_PIXELFORMAT		GDISP_PIXELFORMAT_RGB565
 
@@ -145,10 +145,30 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 			write_data(g, c >> 8);
 			write_data(g, c);
 		}
+		LLDSPEC	void gdisp_lld_write_colors(GDisplay *g) {
+			const gColor	*p;
+			gCoord			n;
+			LLDCOLOR_TYPE	c;
+
+			p = (const gColor *)g->p.ptr;
+			for(n = g->p.x2; n; n--, p++) {
+				c = gdispColor2Native(*p);
+				write_data(g, c >> 8);
+				write_data(g, c);
+			}
+		}
 	#else
 		LLDSPEC	void gdisp_lld_write_color(GDisplay *g) {
 			write_data(g, gdispColor2Native(g->p.color));
 		}
+		LLDSPEC	void gdisp_lld_write_colors(GDisplay *g) {
+			const gColor	*p;
+			gCoord			n;
+
+			p = (const gColor *)g->p.ptr;
+			for(n = g->p.x2; n; n--)
+				write_data(g, gdispColor2Native(*p++));
+		}
 	#endif
 	LLDSPEC	void gdisp_lld_write_stop(GDisplay *g) {
 		release_bus(g);
@@ -16,6 +16,7 @@
 
 // This controller supports some optimized drawing routines - but no read (at least with SPI interfacing)
 #define GDISP_HARDWARE_STREAM_WRITE		GFXON
+#define GDISP_HARDWARE_STREAM_WRITECOLORS	GFXON
 #define GDISP_HARDWARE_FILLS			GFXON
 #define GDISP_HARDWARE_SCROLL			GFXON
 #define GDISP_HARDWARE_CONTROL			GFXON
@@ -156,6 +156,18 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		write_data(g, c >> 8);
 		write_data(g, c & 0xFF);
 	}
+	LLDSPEC	void gdisp_lld_write_colors(GDisplay *g) {
+		const gColor	*p;
+		gCoord			n;
+		LLDCOLOR_TYPE	c;
+
+		p = (const gColor *)g->p.ptr;
+		for(n = g->p.x2; n; n--, p++) {
+			c = gdispColor2Native(*p);
+			write_data(g, c >> 8);
+			write_data(g, c & 0xFF);
+		}
+	}
 	LLDSPEC	void gdisp_lld_write_stop(GDisplay *g) {
 		release_bus(g);
 	}
@@ -289,6 +289,18 @@ LLDSPEC	void gdisp_lld_write_color(GDisplay *g) {
 	write_data(g, c );
 }
 
+LLDSPEC	void gdisp_lld_write_colors(GDisplay *g) {
+	const gColor	*p;
+	gCoord			n;
+	LLDCOLOR_TYPE	c;
+
+	p = (const gColor *)g->p.ptr;
+	for(n = g->p.x2; n; n--, p++) {
+		c = gdispColor2Native(*p);
+		write_data(g, c);
+	}
+}
+
 LLDSPEC	void gdisp_lld_write_stop(GDisplay *g) {
 	release_bus(g);
 }
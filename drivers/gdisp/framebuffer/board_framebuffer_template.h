@@ -13,6 +13,10 @@
 // Uncomment this if your frame buffer device requires flushing
 //#define GDISP_HARDWARE_FLUSH		GFXON
 
+// Uncomment this as well if your frame buffer device can flush just part of the display.
+//	board_flush() is still called after the areas have been flushed.
+//#define GDISP_HARDWARE_FLUSHAREA	GFXON
+
 #ifdef GDISP_DRIVER_VMT
 
 	static void board_init(GDisplay *g, fbInfo *fbi) {
@@ -25,15 +29,44 @@
 		g->g.Contrast = 50;
 		fbi->linelen = g->g.Width * sizeof(LLDCOLOR_TYPE);				// bytes per row
 		fbi->pixels = 0;												// pointer to the memory frame buffer
+
+		// TODO: If using double buffering and your device can flip between display pages
+		//			set these and implement board_flip(). Otherwise the back buffer is
+		//			allocated in memory and copied to the frame buffer when flushed.
+		#if GDISP_NEED_DOUBLEBUFFER
+			fbi->pages = 0;												// number of display pages (starting at fbi->pixels)
+			fbi->pagelen = 0;											// bytes from one display page to the next
+		#endif
 	}
 
-	#if GDISP_HARDWARE_FLUSH
+	#if GDISP_NEED_DOUBLEBUFFER
+		static void board_flip(GDisplay *g, unsigned page) {
+			// TODO: Show this display page. Only called if fbi->pages was set.
+			//			For double buffering (GDISP_DOUBLEBUFFER_PAGES == 2) don't return until the page is being shown.
+			//			For triple buffering wait for any previous flip to complete and then return straight away.
+			(void) g;
+			(void) page;
+		}
+	#endif
+
+	#if FB_BOARD_FLUSH
 		static void board_flush(GDisplay *g) {
 			// TODO: Can be an empty function if your hardware doesn't support this
 			(void) g;
 		}
 	#endif
 
+	#if FB_BOARD_FLUSHAREA && GDISP_NEED_DIRTYRECTS
+		static void board_flush_area(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+			// TODO: Flush this area. It is in frame buffer (un-rotated) coordinates.
+			(void) g;
+			(void) x;
+			(void) y;
+			(void) cx;
+			(void) cy;
+		}
+	#endif
+
 	#if GDISP_NEED_CONTROL
 		static void board_backlight(GDisplay *g, gU8 percent) {
 			// TODO: Can be an empty function if your hardware doesn't support this
@@ -17,10 +17,43 @@
 #define GDISP_HARDWARE_DRAWPIXEL		GFXON
 #define GDISP_HARDWARE_PIXELREAD		GFXON
 #define GDISP_HARDWARE_CONTROL			GFXON
+#define GDISP_HARDWARE_CLEARS			GFXON
+#define GDISP_HARDWARE_FILLS			GFXON
+#define GDISP_HARDWARE_BITFILLS			GFXON
+#define GDISP_HARDWARE_SCROLL			GFXON
+#define GDISP_HARDWARE_COPY				GFXON
 
 // Any other support comes from the board file
 #include "board_framebuffer.h"
 
+// Remember what flushing the board itself needs
+#if GDISP_HARDWARE_FLUSH
+	#define FB_BOARD_FLUSH				GFXON
+#else
+	#define FB_BOARD_FLUSH				GFXOFF
+#endif
+#if GDISP_HARDWARE_FLUSHAREA
+	#define FB_BOARD_FLUSHAREA			GFXON
+#else
+	#define FB_BOARD_FLUSHAREA			GFXOFF
+#endif
+
+// Double buffering presents each frame when the display is flushed
+#if GDISP_NEED_DOUBLEBUFFER
+	#undef GDISP_HARDWARE_FLUSH
+	#define GDISP_HARDWARE_FLUSH		GFXON
+	#undef GDISP_HARDWARE_FLUSHAREA
+	#define GDISP_HARDWARE_FLUSHAREA	GFXON
+#endif
+
+// A worker thread does blits and shows double buffered frames in the background
+#if GDISP_NEED_ASYNC
+	#define GDISP_HARDWARE_BITFILLSASYNC	GFXON
+	#if GDISP_NEED_DOUBLEBUFFER
+		#define GDISP_HARDWARE_FLUSHASYNC	GFXON
+	#endif
+#endif
+
 #ifndef GDISP_LLD_PIXELFORMAT
 	#error "GDISP FrameBuffer: You must specify a GDISP_LLD_PIXELFORMAT in your board_framebuffer.h or your makefile"
 #endif
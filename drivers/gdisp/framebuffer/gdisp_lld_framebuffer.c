@@ -10,18 +10,71 @@
 #if GFX_USE_GDISP
 
 #define GDISP_DRIVER_VMT			GDISPVMT_framebuffer
+#define GDISP_DRIVER_VMT_FLAGS		GDISP_VFLG_CONCURRENT
 #include "gdisp_lld_config.h"
 #include "../../../src/gdisp/gdisp_driver.h"
+#include "../../../src/gdisp/gdisp_render.h"
 
 typedef struct fbInfo {
 	void *			pixels;			// The pixel buffer
 	gCoord			linelen;		// The number of bytes per display line
+	#if GDISP_NEED_DOUBLEBUFFER
+		unsigned	pages;			// The number of display pages the board can flip between (0 if it can't)
+		size_t		pagelen;		// The number of bytes from one display page to the next
+	#endif
 	} fbInfo;
 
 #include "board_framebuffer.h"
+#include <string.h>					// For memset, memcpy and memmove
+
+#if GDISP_NEED_DOUBLEBUFFER
+	typedef struct fbArea {
+		gCoord		x, y, cx, cy;	// An area in frame buffer (un-rotated) coordinates
+		} fbArea;
+
+	#if GDISP_DOUBLEBUFFER_PAGES < 2
+		#error "GDISP Framebuffer: GDISP_DOUBLEBUFFER_PAGES must be at least 2"
+	#endif
+
+	// The number of previous frames a display page can miss while it is not being drawn on
+	#define FB_MISSED		(GDISP_DOUBLEBUFFER_PAGES-1)
+
+	// The maximum number of areas recorded for a frame
+	#if GDISP_NEED_DIRTYRECTS
+		#define FB_AREAS	GDISP_DIRTYRECTS_MAX
+	#else
+		#define FB_AREAS	1
+	#endif
+#endif
+
+#if GDISP_NEED_ASYNC
+	#ifndef FB_ASYNC_STACKSIZE
+		#define FB_ASYNC_STACKSIZE	1024
+	#endif
+
+	typedef struct fbBlit {
+		gCoord			x, y, cx, cy;	// The display (rotated) area
+		gCoord			srccx;			// The width of a source line
+		const gPixel *	src;			// The first source pixel
+		} fbBlit;
+#endif
 
 typedef struct fbPriv {
-	fbInfo			fbi;			// Display information
+	fbInfo			fbi;			// Display information. fbi.pixels is where we draw.
+	#if GDISP_NEED_DOUBLEBUFFER
+		void *		front;			// The pixels being shown
+		unsigned	page;			// The page we are drawing on (when the board can flip pages)
+		int			cnt[FB_MISSED];	// The number of areas changed in each recent frame (-1 = everything)
+		fbArea		area[FB_MISSED][FB_AREAS];
+	#endif
+	#if GDISP_NEED_ASYNC
+		gMutex		asynclock;		// Protects the requests below
+		gSem		asyncwake;		// Wakes the worker thread when there is a request
+		gBool		flushreq;		// Show a frame
+		int			flushpage;		//	the page to flip to (-1 = no flip)
+		gBool		blitreq;		// Blit an area
+		fbBlit		blit;
+	#endif
 	} fbPriv;
 
 /*===========================================================================*/
@@ -30,6 +83,238 @@ typedef struct fbPriv {
 
 #define PIXIL_POS(g, x, y)		((y) * ((fbPriv *)(g)->priv)->fbi.linelen + (x) * sizeof(LLDCOLOR_TYPE))
 #define PIXEL_ADDR(g, pos)		((LLDCOLOR_TYPE *)(((char *)((fbPriv *)(g)->priv)->fbi.pixels)+pos))
+#define LINELEN(g)				(((fbPriv *)(g)->priv)->fbi.linelen)
+
+// Fill a rectangle specified in frame buffer (un-rotated) coordinates.
+//	The first row is filled and then replicated into the remaining rows.
+static void fb_fillphys(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, LLDCOLOR_TYPE c) {
+	char	*first, *p;
+	size_t	len;
+
+	first = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y));
+	len = (size_t)cx * sizeof(LLDCOLOR_TYPE);
+
+	// If the whole display line is being filled and every byte of the color is identical
+	//	(always true for 8 bit pixels, common for black and white) we can do it in one hit.
+	#if LLDCOLOR_TYPE_BITS == 8
+		if ((gCoord)len == LINELEN(g)) {
+			memset(first, c, len * cy);
+			return;
+		}
+	#else
+		if ((gCoord)len == LINELEN(g) && c == (LLDCOLOR_TYPE)(((LLDCOLOR_TYPE)-1 / 0xFF) * (c & 0xFF))) {
+			memset(first, c & 0xFF, len * cy);
+			return;
+		}
+	#endif
+
+	gdispRenderFill(first, 0, cx, c);
+	for(p = first + LINELEN(g); --cy > 0; p += LINELEN(g))
+		memcpy(p, first, len);
+}
+
+#if GDISP_NEED_CONTROL
+	// Convert a display (rotated) area into frame buffer (un-rotated) coordinates
+	static void fb_rotatearea(GDisplay *g, gCoord *x, gCoord *y, gCoord *cx, gCoord *cy) {
+		gCoord	t;
+
+		switch(g->g.Orientation) {
+		case gOrientation0:
+		default:
+			break;
+		case gOrientation90:
+			t = *x;
+			*x = *y;
+			*y = g->g.Width - t - *cx;
+			t = *cx; *cx = *cy; *cy = t;
+			break;
+		case gOrientation180:
+			*x = g->g.Width - *x - *cx;
+			*y = g->g.Height - *y - *cy;
+			break;
+		case gOrientation270:
+			t = *y;
+			*y = *x;
+			*x = g->g.Height - t - *cy;
+			t = *cx; *cx = *cy; *cy = t;
+			break;
+		}
+	}
+#endif
+
+#if GDISP_NEED_DOUBLEBUFFER
+	// Copy a frame buffer (un-rotated) area from one display page to another
+	static void fb_copyarea(GDisplay *g, void *dst, const void *src, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		size_t	pos, len;
+
+		pos = PIXIL_POS(g, x, y);
+		len = (size_t)cx * sizeof(LLDCOLOR_TYPE);
+		if ((gCoord)len == LINELEN(g)) {
+			memcpy((char *)dst + pos, (const char *)src + pos, len * cy);
+			return;
+		}
+		for(; cy > 0; cy--, pos += LINELEN(g))
+			memcpy((char *)dst + pos, (const char *)src + pos, len);
+	}
+
+	// Copy a whole display page
+	static void fb_copyall(GDisplay *g, void *dst, const void *src) {
+		#if GDISP_NEED_CONTROL
+			if (g->g.Orientation == gOrientation90 || g->g.Orientation == gOrientation270) {
+				memcpy(dst, src, (size_t)LINELEN(g) * g->g.Width);
+				return;
+			}
+		#endif
+		memcpy(dst, src, (size_t)LINELEN(g) * g->g.Height);
+	}
+#endif
+
+// Copy pixels to a display (rotated) area
+static void fb_blit(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const gPixel *src, gCoord srccx) {
+	char			*dst;
+	int				pixadd, lineadd;
+	gCoord			i, j;
+
+	// Work out where the first pixel goes and how to step across a row and down a column
+	#if GDISP_NEED_CONTROL
+		switch(g->g.Orientation) {
+		case gOrientation0:
+		default:
+			dst = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y));
+			pixadd = sizeof(LLDCOLOR_TYPE);
+			lineadd = LINELEN(g);
+			break;
+		case gOrientation90:
+			dst = (char *)PIXEL_ADDR(g, PIXIL_POS(g, y, g->g.Width-x-1));
+			pixadd = -LINELEN(g);
+			lineadd = sizeof(LLDCOLOR_TYPE);
+			break;
+		case gOrientation180:
+			dst = (char *)PIXEL_ADDR(g, PIXIL_POS(g, g->g.Width-x-1, g->g.Height-y-1));
+			pixadd = -(int)sizeof(LLDCOLOR_TYPE);
+			lineadd = -LINELEN(g);
+			break;
+		case gOrientation270:
+			dst = (char *)PIXEL_ADDR(g, PIXIL_POS(g, g->g.Height-y-1, x));
+			pixadd = LINELEN(g);
+			lineadd = -(int)sizeof(LLDCOLOR_TYPE);
+			break;
+		}
+	#else
+		dst = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y));
+		pixadd = sizeof(LLDCOLOR_TYPE);
+		lineadd = LINELEN(g);
+	#endif
+
+	// Un-rotated rows go straight across
+	if (pixadd == sizeof(LLDCOLOR_TYPE)) {
+		// ...using the pixel kernels if they support the conversion
+		#if GDISP_PIXELFORMAT != GDISP_LLD_PIXELFORMAT && GDISP_NEED_PIXELKERNELS && !GDISP_HARDWARE_USE_EXACT_COLOR
+			gdispKernelConvertFn	conv;
+
+			if ((conv = gdispKernelGetConverter(GDISP_LLD_PIXELFORMAT, GDISP_PIXELFORMAT))) {
+				for(j = 0; j < cy; j++, src += srccx, dst += lineadd)
+					conv(dst, src, cx);
+				return;
+			}
+		#endif
+		for(j = 0; j < cy; j++, src += srccx, dst += lineadd)
+			gdispRenderBlit(dst, 0, src, cx);
+		return;
+	}
+
+	for(j = 0; j < cy; j++, src += srccx, dst += lineadd) {
+		char	*d;
+
+		for(d = dst, i = 0; i < cx; i++, d += pixadd)
+			*(LLDCOLOR_TYPE *)d = gdispColor2Native(src[i]);
+	}
+}
+
+#if GDISP_HARDWARE_FLUSH && GDISP_NEED_DOUBLEBUFFER
+	// Move on to the next frame once the one drawn is on its way to the display
+	static void fb_nextframe(GDisplay *g) {
+		fbPriv	*priv;
+		int		i, j;
+
+		priv = (fbPriv *)g->priv;
+
+		// No areas means we don't know what changed
+		if (!priv->cnt[0])
+			priv->cnt[0] = -1;
+
+		if (priv->fbi.pages) {
+			// Move on to the next page
+			priv->front = priv->fbi.pixels;
+			priv->fbi.pixels = (char *)priv->fbi.pixels - priv->page * priv->fbi.pagelen;
+			if (++priv->page >= priv->fbi.pages)
+				priv->page = 0;
+			priv->fbi.pixels = (char *)priv->fbi.pixels + priv->page * priv->fbi.pagelen;
+
+			// Bring the new page up to date with the frames drawn since it was last shown
+			for(i = 0; i < (int)priv->fbi.pages - 1; i++) {
+				if (priv->cnt[i] < 0) {
+					fb_copyall(g, priv->fbi.pixels, priv->front);
+					break;
+				}
+				for(j = 0; j < priv->cnt[i]; j++)
+					fb_copyarea(g, priv->fbi.pixels, priv->front, priv->area[i][j].x, priv->area[i][j].y, priv->area[i][j].cx, priv->area[i][j].cy);
+			}
+			for(i = FB_MISSED-1; i > 0; i--) {
+				priv->cnt[i] = priv->cnt[i-1];
+				memcpy(priv->area[i], priv->area[i-1], sizeof(priv->area[i]));
+			}
+
+		// The areas have already been copied if we got them
+		} else if (priv->cnt[0] < 0)
+			fb_copyall(g, priv->front, priv->fbi.pixels);
+
+		priv->cnt[0] = 0;
+	}
+#endif
+
+#if GDISP_NEED_ASYNC
+	// Does the slow part of background flushes and blits
+	static GFX_THREAD_FUNCTION(fb_asyncthread, param) {
+		GDisplay	*g;
+		fbPriv		*priv;
+		gBool		flush, blit;
+		int			page;
+		fbBlit		b;
+
+		g = (GDisplay *)param;
+		priv = (fbPriv *)g->priv;
+		while(1) {
+			gfxSemWait(&priv->asyncwake, gDelayForever);
+
+			gfxMutexEnter(&priv->asynclock);
+			flush = priv->flushreq;
+			page = priv->flushpage;
+			blit = priv->blitreq;
+			b = priv->blit;
+			priv->flushreq = priv->blitreq = gFalse;
+			gfxMutexExit(&priv->asynclock);
+
+			if (blit) {
+				fb_blit(g, b.x, b.y, b.cx, b.cy, b.src, b.srccx);
+				_gdispBlitDone(g);
+			}
+			if (flush) {
+				#if GDISP_NEED_DOUBLEBUFFER
+					if (page >= 0)
+						board_flip(g, page);
+				#else
+					(void) page;
+				#endif
+				#if FB_BOARD_FLUSH
+					board_flush(g);
+				#endif
+				_gdispFlushDone(g);
+			}
+		}
+		gfxThreadReturn(0);
+	}
+#endif
 
 /*===========================================================================*/
 /* Driver exported functions.                                                */
@@ -42,6 +327,10 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		gfxHalt("GDISP Framebuffer: Failed to allocate private memory");
 	((fbPriv *)g->priv)->fbi.pixels = 0;
 	((fbPriv *)g->priv)->fbi.linelen = 0;
+	#if GDISP_NEED_DOUBLEBUFFER
+		((fbPriv *)g->priv)->fbi.pages = 0;
+		((fbPriv *)g->priv)->fbi.pagelen = 0;
+	#endif
 
 	// Initialize the GDISP structure
 	g->g.Orientation = gOrientation0;
@@ -49,12 +338,131 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	g->board = 0;							// preinitialize
 	board_init(g, &((fbPriv *)g->priv)->fbi);
 
+	// Set up the page we draw on
+	#if GDISP_NEED_DOUBLEBUFFER
+		{
+			fbPriv	*priv;
+			int		i;
+
+			priv = (fbPriv *)g->priv;
+			priv->front = priv->fbi.pixels;
+			for(i = 0; i < FB_MISSED; i++)
+				priv->cnt[i] = -1;
+
+			// Best is to draw on a hidden display page and flip to it
+			if (priv->fbi.pages >= 2) {
+				if (priv->fbi.pages > GDISP_DOUBLEBUFFER_PAGES)
+					priv->fbi.pages = GDISP_DOUBLEBUFFER_PAGES;
+				priv->page = 1;
+				priv->fbi.pixels = (char *)priv->front + priv->fbi.pagelen;
+
+			// Otherwise draw in memory and copy it to the display
+			} else {
+				priv->fbi.pages = 0;
+				priv->page = 0;
+				if (!(priv->fbi.pixels = gfxAlloc((size_t)priv->fbi.linelen * g->g.Height)))
+					gfxHalt("GDISP Framebuffer: Failed to allocate the back buffer");
+			}
+		}
+	#endif
+
+	// Start the thread that does background flushes and blits
+	#if GDISP_NEED_ASYNC
+		{
+			fbPriv	*priv;
+			gThread	t;
+
+			priv = (fbPriv *)g->priv;
+			gfxMutexInit(&priv->asynclock);
+			gfxSemInit(&priv->asyncwake, 0, gSemMaxCount);
+			priv->flushreq = priv->blitreq = gFalse;
+			if (!(t = gfxThreadCreate(0, FB_ASYNC_STACKSIZE, gThreadpriorityHigh, fb_asyncthread, g)))
+				gfxHalt("GDISP Framebuffer: Failed to start the background thread");
+			gfxThreadClose(t);
+		}
+	#endif
+
 	return gTrue;
 }
 
 #if GDISP_HARDWARE_FLUSH
 	LLDSPEC void gdisp_lld_flush(GDisplay *g) {
-		board_flush(g);
+		#if GDISP_NEED_DOUBLEBUFFER
+			// Show the page we have been drawing on
+			if (((fbPriv *)g->priv)->fbi.pages)
+				board_flip(g, ((fbPriv *)g->priv)->page);
+			fb_nextframe(g);
+		#endif
+		#if FB_BOARD_FLUSH
+			board_flush(g);
+		#endif
+	}
+#endif
+
+#if GDISP_HARDWARE_FLUSHASYNC && GDISP_NEED_ASYNC
+	LLDSPEC void gdisp_lld_flush_async(GDisplay *g) {
+		fbPriv	*priv;
+		int		page;
+
+		priv = (fbPriv *)g->priv;
+
+		// With only two pages the page we draw on next is being shown until the flip completes
+		if (priv->fbi.pages == 2) {
+			gdisp_lld_flush(g);
+			_gdispFlushDone(g);
+			return;
+		}
+
+		// Get the next page ready to draw on and leave the worker to show this one
+		page = priv->fbi.pages ? (int)priv->page : -1;
+		fb_nextframe(g);
+		gfxMutexEnter(&priv->asynclock);
+		priv->flushpage = page;
+		priv->flushreq = gTrue;
+		gfxMutexExit(&priv->asynclock);
+		gfxSemSignal(&priv->asyncwake);
+	}
+#endif
+
+#if GDISP_HARDWARE_FLUSHAREA && GDISP_NEED_DIRTYRECTS
+	LLDSPEC void gdisp_lld_flush_area(GDisplay *g) {
+		gCoord	x, y, cx, cy;
+
+		x = g->p.x; y = g->p.y;
+		cx = g->p.cx; cy = g->p.cy;
+		#if GDISP_NEED_CONTROL
+			fb_rotatearea(g, &x, &y, &cx, &cy);
+		#endif
+
+		#if GDISP_NEED_DOUBLEBUFFER
+			{
+				fbPriv	*priv;
+
+				priv = (fbPriv *)g->priv;
+
+				// Remember the area so the other pages can be brought up to date
+				if (priv->fbi.pages) {
+					if (priv->cnt[0] >= 0 && priv->cnt[0] < FB_AREAS) {
+						priv->area[0][priv->cnt[0]].x = x;
+						priv->area[0][priv->cnt[0]].y = y;
+						priv->area[0][priv->cnt[0]].cx = cx;
+						priv->area[0][priv->cnt[0]].cy = cy;
+						priv->cnt[0]++;
+					} else
+						priv->cnt[0] = -1;
+					return;
+				}
+
+				// Copy it to the display
+				fb_copyarea(g, priv->front, priv->fbi.pixels, x, y, cx, cy);
+				if (priv->cnt[0] >= 0)
+					priv->cnt[0]++;
+			}
+		#endif
+
+		#if FB_BOARD_FLUSHAREA
+			board_flush_area(g, x, y, cx, cy);
+		#endif
 	}
 #endif
 
@@ -112,6 +520,154 @@ LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
 	return gdispNative2Color(color);
 }
 
+LLDSPEC void gdisp_lld_clear(GDisplay *g) {
+	#if GDISP_NEED_CONTROL
+		if (g->g.Orientation == gOrientation90 || g->g.Orientation == gOrientation270) {
+			fb_fillphys(g, 0, 0, g->g.Height, g->g.Width, gdispColor2Native(g->p.color));
+			return;
+		}
+	#endif
+	fb_fillphys(g, 0, 0, g->g.Width, g->g.Height, gdispColor2Native(g->p.color));
+}
+
+LLDSPEC void gdisp_lld_fill_area(GDisplay *g) {
+	gCoord	x, y, cx, cy;
+
+	x = g->p.x; y = g->p.y;
+	cx = g->p.cx; cy = g->p.cy;
+	#if GDISP_NEED_CONTROL
+		fb_rotatearea(g, &x, &y, &cx, &cy);
+	#endif
+	fb_fillphys(g, x, y, cx, cy, gdispColor2Native(g->p.color));
+}
+
+LLDSPEC void gdisp_lld_blit_area(GDisplay *g) {
+	fb_blit(g, g->p.x, g->p.y, g->p.cx, g->p.cy, (const gPixel *)g->p.ptr + g->p.y1 * g->p.x2 + g->p.x1, g->p.x2);
+}
+
+#if GDISP_NEED_ASYNC
+	LLDSPEC void gdisp_lld_blit_area_async(GDisplay *g) {
+		fbPriv	*priv;
+
+		priv = (fbPriv *)g->priv;
+		gfxMutexEnter(&priv->asynclock);
+		priv->blit.x = g->p.x;
+		priv->blit.y = g->p.y;
+		priv->blit.cx = g->p.cx;
+		priv->blit.cy = g->p.cy;
+		priv->blit.srccx = g->p.x2;
+		priv->blit.src = (const gPixel *)g->p.ptr + g->p.y1 * g->p.x2 + g->p.x1;
+		priv->blitreq = gTrue;
+		gfxMutexExit(&priv->asynclock);
+		gfxSemSignal(&priv->asyncwake);
+	}
+#endif
+
+#if GDISP_NEED_SCROLL
+	// Move rows up (lines > 0) or down (lines < 0) within a frame buffer (un-rotated) area
+	static void fb_vscroll(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord lines) {
+		char	*p;
+		size_t	len;
+		int		lineadd;
+
+		len = (size_t)cx * sizeof(LLDCOLOR_TYPE);
+		if (lines > 0) {
+			p = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y));
+			lineadd = LINELEN(g);
+		} else {
+			p = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y+cy-1));
+			lineadd = -LINELEN(g);
+			lines = -lines;
+		}
+		for(cy -= lines; cy > 0; cy--, p += lineadd)
+			memcpy(p, p + lines * lineadd, len);
+	}
+
+	// Move columns left (cols > 0) or right (cols < 0) within a frame buffer (un-rotated) area
+	static void fb_hscroll(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord cols) {
+		char	*p;
+		size_t	len;
+
+		if (cols > 0) {
+			p = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y));
+			len = (size_t)(cx - cols) * sizeof(LLDCOLOR_TYPE);
+			for(; cy > 0; cy--, p += LINELEN(g))
+				memmove(p, p + cols * sizeof(LLDCOLOR_TYPE), len);
+		} else {
+			p = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y));
+			len = (size_t)(cx + cols) * sizeof(LLDCOLOR_TYPE);
+			for(; cy > 0; cy--, p += LINELEN(g))
+				memmove(p - cols * sizeof(LLDCOLOR_TYPE), p, len);
+		}
+	}
+
+	LLDSPEC void gdisp_lld_vertical_scroll(GDisplay *g) {
+		gCoord	x, y, cx, cy;
+
+		x = g->p.x; y = g->p.y;
+		cx = g->p.cx; cy = g->p.cy;
+		#if GDISP_NEED_CONTROL
+			fb_rotatearea(g, &x, &y, &cx, &cy);
+			switch(g->g.Orientation) {
+			case gOrientation0:
+			default:
+				fb_vscroll(g, x, y, cx, cy, g->p.y1);
+				break;
+			case gOrientation90:
+				fb_hscroll(g, x, y, cx, cy, g->p.y1);
+				break;
+			case gOrientation180:
+				fb_vscroll(g, x, y, cx, cy, -g->p.y1);
+				break;
+			case gOrientation270:
+				fb_hscroll(g, x, y, cx, cy, -g->p.y1);
+				break;
+			}
+		#else
+			fb_vscroll(g, x, y, cx, cy, g->p.y1);
+		#endif
+	}
+#endif
+
+#if GDISP_NEED_COPYAREA
+	// Move a frame buffer (un-rotated) area from sx,sy to x,y. The areas may overlap.
+	static void fb_movearea(GDisplay *g, gCoord sx, gCoord sy, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		char	*p;
+		size_t	len;
+		int		offset, lineadd;
+
+		len = (size_t)cx * sizeof(LLDCOLOR_TYPE);
+		offset = (sy - y) * LINELEN(g) + (sx - x) * (int)sizeof(LLDCOLOR_TYPE);
+		if (y > sy) {
+			p = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y+cy-1));
+			lineadd = -LINELEN(g);
+		} else {
+			p = (char *)PIXEL_ADDR(g, PIXIL_POS(g, x, y));
+			lineadd = LINELEN(g);
+		}
+		for(; cy > 0; cy--, p += lineadd)
+			memmove(p, p + offset, len);
+	}
+
+	LLDSPEC void gdisp_lld_copy_area(GDisplay *g) {
+		gCoord	x, y, cx, cy, sx, sy;
+
+		x = g->p.x; y = g->p.y;
+		cx = g->p.cx; cy = g->p.cy;
+		sx = g->p.x1; sy = g->p.y1;
+		#if GDISP_NEED_CONTROL
+			{
+				gCoord	scx, scy;
+
+				scx = cx; scy = cy;
+				fb_rotatearea(g, &x, &y, &cx, &cy);
+				fb_rotatearea(g, &sx, &sy, &scx, &scy);
+			}
+		#endif
+		fb_movearea(g, sx, sy, x, y, cx, cy);
+	}
+#endif
+
 #if GDISP_NEED_CONTROL
 	LLDSPEC void gdisp_lld_control(GDisplay *g) {
 		switch(g->p.x) {
@@ -15,6 +15,7 @@
 #include <sys/mman.h>
 #include <sys/wait.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <signal.h>
 #include <semaphore.h>
@@ -23,6 +24,7 @@
 #define GDISP_DRIVER_VMT				GDISPVMT_SDL
 #include "gdisp_lld_config.h"
 #include "../../../src/gdisp/gdisp_driver.h"
+#include "../../../src/gdisp/gdisp_render.h"
 
 #ifndef GDISP_FORCE_24BIT
 	#define GDISP_FORCE_24BIT			GFXOFF
@@ -33,6 +35,16 @@
 #ifndef GDISP_SCREEN_HEIGHT
 	#define GDISP_SCREEN_HEIGHT			480
 #endif
+#ifndef GDISP_SDL_DIRTY_RECTS
+	/**
+	 * The number of separate changed areas remembered between window updates.
+	 * When there are more the nearest ones are merged.
+	 */
+	#define GDISP_SDL_DIRTY_RECTS		16
+#endif
+#if GDISP_SDL_DIRTY_RECTS < 1
+	#error "GDISP SDL: GDISP_SDL_DIRTY_RECTS must be at least 1"
+#endif
 
 #if GINPUT_NEED_MOUSE
 	// Include mouse support code
@@ -155,11 +167,17 @@
 	static GKeyboard *keyboard = 0;
 #endif
 
+// A list of changed areas
+typedef struct SDL_DirtyList {
+	int			cnt;
+	SDL_Rect	r[GDISP_SDL_DIRTY_RECTS];
+} SDL_DirtyList;
+
 // shared IPC context
 struct SDL_UGFXContext {
 	gU32 	framebuf[GDISP_SCREEN_WIDTH*GDISP_SCREEN_HEIGHT];
-	gI16		need_redraw;
-	int		minx,miny,maxx,maxy;
+	gI16		need_redraw;		// The SDL process has been woken to upload the dirty areas
+	SDL_DirtyList	dirty;		// The areas of framebuf changed since the last upload
 #if GINPUT_NEED_MOUSE
 	gCoord 	mousex, mousey;
 	gU16 	buttons;
@@ -173,38 +191,116 @@ struct SDL_UGFXContext {
 static struct SDL_UGFXContext *context;
 static sem_t *ctx_mutex;
 static sem_t *input_event;
+static sem_t *redraw_event;
 
 #define CTX_MUTEX_NAME 		"ugfx_ctx_mutex"
 #define INPUT_EVENT_NAME 	"ugfx_input_event"
+#define REDRAW_EVENT_NAME 	"ugfx_redraw_event"
+
+// Add an area to a list. Areas are merged when that covers no more than they do separately
+//	or when the list is full.
+static void SDL_dirtyAdd (SDL_DirtyList *d, int x, int y, int w, int h) {
+	SDL_Rect n, u;
+	int i, best, grow, bestgrow;
+
+	n.x = x;
+	n.y = y;
+	n.w = w;
+	n.h = h;
+	best = 0;
+	bestgrow = 0x7FFFFFFF;
+	for (i = 0; i < d->cnt; ++i) {
+		SDL_UnionRect (&d->r[i], &n, &u);
+		grow = u.w*u.h - d->r[i].w*d->r[i].h;
+		if (grow <= w*h) {
+			d->r[i] = u;
+			return;
+		}
+		if (grow < bestgrow) {
+			bestgrow = grow;
+			best = i;
+		}
+	}
+	if (d->cnt < GDISP_SDL_DIRTY_RECTS)
+		d->r[d->cnt++] = n;
+	else
+		SDL_UnionRect (&d->r[best], &n, &d->r[best]);
+}
+
+// Wake the SDL process to upload the dirty areas. The caller holds ctx_mutex.
+static void SDL_wake (void) {
+	if (!context->need_redraw) {
+		context->need_redraw = 1;
+		sem_post (redraw_event);
+	}
+}
 
+// Turn redraw notifications from the uGFX process into SDL events
+static int SDL_redraw_event_loop (void *param) {
+	SDL_Event event;
+
+	SDL_zero (event);
+	event.type = (Uint32)(uintptr_t)param;
+	for (;;) {
+		sem_wait (redraw_event);
+		SDL_PushEvent (&event);
+	}
+	return 0;
+}
 
 static int SDL_loop (void) {
 	SDL_Window   *window = SDL_CreateWindow("uGFX", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT, 0);
 	SDL_Renderer *render = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-	SDL_Texture  *texture = SDL_CreateTexture(render, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT);
+	SDL_Texture  *texture = SDL_CreateTexture(render, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT);
+	Uint32 redraw_type = SDL_RegisterEvents(1);
 	int done = 0;
+	int upload = 1;
+	int present = 1;
+
+	SDL_DetachThread (SDL_CreateThread(SDL_redraw_event_loop, "uGFX redraw", (void *)(uintptr_t)redraw_type));
 
 	while  (!done) {
-		
-		if (context->need_redraw) {
+		if (upload) {
+			int i, y, pitch;
+			gU8 *pixels;
+			const SDL_Rect *r;
+
+			// Only the changed areas are written to the texture
+			sem_wait (ctx_mutex);
+			for (i = 0; i < context->dirty.cnt; ++i) {
+				r = &context->dirty.r[i];
+				if (SDL_LockTexture(texture, r, (void **)&pixels, &pitch))
+					continue;
+				for (y = 0; y < r->h; ++y, pixels += pitch)
+					memcpy (pixels, context->framebuf+(r->y+y)*GDISP_SCREEN_WIDTH+r->x, r->w*sizeof(gU32));
+				SDL_UnlockTexture(texture);
+			}
+			context->dirty.cnt = 0;
 			context->need_redraw = 0;
-			SDL_Rect r;
-			r.x = context->minx;
-			r.y = context->miny;
-			r.w = context->maxx - context->minx + 1;
-			r.h = context->maxy - context->miny + 1;
-			context->minx = GDISP_SCREEN_WIDTH;
-			context->miny = GDISP_SCREEN_HEIGHT;
-			context->maxx = 0;
-			context->maxy = 0;
-			
-			SDL_UpdateTexture(texture, &r, context->framebuf+r.y*GDISP_SCREEN_WIDTH+r.x, GDISP_SCREEN_WIDTH*sizeof(gU32));
+			sem_post (ctx_mutex);
+			upload = 0;
+			present = 1;
+		}
+		if (present) {
 			SDL_RenderCopy(render, texture, 0, 0);
 			SDL_RenderPresent(render);
+			present = 0;
 		}
+
+		// Sleep until there is something to do
 		SDL_Event event;
-		for (; SDL_PollEvent(&event); ){
+		if (!SDL_WaitEvent(&event))
+			continue;
+		do {
+			if (event.type == redraw_type) {
+				upload = 1;
+				continue;
+			}
 			switch(event.type){
+			case SDL_WINDOWEVENT:
+				if (event.window.event == SDL_WINDOWEVENT_EXPOSED)
+					present = 1;
+				break;
 #if GINPUT_NEED_MOUSE
 #if 0
 			// On osx event contains coordinates of touchpad. We can't use them, we screen coordinates. 
@@ -281,8 +377,7 @@ static int SDL_loop (void) {
 			default:
 				break;
 			}
-		}
-		SDL_Delay(40);
+		} while (SDL_PollEvent(&event));
 	}
 	
 	SDL_DestroyTexture (texture);
@@ -334,6 +429,13 @@ void sdl_driver_init (void) {
 		perror("Failed init semaphore");
 		exit(1);
 	}
+
+	// Create event for redraw notifications to the SDL process
+	sem_unlink (REDRAW_EVENT_NAME);
+	if((redraw_event = sem_open(REDRAW_EVENT_NAME,O_CREAT,0666,0)) == SEM_FAILED) {
+		perror("Failed init semaphore");
+		exit(1);
+	}
 	pid_t gui_pid = fork ();
 
 	if (gui_pid) {
@@ -341,10 +443,7 @@ void sdl_driver_init (void) {
 		int status;
 		memset (context,0,sizeof (*context));
 		context->need_redraw = 1;
-		context->maxx = GDISP_SCREEN_WIDTH-1;
-		context->maxy = GDISP_SCREEN_HEIGHT-1;
-		context->minx = 0;
-		context->miny = 0;
+		SDL_dirtyAdd (&context->dirty, 0, 0, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT);
 		SDL_loop ();
 		// cleanup
 		kill(gui_pid,SIGKILL);
@@ -355,6 +454,8 @@ void sdl_driver_init (void) {
 		sem_unlink (CTX_MUTEX_NAME);
 		sem_close (input_event);
 		sem_unlink (INPUT_EVENT_NAME);
+		sem_close (redraw_event);
+		sem_unlink (REDRAW_EVENT_NAME);
 		exit (0);
 	}
 	
@@ -366,9 +467,58 @@ void sdl_driver_init (void) {
 }
 
 
+#if GDISP_NEED_DOUBLEBUFFER
+	// We draw here and copy the changed area to the shared frame buffer when flushed
+	static gU32	*backbuf;
+	static SDL_DirtyList	drawdirty;
+	#define SDL_DRAWBUF		backbuf
+
+	#if GDISP_NEED_ASYNC
+		// A background flush copies the changed areas here and a thread waits for the SDL process
+		static gU32	*stagebuf;
+		static SDL_DirtyList	stagedirty;
+		static gSem	stagewake;
+	#endif
+#else
+	#define SDL_DRAWBUF		context->framebuf
+#endif
+
+#if GDISP_NEED_DOUBLEBUFFER && GDISP_NEED_ASYNC
+	static void SDL_present (const gU32 *buf, const SDL_DirtyList *d);
+
+	static GFX_THREAD_FUNCTION(SDL_flushthread, param) {
+		GDisplay *g = (GDisplay *)param;
+
+		while (1) {
+			gfxSemWait (&stagewake, gDelayForever);
+			SDL_present (stagebuf, &stagedirty);
+			_gdispFlushDone (g);
+		}
+		gfxThreadReturn(0);
+	}
+#endif
+
 LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	g->board = 0;					// No board interface for this driver
 
+#if GDISP_NEED_DOUBLEBUFFER
+	if (!(backbuf = gfxAlloc(GDISP_SCREEN_WIDTH*GDISP_SCREEN_HEIGHT*sizeof(gU32))))
+		return gFalse;
+	drawdirty.cnt = 0;
+	#if GDISP_NEED_ASYNC
+		{
+			gThread t;
+
+			if (!(stagebuf = gfxAlloc(GDISP_SCREEN_WIDTH*GDISP_SCREEN_HEIGHT*sizeof(gU32))))
+				return gFalse;
+			gfxSemInit (&stagewake, 0, 1);
+			if (!(t = gfxThreadCreate(0, 1024, gThreadpriorityHigh, SDL_flushthread, g)))
+				return gFalse;
+			gfxThreadClose (t);
+		}
+	#endif
+#endif
+
 #if GINPUT_NEED_MOUSE
 	gdriverRegister((const GDriverVMT *)GMOUSE_DRIVER_VMT, g);
 #endif
@@ -384,50 +534,160 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 }
 
 
-static void SDL_extendUpdateRect (int x,int y) {
-	if (context->minx > x)
-		context->minx = x;
-	if (context->miny > y)
-		context->miny = y;
-	if (context->maxx < x)
-		context->maxx = x;
-	if (context->maxy < y)
-		context->maxy = y;
-}
+#if GDISP_NEED_DOUBLEBUFFER
+	// Drawing is only remembered until the next flush
+	#define SDL_dirty(x,y,w,h)		SDL_dirtyAdd (&drawdirty, x, y, w, h)
+
+	// Present the whole frame in one go so the window never shows part of it.
+	//	This waits while the SDL process is uploading the last frame.
+	static void SDL_present (const gU32 *buf, const SDL_DirtyList *d) {
+		const SDL_Rect *r;
+		int i, y;
+
+		sem_wait (ctx_mutex);
+		for (i = 0; i < d->cnt; ++i) {
+			r = &d->r[i];
+			for (y = r->y; y < r->y + r->h; ++y)
+				memcpy (context->framebuf + y*GDISP_SCREEN_WIDTH + r->x, buf + y*GDISP_SCREEN_WIDTH + r->x, r->w*sizeof(gU32));
+			SDL_dirtyAdd (&context->dirty, r->x, r->y, r->w, r->h);
+		}
+		SDL_wake ();
+		sem_post (ctx_mutex);
+	}
+
+	LLDSPEC void gdisp_lld_flush(GDisplay *g) {
+		(void) g;
+
+		if (!context || !drawdirty.cnt)
+			return;
+
+		SDL_present (backbuf, &drawdirty);
+		drawdirty.cnt = 0;
+	}
+
+	#if GDISP_NEED_ASYNC
+		LLDSPEC void gdisp_lld_flush_async(GDisplay *g) {
+			const SDL_Rect *r;
+			int i, y;
+
+			if (!context || !drawdirty.cnt) {
+				_gdispFlushDone (g);
+				return;
+			}
+
+			// Take a copy of the frame so drawing can carry on while the thread waits for the SDL process
+			for (i = 0; i < drawdirty.cnt; ++i) {
+				r = &drawdirty.r[i];
+				for (y = r->y; y < r->y + r->h; ++y)
+					memcpy (stagebuf + y*GDISP_SCREEN_WIDTH + r->x, backbuf + y*GDISP_SCREEN_WIDTH + r->x, r->w*sizeof(gU32));
+			}
+			stagedirty = drawdirty;
+			gfxSemSignal (&stagewake);
+			drawdirty.cnt = 0;
+		}
+	#endif
+#else
+	// Without double buffering everything drawn is shown straight away
+	static void SDL_dirty (int x, int y, int w, int h) {
+		sem_wait (ctx_mutex);
+		SDL_dirtyAdd (&context->dirty, x, y, w, h);
+		SDL_wake ();
+		sem_post (ctx_mutex);
+	}
+#endif
 
 LLDSPEC void gdisp_lld_draw_pixel(GDisplay *g)
 {
 	if (context) {
-		context->framebuf[(g->p.y*GDISP_SCREEN_WIDTH)+g->p.x] = gdispColor2Native(g->p.color);
-		SDL_extendUpdateRect (g->p.x,g->p.y);
-		context->need_redraw = 1;
+		SDL_DRAWBUF[(g->p.y*GDISP_SCREEN_WIDTH)+g->p.x] = gdispColor2Native(g->p.color);
+		SDL_dirty (g->p.x, g->p.y, 1, 1);
 	}
 }
 
+#if GDISP_HARDWARE_STREAM_WRITE
+	// The stream window and the current position in it
+	static int	streamx0, streamy0, streamx1, streamy1, streamx, streamy;
+
+	LLDSPEC void gdisp_lld_write_start(GDisplay *g) {
+		streamx = streamx0 = g->p.x;
+		streamy = streamy0 = g->p.y;
+		streamx1 = g->p.x + g->p.cx;
+		streamy1 = g->p.y + g->p.cy;
+	}
+
+	LLDSPEC void gdisp_lld_write_color(GDisplay *g) {
+		if (context)
+			SDL_DRAWBUF[(streamy*GDISP_SCREEN_WIDTH)+streamx] = gdispColor2Native(g->p.color);
+		if (++streamx >= streamx1) {
+			streamx = streamx0;
+			if (++streamy >= streamy1)
+				streamy = streamy0;
+		}
+	}
+
+	LLDSPEC void gdisp_lld_write_colors(GDisplay *g) {
+		const gColor *p = (const gColor *)g->p.ptr;
+		int n = g->p.x2;
+		int cnt;
+		gU32 *pbuf;
+
+		if (!context)
+			return;
+		while (n) {
+			// Copy up to the end of the current line of the window
+			cnt = streamx1 - streamx;
+			if (cnt > n)
+				cnt = n;
+			n -= cnt;
+			pbuf = SDL_DRAWBUF + streamy*GDISP_SCREEN_WIDTH + streamx;
+			streamx += cnt;
+			gdispRenderBlit (pbuf, 0, p, cnt);
+			p += cnt;
+			if (streamx >= streamx1) {
+				streamx = streamx0;
+				if (++streamy >= streamy1)
+					streamy = streamy0;
+			}
+		}
+	}
+
+	LLDSPEC void gdisp_lld_write_stop(GDisplay *g) {
+		(void) g;
+		if (context)
+			SDL_dirty (streamx0, streamy0, streamx1-streamx0, streamy1-streamy0);
+	}
+#endif
+
 #if GDISP_HARDWARE_FILLS
 	LLDSPEC void gdisp_lld_fill_area(GDisplay *g) {
 		LLDCOLOR_TYPE c = gdispColor2Native(g->p.color);
 		if (context) {
-			int x,y;
-			gU32 *pbuf = context->framebuf + g->p.y*GDISP_SCREEN_WIDTH + g->p.x;
-			int dy = GDISP_SCREEN_WIDTH - g->p.cx;
-			for (y = 0; y < g->p.cy; ++y) {
-				for (x = 0; x < g->p.cx; ++x)
-					*pbuf++ = c;
-				pbuf += dy;
-			}
-			SDL_extendUpdateRect (g->p.x,g->p.y);
-			SDL_extendUpdateRect (g->p.x+g->p.cx-1,g->p.y+g->p.cy-1);
-			context->need_redraw = 1;
+			int y;
+			gU32 *pbuf = SDL_DRAWBUF + g->p.y*GDISP_SCREEN_WIDTH + g->p.x;
+			for (y = 0; y < g->p.cy; ++y, pbuf += GDISP_SCREEN_WIDTH)
+				gdispRenderFill (pbuf, 0, g->p.cx, c);
+			SDL_dirty (g->p.x, g->p.y, g->p.cx, g->p.cy);
 		}
 	}
+#endif
 
+#if GDISP_HARDWARE_BITFILLS
+	LLDSPEC void gdisp_lld_blit_area(GDisplay *g) {
+		if (context) {
+			int y;
+			gU32 *pbuf = SDL_DRAWBUF + g->p.y*GDISP_SCREEN_WIDTH + g->p.x;
+			const gPixel *src = (const gPixel *)g->p.ptr + g->p.y1*g->p.x2 + g->p.x1;
+			for (y = 0; y < g->p.cy; ++y, pbuf += GDISP_SCREEN_WIDTH, src += g->p.x2)
+				gdispRenderBlit (pbuf, 0, src, g->p.cx);
+			SDL_dirty (g->p.x, g->p.y, g->p.cx, g->p.cy);
+		}
+	}
 #endif
 
 #if GDISP_HARDWARE_PIXELREAD
 	LLDSPEC gColor gdisp_lld_get_pixel_color(GDisplay *g) {
 		if (context)
-			return gdispNative2Color(context->framebuf[(g->p.y*GDISP_SCREEN_WIDTH)+g->p.x]);
+			return gdispNative2Color(SDL_DRAWBUF[(g->p.y*GDISP_SCREEN_WIDTH)+g->p.x]);
 		return 0;
 	}
 #endif
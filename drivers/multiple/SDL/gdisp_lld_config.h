@@ -13,14 +13,22 @@
 /*===========================================================================*/
 
 #define GDISP_HARDWARE_DRAWPIXEL		GFXON
+#define GDISP_HARDWARE_STREAM_WRITE		GFXON
+#define GDISP_HARDWARE_STREAM_WRITECOLORS	GFXON
 #define GDISP_HARDWARE_FILLS			GFXON
-#define GDISP_HARDWARE_BITFILLS			GFXOFF
+#define GDISP_HARDWARE_BITFILLS			GFXON
 #define GDISP_HARDWARE_SCROLL			GFXOFF
 #define GDISP_HARDWARE_PIXELREAD		GFXON
 #define GDISP_HARDWARE_CONTROL			GFXOFF
 
 #define GDISP_LLD_PIXELFORMAT			GDISP_PIXELFORMAT_RGB888
 
+// Double buffering presents each frame when the display is flushed
+#if GDISP_NEED_DOUBLEBUFFER
+	#define GDISP_HARDWARE_FLUSH		GFXON
+	#define GDISP_HARDWARE_FLUSHASYNC	GFXON
+#endif
+
 #endif	/* GFX_USE_GDISP */
 
 #endif	/* _GDISP_LLD_CONFIG_H */
@@ -17,15 +17,37 @@
 #include <X11/Xresource.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <poll.h>
 
 #define GDISP_DRIVER_VMT				GDISPVMT_X11
 #include "gdisp_lld_config.h"
 #include "../../../src/gdisp/gdisp_driver.h"
+#include "../../../src/gdisp/gdisp_render.h"
 
 // Configuration parameters for this driver
 #ifndef GDISP_FORCE_24BIT
+	/**
+	 * Use a 24 bit TrueColor visual instead of the display's default visual.
+	 * Pixels are only converted before they are sent if the visual isn't 24 bit RGB TrueColor.
+	 */
 	#define GDISP_FORCE_24BIT			GFXOFF
 #endif
+#ifndef GDISP_X_USE_SHM
+	/**
+	 * Share the image shown in the window with the X server using the MIT-SHM extension.
+	 * It is only used if the server supports it and is on the same machine.
+	 * Otherwise the changed pixels are sent with XPutImage().
+	 */
+	#define GDISP_X_USE_SHM				GFXON
+#endif
+#ifndef GDISP_X_REFRESH_PERIOD
+	/**
+	 * How often (in milliseconds) drawing is shown in the window.
+	 * Double buffered displays are only shown when they are flushed.
+	 */
+	#define GDISP_X_REFRESH_PERIOD		20
+#endif
 #ifndef GDISP_SCREEN_WIDTH
 	#define GDISP_SCREEN_WIDTH			640
 #endif
@@ -53,6 +75,21 @@
 // Driver status flags
 #define GDISP_FLG_READY				(GDISP_FLG_DRIVER<<0)
 
+#if GDISP_X_USE_SHM
+	#include <sys/ipc.h>
+	#include <sys/shm.h>
+	#include <X11/extensions/XShm.h>
+#endif
+
+// Double buffered frames are sent to the server in the background
+#define X_ASYNCFLUSH				(GDISP_HARDWARE_FLUSHASYNC && GDISP_NEED_ASYNC && GDISP_X_USE_SHM)
+
+// The first pixel of a frame buffer line
+#define FBROW(priv, y)				((gU32 *)((priv)->fb + (y) * (priv)->linelen))
+
+// The number of colors remembered when they have to be allocated in the colormap (a power of 2)
+#define X_COLORCACHE				256
+
 #if GINPUT_NEED_MOUSE
 	// Include mouse support code
 	#define GMOUSE_DRIVER_VMT		GMOUSEVMT_X11
@@ -173,13 +210,40 @@ static int				scr;
 static XEvent			evt;
 static Colormap			cmap;
 static XVisualInfo		vis;
+static gBool			xdirect;			// The visual takes our RGB888 pixels as they are
 static XContext			cxt;
 static Atom				wmDelete;
+static struct xPriv		*xdisplays;
+#if GDISP_X_USE_SHM
+	static gBool		useshm;
+	static gBool		shmfailed;
+#endif
+#if X_ASYNCFLUSH
+	static int			shmcompletion;
+#endif
 
 typedef struct xPriv {
-	Pixmap			pix;
+	struct xPriv *	next;			// The next X display
 	GC 				gc;
 	Window			win;
+	XImage *		img;			// The pixels shown in the window
+	#if GDISP_X_USE_SHM
+		XShmSegmentInfo	shm;		// Its shared memory (shm.shmaddr is 0 if it isn't shared)
+	#endif
+	char *			fb;				// The RGB888 frame buffer we draw on. It is img->data if the pixels
+									//	need no conversion and are shown as they are drawn.
+	int				linelen;		// Bytes from one frame buffer line to the next
+	gBool			direct;			// The frame buffer pixels can be copied to img as they are
+	gMutex			lock;			// Protects img and (without double buffering) the changed area
+	gCoord			x0, y0, x1, y1;	// The area changed since it was last shown (x1 < x0 if nothing)
+	#if !GDISP_NEED_DOUBLEBUFFER
+		volatile unsigned	shows;	// The number of times the X thread has taken the changed area
+		unsigned	seen;			// The value of shows when the changed area was last extended
+	#endif
+	struct {
+		gU32			c;			// The color with bit 24 set (0 if the entry is unused)
+		unsigned long	pixel;		// Its colormap entry
+	} colors[X_COLORCACHE];
 	#if GINPUT_NEED_MOUSE
 		gCoord		mousex, mousey;
 		gU16	buttons;
@@ -187,7 +251,213 @@ typedef struct xPriv {
 	#endif
 } xPriv;
 
+// Send an area of the image to the window
+static void XPutArea(xPriv *priv, int x, int y, int cx, int cy, Bool event) {
+	#if GDISP_X_USE_SHM
+		if (priv->shm.shmaddr) {
+			XShmPutImage(dis, priv->win, priv->gc, priv->img, x, y, x, y, cx, cy, event);
+			return;
+		}
+	#else
+		(void) event;
+	#endif
+	XPutImage(dis, priv->win, priv->gc, priv->img, x, y, x, y, cx, cy);
+}
+
+// Scale a color component to fit a visual's mask
+static unsigned long XScale(unsigned c, unsigned long mask) {
+	unsigned long	low;
+
+	if (!mask)
+		return 0;
+	low = mask & (~mask + 1);
+	return ((c * (mask / low) + 127) / 255) * low;
+}
+
+// The window's pixel for a frame buffer pixel when the visual doesn't take RGB888 pixels
+static unsigned long XPixel(xPriv *priv, gU32 c) {
+	unsigned	r, gr, b, i;
+	XColor		col;
+
+	r = (c >> 16) & 0xFF;
+	gr = (c >> 8) & 0xFF;
+	b = c & 0xFF;
+	if (vis.class == TrueColor)
+		return XScale(r, vis.red_mask) | XScale(gr, vis.green_mask) | XScale(b, vis.blue_mask);
+
+	// Other visuals need the color allocated in the colormap. Remember the ones we have.
+	c = (c & 0xFFFFFF) | 0x1000000;
+	i = (r ^ (gr << 1) ^ (b << 2) ^ (gr >> 4)) & (X_COLORCACHE-1);
+	if (priv->colors[i].c != c) {
+		col.red = (unsigned short)(r * 257);
+		col.green = (unsigned short)(gr * 257);
+		col.blue = (unsigned short)(b * 257);
+		col.flags = DoRed|DoGreen|DoBlue;
+		priv->colors[i].c = c;
+		priv->colors[i].pixel = XAllocColor(dis, cmap, &col) ? col.pixel : BlackPixel(dis, scr);
+	}
+	return priv->colors[i].pixel;
+}
+
+// Copy an area of the frame buffer into the image converting the pixels if the visual needs it
+static void XCopyOut(xPriv *priv, int x, int y, int cx, int cy) {
+	const gU32 *	src;
+	int				i, j;
+
+	for(j = y; j < y + cy; j++) {
+		src = FBROW(priv, j) + x;
+		if (priv->direct) {
+			memcpy((gU32 *)(priv->img->data + j * priv->img->bytes_per_line) + x, src, cx * sizeof(gU32));
+			continue;
+		}
+		for(i = 0; i < cx; i++)
+			XPutPixel(priv->img, x + i, j, XPixel(priv, src[i]));
+	}
+}
+
+// Remember an area has changed
+static void XChanged(xPriv *priv, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+	#if !GDISP_NEED_DOUBLEBUFFER
+		// The X thread shows the area. Drawing inside an area it has still to take needs no lock.
+		//	If it takes the area after this check it sends the pixels that have already been drawn.
+		if (priv->seen == priv->shows && x >= priv->x0 && y >= priv->y0 && x+cx-1 <= priv->x1 && y+cy-1 <= priv->y1)
+			return;
+
+		// Grow the area in blocks so that a line drawn a pixel at a time rarely needs the lock
+		cx += x & 7; x &= ~7;
+		cy += y & 7; y &= ~7;
+		cx = (cx + 7) & ~7;
+		cy = (cy + 7) & ~7;
+		if (x + cx > GDISP_SCREEN_WIDTH)	cx = GDISP_SCREEN_WIDTH - x;
+		if (y + cy > GDISP_SCREEN_HEIGHT)	cy = GDISP_SCREEN_HEIGHT - y;
+		gfxMutexEnter(&priv->lock);
+	#endif
+	if (x < priv->x0)			priv->x0 = x;
+	if (y < priv->y0)			priv->y0 = y;
+	if (x+cx-1 > priv->x1)		priv->x1 = x+cx-1;
+	if (y+cy-1 > priv->y1)		priv->y1 = y+cy-1;
+	#if !GDISP_NEED_DOUBLEBUFFER
+		priv->seen = priv->shows;
+		gfxMutexExit(&priv->lock);
+	#endif
+}
+
+// Show the area that has changed in one request. Returns gFalse if nothing has changed.
+static gBool XShow(xPriv *priv, Bool event) {
+	int		x, y, cx, cy;
+
+	gfxMutexEnter(&priv->lock);
+	if (priv->x1 < priv->x0) {
+		gfxMutexExit(&priv->lock);
+		return gFalse;
+	}
+	x = priv->x0; cx = priv->x1 - x + 1;
+	y = priv->y0; cy = priv->y1 - y + 1;
+	priv->x0 = GDISP_SCREEN_WIDTH;
+	priv->y0 = GDISP_SCREEN_HEIGHT;
+	priv->x1 = priv->y1 = -1;
+	#if !GDISP_NEED_DOUBLEBUFFER
+		priv->shows++;
+	#endif
+	if (priv->fb != priv->img->data)
+		XCopyOut(priv, x, y, cx, cy);
+	XPutArea(priv, x, y, cx, cy, event);
+	XFlush(dis);
+	gfxMutexExit(&priv->lock);
+	return gTrue;
+}
+
+// Create an image in our own memory. XPutImage() sends it to the server.
+static XImage *XCreateFrame(void) {
+	XImage	*img;
+
+	if (!(img = XCreateImage(dis, vis.visual, vis.depth, ZPixmap, 0, 0, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT, 32, 0)))
+		return 0;
+	if (!(img->data = gfxAlloc(img->bytes_per_line * GDISP_SCREEN_HEIGHT))) {
+		XDestroyImage(img);
+		return 0;
+	}
+
+	// We write whole pixels so the bytes are in our order. XPutImage() swaps them if the server needs it.
+	{
+		gU32	endian = 1;
+
+		img->byte_order = *(gU8 *)&endian ? LSBFirst : MSBFirst;
+		XInitImage(img);
+	}
+	return img;
+}
+
+#if GDISP_X_USE_SHM
+	static int XShmError(Display *d, XErrorEvent *e) {
+		(void) d;
+		(void) e;
+
+		shmfailed = gTrue;
+		return 0;
+	}
+
+	// Create an image in memory shared with the server. If that can't be done shm->shmaddr is 0.
+	static XImage *XCreateSharedFrame(XShmSegmentInfo *shm) {
+		XImage	*img;
+
+		shm->shmaddr = 0;
+		if (!useshm)
+			return XCreateFrame();
+		if ((img = XShmCreateImage(dis, vis.visual, vis.depth, ZPixmap, 0, shm, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT))) {
+			if ((shm->shmid = shmget(IPC_PRIVATE, img->bytes_per_line * img->height, IPC_CREAT|0600)) >= 0) {
+				if ((shm->shmaddr = img->data = shmat(shm->shmid, 0, 0)) != (char *)-1) {
+					int		(*old)(Display *, XErrorEvent *);
+
+					// A server on another machine fails the attach
+					shm->readOnly = False;
+					shmfailed = gFalse;
+					old = XSetErrorHandler(XShmError);
+					XShmAttach(dis, shm);
+					XSync(dis, False);
+					XSetErrorHandler(old);
+
+					// The memory is freed when both of us have detached
+					shmctl(shm->shmid, IPC_RMID, 0);
+					if (!shmfailed)
+						return img;
+					shmdt(shm->shmaddr);
+				} else
+					shmctl(shm->shmid, IPC_RMID, 0);
+			}
+			shm->shmaddr = 0;
+			img->data = 0;
+			XDestroyImage(img);
+		}
+
+		// Don't try again
+		fprintf(stderr, "GFX Window is not using shared memory\n");
+		useshm = gFalse;
+		return XCreateFrame();
+	}
+#endif
+
+// Free an image created by XCreateFrame() or XCreateSharedFrame()
+static void XFreeFrame(xPriv *priv) {
+	#if GDISP_X_USE_SHM
+		if (priv->shm.shmaddr) {
+			XShmDetach(dis, &priv->shm);
+			shmdt(priv->shm.shmaddr);
+			priv->img->data = 0;
+		}
+	#endif
+	XDestroyImage(priv->img);
+}
+
 static void ProcessEvent(GDisplay *g, xPriv *priv) {
+	#if X_ASYNCFLUSH
+		// The server has finished reading a frame sent in the background
+		if (evt.type == shmcompletion) {
+			_gdispFlushDone(g);
+			return;
+		}
+	#endif
+
 	switch(evt.type) {
 	case MapNotify:
 		XSelectInput(dis, evt.xmap.window,
@@ -205,10 +475,13 @@ static void ProcessEvent(GDisplay *g, xPriv *priv) {
 		}
 		break;
 	case Expose:
-		XCopyArea(dis, priv->pix, evt.xexpose.window, priv->gc,
+		// The image holds what was last shown. A double buffered frame being drawn is not in it.
+		gfxMutexEnter(&priv->lock);
+		XPutArea(priv,
 			evt.xexpose.x, evt.xexpose.y,
-			evt.xexpose.width, evt.xexpose.height,
-			evt.xexpose.x, evt.xexpose.y);
+			evt.xexpose.width, evt.xexpose.height, False);
+		XFlush(dis);
+		gfxMutexExit(&priv->lock);
 		break;
 	#if GINPUT_NEED_MOUSE
 		case ButtonPress:
@@ -272,16 +545,31 @@ static void ProcessEvent(GDisplay *g, xPriv *priv) {
 /* this is the X11 thread which keeps track of all events */
 static GFX_THREAD_STACK(waXThread, 1024);
 static GFX_THREAD_FUNCTION(ThreadX, arg) {
-	GDisplay	*g;
+	GDisplay		*g;
+	struct pollfd	pfd;
 	(void)arg;
 
+	pfd.fd = ConnectionNumber(dis);
+	pfd.events = POLLIN;
 	while(1) {
-		gfxSleepMilliseconds(100);
+		// Wait for an event or until it is time to show what has been drawn
+		if (!XPending(dis))
+			poll(&pfd, 1, GDISP_X_REFRESH_PERIOD);
 		while(XPending(dis)) {
 			XNextEvent(dis, &evt);
-			XFindContext(evt.xany.display, evt.xany.window, cxt, (XPointer*)&g);
-			ProcessEvent(g, (xPriv *)g->priv);
+			if (!XFindContext(evt.xany.display, evt.xany.window, cxt, (XPointer*)&g))
+				ProcessEvent(g, (xPriv *)g->priv);
 		}
+
+		// Double buffered displays are shown when they are flushed
+		#if !GDISP_NEED_DOUBLEBUFFER
+			{
+				xPriv	*priv;
+
+				for(priv = xdisplays; priv; priv = priv->next)
+					XShow(priv, False);
+			}
+		#endif
 	}
 	return 0;
 }
@@ -304,12 +592,14 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	if (!initdone) {
 		gThread			hth;
 
-		initdone = gTrue;
 		#if GFX_USE_OS_LINUX || GFX_USE_OS_OSX
 			XInitThreads();
 		#endif
 
-		dis = XOpenDisplay(0);
+		if (!(dis = XOpenDisplay(0))) {
+			fprintf(stderr, "Cannot open the X display\n");
+			return gFalse;
+		}
 		scr = DefaultScreen(dis);
 		cxt = XUniqueContext();
 		wmDelete = XInternAtom(dis, "WM_DELETE_WINDOW", False);
@@ -324,11 +614,32 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 			cmap = XCreateColormap(dis, RootWindow(dis, scr),
 					vis.visual, AllocNone);
 		#else
-			vis.visual = CopyFromParent;
-			vis.depth = DefaultDepth(dis, scr);
+			{
+				XVisualInfo	tmpl, *pvis;
+				int			n;
+
+				tmpl.visualid = XVisualIDFromVisual(DefaultVisual(dis, scr));
+				if (!(pvis = XGetVisualInfo(dis, VisualIDMask, &tmpl, &n))) {
+					fprintf(stderr, "Cannot find the display's visual\n");
+					XCloseDisplay(dis);
+					return gFalse;
+				}
+				vis = *pvis;
+				XFree(pvis);
+			}
 			cmap = DefaultColormap(dis, scr);
 		#endif
-		fprintf(stderr, "Running GFX Window in %d bit color\n", vis.depth);
+
+		// We draw 32 bit RGB888 pixels. Other visuals need them converted before they are sent.
+		xdirect = vis.class == TrueColor && vis.depth == 24
+					&& vis.red_mask == 0xFF0000 && vis.green_mask == 0x00FF00 && vis.blue_mask == 0x0000FF;
+		#if GDISP_X_USE_SHM
+			useshm = XShmQueryExtension(dis) ? gTrue : gFalse;
+			#if X_ASYNCFLUSH
+				shmcompletion = XShmGetEventBase(dis) + ShmCompletion;
+			#endif
+		#endif
+		fprintf(stderr, "Running GFX Window in %d bit color%s\n", vis.depth, xdirect ? "" : " (converted)");
 
 		if (!(hth = gfxThreadCreate(waXThread, sizeof(waXThread), gThreadpriorityHigh, ThreadX, 0))) {
 			fprintf(stderr, "Cannot start X Thread\n");
@@ -339,11 +650,55 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 			pthread_detach(hth);
 		#endif
 		gfxThreadClose(hth);
+		initdone = gTrue;
 	}
 
-	g->priv = gfxAlloc(sizeof(xPriv));
-	priv = (xPriv *)g->priv;
+	if (!(priv = gfxAlloc(sizeof(xPriv)))) {
+		fprintf(stderr, "Cannot allocate the GFX Window\n");
+		return gFalse;
+	}
+
+	// Create the image shown in the window. Nothing has been drawn yet.
+	#if GDISP_X_USE_SHM
+		priv->img = XCreateSharedFrame(&priv->shm);
+	#else
+		priv->img = XCreateFrame();
+	#endif
+	if (!priv->img) {
+		fprintf(stderr, "Cannot create the GFX Window image\n");
+		gfxFree(priv);
+		return gFalse;
+	}
+	memset(priv->img->data, 0, priv->img->bytes_per_line * GDISP_SCREEN_HEIGHT);
+
+	// Draw straight into the image if the pixels need no conversion and are shown as they are drawn
+	priv->direct = xdirect && priv->img->bits_per_pixel == 32;
+	#if !GDISP_NEED_DOUBLEBUFFER
+		if (priv->direct) {
+			priv->fb = priv->img->data;
+			priv->linelen = priv->img->bytes_per_line;
+		} else
+	#endif
+	{
+		priv->linelen = GDISP_SCREEN_WIDTH * sizeof(gU32);
+		if (!(priv->fb = gfxAlloc(priv->linelen * GDISP_SCREEN_HEIGHT))) {
+			fprintf(stderr, "Cannot create the GFX Window frame buffer\n");
+			XFreeFrame(priv);
+			gfxFree(priv);
+			return gFalse;
+		}
+		memset(priv->fb, 0, priv->linelen * GDISP_SCREEN_HEIGHT);
+	}
+	memset(priv->colors, 0, sizeof(priv->colors));
+	g->priv = priv;
 	g->board = 0;					// No board interface for this driver
+	gfxMutexInit(&priv->lock);
+	priv->x0 = GDISP_SCREEN_WIDTH;
+	priv->y0 = GDISP_SCREEN_HEIGHT;
+	priv->x1 = priv->y1 = -1;
+	#if !GDISP_NEED_DOUBLEBUFFER
+		priv->shows = priv->seen = 0;
+	#endif
 
 	xa.colormap = cmap;
 	xa.border_pixel = 0xFFFFFF;
@@ -376,10 +731,6 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	XFree(pSH);
 	XSync(dis, TRUE);
 
-	priv->pix = XCreatePixmap(dis, priv->win,
-				GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT, vis.depth);
-	XSync(dis, TRUE);
-
 	priv->gc = XCreateGC(dis, priv->win, 0, 0);
 	XSetBackground(dis, priv->gc, BlackPixel(dis, scr));
 	XSync(dis, TRUE);
@@ -389,6 +740,10 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		priv->mouse = (GMouse *)gdriverRegister((const GDriverVMT const *)GMOUSE_DRIVER_VMT, g);
 	#endif
 
+	// Let the X thread show what is drawn
+	priv->next = xdisplays;
+	xdisplays = priv;
+
 	XSelectInput(dis, priv->win, StructureNotifyMask);
 	XMapWindow(dis, priv->win);
 
@@ -407,75 +762,108 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
     return gTrue;
 }
 
-LLDSPEC void gdisp_lld_draw_pixel(GDisplay *g)
-{
+#if GDISP_HARDWARE_FLUSH
+	LLDSPEC void gdisp_lld_flush(GDisplay *g) {
+		XShow((xPriv *)g->priv, False);
+
+		// Wait until the server has the whole frame before the next one is copied over it
+		#if GDISP_NEED_DOUBLEBUFFER
+			XSync(dis, False);
+		#endif
+	}
+#endif
+
+#if GDISP_HARDWARE_FLUSHASYNC && GDISP_NEED_ASYNC
+	LLDSPEC void gdisp_lld_flush_async(GDisplay *g) {
+		#if X_ASYNCFLUSH
+			// Drawing carries on in the frame buffer while the server reads the shared image.
+			//	The X thread tells GDISP when the completion event arrives.
+			if (((xPriv *)g->priv)->shm.shmaddr) {
+				if (!XShow((xPriv *)g->priv, True))
+					_gdispFlushDone(g);
+				return;
+			}
+		#endif
+
+		// XPutImage() has copied the pixels by the time it returns
+		XShow((xPriv *)g->priv, False);
+		_gdispFlushDone(g);
+	}
+#endif
+
+LLDSPEC void gdisp_lld_draw_pixel(GDisplay *g) {
 	xPriv *	priv = (xPriv *)g->priv;
-	XColor	col;
-
-	col.red = RED_OF(g->p.color) << 8;
-	col.green = GREEN_OF(g->p.color) << 8;
-	col.blue = BLUE_OF(g->p.color) << 8;
-	XAllocColor(dis, cmap, &col);
-	XSetForeground(dis, priv->gc, col.pixel);
-	XDrawPoint(dis, priv->pix, priv->gc, (int)g->p.x, (int)g->p.y );
-	XDrawPoint(dis, priv->win, priv->gc, (int)g->p.x, (int)g->p.y );
-	XFlush(dis);
+
+	FBROW(priv, g->p.y)[g->p.x] = gdispColor2Native(g->p.color);
+	XChanged(priv, g->p.x, g->p.y, 1, 1);
 }
 
 #if GDISP_HARDWARE_FILLS
 	LLDSPEC void gdisp_lld_fill_area(GDisplay *g) {
 		xPriv *	priv = (xPriv *)g->priv;
-		XColor	col;
-
-		col.red = RED_OF(g->p.color) << 8;
-		col.green = GREEN_OF(g->p.color) << 8;
-		col.blue = BLUE_OF(g->p.color) << 8;
-		XAllocColor(dis, cmap, &col);
-		XSetForeground(dis, priv->gc, col.pixel);
-		XFillRectangle(dis, priv->pix, priv->gc, g->p.x, g->p.y, g->p.cx, g->p.cy);
-		XFillRectangle(dis, priv->win, priv->gc, g->p.x, g->p.y, g->p.cx, g->p.cy);
-		XFlush(dis);
+		gU32	c;
+		gCoord	y;
+
+		c = gdispColor2Native(g->p.color);
+		for(y = g->p.y; y < g->p.y + g->p.cy; y++)
+			gdispRenderFill(FBROW(priv, y), g->p.x, g->p.cx, c);
+		XChanged(priv, g->p.x, g->p.y, g->p.cx, g->p.cy);
 	}
 #endif
 
-#if 0 && GDISP_HARDWARE_BITFILLS
+#if GDISP_HARDWARE_BITFILLS
 	LLDSPEC void gdisp_lld_blit_area(GDisplay *g) {
-		// Start of Bitblit code
-
-		//XImage			bitmap;
-		//gPixel			*bits;
-		//	bits = malloc(vis.depth * GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT);
-		//	bitmap = XCreateImage(dis, vis, vis.depth, ZPixmap,
-		//				0, bits, GDISP_SCREEN_WIDTH, GDISP_SCREEN_HEIGHT,
-		//				0, 0);
+		xPriv *			priv = (xPriv *)g->priv;
+		const gPixel *	src;
+		gCoord			y;
+
+		src = (const gPixel *)g->p.ptr + g->p.y1 * g->p.x2 + g->p.x1;
+		for(y = g->p.y; y < g->p.y + g->p.cy; y++, src += g->p.x2)
+			gdispRenderBlit(FBROW(priv, y), g->p.x, src, g->p.cx);
+		XChanged(priv, g->p.x, g->p.y, g->p.cx, g->p.cy);
 	}
 #endif
 
 #if GDISP_HARDWARE_PIXELREAD
 	LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
 		xPriv *	priv = (xPriv *)g->priv;
-		XColor	color;
-		XImage *img;
-
-		img = XGetImage (dis, priv->pix, g->p.x, g->p.y, 1, 1, AllPlanes, XYPixmap);
-		color.pixel = XGetPixel (img, 0, 0);
-		XFree(img);
-		XQueryColor(dis, cmap, &color);
-		return RGB2COLOR(color.red>>8, color.green>>8, color.blue>>8);
+
+		return gdispNative2Color(FBROW(priv, g->p.y)[g->p.x]);
 	}
 #endif
 
 #if GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL
 	LLDSPEC void gdisp_lld_vertical_scroll(GDisplay *g) {
 		xPriv *	priv = (xPriv *)g->priv;
+		gCoord	y;
 
+		// Move the lines that stay visible. The high level code fills the gap that is left.
 		if (g->p.y1 > 0) {
-			XCopyArea(dis, priv->pix, priv->pix, priv->gc, g->p.x, g->p.y+g->p.y1, g->p.cx, g->p.cy-g->p.y1, g->p.x, g->p.y);
-			XCopyArea(dis, priv->pix, priv->win, priv->gc, g->p.x, g->p.y, g->p.cx, g->p.cy-g->p.y1, g->p.x, g->p.y);
+			for(y = g->p.y; y < g->p.y + g->p.cy - g->p.y1; y++)
+				memcpy(FBROW(priv, y) + g->p.x, FBROW(priv, y + g->p.y1) + g->p.x, g->p.cx * sizeof(gU32));
+		} else {
+			for(y = g->p.y + g->p.cy - 1; y >= g->p.y - g->p.y1; y--)
+				memcpy(FBROW(priv, y) + g->p.x, FBROW(priv, y + g->p.y1) + g->p.x, g->p.cx * sizeof(gU32));
+		}
+		XChanged(priv, g->p.x, g->p.y, g->p.cx, g->p.cy);
+	}
+#endif
+
+#if GDISP_NEED_COPYAREA && GDISP_HARDWARE_COPY
+	LLDSPEC void gdisp_lld_copy_area(GDisplay *g) {
+		xPriv *	priv = (xPriv *)g->priv;
+		gCoord	i, dy;
+
+		// Copy the lines in an order that reads each source line before it is overwritten
+		dy = g->p.y1 - g->p.y;
+		if (dy < 0) {
+			for(i = g->p.cy-1; i >= 0; i--)
+				memmove(FBROW(priv, g->p.y+i) + g->p.x, FBROW(priv, g->p.y+i+dy) + g->p.x1, g->p.cx * sizeof(gU32));
 		} else {
-			XCopyArea(dis, priv->pix, priv->pix, priv->gc, g->p.x, g->p.y, g->p.cx, g->p.cy+g->p.y1, g->p.x, g->p.y-g->p.y1);
-			XCopyArea(dis, priv->pix, priv->win, priv->gc, g->p.x, g->p.y-g->p.y1, g->p.cx, g->p.cy+g->p.y1, g->p.x, g->p.y-g->p.y1);
+			for(i = 0; i < g->p.cy; i++)
+				memmove(FBROW(priv, g->p.y+i) + g->p.x, FBROW(priv, g->p.y+i+dy) + g->p.x1, g->p.cx * sizeof(gU32));
 		}
+		XChanged(priv, g->p.x, g->p.y, g->p.cx, g->p.cy);
 	}
 #endif
 
@@ -14,15 +14,22 @@
 /* Driver hardware support.                                                  */
 /*===========================================================================*/
 
+#define GDISP_HARDWARE_FLUSH			GFXON
 #define GDISP_HARDWARE_DRAWPIXEL		GFXON
 #define GDISP_HARDWARE_FILLS			GFXON
-#define GDISP_HARDWARE_BITFILLS			GFXOFF
+#define GDISP_HARDWARE_BITFILLS			GFXON
 #define GDISP_HARDWARE_SCROLL			GFXON
+#define GDISP_HARDWARE_COPY				GFXON
 #define GDISP_HARDWARE_PIXELREAD		GFXON
 #define GDISP_HARDWARE_CONTROL			GFXOFF
 
 #define GDISP_LLD_PIXELFORMAT			GDISP_PIXELFORMAT_RGB888
 
+// Double buffering presents each frame when the display is flushed
+#if GDISP_NEED_DOUBLEBUFFER
+	#define GDISP_HARDWARE_FLUSHASYNC	GFXON
+#endif
+
 #endif	/* GFX_USE_GDISP */
 
 #endif	/* _GDISP_LLD_CONFIG_H */
@@ -22,9 +22,23 @@
 #define GDISP_HARDWARE_FILLS			GFXON
 #define GDISP_HARDWARE_BITFILLS			GFXON
 #define GDISP_HARDWARE_PIXELREAD		GFXON
+#define GDISP_HARDWARE_STREAM_READ		GFXON
 #define GDISP_HARDWARE_SCROLL			GFXON
 #define GDISP_HARDWARE_CONTROL			GFXON
 
+// Keep a frame buffer so that only changes need to be sent and pixel reads don't need the network.
+//	It costs two copies of the screen in RAM so it is only turned on by default on desktop operating systems.
+#ifndef GDISP_GFXNET_FRAMEBUFFER
+	#if GFX_USE_OS_WIN32 || GFX_USE_OS_LINUX || GFX_USE_OS_OSX
+		#define GDISP_GFXNET_FRAMEBUFFER	GFXON
+	#else
+		#define GDISP_GFXNET_FRAMEBUFFER	GFXOFF
+	#endif
+#endif
+#if GDISP_GFXNET_FRAMEBUFFER
+	#define GDISP_HARDWARE_COPY			GFXON
+#endif
+
 #define GDISP_LLD_PIXELFORMAT			GDISP_PIXELFORMAT_RGB565
 
 #endif	/* GFX_USE_GDISP */
@@ -15,6 +15,7 @@
 #define GDISP_DRIVER_VMT			GDISPVMT_uGFXnet
 #include "gdisp_lld_config.h"
 #include "../../../src/gdisp/gdisp_driver.h"
+#include "../../../src/gdisp/gdisp_render.h"
 #include "uGFXnetProtocol.h"
 
 #ifndef GDISP_SCREEN_WIDTH
@@ -35,6 +36,25 @@
 #ifndef GDISP_GFXNET_BROKEN_LWIP_ACCEPT
 	#define GDISP_GFXNET_BROKEN_LWIP_ACCEPT		GFXOFF
 #endif
+#ifndef GDISP_GFXNET_TXBUFFER_SIZE
+	#define GDISP_GFXNET_TXBUFFER_SIZE	1024
+#endif
+#ifndef GDISP_GFXNET_FLUSH_PERIOD
+	#define GDISP_GFXNET_FLUSH_PERIOD	20
+#endif
+#ifndef GDISP_GFXNET_VIEWERS
+	#define GDISP_GFXNET_VIEWERS		1
+#endif
+#ifndef GDISP_GFXNET_QUEUE_SIZE
+	#define GDISP_GFXNET_QUEUE_SIZE	65536
+#endif
+#ifndef GDISP_GFXNET_EPOLL
+	#if GFX_USE_OS_LINUX
+		#define GDISP_GFXNET_EPOLL		GFXON
+	#else
+		#define GDISP_GFXNET_EPOLL		GFXOFF
+	#endif
+#endif
 
 #if GINPUT_NEED_MOUSE
 	// Include mouse support code
@@ -78,21 +98,30 @@
 	}};
 #endif
 
-#if GNETCODE_VERSION != GNETCODE_VERSION_1_0
-	#error "GDISP: uGFXnet - This driver only support protocol V1.0"
+#if GNETCODE_VERSION != GNETCODE_VERSION_2_0
+	#error "GDISP: uGFXnet - This driver only supports protocol V1.0 and V2.0"
 #endif
 #if GDISP_LLD_PIXELFORMAT != GNETCODE_PIXELFORMAT
 	#error "GDISP: uGFXnet - The driver pixel format must match the protocol"
 #endif
+#if GDISP_GFXNET_VIEWERS > 1 && !GDISP_GFXNET_FRAMEBUFFER
+	#error "GDISP: uGFXnet - More than one viewer needs GDISP_GFXNET_FRAMEBUFFER"
+#endif
+#if GDISP_GFXNET_EPOLL && !GFX_USE_OS_LINUX
+	#error "GDISP: uGFXnet - GDISP_GFXNET_EPOLL is only supported on Linux"
+#endif
 
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <errno.h>
 
 #if defined(WIN32) || GFX_USE_OS_WIN32
 	#include <winsock.h>
 	#define SOCKET_TYPE				SOCKET
 	#define socklen_t		int
+	#define SOCKET_WOULDBLOCK()		(WSAGetLastError() == WSAEWOULDBLOCK)
+	#define SetNonBlocking(fd)		do { u_long nb = 1; ioctlsocket(fd, FIONBIO, &nb); } while(0)
 
 	static void StopSockets(void) {
 		WSACleanup();
@@ -108,13 +137,21 @@
 	#include <sys/types.h>
 	#include <sys/socket.h>
 	#include <netinet/in.h>
+	#include <netinet/tcp.h>
 	#include <arpa/inet.h>
 	#include <netdb.h>
+	#include <sys/ioctl.h>
+	#include <unistd.h>
+	#if GDISP_GFXNET_EPOLL
+		#include <sys/epoll.h>
+	#endif
 
 	#define closesocket(fd)			close(fd)
 	#define ioctlsocket(fd,cmd,arg)	ioctl(fd,cmd,arg)
 	#define StartSockets()
 	#define SOCKET_TYPE				int
+	#define SOCKET_WOULDBLOCK()		(errno == EWOULDBLOCK || errno == EAGAIN)
+	#define SetNonBlocking(fd)		do { int nb = 1; ioctlsocket(fd, FIONBIO, &nb); } while(0)
 
 #else
 	#include <lwip/sockets.h>
@@ -134,6 +171,8 @@
 		#error "GDISP: uGFXnet - LWIP_COMPAT_SOCKETS must be defined in your lwipopts.h file"
 	#endif
 	#define SOCKET_TYPE				int
+	#define SOCKET_WOULDBLOCK()		(errno == EWOULDBLOCK || errno == EAGAIN)
+	#define SetNonBlocking(fd)		do { int nb = 1; ioctlsocket(fd, FIONBIO, &nb); } while(0)
 
 	// Mutex protection is required for LWIP
 	#if !GDISP_GFXNET_UNSAFE_SOCKETS
@@ -148,16 +187,80 @@
 #endif
 
 #define GDISP_FLG_CONNECTED			(GDISP_FLG_DRIVER<<0)
-#define GDISP_FLG_HAVEDATA			(GDISP_FLG_DRIVER<<1)
+
+#define NET_REPLY_MAX				256		// The most replies (colors) asked for at once
+
+#ifndef MSG_NOSIGNAL
+	#define MSG_NOSIGNAL			0
+#endif
+
+#if GDISP_GFXNET_FRAMEBUFFER
+	// Connection states
+	#define NET_CLOSED				0		// The viewer slot is free
+	#define NET_SYNC				1		// Waiting to find out which protocol the display wants before sending the frame buffer
+	#define NET_IMMEDIATE			2		// Drawing is sent as it is done (V1.0)
+	#define NET_FRAMES				3		// Changed tiles are sent as frames the display acknowledges (V2.0)
+	#define NET_BEHIND				4		// Too much is queued (V1.0). Drawing is skipped until the queue empties.
+
+	#define NET_TILE				16		// The width and height of a frame buffer tile
+	#define NET_UPGRADE_WAIT		200		// How long (ms) a new display has to ask for a newer protocol
+	#define NET_TILESX(g)			(((g)->g.Width + NET_TILE - 1) / NET_TILE)
+	#define NET_TILESY(g)			(((g)->g.Height + NET_TILE - 1) / NET_TILE)
+	#define NET_QUEUED(c)			((c)->txlen - (c)->txdone)
+#endif
+
+#if GDISP_GFXNET_EPOLL
+	#define NET_EVENTS				16		// The most socket events handled for each epoll_wait()
+#endif
 
 /*===========================================================================*/
 /* Driver local routines    .                                                */
 /*===========================================================================*/
 
+// A connection to a display (a viewer)
+typedef struct netClient {
+	GDisplay *		g;						// The display being shown
+	SOCKET_TYPE		netfd;					// The socket or -1 when not connected
+	unsigned		rxlen;					// How many bytes are in rxbuf
+	gU8				rxbuf[64];				// Data received but not processed yet
+	unsigned		datacnt;				// How many words of the current command have been received
+	gU16			data[2];				// Buffer for storing data read.
+	unsigned		arealeft;				// How many colors of a GNETCODE_READ_AREA reply are still to come
+	gU16			version;				// The protocol version in use
+	unsigned		skipreplies;			// Control replies to ignore as the driver sent the commands itself
+	unsigned		txlen;					// How many bytes are in the transmit buffer
+	#if GDISP_GFXNET_FRAMEBUFFER
+		unsigned	txdone;					// How many of those have been sent
+		unsigned	txsize;					// The transmit buffer grows while the viewer is slow to take data
+		gU8 *		txbuf;
+		gBool		pollout;				// The network thread is waiting for the socket to take more
+		LLDCOLOR_TYPE *	ref;				// What the display has been sent in frames
+		gU8 *		dirty;					// The tiles that may be different in fb and ref
+		gBool		anydirty;				// A frame needs to be sent
+		gBool		refvalid;				// gFalse if we don't know what the display is showing
+		gU8			state;
+		gTicks		connecttime;
+		gU16		framesent, frameacked;
+	#else
+		gU8			txbuf[GDISP_GFXNET_TXBUFFER_SIZE];
+	#endif
+} netClient;
+
 typedef struct netPriv {
-	SOCKET_TYPE		netfd;					// The current socket
-	unsigned		databytes;				// How many bytes have been read
-	gU16		data[2];				// Buffer for storing data read.
+	gMutex			lock;					// Protects the viewers, the replies and the frame buffer
+	netClient		clients[GDISP_GFXNET_VIEWERS];
+	netClient *		primary;				// The viewer that answers reads and controls and drives the mouse
+	gSem			replysem;				// Signalled when all the replies asked for have arrived
+	unsigned		replylen;				// How many replies have arrived
+	unsigned		replywant;				// How many replies have been asked for
+	gU16			reply[NET_REPLY_MAX];	// The replies (colors or control status)
+	gCoord			readx, ready;			// The stream read area
+	gCoord			readcx, readcy;
+	gCoord			readcol, readrow;		// The next pixel to return
+	unsigned		readpos;				// The next reply to return (non-frame buffer only)
+	#if GDISP_GFXNET_FRAMEBUFFER
+		LLDCOLOR_TYPE *	fb;					// Everything that has been drawn
+	#endif
 	#if GINPUT_NEED_MOUSE
 		gCoord		mousex, mousey;
 		gU16	mousebuttons;
@@ -167,6 +270,12 @@ typedef struct netPriv {
 
 static gThread	hThread;
 
+#if GDISP_GFXNET_EPOLL
+	static int		netPoll;				// Watches the listening socket and the viewers
+#elif GDISP_GFXNET_FRAMEBUFFER
+	static fd_set	netWriteSet;			// The viewers whose socket we are waiting on to take more
+#endif
+
 #if GDISP_GFXNET_UNSAFE_SOCKETS
 	static gMutex	uGFXnetMutex;
 	#define MUTEX_INIT		gfxMutexInit(&uGFXnetMutex)
@@ -178,29 +287,531 @@ static gThread	hThread;
 	#define MUTEX_EXIT
 #endif
 
+#if GDISP_GFXNET_FRAMEBUFFER
+	/**
+	 * Send as much of the transmit buffer as the socket will take without waiting.
+	 * The network thread sends the rest when the socket has room.
+	 * If the connection has failed the data is thrown away and the call returns gFalse.
+	 * The caller must hold priv->lock.
+	 */
+	static gBool netWrite(netClient *c) {
+		int			len;
+		gBool		wouldblock;
+
+		while(c->txdone < c->txlen) {
+			MUTEX_ENTER;
+			len = send(c->netfd, (const char *)c->txbuf+c->txdone, c->txlen-c->txdone, MSG_NOSIGNAL);
+			wouldblock = len < 0 && SOCKET_WOULDBLOCK();
+			MUTEX_EXIT;
+			if (wouldblock)
+				return gTrue;
+			if (len <= 0) {
+				c->txlen = c->txdone = 0;
+				return gFalse;
+			}
+			c->txdone += len;
+		}
+		c->txlen = c->txdone = 0;
+		return gTrue;
+	}
+
+	/**
+	 * Add a gU16 to the transmit buffer in network order.
+	 * A full buffer is sent if the socket will take it. If not the buffer grows - a viewer that falls
+	 * too far behind is dealt with by netSendNow() and netSendFrame().
+	 * The caller must hold priv->lock.
+	 */
+	static void netPut(netClient *c, gU16 w) {
+		gU8 *	p;
+
+		if (c->txlen + sizeof(gU16) > c->txsize) {
+			netWrite(c);
+			if (c->txdone) {
+				memmove(c->txbuf, c->txbuf+c->txdone, c->txlen-c->txdone);
+				c->txlen -= c->txdone;
+				c->txdone = 0;
+			}
+			if (c->txlen + sizeof(gU16) > c->txsize) {
+				if (!(p = gfxRealloc(c->txbuf, c->txsize, c->txsize*2)))
+					gfxHalt("GDISP: uGFXnet - Memory allocation failed");
+				c->txbuf = p;
+				c->txsize *= 2;
+			}
+		}
+		c->txbuf[c->txlen++] = (gU8)(w >> 8);
+		c->txbuf[c->txlen++] = (gU8)w;
+	}
+#else
+	/**
+	 * Send everything in the transmit buffer.
+	 * If the connection closes before we send all the data - the call returns gFalse.
+	 * The caller must hold priv->lock.
+	 */
+	static gBool netWrite(netClient *c) {
+		unsigned	done;
+		int			len;
+
+		for(done = 0; done < c->txlen; done += len) {
+			MUTEX_ENTER;
+			len = send(c->netfd, (const char *)c->txbuf+done, c->txlen-done, MSG_NOSIGNAL);
+			MUTEX_EXIT;
+			if (len <= 0) {
+				c->txlen = 0;
+				return gFalse;
+			}
+		}
+		c->txlen = 0;
+		return gTrue;
+	}
+
+	/**
+	 * Add a gU16 to the transmit buffer in network order. A full buffer is sent straight away.
+	 * Anything else is sent by a flush, when a reply is needed or by the network thread within GDISP_GFXNET_FLUSH_PERIOD.
+	 * The caller must hold priv->lock.
+	 */
+	static void netPut(netClient *c, gU16 w) {
+		if (c->txlen > sizeof(c->txbuf) - sizeof(gU16))
+			netWrite(c);
+		c->txbuf[c->txlen++] = (gU8)(w >> 8);
+		c->txbuf[c->txlen++] = (gU8)w;
+	}
+#endif
+
+static void netPutPkt(netClient *c, const gU16 *pkt, int len) {
+	while(len--)
+		netPut(c, *pkt++);
+}
+
+#if GDISP_GFXNET_FRAMEBUFFER
+	// Can drawing be sent to this viewer as it is done? A V1.0 viewer that falls too far behind skips
+	//	the drawing until it has caught up and is then sent the whole frame buffer.
+	static gBool netSendNow(netClient *c) {
+		if (c->state != NET_IMMEDIATE)
+			return gFalse;
+		if (NET_QUEUED(c) < GDISP_GFXNET_QUEUE_SIZE)
+			return gTrue;
+		c->state = NET_BEHIND;
+		return gFalse;
+	}
+#endif
+
+// Send a command to every viewer that is sent drawing as it is done
+static void netPutAll(netPriv *priv, const gU16 *pkt, int len) {
+	#if GDISP_GFXNET_FRAMEBUFFER
+		netClient *	c;
+
+		for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+			if (netSendNow(c))
+				netPutPkt(c, pkt, len);
+		}
+	#else
+		netPutPkt(&priv->clients[0], pkt, len);
+	#endif
+}
+
+/**
+ * Get ready for cnt replies. This must be done before the requests are added to the
+ * transmit buffer as a full buffer is sent straight away.
+ * The caller must hold priv->lock.
+ */
+static void netExpectReplies(netPriv *priv, unsigned cnt) {
+	// Anything signalled earlier has nothing to do with these replies
+	while(gfxSemWait(&priv->replysem, gDelayNone));
+	priv->replylen = 0;
+	priv->replywant = cnt;
+}
+
 /**
- * Send a whole packet of data.
- * Len is specified in the number of gU16's we want to send as our protocol only talks gU16's.
- * Note that contents of the packet are modified to ensure it will cross the wire in the correct format.
- * If the connection closes before we send all the data - the call returns gFalse.
+ * Send the requests to the primary viewer and wait for the replies to arrive.
+ * The lock is released while waiting so the network thread can keep running.
+ * Returns gFalse if the viewer goes away first.
+ * The caller must hold priv->lock.
  */
-static gBool sendpkt(SOCKET_TYPE netfd, gU16 *pkt, int len) {
-	int		i;
+static gBool netGetReplies(netPriv *priv) {
+	unsigned	cnt;
+
+	cnt = priv->replywant;
+	if (priv->primary && netWrite(priv->primary)) {
+		gfxMutexExit(&priv->lock);
+		gfxSemWait(&priv->replysem, gDelayForever);
+		gfxMutexEnter(&priv->lock);
+	}
+	priv->replywant = 0;
+	return priv->replylen >= cnt;
+}
+
+// Save a reply and wake the waiting thread once they have all arrived. Replies nobody asked for are dropped.
+static void netReply(netPriv *priv, gU16 w) {
+	if (priv->replylen < priv->replywant) {
+		priv->reply[priv->replylen++] = w;
+		if (priv->replylen == priv->replywant)
+			gfxSemSignal(&priv->replysem);
+	}
+}
+
+#if GDISP_GFXNET_FRAMEBUFFER || GDISP_PIXELFORMAT == GDISP_LLD_PIXELFORMAT
+	/**
+	 * Send a rectangle of pixels.
+	 * V2.0 uses whichever of a fill, runs, a palette or the raw pixels is smallest.
+	 */
+	static void netSendRect(netClient *c, gCoord x, gCoord y, gCoord cx, gCoord cy, const LLDCOLOR_TYPE *src, gCoord stride) {
+		const LLDCOLOR_TYPE *	p;
+		LLDCOLOR_TYPE			pal[GNETCODE_PALETTE_MAX];
+		LLDCOLOR_TYPE			color;
+		unsigned				npal, runs, run, bits, k, raw, rle, packed;
+		gCoord					i, j;
+		gU16					w, nw;
+
+		raw = (unsigned)cx * cy;
+		if (c->version >= GNETCODE_VERSION_2_0) {
+			// Count the runs and the colors
+			color = src[0];
+			npal = runs = run = 0;
+			for(j = 0, p = src; j < cy; j++, p += stride) {
+				for(i = 0; i < cx; i++) {
+					if (!run || p[i] != color || run == 0xFFFF) {
+						color = p[i];
+						runs++;
+						run = 0;
+					}
+					run++;
+					if (npal <= GNETCODE_PALETTE_MAX) {
+						for(k = 0; k < npal && pal[k] != p[i]; k++);
+						if (k == npal) {
+							if (npal < GNETCODE_PALETTE_MAX)
+								pal[npal] = p[i];
+							npal++;
+						}
+					}
+				}
+			}
+
+			// A single color is just a fill
+			if (npal == 1) {
+				netPut(c, GNETCODE_FILL);
+				netPut(c, x);
+				netPut(c, y);
+				netPut(c, cx);
+				netPut(c, cy);
+				netPut(c, src[0]);
+				return;
+			}
+
+			// Work out the sizes of the encodings
+			rle = runs * 2;
+			bits = npal <= 2 ? 1 : (npal <= 4 ? 2 : 4);
+			packed = npal <= GNETCODE_PALETTE_MAX ? 1 + npal + cy * ((cx * bits + 15) / 16) : raw;
+
+			if (rle < raw && rle <= packed) {
+				netPut(c, GNETCODE_RLE);
+				netPut(c, x);
+				netPut(c, y);
+				netPut(c, cx);
+				netPut(c, cy);
+				color = src[0];
+				run = 0;
+				for(j = 0, p = src; j < cy; j++, p += stride) {
+					for(i = 0; i < cx; i++) {
+						if (run && (p[i] != color || run == 0xFFFF)) {
+							netPut(c, run);
+							netPut(c, color);
+							run = 0;
+						}
+						color = p[i];
+						run++;
+					}
+				}
+				netPut(c, run);
+				netPut(c, color);
+				return;
+			}
+
+			if (packed < raw) {
+				netPut(c, GNETCODE_PALETTE);
+				netPut(c, x);
+				netPut(c, y);
+				netPut(c, cx);
+				netPut(c, cy);
+				netPut(c, npal);
+				for(k = 0; k < npal; k++)
+					netPut(c, pal[k]);
+				for(j = 0, p = src; j < cy; j++, p += stride) {
+					// Each line starts in a new block
+					for(i = 0, w = 0, nw = 0; i < cx; i++) {
+						for(k = 0; pal[k] != p[i]; k++);
+						w = (gU16)((w << bits) | k);
+						if ((nw += bits) == 16) {
+							netPut(c, w);
+							w = nw = 0;
+						}
+					}
+					if (nw)
+						netPut(c, (gU16)(w << (16 - nw)));
+				}
+				return;
+			}
+		}
+
+		// The raw pixels
+		netPut(c, GNETCODE_BLIT);
+		netPut(c, x);
+		netPut(c, y);
+		netPut(c, cx);
+		netPut(c, cy);
+		for(j = 0, p = src; j < cy; j++, p += stride) {
+			for(i = 0; i < cx; i++)
+				netPut(c, p[i]);
+		}
+	}
+#endif
+
+
+#if GDISP_GFXNET_FRAMEBUFFER
+	// Mark the tiles covering an area as possibly different from what a viewer has
+	static void netDirtyClient(GDisplay *g, netClient *c, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		gCoord	tx, ty, tw;
+
+		tw = NET_TILESX(g);
+		for(ty = y / NET_TILE; ty <= (y + cy - 1) / NET_TILE; ty++) {
+			for(tx = x / NET_TILE; tx <= (x + cx - 1) / NET_TILE; tx++)
+				c->dirty[ty * tw + tx] = 1;
+		}
+		c->anydirty = gTrue;
+	}
+
+	// Mark an area as changed for every viewer that is sent frames
+	static void netDirty(GDisplay *g, netPriv *priv, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		netClient *	c;
+
+		for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+			if (c->state == NET_FRAMES)
+				netDirtyClient(g, c, x, y, cx, cy);
+		}
+	}
+
+	static gBool netIsDirty(GDisplay *g, netClient *c, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		gCoord	tx, ty, tw;
+
+		tw = NET_TILESX(g);
+		for(ty = y / NET_TILE; ty <= (y + cy - 1) / NET_TILE; ty++) {
+			for(tx = x / NET_TILE; tx <= (x + cx - 1) / NET_TILE; tx++) {
+				if (c->dirty[ty * tw + tx])
+					return gTrue;
+			}
+		}
+		return gFalse;
+	}
 
-	// Convert each gU16 to network order
-	for(i = 0; i < len; i++)
-		pkt[i] = htons(pkt[i]);
+	// Move an area of a buffer in an order that reads each line before it is overwritten
+	static void netMove(LLDCOLOR_TYPE *buf, gCoord stride, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord sx, gCoord sy) {
+		gCoord	j;
 
-	// Send it
-	len *= sizeof(gU16);
-	return send(netfd, (const char *)pkt, len, 0) == len;
+		if (y > sy) {
+			for(j = cy - 1; j >= 0; j--)
+				memmove(buf + (y + j) * stride + x, buf + (sy + j) * stride + sx, cx * sizeof(LLDCOLOR_TYPE));
+		} else {
+			for(j = 0; j < cy; j++)
+				memmove(buf + (y + j) * stride + x, buf + (sy + j) * stride + sx, cx * sizeof(LLDCOLOR_TYPE));
+		}
+	}
+
+	// Copy an area of the frame buffer. Viewers that are sent frames do the same copy.
+	static void netCopy(GDisplay *g, netPriv *priv, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord sx, gCoord sy) {
+		netClient *	c;
+
+		netMove(priv->fb, g->g.Width, x, y, cx, cy, sx, sy);
+		for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+			if (c->state != NET_FRAMES)
+				continue;
+
+			// A viewer that is behind just gets the result in its next frame
+			if (!c->refvalid || NET_QUEUED(c) >= GDISP_GFXNET_QUEUE_SIZE) {
+				netDirtyClient(g, c, x, y, cx, cy);
+				continue;
+			}
+
+			netMove(c->ref, g->g.Width, x, y, cx, cy, sx, sy);
+			netPut(c, GNETCODE_COPY);
+			netPut(c, x);
+			netPut(c, y);
+			netPut(c, cx);
+			netPut(c, cy);
+			netPut(c, sx);
+			netPut(c, sy);
+
+			// The destination only needs sending if the source hadn't been sent. The next frame shows the copy.
+			if (netIsDirty(g, c, sx, sy, cx, cy))
+				netDirtyClient(g, c, x, y, cx, cy);
+			c->anydirty = gTrue;
+		}
+	}
+
+	/**
+	 * Send the tiles that have changed as a frame.
+	 * Nothing is sent until the display has acknowledged the last frame. The tiles stay marked until then
+	 * so a slow display skips the frames in between.
+	 */
+	static void netSendFrame(GDisplay *g, netPriv *priv, netClient *c) {
+		gCoord	tx, ty, tw, th, t0, x, y, cx, cy, j;
+		gU8		*pd;
+
+		if (!c->anydirty || c->framesent != c->frameacked)
+			return;
+		tw = NET_TILESX(g);
+		th = NET_TILESY(g);
+		for(ty = 0, pd = c->dirty; ty < th; ty++, pd += tw) {
+			y = ty * NET_TILE;
+			cy = g->g.Height - y;
+			if (cy > NET_TILE)
+				cy = NET_TILE;
+
+			// Changed tiles next to each other on a row are sent together
+			for(tx = 0, t0 = -1; tx <= tw; tx++) {
+				if (tx < tw && pd[tx]) {
+					pd[tx] = 0;
+					x = tx * NET_TILE;
+					cx = g->g.Width - x;
+					if (cx > NET_TILE)
+						cx = NET_TILE;
+					for(j = 0; j < cy && c->refvalid; j++) {
+						if (memcmp(priv->fb + (y + j) * g->g.Width + x, c->ref + (y + j) * g->g.Width + x, cx * sizeof(LLDCOLOR_TYPE)))
+							break;
+					}
+					if (j < cy) {
+						if (t0 < 0)
+							t0 = tx;
+						continue;
+					}
+				}
+				if (t0 >= 0) {
+					x = t0 * NET_TILE;
+					cx = (tx < tw ? tx * NET_TILE : g->g.Width) - x;
+					netSendRect(c, x, y, cx, cy, priv->fb + y * g->g.Width + x, g->g.Width);
+					for(j = 0; j < cy; j++)
+						memcpy(c->ref + (y + j) * g->g.Width + x, priv->fb + (y + j) * g->g.Width + x, cx * sizeof(LLDCOLOR_TYPE));
+					t0 = -1;
+				}
+			}
+		}
+		c->anydirty = gFalse;
+		c->refvalid = gTrue;
+		netPut(c, GNETCODE_FRAME);
+		netPut(c, ++c->framesent);
+		netWrite(c);
+	}
+
+	// Where the pixel at a physical position is in the frame buffer when the display has orientation o
+	static unsigned netFbPos(gOrientation o, gCoord px, gCoord py) {
+		switch(o) {
+		case gOrientation0:
+		default:
+			return py * GDISP_SCREEN_WIDTH + px;
+		case gOrientation90:
+			return px * GDISP_SCREEN_HEIGHT + GDISP_SCREEN_HEIGHT - 1 - py;
+		case gOrientation180:
+			return (GDISP_SCREEN_HEIGHT - 1 - py) * GDISP_SCREEN_WIDTH + GDISP_SCREEN_WIDTH - 1 - px;
+		case gOrientation270:
+			return (GDISP_SCREEN_WIDTH - 1 - px) * GDISP_SCREEN_HEIGHT + py;
+		}
+	}
+
+	/**
+	 * Move the frame buffer into nfb laid out for the new orientation (g->g.Width and g->g.Height are already set)
+	 * so each pixel stays where it is on the display. The ref buffers are still in the old layout so they are not
+	 * trusted again until the whole display has been sent in the next frame.
+	 */
+	static void netRotate(GDisplay *g, netPriv *priv, LLDCOLOR_TYPE *nfb, gOrientation o) {
+		netClient *	c;
+		gCoord		px, py;
+
+		for(py = 0; py < GDISP_SCREEN_HEIGHT; py++) {
+			for(px = 0; px < GDISP_SCREEN_WIDTH; px++)
+				nfb[netFbPos(o, px, py)] = priv->fb[netFbPos(g->g.Orientation, px, py)];
+		}
+		gfxFree(priv->fb);
+		priv->fb = nfb;
+		for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++)
+			c->refvalid = gFalse;
+		netDirty(g, priv, 0, 0, g->g.Width, g->g.Height);
+	}
+
+	// Send the whole frame buffer to a viewer that is new (once we know which protocol it uses) or has fallen behind
+	static void netSync(GDisplay *g, netPriv *priv, netClient *c) {
+		if (c->version >= GNETCODE_VERSION_2_0) {
+			c->state = NET_FRAMES;
+			c->refvalid = gFalse;
+			netDirtyClient(g, c, 0, 0, g->g.Width, g->g.Height);
+			netSendFrame(g, priv, c);
+		} else {
+			c->state = NET_IMMEDIATE;
+			netSendRect(c, 0, 0, g->g.Width, g->g.Height, priv->fb, g->g.Width);
+			netPut(c, GNETCODE_FLUSH);
+			netWrite(c);
+		}
+	}
+
+	// Watch for the socket taking more while anything is queued. Only used by the network thread.
+	static void netPollWrite(netClient *c) {
+		gBool	want;
+
+		want = NET_QUEUED(c) ? gTrue : gFalse;
+		if (want == c->pollout)
+			return;
+		c->pollout = want;
+		#if GDISP_GFXNET_EPOLL
+		{
+			struct epoll_event	ev;
+
+			ev.events = want ? EPOLLIN|EPOLLOUT : EPOLLIN;
+			ev.data.ptr = c;
+			epoll_ctl(netPoll, EPOLL_CTL_MOD, c->netfd, &ev);
+		}
+		#else
+			if (want)
+				FD_SET(c->netfd, &netWriteSet);
+			else
+				FD_CLR(c->netfd, &netWriteSet);
+		#endif
+	}
+
+	// Send more of the transmit buffer now the socket has room
+	static void netFlush(netClient *c) {
+		netPriv	*	priv;
+
+		priv = c->g->priv;
+		gfxMutexEnter(&priv->lock);
+		netWrite(c);
+		gfxMutexExit(&priv->lock);
+	}
+#endif
+
+/**
+ * Wait for a display to connect unless GDISP_DONT_WAIT_FOR_NET_DISPLAY. Returns gFalse if there is no display.
+ * With a frame buffer drawing still goes into it when there is no display. It is sent when one connects.
+ */
+static gBool netWait(GDisplay *g) {
+	#if GDISP_DONT_WAIT_FOR_NET_DISPLAY
+		if (!(g->flags & GDISP_FLG_CONNECTED))
+			return gFalse;
+	#else
+		while(!(g->flags & GDISP_FLG_CONNECTED))
+			gfxSleepMilliseconds(200);
+	#endif
+	return gTrue;
 }
 
-static gBool newconnection(SOCKET_TYPE clientfd) {
+static netClient *newconnection(SOCKET_TYPE clientfd) {
 	GDisplay *	g;
     netPriv *	priv;
+	netClient *	c;
+	#if GDISP_GFXNET_VIEWERS > 1
+		GDisplay *	gwatched;
+	#endif
 
-	// Look for a display that isn't connected
+	// Look for a display that isn't connected. Failing that one that can take another viewer.
+	#if GDISP_GFXNET_VIEWERS > 1
+		gwatched = 0;
+	#endif
 	for(g = 0; (g = (GDisplay *)gdriverGetNext(GDRIVER_TYPE_DISPLAY, (GDriver *)g));) {
 		// Ignore displays for other controllers
 		#ifdef GDISP_DRIVER_LIST
@@ -209,104 +820,214 @@ static gBool newconnection(SOCKET_TYPE clientfd) {
 		#endif
 		if (!(g->flags & GDISP_FLG_CONNECTED))
 			break;
+		#if GDISP_GFXNET_VIEWERS > 1
+			if (!gwatched) {
+				priv = g->priv;
+				for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+					if (c->netfd == (SOCKET_TYPE)-1) {
+						gwatched = g;
+						break;
+					}
+				}
+			}
+		#endif
 	}
+	#if GDISP_GFXNET_VIEWERS > 1
+		if (!g)
+			g = gwatched;
+	#endif
 
 	// Was anything found?
 	if (!g)
-		return gFalse;
+		return 0;
 
-	// Reset the priv area
+	// Find the free viewer slot
 	priv = g->priv;
-	priv->netfd = clientfd;
-	priv->databytes = 0;
-	priv->mousebuttons = 0;
-
-	// Send the initialisation data (2 words at a time)
-	priv->data[0] = GNETCODE_INIT;
-	priv->data[1] = GNETCODE_VERSION;
-	sendpkt(priv->netfd, priv->data, 2);
-	priv->data[0] = GDISP_SCREEN_WIDTH;
-	priv->data[1] = GDISP_SCREEN_HEIGHT;
-	sendpkt(priv->netfd, priv->data, 2);
-	priv->data[0] = GDISP_LLD_PIXELFORMAT;
-	priv->data[1] = 1;							// We have a mouse
-	MUTEX_ENTER;
-	sendpkt(priv->netfd, priv->data, 2);
-	MUTEX_EXIT;
+	c = priv->clients;
+	while(c->netfd != (SOCKET_TYPE)-1)
+		c++;
+
+	// We do our own buffering. Don't let the socket hold back requests that we then wait on.
+	#ifdef TCP_NODELAY
+	{
+		int		one = 1;
+		setsockopt(clientfd, IPPROTO_TCP, TCP_NODELAY, (const char *)&one, sizeof(one));
+	}
+	#endif
+
+	// With a frame buffer a slow viewer can always be caught up later so it must never hold up drawing
+	#if GDISP_GFXNET_FRAMEBUFFER
+		SetNonBlocking(clientfd);
+	#endif
+
+	// Reset the viewer
+	gfxMutexEnter(&priv->lock);
+	c->netfd = clientfd;
+	c->rxlen = 0;
+	c->datacnt = 0;
+	c->arealeft = 0;
+	c->version = GNETCODE_VERSION_1_0;
+	c->txlen = 0;
+
+	// Send the initialisation data. Every display starts with V1.0 and can then ask for an upgrade.
+	netPut(c, GNETCODE_INIT);
+	netPut(c, GNETCODE_VERSION_1_0);
+	netPut(c, GDISP_SCREEN_WIDTH);
+	netPut(c, GDISP_SCREEN_HEIGHT);
+	netPut(c, GDISP_LLD_PIXELFORMAT);
+	netPut(c, 1);							// We have a mouse
+	c->skipreplies = 0;
+
+	// A display that connects after the orientation has been changed needs telling
+	#if GDISP_NEED_CONTROL
+		if (g->g.Orientation != gOrientation0) {
+			netPut(c, GNETCODE_CONTROL);
+			netPut(c, GDISP_CONTROL_ORIENTATION);
+			netPut(c, g->g.Orientation);
+			c->skipreplies++;
+		}
+	#endif
+	netWrite(c);
+
+	// The frame buffer is sent when we know which protocol to use
+	#if GDISP_GFXNET_FRAMEBUFFER
+		c->pollout = gFalse;
+		c->state = NET_SYNC;
+		c->connecttime = gfxSystemTicks();
+		c->framesent = c->frameacked = 0;
+	#endif
+
+	// The first viewer answers reads and controls
+	if (!priv->primary) {
+		priv->primary = c;
+		#if GINPUT_NEED_MOUSE
+			priv->mousebuttons = 0;
+		#endif
+	}
 
 	// The display is now working
 	g->flags |= GDISP_FLG_CONNECTED;
+	gfxMutexExit(&priv->lock);
 
 	// Send a redraw all
-	#if GFX_USE_GWIN && GWIN_NEED_WINDOWMANAGER
+	#if !GDISP_GFXNET_FRAMEBUFFER && GFX_USE_GWIN && GWIN_NEED_WINDOWMANAGER
 		gdispGClear(g, gwinGetDefaultBgColor());
 		gwinRedrawDisplay(g, gFalse);
 	#endif
 
-	return gTrue;
+	return c;
 }
 
-static gBool rxdata(SOCKET_TYPE fd) {
+// A viewer has gone away. Another viewer takes over as the primary.
+static void netClose(netClient *c) {
 	GDisplay *	g;
-    netPriv *	priv;
-    int			len;
+	netPriv *	priv;
+	gBool		wasprimary;
 
-	// Look for a display that is connected and the socket descriptor matches
-	for(g = 0; (g = (GDisplay *)gdriverGetNext(GDRIVER_TYPE_DISPLAY, (GDriver *)g));) {
-		// Ignore displays for other controllers
-		#ifdef GDISP_DRIVER_LIST
-			if (gvmt(g) != &GDISPVMT_uGFXnet)
-				continue;
+	g = c->g;
+	priv = g->priv;
+	gfxMutexEnter(&priv->lock);
+	c->netfd = (SOCKET_TYPE)-1;
+	#if GDISP_GFXNET_FRAMEBUFFER
+		c->state = NET_CLOSED;
+		c->txlen = c->txdone = 0;
+	#endif
+	wasprimary = priv->primary == c;
+	if (wasprimary) {
+		priv->primary = 0;
+		for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+			if (c->netfd != (SOCKET_TYPE)-1) {
+				priv->primary = c;
+				break;
+			}
+		}
+		#if GINPUT_NEED_MOUSE
+			priv->mousebuttons = 0;
 		#endif
-		priv = g->priv;
-		if ((g->flags & GDISP_FLG_CONNECTED) && priv->netfd == fd)
-			break;
 	}
-	if (!g)
-		gfxHalt("GDISP: uGFXnet - Got data from unrecognized connection");
-
-	if ((g->flags & GDISP_FLG_HAVEDATA)) {
-		// The higher level is still processing the previous data.
-		//	Give it a chance to run by coming back to this data.
-		gfxSleepMilliseconds(1);
-		return gTrue;
-	}
-
-	/* handle data from a client */
-	MUTEX_ENTER;
-	if ((len = recv(fd, ((char *)priv->data)+priv->databytes, sizeof(priv->data)-priv->databytes, 0)) <= 0) {
-		// Socket closed or in error state
-		MUTEX_EXIT;
+	if (!priv->primary)
 		g->flags &= ~GDISP_FLG_CONNECTED;
-		return gFalse;
-	}
-	MUTEX_EXIT;
+	gfxMutexExit(&priv->lock);
 
-	// Do we have a full reply yet
-	priv->databytes += len;
-	if (priv->databytes < sizeof(priv->data))
-		return gTrue;
-	priv->databytes = 0;
+	// Wake anything waiting for a reply
+	if (wasprimary)
+		gfxSemSignal(&priv->replysem);
+}
 
-	// Convert network byte or to host byte order
-	priv->data[0] = ntohs(priv->data[0]);
-	priv->data[1] = ntohs(priv->data[1]);
+// Process a code and value received from a viewer
+static void rxcmd(GDisplay *g, netPriv *priv, netClient *c) {
+	#if !GDISP_GFXNET_FRAMEBUFFER
+		(void) g;
+	#endif
 
-	// Process the data received
-	switch(priv->data[0]) {
+	switch(c->data[0]) {
 	#if GINPUT_NEED_MOUSE
-		case GNETCODE_MOUSE_X:		priv->mousex = priv->data[1];		break;
-		case GNETCODE_MOUSE_Y:		priv->mousey = priv->data[1];		break;
+		// Only the primary viewer drives the mouse. The others just watch.
+		case GNETCODE_MOUSE_X:
+			if (c == priv->primary)
+				priv->mousex = c->data[1];
+			break;
+		case GNETCODE_MOUSE_Y:
+			if (c == priv->primary)
+				priv->mousey = c->data[1];
+			break;
 		case GNETCODE_MOUSE_B:
-			priv->mousebuttons = priv->data[1];
-			// Treat the button event as the sync signal
-			_gmouseWakeup(priv->mouse);
+			if (c == priv->primary) {
+				priv->mousebuttons = c->data[1];
+				// Treat the button event as the sync signal
+				_gmouseWakeup(priv->mouse);
+			}
 			break;
 	#endif
 	case GNETCODE_CONTROL:
+		// Nobody is waiting for the answer to an orientation a new display was told about
+		if (c->skipreplies) {
+			c->skipreplies--;
+			break;
+		}
+		// Fall through
 	case GNETCODE_READ:
-		g->flags |= GDISP_FLG_HAVEDATA;
+		gfxMutexEnter(&priv->lock);
+		if (c == priv->primary)
+			netReply(priv, c->data[1]);
+		gfxMutexExit(&priv->lock);
+		break;
+	case GNETCODE_READ_AREA:
+		// The colors follow
+		c->arealeft = c->data[1];
+		break;
+	case GNETCODE_UPGRADE:
+		// Agree on the newest version we both understand
+		gfxMutexEnter(&priv->lock);
+		c->version = c->data[1] < GNETCODE_VERSION ? c->data[1] : GNETCODE_VERSION;
+		if (c->version < GNETCODE_VERSION_1_0)
+			c->version = GNETCODE_VERSION_1_0;
+		netPut(c, GNETCODE_UPGRADE);
+		netPut(c, c->version);
+		#if GDISP_GFXNET_FRAMEBUFFER
+			if (c->state == NET_SYNC || c->state == NET_BEHIND)
+				netSync(g, priv, c);
+			else if (c->state == NET_IMMEDIATE && c->version >= GNETCODE_VERSION_2_0) {
+				// The display already has everything drawn so far
+				memcpy(c->ref, priv->fb, GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT * sizeof(LLDCOLOR_TYPE));
+				memset(c->dirty, 0, NET_TILESX(g) * NET_TILESY(g));
+				c->anydirty = gFalse;
+				c->refvalid = gTrue;
+				c->state = NET_FRAMES;
+			}
+		#endif
+		netWrite(c);
+		gfxMutexExit(&priv->lock);
 		break;
+	#if GDISP_GFXNET_FRAMEBUFFER
+		case GNETCODE_FRAME:
+			// The display has shown a frame. Send the next one if it is ready.
+			gfxMutexEnter(&priv->lock);
+			c->frameacked = c->data[1];
+			netSendFrame(g, priv, c);
+			gfxMutexExit(&priv->lock);
+			break;
+	#endif
 	case GNETCODE_KILL:
 		gfxHalt("GDISP: uGFXnet - Display sent KILL command");
 		break;
@@ -315,25 +1036,179 @@ static gBool rxdata(SOCKET_TYPE fd) {
 		// Just ignore unrecognised data
 		break;
 	}
+}
+
+// Handle data from a viewer. Returns gFalse if the viewer has gone.
+static gBool rxdata(netClient *c) {
+	GDisplay *	g;
+    netPriv *	priv;
+    int			len;
+    gU8 *		p;
+    gU16		w;
+
+	g = c->g;
+	priv = g->priv;
+
+	/* handle data from a client */
+	MUTEX_ENTER;
+	if ((len = recv(c->netfd, (char *)c->rxbuf+c->rxlen, sizeof(c->rxbuf)-c->rxlen, 0)) <= 0) {
+		// Nothing to read after all
+		#if GDISP_GFXNET_FRAMEBUFFER
+			if (len < 0 && SOCKET_WOULDBLOCK()) {
+				MUTEX_EXIT;
+				return gTrue;
+			}
+		#endif
+
+		// Socket closed or in error state
+		MUTEX_EXIT;
+		netClose(c);
+		return gFalse;
+	}
+	MUTEX_EXIT;
+	c->rxlen += len;
+
+	// Process each whole word received (in network order)
+	for(p = c->rxbuf; p+sizeof(gU16) <= c->rxbuf+c->rxlen; p += sizeof(gU16)) {
+		w = (gU16)((p[0] << 8) | p[1]);
+
+		// The colors of an area read
+		if (c->arealeft) {
+			c->arealeft--;
+			gfxMutexEnter(&priv->lock);
+			if (c == priv->primary)
+				netReply(priv, w);
+			gfxMutexExit(&priv->lock);
+			continue;
+		}
+
+		// Everything else is a code and a value
+		c->data[c->datacnt++] = w;
+		if (c->datacnt < 2)
+			continue;
+		c->datacnt = 0;
+		rxcmd(g, priv, c);
+	}
+
+	// Keep any odd byte for next time
+	if ((c->rxlen & 1))
+		c->rxbuf[0] = c->rxbuf[c->rxlen-1];
+	c->rxlen &= 1;
 	return gTrue;
 }
 
-static GFX_THREAD_STACK(waNetThread, 512);
-static GFX_THREAD_FUNCTION(NetThread, param) {
-	SOCKET_TYPE			listenfd, fdmax, i, clientfd;
+#if !GDISP_GFXNET_EPOLL
+	// Find the viewer using a socket
+	static netClient *netFindClient(SOCKET_TYPE fd) {
+		GDisplay *	g;
+		netPriv *	priv;
+		netClient *	c;
+
+		for(g = 0; (g = (GDisplay *)gdriverGetNext(GDRIVER_TYPE_DISPLAY, (GDriver *)g));) {
+			// Ignore displays for other controllers
+			#ifdef GDISP_DRIVER_LIST
+				if (gvmt(g) != &GDISPVMT_uGFXnet)
+					continue;
+			#endif
+			priv = g->priv;
+			for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+				if (c->netfd == fd)
+					return c;
+			}
+		}
+		gfxHalt("GDISP: uGFXnet - Got data from unrecognized connection");
+		return 0;
+	}
+#endif
+
+// Send anything that is waiting
+static void netPeriodic(void) {
+	GDisplay *	g;
+    netPriv *	priv;
+	netClient *	c;
+
+	for(g = 0; (g = (GDisplay *)gdriverGetNext(GDRIVER_TYPE_DISPLAY, (GDriver *)g));) {
+		// Ignore displays for other controllers
+		#ifdef GDISP_DRIVER_LIST
+			if (gvmt(g) != &GDISPVMT_uGFXnet)
+				continue;
+		#endif
+		if (!(g->flags & GDISP_FLG_CONNECTED))
+			continue;
+		priv = g->priv;
+		gfxMutexEnter(&priv->lock);
+		for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+			if (c->netfd == (SOCKET_TYPE)-1)
+				continue;
+			#if GDISP_GFXNET_FRAMEBUFFER
+				switch(c->state) {
+				case NET_SYNC:
+					if (gfxSystemTicks() - c->connecttime >= gfxMillisecondsToTicks(NET_UPGRADE_WAIT))
+						netSync(g, priv, c);
+					break;
+				case NET_FRAMES:
+					netSendFrame(g, priv, c);
+					break;
+				case NET_BEHIND:
+					// Caught up at last
+					if (!NET_QUEUED(c))
+						netSync(g, priv, c);
+					break;
+				}
+			#endif
+			if (c->txlen)
+				netWrite(c);
+			#if GDISP_GFXNET_FRAMEBUFFER
+				netPollWrite(c);
+			#endif
+		}
+		gfxMutexExit(&priv->lock);
+	}
+}
+
+// Accept a new viewer. Returns 0 if there is nothing for it to show.
+static netClient *netAccept(SOCKET_TYPE listenfd) {
+	SOCKET_TYPE			clientfd;
 	socklen_t			len;
-	fd_set				master, read_fds;
+	struct sockaddr_in	addr;
+	netClient *			c;
+
+	len = sizeof(addr);
+	if((clientfd = accept(listenfd, (struct sockaddr *)&addr, &len)) == (SOCKET_TYPE)-1)
+		gfxHalt("GDISP: uGFXnet - Accept failed");
+	//printf("New connection from %s on socket %d\n", inet_ntoa(addr.sin_addr), clientfd);
+
+	// Can we handle it?
+	if (!(c = newconnection(clientfd))) {
+		// No - Just close the connection
+		closesocket(clientfd);
+		//printf("Rejected connection as all displays are already connected\n");
+	}
+	return c;
+}
+
+static GFX_THREAD_STACK(waNetThread, 1024);
+static GFX_THREAD_FUNCTION(NetThread, param) {
+	SOCKET_TYPE			listenfd, clientfd;
     struct sockaddr_in	addr;
+	netClient *			c;
+	#if GDISP_GFXNET_EPOLL
+		struct epoll_event	ev, events[NET_EVENTS];
+		int					i, cnt;
+	#else
+		SOCKET_TYPE			fdmax, i;
+		fd_set				master, read_fds;
+		#if GDISP_GFXNET_FRAMEBUFFER
+			fd_set			write_fds;
+		#endif
+		struct timeval		tv;
+	#endif
 	(void)param;
 
 	// Start the sockets layer
 	StartSockets();
 	gfxSleepMilliseconds(100);					// Make sure the thread has time to start.
 
-	/* clear the master and temp sets */
-	FD_ZERO(&master);
-	FD_ZERO(&read_fds);
-
 	if ((listenfd = socket(AF_INET, SOCK_STREAM, 0)) == (SOCKET_TYPE)-1)
 		gfxHalt("GDISP: uGFXnet - Socket failed");
 
@@ -348,80 +1223,133 @@ static GFX_THREAD_FUNCTION(NetThread, param) {
     if (listen(listenfd, 10) == -1)
 		gfxHalt("GDISP: uGFXnet - Listen failed");
 
+	#if GDISP_GFXNET_EPOLL
+		if ((netPoll = epoll_create1(0)) == -1)
+			gfxHalt("GDISP: uGFXnet - Epoll failed");
+
+		// The listener is the only thing without a viewer
+		ev.events = EPOLLIN;
+		ev.data.ptr = 0;
+		if (epoll_ctl(netPoll, EPOLL_CTL_ADD, listenfd, &ev) == -1)
+			gfxHalt("GDISP: uGFXnet - Epoll failed");
+
+		for(;;) {
+			cnt = epoll_wait(netPoll, events, NET_EVENTS, GDISP_GFXNET_FLUSH_PERIOD);
+			if (cnt == -1 && errno != EINTR)
+				gfxHalt("GDISP: uGFXnet - Epoll failed");
+
+			for(i = 0; i < cnt; i++) {
+				// Handle new connections
+				if (!(c = events[i].data.ptr)) {
+					if ((c = netAccept(listenfd))) {
+						ev.events = EPOLLIN;
+						ev.data.ptr = c;
+						if (epoll_ctl(netPoll, EPOLL_CTL_ADD, c->netfd, &ev) == -1)
+							gfxHalt("GDISP: uGFXnet - Epoll failed");
+					}
+					continue;
+				}
 
-    /* add the listener to the master set */
-    FD_SET(listenfd, &master);
-
-    /* keep track of the biggest file descriptor */
-    fdmax = listenfd; /* so far, it's this one*/
-
-	#if GDISP_GFXNET_BROKEN_LWIP_ACCEPT
-		#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
-			#warning "Using GDISP_GFXNET_BROKEN_LWIP_ACCEPT limits the number of displays and the use of GFXNET. Avoid if possible!"
-		#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
-			COMPILER_WARNING("Using GDISP_GFXNET_BROKEN_LWIP_ACCEPT limits the number of displays and the use of GFXNET. Avoid if possible!")
-		#endif
-		len = sizeof(addr);
-		if((clientfd = accept(listenfd, (struct sockaddr *)&addr, &len)) == (SOCKET_TYPE)-1)
-			gfxHalt("GDISP: uGFXnet - Accept failed");
-		//printf("New connection from %s on socket %d\n", inet_ntoa(addr.sin_addr), clientfd);
+				// The socket can take more
+				#if GDISP_GFXNET_FRAMEBUFFER
+					if ((events[i].events & EPOLLOUT))
+						netFlush(c);
+				#endif
+
+				// Handle data from a viewer
+				if ((events[i].events & (EPOLLIN|EPOLLHUP|EPOLLERR))) {
+					clientfd = c->netfd;
+					if (!rxdata(c)) {
+						epoll_ctl(netPoll, EPOLL_CTL_DEL, clientfd, &ev);
+						closesocket(clientfd);
+					}
+				}
+			}
 
-		if (!newconnection(clientfd)) {
-			// No Just close the connection
-			closesocket(clientfd);
-			gfxHalt("GDISP: uGFXnet - Can't find display for connection");
-			return 0;
+			// Send anything buffered and any frames that are due
+			netPeriodic();
 		}
+	#else
+		/* clear the master and temp sets */
+		FD_ZERO(&master);
+		FD_ZERO(&read_fds);
+		#if GDISP_GFXNET_FRAMEBUFFER
+			FD_ZERO(&netWriteSet);
+		#endif
 
-		// Save the descriptor
-		FD_SET(clientfd, &master);
-		if (clientfd > fdmax) fdmax = clientfd;
-	#endif
-
-    /* loop */
-    for(;;) {
-		/* copy it */
-		read_fds = master;
-		if (select(fdmax+1, &read_fds, 0, 0, 0) == -1)
-			gfxHalt("GDISP: uGFXnet - Select failed");
-
-		// Run through the existing connections looking for data to be read
-		for(i = 0; i <= fdmax; i++) {
-			if(!FD_ISSET(i, &read_fds))
-				continue;
+		/* add the listener to the master set */
+		FD_SET(listenfd, &master);
 
-			// Handle new connections
-			if(i == listenfd) {
+		/* keep track of the biggest file descriptor */
+		fdmax = listenfd; /* so far, it's this one*/
 
-				// Accept the connection
-				len = sizeof(addr);
-				if((clientfd = accept(listenfd, (struct sockaddr *)&addr, &len)) == (SOCKET_TYPE)-1)
-					gfxHalt("GDISP: uGFXnet - Accept failed");
-				//printf("New connection from %s on socket %d\n", inet_ntoa(addr.sin_addr), clientfd);
+		#if GDISP_GFXNET_BROKEN_LWIP_ACCEPT
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "Using GDISP_GFXNET_BROKEN_LWIP_ACCEPT limits the number of displays and the use of GFXNET. Avoid if possible!"
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("Using GDISP_GFXNET_BROKEN_LWIP_ACCEPT limits the number of displays and the use of GFXNET. Avoid if possible!")
+			#endif
+			if (!(c = netAccept(listenfd))) {
+				gfxHalt("GDISP: uGFXnet - Can't find display for connection");
+				return 0;
+			}
 
-				// Can we handle it?
-				if (!newconnection(clientfd)) {
+			// Save the descriptor
+			FD_SET(c->netfd, &master);
+			if (c->netfd > fdmax) fdmax = c->netfd;
+		#endif
 
-					// No - Just close the connection
-					closesocket(clientfd);
+		/* loop */
+		for(;;) {
+			/* copy it */
+			read_fds = master;
+			tv.tv_sec = 0;
+			tv.tv_usec = GDISP_GFXNET_FLUSH_PERIOD * 1000;
+			#if GDISP_GFXNET_FRAMEBUFFER
+				write_fds = netWriteSet;
+				if (select(fdmax+1, &read_fds, &write_fds, 0, &tv) == -1)
+					gfxHalt("GDISP: uGFXnet - Select failed");
+			#else
+				if (select(fdmax+1, &read_fds, 0, 0, &tv) == -1)
+					gfxHalt("GDISP: uGFXnet - Select failed");
+			#endif
+
+			// Run through the existing connections looking for data to be read
+			for(i = 0; i <= fdmax; i++) {
+				// The socket can take more
+				#if GDISP_GFXNET_FRAMEBUFFER
+					if (FD_ISSET(i, &write_fds))
+						netFlush(netFindClient(i));
+				#endif
+
+				if(!FD_ISSET(i, &read_fds))
+					continue;
 
-					//printf("Rejected connection as all displays are already connected\n");
+				// Handle new connections
+				if(i == listenfd) {
+					if ((c = netAccept(listenfd))) {
+						// Save the descriptor
+						clientfd = c->netfd;
+						FD_SET(clientfd, &master);
+						if (clientfd > fdmax) fdmax = clientfd;
+					}
 					continue;
 				}
 
-				// Save the descriptor
-				FD_SET(clientfd, &master);
-				if (clientfd > fdmax) fdmax = clientfd;
-				continue;
+				// Handle data from a client
+				if (!rxdata(netFindClient(i))) {
+					closesocket(i);
+					FD_CLR(i, &master);
+					#if GDISP_GFXNET_FRAMEBUFFER
+						FD_CLR(i, &netWriteSet);
+					#endif
+				}
 			}
 
-			// Handle data from a client
-			if (!rxdata(i)) {
-				closesocket(i);
-				FD_CLR(clientfd, &master);
-			}
+			// Send anything buffered and any frames that are due
+			netPeriodic();
 		}
-	}
+	#endif
     return 0;
 }
 
@@ -431,6 +1359,7 @@ static GFX_THREAD_FUNCTION(NetThread, param) {
 
 LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	netPriv	*	priv;
+	netClient *	c;
 
 	// Initialise the receiver thread (if it hasn't been done already)
 	if (!hThread) {
@@ -443,9 +1372,32 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	if (!(priv = gfxAlloc(sizeof(netPriv))))
 		gfxHalt("GDISP: uGFXnet - Memory allocation failed");
 	memset(priv, 0, sizeof(netPriv));
+	gfxMutexInit(&priv->lock);
+	gfxSemInit(&priv->replysem, 0, 1);
 	g->priv = priv;
 	g->board = 0;			// no board interface for this controller
 
+	// Create the frame buffer (which starts black)
+	#if GDISP_GFXNET_FRAMEBUFFER
+		if (!(priv->fb = gfxAlloc(GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT * sizeof(LLDCOLOR_TYPE))))
+			gfxHalt("GDISP: uGFXnet - Memory allocation failed");
+		memset(priv->fb, 0, GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT * sizeof(LLDCOLOR_TYPE));
+	#endif
+
+	// Each viewer needs to know what it has been sent
+	for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+		c->g = g;
+		c->netfd = (SOCKET_TYPE)-1;
+		#if GDISP_GFXNET_FRAMEBUFFER
+			c->txsize = GDISP_GFXNET_TXBUFFER_SIZE;
+			if (!(c->txbuf = gfxAlloc(GDISP_GFXNET_TXBUFFER_SIZE))
+					|| !(c->ref = gfxAlloc(GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT * sizeof(LLDCOLOR_TYPE)))
+					|| !(c->dirty = gfxAlloc(((GDISP_SCREEN_WIDTH + NET_TILE - 1) / NET_TILE) * ((GDISP_SCREEN_HEIGHT + NET_TILE - 1) / NET_TILE))))
+				gfxHalt("GDISP: uGFXnet - Memory allocation failed");
+			memset(c->dirty, 0, ((GDISP_SCREEN_WIDTH + NET_TILE - 1) / NET_TILE) * ((GDISP_SCREEN_HEIGHT + NET_TILE - 1) / NET_TILE));
+		#endif
+	}
+
 	// Create the associated mouse
 	#if GINPUT_NEED_MOUSE
 		priv->mouse = (GMouse *)gdriverRegister((const GDriverVMT const *)GMOUSE_DRIVER_VMT, g);
@@ -465,21 +1417,33 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 #if GDISP_HARDWARE_FLUSH
 	LLDSPEC void gdisp_lld_flush(GDisplay *g) {
 		netPriv	*	priv;
-		gU16	buf[1];
 
-		#if GDISP_DONT_WAIT_FOR_NET_DISPLAY
-			if (!(g->flags & GDISP_FLG_CONNECTED))
-				return;
-		#else
-			while(!(g->flags & GDISP_FLG_CONNECTED))
-				gfxSleepMilliseconds(200);
+		#if GDISP_GFXNET_FRAMEBUFFER
+			netClient *	c;
 		#endif
 
-		priv = g->priv;
-		buf[0] = GNETCODE_FLUSH;
-		MUTEX_ENTER;
-		sendpkt(priv->netfd, buf, 1);
-		MUTEX_EXIT;
+		if (!netWait(g))
+			return;
+
+		#if GDISP_GFXNET_FRAMEBUFFER
+			priv = g->priv;
+			gfxMutexEnter(&priv->lock);
+			for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+				if (c->state == NET_FRAMES)
+					netSendFrame(g, priv, c);
+				else if (c->state == NET_IMMEDIATE) {
+					netPut(c, GNETCODE_FLUSH);
+					netWrite(c);
+				}
+			}
+			gfxMutexExit(&priv->lock);
+		#else
+			priv = g->priv;
+			gfxMutexEnter(&priv->lock);
+			netPut(&priv->clients[0], GNETCODE_FLUSH);
+			netWrite(&priv->clients[0]);
+			gfxMutexExit(&priv->lock);
+		#endif
 	}
 #endif
 
@@ -488,12 +1452,11 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		netPriv	*	priv;
 		gU16	buf[4];
 
-		#if GDISP_DONT_WAIT_FOR_NET_DISPLAY
-			if (!(g->flags & GDISP_FLG_CONNECTED))
-				return;
+		#if GDISP_GFXNET_FRAMEBUFFER
+			netWait(g);
 		#else
-			while(!(g->flags & GDISP_FLG_CONNECTED))
-				gfxSleepMilliseconds(200);
+			if (!netWait(g))
+				return;
 		#endif
 
 		priv = g->priv;
@@ -501,9 +1464,13 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		buf[1] = g->p.x;
 		buf[2] = g->p.y;
 		buf[3] = gdispColor2Native(g->p.color);
-		MUTEX_ENTER;
-		sendpkt(priv->netfd, buf, 4);
-		MUTEX_EXIT;
+		gfxMutexEnter(&priv->lock);
+		#if GDISP_GFXNET_FRAMEBUFFER
+			priv->fb[g->p.y * g->g.Width + g->p.x] = buf[3];
+			netDirty(g, priv, g->p.x, g->p.y, 1, 1);
+		#endif
+		netPutAll(priv, buf, 4);
+		gfxMutexExit(&priv->lock);
 	}
 #endif
 
@@ -514,12 +1481,11 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		netPriv	*	priv;
 		gU16	buf[6];
 
-		#if GDISP_DONT_WAIT_FOR_NET_DISPLAY
-			if (!(g->flags & GDISP_FLG_CONNECTED))
-				return;
+		#if GDISP_GFXNET_FRAMEBUFFER
+			netWait(g);
 		#else
-			while(!(g->flags & GDISP_FLG_CONNECTED))
-				gfxSleepMilliseconds(200);
+			if (!netWait(g))
+				return;
 		#endif
 
 		priv = g->priv;
@@ -529,9 +1495,18 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		buf[3] = g->p.cx;
 		buf[4] = g->p.cy;
 		buf[5] = gdispColor2Native(g->p.color);
-		MUTEX_ENTER;
-		sendpkt(priv->netfd, buf, 6);
-		MUTEX_EXIT;
+		gfxMutexEnter(&priv->lock);
+		#if GDISP_GFXNET_FRAMEBUFFER
+		{
+			gCoord	y;
+
+			for(y = g->p.y; y < g->p.y + g->p.cy; y++)
+				gdispRenderFill(priv->fb + y * g->g.Width, g->p.x, g->p.cx, buf[5]);
+			netDirty(g, priv, g->p.x, g->p.y, g->p.cx, g->p.cy);
+		}
+		#endif
+		netPutAll(priv, buf, 6);
+		gfxMutexExit(&priv->lock);
 	}
 #endif
 
@@ -539,70 +1514,172 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	LLDSPEC void gdisp_lld_blit_area(GDisplay *g) {
 		netPriv	*	priv;
 		gPixel	*	buffer;
-		gU16	buf[5];
-		gCoord		x, y;
 
-		#if GDISP_DONT_WAIT_FOR_NET_DISPLAY
-			if (!(g->flags & GDISP_FLG_CONNECTED))
-				return;
+		#if GDISP_GFXNET_FRAMEBUFFER
+			netWait(g);
 		#else
-			while(!(g->flags & GDISP_FLG_CONNECTED))
-				gfxSleepMilliseconds(200);
+			if (!netWait(g))
+				return;
 		#endif
 
 		// Make everything relative to the start of the line
 		buffer = g->p.ptr;
-		buffer += g->p.x2*g->p.y1;
+		buffer += g->p.x2*g->p.y1 + g->p.x1;
 
 		priv = g->priv;
-		buf[0] = GNETCODE_BLIT;
-		buf[1] = g->p.x;
-		buf[2] = g->p.y;
-		buf[3] = g->p.cx;
-		buf[4] = g->p.cy;
-		MUTEX_ENTER;
-		sendpkt(priv->netfd, buf, 5);
-
-		for(y = 0; y < g->p.cy; y++, buffer += g->p.x2 - g->p.cx) {
-			for(x = 0; x < g->p.cx; x++, buffer++) {
-				buf[0] = gdispColor2Native(buffer[0]);
-				sendpkt(priv->netfd, buf, 1);
+		gfxMutexEnter(&priv->lock);
+		#if GDISP_GFXNET_FRAMEBUFFER
+		{
+			netClient *	c;
+			gCoord		y;
+
+			for(y = 0; y < g->p.cy; y++, buffer += g->p.x2)
+				gdispRenderBlit(priv->fb + (g->p.y + y) * g->g.Width, g->p.x, buffer, g->p.cx);
+			netDirty(g, priv, g->p.x, g->p.y, g->p.cx, g->p.cy);
+			for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+				if (netSendNow(c))
+					netSendRect(c, g->p.x, g->p.y, g->p.cx, g->p.cy, priv->fb + g->p.y * g->g.Width + g->p.x, g->g.Width);
 			}
 		}
-		MUTEX_EXIT;
+		#elif GDISP_PIXELFORMAT == GDISP_LLD_PIXELFORMAT
+			netSendRect(&priv->clients[0], g->p.x, g->p.y, g->p.cx, g->p.cy, (const LLDCOLOR_TYPE *)buffer, g->p.x2);
+		#else
+		{
+			netClient *	c;
+			gCoord		x, y;
+
+			c = &priv->clients[0];
+			netPut(c, GNETCODE_BLIT);
+			netPut(c, g->p.x);
+			netPut(c, g->p.y);
+			netPut(c, g->p.cx);
+			netPut(c, g->p.cy);
+			for(y = 0; y < g->p.cy; y++, buffer += g->p.x2) {
+				for(x = 0; x < g->p.cx; x++)
+					netPut(c, gdispColor2Native(buffer[x]));
+			}
+		}
+		#endif
+		gfxMutexExit(&priv->lock);
 	}
 #endif
 
 #if GDISP_HARDWARE_PIXELREAD
 	LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
 		netPriv	*	priv;
-		gU16	buf[3];
-		gColor		data;
+		#if !GDISP_GFXNET_FRAMEBUFFER
+			gU16	buf[3];
+			gU16	data;
+		#endif
 
-		#if GDISP_DONT_WAIT_FOR_NET_DISPLAY
-			if (!(g->flags & GDISP_FLG_CONNECTED))
-				return 0;
+		// We have our own copy
+		#if GDISP_GFXNET_FRAMEBUFFER
+			priv = g->priv;
+			return gdispNative2Color(priv->fb[g->p.y * g->g.Width + g->p.x]);
 		#else
-			while(!(g->flags & GDISP_FLG_CONNECTED))
-				gfxSleepMilliseconds(200);
+			if (!netWait(g))
+				return 0;
+
+			priv = g->priv;
+			buf[0] = GNETCODE_READ;
+			buf[1] = g->p.x;
+			buf[2] = g->p.y;
+			gfxMutexEnter(&priv->lock);
+			netExpectReplies(priv, 1);
+			netPutPkt(&priv->clients[0], buf, 3);
+			data = netGetReplies(priv) ? priv->reply[0] : 0;
+			gfxMutexExit(&priv->lock);
+
+			return gdispNative2Color(data);
 		#endif
+	}
+#endif
+
+#if GDISP_HARDWARE_STREAM_READ
+	LLDSPEC	void gdisp_lld_read_start(GDisplay *g) {
+		netPriv	*	priv;
 
 		priv = g->priv;
-		buf[0] = GNETCODE_READ;
-		buf[1] = g->p.x;
-		buf[2] = g->p.y;
-		MUTEX_ENTER;
-		sendpkt(priv->netfd, buf, 3);
-		MUTEX_EXIT;
+		priv->readx = g->p.x;
+		priv->ready = g->p.y;
+		priv->readcx = g->p.cx;
+		priv->readcy = g->p.cy;
+		priv->readcol = priv->readrow = 0;
+		priv->readpos = priv->replylen = 0;
+	}
+
+	LLDSPEC	gColor gdisp_lld_read_color(GDisplay *g) {
+		netPriv	*	priv;
+		gU16		data;
+
+		priv = g->priv;
+		#if GDISP_GFXNET_FRAMEBUFFER
+			// We have our own copy
+			data = priv->fb[(priv->ready + priv->readrow) * g->g.Width + priv->readx + priv->readcol];
+		#else
+			// Ask for the next lot of pixels in one go
+			if (priv->readpos >= priv->replylen) {
+				netClient *	c;
+				gCoord		x, y, cx, cy, i, j;
+
+				if (!netWait(g))
+					return 0;
+				c = &priv->clients[0];
+
+				// Whole lines if they fit otherwise part of a line
+				x = priv->readx + priv->readcol;
+				y = priv->ready + priv->readrow;
+				if (priv->readcx <= NET_REPLY_MAX) {
+					cx = priv->readcx;
+					cy = NET_REPLY_MAX / cx;
+					if (cy > priv->readcy - priv->readrow)
+						cy = priv->readcy - priv->readrow;
+				} else {
+					cx = priv->readcx - priv->readcol;
+					if (cx > NET_REPLY_MAX)
+						cx = NET_REPLY_MAX;
+					cy = 1;
+				}
 
-		// Now wait for a reply
-		while(!(g->flags & GDISP_FLG_HAVEDATA) || priv->data[0] != GNETCODE_READ)
-			gfxSleepMilliseconds(1);
+				gfxMutexEnter(&priv->lock);
+				netExpectReplies(priv, (unsigned)cx * cy);
+				if (c->version >= GNETCODE_VERSION_2_0) {
+					netPut(c, GNETCODE_READ_AREA);
+					netPut(c, x);
+					netPut(c, y);
+					netPut(c, cx);
+					netPut(c, cy);
+				} else {
+					// V1.0 can only read pixels but at least we don't need to wait for each one
+					for(j = 0; j < cy; j++) {
+						for(i = 0; i < cx; i++) {
+							netPut(c, GNETCODE_READ);
+							netPut(c, x + i);
+							netPut(c, y + j);
+						}
+					}
+				}
+				if (!netGetReplies(priv)) {
+					// The display has gone. Return black for the rest.
+					memset(priv->reply, 0, (unsigned)cx * cy * sizeof(gU16));
+					priv->replylen = (unsigned)cx * cy;
+				}
+				gfxMutexExit(&priv->lock);
+				priv->readpos = 0;
+			}
+			data = priv->reply[priv->readpos++];
+		#endif
 
-		data = gdispNative2Color(priv->data[1]);
-		g->flags &= ~GDISP_FLG_HAVEDATA;
+		// Move on to the next pixel
+		if (++priv->readcol >= priv->readcx) {
+			priv->readcol = 0;
+			priv->readrow++;
+		}
+		return gdispNative2Color(data);
+	}
 
-		return data;
+	LLDSPEC	void gdisp_lld_read_stop(GDisplay *g) {
+		(void) g;
 	}
 #endif
 
@@ -611,12 +1688,11 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		netPriv	*	priv;
 		gU16	buf[6];
 
-		#if GDISP_DONT_WAIT_FOR_NET_DISPLAY
-			if (!(g->flags & GDISP_FLG_CONNECTED))
-				return;
+		#if GDISP_GFXNET_FRAMEBUFFER
+			netWait(g);
 		#else
-			while(!(g->flags & GDISP_FLG_CONNECTED))
-				gfxSleepMilliseconds(200);
+			if (!netWait(g))
+				return;
 		#endif
 
 		priv = g->priv;
@@ -626,9 +1702,36 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		buf[3] = g->p.cx;
 		buf[4] = g->p.cy;
 		buf[5] = g->p.y1;
-		MUTEX_ENTER;
-		sendpkt(priv->netfd, buf, 6);
-		MUTEX_EXIT;
+		gfxMutexEnter(&priv->lock);
+		#if GDISP_GFXNET_FRAMEBUFFER
+			// Move the lines that stay visible. The high level code fills the gap that is left.
+			if (g->p.y1 > 0 && g->p.y1 < g->p.cy)
+				netCopy(g, priv, g->p.x, g->p.y, g->p.cx, g->p.cy - g->p.y1, g->p.x, g->p.y + g->p.y1);
+			else if (g->p.y1 < 0 && -g->p.y1 < g->p.cy)
+				netCopy(g, priv, g->p.x, g->p.y - g->p.y1, g->p.cx, g->p.cy + g->p.y1, g->p.x, g->p.y);
+		#endif
+		netPutAll(priv, buf, 6);
+		gfxMutexExit(&priv->lock);
+	}
+#endif
+
+#if GDISP_NEED_COPYAREA && GDISP_HARDWARE_COPY
+	LLDSPEC void gdisp_lld_copy_area(GDisplay *g) {
+		netPriv	*	priv;
+		netClient *	c;
+
+		netWait(g);
+
+		priv = g->priv;
+		gfxMutexEnter(&priv->lock);
+		netCopy(g, priv, g->p.x, g->p.y, g->p.cx, g->p.cy, g->p.x1, g->p.y1);
+
+		// V1.0 has no copy so the destination is sent instead
+		for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+			if (netSendNow(c))
+				netSendRect(c, g->p.x, g->p.y, g->p.cx, g->p.cy, priv->fb + g->p.y * g->g.Width + g->p.x, g->g.Width);
+		}
+		gfxMutexExit(&priv->lock);
 	}
 #endif
 
@@ -637,20 +1740,26 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		netPriv	*	priv;
 		gU16	buf[3];
 		gBool		allgood;
+		#if GDISP_GFXNET_FRAMEBUFFER
+			LLDCOLOR_TYPE *	nfb;
 
-		#if GDISP_DONT_WAIT_FOR_NET_DISPLAY
-			if (!(g->flags & GDISP_FLG_CONNECTED))
-				return;
-		#else
-			while(!(g->flags & GDISP_FLG_CONNECTED))
-				gfxSleepMilliseconds(200);
+			nfb = 0;
 		#endif
 
+		// Nothing can be changed until a display is connected
+		if (!netWait(g))
+			return;
+
 		// Check if we might support the code
 		switch(g->p.x) {
 		case GDISP_CONTROL_ORIENTATION:
 			if (g->g.Orientation == (gOrientation)g->p.ptr)
 				return;
+			#if GDISP_GFXNET_FRAMEBUFFER
+				// The frame buffer is rotated into a new one if the display agrees to the change
+				if (!(nfb = gfxAlloc(GDISP_SCREEN_WIDTH * GDISP_SCREEN_HEIGHT * sizeof(LLDCOLOR_TYPE))))
+					return;
+			#endif
 			break;
 		case GDISP_CONTROL_POWER:
 			if (g->g.Powermode == (gPowermode)g->p.ptr)
@@ -671,24 +1780,46 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 		buf[0] = GNETCODE_CONTROL;
 		buf[1] = g->p.x;
 		buf[2] = (gU16)(int)g->p.ptr;
-		MUTEX_ENTER;
-		sendpkt(priv->netfd, buf, 3);
-		MUTEX_EXIT;
+		gfxMutexEnter(&priv->lock);
+		netExpectReplies(priv, 1);
+		#if GDISP_GFXNET_FRAMEBUFFER
+		{
+			netClient *	c;
 
-		// Now wait for a reply
-		while(!(g->flags & GDISP_FLG_HAVEDATA) || priv->data[0] != GNETCODE_CONTROL)
-			gfxSleepMilliseconds(1);
+			// Every viewer is told but only the primary viewer's answer counts
+			for(c = priv->clients; c < priv->clients + GDISP_GFXNET_VIEWERS; c++) {
+				if (c->state != NET_CLOSED && c != priv->primary) {
+					netPutPkt(c, buf, 3);
+					netWrite(c);
+				}
+			}
+			if (priv->primary)
+				netPutPkt(priv->primary, buf, 3);
+		}
+		#else
+			netPutPkt(&priv->clients[0], buf, 3);
+		#endif
 
-		// Extract the return status
-		allgood = priv->data[1] ? gTrue : gFalse;
-		g->flags &= ~GDISP_FLG_HAVEDATA;
+		// Wait for the return status
+		allgood = netGetReplies(priv) && priv->reply[0] ? gTrue : gFalse;
+		gfxMutexExit(&priv->lock);
 
 		// Do nothing more if the operation failed
-		if (!allgood) return;
+		if (!allgood) {
+			#if GDISP_GFXNET_FRAMEBUFFER
+				if (nfb)
+					gfxFree(nfb);
+			#endif
+			return;
+		}
 
 		// Update the local stuff
 		switch(g->p.x) {
 		case GDISP_CONTROL_ORIENTATION:
+			#if GDISP_GFXNET_FRAMEBUFFER
+				// The network thread sends frames so the size and the frame buffer must change together
+				gfxMutexEnter(&priv->lock);
+			#endif
 			switch((gOrientation)g->p.ptr) {
 				case gOrientation0:
 				case gOrientation180:
@@ -701,9 +1832,19 @@ LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 					g->g.Width = GDISP_SCREEN_HEIGHT;
 					break;
 				default:
+					#if GDISP_GFXNET_FRAMEBUFFER
+						gfxMutexExit(&priv->lock);
+						gfxFree(nfb);
+					#endif
 					return;
 			}
+			#if GDISP_GFXNET_FRAMEBUFFER
+				netRotate(g, priv, nfb, (gOrientation)g->p.ptr);
+			#endif
 			g->g.Orientation = (gOrientation)g->p.ptr;
+			#if GDISP_GFXNET_FRAMEBUFFER
+				gfxMutexExit(&priv->lock);
+			#endif
 			break;
 		case GDISP_CONTROL_POWER:
 			g->g.Powermode = (gPowermode)g->p.ptr;
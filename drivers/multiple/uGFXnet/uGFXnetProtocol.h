@@ -5,10 +5,11 @@
  *              http://ugfx.io/license.html
  */
 
-#define GNETCODE_VERSION			GNETCODE_VERSION_1_0		// The current protocol version
+#define GNETCODE_VERSION			GNETCODE_VERSION_2_0		// The current protocol version
 
 // The list of possible protocol version numbers
 #define GNETCODE_VERSION_1_0		0x0100		// V1.0
+#define GNETCODE_VERSION_2_0		0x0200		// V2.0 - Adds compressed rectangles, area copies and acknowledged frames
 
 // The required pixel format
 #define GNETCODE_PIXELFORMAT		GDISP_PIXELFORMAT_RGB565
@@ -19,6 +20,10 @@
 /**
  * All commands are sent in 16 bit blocks (2 bytes) in network order (BigEndian)
  * Across all uGFXnet protocol versions, the stream will always start with GNETCODE_INIT (0xFFFF) and then the version number.
+ *
+ * The host always starts with V1.0. A display that understands a later version replies with GNETCODE_UPGRADE and
+ * the version it would like. The host answers with GNETCODE_UPGRADE and the version it will use from then on
+ * (which may still be V1.0). A display that never asks is only ever sent V1.0 commands.
  */
 #define GNETCODE_INIT			0xFFFF		// Followed by version,width,height,pixelformat,hasmouse
 #define GNETCODE_FLUSH			0x0000		// No following data
@@ -32,3 +37,17 @@
 #define GNETCODE_MOUSE_Y		0x0008		// This is only ever received - never sent. Response is GNETCODE_MOUSE_Y,y
 #define GNETCODE_MOUSE_B		0x0009		// This is only ever received - never sent. Response is GNETCODE_MOUSE_B,buttons. This is also the sync signal for mouse updates.
 #define GNETCODE_KILL			0xFFFE		// This is only ever received - never sent. Response is GNETCODE_KILL,retcode
+
+// V2.0 commands
+#define GNETCODE_UPGRADE		0x000A		// Followed by version - Sent by the display to ask for a version. The host replies GNETCODE_UPGRADE,version-in-use
+#define GNETCODE_RLE			0x000B		// Followed by x,y,cx,cy then count,color pairs that cover cx * cy pixels
+#define GNETCODE_PALETTE		0x000C		// Followed by x,y,cx,cy,colors then the colors (2 to 16) and then the cx * cy indexes (see below)
+#define GNETCODE_COPY			0x000D		// Followed by x,y,cx,cy,srcx,srcy. The source and destination may overlap.
+#define GNETCODE_FRAME			0x000E		// Followed by frame - Flush the display. Response is GNETCODE_FRAME,frame when it has been shown.
+#define GNETCODE_READ_AREA		0x000F		// Followed by x,y,cx,cy - Response is GNETCODE_READ_AREA,count followed by count (cx * cy) colors
+
+/**
+ * GNETCODE_PALETTE indexes are packed most significant bits first into 16 bit blocks. There are 1 bit indexes for 2 colors,
+ * 2 bits for up to 4 colors and 4 bits for up to 16 colors. The indexes for each line start in a new block.
+ */
+#define GNETCODE_PALETTE_MAX	16
@@ -77,6 +77,8 @@
 
 //#define GDISP_NEED_AUTOFLUSH                         GFXOFF
 //#define GDISP_NEED_TIMERFLUSH                        GFXOFF
+//#define GDISP_NEED_DIRTYRECTS                        GFXOFF
+//#define GDISP_NEED_DOUBLEBUFFER                      GFXOFF
 //#define GDISP_NEED_VALIDATION                        GFXON
 //#define GDISP_NEED_CLIP                              GFXON
 //#define GDISP_NEED_CIRCLE                            GFXOFF
@@ -85,11 +87,16 @@
 //#define GDISP_NEED_ARC                               GFXOFF
 //#define GDISP_NEED_ARCSECTORS                        GFXOFF
 //#define GDISP_NEED_CONVEX_POLYGON                    GFXOFF
+//#define GDISP_NEED_POLYGON                           GFXOFF
 //#define GDISP_NEED_SCROLL                            GFXOFF
+//#define GDISP_NEED_COPYAREA                          GFXOFF
 //#define GDISP_NEED_PIXELREAD                         GFXOFF
 //#define GDISP_NEED_CONTROL                           GFXOFF
 //#define GDISP_NEED_QUERY                             GFXOFF
 //#define GDISP_NEED_MULTITHREAD                       GFXOFF
+//    #define GDISP_NEED_VIEWS                         GFXOFF
+//        #define GDISP_NEED_TILER                     GFXOFF
+//    #define GDISP_NEED_ASYNC                         GFXOFF
 //#define GDISP_NEED_STREAMING                         GFXOFF
 //#define GDISP_NEED_TEXT                              GFXOFF
 //    #define GDISP_NEED_TEXT_WORDWRAP                 GFXOFF
@@ -158,8 +165,23 @@
 //#define GDISP_NEED_PIXMAP                            GFXOFF
 //    #define GDISP_NEED_PIXMAP_IMAGE                  GFXOFF
 
+//#define GDISP_NEED_PIXELKERNELS                      GFXOFF
+//    #define GDISP_PIXELKERNELS_SIMD                  GFXON
+
+//#define GDISP_NEED_CMDLIST                           GFXOFF
+//#define GDISP_NEED_CLIPREGION                        GFXOFF
+//#define GDISP_NEED_STATS                             GFXOFF
+//#define GDISP_NEED_COMPOSITE                         GFXOFF
+//#define GDISP_NEED_TRANSFORM                         GFXOFF
+//#define GDISP_NEED_PAINT                             GFXOFF
+
 //#define GDISP_DEFAULT_ORIENTATION                    gOrientationLandscape    // If not defined the native hardware orientation is used.
 //#define GDISP_LINEBUF_SIZE                           128
+//#define GDISP_DIRTYRECTS_MAX                         8
+//#define GDISP_DOUBLEBUFFER_PAGES                     2
+//#define GDISP_STATS_CLOCK()                          gfxSystemTicks()
+//#define GDISP_TILER_THREADS                          3
+//#define GDISP_TILER_STACKSIZE                        2048
 //#define GDISP_STARTUP_COLOR                          GFX_BLACK
 //#define GDISP_NEED_STARTUP_LOGO                      GFXON
 
@@ -12,6 +12,10 @@
 /* Include the low level driver information */
 #include "gdisp_driver.h"
 
+#if GDISP_NEED_PIXMAP || GDISP_NEED_COMPOSITE
+	#include <string.h>				// For memmove and memcpy
+#endif
+
 // Number of milliseconds for the startup logo - 0 means disabled.
 #if GDISP_NEED_STARTUP_LOGO
 	#define GDISP_STARTUP_LOGO_TIMEOUT		1000
@@ -30,9 +34,39 @@
 
 GDisplay	*GDISP;
 
+#if GDISP_NEED_TILER
+	static gMutex	tilerimagemutex;				// Only one tile can decode an image at a time
+#endif
+
+#if GDISP_NEED_ASYNC
+	// asyncwait(a)
+	// Waits for the driver to finish a background operation. The display must be locked.
+	static void asyncwait(struct GDISPAsync *a) {
+		if (a->busy) {
+			gfxSemWait(&a->idle, gDelayForever);
+			gfxSemSignal(&a->idle);
+			a->busy = gFalse;
+		}
+	}
+
+	#if GDISP_HARDWARE_FLUSHASYNC || GDISP_HARDWARE_BITFILLSASYNC
+		// asyncstart(a)
+		// Marks the driver as busy just before it is given a background operation.
+		static void asyncstart(struct GDISPAsync *a) {
+			gfxSemWait(&a->idle, gDelayForever);
+			a->busy = gTrue;
+		}
+	#endif
+#endif
+
 #if GDISP_NEED_MULTITHREAD
 	#define MUTEX_INIT(g)		gfxMutexInit(&(g)->mutex)
-	#define MUTEX_ENTER(g)		gfxMutexEnter(&(g)->mutex)
+	#if GDISP_NEED_ASYNC
+		// Nothing else can be done on a display while the driver is still blitting to it
+		#define MUTEX_ENTER(g)	{ gfxMutexEnter(&(g)->mutex); asyncwait(&(g)->asyncblit); }
+	#else
+		#define MUTEX_ENTER(g)	gfxMutexEnter(&(g)->mutex)
+	#endif
 	#define MUTEX_EXIT(g)		gfxMutexExit(&(g)->mutex)
 	#define MUTEX_DEINIT(g)		gfxMutexDestroy(&(g)->mutex)
 #else
@@ -43,6 +77,7 @@ GDisplay	*GDISP;
 #endif
 
 #define NEED_CLIPPING	(GDISP_HARDWARE_CLIP != GFXON && (GDISP_NEED_VALIDATION || GDISP_NEED_CLIP))
+#define NEED_CLIPREGION	(NEED_CLIPPING && GDISP_NEED_CLIPREGION)
 
 #if !NEED_CLIPPING
 	#define TEST_CLIP_AREA(g)
@@ -64,10 +99,157 @@ GDisplay	*GDISP;
 			if ((g)->p.cx > 0 && (g)->p.cy > 0)
 #endif
 
+#if GDISP_NEED_STATS
+	#define STAT_BEGIN(g, op)	_gdispStatBegin(g, op)
+	#define STAT_END(g)			_gdispStatEnd(g)
+#else
+	#define STAT_BEGIN(g, op)
+	#define STAT_END(g)
+#endif
+
 /*==========================================================================*/
 /* Internal functions.														*/
 /*==========================================================================*/
 
+#if GDISP_NEED_STATS
+	// statlld(g, op, pixels, start)
+	// Counts and times a call to the driver. The pixels are also charged to the current drawing operation.
+	static void statlld(GDisplay *g, gdispStatOp op, gU32 pixels, gU32 start) {
+		g->stats.s.op[op].calls++;
+		g->stats.s.op[op].pixels += pixels;
+		g->stats.s.op[op].time += (gU32)GDISP_STATS_CLOCK() - start;
+		if (g->stats.depth)
+			g->stats.s.op[g->stats.cur].pixels += pixels;
+	}
+
+	// Replace the driver calls with ones that are measured.
+	//	Each wrapper is defined before its driver call is redefined so that it calls the real driver routine.
+	#if GDISP_HARDWARE_DRAWPIXEL
+		static GFXINLINE void statdrawpixel(GDisplay *g) {
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_draw_pixel(g);
+			statlld(g, gdispStatLLDPixel, 1, t);
+		}
+		#undef gdisp_lld_draw_pixel
+		#define gdisp_lld_draw_pixel(g)			statdrawpixel(g)
+	#endif
+	#if GDISP_HARDWARE_CLEARS
+		static GFXINLINE void statclear(GDisplay *g) {
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_clear(g);
+			statlld(g, gdispStatLLDClear, (gU32)g->g.Width * g->g.Height, t);
+		}
+		#undef gdisp_lld_clear
+		#define gdisp_lld_clear(g)				statclear(g)
+	#endif
+	#if GDISP_HARDWARE_FILLS
+		static GFXINLINE void statfillarea(GDisplay *g) {
+			gU32	n = (gU32)g->p.cx * g->p.cy;
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_fill_area(g);
+			statlld(g, gdispStatLLDFill, n, t);
+		}
+		#undef gdisp_lld_fill_area
+		#define gdisp_lld_fill_area(g)			statfillarea(g)
+	#endif
+	#if GDISP_HARDWARE_BITFILLS
+		static GFXINLINE void statblitarea(GDisplay *g) {
+			gU32	n = (gU32)g->p.cx * g->p.cy;
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_blit_area(g);
+			statlld(g, gdispStatLLDBlit, n, t);
+		}
+		#undef gdisp_lld_blit_area
+		#define gdisp_lld_blit_area(g)			statblitarea(g)
+	#endif
+	#if GDISP_HARDWARE_STREAM_WRITE
+		static GFXINLINE void statwritestart(GDisplay *g) {
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_write_start(g);
+			statlld(g, gdispStatLLDWriteStart, 0, t);
+		}
+		static GFXINLINE void statwritecolor(GDisplay *g) {
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_write_color(g);
+			statlld(g, gdispStatLLDWriteColor, 1, t);
+		}
+		#undef gdisp_lld_write_start
+		#define gdisp_lld_write_start(g)		statwritestart(g)
+		#undef gdisp_lld_write_color
+		#define gdisp_lld_write_color(g)		statwritecolor(g)
+		#if GDISP_HARDWARE_STREAM_WRITECOLORS
+			static GFXINLINE void statwritecolors(GDisplay *g) {
+				gU32	n = (gU32)g->p.x2;
+				gU32	t = GDISP_STATS_CLOCK();
+				gdisp_lld_write_colors(g);
+				statlld(g, gdispStatLLDWriteColor, n, t);
+			}
+			#undef gdisp_lld_write_colors
+			#define gdisp_lld_write_colors(g)	statwritecolors(g)
+		#endif
+	#endif
+	#if GDISP_HARDWARE_STREAM_READ
+		static GFXINLINE gColor statreadcolor(GDisplay *g) {
+			gColor	c;
+			gU32	t = GDISP_STATS_CLOCK();
+			c = gdisp_lld_read_color(g);
+			statlld(g, gdispStatLLDReadColor, 1, t);
+			return c;
+		}
+		#undef gdisp_lld_read_color
+		#define gdisp_lld_read_color(g)			statreadcolor(g)
+	#endif
+	#if GDISP_HARDWARE_PIXELREAD
+		static GFXINLINE gColor statgetpixelcolor(GDisplay *g) {
+			gColor	c;
+			gU32	t = GDISP_STATS_CLOCK();
+			c = gdisp_lld_get_pixel_color(g);
+			statlld(g, gdispStatLLDGetPixel, 1, t);
+			return c;
+		}
+		#undef gdisp_lld_get_pixel_color
+		#define gdisp_lld_get_pixel_color(g)	statgetpixelcolor(g)
+	#endif
+	#if GDISP_HARDWARE_SCROLL
+		static GFXINLINE void statverticalscroll(GDisplay *g) {
+			gU32	n = (gU32)g->p.cx * g->p.cy;
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_vertical_scroll(g);
+			statlld(g, gdispStatLLDVScroll, n, t);
+		}
+		#undef gdisp_lld_vertical_scroll
+		#define gdisp_lld_vertical_scroll(g)	statverticalscroll(g)
+	#endif
+	#if GDISP_HARDWARE_COPY && GDISP_NEED_COPYAREA
+		static GFXINLINE void statcopyarea(GDisplay *g) {
+			gU32	n = (gU32)g->p.cx * g->p.cy;
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_copy_area(g);
+			statlld(g, gdispStatLLDCopy, n, t);
+		}
+		#undef gdisp_lld_copy_area
+		#define gdisp_lld_copy_area(g)			statcopyarea(g)
+	#endif
+	#if GDISP_HARDWARE_FLUSH
+		static GFXINLINE void statflush(GDisplay *g) {
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_flush(g);
+			statlld(g, gdispStatLLDFlush, 0, t);
+		}
+		#undef gdisp_lld_flush
+		#define gdisp_lld_flush(g)				statflush(g)
+	#endif
+	#if GDISP_HARDWARE_FLUSHAREA && GDISP_NEED_DIRTYRECTS
+		static GFXINLINE void statflusharea(GDisplay *g) {
+			gU32	t = GDISP_STATS_CLOCK();
+			gdisp_lld_flush_area(g);
+			statlld(g, gdispStatLLDFlush, 0, t);
+		}
+		#undef gdisp_lld_flush_area
+		#define gdisp_lld_flush_area(g)			statflusharea(g)
+	#endif
+#endif
+
 #if GDISP_HARDWARE_STREAM_POS && GDISP_HARDWARE_STREAM_WRITE
 	static GFXINLINE void setglobalwindow(GDisplay *g) {
 		gCoord	x, y;
@@ -80,24 +262,184 @@ GDisplay	*GDISP;
 	}
 #endif
 
-#if GDISP_NEED_AUTOFLUSH && GDISP_HARDWARE_FLUSH == HARDWARE_AUTODETECT
-	#define autoflush_stopdone(g)	if (gvmt(g)->flush) gdisp_lld_flush(g)
-#elif GDISP_NEED_AUTOFLUSH && GDISP_HARDWARE_FLUSH
-	#define autoflush_stopdone(g)	gdisp_lld_flush(g)
+#if GDISP_NEED_DIRTYRECTS
+	// dirtyop(g, x, y, cx, cy)
+	// Adds an area to the area drawn by the current operation.
+	// The area does not need to be clipped.
+	static GFXINLINE void dirtyop(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		if (x < g->opx0)			g->opx0 = x;
+		if (y < g->opy0)			g->opy0 = y;
+		if (x + cx > g->opx1)		g->opx1 = x + cx;
+		if (y + cy > g->opy1)		g->opy1 = y + cy;
+	}
+
+	#define dirtyreset(g)			{ (g)->opx0 = (g)->opy0 = 0x7FFF; (g)->opx1 = (g)->opy1 = -0x7FFF; }
+
+	// dirtycommit(g)
+	// Adds the area drawn by the current operation to the list of dirty areas.
+	// Areas are merged if that wastes less than the two areas themselves or if the list is full.
+	static void dirtycommit(GDisplay *g) {
+		struct GDISPDirtyRect	*d, *best;
+		gCoord					x0, y0, x1, y1;
+		gI32					area, u, bestu, besta;
+
+		x0 = g->opx0 < 0 ? 0 : g->opx0;
+		y0 = g->opy0 < 0 ? 0 : g->opy0;
+		x1 = g->opx1 > g->g.Width ? g->g.Width : g->opx1;
+		y1 = g->opy1 > g->g.Height ? g->g.Height : g->opy1;
+		dirtyreset(g);
+		if (x1 <= x0 || y1 <= y0)
+			return;
+
+		while(1) {
+			// Find the dirty area that grows the least when merged with this one
+			area = (gI32)(x1 - x0) * (y1 - y0);
+			best = 0;
+			bestu = besta = 0;
+			for(d = g->dirty; d < g->dirty + g->dirtycnt; d++) {
+				u = (gI32)((x1 > d->x1 ? x1 : d->x1) - (x0 < d->x0 ? x0 : d->x0))
+					* ((y1 > d->y1 ? y1 : d->y1) - (y0 < d->y0 ? y0 : d->y0));
+				if (!best || u - (gI32)(d->x1 - d->x0) * (d->y1 - d->y0) < bestu - besta) {
+					best = d;
+					bestu = u;
+					besta = (gI32)(d->x1 - d->x0) * (d->y1 - d->y0);
+				}
+			}
+
+			// Add it as a separate area if it doesn't merge well and there is room
+			if (!best || (bestu > 2 * (besta + area) && g->dirtycnt < GDISP_DIRTYRECTS_MAX)) {
+				d = g->dirty + g->dirtycnt++;
+				d->x0 = x0; d->y0 = y0;
+				d->x1 = x1; d->y1 = y1;
+				return;
+			}
+
+			// Merge them and then try again as the merged area may now merge with others
+			if (best->x0 < x0)	x0 = best->x0;
+			if (best->y0 < y0)	y0 = best->y0;
+			if (best->x1 > x1)	x1 = best->x1;
+			if (best->y1 > y1)	y1 = best->y1;
+			*best = g->dirty[--g->dirtycnt];
+		}
+	}
+#else
+	#define dirtyop(g, x, y, cx, cy)
+	#define dirtyreset(g)
+	#define dirtycommit(g)
+#endif
+
+#if GDISP_NEED_VIEWS && GDISP_NEED_DIRTYRECTS
+	// viewpublish(g)
+	// Passes the areas drawn on a view to its display.
+	// The display is locked while the areas are added.
+	static void viewpublish(GDisplay *g) {
+		GDisplay	*pg;
+		unsigned	i;
+
+		dirtycommit(g);
+		if (!g->dirtycnt)
+			return;
+		pg = g->parent;
+		MUTEX_ENTER(pg);
+		for(i = 0; i < g->dirtycnt; i++) {
+			dirtyop(pg, g->dirty[i].x0, g->dirty[i].y0, g->dirty[i].x1 - g->dirty[i].x0, g->dirty[i].y1 - g->dirty[i].y0);
+			dirtycommit(pg);
+		}
+		MUTEX_EXIT(pg);
+		g->dirtycnt = 0;
+	}
+#else
+	#define viewpublish(g)
+#endif
+
+#if GDISP_HARDWARE_FLUSH || GDISP_NEED_DIRTYRECTS
+	// doflush(g)
+	// Parameters:	none
+	// Alters:		nothing
+	// Flushes the display, first passing the dirty areas to the driver if it wants them
+	static void doflush(GDisplay *g) {
+		// A view just passes what it has drawn to its display
+		#if GDISP_NEED_VIEWS
+			if (g->parent) {
+				viewpublish(g);
+				return;
+			}
+		#endif
+
+		// The driver may still be showing the last frame or blitting
+		#if GDISP_NEED_ASYNC
+			asyncwait(&g->asyncflush);
+			asyncwait(&g->asyncblit);
+		#endif
+
+		#if GDISP_NEED_DIRTYRECTS
+			dirtycommit(g);
+			if (!g->dirtycnt)
+				return;
+
+			// Tell the driver which areas need flushing
+			#if GDISP_HARDWARE_FLUSHAREA
+				#if GDISP_HARDWARE_FLUSHAREA == HARDWARE_AUTODETECT
+					if (gvmt(g)->flusharea)
+				#endif
+				{
+					gCoord	x, y, cx, cy;
+					unsigned	i;
+
+					x = g->p.x; y = g->p.y;
+					cx = g->p.cx; cy = g->p.cy;
+					for(i = 0; i < g->dirtycnt; i++) {
+						g->p.x = g->dirty[i].x0;
+						g->p.y = g->dirty[i].y0;
+						g->p.cx = g->dirty[i].x1 - g->dirty[i].x0;
+						g->p.cy = g->dirty[i].y1 - g->dirty[i].y0;
+						gdisp_lld_flush_area(g);
+					}
+					g->p.x = x; g->p.y = y;
+					g->p.cx = cx; g->p.cy = cy;
+				}
+			#endif
+			g->dirtycnt = 0;
+		#endif
+
+		// Complete the flush - in the background if that has been asked for
+		#if GDISP_NEED_ASYNC && GDISP_HARDWARE_FLUSHASYNC
+			if ((g->flags & GDISP_FLG_ASYNCFLUSH)
+					#if GDISP_HARDWARE_FLUSHASYNC == HARDWARE_AUTODETECT
+						&& gvmt(g)->flushasync
+					#endif
+					) {
+				asyncstart(&g->asyncflush);
+				gdisp_lld_flush_async(g);
+				return;
+			}
+		#endif
+		#if GDISP_HARDWARE_FLUSH
+			#if GDISP_HARDWARE_FLUSH == HARDWARE_AUTODETECT
+				if (gvmt(g)->flush)
+			#endif
+				gdisp_lld_flush(g);
+		#endif
+	}
+#endif
+
+#if GDISP_NEED_AUTOFLUSH && GDISP_HARDWARE_FLUSH
+	#define autoflush_stopdone(g)	doflush(g)
 #else
-	#define autoflush_stopdone(g)
+	#define autoflush_stopdone(g)	dirtycommit(g)
 #endif
 
 #if GDISP_HARDWARE_STREAM_POS && GDISP_HARDWARE_STREAM_WRITE
-	#define autoflush(g)									\
+	#define scrstreamstop(g)								\
 			{												\
 				if ((g->flags & GDISP_FLG_SCRSTREAM)) {		\
 					gdisp_lld_write_stop(g);				\
 					g->flags &= ~GDISP_FLG_SCRSTREAM;		\
 				}											\
-				autoflush_stopdone(g);						\
 			}
+	#define autoflush(g)		{ scrstreamstop(g); autoflush_stopdone(g); }
 #else
+	#define scrstreamstop(g)
 	#define autoflush(g)		autoflush_stopdone(g)
 #endif
 
@@ -106,6 +448,7 @@ GDisplay	*GDISP;
 // Alters:		cx, cy (if using streaming)
 // Does not clip
 static GFXINLINE void drawpixel(GDisplay *g) {
+	dirtyop(g, g->p.x, g->p.y, 1, 1);
 
 	// Best is hardware accelerated pixel draw
 	#if GDISP_HARDWARE_DRAWPIXEL
@@ -148,6 +491,24 @@ static GFXINLINE void drawpixel(GDisplay *g) {
 	#endif
 }
 
+#if NEED_CLIPREGION
+	// regionfirst(rgn, y)
+	// Returns the first rectangle in the region that is not above row y.
+	//	The bands are in order so the bottom edges can be binary searched.
+	static const gdispRegionRect *regionfirst(const gdispRegion *rgn, gCoord y) {
+		unsigned	lo, hi, mid;
+
+		for(lo = 0, hi = rgn->cnt; lo < hi;) {
+			mid = (lo + hi) / 2;
+			if (rgn->rects[mid].y1 <= y)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return rgn->rects + lo;
+	}
+#endif
+
 // drawpixel_clip(g)
 // Parameters:	x,y
 // Alters:		cx, cy (if using streaming)
@@ -159,6 +520,10 @@ static GFXINLINE void drawpixel(GDisplay *g) {
 		{
 			if (g->p.x < g->clipx0 || g->p.x >= g->clipx1 || g->p.y < g->clipy0 || g->p.y >= g->clipy1)
 				return;
+			#if NEED_CLIPREGION
+				if (g->clipregion && !gdispRegionContains(g->clipregion, g->p.x, g->p.y))
+					return;
+			#endif
 		}
 		drawpixel(g);
 	}
@@ -172,6 +537,7 @@ static GFXINLINE void drawpixel(GDisplay *g) {
 // Note:		This is not clipped
 // Resets the streaming area if GDISP_HARDWARE_STREAM_WRITE and GDISP_HARDWARE_STREAM_POS is set.
 static GFXINLINE void fillarea(GDisplay *g) {
+	dirtyop(g, g->p.x, g->p.y, g->p.cx, g->p.cy);
 
 	// Best is hardware accelerated area fill
 	#if GDISP_HARDWARE_FILLS
@@ -220,6 +586,39 @@ static GFXINLINE void fillarea(GDisplay *g) {
 		}
 	#endif
 
+	// Next best is to bit-blit a line buffer full of the color
+	#if GDISP_NEED_PIXELKERNELS && GDISP_HARDWARE_FILLS != GFXON && !GDISP_HARDWARE_STREAM_WRITE && GDISP_HARDWARE_BITFILLS && GDISP_LINEBUF_SIZE != 0
+		#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
+			if (gvmt(g)->blit)
+		#endif
+		{
+			gCoord x0, y0, cx, cy, x, y, n;
+
+			x0 = g->p.x;
+			y0 = g->p.y;
+			cx = g->p.cx;
+			cy = g->p.cy;
+			gdispKernelFillColor(g->linebuf, g->p.color, cx > GDISP_LINEBUF_SIZE ? GDISP_LINEBUF_SIZE : cx);
+			for(y = y0; y < y0 + cy; y++) {
+				for(x = x0; x < x0 + cx; x += n) {
+					n = x0 + cx - x;
+					if (n > GDISP_LINEBUF_SIZE)
+						n = GDISP_LINEBUF_SIZE;
+					g->p.x = x; g->p.y = y;
+					g->p.cx = n; g->p.cy = 1;
+					g->p.x1 = 0; g->p.y1 = 0; g->p.x2 = n;
+					g->p.ptr = (void *)g->linebuf;
+					gdisp_lld_blit_area(g);
+				}
+			}
+			g->p.x = x0;
+			g->p.y = y0;
+			g->p.cx = cx;
+			g->p.cy = cy;
+			return;
+		}
+	#endif
+
 	// Worst is pixel drawing
 	#if GDISP_HARDWARE_FILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_DRAWPIXEL
 		// The following test is unneeded because we are guaranteed to have draw pixel if we don't have streaming
@@ -242,6 +641,299 @@ static GFXINLINE void fillarea(GDisplay *g) {
 	#endif
 }
 
+// fillarea_clip(g)
+// Parameters:	x,y cx,cy and color
+// Alters:		nothing
+// Note:		The area must already be clipped to the clip area. This just clips it to the clip region.
+#if NEED_CLIPREGION
+	static void fillarea_clip(GDisplay *g) {
+		const gdispRegionRect	*r, *e;
+		gCoord					x0, y0, x1, y1;
+
+		if (!g->clipregion) {
+			fillarea(g);
+			return;
+		}
+
+		// Fill each part of the area that is inside the clip region
+		x0 = g->p.x; y0 = g->p.y;
+		x1 = x0 + g->p.cx; y1 = y0 + g->p.cy;
+		for(r = regionfirst(g->clipregion, y0), e = g->clipregion->rects+g->clipregion->cnt; r < e && r->y0 < y1; r++) {
+			if (r->x1 <= x0 || r->x0 >= x1)
+				continue;
+			g->p.x = r->x0 > x0 ? r->x0 : x0;
+			g->p.y = r->y0 > y0 ? r->y0 : y0;
+			g->p.cx = (r->x1 < x1 ? r->x1 : x1) - g->p.x;
+			g->p.cy = (r->y1 < y1 ? r->y1 : y1) - g->p.y;
+			fillarea(g);
+		}
+		g->p.x = x0; g->p.y = y0;
+		g->p.cx = x1 - x0; g->p.cy = y1 - y0;
+	}
+#else
+	#define fillarea_clip(g)		fillarea(g)
+#endif
+
+#if GDISP_NEED_TRANSFORM || GDISP_NEED_PAINT
+	// Convert between a pixel and an RGB888 word for interpolating colors
+	#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
+		#define PIXEL2RGB(c)	((gU32)(c) & 0x00FFFFFF)
+		#define RGB2PIXEL(c)	((gPixel)(c))
+	#else
+		#define PIXEL2RGB(c)	(((gU32)RED_OF(c) << 16) | ((gU32)GREEN_OF(c) << 8) | (gU32)BLUE_OF(c))
+		#define RGB2PIXEL(c)	HTML2COLOR(c)
+	#endif
+
+	// lerprgb(a, b, f)
+	// Returns the RGB888 color f/256 of the way from a to b. The red and blue channels are done together.
+	static GFXINLINE gU32 lerprgb(gU32 a, gU32 b, gU32 f) {
+		return ((((a & 0xFF00FF) * (256-f) + (b & 0xFF00FF) * f) >> 8) & 0xFF00FF)
+			| ((((a & 0x00FF00) * (256-f) + (b & 0x00FF00) * f) >> 8) & 0x00FF00);
+	}
+#endif
+
+#if GDISP_NEED_PAINT
+	#if GDISP_LINEBUF_SIZE == 0
+		#error "GDISP: GDISP_NEED_PAINT is set but GDISP_LINEBUF_SIZE is zero."
+	#endif
+
+	// 1.0 in linear gradient positions (24 fractional bits)
+	#define PAINT_ONE		0x1000000
+
+	// isqrt8(q)
+	// Returns the integer square root of q (0 to 65535)
+	static gU32 isqrt8(gU32 q) {
+		gU32	r, b;
+
+		for(r = 0, b = 0x80; b; b >>= 1) {
+			if ((r|b) * (r|b) <= q)
+				r |= b;
+		}
+		return r;
+	}
+
+	// paintcolors(g, x, y, cnt)
+	// Fills the line buffer with the paint colors for cnt pixels starting at x,y
+	static void paintcolors(GDisplay *g, gCoord x, gCoord y, gCoord cnt) {
+		const gdispPaint	*pt;
+		gColor				*buf;
+
+		pt = g->paint;
+		buf = g->linebuf;
+		switch(pt->type) {
+		case gdispPaintLinear:
+		default:
+			{
+				gI64	t64;
+				gI32	t;
+				gU32	f, fend;
+
+				// The position along the gradient with 24 fractional bits.
+				//	kx is at most 1.0 so limiting the start can't change the colors of this run.
+				t64 = (gI64)(x - pt->x) * pt->kx + (gI64)(y - pt->y) * pt->ky;
+				t = t64 < -0x40000000 ? -0x40000000 : (t64 > 0x40000000 ? 0x40000000 : (gI32)t64);
+
+				// Once past the end of the gradient (in the direction of travel) the color can't change
+				fend = pt->kx > 0 ? 256 : 0;
+				for(; cnt; cnt--, t += pt->kx) {
+					f = t <= 0 ? 0 : (t >= PAINT_ONE ? 256 : (gU32)t >> 16);
+					*buf++ = RGB2PIXEL(lerprgb(pt->rgb0, pt->rgb1, f));
+					if (f == fend) {
+						for(cnt--; cnt; cnt--, buf++)
+							buf[0] = buf[-1];
+						break;
+					}
+				}
+			}
+			break;
+
+		case gdispPaintRadial:
+			{
+				gI32	dx, dy, r;
+				gU32	q, f;
+
+				r = pt->radius;
+				dx = x - pt->x;
+				dy = y - pt->y;
+				if (dy < 0)
+					dy = -dy;
+
+				// f is the distance from the center as a fraction of the radius (0 to 256).
+				//	It only changes a little from one pixel to the next so it is stepped rather than recalculated.
+				for(f = 256; cnt; cnt--, dx++) {
+					if (dy >= r || dx >= r || dx <= -r) {
+						f = 256;
+					} else {
+						q = (gU32)(((gU64)(dx*dx + dy*dy) * pt->rk) >> 16);
+						if (q >= 65536) {
+							f = 256;
+						} else {
+							if (f > 255)
+								f = isqrt8(q);
+							while (f*f > q)
+								f--;
+							while ((f+1)*(f+1) <= q)
+								f++;
+						}
+					}
+					*buf++ = RGB2PIXEL(lerprgb(pt->rgb0, pt->rgb1, f));
+				}
+			}
+			break;
+
+		case gdispPaintPattern:
+			{
+				const gPixel	*row;
+				gCoord			i;
+
+				// Wrap the position into the pattern
+				i = (y - pt->y) % pt->cy;
+				if (i < 0)
+					i += pt->cy;
+				row = pt->bits + i * pt->cx;
+				i = (x - pt->x) % pt->cx;
+				if (i < 0)
+					i += pt->cx;
+				for(; cnt; cnt--) {
+					*buf++ = row[i];
+					if (++i >= pt->cx)
+						i = 0;
+				}
+			}
+			break;
+		}
+	}
+
+	// paintspan(g)
+	// Parameters:	x,y and x1
+	// Alters:		x,y x1,y1 cx,cy x2 ptr color
+	// Draws a horizontal line using the paint. The line must already be clipped.
+	static void paintspan(GDisplay *g) {
+		gCoord	x, y, x1, n;
+
+		x = g->p.x;
+		y = g->p.y;
+		x1 = g->p.x1;
+
+		// A linear gradient that doesn't change across the line is just a fill
+		if (g->paint->type == gdispPaintLinear && !g->paint->kx) {
+			paintcolors(g, x, y, 1);
+			g->p.color = g->linebuf[0];
+			g->p.cx = x1 - x + 1;
+			g->p.cy = 1;
+			fillarea(g);
+			return;
+		}
+
+		dirtyop(g, x, y, x1 - x + 1, 1);
+		scrstreamstop(g);
+
+		// Best is hardware bitfills of the line buffer
+		#if GDISP_HARDWARE_BITFILLS
+			#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
+				if (gvmt(g)->blit)
+			#endif
+			{
+				for(; x <= x1; x += n) {
+					n = x1 - x + 1;
+					if (n > GDISP_LINEBUF_SIZE)
+						n = GDISP_LINEBUF_SIZE;
+					paintcolors(g, x, y, n);
+					g->p.x = x; g->p.y = y;
+					g->p.cx = n; g->p.cy = 1;
+					g->p.x1 = 0; g->p.y1 = 0; g->p.x2 = n;
+					g->p.ptr = (void *)g->linebuf;
+					gdisp_lld_blit_area(g);
+				}
+				return;
+			}
+		#endif
+
+		// Next best is hardware streaming
+		#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE
+			#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
+				if (gvmt(g)->writestart)
+			#endif
+			{
+				gCoord	i;
+
+				g->p.cx = x1 - x + 1;
+				g->p.cy = 1;
+				gdisp_lld_write_start(g);
+				#if GDISP_HARDWARE_STREAM_POS
+					#if GDISP_HARDWARE_STREAM_POS == HARDWARE_AUTODETECT
+						if (gvmt(g)->writepos)
+					#endif
+					gdisp_lld_write_pos(g);
+				#endif
+				for(; x <= x1; x += n) {
+					n = x1 - x + 1;
+					if (n > GDISP_LINEBUF_SIZE)
+						n = GDISP_LINEBUF_SIZE;
+					paintcolors(g, x, y, n);
+					for(i = 0; i < n; i++) {
+						g->p.color = g->linebuf[i];
+						gdisp_lld_write_color(g);
+					}
+				}
+				gdisp_lld_write_stop(g);
+				return;
+			}
+		#endif
+
+		// Only slightly better than drawing pixels is to look for runs and use fill area
+		#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS
+			#if GDISP_HARDWARE_FILLS == HARDWARE_AUTODETECT
+				if (gvmt(g)->fill)
+			#endif
+			{
+				gCoord	i;
+
+				for(; x <= x1; x += n) {
+					n = x1 - x + 1;
+					if (n > GDISP_LINEBUF_SIZE)
+						n = GDISP_LINEBUF_SIZE;
+					paintcolors(g, x, y, n);
+					for(i = 0; i < n; i += g->p.cx) {
+						g->p.x = x+i;
+						g->p.y = y;
+						g->p.color = g->linebuf[i];
+						g->p.cx = 1;
+						while(i+g->p.cx < n && g->linebuf[i+g->p.cx] == g->p.color)
+							g->p.cx++;
+						if (g->p.cx == 1) {
+							gdisp_lld_draw_pixel(g);
+						} else {
+							g->p.cy = 1;
+							gdisp_lld_fill_area(g);
+						}
+					}
+				}
+				return;
+			}
+		#endif
+
+		// Worst is drawing pixels
+		#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS != GFXON && GDISP_HARDWARE_DRAWPIXEL
+			{
+				gCoord	i;
+
+				for(; x <= x1; x += n) {
+					n = x1 - x + 1;
+					if (n > GDISP_LINEBUF_SIZE)
+						n = GDISP_LINEBUF_SIZE;
+					paintcolors(g, x, y, n);
+					for(g->p.y = y, i = 0; i < n; i++) {
+						g->p.x = x+i;
+						g->p.color = g->linebuf[i];
+						gdisp_lld_draw_pixel(g);
+					}
+				}
+			}
+		#endif
+	}
+#endif
+
 // Parameters:	x,y and x1
 // Alters:		x,y x1,y1 cx,cy
 // Assumes the window covers the screen and a write_stop() will occur later
@@ -262,8 +954,39 @@ static void hline_clip(GDisplay *g) {
 			if (g->p.x < g->clipx0) g->p.x = g->clipx0;
 			if (g->p.x1 >= g->clipx1) g->p.x1 = g->clipx1 - 1;
 			if (g->p.x1 < g->p.x) return;
+
+			#if NEED_CLIPREGION
+				// Draw each part of the line that is inside the clip region
+				if (g->clipregion) {
+					const gdispRegion		*rgn;
+					const gdispRegionRect	*r, *e;
+					gCoord					x0, x1, y;
+
+					rgn = g->clipregion;
+					g->clipregion = 0;
+					x0 = g->p.x; x1 = g->p.x1; y = g->p.y;
+					for(r = regionfirst(rgn, y), e = rgn->rects+rgn->cnt; r < e && r->y0 <= y && r->x0 <= x1; r++) {
+						if (r->x1 <= x0)
+							continue;
+						g->p.x = r->x0 > x0 ? r->x0 : x0;
+						g->p.x1 = r->x1 <= x1 ? r->x1 - 1 : x1;
+						g->p.y = y;
+						hline_clip(g);
+					}
+					g->clipregion = rgn;
+					return;
+				}
+			#endif
+		}
+	#endif
+	#if GDISP_NEED_PAINT
+		// Gradient and pattern fills
+		if (g->paint) {
+			paintspan(g);
+			return;
 		}
 	#endif
+	dirtyop(g, g->p.x, g->p.y, g->p.x1 - g->p.x + 1, 1);
 
 	// This is an optimization for the point case. It is only worthwhile however if we
 	// have hardware fills or if we support both hardware pixel drawing and hardware streaming
@@ -350,8 +1073,32 @@ static void vline_clip(GDisplay *g) {
 			if (g->p.y < g->clipy0) g->p.y = g->clipy0;
 			if (g->p.y1 >= g->clipy1) g->p.y1 = g->clipy1 - 1;
 			if (g->p.y1 < g->p.y) return;
+
+			#if NEED_CLIPREGION
+				// Draw each part of the line that is inside the clip region
+				if (g->clipregion) {
+					const gdispRegion		*rgn;
+					const gdispRegionRect	*r, *e;
+					gCoord					x, y0, y1;
+
+					rgn = g->clipregion;
+					g->clipregion = 0;
+					x = g->p.x; y0 = g->p.y; y1 = g->p.y1;
+					for(r = regionfirst(rgn, y0), e = rgn->rects+rgn->cnt; r < e && r->y0 <= y1; r++) {
+						if (x < r->x0 || x >= r->x1)
+							continue;
+						g->p.x = x;
+						g->p.y = r->y0 > y0 ? r->y0 : y0;
+						g->p.y1 = r->y1 <= y1 ? r->y1 - 1 : y1;
+						vline_clip(g);
+					}
+					g->clipregion = rgn;
+					return;
+				}
+			#endif
 		}
 	#endif
+	dirtyop(g, g->p.x, g->p.y, 1, g->p.y1 - g->p.y + 1);
 
 	// This is an optimization for the point case. It is only worthwhile however if we
 	// have hardware fills or if we support both hardware pixel drawing and hardware streaming
@@ -500,15 +1247,179 @@ static void line_clip(GDisplay *g) {
 	}
 }
 
-#if GDISP_STARTUP_LOGO_TIMEOUT > 0
-	static gBool	gdispInitDone;
-	static void StartupLogoDisplay(GDisplay *g) {
-		gCoord			x, y, w;
-		const gCoord *	p;
-		static const gCoord blks[] = {
-				// u
-				2, 6, 1, 10,
-				3, 11, 4, 1,
+#if GDISP_NEED_ANTIALIAS
+	// The number of pixels read, blended and written back in one go
+	#define BLENDSPAN_PIXELS	32
+
+	#if GDISP_HARDWARE_PIXELREAD
+		// readspan(g, x, y, cnt, buf)
+		// Alters:		x,y cx,cy
+		// Reads cnt pixels starting at x,y into buf. A stream read is used if the driver has one as it
+		//	is normally much cheaper than reading each pixel (a single request for a remote display).
+		static void readspan(GDisplay *g, gCoord x, gCoord y, gCoord cnt, gPixel *buf) {
+			gCoord	i;
+
+			#if GDISP_HARDWARE_STREAM_READ
+				#if GDISP_HARDWARE_STREAM_READ == HARDWARE_AUTODETECT
+					if (gvmt(g)->readstart)
+				#endif
+				{
+					g->p.x = x;
+					g->p.y = y;
+					g->p.cx = cnt;
+					g->p.cy = 1;
+					gdisp_lld_read_start(g);
+					for(i = 0; i < cnt; i++)
+						buf[i] = gdisp_lld_read_color(g);
+					gdisp_lld_read_stop(g);
+					return;
+				}
+			#endif
+			#if GDISP_HARDWARE_STREAM_READ != GFXON
+				for (g->p.y = y, i = 0; i < cnt; i++) {
+					g->p.x = x+i;
+					buf[i] = gdisp_lld_get_pixel_color(g);
+				}
+			#endif
+		}
+	#endif
+
+	// blendspan(g)
+	// Parameters:	x,y cx and color. ptr is an array of cx alpha values (one per pixel)
+	// Alters:		x,y x1,y1 x2 cx,cy ptr
+	// Blends the color into a row of pixels. Transparent pixels are skipped, opaque runs are filled
+	//	and the rest are read and blended a block at a time.
+	// Without pixel read support, pixels that are more than half covered are filled and the rest are skipped.
+	static void blendspan(GDisplay *g) {
+		const gU8	*alpha;
+		gCoord		x, y, cnt, n;
+
+		x = g->p.x; y = g->p.y; cnt = g->p.cx;
+		alpha = (const gU8 *)g->p.ptr;
+
+		// Don't read pixels outside the clip area
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				if (y < g->clipy0 || y >= g->clipy1 || x+cnt <= g->clipx0 || x >= g->clipx1)
+					return;
+				if (x < g->clipx0) {
+					alpha += g->clipx0 - x;
+					cnt -= g->clipx0 - x;
+					x = g->clipx0;
+				}
+				if (x+cnt > g->clipx1)
+					cnt = g->clipx1 - x;
+
+				#if NEED_CLIPREGION
+					// Blend each part of the span that is inside the clip region
+					if (g->clipregion) {
+						const gdispRegion		*rgn;
+						const gdispRegionRect	*r, *e;
+
+						rgn = g->clipregion;
+						g->clipregion = 0;
+						for(r = regionfirst(rgn, y), e = rgn->rects+rgn->cnt; r < e && r->y0 <= y && r->x0 < x+cnt; r++) {
+							if (r->x1 <= x)
+								continue;
+							g->p.x = r->x0 > x ? r->x0 : x;
+							g->p.y = y;
+							g->p.cx = (r->x1 < x+cnt ? r->x1 : x+cnt) - g->p.x;
+							g->p.ptr = (void *)(alpha + g->p.x - x);
+							blendspan(g);
+						}
+						g->clipregion = rgn;
+						return;
+					}
+				#endif
+			}
+		#endif
+
+		for(; cnt; cnt -= n, x += n, alpha += n) {
+			#if GDISP_HARDWARE_PIXELREAD
+				// Skip transparent pixels
+				if (!alpha[0]) {
+					for(n = 1; n < cnt && !alpha[n]; n++)
+						;
+					continue;
+				}
+
+				// Fill opaque runs
+				if (alpha[0] == 255) {
+					for(n = 1; n < cnt && alpha[n] == 255; n++)
+						;
+					g->p.x = x; g->p.y = y; g->p.x1 = x+n-1;
+					hline_clip(g);
+					continue;
+				}
+
+				// Blend the rest
+				for(n = 1; n < cnt && n < BLENDSPAN_PIXELS && alpha[n] && alpha[n] != 255; n++)
+					;
+
+				// Read the run, blend it in one hit and bit-blit it back
+				#if GDISP_NEED_PIXELKERNELS && GDISP_HARDWARE_BITFILLS
+					#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
+						if (gvmt(g)->blit)
+					#endif
+					{
+						gPixel	buf[BLENDSPAN_PIXELS];
+						gColor	color;
+
+						scrstreamstop(g);
+						dirtyop(g, x, y, n, 1);
+						color = g->p.color;
+						readspan(g, x, y, n, buf);
+						gdispKernel->blendmask(buf, color, alpha, n);
+						g->p.x = x; g->p.y = y;
+						g->p.cx = n; g->p.cy = 1;
+						g->p.x1 = 0; g->p.y1 = 0; g->p.x2 = n;
+						g->p.ptr = (void *)buf;
+						gdisp_lld_blit_area(g);
+						continue;
+					}
+				#endif
+				{
+					gPixel	buf[BLENDSPAN_PIXELS];
+					gColor	color;
+					gCoord	i;
+
+					color = g->p.color;
+					readspan(g, x, y, n, buf);
+					for (g->p.y = y, i = 0; i < n; i++) {
+						g->p.x = x+i;
+						g->p.color = gdispBlendColor(color, buf[i], alpha[i]);
+						drawpixel_clip(g);
+					}
+					g->p.color = color;
+				}
+			#else
+				// A best approximation when we can't read back the pixels
+				if (alpha[0] <= 0x80) {
+					for(n = 1; n < cnt && alpha[n] <= 0x80; n++)
+						;
+					continue;
+				}
+				for(n = 1; n < cnt && alpha[n] > 0x80; n++)
+					;
+				g->p.x = x; g->p.y = y; g->p.x1 = x+n-1;
+				hline_clip(g);
+			#endif
+		}
+	}
+#endif
+
+#if GDISP_STARTUP_LOGO_TIMEOUT > 0
+	static gBool	gdispInitDone;
+	static void StartupLogoDisplay(GDisplay *g) {
+		gCoord			x, y, w;
+		const gCoord *	p;
+		static const gCoord blks[] = {
+				// u
+				2, 6, 1, 10,
+				3, 11, 4, 1,
 				6, 6, 1, 6,
 				// G
 				8, 0, 1, 12,
@@ -557,6 +1468,15 @@ static void line_clip(GDisplay *g) {
 
 void _gdispInit(void)
 {
+	#if GDISP_NEED_TILER
+		gfxMutexInit(&tilerimagemutex);
+	#endif
+
+	// Select the best pixel kernels before any driver starts drawing
+	#if GDISP_NEED_PIXELKERNELS
+		_gdispKernelsInit();
+	#endif
+
 	// GDISP_DRIVER_LIST is defined - create each driver instance
 	#if defined(GDISP_DRIVER_LIST)
 		{
@@ -629,7 +1549,29 @@ gBool _gdispInitDriver(GDriver *g, void *param, unsigned driverinstance, unsigne
 	gd->controllerdisplay = driverinstance;
 	gd->flags = 0;
 	gd->priv = param;
+	#if GDISP_NEED_VIEWS
+		gd->parent = 0;
+	#endif
+	#if NEED_CLIPREGION
+		gd->clipregion = 0;
+	#endif
+	#if GDISP_NEED_PAINT
+		gd->paint = 0;
+	#endif
+	#if GDISP_NEED_DIRTYRECTS
+		gd->dirtycnt = 0;
+		dirtyreset(gd);
+	#endif
+	#if GDISP_NEED_ASYNC
+		gfxSemInit(&gd->asyncflush.idle, 1, 1);
+		gfxSemInit(&gd->asyncblit.idle, 1, 1);
+		gd->asyncflush.busy = gd->asyncblit.busy = gFalse;
+	#endif
 	MUTEX_INIT(gd);
+	#if GDISP_NEED_STATS
+		gd->stats.depth = 0;
+		gdispGGetStats(gd, 0, gTrue);
+	#endif
 
 	// Call the driver init
 	MUTEX_ENTER(gd);
@@ -682,6 +1624,13 @@ void _gdispDeInitDriver(GDriver *g) {
 	if (GDISP == gd)
 		GDISP = (GDisplay *)gdriverGetInstance(GDRIVER_TYPE_DISPLAY, 0);
 
+	// Let the driver finish anything it is doing in the background
+	#if GDISP_NEED_ASYNC
+		MUTEX_ENTER(gd);
+		asyncwait(&gd->asyncflush);
+		MUTEX_EXIT(gd);
+	#endif
+
 	#if GDISP_HARDWARE_DEINIT
 		#if GDISP_HARDWARE_DEINIT == HARDWARE_AUTODETECT
 			if (gvmt(gd)->deinit)
@@ -692,6 +1641,10 @@ void _gdispDeInitDriver(GDriver *g) {
 			MUTEX_EXIT(gd);
 		}
 	#endif
+	#if GDISP_NEED_ASYNC
+		gfxSemDestroy(&gd->asyncflush.idle);
+		gfxSemDestroy(&gd->asyncblit.idle);
+	#endif
 	MUTEX_DEINIT(gd);
 
 	#undef gd
@@ -717,13 +1670,13 @@ gU8 gdispGGetBacklight(GDisplay *g)			{ return g->g.Backlight; }
 gU8 gdispGGetContrast(GDisplay *g)			{ return g->g.Contrast; }
 
 void gdispGFlush(GDisplay *g) {
-	#if GDISP_HARDWARE_FLUSH
-		#if GDISP_HARDWARE_FLUSH == HARDWARE_AUTODETECT
+	#if GDISP_HARDWARE_FLUSH || GDISP_NEED_DIRTYRECTS
+		#if GDISP_HARDWARE_FLUSH == HARDWARE_AUTODETECT && !GDISP_NEED_DIRTYRECTS
 			if (gvmt(g)->flush)
 		#endif
 		{
 			MUTEX_ENTER(g);
-			gdisp_lld_flush(g);
+			doflush(g);
 			MUTEX_EXIT(g);
 		}
 	#else
@@ -731,9 +1684,62 @@ void gdispGFlush(GDisplay *g) {
 	#endif
 }
 
+#if GDISP_NEED_DIRTYRECTS
+	void gdispGMarkDirty(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		if (cx <= 0 || cy <= 0) return;
+		MUTEX_ENTER(g);
+		dirtyop(g, x, y, cx, cy);
+		dirtycommit(g);
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_STATS
+	static const char *const statnames[gdispStatCount] = {
+		"Clear", "Pixel", "Line", "Box", "Fill", "Blit", "Stream", "Circle", "Ellipse",
+		"Arc", "RoundedBox", "Poly", "AntiAlias", "Text", "GetPixel", "Scroll", "Image", "CmdList", "Composite", "Transform", "Copy",
+		"LLD Pixel", "LLD Clear", "LLD Fill", "LLD Blit", "LLD WriteStart", "LLD WriteColor",
+		"LLD ReadColor", "LLD GetPixel", "LLD VScroll", "LLD Copy", "LLD Flush"
+	};
+
+	void _gdispStatBegin(GDisplay *g, gdispStatOp op) {
+		g->stats.s.op[op].calls++;
+		if (!g->stats.depth++) {
+			g->stats.cur = op;
+			g->stats.start = GDISP_STATS_CLOCK();
+		}
+	}
+
+	void _gdispStatEnd(GDisplay *g) {
+		if (!--g->stats.depth)
+			g->stats.s.op[g->stats.cur].time += (gU32)GDISP_STATS_CLOCK() - g->stats.start;
+	}
+
+	void gdispGGetStats(GDisplay *g, gdispStats *stats, gBool reset) {
+		unsigned	i;
+
+		MUTEX_ENTER(g);
+		if (stats)
+			*stats = g->stats.s;
+		if (reset) {
+			for(i = 0; i < gdispStatCount; i++) {
+				g->stats.s.op[i].calls = 0;
+				g->stats.s.op[i].pixels = 0;
+				g->stats.s.op[i].time = 0;
+			}
+		}
+		MUTEX_EXIT(g);
+	}
+
+	const char *gdispStatName(gdispStatOp op) {
+		return (unsigned)op < gdispStatCount ? statnames[op] : "";
+	}
+#endif
+
 #if GDISP_NEED_STREAMING
 	void gdispGStreamStart(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatStream);
 
 		#if NEED_CLIPPING
 			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
@@ -741,12 +1747,14 @@ void gdispGFlush(GDisplay *g) {
 			#endif
 			// Test if the area is valid - if not then exit
 			if (x < g->clipx0 || x+cx > g->clipx1 || y < g->clipy0 || y+cy > g->clipy1) {
+				STAT_END(g);
 				MUTEX_EXIT(g);
 				return;
 			}
 		#endif
 
 		g->flags |= GDISP_FLG_INSTREAM;
+		dirtyop(g, x, y, cx, cy);
 
 		// Best is hardware streaming
 		#if GDISP_HARDWARE_STREAM_WRITE
@@ -793,7 +1801,7 @@ void gdispGFlush(GDisplay *g) {
 	}
 
 	void gdispGStreamColor(GDisplay *g, gColor color) {
-		#if !GDISP_HARDWARE_STREAM_WRITE && GDISP_LINEBUF_SIZE != 0 && GDISP_HARDWARE_BITFILLS
+		#if GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_LINEBUF_SIZE != 0 && GDISP_HARDWARE_BITFILLS
 			gCoord	 sx1, sy1;
 		#endif
 
@@ -852,6 +1860,7 @@ void gdispGFlush(GDisplay *g) {
 					if (++g->p.y >= g->p.y2)
 						g->p.y = g->p.y1;
 				}
+				return;
 			}
 		#endif
 
@@ -912,6 +1921,94 @@ void gdispGFlush(GDisplay *g) {
 		#endif
 	}
 
+	void gdispGStreamWrite(GDisplay *g, const gColor *buf, gCoord count) {
+		#if GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_LINEBUF_SIZE != 0 && GDISP_HARDWARE_BITFILLS
+			gCoord	 sx1, sy1;
+		#endif
+
+		// Don't touch the mutex as we should already own it
+
+		// Ignore this call if we are not streaming
+		if (!(g->flags & GDISP_FLG_INSTREAM) || count <= 0)
+			return;
+
+		// Best is hardware streaming
+		#if GDISP_HARDWARE_STREAM_WRITE
+			#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
+				if (gvmt(g)->writestart)
+			#endif
+			{
+				// Even better if the driver can take the whole run
+				#if GDISP_HARDWARE_STREAM_WRITECOLORS
+					#if GDISP_HARDWARE_STREAM_WRITECOLORS == HARDWARE_AUTODETECT
+						if (gvmt(g)->writecolors)
+					#endif
+					{
+						g->p.ptr = (void *)buf;
+						g->p.x2 = count;
+						gdisp_lld_write_colors(g);
+						return;
+					}
+				#endif
+				do {
+					g->p.color = *buf++;
+					gdisp_lld_write_color(g);
+				} while(--count);
+				return;
+			}
+		#endif
+
+		// Next best is to use bitfills straight from the buffer
+		#if GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_LINEBUF_SIZE != 0 && GDISP_HARDWARE_BITFILLS
+			#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
+				if (gvmt(g)->blit)
+			#endif
+			{
+				sx1 = g->p.x1;
+				sy1 = g->p.y1;
+				g->p.x1 = 0;
+				g->p.y1 = 0;
+
+				// Anything already in the line buffer goes first
+				if (g->p.cx) {
+					g->p.ptr = (void *)g->linebuf;
+					gdisp_lld_blit_area(g);
+					g->p.x += g->p.cx;
+				}
+
+				// Then each part of a line in one go
+				do {
+					g->p.cx = g->p.x2 - g->p.x;
+					if (g->p.cx > count)
+						g->p.cx = count;
+					g->p.ptr = (void *)buf;
+					gdisp_lld_blit_area(g);
+					buf += g->p.cx;
+					count -= g->p.cx;
+
+					// Just wrap at end-of-line and end-of-buffer
+					if ((g->p.x += g->p.cx) >= g->p.x2) {
+						g->p.x = sx1;
+						if (++g->p.y >= g->p.y2)
+							g->p.y = sy1;
+					}
+				} while(count);
+
+				g->p.cx = 0;
+				g->p.x1 = sx1;
+				g->p.y1 = sy1;
+				return;
+			}
+		#endif
+
+		// Otherwise there is nothing to be gained over sending each color
+		#if GDISP_HARDWARE_STREAM_WRITE != GFXON
+			do {
+				gdispGStreamColor(g, *buf++);
+			} while(--count);
+		#endif
+	}
+
 	void gdispGStreamStop(GDisplay *g) {
 		// Only release the mutex and end the stream if we are actually streaming.
 		if (!(g->flags & GDISP_FLG_INSTREAM))
@@ -929,6 +2026,7 @@ void gdispGFlush(GDisplay *g) {
 			{
 					gdisp_lld_write_stop(g);
 					autoflush_stopdone(g);
+					STAT_END(g);
 					MUTEX_EXIT(g);
 					return;
 			}
@@ -946,6 +2044,7 @@ void gdispGFlush(GDisplay *g) {
 					gdisp_lld_blit_area(g);
 				}
 				autoflush_stopdone(g);
+				STAT_END(g);
 				MUTEX_EXIT(g);
 				return;
 			}
@@ -964,6 +2063,7 @@ void gdispGFlush(GDisplay *g) {
 						gdisp_lld_fill_area(g);
 				}
 				autoflush_stopdone(g);
+				STAT_END(g);
 				MUTEX_EXIT(g);
 				return;
 			}
@@ -972,6 +2072,7 @@ void gdispGFlush(GDisplay *g) {
 		#if GDISP_HARDWARE_STREAM_WRITE != GFXON && (GDISP_LINEBUF_SIZE == 0 || GDISP_HARDWARE_BITFILLS != GFXON) && GDISP_HARDWARE_FILLS != GFXON
 			{
 				autoflush_stopdone(g);
+				STAT_END(g);
 				MUTEX_EXIT(g);
 			}
 		#endif
@@ -980,16 +2081,19 @@ void gdispGFlush(GDisplay *g) {
 
 void gdispGDrawPixel(GDisplay *g, gCoord x, gCoord y, gColor color) {
 	MUTEX_ENTER(g);
+	STAT_BEGIN(g, gdispStatPixel);
 	g->p.x		= x;
 	g->p.y		= y;
 	g->p.color	= color;
 	drawpixel_clip(g);
 	autoflush(g);
+	STAT_END(g);
 	MUTEX_EXIT(g);
 }
 
 void gdispGDrawLine(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color) {
 	MUTEX_ENTER(g);
+	STAT_BEGIN(g, gdispStatLine);
 	g->p.x = x0;
 	g->p.y = y0;
 	g->p.x1 = x1;
@@ -997,12 +2101,28 @@ void gdispGDrawLine(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gCo
 	g->p.color = color;
 	line_clip(g);
 	autoflush(g);
+	STAT_END(g);
 	MUTEX_EXIT(g);
 }
 
-void gdispGClear(GDisplay *g, gColor color) {
-	// Note - clear() ignores the clipping area. It clears the screen.
-	MUTEX_ENTER(g);
+// clear(g)
+// Parameters:	color
+// Alters:		x,y cx,cy
+// Note:		This ignores the clipping area. It clears the screen (or the area of a view).
+static void clear(GDisplay *g) {
+	// A view only clears its own area
+	#if GDISP_NEED_VIEWS
+		if (g->parent) {
+			g->p.x = g->viewx0;
+			g->p.y = g->viewy0;
+			g->p.cx = g->viewx1 - g->viewx0;
+			g->p.cy = g->viewy1 - g->viewy0;
+			fillarea(g);
+			return;
+		}
+	#endif
+
+	dirtyop(g, 0, 0, g->g.Width, g->g.Height);
 
 	// Best is hardware accelerated clear
 	#if GDISP_HARDWARE_CLEARS
@@ -1010,10 +2130,7 @@ void gdispGClear(GDisplay *g, gColor color) {
 			if (gvmt(g)->clear)
 		#endif
 		{
-			g->p.color = color;
 			gdisp_lld_clear(g);
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1027,10 +2144,7 @@ void gdispGClear(GDisplay *g, gColor color) {
 			g->p.x = g->p.y = 0;
 			g->p.cx = g->g.Width;
 			g->p.cy = g->g.Height;
-			g->p.color = color;
 			gdisp_lld_fill_area(g);
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1046,7 +2160,6 @@ void gdispGClear(GDisplay *g, gColor color) {
 			g->p.x = g->p.y = 0;
 			g->p.cx = g->g.Width;
 			g->p.cy = g->g.Height;
-			g->p.color = color;
 			area = (gU32)g->p.cx * g->p.cy;
 
 			gdisp_lld_write_start(g);
@@ -1059,8 +2172,6 @@ void gdispGClear(GDisplay *g, gColor color) {
 			for(; area; area--)
 				gdisp_lld_write_color(g);
 			gdisp_lld_write_stop(g);
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1072,33 +2183,56 @@ void gdispGClear(GDisplay *g, gColor color) {
 		//	if (gvmt(g)->pixel)
 		//#endif
 		{
-			g->p.color = color;
 			for(g->p.y = 0; g->p.y < g->g.Height; g->p.y++)
 				for(g->p.x = 0; g->p.x < g->g.Width; g->p.x++)
 					gdisp_lld_draw_pixel(g);
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
 }
 
+void gdispGClear(GDisplay *g, gColor color) {
+	// Note - clear() ignores the clipping area. It clears the screen.
+	MUTEX_ENTER(g);
+	STAT_BEGIN(g, gdispStatClear);
+	g->p.color = color;
+	clear(g);
+	autoflush_stopdone(g);
+	STAT_END(g);
+	MUTEX_EXIT(g);
+}
+
 void gdispGFillArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
 	MUTEX_ENTER(g);
+	STAT_BEGIN(g, gdispStatFill);
 	g->p.x = x;
 	g->p.y = y;
 	g->p.cx = cx;
 	g->p.cy = cy;
 	g->p.color = color;
 	TEST_CLIP_AREA(g) {
-		fillarea(g);
+		fillarea_clip(g);
 	}
 	autoflush_stopdone(g);
+	STAT_END(g);
 	MUTEX_EXIT(g);
 }
 
-void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
-	MUTEX_ENTER(g);
+// blitarea(g)
+// Parameters:	x,y cx,cy x1,y1 (the source position) x2 (the source line width) and ptr (the source pixels)
+// Alters:		all
+static void blitarea(GDisplay *g) {
+	gCoord			x, y, cx, cy, srcx, srcy, srccx;
+	const gPixel	*buffer;
+
+	x = g->p.x;
+	y = g->p.y;
+	cx = g->p.cx;
+	cy = g->p.cy;
+	srcx = g->p.x1;
+	srcy = g->p.y1;
+	srccx = g->p.x2;
+	buffer = (const gPixel *)g->p.ptr;
 
 	#if NEED_CLIPPING
 		#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
@@ -1107,13 +2241,40 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		{
 			// This is a different clipping to fillarea(g) as it needs to take into account srcx,srcy
 			if (x < g->clipx0) { cx -= g->clipx0 - x; srcx += g->clipx0 - x; x = g->clipx0; }
-			if (y < g->clipy0) { cy -= g->clipy0 - y; srcy += g->clipy0 - x; y = g->clipy0; }
+			if (y < g->clipy0) { cy -= g->clipy0 - y; srcy += g->clipy0 - y; y = g->clipy0; }
 			if (x+cx > g->clipx1)	cx = g->clipx1 - x;
 			if (y+cy > g->clipy1)	cy = g->clipy1 - y;
 			if (srcx+cx > srccx) cx = srccx - srcx;
-			if (cx <= 0 || cy <= 0) { MUTEX_EXIT(g); return; }
+			if (cx <= 0 || cy <= 0) return;
+
+			#if NEED_CLIPREGION
+				// Blit each part of the area that is inside the clip region
+				if (g->clipregion) {
+					const gdispRegion		*rgn;
+					const gdispRegionRect	*r, *e;
+
+					rgn = g->clipregion;
+					g->clipregion = 0;
+					for(r = regionfirst(rgn, y), e = rgn->rects+rgn->cnt; r < e && r->y0 < y+cy; r++) {
+						if (r->x1 <= x || r->x0 >= x+cx)
+							continue;
+						g->p.x = r->x0 > x ? r->x0 : x;
+						g->p.y = r->y0 > y ? r->y0 : y;
+						g->p.cx = (r->x1 < x+cx ? r->x1 : x+cx) - g->p.x;
+						g->p.cy = (r->y1 < y+cy ? r->y1 : y+cy) - g->p.y;
+						g->p.x1 = srcx + g->p.x - x;
+						g->p.y1 = srcy + g->p.y - y;
+						g->p.x2 = srccx;
+						g->p.ptr = (void *)buffer;
+						blitarea(g);
+					}
+					g->clipregion = rgn;
+					return;
+				}
+			#endif
 		}
 	#endif
+	dirtyop(g, x, y, cx, cy);
 
 	// Best is hardware bitfills
 	#if GDISP_HARDWARE_BITFILLS
@@ -1129,9 +2290,18 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 			g->p.y1 = srcy;
 			g->p.x2 = srccx;
 			g->p.ptr = (void *)buffer;
+			#if GDISP_NEED_ASYNC && GDISP_HARDWARE_BITFILLSASYNC
+				if ((g->flags & GDISP_FLG_ASYNCBLIT)
+						#if GDISP_HARDWARE_BITFILLSASYNC == HARDWARE_AUTODETECT
+							&& gvmt(g)->blitasync
+						#endif
+						) {
+					asyncstart(&g->asyncblit);
+					gdisp_lld_blit_area_async(g);
+					return;
+				}
+			#endif
 			gdisp_lld_blit_area(g);
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1159,6 +2329,21 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				#endif
 				gdisp_lld_write_pos(g);
 			#endif
+			#if GDISP_HARDWARE_STREAM_WRITECOLORS
+				#if GDISP_HARDWARE_STREAM_WRITECOLORS == HARDWARE_AUTODETECT
+					if (gvmt(g)->writecolors)
+				#endif
+				{
+					// Send each line in one go
+					g->p.x2 = cx;
+					for(g->p.y = y; g->p.y < srcy; g->p.y++, buffer += srccx + cx) {
+						g->p.ptr = (void *)buffer;
+						gdisp_lld_write_colors(g);
+					}
+					gdisp_lld_write_stop(g);
+					return;
+				}
+			#endif
 			for(g->p.y = y; g->p.y < srcy; g->p.y++, buffer += srccx) {
 				for(g->p.x = x; g->p.x < srcx; g->p.x++) {
 					g->p.color = *buffer++;
@@ -1166,8 +2351,6 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				}
 			}
 			gdisp_lld_write_stop(g);
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1201,8 +2384,6 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 					}
 				}
 			}
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1226,61 +2407,900 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 					gdisp_lld_draw_pixel(g);
 				}
 			}
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
 }
 
-#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
-	void gdispGSetClip(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
-		MUTEX_ENTER(g);
+void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
+	MUTEX_ENTER(g);
+	STAT_BEGIN(g, gdispStatBlit);
+	g->p.x = x;
+	g->p.y = y;
+	g->p.cx = cx;
+	g->p.cy = cy;
+	g->p.x1 = srcx;
+	g->p.y1 = srcy;
+	g->p.x2 = srccx;
+	g->p.ptr = (void *)buffer;
+	blitarea(g);
+	autoflush_stopdone(g);
+	STAT_END(g);
+	MUTEX_EXIT(g);
+}
 
-		// Best is using hardware clipping
-		#if GDISP_HARDWARE_CLIP
-			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
-				if (gvmt(g)->setclip)
-			#endif
-			{
-				g->p.x = x;
-				g->p.y = y;
-				g->p.cx = cx;
-				g->p.cy = cy;
-				gdisp_lld_set_clip(g);
-			}
-			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
-				else
-			#endif
-		#endif
+#if GDISP_NEED_PIXMAP
+	void gdispGBlitPixmap(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, GDisplay *src, gCoord srcx, gCoord srcy) {
+		const gPixel	*s;
+		gPixel			*d;
+		gCoord			i, j, n;
 
-		// Worst is using software clipping
-		#if GDISP_HARDWARE_CLIP != GFXON
-			{
-				if (x < 0) { cx += x; x = 0; }
-				if (y < 0) { cy += y; y = 0; }
-				if (cx <= 0 || cy <= 0 || x >= g->g.Width || y >= g->g.Height) { x = y = cx = cy = 0; }
-				g->clipx0 = x;
-				g->clipy0 = y;
-				g->clipx1 = x+cx;	if (g->clipx1 > g->g.Width) g->clipx1 = g->g.Width;
-				g->clipy1 = y+cy;	if (g->clipy1 > g->g.Height) g->clipy1 = g->g.Height;
+		if (!(s = gdispPixmapGetBits(src)))
+			return;
+
+		// Clip to the source pixmap
+		if (srcx < 0) { cx += srcx; x -= srcx; srcx = 0; }
+		if (srcy < 0) { cy += srcy; y -= srcy; srcy = 0; }
+		if (srcx+cx > src->g.Width)		cx = src->g.Width - srcx;
+		if (srcy+cy > src->g.Height)	cy = src->g.Height - srcy;
+		if (cx <= 0 || cy <= 0)
+			return;
+
+		// The lines of a rotated pixmap are not in display order. Read its pixels one at a time.
+		#if GDISP_NEED_CONTROL
+			if (src->g.Orientation != gOrientation0) {
+				#if GDISP_NEED_PIXELREAD
+					gPixel	buf[32];
+
+					for(j = 0; j < cy; j++) {
+						for(i = 0; i < cx; i += n) {
+							for(n = 0; n < 32 && i+n < cx; n++)
+								buf[n] = gdispGGetPixelColor(src, srcx+i+n, srcy+j);
+							gdispGBlitArea(g, x+i, y+j, n, 1, 0, 0, n, buf);
+						}
+					}
+				#endif
+				return;
 			}
 		#endif
-		MUTEX_EXIT(g);
-	}
-#endif
-
-#if GDISP_NEED_CIRCLE
-	void gdispGDrawCircle(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
-		gCoord a, b, P;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatBlit);
 
-		// Calculate intermediates
-		a = 1;
-		b = radius;
-		P = 4 - radius;
-		g->p.color = color;
+		// Fastest is copying straight into the memory of an unrotated pixmap
+		d = gdispPixmapGetBits(g);
+		#if GDISP_NEED_CONTROL
+			if (g->g.Orientation != gOrientation0)
+				d = 0;
+		#endif
+		#if NEED_CLIPREGION
+			if (g->clipregion)
+				d = 0;
+		#endif
+		if (d) {
+			#if GDISP_NEED_STATS
+				gU32	t = GDISP_STATS_CLOCK();
+			#endif
+
+			#if NEED_CLIPPING
+				if (x < g->clipx0) { cx -= g->clipx0 - x; srcx += g->clipx0 - x; x = g->clipx0; }
+				if (y < g->clipy0) { cy -= g->clipy0 - y; srcy += g->clipy0 - y; y = g->clipy0; }
+				if (x+cx > g->clipx1)	cx = g->clipx1 - x;
+				if (y+cy > g->clipy1)	cy = g->clipy1 - y;
+			#endif
+			if (cx > 0 && cy > 0) {
+				s += srcy * src->g.Width + srcx;
+				d += y * g->g.Width + x;
+
+				// Copy from the bottom up if the source is above the destination in the same pixmap
+				if (src == g && srcy < y) {
+					s += (cy-1) * src->g.Width;
+					d += (cy-1) * g->g.Width;
+					for(j = 0; j < cy; j++, s -= src->g.Width, d -= g->g.Width)
+						memmove(d, s, cx * sizeof(gPixel));
+				} else {
+					for(j = 0; j < cy; j++, s += src->g.Width, d += g->g.Width)
+						memmove(d, s, cx * sizeof(gPixel));
+				}
+				#if GDISP_NEED_STATS
+					statlld(g, gdispStatLLDBlit, (gU32)cx * cy, t);
+				#endif
+			}
+		} else {
+			g->p.x = x;
+			g->p.y = y;
+			g->p.cx = cx;
+			g->p.cy = cy;
+			g->p.x1 = srcx;
+			g->p.y1 = srcy;
+			g->p.x2 = src->g.Width;
+			g->p.ptr = (void *)s;
+			blitarea(g);
+			autoflush_stopdone(g);
+		}
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_COMPOSITE
+	// The number of pixels read, composited and written back in one go
+	#define COMPOSITE_PIXELS	32
+
+	// pixelstorgb(dst, src, cnt) and rgbtopixels(dst, src, cnt)
+	// Convert a row of pixels to and from RGB888 words
+	static void pixelstorgb(gU32 *dst, const gPixel *src, unsigned cnt) {
+		#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
+			// Drop the alpha of the RGB888 alpha hack
+			for(; cnt; cnt--)
+				*dst++ = *src++ & 0x00FFFFFF;
+		#else
+			#if GDISP_NEED_PIXELKERNELS
+				gdispKernelConvertFn	fn;
+
+				if ((fn = gdispKernelGetConverter(GDISP_PIXELFORMAT_RGB888, GDISP_PIXELFORMAT))) {
+					fn(dst, src, cnt);
+					return;
+				}
+			#endif
+			for(; cnt; cnt--, src++)
+				*dst++ = ((gU32)RED_OF(*src) << 16) | ((gU32)GREEN_OF(*src) << 8) | (gU32)BLUE_OF(*src);
+		#endif
+	}
+	static void rgbtopixels(gPixel *dst, const gU32 *src, unsigned cnt) {
+		#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
+			memcpy(dst, src, cnt * sizeof(gPixel));
+		#else
+			#if GDISP_NEED_PIXELKERNELS
+				gdispKernelConvertFn	fn;
+
+				if ((fn = gdispKernelGetConverter(GDISP_PIXELFORMAT, GDISP_PIXELFORMAT_RGB888))) {
+					fn(dst, src, cnt);
+					return;
+				}
+			#endif
+			for(; cnt; cnt--, src++)
+				*dst++ = HTML2COLOR(*src);
+		#endif
+	}
+
+	// compositerow(dst, src, cnt, op, opacity)
+	// Composites a row of ARGB8888 pixels onto a row of opaque RGB888 pixels. The opacity is 1 to 256.
+	// The red and blue channels are calculated together in one word and then the green channel.
+	//	The operator is chosen outside the loops and the loops have no branches so the compiler can vectorize them.
+	//	A transparent source pixel leaves the destination unchanged without needing to be skipped.
+	static void compositerow(gU32 *dst, const gU32 *src, unsigned cnt, gdispCompositeOp op, gU32 opacity) {
+		gU32	s, d, a, rb, gr, m;
+
+		switch(op) {
+		case gdispCompositeSrcOver:
+		default:
+			for(; cnt; cnt--, src++, dst++) {
+				s = *src;
+				a = ((s >> 24) * opacity) >> 8;
+				d = *dst;
+				rb = ((s & 0xFF00FF) * (a+1) + (d & 0xFF00FF) * (256-a)) >> 8;
+				gr = ((s & 0x00FF00) * (a+1) + (d & 0x00FF00) * (256-a)) >> 8;
+				*dst = (rb & 0xFF00FF) | (gr & 0x00FF00);
+			}
+			break;
+
+		case gdispCompositeSrcIn:
+			for(; cnt; cnt--, src++, dst++) {
+				s = *src;
+				a = (((s >> 24) * opacity) >> 8) + 1;
+				*dst = ((((s & 0xFF00FF) * a) >> 8) & 0xFF00FF) | ((((s & 0x00FF00) * a) >> 8) & 0x00FF00);
+			}
+			break;
+
+		case gdispCompositeAdd:
+			for(; cnt; cnt--, src++, dst++) {
+				s = *src;
+				a = (((s >> 24) * opacity) >> 8) + 1;
+				d = *dst;
+				rb = ((((s & 0xFF00FF) * a) >> 8) & 0xFF00FF) + (d & 0xFF00FF);
+				gr = ((((s & 0x00FF00) * a) >> 8) & 0x00FF00) + (d & 0x00FF00);
+
+				// Saturate the channels that overflowed
+				m = rb & 0x01000100;
+				rb |= m - (m >> 8);
+				m = gr & 0x00010000;
+				gr |= m - (m >> 8);
+				*dst = (rb & 0xFF00FF) | (gr & 0x00FF00);
+			}
+			break;
+		}
+	}
+
+	#if GDISP_NEED_PIXMAP
+		// mul255(a, b)
+		// Returns a * b / 255 rounded
+		static GFXINLINE gU32 mul255(gU32 a, gU32 b) {
+			a = a * b + 128;
+			return (a + (a >> 8)) >> 8;
+		}
+
+		// compositerowargb(dst, src, cnt, op, opacity)
+		// Composites a row of ARGB8888 pixels onto a row of ARGB8888 pixels. The opacity is 1 to 256.
+		// The destination colors are weighted by their alpha so the result is always un-multiplied ARGB8888.
+		static void compositerowargb(gU32 *dst, const gU32 *src, unsigned cnt, gdispCompositeOp op, gU32 opacity) {
+			gU32	s, d, sa, da, ra, c, sh;
+
+			for(; cnt; cnt--, src++, dst++) {
+				s = *src;
+				d = *dst;
+				sa = mul255(s >> 24, opacity - 1);
+				da = d >> 24;
+				switch(op) {
+				case gdispCompositeSrcOver:
+				default:
+					if (!sa)
+						continue;
+					da = mul255(da, 255 - sa);
+					ra = sa + da;
+					break;
+				case gdispCompositeSrcIn:
+					if (!(ra = mul255(sa, da))) {
+						*dst = 0;
+						continue;
+					}
+					*dst = (ra << 24) | (s & 0x00FFFFFF);
+					continue;
+				case gdispCompositeAdd:
+					if (!sa)
+						continue;
+					if ((ra = sa + da) > 255)
+						ra = 255;
+					break;
+				}
+
+				// Each channel is the weighted sum of the source and destination divided by the resulting alpha
+				for(*dst = ra << 24, sh = 0; sh < 24; sh += 8) {
+					c = ((s >> sh) & 0xFF) * sa + ((d >> sh) & 0xFF) * da;
+					if (c > 255*255)
+						c = 255*255;
+					c = (c + (ra >> 1)) / ra;
+					*dst |= (c > 255 ? 255 : c) << sh;
+				}
+			}
+		}
+	#endif
+
+	// compositespan(g, x, y, cnt, src, op, opacity)
+	// Composites a row of ARGB8888 pixels onto the display. The opacity is 1 to 256.
+	// Alters:		x,y cx,cy x1,y1 x2 ptr color
+	// The destination is read, composited and written back a block at a time.
+	static void compositespan(GDisplay *g, gCoord x, gCoord y, gCoord cnt, const gU32 *src, gdispCompositeOp op, gU32 opacity) {
+		gU32		buf[COMPOSITE_PIXELS];
+		gPixel		pix[COMPOSITE_PIXELS];
+		gPixel		*bits;
+		gBool		canread;
+		gCoord		i, n;
+		#if GDISP_NEED_STATS
+			gU32	t = GDISP_STATS_CLOCK();
+			gCoord	total;
+		#endif
+
+		// Don't read pixels outside the clip area
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				if (y < g->clipy0 || y >= g->clipy1 || x+cnt <= g->clipx0 || x >= g->clipx1)
+					return;
+				if (x < g->clipx0) {
+					src += g->clipx0 - x;
+					cnt -= g->clipx0 - x;
+					x = g->clipx0;
+				}
+				if (x+cnt > g->clipx1)
+					cnt = g->clipx1 - x;
+
+				#if NEED_CLIPREGION
+					// Composite each part of the span that is inside the clip region
+					if (g->clipregion) {
+						const gdispRegion		*rgn;
+						const gdispRegionRect	*r, *e;
+						gCoord					x0;
+
+						rgn = g->clipregion;
+						g->clipregion = 0;
+						for(r = regionfirst(rgn, y), e = rgn->rects+rgn->cnt; r < e && r->y0 <= y && r->x0 < x+cnt; r++) {
+							if (r->x1 <= x)
+								continue;
+							x0 = r->x0 > x ? r->x0 : x;
+							compositespan(g, x0, y, (r->x1 < x+cnt ? r->x1 : x+cnt) - x0, src + x0 - x, op, opacity);
+						}
+						g->clipregion = rgn;
+						return;
+					}
+				#endif
+			}
+		#endif
+
+		#if GDISP_NEED_STATS
+			total = cnt;
+		#endif
+
+		// Fastest is reading and writing the memory of a pixmap directly
+		bits = 0;
+		#if GDISP_NEED_PIXMAP
+			// A pixmap with an alpha channel keeps the resulting alpha
+			if (gdispPixmapGetARGBBits(g)) {
+				for(; cnt; cnt -= n, x += n, src += n) {
+					n = cnt > COMPOSITE_PIXELS ? COMPOSITE_PIXELS : cnt;
+					_gdispPixmapReadARGB(g, x, y, n, buf);
+					compositerowargb(buf, src, n, op, opacity);
+					_gdispPixmapWriteARGB(g, x, y, n, buf);
+				}
+				#if GDISP_NEED_STATS
+					statlld(g, gdispStatLLDBlit, total, t);
+				#endif
+				return;
+			}
+			#if GDISP_NEED_CONTROL
+				if (g->g.Orientation == gOrientation0)
+			#endif
+			{
+				if ((bits = gdispPixmapGetBits(g)))
+					bits += y * g->g.Width;
+			}
+		#endif
+
+		#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
+			canread = (bits || gvmt(g)->get) ? gTrue : gFalse;
+		#elif GDISP_HARDWARE_PIXELREAD
+			canread = gTrue;
+		#else
+			canread = bits ? gTrue : gFalse;
+		#endif
+
+		if (!bits)
+			scrstreamstop(g);
+
+		for(; cnt; cnt -= n, x += n, src += n) {
+			n = cnt > COMPOSITE_PIXELS ? COMPOSITE_PIXELS : cnt;
+
+			// Without pixel read support just draw the source pixels that are more than half opaque
+			if (!canread && op != gdispCompositeSrcIn) {
+				for(g->p.y = y, i = 0; i < n; i++) {
+					if (((src[i] >> 24) * opacity) >> 8 > 0x80) {
+						g->p.x = x+i;
+						g->p.color = HTML2COLOR(src[i] & 0x00FFFFFF);
+						drawpixel_clip(g);
+					}
+				}
+				continue;
+			}
+
+			// Source-in replaces the destination so it doesn't need reading
+			if (op != gdispCompositeSrcIn) {
+				if (bits)
+					memcpy(pix, bits + x, n * sizeof(gPixel));
+				#if GDISP_HARDWARE_PIXELREAD
+					else {
+						for(g->p.y = y, i = 0; i < n; i++) {
+							g->p.x = x+i;
+							pix[i] = gdisp_lld_get_pixel_color(g);
+						}
+					}
+				#endif
+				pixelstorgb(buf, pix, n);
+			}
+			compositerow(buf, src, n, op, opacity);
+			rgbtopixels(pix, buf, n);
+
+			// Write it back
+			if (bits) {
+				memcpy(bits + x, pix, n * sizeof(gPixel));
+				continue;
+			}
+			#if GDISP_HARDWARE_BITFILLS
+				#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
+					if (gvmt(g)->blit)
+				#endif
+				{
+					dirtyop(g, x, y, n, 1);
+					g->p.x = x; g->p.y = y;
+					g->p.cx = n; g->p.cy = 1;
+					g->p.x1 = 0; g->p.y1 = 0; g->p.x2 = n;
+					g->p.ptr = (void *)pix;
+					gdisp_lld_blit_area(g);
+					continue;
+				}
+			#endif
+			for(g->p.y = y, i = 0; i < n; i++) {
+				g->p.x = x+i;
+				g->p.color = pix[i];
+				drawpixel_clip(g);
+			}
+		}
+
+		#if GDISP_NEED_STATS
+			if (bits)
+				statlld(g, gdispStatLLDBlit, total, t);
+		#endif
+	}
+
+	// compositearea(g, x, y, cx, cy, src, srcline, op, opacity)
+	// Composites an area of ARGB8888 pixels a row at a time. srcline is the width of a source line.
+	static void compositearea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const gU32 *src, gCoord srcline, gdispCompositeOp op, gU8 opacity) {
+		gCoord	j;
+
+		// Nothing is drawn when fully transparent except by source-in which replaces the destination
+		if ((!opacity && op != gdispCompositeSrcIn) || cx <= 0)
+			return;
+		for(j = 0; j < cy; j++, src += srcline)
+			compositespan(g, x, y+j, cx, src, op, (gU32)opacity+1);
+	}
+
+	void gdispGCompositeArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gU32 *buffer, gdispCompositeOp op, gU8 opacity) {
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatComposite);
+		compositearea(g, x, y, cx, cy, buffer + srcy * srccx + srcx, srccx, op, opacity);
+		autoflush_stopdone(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
+	#if GDISP_NEED_PIXMAP
+		void gdispGBlendPixmap(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, GDisplay *src, gCoord srcx, gCoord srcy, gdispCompositeOp op, gU8 opacity) {
+			const gU32	*s;
+			gU32		buf[COMPOSITE_PIXELS];
+			gCoord		i, j, n;
+
+			if (!(gvmt(src)->d.flags & GDISP_VFLG_PIXMAP))
+				return;
+
+			// Clip to the source pixmap
+			if (srcx < 0) { cx += srcx; x -= srcx; srcx = 0; }
+			if (srcy < 0) { cy += srcy; y -= srcy; srcy = 0; }
+			if (srcx+cx > src->g.Width)		cx = src->g.Width - srcx;
+			if (srcy+cy > src->g.Height)	cy = src->g.Height - srcy;
+			if (cx <= 0 || cy <= 0)
+				return;
+
+			MUTEX_ENTER(g);
+			STAT_BEGIN(g, gdispStatComposite);
+
+			// The pixels of an unrotated ARGB pixmap can be used as they are
+			s = gdispPixmapGetARGBBits(src);
+			#if GDISP_NEED_CONTROL
+				if (src->g.Orientation != gOrientation0)
+					s = 0;
+			#endif
+			if (s)
+				compositearea(g, x, y, cx, cy, s + srcy * src->g.Width + srcx, src->g.Width, op, opacity);
+
+			// Otherwise read the source a block at a time
+			else if (opacity || op == gdispCompositeSrcIn) {
+				for(j = 0; j < cy; j++) {
+					for(i = 0; i < cx; i += n) {
+						n = cx - i > COMPOSITE_PIXELS ? COMPOSITE_PIXELS : cx - i;
+						_gdispPixmapReadARGB(src, srcx+i, srcy+j, n, buf);
+						compositespan(g, x+i, y+j, n, buf, op, (gU32)opacity+1);
+					}
+				}
+			}
+
+			autoflush_stopdone(g);
+			STAT_END(g);
+			MUTEX_EXIT(g);
+		}
+	#endif
+#endif
+
+#if GDISP_NEED_TRANSFORM
+	// The number of pixels sampled and blitted in one go
+	#define TRANSFORM_PIXELS	32
+
+	// floordiv(a, b)
+	// Returns a/b rounded down. b must be positive.
+	static gI64 floordiv(gI64 a, gI64 b) {
+		return a >= 0 ? a / b : -((b - 1 - a) / b);
+	}
+
+	// xformlimit(p, dp, lim, i0, i1)
+	// Limits the range i0 to i1 (exclusive) to the values of i where 0 <= p + i*dp < lim
+	static void xformlimit(gI64 p, gI32 dp, gI64 lim, gI32 *i0, gI32 *i1) {
+		gI64	lo, hi;
+
+		if (dp > 0) {
+			lo = -floordiv(p, dp);
+			hi = floordiv(lim - 1 - p, dp) + 1;
+		} else if (dp < 0) {
+			lo = -floordiv(lim - 1 - p, -(gI64)dp);
+			hi = floordiv(p, -(gI64)dp) + 1;
+		} else if (p < 0 || p >= lim) {
+			*i1 = *i0;
+			return;
+		} else
+			return;
+		if (lo > *i0)	*i0 = lo > *i1 ? *i1 : (gI32)lo;
+		if (hi < *i1)	*i1 = hi < *i0 ? *i0 : (gI32)hi;
+	}
+
+	// transformarea(g, src, dx, dy, cx, cy, m, filter)
+	// Draws a cx by cy area of pixels through the matrix m. The source pixel at x,y is src[x*dx + y*dy].
+	// Alters:		all
+	// Each display line is walked across the part of it that maps inside the source area.
+	//	The source position is calculated using the inverse matrix at the start of the line and then stepped.
+	static void transformarea(GDisplay *g, const gPixel *src, int dx, int dy, gCoord cx, gCoord cy, const MatrixFixed2D *m, gdispTransformFilter filter) {
+		gPixel			buf[TRANSFORM_PIXELS];
+		const gPixel	*p;
+		gI64			det, px, py, t, tu, tv, xmin, xmax, ymin, ymax;
+		gI32			i00, i01, i10, i11, u, v, ub, vb, i0, i1;
+		gCoord			x0, x1, y0, y1, x, y, n, k, sx, sy;
+		int				ox, oy;
+		gU32			fx, fy;
+
+		if (cx <= 0 || cy <= 0)
+			return;
+
+		// Invert the matrix. The determinant is kept to 24 fractional bits to keep small scales accurate.
+		det = ((gI64)m->a00 * m->a11 - (gI64)m->a01 * m->a10) >> 8;
+		if (!det)
+			return;
+		t = (gI64)m->a11 * 0x1000000 / det;		if (t > 0x7FFFFFFF || t < -0x7FFFFFFF) return;		i00 = (gI32)t;
+		t = -(gI64)m->a01 * 0x1000000 / det;	if (t > 0x7FFFFFFF || t < -0x7FFFFFFF) return;		i01 = (gI32)t;
+		t = -(gI64)m->a10 * 0x1000000 / det;	if (t > 0x7FFFFFFF || t < -0x7FFFFFFF) return;		i10 = (gI32)t;
+		t = (gI64)m->a00 * 0x1000000 / det;		if (t > 0x7FFFFFFF || t < -0x7FFFFFFF) return;		i11 = (gI32)t;
+
+		// The display area covered by the corners of the source area
+		xmin = xmax = m->a02;
+		ymin = ymax = m->a12;
+		t = (gI64)m->a00 * cx;		if (t < 0) xmin += t; else xmax += t;
+		t = (gI64)m->a01 * cy;		if (t < 0) xmin += t; else xmax += t;
+		t = (gI64)m->a10 * cx;		if (t < 0) ymin += t; else ymax += t;
+		t = (gI64)m->a11 * cy;		if (t < 0) ymin += t; else ymax += t;
+
+		// Limit it to the display and the clip area
+		x0 = 0; y0 = 0; x1 = g->g.Width; y1 = g->g.Height;
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				x0 = g->clipx0; y0 = g->clipy0; x1 = g->clipx1; y1 = g->clipy1;
+			}
+		#endif
+		if (xmin >= FIXED(x1) || xmax <= FIXED(x0) || ymin >= FIXED(y1) || ymax <= FIXED(y0))
+			return;
+		if (xmin > FIXED(x0))				x0 = (gCoord)(xmin >> 16);
+		if (ymin > FIXED(y0))				y0 = (gCoord)(ymin >> 16);
+		if (xmax < FIXED(x1))				x1 = (gCoord)((xmax + 0xFFFF) >> 16);
+		if (ymax < FIXED(y1))				y1 = (gCoord)((ymax + 0xFFFF) >> 16);
+
+		// Sample at the center of each display pixel
+		for(y = y0; y < y1; y++) {
+			px = FIXED(x0) + FIXED0_5 - m->a02;
+			py = FIXED(y) + FIXED0_5 - m->a12;
+			tu = ((gI64)i00 * px + (gI64)i01 * py) >> 16;
+			tv = ((gI64)i10 * px + (gI64)i11 * py) >> 16;
+
+			// Only draw the part of the line that is inside the source area
+			i0 = 0; i1 = x1 - x0;
+			xformlimit(tu, i00, FIXED(cx), &i0, &i1);
+			xformlimit(tv, i10, FIXED(cy), &i0, &i1);
+			if (i0 >= i1)
+				continue;
+			u = (gI32)(tu + (gI64)i00 * i0);
+			v = (gI32)(tv + (gI64)i10 * i0);
+
+			for(x = x0 + i0; x < x0 + i1; x += n) {
+				n = x0 + i1 - x;
+				if (n > TRANSFORM_PIXELS)
+					n = TRANSFORM_PIXELS;
+
+				if (filter == gdispFilterBilinear) {
+					for(k = 0; k < n; k++, u += i00, v += i10) {
+						// Clamp the four pixels to the edges of the source
+						ub = u - FIXED0_5;
+						vb = v - FIXED0_5;
+						sx = (gCoord)(ub >> 16);	fx = (ub >> 8) & 0xFF;		ox = dx;
+						sy = (gCoord)(vb >> 16);	fy = (vb >> 8) & 0xFF;		oy = dy;
+						if (sx < 0)					{ sx = 0; fx = 0; }
+						if (sx >= cx-1)				{ sx = cx-1; ox = 0; }
+						if (sy < 0)					{ sy = 0; fy = 0; }
+						if (sy >= cy-1)				{ sy = cy-1; oy = 0; }
+						p = src + sx*dx + sy*dy;
+						buf[k] = RGB2PIXEL(lerprgb(
+									lerprgb(PIXEL2RGB(p[0]), PIXEL2RGB(p[ox]), fx),
+									lerprgb(PIXEL2RGB(p[oy]), PIXEL2RGB(p[ox+oy]), fx),
+									fy));
+					}
+				} else if (!i10) {
+					// No rotation so the source line is the same across the display line
+					for(p = src + (v >> 16)*dy, k = 0; k < n; k++, u += i00)
+						buf[k] = p[(u >> 16)*dx];
+				} else {
+					for(k = 0; k < n; k++, u += i00, v += i10)
+						buf[k] = src[(u >> 16)*dx + (v >> 16)*dy];
+				}
+
+				g->p.x = x;
+				g->p.y = y;
+				g->p.cx = n;
+				g->p.cy = 1;
+				g->p.x1 = 0;
+				g->p.y1 = 0;
+				g->p.x2 = n;
+				g->p.ptr = (void *)buf;
+				blitarea(g);
+			}
+		}
+	}
+
+	void gdispGBlitAreaTransformed(GDisplay *g, gCoord srcx, gCoord srcy, gCoord cx, gCoord cy, gCoord srccx, const gPixel *buffer, const MatrixFixed2D *m, gdispTransformFilter filter) {
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatTransform);
+		transformarea(g, buffer + srcy * srccx + srcx, 1, srccx, cx, cy, m, filter);
+		autoflush_stopdone(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
+	#if GMISC_NEED_MATRIXFLOAT2D
+		void gdispGBlitAreaTransformedFloat(GDisplay *g, gCoord srcx, gCoord srcy, gCoord cx, gCoord cy, gCoord srccx, const gPixel *buffer, const MatrixFloat2D *m, gdispTransformFilter filter) {
+			MatrixFixed2D	mf;
+
+			mf.a00 = FP2FIXED(m->a00);	mf.a01 = FP2FIXED(m->a01);	mf.a02 = FP2FIXED(m->a02);
+			mf.a10 = FP2FIXED(m->a10);	mf.a11 = FP2FIXED(m->a11);	mf.a12 = FP2FIXED(m->a12);
+			mf.a20 = 0;					mf.a21 = 0;					mf.a22 = FIXED(1);
+			gdispGBlitAreaTransformed(g, srcx, srcy, cx, cy, srccx, buffer, &mf, filter);
+		}
+	#endif
+
+	#if GDISP_NEED_PIXMAP
+		void gdispGBlitPixmapTransformed(GDisplay *g, GDisplay *src, gCoord srcx, gCoord srcy, gCoord cx, gCoord cy, const MatrixFixed2D *m, gdispTransformFilter filter) {
+			MatrixFixed2D	mf;
+			const gPixel	*s;
+			int				dx, dy;
+
+			if (!(s = gdispPixmapGetBits(src)))
+				return;
+
+			// Clip to the source pixmap. The matrix is moved so the rest of the area stays in the same place.
+			mf = *m;
+			if (srcx < 0) { cx += srcx; mf.a02 -= m->a00 * srcx; mf.a12 -= m->a10 * srcx; srcx = 0; }
+			if (srcy < 0) { cy += srcy; mf.a02 -= m->a01 * srcy; mf.a12 -= m->a11 * srcy; srcy = 0; }
+			if (srcx+cx > src->g.Width)		cx = src->g.Width - srcx;
+			if (srcy+cy > src->g.Height)	cy = src->g.Height - srcy;
+			if (cx <= 0 || cy <= 0)
+				return;
+
+			// Find the source area in the pixmap memory. This matches the pixmap driver.
+			#if GDISP_NEED_CONTROL
+				switch(src->g.Orientation) {
+				case gOrientation90:
+					s += (src->g.Width-srcx-1) * src->g.Height + srcy;
+					dx = -src->g.Height;	dy = 1;
+					break;
+				case gOrientation180:
+					s += (src->g.Height-srcy-1) * src->g.Width + src->g.Width-srcx-1;
+					dx = -1;				dy = -src->g.Width;
+					break;
+				case gOrientation270:
+					s += srcx * src->g.Height + src->g.Height-srcy-1;
+					dx = src->g.Height;		dy = -1;
+					break;
+				default:
+					s += srcy * src->g.Width + srcx;
+					dx = 1;					dy = src->g.Width;
+					break;
+				}
+			#else
+				s += srcy * src->g.Width + srcx;
+				dx = 1;
+				dy = src->g.Width;
+			#endif
+
+			MUTEX_ENTER(g);
+			STAT_BEGIN(g, gdispStatTransform);
+			transformarea(g, s, dx, dy, cx, cy, &mf, filter);
+			autoflush_stopdone(g);
+			STAT_END(g);
+			MUTEX_EXIT(g);
+		}
+	#endif
+#endif
+
+#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
+	// setclip(g)
+	// Parameters:	x,y cx,cy
+	// Alters:		nothing
+	static void setclip(GDisplay *g) {
+		// Best is using hardware clipping
+		#if GDISP_HARDWARE_CLIP
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (gvmt(g)->setclip)
+			#endif
+				gdisp_lld_set_clip(g);
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				else
+			#endif
+		#endif
+
+		// Worst is using software clipping
+		#if GDISP_HARDWARE_CLIP != GFXON
+			{
+				gCoord	x, y, cx, cy;
+
+				x = g->p.x;
+				y = g->p.y;
+				cx = g->p.cx;
+				cy = g->p.cy;
+				if (x < 0) { cx += x; x = 0; }
+				if (y < 0) { cy += y; y = 0; }
+				if (cx <= 0 || cy <= 0 || x >= g->g.Width || y >= g->g.Height) { x = y = cx = cy = 0; }
+				g->clipx0 = x;
+				g->clipy0 = y;
+				g->clipx1 = x+cx;	if (g->clipx1 > g->g.Width) g->clipx1 = g->g.Width;
+				g->clipy1 = y+cy;	if (g->clipy1 > g->g.Height) g->clipy1 = g->g.Height;
+				#if GDISP_NEED_VIEWS
+					// A view never draws outside its area
+					if (g->parent) {
+						if (g->clipx0 < g->viewx0)	g->clipx0 = g->viewx0;
+						if (g->clipy0 < g->viewy0)	g->clipy0 = g->viewy0;
+						if (g->clipx1 > g->viewx1)	g->clipx1 = g->viewx1;
+						if (g->clipy1 > g->viewy1)	g->clipy1 = g->viewy1;
+						if (g->clipx1 < g->clipx0)	g->clipx1 = g->clipx0;
+						if (g->clipy1 < g->clipy0)	g->clipy1 = g->clipy0;
+					}
+				#endif
+				#if GDISP_NEED_CLIPREGION
+					g->clipregion = 0;
+				#endif
+			}
+		#endif
+	}
+
+	void gdispGSetClip(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		MUTEX_ENTER(g);
+		g->p.x = x;
+		g->p.y = y;
+		g->p.cx = cx;
+		g->p.cy = cy;
+		setclip(g);
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_CLIPREGION
+	void gdispGSetClipRegion(GDisplay *g, const gdispRegion *rgn) {
+		MUTEX_ENTER(g);
+		g->p.x = rgn->bounds.x0;
+		g->p.y = rgn->bounds.y0;
+		g->p.cx = rgn->bounds.x1 - rgn->bounds.x0;
+		g->p.cy = rgn->bounds.y1 - rgn->bounds.y0;
+		setclip(g);
+
+		// A single rectangle is just the clip area. Hardware clipping can only use the bounding box.
+		#if GDISP_HARDWARE_CLIP != GFXON
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			g->clipregion = rgn->cnt > 1 ? rgn : 0;
+		#endif
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_VIEWS
+	// viewsetarea(v)
+	// Parameters:	x,y cx,cy
+	// Alters:		nothing
+	// Sets the area of a view (clipped to the display) and resets the clipping area to it.
+	// The size and orientation of the display are picked up again in case they have changed.
+	static void viewsetarea(GDisplay *v) {
+		MUTEX_ENTER(v->parent);
+		v->g = v->parent->g;
+		MUTEX_EXIT(v->parent);
+
+		v->viewx0 = v->p.x < 0 ? 0 : v->p.x;
+		v->viewy0 = v->p.y < 0 ? 0 : v->p.y;
+		v->viewx1 = v->p.x + v->p.cx > v->g.Width ? v->g.Width : v->p.x + v->p.cx;
+		v->viewy1 = v->p.y + v->p.cy > v->g.Height ? v->g.Height : v->p.y + v->p.cy;
+		if (v->viewx1 < v->viewx0)	v->viewx1 = v->viewx0;
+		if (v->viewy1 < v->viewy0)	v->viewy1 = v->viewy0;
+		setclip(v);
+	}
+
+	GDisplay *gdispGViewCreate(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		GDisplay	*v;
+
+		// A view of a view is a view of the same display
+		if (g->parent)
+			g = g->parent;
+
+		// The driver must be able to draw on separate areas at the same time
+		if (!(gvmt(g)->d.flags & GDISP_VFLG_CONCURRENT))
+			return 0;
+		if (!(v = gfxAlloc(sizeof(GDisplay))))
+			return 0;
+
+		// Share the driver and its pixels with the display. viewsetarea() copies its size and orientation.
+		MUTEX_ENTER(g);
+		v->d.driverchain = 0;
+		v->d.vmt = g->d.vmt;
+		v->priv = g->priv;
+		v->board = g->board;
+		v->systemdisplay = g->systemdisplay;
+		v->controllerdisplay = g->controllerdisplay;
+		MUTEX_EXIT(g);
+
+		// Everything else belongs to the view
+		v->parent = g;
+		v->flags = 0;
+		#if NEED_CLIPREGION
+			v->clipregion = 0;
+		#endif
+		#if GDISP_NEED_PAINT
+			v->paint = 0;
+		#endif
+		#if GDISP_NEED_DIRTYRECTS
+			v->dirtycnt = 0;
+			dirtyreset(v);
+		#endif
+		#if GDISP_NEED_ASYNC
+			// Views never use the driver's background operations
+			v->asyncflush.busy = v->asyncblit.busy = gFalse;
+		#endif
+		MUTEX_INIT(v);
+		#if GDISP_NEED_STATS
+			v->stats.depth = 0;
+			gdispGGetStats(v, 0, gTrue);
+		#endif
+
+		v->p.x = x;
+		v->p.y = y;
+		v->p.cx = cx;
+		v->p.cy = cy;
+		viewsetarea(v);
+		return v;
+	}
+
+	void gdispViewSetArea(GDisplay *v, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		if (!v->parent)
+			return;
+		MUTEX_ENTER(v);
+		viewpublish(v);
+		v->p.x = x;
+		v->p.y = y;
+		v->p.cx = cx;
+		v->p.cy = cy;
+		viewsetarea(v);
+		MUTEX_EXIT(v);
+	}
+
+	void gdispViewDelete(GDisplay *v) {
+		if (!v->parent)
+			return;
+		MUTEX_ENTER(v);
+		viewpublish(v);
+		MUTEX_EXIT(v);
+		MUTEX_DEINIT(v);
+		gfxFree(v);
+	}
+
+	GDisplay *gdispViewGetDisplay(GDisplay *v) {
+		return v->parent;
+	}
+#endif
+
+#if GDISP_NEED_CIRCLE
+	void gdispGDrawCircle(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
+		gCoord a, b, P;
+
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatCircle);
+
+		// Calculate intermediates
+		a = 1;
+		b = radius;
+		P = 4 - radius;
+		g->p.color = color;
 
 		// Away we go using Bresenham's circle algorithm
 		// Optimized to prevent double drawing
@@ -1308,6 +3328,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		g->p.x = x - a; g->p.y = y - b; drawpixel_clip(g);
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -1317,6 +3338,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gCoord a, b, P;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatCircle);
 
 		// Calculate intermediates
 		a = 1;
@@ -1344,6 +3366,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		g->p.y = y-a; g->p.x = x-b; g->p.x1 = x+b; hline_clip(g);
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -1361,6 +3384,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gCoord a, b1, b2, p1, p2;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatCircle);
 
 		// Do the combined circle where the inner circle < 45 deg (and outer circle)
 		g->p.color = color1;
@@ -1419,6 +3443,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		} while(b1 > radius2 && a < b1);
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 	#undef DRAW_DUALLINE
@@ -1432,6 +3457,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gI32	err, e2;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatEllipse);
 
 		// Calculate intermediates
 		dx = 0;
@@ -1460,6 +3486,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		} while(dy >= 0);
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -1471,6 +3498,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gI32	err, e2;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatEllipse);
 
 		// Calculate intermediates
 		dx = 0;
@@ -1497,6 +3525,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		} while(dy >= 0);
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -1506,6 +3535,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gCoord a, b, P;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatArc);
 
 		// Calculate intermediates
 		a = 1;              // x in many explanations
@@ -1541,6 +3571,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		if (sectors & 0x0C) { g->p.x = x - a; g->p.y = y - b; drawpixel_clip(g); }			// Upper left
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -1550,6 +3581,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gCoord a, b, P;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatArc);
 
 		// Calculate intermediates
 		a = 1;              // x in many explanations
@@ -1722,6 +3754,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		else if (sectors & 0x10)	{ g->p.y = y + a; g->p.x = x - a; drawpixel_clip(g); }
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -1759,6 +3792,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		tbit = start%45 == 0 ? sbit : 0;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatArc);
 		g->p.color = color;
 
 		if (full) {
@@ -1791,6 +3825,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 			if (full & 0x30) { g->p.x = x-a; g->p.y = y+b; drawpixel_clip(g); }
 			if (full == 0xFF) {
 				autoflush(g);
+				STAT_END(g);
 				MUTEX_EXIT(g);
 				return;
 			}
@@ -1908,6 +3943,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		}
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -1965,6 +4001,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		#endif
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatArc);
 		g->p.color = color;
 
 		//Draw concentric circles using Andres algorithm
@@ -2027,6 +4064,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		}
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -2039,6 +4077,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gU8	qtr;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatArc);
 
 		// We add a half pixel so that we are drawing from the centre of the pixel
 		//	instead of the left edge of the pixel. This also fixes the implied floor()
@@ -2529,6 +4568,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		}
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -2540,6 +4580,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 			return;
 		}
 
+		STAT_BEGIN(g, gdispStatRoundedBox);
 		#if GDISP_NEED_ARCSECTORS
 			gdispGDrawArcSectors(g, x+radius, y+radius, radius, 0x0C, color);
 			gdispGDrawArcSectors(g, x+cx-1-radius, y+radius, radius, 0x03, color);
@@ -2555,6 +4596,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gdispGDrawLine(g, x+cx-1, y+radius+1, x+cx-1, y+cy-2-radius, color);
 		gdispGDrawLine(g, x+radius+1, y+cy-1, x+cx-2-radius, y+cy-1, color);
 		gdispGDrawLine(g, x, y+radius+1, x, y+cy-2-radius, color);
+		STAT_END(g);
 	}
 #endif
 
@@ -2567,6 +4609,8 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 			gdispGFillArea(g, x, y, cx, cy, color);
 			return;
 		}
+
+		STAT_BEGIN(g, gdispStatRoundedBox);
 		#if GDISP_NEED_ARCSECTORS
 			gdispGFillArcSectors(g, x+radius, y+radius, radius, 0x0C, color);
 			gdispGFillArcSectors(g, x+cx-1-radius, y+radius, radius, 0x03, color);
@@ -2581,6 +4625,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gdispGFillArea(g, x+radius+1, y, cx-radius2, radius, color);
 		gdispGFillArea(g, x+radius+1, y+cy-radius, cx-radius2, radius, color);
 		gdispGFillArea(g, x, y+radius, cx, cy-radius2, color);
+		STAT_END(g);
 	}
 #endif
 
@@ -2590,6 +4635,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 
 		/* Always synchronous as it must return a value */
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatGetPixel);
 		#if GDISP_HARDWARE_PIXELREAD
 			#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
 				if (gvmt(g)->get)
@@ -2599,6 +4645,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				g->p.x = x;
 				g->p.y = y;
 				c = gdisp_lld_get_pixel_color(g);
+				STAT_END(g);
 				MUTEX_EXIT(g);
 				return c;
 			}
@@ -2616,6 +4663,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				gdisp_lld_read_start(g);
 				c = gdisp_lld_read_color(g);
 				gdisp_lld_read_stop(g);
+				STAT_END(g);
 				MUTEX_EXIT(g);
 				return c;
 			}
@@ -2625,22 +4673,173 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				// Worst is "not possible"
 				#error "GDISP: GDISP_NEED_PIXELREAD has been set but there is no hardware support for reading the display"
 			#endif
+			STAT_END(g);
 			MUTEX_EXIT(g);
 			return 0;
 		#endif
 	}
 #endif
 
+#if GDISP_LINEBUF_SIZE != 0 && ((GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL != GFXON) || (GDISP_NEED_COPYAREA && GDISP_HARDWARE_COPY != GFXON))
+	// readline(g, x, y, cnt)
+	// Alters:		x,y cx,cy
+	// Reads cnt (<= GDISP_LINEBUF_SIZE) pixels starting at x,y into the line buffer.
+	// Returns gFalse if the display can't be read.
+	static gBool readline(GDisplay *g, gCoord x, gCoord y, gCoord cnt) {
+		// Best line read is hardware streaming
+		#if GDISP_HARDWARE_STREAM_READ
+			#if GDISP_HARDWARE_STREAM_READ == HARDWARE_AUTODETECT
+				if (gvmt(g)->readstart)
+			#endif
+			{
+				gCoord	j;
+
+				g->p.x = x;
+				g->p.y = y;
+				g->p.cx = cnt;
+				g->p.cy = 1;
+				gdisp_lld_read_start(g);
+				for(j=0; j < cnt; j++)
+					g->linebuf[j] = gdisp_lld_read_color(g);
+				gdisp_lld_read_stop(g);
+				return gTrue;
+			}
+		#endif
+
+		// Next best line read is single pixel reads
+		#if GDISP_HARDWARE_STREAM_READ != GFXON && GDISP_HARDWARE_PIXELREAD
+			#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
+				if (gvmt(g)->get)
+			#endif
+			{
+				gCoord	j;
+
+				g->p.y = y;
+				for(j=0; j < cnt; j++) {
+					g->p.x = x+j;
+					g->linebuf[j] = gdisp_lld_get_pixel_color(g);
+				}
+				return gTrue;
+			}
+		#endif
+
+		// Worst is "not possible"
+		return gFalse;
+	}
+
+	// writeline(g, x, y, cnt)
+	// Alters:		x,y cx,cy x1,y1 x2 ptr color
+	// Writes cnt (<= GDISP_LINEBUF_SIZE) pixels from the line buffer starting at x,y.
+	static void writeline(GDisplay *g, gCoord x, gCoord y, gCoord cnt) {
+		// Best line write is hardware bitfills
+		#if GDISP_HARDWARE_BITFILLS
+			#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
+				if (gvmt(g)->blit)
+			#endif
+			{
+				g->p.x = x;
+				g->p.y = y;
+				g->p.cx = cnt;
+				g->p.cy = 1;
+				g->p.x1 = 0;
+				g->p.y1 = 0;
+				g->p.x2 = cnt;
+				g->p.ptr = (void *)g->linebuf;
+				gdisp_lld_blit_area(g);
+				return;
+			}
+		#endif
+
+		// Next best line write is hardware streaming
+		#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE
+			#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
+				if (gvmt(g)->writestart)
+			#endif
+			{
+				gCoord	j;
+
+				g->p.x = x;
+				g->p.y = y;
+				g->p.cx = cnt;
+				g->p.cy = 1;
+				gdisp_lld_write_start(g);
+				#if GDISP_HARDWARE_STREAM_POS
+					#if GDISP_HARDWARE_STREAM_POS == HARDWARE_AUTODETECT
+						if (gvmt(g)->writepos)
+					#endif
+					gdisp_lld_write_pos(g);
+				#endif
+				for(j = 0; j < cnt; j++) {
+					g->p.color = g->linebuf[j];
+					gdisp_lld_write_color(g);
+				}
+				gdisp_lld_write_stop(g);
+				return;
+			}
+		#endif
+
+		// Next best line write is drawing pixels in combination with filling
+		#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS && GDISP_HARDWARE_DRAWPIXEL
+			// We don't need to test for auto-detect on drawpixel as we know we have it because we don't have streaming.
+			#if GDISP_HARDWARE_FILLS == HARDWARE_AUTODETECT
+				if (gvmt(g)->fill)
+			#endif
+			{
+				gCoord	j;
+
+				g->p.y = y;
+				g->p.cy = 1;
+				g->p.x = x;
+				g->p.cx = 1;
+				for(j = 0; j < cnt; ) {
+					g->p.color = g->linebuf[j];
+					if (j + g->p.cx < cnt && g->linebuf[j] == g->linebuf[j + g->p.cx])
+						g->p.cx++;
+					else if (g->p.cx == 1) {
+						gdisp_lld_draw_pixel(g);
+						j++;
+						g->p.x++;
+					} else {
+						gdisp_lld_fill_area(g);
+						j += g->p.cx;
+						g->p.x += g->p.cx;
+						g->p.cx = 1;
+					}
+				}
+				return;
+			}
+		#endif
+
+		// Worst line write is drawing pixels
+		#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS != GFXON && GDISP_HARDWARE_DRAWPIXEL
+			// The following test is unneeded because we are guaranteed to have draw pixel if we don't have streaming
+			//#if GDISP_HARDWARE_DRAWPIXEL == HARDWARE_AUTODETECT
+			//	if (gvmt(g)->pixel)
+			//#endif
+			{
+				gCoord	j;
+
+				g->p.y = y;
+				for(g->p.x = x, j = 0; j < cnt; g->p.x++, j++) {
+					g->p.color = g->linebuf[j];
+					gdisp_lld_draw_pixel(g);
+				}
+			}
+		#endif
+	}
+#endif
+
 #if GDISP_NEED_SCROLL
 	void gdispGVerticalScroll(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, int lines, gColor bgcolor) {
 		gCoord		abslines;
 		#if GDISP_HARDWARE_SCROLL != GFXON
-			gCoord 	fy, dy, ix, fx, i, j;
+			gCoord 	fy, dy, ix, fx, i;
 		#endif
 
 		if (!lines) return;
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatScroll);
 		#if NEED_CLIPPING
 			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
 				if (!gvmt(g)->setclip)
@@ -2648,11 +4847,12 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 			{
 				if (x < g->clipx0) { cx -= g->clipx0 - x; x = g->clipx0; }
 				if (y < g->clipy0) { cy -= g->clipy0 - y; y = g->clipy0; }
-				if (cx <= 0 || cy <= 0 || x >= g->clipx1 || y >= g->clipy1) { MUTEX_EXIT(g); return; }
+				if (cx <= 0 || cy <= 0 || x >= g->clipx1 || y >= g->clipy1) { STAT_END(g); MUTEX_EXIT(g); return; }
 				if (x+cx > g->clipx1)	cx = g->clipx1 - x;
 				if (y+cy > g->clipy1)	cy = g->clipy1 - y;
 			}
 		#endif
+		dirtyop(g, x, y, cx, cy);
 
 		abslines = lines < 0 ? -lines : lines;
 		if (abslines >= cy) {
@@ -2683,10 +4883,13 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 
 			// Scroll Emulation
 			#if GDISP_HARDWARE_SCROLL != GFXON
+				#if !GDISP_HARDWARE_STREAM_READ && !GDISP_HARDWARE_PIXELREAD
+					#error "GDISP: GDISP_NEED_SCROLL is set but there is no hardware support for scrolling or reading pixels."
+				#endif
 				{
 					cy -= abslines;
 					if (lines < 0) {
-						fy = y+cy-1;
+						fy = y+cy+abslines-1;
 						dy = -1;
 					} else {
 						fy = y;
@@ -2703,148 +4906,14 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 							if (fx > GDISP_LINEBUF_SIZE)
 								fx = GDISP_LINEBUF_SIZE;
 
-							// Read one line of data from the screen
-
-							// Best line read is hardware streaming
-							#if GDISP_HARDWARE_STREAM_READ
-								#if GDISP_HARDWARE_STREAM_READ == HARDWARE_AUTODETECT
-									if (gvmt(g)->readstart)
-								#endif
-								{
-									g->p.x = x+ix;
-									g->p.y = fy+lines;
-									g->p.cx = fx;
-									g->p.cy = 1;
-									gdisp_lld_read_start(g);
-									for(j=0; j < fx; j++)
-										g->linebuf[j] = gdisp_lld_read_color(g);
-									gdisp_lld_read_stop(g);
-								}
-								#if GDISP_HARDWARE_STREAM_READ == HARDWARE_AUTODETECT
-									else
-								#endif
-							#endif
-
-							// Next best line read is single pixel reads
-							#if GDISP_HARDWARE_STREAM_READ != GFXON && GDISP_HARDWARE_PIXELREAD
-								#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
-									if (gvmt(g)->get)
-								#endif
-								{
-									for(j=0; j < fx; j++) {
-										g->p.x = x+ix+j;
-										g->p.y = fy+lines;
-										g->linebuf[j] = gdisp_lld_get_pixel_color(g);
-									}
-								}
-								#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
-									else {
-										// Worst is "not possible"
-										MUTEX_EXIT(g);
-										return;
-									}
-								#endif
-							#endif
-
-							// Worst is "not possible"
-							#if !GDISP_HARDWARE_STREAM_READ && !GDISP_HARDWARE_PIXELREAD
-								#error "GDISP: GDISP_NEED_SCROLL is set but there is no hardware support for scrolling or reading pixels."
-							#endif
-
-							// Write that line to the new location
-
-							// Best line write is hardware bitfills
-							#if GDISP_HARDWARE_BITFILLS
-								#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
-									if (gvmt(g)->blit)
-								#endif
-								{
-									g->p.x = x+ix;
-									g->p.y = fy;
-									g->p.cx = fx;
-									g->p.cy = 1;
-									g->p.x1 = 0;
-									g->p.y1 = 0;
-									g->p.x2 = fx;
-									g->p.ptr = (void *)g->linebuf;
-									gdisp_lld_blit_area(g);
-								}
-								#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
-									else
-								#endif
-							#endif
-
-							// Next best line write is hardware streaming
-							#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE
-								#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
-									if (gvmt(g)->writestart)
-								#endif
-								{
-									g->p.x = x+ix;
-									g->p.y = fy;
-									g->p.cx = fx;
-									g->p.cy = 1;
-									gdisp_lld_write_start(g);
-									#if GDISP_HARDWARE_STREAM_POS
-										gdisp_lld_write_pos(g);
-									#endif
-									for(j = 0; j < fx; j++) {
-										g->p.color = g->linebuf[j];
-										gdisp_lld_write_color(g);
-									}
-									gdisp_lld_write_stop(g);
-								}
-								#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
-									else
-								#endif
-							#endif
-
-							// Next best line write is drawing pixels in combination with filling
-							#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS && GDISP_HARDWARE_DRAWPIXEL
-								// We don't need to test for auto-detect on drawpixel as we know we have it because we don't have streaming.
-								#if GDISP_HARDWARE_FILLS == HARDWARE_AUTODETECT
-									if (gvmt(g)->fill)
-								#endif
-								{
-									g->p.y = fy;
-									g->p.cy = 1;
-									g->p.x = x+ix;
-									g->p.cx = 1;
-									for(j = 0; j < fx; ) {
-										g->p.color = g->linebuf[j];
-										if (j + g->p.cx < fx && g->linebuf[j] == g->linebuf[j + g->p.cx])
-											g->p.cx++;
-										else if (g->p.cx == 1) {
-											gdisp_lld_draw_pixel(g);
-											j++;
-											g->p.x++;
-										} else {
-											gdisp_lld_fill_area(g);
-											j += g->p.cx;
-											g->p.x += g->p.cx;
-											g->p.cx = 1;
-										}
-									}
-								}
-								#if GDISP_HARDWARE_FILLS == HARDWARE_AUTODETECT
-									else
-								#endif
-							#endif
-
-							// Worst line write is drawing pixels
-							#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS != GFXON && GDISP_HARDWARE_DRAWPIXEL
-								// The following test is unneeded because we are guaranteed to have draw pixel if we don't have streaming
-								//#if GDISP_HARDWARE_DRAWPIXEL == HARDWARE_AUTODETECT
-								//	if (gvmt(g)->pixel)
-								//#endif
-								{
-									g->p.y = fy;
-									for(g->p.x = x+ix, j = 0; j < fx; g->p.x++, j++) {
-										g->p.color = g->linebuf[j];
-										gdisp_lld_draw_pixel(g);
-									}
-								}
-							#endif
+							// Read one line of data from the screen and write it to the new location
+							if (!readline(g, x+ix, fy+lines, fx)) {
+								// Worst is "not possible"
+								STAT_END(g);
+								MUTEX_EXIT(g);
+								return;
+							}
+							writeline(g, x+ix, fy, fx);
 						}
 					}
 				}
@@ -2859,6 +4928,100 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		g->p.color = bgcolor;
 		fillarea(g);
 		autoflush_stopdone(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_COPYAREA
+	void gdispGCopyArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord dx, gCoord dy) {
+		#if GDISP_HARDWARE_COPY != GFXON
+			gCoord	i, ix, iy, fx, fy, stepy;
+		#endif
+
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatCopy);
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				// The source must be on the display
+				if (x < 0) { cx += x; dx -= x; x = 0; }
+				if (y < 0) { cy += y; dy -= y; y = 0; }
+				if (x+cx > g->g.Width)	cx = g->g.Width - x;
+				if (y+cy > g->g.Height)	cy = g->g.Height - y;
+
+				// The destination must be inside the clip area
+				if (dx < g->clipx0) { cx -= g->clipx0 - dx; x += g->clipx0 - dx; dx = g->clipx0; }
+				if (dy < g->clipy0) { cy -= g->clipy0 - dy; y += g->clipy0 - dy; dy = g->clipy0; }
+				if (dx+cx > g->clipx1)	cx = g->clipx1 - dx;
+				if (dy+cy > g->clipy1)	cy = g->clipy1 - dy;
+			}
+		#endif
+		if (cx <= 0 || cy <= 0 || (x == dx && y == dy)) {
+			STAT_END(g);
+			MUTEX_EXIT(g);
+			return;
+		}
+		dirtyop(g, dx, dy, cx, cy);
+
+		// Best is hardware copy
+		#if GDISP_HARDWARE_COPY
+			#if GDISP_HARDWARE_COPY == HARDWARE_AUTODETECT
+				if (gvmt(g)->copy)
+			#endif
+			{
+				g->p.x = dx;
+				g->p.y = dy;
+				g->p.cx = cx;
+				g->p.cy = cy;
+				g->p.x1 = x;
+				g->p.y1 = y;
+				gdisp_lld_copy_area(g);
+			}
+			#if GDISP_HARDWARE_COPY == HARDWARE_AUTODETECT
+				else
+			#endif
+		#elif GDISP_LINEBUF_SIZE == 0
+			#error "GDISP: GDISP_NEED_COPYAREA is set but there is no hardware support and GDISP_LINEBUF_SIZE is zero."
+		#endif
+
+		// Copy Emulation
+		#if GDISP_HARDWARE_COPY != GFXON
+			#if !GDISP_HARDWARE_STREAM_READ && !GDISP_HARDWARE_PIXELREAD
+				#error "GDISP: GDISP_NEED_COPYAREA is set but there is no hardware support for copying or reading pixels."
+			#endif
+			{
+				// Copy a line buffer at a time in an order that never overwrites source pixels before they are read.
+				//	Moving down copies the bottom line first and moving right copies the right end of each line first.
+				if (dy > y) {
+					iy = cy-1;
+					stepy = -1;
+				} else {
+					iy = 0;
+					stepy = 1;
+				}
+				for(fy = 0; fy < cy; fy++, iy += stepy) {
+					for(i = 0; i < cx; i += fx) {
+						fx = cx - i;
+						if (fx > GDISP_LINEBUF_SIZE)
+							fx = GDISP_LINEBUF_SIZE;
+						ix = dx > x ? cx - i - fx : i;
+						if (!readline(g, x+ix, y+iy, fx)) {
+							// Worst is "not possible"
+							STAT_END(g);
+							MUTEX_EXIT(g);
+							return;
+						}
+						writeline(g, dx+ix, dy+iy, fx);
+					}
+				}
+			}
+		#endif
+
+		autoflush_stopdone(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 #endif
@@ -2870,6 +5033,11 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				if (!gvmt(g)->control)
 					return;
 			#endif
+			#if GDISP_NEED_VIEWS
+				// The driver settings belong to the display not its views
+				if (g->parent)
+					return;
+			#endif
 			MUTEX_ENTER(g);
 			g->p.x = what;
 			g->p.ptr = value;
@@ -2886,6 +5054,14 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				}
 			}
 			gdisp_lld_control(g);
+			#if GDISP_NEED_DIRTYRECTS
+				// Any dirty areas are in the old orientation
+				if (what == GDISP_CONTROL_ORIENTATION && g->dirtycnt) {
+					g->dirtycnt = 0;
+					dirtyop(g, 0, 0, g->g.Width, g->g.Height);
+					dirtycommit(g);
+				}
+			#endif
 			#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
 				if (what == GDISP_CONTROL_ORIENTATION) {
 					// Best is hardware clipping
@@ -2912,6 +5088,9 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 							g->clipy0 = 0;
 							g->clipx1 = g->g.Width;
 							g->clipy1 = g->g.Height;
+							#if GDISP_NEED_CLIPREGION
+								g->clipregion = 0;
+							#endif
 						}
 					#endif
 				}
@@ -2955,14 +5134,13 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 /* High Level Driver Routines.                                               */
 /*===========================================================================*/
 
-void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
+// drawbox(g, x, y, cx, cy)
+// Parameters:	color
+// Alters:		x,y x1,y1
+static void drawbox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
 	if (cx <= 0 || cy <= 0) return;
 	cx = x+cx-1; cy = y+cy-1;			// cx, cy are now the end point.
 
-	MUTEX_ENTER(g);
-
-	g->p.color = color;
-
 	if (cx - x >= 2) {
 		g->p.x = x; g->p.y = y; g->p.x1 = cx; hline_clip(g);
 		if (y != cy) {
@@ -2979,8 +5157,17 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			g->p.x = cx; g->p.y = y; g->p.y1 = cy; vline_clip(g);
 		}
 	}
+}
+
+void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
+	if (cx <= 0 || cy <= 0) return;
 
+	MUTEX_ENTER(g);
+	STAT_BEGIN(g, gdispStatBox);
+	g->p.color = color;
+	drawbox(g, x, y, cx, cy);
 	autoflush(g);
+	STAT_END(g);
 	MUTEX_EXIT(g);
 }
 
@@ -2991,6 +5178,7 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		epnt = &pntarray[cnt-1];
 
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatPoly);
 		g->p.color = color;
 		for(p = pntarray; p < epnt; p++) {
 			g->p.x=tx+p->x; g->p.y=ty+p->y; g->p.x1=tx+p[1].x; g->p.y1=ty+p[1].y; line_clip(g);
@@ -2998,10 +5186,14 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		g->p.x=tx+p->x; g->p.y=ty+p->y; g->p.x1=tx+pntarray->x; g->p.y1=ty+pntarray->y; line_clip(g);
 
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 
-	void gdispGFillConvexPoly(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color) {
+	// fillconvexpoly(g, tx, ty, pntarray, cnt)
+	// Parameters:	color
+	// Alters:		x,y x1,y1 cx,cy
+	static void fillconvexpoly(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt) {
 		const gPoint	*lpnt, *rpnt, *epnts;
 		fixed		lx, rx, lk, rk;
 		gCoord		y, ymax, lxc, rxc;
@@ -3036,8 +5228,6 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		rx += FIXED0_5;
 
 		// Do all the line segments
-		MUTEX_ENTER(g);
-		g->p.color = color;
 		while(1) {
 			/* Determine our boundary */
 			ymax = rpnt->y < lpnt->y ? rpnt->y : lpnt->y;
@@ -3061,22 +5251,16 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 				rx += rk;
 			}
 
-			if (!cnt) {
-				autoflush(g);
-				MUTEX_EXIT(g);
+			if (!cnt)
 				return;
-			}
 			cnt--;
 
 			/* Replace the appropriate point */
 			if (ymax == lpnt->y) {
 				lx -= FIXED0_5;
 				for (lpnt = lpnt <= pntarray ? epnts : lpnt-1; lpnt->y == y; cnt--) {
-					if (!cnt) {
-						autoflush(g);
-						MUTEX_EXIT(g);
+					if (!cnt)
 						return;
-					}
 					lx = FIXED(lpnt->x);
 					lpnt = lpnt <= pntarray ? epnts : lpnt-1;
 				}
@@ -3085,11 +5269,8 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			} else {
 				rx -= FIXED0_5;
 				for (rpnt = rpnt >= epnts ? pntarray : rpnt+1; rpnt->y == y; cnt--) {
-					if (!cnt) {
-						autoflush(g);
-						MUTEX_EXIT(g);
+					if (!cnt)
 						return;
-					}
 					rx = FIXED(rpnt->x);
 					rpnt = rpnt >= epnts ? pntarray : rpnt+1;
 				}
@@ -3099,6 +5280,16 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		}
 	}
 
+	void gdispGFillConvexPoly(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color) {
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatPoly);
+		g->p.color = color;
+		fillconvexpoly(g, tx, ty, pntarray, cnt);
+		autoflush(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
 	static gI32 rounding_div(const gI32 n, const gI32 d)
 	{
 		if ((n < 0) != (d < 0))
@@ -3252,7 +5443,660 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 
 			gdispGFillConvexPoly(g, x0, y0, pntarray, 8, color);
 		}
-	}
+	}
+#endif
+
+#if GDISP_NEED_PAINT
+	void gdispPaintSetLinear(gdispPaint *paint, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color0, gColor color1) {
+		gI64	vx, vy, len2;
+
+		paint->type = gdispPaintLinear;
+		paint->x = x0;
+		paint->y = y0;
+		paint->rgb0 = PIXEL2RGB(color0);
+		paint->rgb1 = PIXEL2RGB(color1);
+
+		// The change in the position along the gradient for each pixel in x and y (rounded)
+		vx = (gI64)x1 - x0;
+		vy = (gI64)y1 - y0;
+		len2 = vx*vx + vy*vy;
+		if (!len2) {
+			paint->kx = paint->ky = 0;
+			return;
+		}
+		paint->kx = (gI32)((vx * PAINT_ONE + (vx < 0 ? -len2/2 : len2/2)) / len2);
+		paint->ky = (gI32)((vy * PAINT_ONE + (vy < 0 ? -len2/2 : len2/2)) / len2);
+	}
+
+	void gdispPaintSetRadial(gdispPaint *paint, gCoord x, gCoord y, gCoord radius, gColor color0, gColor color1) {
+		paint->type = gdispPaintRadial;
+		paint->x = x;
+		paint->y = y;
+		paint->rgb0 = PIXEL2RGB(color0);
+		paint->rgb1 = PIXEL2RGB(color1);
+		if (radius < 1)
+			radius = 1;
+		paint->radius = radius;
+		paint->rk = 0xFFFFFFFF / ((gU32)radius * radius);
+	}
+
+	void gdispPaintSetPattern(gdispPaint *paint, gCoord x, gCoord y, gCoord cx, gCoord cy, const gPixel *bits) {
+		paint->type = gdispPaintPattern;
+		paint->x = x;
+		paint->y = y;
+		paint->cx = cx;
+		paint->cy = cy;
+		paint->bits = bits;
+	}
+
+	// fillroundedbox(g, x, y, cx, cy, radius)
+	// Alters:		x,y x1,y1 cx,cy
+	// The corners are drawn using Bresenham's circle algorithm in the same way as gdispGFillCircle()
+	//	so that a box with the same width and height as the circle fills the same pixels.
+	#define ROUNDEDLINE(dy, dx)																				\
+		if (dy <= radius) {																					\
+			g->p.y = yt-(dy); g->p.x = xl-(dx); g->p.x1 = xr+(dx); hline_clip(g);							\
+			if (yb+(dy) != yt-(dy)) { g->p.y = yb+(dy); g->p.x = xl-(dx); g->p.x1 = xr+(dx); hline_clip(g); }	\
+		}
+	static void fillroundedbox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord radius) {
+		gCoord	xl, xr, yt, yb, a, b, P;
+
+		if (cx <= 0 || cy <= 0)
+			return;
+		if (radius*2 >= cx)		radius = (cx-1)/2;
+		if (radius*2 >= cy)		radius = (cy-1)/2;
+		if (radius < 0)			radius = 0;
+		xl = x+radius;
+		xr = x+cx-1-radius;
+		yt = y+radius;
+		yb = y+cy-1-radius;
+
+		// The middle
+		for(a = yt+1; a < yb; a++) {
+			g->p.y = a; g->p.x = x; g->p.x1 = x+cx-1; hline_clip(g);
+		}
+
+		// The corners
+		ROUNDEDLINE(0, radius);
+		if (radius) {
+			ROUNDEDLINE(radius, 0);
+			a = 1;
+			b = radius;
+			P = 4 - radius;
+			do {
+				ROUNDEDLINE(a, b);
+				if (P < 0) {
+					P += 3 + 2*a++;
+				} else {
+					ROUNDEDLINE(b, a);
+					P += 5 + 2*(a++ - b--);
+				}
+			} while(a < b);
+			ROUNDEDLINE(a, b);
+		}
+	}
+	#undef ROUNDEDLINE
+
+	void gdispGFillAreaPaint(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const gdispPaint *paint) {
+		gCoord	j;
+
+		if (cx <= 0 || cy <= 0)
+			return;
+
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatFill);
+		g->paint = paint;
+		for(j = y; j < y+cy; j++) {
+			g->p.y = j; g->p.x = x; g->p.x1 = x+cx-1; hline_clip(g);
+		}
+		g->paint = 0;
+		autoflush(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
+	void gdispGFillCirclePaint(GDisplay *g, gCoord x, gCoord y, gCoord radius, const gdispPaint *paint) {
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatCircle);
+		g->paint = paint;
+		fillroundedbox(g, x-radius, y-radius, radius*2+1, radius*2+1, radius);
+		g->paint = 0;
+		autoflush(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
+	void gdispGFillRoundedBoxPaint(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord radius, const gdispPaint *paint) {
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatRoundedBox);
+		g->paint = paint;
+		fillroundedbox(g, x, y, cx, cy, radius);
+		g->paint = 0;
+		autoflush(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
+	#if GDISP_NEED_CONVEX_POLYGON
+		void gdispGFillConvexPolyPaint(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, const gdispPaint *paint) {
+			MUTEX_ENTER(g);
+			STAT_BEGIN(g, gdispStatPoly);
+			g->paint = paint;
+			fillconvexpoly(g, tx, ty, pntarray, cnt);
+			g->paint = 0;
+			autoflush(g);
+			STAT_END(g);
+			MUTEX_EXIT(g);
+		}
+	#endif
+#endif
+
+#if GDISP_NEED_POLYGON
+	// The number of sample lines per pixel row when anti-aliasing
+	#define POLY_AA_SUBLINES	4
+
+	// A polygon edge. Y values are in sample lines.
+	typedef struct polyEdge {
+		gI32		ystart;			// The first sample line the edge is on
+		gI32		yend;			// The sample line after the last one the edge is on
+		fixed		x;				// The x position on the current sample line
+		fixed		dx;				// The change in x for each sample line
+		int			dir;			// +1 if the edge goes down, -1 if it goes up
+	} polyEdge;
+
+	// polycover(cov, cx0, cx1, xl, xr)
+	// Add the coverage of one sample line span to the coverage differences of a pixel row.
+	// cov[0] is for pixel cx0. A whole pixel adds 256.
+	static void polycover(gI32 *cov, gCoord cx0, gCoord cx1, fixed xl, fixed xr) {
+		gCoord	il, ir;
+		gI32	c;
+
+		if (xl < FIXED(cx0))	xl = FIXED(cx0);
+		if (xr > FIXED(cx1))	xr = FIXED(cx1);
+		if (xl >= xr)
+			return;
+		il = NONFIXED(xl);
+		ir = NONFIXED(xr);
+		if (il == ir) {
+			c = (xr - xl) >> 8;
+			cov[il-cx0] += c;
+			cov[il-cx0+1] -= c;
+			return;
+		}
+		c = (FIXED(il+1) - xl) >> 8;
+		cov[il-cx0] += c;
+		cov[il-cx0+1] += 256 - c;
+		c = (xr - FIXED(ir)) >> 8;
+		cov[ir-cx0] += c - 256;
+		cov[ir-cx0+1] -= c;
+	}
+
+	void gdispGFillPoly(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color, gPolyFill mode) {
+		const gPoint	*a, *b, *p;
+		polyEdge		*edges, **aet, *e;
+		gI32			*cov;
+		unsigned		nedges, nactive, next, i, j;
+		gI32			n, nfirst, nlast;
+		int				sub, wind;
+		fixed			xl;
+		gCoord			cx0, cy0, cx1, cy1, rx0, rx1, x;
+
+		if (cnt < 3)
+			return;
+
+		// Anti-aliasing needs to read back the pixels it blends with
+		#if !(GDISP_NEED_ANTIALIAS && GDISP_HARDWARE_PIXELREAD)
+			mode &= ~gPolyFillAntiAlias;
+		#endif
+		sub = (mode & gPolyFillAntiAlias) ? POLY_AA_SUBLINES : 1;
+
+		// The active edge table goes first to keep its pointers aligned
+		if (!(aet = gfxAlloc(cnt * (sizeof(polyEdge *) + sizeof(polyEdge)))))
+			return;
+		edges = (polyEdge *)(aet + cnt);
+
+		// Build the edge table. Horizontal edges are not needed.
+		cx0 = cx1 = pntarray[0].x;
+		for(nedges = 0, i = 0; i < cnt; i++) {
+			a = &pntarray[i];
+			b = i == cnt-1 ? pntarray : a+1;
+			if (a->x < cx0)		cx0 = a->x;
+			if (a->x > cx1)		cx1 = a->x;
+			if (a->y == b->y)
+				continue;
+			e = &edges[nedges++];
+			if (a->y < b->y) {
+				e->dir = 1;
+			} else {
+				e->dir = -1;
+				p = a; a = b; b = p;				// Make a the top point
+			}
+			e->ystart = (gI32)(a->y + ty) * sub;
+			e->yend = (gI32)(b->y + ty) * sub;
+			e->dx = FIXED(b->x - a->x) / (e->yend - e->ystart);
+
+			// Sample at the top of each pixel row (like gdispGFillConvexPoly) or evenly within it when anti-aliasing
+			if (sub == 1)
+				e->x = FIXED(a->x + tx) + FIXED0_5;
+			else
+				e->x = FIXED(a->x + tx) + e->dx/2;
+		}
+		cx0 += tx;
+		cx1 += tx + 1;
+
+		// Sort the edges by their first sample line
+		for(i = 1; i < nedges; i++) {
+			polyEdge	t;
+
+			t = edges[i];
+			for(j = i; j && edges[j-1].ystart > t.ystart; j--)
+				edges[j] = edges[j-1];
+			edges[j] = t;
+		}
+
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatPoly);
+
+		// Only scan what can be seen
+		cy0 = 0; cy1 = g->g.Height;
+		if (cx0 < 0)				cx0 = 0;
+		if (cx1 > g->g.Width)		cx1 = g->g.Width;
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				cy0 = g->clipy0;
+				cy1 = g->clipy1;
+				if (cx0 < g->clipx0)	cx0 = g->clipx0;
+				if (cx1 > g->clipx1)	cx1 = g->clipx1;
+			}
+		#endif
+		nfirst = nedges ? edges[0].ystart : 0;
+		nlast = 0;
+		for(i = 0; i < nedges; i++) {
+			if (edges[i].yend > nlast)
+				nlast = edges[i].yend;
+		}
+		if (nfirst < (gI32)cy0 * sub)	nfirst = (gI32)cy0 * sub;
+		if (nlast > (gI32)cy1 * sub)	nlast = (gI32)cy1 * sub;
+
+		// The pixel row coverage differences (followed by the row alpha values) when anti-aliasing
+		cov = 0;
+		if (sub > 1 && cx0 < cx1 && nfirst < nlast) {
+			if (!(cov = gfxAlloc((cx1 - cx0 + 2) * sizeof(gI32) + (cx1 - cx0))))
+				nlast = nfirst;
+			else {
+				for(x = 0; x < cx1 - cx0 + 2; x++)
+					cov[x] = 0;
+			}
+		}
+
+		g->p.color = color;
+		rx0 = cx1; rx1 = cx0;
+		for(nactive = 0, next = 0, n = nfirst; n < nlast; n++) {
+			// Add the edges that start on (or above) this sample line
+			for(; next < nedges && edges[next].ystart <= n; next++) {
+				e = &edges[next];
+				if (e->yend <= n)
+					continue;
+				e->x += e->dx * (n - e->ystart);
+				aet[nactive++] = e;
+			}
+
+			// Remove the edges that have finished
+			for(i = j = 0; i < nactive; i++) {
+				if (aet[i]->yend > n)
+					aet[j++] = aet[i];
+			}
+			nactive = j;
+
+			// Sort the active edges by x. They are nearly always in order already.
+			for(i = 1; i < nactive; i++) {
+				e = aet[i];
+				for(j = i; j && aet[j-1]->x > e->x; j--)
+					aet[j] = aet[j-1];
+				aet[j] = e;
+			}
+
+			// Fill between the edges according to the fill rule
+			for(wind = 0, xl = 0, i = 0; i < nactive; i++) {
+				e = aet[i];
+				if (!((mode & gPolyFillNonZero) ? wind : (wind & 1)))
+					xl = e->x;
+				wind += e->dir;
+				if (!((mode & gPolyFillNonZero) ? wind : (wind & 1))) {
+					if (cov) {
+						polycover(cov, cx0, cx1, xl, e->x);
+						if (NONFIXED(xl) < rx0)		rx0 = NONFIXED(xl);
+						if (NONFIXED(e->x) >= rx1)	rx1 = NONFIXED(e->x) + 1;
+					} else if (NONFIXED(xl) < NONFIXED(e->x)) {
+						g->p.x = NONFIXED(xl);
+						g->p.y = n;
+						g->p.x1 = NONFIXED(e->x) - 1;
+						hline_clip(g);
+					}
+				}
+				e->x += e->dx;
+			}
+
+			// Draw an anti-aliased pixel row once all its sample lines are done
+			#if GDISP_NEED_ANTIALIAS && GDISP_HARDWARE_PIXELREAD
+				if (cov && (n % sub == sub-1 || n == nlast-1)) {
+					gU8		*alpha;
+					gI32	sum;
+
+					alpha = (gU8 *)(cov + (cx1 - cx0 + 2));
+					if (rx0 < cx0)	rx0 = cx0;
+					if (rx1 > cx1)	rx1 = cx1;
+					for(sum = 0, x = rx0; x < rx1; x++) {
+						sum += cov[x-cx0];
+						cov[x-cx0] = 0;
+						alpha[x-rx0] = sum >= 256*sub ? 255 : (gU8)((sum * 255) / (256*sub));
+					}
+					if (rx1 > rx0) {
+						cov[rx1-cx0] = 0;
+						cov[rx1-cx0+1] = 0;
+						g->p.x = rx0; g->p.y = n / sub; g->p.cx = rx1 - rx0; g->p.ptr = alpha;
+						blendspan(g);
+					}
+					rx0 = cx1; rx1 = cx0;
+				}
+			#endif
+		}
+
+		autoflush(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+
+		if (cov)
+			gfxFree(cov);
+		gfxFree(aet);
+	}
+#endif
+
+#if GDISP_NEED_ANTIALIAS
+	// An anti-aliased span being built up a pixel at a time
+	typedef struct aaSpan {
+		gCoord		x, y;						// The first pixel
+		gCoord		cnt;						// The number of pixels so far
+		gU8			alpha[BLENDSPAN_PIXELS];	// The alpha for each pixel
+	} aaSpan;
+
+	static void aaspanflush(GDisplay *g, aaSpan *s) {
+		if (s->cnt) {
+			g->p.x = s->x; g->p.y = s->y; g->p.cx = s->cnt; g->p.ptr = s->alpha;
+			blendspan(g);
+			s->cnt = 0;
+		}
+	}
+
+	// Add a pixel to the span. If it doesn't follow on from the span the span is drawn first.
+	static void aaspanadd(GDisplay *g, aaSpan *s, gCoord x, gCoord y, gU8 alpha) {
+		if (s->cnt && (y != s->y || x != s->x + s->cnt || s->cnt >= BLENDSPAN_PIXELS))
+			aaspanflush(g, s);
+		if (!s->cnt) {
+			s->x = x;
+			s->y = y;
+		}
+		s->alpha[s->cnt++] = alpha;
+	}
+
+	void gdispGDrawLineAA(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color) {
+		aaSpan	span[2];
+		fixed	pos, step;
+		gCoord	i, t;
+		gU8		f;
+
+		// Wu's algorithm. Each step splits a pixel between the two nearest rows (or columns).
+		//	Pixels are collected into spans by row so they can be blended together.
+		span[0].cnt = span[1].cnt = 0;
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatAntiAlias);
+		g->p.color = color;
+		if ((x1 > x0 ? x1 - x0 : x0 - x1) >= (y1 > y0 ? y1 - y0 : y0 - y1)) {
+			// Mostly horizontal. Alternate rows use alternate spans so both rows keep growing.
+			if (x1 < x0) {
+				t = x0; x0 = x1; x1 = t;
+				t = y0; y0 = y1; y1 = t;
+			}
+			step = x1 == x0 ? 0 : FIXED(y1 - y0) / (x1 - x0);
+			for(pos = FIXED(y0), i = x0; i <= x1; i++, pos += step) {
+				t = NONFIXED(pos);
+				f = (gU8)(pos >> 8);
+				aaspanadd(g, &span[t & 1], i, t, 255 - f);
+				if (f)
+					aaspanadd(g, &span[(t+1) & 1], i, t+1, f);
+			}
+		} else {
+			// Mostly vertical
+			if (y1 < y0) {
+				t = x0; x0 = x1; x1 = t;
+				t = y0; y0 = y1; y1 = t;
+			}
+			step = FIXED(x1 - x0) / (y1 - y0);
+			for(pos = FIXED(x0), i = y0; i <= y1; i++, pos += step) {
+				t = NONFIXED(pos);
+				f = (gU8)(pos >> 8);
+				aaspanadd(g, &span[0], t, i, 255 - f);
+				if (f)
+					aaspanadd(g, &span[0], t+1, i, f);
+			}
+		}
+		aaspanflush(g, &span[0]);
+		aaspanflush(g, &span[1]);
+		autoflush(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
+	#if GDISP_NEED_CIRCLE || GDISP_NEED_ARC
+		// An integer square root (rounded down)
+		static gU32 aasqrt(gU32 n) {
+			gU32	r, b;
+
+			for(r = 0, b = 1UL << 30; b > n; b >>= 2);
+			for(; b; b >>= 2) {
+				if (n >= r + b) {
+					n -= r + b;
+					r = (r >> 1) + b;
+				} else
+					r >>= 1;
+			}
+			return r;
+		}
+
+		// A circle edge. The radius is in 1/256ths of a pixel.
+		typedef struct aaRadius {
+			gI32		r;						// The radius
+			gI32		sqi, sqf;				// The radius squared as whole pixels and 1/256ths
+		} aaRadius;
+
+		static void aaradius(aaRadius *pr, gI32 r) {
+			gI32	ri, rf, t;
+
+			if (r < 0)
+				r = 0;
+			ri = r >> 8;
+			rf = r & 255;
+			t = 2*ri*rf + ((rf*rf) >> 8);
+			pr->r = r;
+			pr->sqi = ri*ri + (t >> 8);
+			pr->sqf = t & 255;
+		}
+
+		// How much (0 to 256) of the pixel at distance squared d2 from the centre is inside the circle edge.
+		//	The distance to the edge is found from (d*d - r*r) / (d + r) without needing a square root.
+		static gI32 aacover(gI32 d2, const aaRadius *pr) {
+			gI32	diff, lim, num, e, den;
+
+			diff = d2 - pr->sqi;
+			lim = 4 * ((pr->r >> 8) + 2);
+			if (diff > lim)
+				return 0;
+			if (diff < -lim)
+				return 256;
+			num = diff * 256 - pr->sqf;									// 1/256ths of a pixel squared
+			den = 2 * pr->r;
+			if (den < 1)
+				den = 1;
+			e = (num < 0x7FFFFF && num > -0x7FFFFF) ? num * 256 / den : num / ((den >> 8) + 1);
+			den = 2 * pr->r + e;
+			if (den >= 1)
+				e = (num < 0x7FFFFF && num > -0x7FFFFF) ? num * 256 / den : num / ((den >> 8) + 1);
+			e = 128 - e;
+			return e < 0 ? 0 : (e > 256 ? 256 : e);
+		}
+
+		// aaring(g, xc, yc, ri, ro, angles)
+		// Draws the anti-aliased ring between the radius ri and ro (in 1/256ths of a pixel) centred on xc,yc.
+		// angles is 0 for the full ring or the sine and cosine (in 1/4096ths) of the start and end angles.
+		// The caller must have locked the display and set the color.
+		typedef struct aaAngles {
+			gI32		sc, ss;					// The cosine and sine of the start angle
+			gI32		ec, es;					// The cosine and sine of the end angle
+			gBool		narrow;					// The arc is 180 degrees or less
+		} aaAngles;
+
+		static void aaring(GDisplay *g, gCoord xc, gCoord yc, gI32 ri, gI32 ro, const aaAngles *angles) {
+			aaSpan		span;
+			aaRadius	rin, rout;
+			gCoord		cx0, cy0, cx1, cy1, x, y, xs, xe, h;
+			gI32		rmax, rhole, d2, a, s1, s2;
+
+			// The rows and columns that can be touched
+			rmax = (ro + 128 + 255) >> 8;
+			rhole = ri > 128 ? (ri - 128) >> 8 : -1;
+			cx0 = 0; cy0 = 0; cx1 = g->g.Width; cy1 = g->g.Height;
+			#if NEED_CLIPPING
+				#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+					if (!gvmt(g)->setclip)
+				#endif
+				{
+					cx0 = g->clipx0; cy0 = g->clipy0; cx1 = g->clipx1; cy1 = g->clipy1;
+				}
+			#endif
+			if (cy0 < yc - rmax)	cy0 = yc - rmax;
+			if (cy1 > yc + rmax + 1)	cy1 = yc + rmax + 1;
+			if (cx0 < xc - rmax)	cx0 = xc - rmax;
+			if (cx1 > xc + rmax + 1)	cx1 = xc + rmax + 1;
+
+			aaradius(&rin, ri);
+			aaradius(&rout, ro);
+			span.cnt = 0;
+			for(y = cy0; y < cy1; y++) {
+				d2 = (gI32)(y - yc) * (y - yc);
+				if (d2 > rmax * rmax)
+					continue;
+				h = (gCoord)aasqrt(rmax * rmax - d2);
+				xs = xc - h < cx0 ? cx0 : xc - h;
+				xe = xc + h >= cx1 ? cx1 - 1 : xc + h;
+				h = rhole >= 0 && d2 <= rhole * rhole ? (gCoord)aasqrt(rhole * rhole - d2) : -1;
+				for(x = xs; x <= xe; x++) {
+					// Skip the hole in the middle
+					if (h >= 0 && x >= xc - h && x <= xc + h) {
+						x = xc + h;
+						continue;
+					}
+					d2 = (gI32)(x - xc) * (x - xc) + (gI32)(y - yc) * (y - yc);
+					a = aacover(d2, &rout);
+					if (ri > 0)
+						a -= aacover(d2, &rin);
+					if (angles && a) {
+						// The signed distances (in 1/256ths of a pixel) from the start and end lines
+						s1 = 128 + ((angles->sc * (yc - y) - angles->ss * (x - xc)) >> 4);
+						s2 = 128 - ((angles->ec * (yc - y) - angles->es * (x - xc)) >> 4);
+						s1 = s1 < 0 ? 0 : (s1 > 256 ? 256 : s1);
+						s2 = s2 < 0 ? 0 : (s2 > 256 ? 256 : s2);
+						if (angles->narrow)
+							a = (a * (s1 < s2 ? s1 : s2)) >> 8;
+						else
+							a = (a * (s1 > s2 ? s1 : s2)) >> 8;
+					}
+					aaspanadd(g, &span, x, y, a >= 256 ? 255 : (gU8)a);
+				}
+			}
+			aaspanflush(g, &span);
+		}
+	#endif
+
+	#if GDISP_NEED_CIRCLE
+		void gdispGDrawCircleAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
+			MUTEX_ENTER(g);
+			STAT_BEGIN(g, gdispStatAntiAlias);
+			g->p.color = color;
+			aaring(g, x, y, (gI32)radius * 256 - 128, (gI32)radius * 256 + 128, 0);
+			autoflush(g);
+			STAT_END(g);
+			MUTEX_EXIT(g);
+		}
+
+		void gdispGFillCircleAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
+			MUTEX_ENTER(g);
+			STAT_BEGIN(g, gdispStatAntiAlias);
+			g->p.color = color;
+			aaring(g, x, y, 0, (gI32)radius * 256 + 128, 0);
+			autoflush(g);
+			STAT_END(g);
+			MUTEX_EXIT(g);
+		}
+	#endif
+
+	#if GDISP_NEED_ARC
+		// Returns gFalse if the arc is a full circle
+		static gBool aaangles(aaAngles *pa, gCoord start, gCoord end) {
+			// Normalize the angles
+			if (start < 0)
+				start -= (start/360-1)*360;
+			else if (start >= 360)
+				start %= 360;
+			if (end < 0)
+				end -= (end/360-1)*360;
+			else if (end >= 360)
+				end %= 360;
+
+			#if GFX_USE_GMISC && GMISC_NEED_FIXEDTRIG
+				pa->sc = ffcos(start) >> 4;	pa->ss = ffsin(start) >> 4;
+				pa->ec = ffcos(end) >> 4;	pa->es = ffsin(end) >> 4;
+			#elif GFX_USE_GMISC && GMISC_NEED_FASTTRIG
+				pa->sc = (gI32)(fcos(start) * 4096);	pa->ss = (gI32)(fsin(start) * 4096);
+				pa->ec = (gI32)(fcos(end) * 4096);		pa->es = (gI32)(fsin(end) * 4096);
+			#else
+				pa->sc = (gI32)(cos(start*GFX_PI/180) * 4096);	pa->ss = (gI32)(sin(start*GFX_PI/180) * 4096);
+				pa->ec = (gI32)(cos(end*GFX_PI/180) * 4096);	pa->es = (gI32)(sin(end*GFX_PI/180) * 4096);
+			#endif
+			pa->narrow = (end - start + 360) % 360 <= 180;
+			return start != end;
+		}
+
+		void gdispGDrawArcAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gCoord start, gCoord end, gColor color) {
+			aaAngles	a;
+			gBool		part;
+
+			part = aaangles(&a, start, end);
+			MUTEX_ENTER(g);
+			STAT_BEGIN(g, gdispStatAntiAlias);
+			g->p.color = color;
+			aaring(g, x, y, (gI32)radius * 256 - 128, (gI32)radius * 256 + 128, part ? &a : 0);
+			autoflush(g);
+			STAT_END(g);
+			MUTEX_EXIT(g);
+		}
+
+		void gdispGDrawThickArcAA(GDisplay *g, gCoord xc, gCoord yc, gCoord radiusStart, gCoord radiusEnd, gCoord start, gCoord end, gColor color) {
+			aaAngles	a;
+			gBool		part;
+
+			part = aaangles(&a, start, end);
+			MUTEX_ENTER(g);
+			STAT_BEGIN(g, gdispStatAntiAlias);
+			g->p.color = color;
+			aaring(g, xc, yc, radiusStart > 0 ? (gI32)radiusStart * 256 - 128 : 0, (gI32)radiusEnd * 256 + 128, part ? &a : 0);
+			autoflush(g);
+			STAT_END(g);
+			MUTEX_EXIT(g);
+		}
+	#endif
 #endif
 
 #if GDISP_NEED_TEXT
@@ -3273,10 +6117,18 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 				GD->p.x = x; GD->p.y = y; GD->p.x1 = x+count-1; GD->p.color = GD->t.color;
 				hline_clip(GD);
 			} else {
-				for (; count; count--, x++) {
-					GD->p.x = x; GD->p.y = y;
-					GD->p.color = gdispBlendColor(GD->t.color, gdisp_lld_get_pixel_color(GD), alpha);
-					drawpixel_clip(GD);
+				gU8		abuf[BLENDSPAN_PIXELS];
+				gCoord	n;
+
+				// Blend the run a block at a time
+				for (n = 0; n < count && n < BLENDSPAN_PIXELS; n++)
+					abuf[n] = alpha;
+				GD->p.color = GD->t.color;
+				for (; count; count -= n, x += n) {
+					n = count > BLENDSPAN_PIXELS ? BLENDSPAN_PIXELS : count;
+					GD->p.x = x; GD->p.y = y; GD->p.cx = n;
+					GD->p.ptr = (void *)abuf;
+					blendspan(GD);
 				}
 			}
 			#undef GD
@@ -3367,6 +6219,7 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		if (!font)
 			return;
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatText);
 		g->t.font = font;
 		g->t.clipx0 = x;
 		g->t.clipy0 = y;
@@ -3375,6 +6228,7 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		g->t.color = color;
 		mf_render_character(font, x, y, c, drawcharline, g);
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 
@@ -3382,6 +6236,7 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		if (!font)
 			return;
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatText);
 		g->p.cx = mf_character_width(font, c) + font->baseline_x;
 		g->p.cy = font->height;
 		g->t.font = font;
@@ -3393,17 +6248,15 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		g->t.bgcolor = g->p.color = bgcolor;
 
 		TEST_CLIP_AREA(g) {
-			fillarea(g);
+			fillarea_clip(g);
 			mf_render_character(font, x, y, c, fillcharline, g);
 		}
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 
-	void gdispGDrawString(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color) {
-		if (!font)
-			return;
-		MUTEX_ENTER(g);
+	static void drawstring(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color) {
 		g->t.font = font;
 		g->t.clipx0 = x;
 		g->t.clipy0 = y;
@@ -3412,14 +6265,20 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		g->t.color = color;
 
 		mf_render_aligned(font, x+font->baseline_x, y, MF_ALIGN_LEFT, str, 0, drawcharglyph, g);
-		autoflush(g);
-		MUTEX_EXIT(g);
 	}
 
-	void gdispGFillString(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color, gColor bgcolor) {
+	void gdispGDrawString(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color) {
 		if (!font)
 			return;
 		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatText);
+		drawstring(g, x, y, str, font, color);
+		autoflush(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
+	static void fillstring(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color, gColor bgcolor) {
 		g->p.cx = mf_get_string_width(font, str, 0, 0) + font->baseline_x;
 		g->p.cy = font->height;
 		g->t.font = font;
@@ -3431,21 +6290,25 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		g->t.bgcolor = g->p.color = bgcolor;
 
 		TEST_CLIP_AREA(g) {
-			fillarea(g);
+			fillarea_clip(g);
 			mf_render_aligned(font, x+font->baseline_x, y, MF_ALIGN_LEFT, str, 0, fillcharglyph, g);
 		}
+	}
 
+	void gdispGFillString(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color, gColor bgcolor) {
+		if (!font)
+			return;
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatText);
+		fillstring(g, x, y, str, font, color, bgcolor);
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 
-	void gdispGDrawStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gJustify justify) {
+	static void drawstringbox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gJustify justify) {
 		gCoord		totalHeight;
 
-		if (!font)
-			return;
-		MUTEX_ENTER(g);
-
 		// Apply padding
 		#if GDISP_NEED_TEXT_BOXPADLR != 0 || GDISP_NEED_TEXT_BOXPADTB != 0
 			if (!(justify & gJustifyNoPad)) {
@@ -3512,18 +6375,22 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			} else
 		#endif
 		mf_render_aligned(font, x, y, (justify & JUSTIFYMASK_HORIZONTAL), str, 0, drawcharglyph, g);
+	}
 
+	void gdispGDrawStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gJustify justify) {
+		if (!font)
+			return;
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatText);
+		drawstringbox(g, x, y, cx, cy, str, font, color, justify);
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 
-	void gdispGFillStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgcolor, gJustify justify) {
+	static void fillstringbox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgcolor, gJustify justify) {
 		gCoord		totalHeight;
 
-		if (!font)
-			return;
-		MUTEX_ENTER(g);
-
 		g->p.x = x;
 		g->p.y = y;
 		g->p.cx = cx;
@@ -3533,7 +6400,7 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 
 			// background fill
 			g->p.color = bgcolor;
-			fillarea(g);
+			fillarea_clip(g);
 
 			// Apply padding
 			#if GDISP_NEED_TEXT_BOXPADLR != 0 || GDISP_NEED_TEXT_BOXPADTB != 0
@@ -3603,8 +6470,16 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			#endif
 			mf_render_aligned(font, x, y, (justify & JUSTIFYMASK_HORIZONTAL), str, 0, fillcharglyph, g);
 		}
+	}
 
+	void gdispGFillStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgcolor, gJustify justify) {
+		if (!font)
+			return;
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatText);
+		fillstringbox(g, x, y, cx, cy, str, font, color, bgcolor, justify);
 		autoflush(g);
+		STAT_END(g);
 		MUTEX_EXIT(g);
 	}
 
@@ -3649,6 +6524,749 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	}
 #endif
 
+#if GDISP_NEED_CMDLIST
+	// The commands that can be recorded
+	#define CMD_CLEAR			1
+	#define CMD_PIXEL			2
+	#define CMD_LINE			3
+	#define CMD_FILL			4
+	#define CMD_BOX				5
+	#define CMD_BLIT			6
+	#define CMD_CLIP			7
+	#define CMD_STRING			8
+	#define CMD_FILLSTRING		9
+	#define CMD_STRINGBOX		10
+	#define CMD_FILLSTRINGBOX	11
+	#define CMD_IMAGE			12
+
+	// A recorded command. Any string follows the record.
+	typedef struct cmdRec {
+		gU16				op;				// The command
+		gMemSize			len;			// The size of this record (including any string)
+		gCoord				x, y, cx, cy;	// The area (or the end point for lines)
+		gColor				color;
+		gColor				bgcolor;
+		union {
+			struct {
+				gCoord			srcx, srcy, srccx;
+				const gPixel *	buffer;
+			} blit;
+			#if GDISP_NEED_TEXT
+				struct {
+					gFont		font;
+					gJustify	justify;
+				} text;
+			#endif
+			#if GDISP_NEED_IMAGE
+				struct {
+					gImage *	img;
+					gCoord		sx, sy;
+				} image;
+			#endif
+		} u;
+	} cmdRec;
+
+	// Records are aligned so that the pointers in them can be accessed directly
+	#define CMD_ALIGN(n)		(((n) + sizeof(void *) - 1) & ~(gMemSize)(sizeof(void *) - 1))
+
+	// cmdalloc(cl, op, str)
+	// Add a record for a command to the list (copying the string if there is one).
+	// The list is submitted first if there isn't enough room.
+	// Returns 0 if the command can't fit even in an empty list in which case it must be drawn directly
+	// (the list has already been submitted so the drawing order is kept).
+	static cmdRec *cmdalloc(gdispCmdList *cl, gU16 op, const char *str) {
+		cmdRec		*r;
+		gMemSize	len;
+		const char	*s;
+		char		*p;
+
+		len = sizeof(cmdRec);
+		if (str) {
+			for(s = str; *s; s++, len++);
+			len++;
+		}
+		len = CMD_ALIGN(len);
+		if (len > cl->size - cl->len) {
+			gdispCmdListSubmit(cl);
+			if (len > cl->size)
+				return 0;
+		}
+
+		r = (cmdRec *)(cl->buf + cl->len);
+		cl->len += len;
+		r->op = op;
+		r->len = len;
+		if (str)
+			for(p = (char *)(r+1); (*p++ = *str++););
+		return r;
+	}
+
+	void gdispGCmdListBegin(GDisplay *g, gdispCmdList *cl, void *buf, gMemSize size) {
+		gMemSize	skip;
+
+		// Start on an aligned boundary
+		skip = (gMemSize)(-(gPtrDiff)buf & (gPtrDiff)(sizeof(void *) - 1));
+		cl->display = g;
+		cl->buf = (gU8 *)buf + skip;
+		cl->size = size > skip ? size - skip : 0;
+		cl->len = 0;
+	}
+
+	#if GDISP_NEED_TILER
+		// cmdculled(g, r)
+		// Is a command completely outside the area of a view.
+		// Only commands with a known bounding box are culled.
+		static gBool cmdculled(GDisplay *g, cmdRec *r) {
+			gCoord	x0, y0, x1, y1;
+
+			switch(r->op) {
+			case CMD_PIXEL:
+				x0 = x1 = r->x;
+				y0 = y1 = r->y;
+				break;
+			case CMD_LINE:
+				if (r->x < r->cx)	{ x0 = r->x; x1 = r->cx; }
+				else				{ x0 = r->cx; x1 = r->x; }
+				if (r->y < r->cy)	{ y0 = r->y; y1 = r->cy; }
+				else				{ y0 = r->cy; y1 = r->y; }
+				break;
+			case CMD_FILL:
+			case CMD_BOX:
+			case CMD_BLIT:
+			#if GDISP_NEED_TEXT
+				case CMD_STRINGBOX:
+				case CMD_FILLSTRINGBOX:
+			#endif
+			#if GDISP_NEED_IMAGE
+				case CMD_IMAGE:
+			#endif
+				x0 = r->x;
+				y0 = r->y;
+				x1 = r->x + r->cx - 1;
+				y1 = r->y + r->cy - 1;
+				break;
+			#if GDISP_NEED_TEXT
+				case CMD_STRING:
+				case CMD_FILLSTRING:
+					// Strings only ever extend right and down from their position
+					x0 = r->x;
+					y0 = r->y;
+					x1 = g->viewx1;
+					y1 = r->y + r->u.text.font->height - 1;
+					break;
+			#endif
+			default:
+				return gFalse;
+			}
+			return x1 < g->viewx0 || y1 < g->viewy0 || x0 >= g->viewx1 || y0 >= g->viewy1;
+		}
+	#endif
+
+	// cmdlistdraw(g, cl)
+	// Draws all the commands in a list on g (which must be locked).
+	// When g is a view the commands outside its area are skipped.
+	static void cmdlistdraw(GDisplay *g, gdispCmdList *cl) {
+		cmdRec		*r;
+		gU8			*end;
+
+		end = cl->buf + cl->len;
+		for(r = (cmdRec *)cl->buf; (gU8 *)r < end; r = (cmdRec *)((gU8 *)r + r->len)) {
+			#if GDISP_NEED_TILER
+				if (g->parent && cmdculled(g, r))
+					continue;
+			#endif
+			switch(r->op) {
+			case CMD_CLEAR:
+				scrstreamstop(g);
+				g->p.color = r->color;
+				clear(g);
+				break;
+			case CMD_PIXEL:
+				g->p.x = r->x;
+				g->p.y = r->y;
+				g->p.color = r->color;
+				drawpixel_clip(g);
+				break;
+			case CMD_LINE:
+				g->p.x = r->x;
+				g->p.y = r->y;
+				g->p.x1 = r->cx;
+				g->p.y1 = r->cy;
+				g->p.color = r->color;
+				line_clip(g);
+				break;
+			case CMD_FILL:
+				g->p.x = r->x;
+				g->p.y = r->y;
+				g->p.cx = r->cx;
+				g->p.cy = r->cy;
+				g->p.color = r->color;
+				TEST_CLIP_AREA(g) {
+					fillarea_clip(g);
+				}
+				break;
+			case CMD_BOX:
+				g->p.color = r->color;
+				drawbox(g, r->x, r->y, r->cx, r->cy);
+				break;
+			case CMD_BLIT:
+				scrstreamstop(g);
+				g->p.x = r->x;
+				g->p.y = r->y;
+				g->p.cx = r->cx;
+				g->p.cy = r->cy;
+				g->p.x1 = r->u.blit.srcx;
+				g->p.y1 = r->u.blit.srcy;
+				g->p.x2 = r->u.blit.srccx;
+				g->p.ptr = (void *)r->u.blit.buffer;
+				blitarea(g);
+				break;
+			#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
+				case CMD_CLIP:
+					scrstreamstop(g);
+					g->p.x = r->x;
+					g->p.y = r->y;
+					g->p.cx = r->cx;
+					g->p.cy = r->cy;
+					setclip(g);
+					break;
+			#endif
+			#if GDISP_NEED_TEXT
+				case CMD_STRING:
+					drawstring(g, r->x, r->y, (const char *)(r+1), r->u.text.font, r->color);
+					break;
+				case CMD_FILLSTRING:
+					fillstring(g, r->x, r->y, (const char *)(r+1), r->u.text.font, r->color, r->bgcolor);
+					break;
+				case CMD_STRINGBOX:
+					drawstringbox(g, r->x, r->y, r->cx, r->cy, (const char *)(r+1), r->u.text.font, r->color, r->u.text.justify);
+					break;
+				case CMD_FILLSTRINGBOX:
+					fillstringbox(g, r->x, r->y, r->cx, r->cy, (const char *)(r+1), r->u.text.font, r->color, r->bgcolor, r->u.text.justify);
+					break;
+			#endif
+			#if GDISP_NEED_IMAGE
+				case CMD_IMAGE:
+					// Image decoders draw using the normal drawing functions so we must let go of the display
+					scrstreamstop(g);
+					dirtycommit(g);
+					MUTEX_EXIT(g);
+					#if GDISP_NEED_TILER
+						// A view only decodes the part of the image in its area.
+						// An image can only be decoded by one thread at a time.
+						if (g->parent) {
+							gCoord	x, y, cx, cy;
+
+							x = r->x < g->viewx0 ? g->viewx0 : r->x;
+							y = r->y < g->viewy0 ? g->viewy0 : r->y;
+							cx = (r->x + r->cx > g->viewx1 ? g->viewx1 : r->x + r->cx) - x;
+							cy = (r->y + r->cy > g->viewy1 ? g->viewy1 : r->y + r->cy) - y;
+							gfxMutexEnter(&tilerimagemutex);
+							gdispGImageDraw(g, r->u.image.img, x, y, cx, cy, r->u.image.sx + x - r->x, r->u.image.sy + y - r->y);
+							gfxMutexExit(&tilerimagemutex);
+						} else
+					#endif
+					gdispGImageDraw(g, r->u.image.img, r->x, r->y, r->cx, r->cy, r->u.image.sx, r->u.image.sy);
+					MUTEX_ENTER(g);
+					break;
+			#endif
+			}
+
+			// Keep the dirty areas just as precise as drawing each command separately
+			dirtycommit(g);
+		}
+	}
+
+	void gdispCmdListSubmit(gdispCmdList *cl) {
+		GDisplay	*g;
+
+		if (!cl->len)
+			return;
+
+		g = cl->display;
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatCmdList);
+		cmdlistdraw(g, cl);
+		cl->len = 0;
+		autoflush(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+	}
+
+	void gdispCmdListClear(gdispCmdList *cl, gColor color) {
+		cmdRec	*r;
+
+		if (!(r = cmdalloc(cl, CMD_CLEAR, 0))) {
+			gdispGClear(cl->display, color);
+			return;
+		}
+		r->color = color;
+	}
+
+	void gdispCmdListDrawPixel(gdispCmdList *cl, gCoord x, gCoord y, gColor color) {
+		cmdRec	*r;
+
+		if (!(r = cmdalloc(cl, CMD_PIXEL, 0))) {
+			gdispGDrawPixel(cl->display, x, y, color);
+			return;
+		}
+		r->x = x;
+		r->y = y;
+		r->color = color;
+	}
+
+	void gdispCmdListDrawLine(gdispCmdList *cl, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color) {
+		cmdRec	*r;
+
+		if (!(r = cmdalloc(cl, CMD_LINE, 0))) {
+			gdispGDrawLine(cl->display, x0, y0, x1, y1, color);
+			return;
+		}
+		r->x = x0;
+		r->y = y0;
+		r->cx = x1;
+		r->cy = y1;
+		r->color = color;
+	}
+
+	void gdispCmdListFillArea(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
+		cmdRec	*r;
+
+		if (!(r = cmdalloc(cl, CMD_FILL, 0))) {
+			gdispGFillArea(cl->display, x, y, cx, cy, color);
+			return;
+		}
+		r->x = x;
+		r->y = y;
+		r->cx = cx;
+		r->cy = cy;
+		r->color = color;
+	}
+
+	void gdispCmdListDrawBox(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
+		cmdRec	*r;
+
+		if (cx <= 0 || cy <= 0)
+			return;
+		if (!(r = cmdalloc(cl, CMD_BOX, 0))) {
+			gdispGDrawBox(cl->display, x, y, cx, cy, color);
+			return;
+		}
+		r->x = x;
+		r->y = y;
+		r->cx = cx;
+		r->cy = cy;
+		r->color = color;
+	}
+
+	void gdispCmdListBlitArea(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
+		cmdRec	*r;
+
+		if (!(r = cmdalloc(cl, CMD_BLIT, 0))) {
+			gdispGBlitArea(cl->display, x, y, cx, cy, srcx, srcy, srccx, buffer);
+			return;
+		}
+		r->x = x;
+		r->y = y;
+		r->cx = cx;
+		r->cy = cy;
+		r->u.blit.srcx = srcx;
+		r->u.blit.srcy = srcy;
+		r->u.blit.srccx = srccx;
+		r->u.blit.buffer = buffer;
+	}
+
+	#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
+		void gdispCmdListSetClip(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+			cmdRec	*r;
+
+			if (!(r = cmdalloc(cl, CMD_CLIP, 0))) {
+				gdispGSetClip(cl->display, x, y, cx, cy);
+				return;
+			}
+			r->x = x;
+			r->y = y;
+			r->cx = cx;
+			r->cy = cy;
+		}
+	#endif
+
+	#if GDISP_NEED_TEXT
+		void gdispCmdListDrawString(gdispCmdList *cl, gCoord x, gCoord y, const char *str, gFont font, gColor color) {
+			cmdRec	*r;
+
+			if (!font)
+				return;
+			if (!(r = cmdalloc(cl, CMD_STRING, str))) {
+				gdispGDrawString(cl->display, x, y, str, font, color);
+				return;
+			}
+			r->x = x;
+			r->y = y;
+			r->color = color;
+			r->u.text.font = font;
+		}
+
+		void gdispCmdListFillString(gdispCmdList *cl, gCoord x, gCoord y, const char *str, gFont font, gColor color, gColor bgcolor) {
+			cmdRec	*r;
+
+			if (!font)
+				return;
+			if (!(r = cmdalloc(cl, CMD_FILLSTRING, str))) {
+				gdispGFillString(cl->display, x, y, str, font, color, bgcolor);
+				return;
+			}
+			r->x = x;
+			r->y = y;
+			r->color = color;
+			r->bgcolor = bgcolor;
+			r->u.text.font = font;
+		}
+
+		void gdispCmdListDrawStringBox(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gJustify justify) {
+			cmdRec	*r;
+
+			if (!font)
+				return;
+			if (!(r = cmdalloc(cl, CMD_STRINGBOX, str))) {
+				gdispGDrawStringBox(cl->display, x, y, cx, cy, str, font, color, justify);
+				return;
+			}
+			r->x = x;
+			r->y = y;
+			r->cx = cx;
+			r->cy = cy;
+			r->color = color;
+			r->u.text.font = font;
+			r->u.text.justify = justify;
+		}
+
+		void gdispCmdListFillStringBox(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgcolor, gJustify justify) {
+			cmdRec	*r;
+
+			if (!font)
+				return;
+			if (!(r = cmdalloc(cl, CMD_FILLSTRINGBOX, str))) {
+				gdispGFillStringBox(cl->display, x, y, cx, cy, str, font, color, bgcolor, justify);
+				return;
+			}
+			r->x = x;
+			r->y = y;
+			r->cx = cx;
+			r->cy = cy;
+			r->color = color;
+			r->bgcolor = bgcolor;
+			r->u.text.font = font;
+			r->u.text.justify = justify;
+		}
+	#endif
+
+	#if GDISP_NEED_IMAGE
+		void gdispCmdListImageDraw(gdispCmdList *cl, gImage *img, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord sx, gCoord sy) {
+			cmdRec	*r;
+
+			if (!(r = cmdalloc(cl, CMD_IMAGE, 0))) {
+				gdispGImageDraw(cl->display, img, x, y, cx, cy, sx, sy);
+				return;
+			}
+			r->x = x;
+			r->y = y;
+			r->cx = cx;
+			r->cy = cy;
+			r->u.image.img = img;
+			r->u.image.sx = sx;
+			r->u.image.sy = sy;
+		}
+	#endif
+#endif
+
+#if GDISP_NEED_TILER
+	// tilerdraw(t, v)
+	// Draws the tiles that no other thread has taken yet using view v.
+	static void tilerdraw(gdispTiler *t, GDisplay *v) {
+		unsigned	tile;
+
+		MUTEX_ENTER(v);
+		while(1) {
+			// Take the next tile
+			gfxMutexEnter(&t->lock);
+			tile = t->next;
+			if (tile < t->tiles)
+				t->next++;
+			gfxMutexExit(&t->lock);
+			if (tile >= t->tiles)
+				break;
+
+			// Move the view onto the tile and start with the clip the display has
+			v->p.x = (tile % t->across) * t->tilecx;
+			v->p.y = (tile / t->across) * t->tilecy;
+			v->p.cx = t->tilecx;
+			v->p.cy = t->tilecy;
+			viewsetarea(v);
+			v->p.x = t->clipx0;
+			v->p.y = t->clipy0;
+			v->p.cx = t->clipx1 - t->clipx0;
+			v->p.cy = t->clipy1 - t->clipy0;
+			setclip(v);
+
+			cmdlistdraw(v, t->cl);
+		}
+
+		// Pass what has been drawn to the display
+		viewpublish(v);
+		MUTEX_EXIT(v);
+	}
+
+	static GFX_THREAD_FUNCTION(tilerthread, param) {
+		gdispTiler	*t;
+		GDisplay	*v;
+
+		t = (gdispTiler *)param;
+		v = gdispGViewCreate(t->display, 0, 0, 0, 0);
+		while(1) {
+			gfxSemWait(&t->start, gDelayForever);
+			if (t->quit)
+				break;
+			if (v)
+				tilerdraw(t, v);
+			gfxMutexEnter(&t->lock);
+			if (!--t->busy)
+				gfxSemSignal(&t->done);
+			gfxMutexExit(&t->lock);
+		}
+		if (v)
+			gdispViewDelete(v);
+		gfxThreadReturn(0);
+	}
+
+	gBool gdispGTilerInit(GDisplay *g, gdispTiler *t, gCoord tilecx, gCoord tilecy) {
+		// A tiler on a view tiles the whole display
+		if (g->parent)
+			g = g->parent;
+
+		t->display = g;
+		t->tilecx = tilecx > 0 ? tilecx : 64;
+		t->tilecy = tilecy > 0 ? tilecy : 64;
+		t->threads = 0;
+		t->quit = gFalse;
+
+		// If the display can't have views just submit lists normally
+		if (!(t->view = gdispGViewCreate(g, 0, 0, 0, 0)))
+			return gFalse;
+
+		gfxMutexInit(&t->lock);
+		gfxSemInit(&t->start, 0, GDISP_TILER_THREADS);
+		gfxSemInit(&t->done, 0, 1);
+		while(t->threads < GDISP_TILER_THREADS) {
+			if (!(t->thread[t->threads] = gfxThreadCreate(0, GDISP_TILER_STACKSIZE, gThreadpriorityNormal, tilerthread, t)))
+				break;
+			t->threads++;
+		}
+		return t->threads != 0;
+	}
+
+	void gdispTilerDeinit(gdispTiler *t) {
+		unsigned	i;
+
+		if (!t->view)
+			return;
+
+		t->quit = gTrue;
+		for(i = 0; i < t->threads; i++)
+			gfxSemSignal(&t->start);
+		for(i = 0; i < t->threads; i++)
+			gfxThreadWait(t->thread[i]);
+		gfxSemDestroy(&t->done);
+		gfxSemDestroy(&t->start);
+		gfxMutexDestroy(&t->lock);
+		gdispViewDelete(t->view);
+		t->view = 0;
+		t->threads = 0;
+	}
+
+	void gdispTilerSubmit(gdispTiler *t, gdispCmdList *cl) {
+		GDisplay	*g;
+		cmdRec		*r, *clip;
+		gU8			*end;
+		unsigned	i;
+
+		if (!cl->len)
+			return;
+
+		g = t->display;
+		if (!t->view || cl->display != g) {
+			gdispCmdListSubmit(cl);
+			return;
+		}
+
+		// Every tile starts with the clip the display has now
+		MUTEX_ENTER(g);
+		#if NEED_CLIPREGION
+			// Views can't share a clip region
+			if (g->clipregion) {
+				MUTEX_EXIT(g);
+				gdispCmdListSubmit(cl);
+				return;
+			}
+		#endif
+		t->clipx0 = g->clipx0;
+		t->clipy0 = g->clipy0;
+		t->clipx1 = g->clipx1;
+		t->clipy1 = g->clipy1;
+		t->across = (g->g.Width + t->tilecx - 1) / t->tilecx;
+		t->tiles = t->across * ((g->g.Height + t->tilecy - 1) / t->tilecy);
+		MUTEX_EXIT(g);
+
+		// Draw the tiles on all the threads (including this one)
+		t->cl = cl;
+		t->next = 0;
+		t->busy = t->threads;
+		for(i = 0; i < t->threads; i++)
+			gfxSemSignal(&t->start);
+		tilerdraw(t, t->view);
+		if (t->threads)
+			gfxSemWait(&t->done, gDelayForever);
+
+		// Leave the display clipped just as drawing the list directly would
+		clip = 0;
+		end = cl->buf + cl->len;
+		for(r = (cmdRec *)cl->buf; (gU8 *)r < end; r = (cmdRec *)((gU8 *)r + r->len)) {
+			if (r->op == CMD_CLIP)
+				clip = r;
+		}
+		cl->len = 0;
+
+		MUTEX_ENTER(g);
+		if (clip) {
+			g->p.x = clip->x;
+			g->p.y = clip->y;
+			g->p.cx = clip->cx;
+			g->p.cy = clip->cy;
+			setclip(g);
+		}
+		autoflush(g);
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_ASYNC
+	// asynccomplete(g, f, fn, param)
+	// Tells the application an operation has completed. The callback is called before the fence is signalled.
+	static void asynccomplete(GDisplay *g, gdispFence *f, gdispAsyncCallback fn, void *param) {
+		if (fn)
+			fn(g, param);
+		if (f)
+			gfxSemSignal(&f->done);
+	}
+
+	// asyncdone(g, a)
+	// The driver has finished a background operation.
+	//	The application is told before the driver is marked idle so the fence can be reused straight away.
+	static void asyncdone(GDisplay *g, struct GDISPAsync *a) {
+		asynccomplete(g, a->fence, a->fn, a->param);
+		gfxSemSignal(&a->idle);
+	}
+
+	void _gdispFlushDone(GDisplay *g) {
+		asyncdone(g, &g->asyncflush);
+	}
+
+	void _gdispBlitDone(GDisplay *g) {
+		asyncdone(g, &g->asyncblit);
+	}
+
+	void gdispFenceInit(gdispFence *f) {
+		gfxSemInit(&f->done, 1, 1);
+	}
+
+	void gdispFenceDeinit(gdispFence *f) {
+		gfxSemDestroy(&f->done);
+	}
+
+	gBool gdispFenceWait(gdispFence *f, gDelay ms) {
+		if (!gfxSemWait(&f->done, ms))
+			return gFalse;
+
+		// Leave it signalled for anyone else waiting
+		gfxSemSignal(&f->done);
+		return gTrue;
+	}
+
+	void gdispGFlushAsync(GDisplay *g, gdispFence *f, gdispAsyncCallback fn, void *param) {
+		#if GDISP_HARDWARE_FLUSHASYNC
+			#if GDISP_HARDWARE_FLUSHASYNC == HARDWARE_AUTODETECT
+				if (gvmt(g)->flushasync)
+			#endif
+			{
+				gBool	started;
+
+				MUTEX_ENTER(g);
+				asyncwait(&g->asyncflush);
+
+				// The fence is not signalled until this flush has completed
+				if (f)
+					gfxSemWait(&f->done, gDelayNone);
+				g->asyncflush.fence = f;
+				g->asyncflush.fn = fn;
+				g->asyncflush.param = param;
+				g->flags |= GDISP_FLG_ASYNCFLUSH;
+				doflush(g);
+				g->flags &= ~GDISP_FLG_ASYNCFLUSH;
+				started = g->asyncflush.busy;
+				MUTEX_EXIT(g);
+				if (started)
+					return;
+			}
+		#endif
+
+		// Nothing needed doing in the background
+		gdispGFlush(g);
+		asynccomplete(g, f, fn, param);
+	}
+
+	void gdispGBlitAreaAsync(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer, gdispFence *f, gdispAsyncCallback fn, void *param) {
+		gBool	started;
+
+		MUTEX_ENTER(g);
+		STAT_BEGIN(g, gdispStatBlit);
+
+		// The fence is not signalled until this blit has completed
+		if (f)
+			gfxSemWait(&f->done, gDelayNone);
+		g->p.x = x;
+		g->p.y = y;
+		g->p.cx = cx;
+		g->p.cy = cy;
+		g->p.x1 = srcx;
+		g->p.y1 = srcy;
+		g->p.x2 = srccx;
+		g->p.ptr = (void *)buffer;
+
+		// Views and clip regions are blitted straight away
+		#if GDISP_NEED_VIEWS
+			if (!g->parent)
+		#endif
+		#if NEED_CLIPREGION
+			if (!g->clipregion)
+		#endif
+		{
+			g->asyncblit.fence = f;
+			g->asyncblit.fn = fn;
+			g->asyncblit.param = param;
+			g->flags |= GDISP_FLG_ASYNCBLIT;
+		}
+		blitarea(g);
+		g->flags &= ~GDISP_FLG_ASYNCBLIT;
+		started = g->asyncblit.busy;
+		autoflush_stopdone(g);
+		STAT_END(g);
+		MUTEX_EXIT(g);
+
+		if (!started)
+			asynccomplete(g, f, fn, param);
+	}
+#endif
+
 #if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
 	// Special alpha hacked version.
 	// Note: this will still work with real RGB888
@@ -72,6 +72,16 @@ typedef enum gJustify {
 #define JUSTIFYMASK_HORIZONTAL	(gJustifyLeft|gJustifyCenter|gJustifyRight)
 #define JUSTIFYMASK_VERTICAL	(gJustifyTop|gJustifyMiddle|gJustifyBottom)
 
+/**
+ * @enum gPolyFill
+ * @brief   Type for the polygon fill mode.
+ */
+typedef enum gPolyFill {
+	gPolyFillEvenOdd = 0x00,	/**< Fill using the even-odd rule (the default) */
+	gPolyFillNonZero = 0x01,	/**< Fill using the non-zero winding rule */
+	gPolyFillAntiAlias = 0x10	/**< Anti-alias the polygon edges */
+} gPolyFill;
+
 /**
  * @enum gFontmetric
  * @brief   Type for the font metric.
@@ -384,6 +394,24 @@ gU8 gdispGGetContrast(GDisplay *g);
 void gdispGFlush(GDisplay *g);
 #define gdispFlush()									gdispGFlush(GDISP)
 
+#if GDISP_NEED_DIRTYRECTS || defined(__DOXYGEN__)
+	/**
+	 * @brief   Mark an area of the display as needing to be flushed
+	 * @pre		GDISP_NEED_DIRTYRECTS must be GFXON in your gfxconf.h
+	 * @note	GDISP drawing functions do this automatically. This is only needed
+	 * 			when the display surface has been changed some other way eg. by
+	 * 			writing directly to the pixmap or frame buffer memory.
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] x,y		The start position
+	 * @param[in] cx,cy		The size of the area
+	 *
+	 * @api
+	 */
+	void gdispGMarkDirty(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy);
+	#define gdispMarkDirty(x,y,cx,cy)					gdispGMarkDirty(GDISP,x,y,cx,cy)
+#endif
+
 /**
  * @brief   Clear the display to the specified color.
  *
@@ -514,6 +542,26 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	void gdispGStreamColor(GDisplay *g, gColor color);
 	#define gdispStreamColor(c)								gdispGStreamColor(GDISP,c)
 
+	/**
+	 * @brief   Send a run of pixel data to the stream.
+	 * @details Write the colors to the next positions in the streamed area and move the position past them.
+	 * 			The run can wrap onto the next line of the area.
+	 * @pre		GDISP_NEED_STREAMING must be GFXON in your gfxconf.h
+	 * @pre		@p gdispStreamStart() has been called.
+	 * @note	The result is the same as calling @p gdispStreamColor() for each color but it is much faster
+	 * 			as the driver is given the whole run at once. Use it whenever a line or more is ready.
+	 * @note	If the gdispStreamStart() has not been called (or failed due to clipping), the
+	 * 			data provided here is simply thrown away.
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] buf		The colors of the pixels to write
+	 * @param[in] count		The number of colors in the buffer
+	 *
+	 * @api
+	 */
+	void gdispGStreamWrite(GDisplay *g, const gColor *buf, gCoord count);
+	#define gdispStreamWrite(buf,count)						gdispGStreamWrite(GDISP,buf,count)
+
 	/**
 	 * @brief   Finish the current streaming operation.
 	 * @details	Completes the current streaming operation and allows other GDISP calls to operate again.
@@ -805,6 +853,29 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	#define gdispVerticalScroll(x,y,cx,cy,l,b)				gdispGVerticalScroll(GDISP,x,y,cx,cy,l,b)
 #endif
 
+/* Copy Function */
+
+#if GDISP_NEED_COPYAREA || defined(__DOXYGEN__)
+	/**
+	 * @brief   Copy an area of the screen to another position on the same screen.
+	 * @pre		GDISP_NEED_COPYAREA must be set to GFXON in gfxconf.h
+	 * @note    Optional.
+	 * @note	The source and destination areas can overlap.
+	 * @note	The destination is clipped to the clipping area. If GDISP_NEED_CLIPREGION is set only the
+	 * 			bounding box of the clipping region is used.
+	 * @note	Drivers without a copy routine need GDISP_LINEBUF_SIZE and a way of reading pixels back.
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] x, y		The start of the area to be copied
+	 * @param[in] cx, cy	The size of the area to be copied
+	 * @param[in] dx, dy	The new position of the start of the area
+	 *
+	 * @api
+	 */
+	void gdispGCopyArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord dx, gCoord dy);
+	#define gdispCopyArea(x,y,cx,cy,dx,dy)					gdispGCopyArea(GDISP,x,y,cx,cy,dx,dy)
+#endif
+
 /* Set driver specific control */
 
 #if GDISP_NEED_CONTROL || defined(__DOXYGEN__)
@@ -902,6 +973,136 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	#define gdispDrawThickLine(x0,y0,x1,y1,c,w,r)			gdispGDrawThickLine(GDISP,x0,y0,x1,y1,c,w,r)
 #endif
 
+#if GDISP_NEED_POLYGON || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill a polygon
+	 * @details Fills any polygon including concave and self-intersecting polygons.
+	 * @pre		GDISP_NEED_POLYGON must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g			The display to use
+	 * @param[in] tx, ty	Transform all points in pntarray by tx, ty
+	 * @param[in] pntarray	An array of points
+	 * @param[in] cnt		The number of points in the array
+	 * @param[in] color		The color to use
+	 * @param[in] mode		The fill rule optionally or'd with gPolyFillAntiAlias
+	 *
+	 * @note	The polygon is closed automatically by joining the last point to the first.
+	 * @note	With gPolyFillEvenOdd, the areas where the polygon overlaps itself an even number
+	 * 			of times are not filled. With gPolyFillNonZero they are filled.
+	 * @note	Anti-aliasing requires GDISP_NEED_ANTIALIAS and a driver that can read pixels.
+	 * 			Without them the polygon is drawn without anti-aliasing.
+	 * @note	Without anti-aliasing the pixels are chosen the same way as for gdispGFillConvexPoly().
+	 * @note	Memory for the polygon edges is allocated on the heap while drawing.
+	 * 			If there is not enough memory nothing is drawn.
+	 *
+	 * @api
+	 */
+	void gdispGFillPoly(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color, gPolyFill mode);
+	#define gdispFillPoly(x,y,p,i,c,m)						gdispGFillPoly(GDISP,x,y,p,i,c,m)
+#endif
+
+/* Anti-aliased Drawing Functions */
+
+#if GDISP_NEED_ANTIALIAS || defined(__DOXYGEN__)
+	/**
+	 * @brief	Draw an anti-aliased line.
+	 * @pre		GDISP_NEED_ANTIALIAS must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] x0,y0		The start position
+	 * @param[in] x1,y1 	The end position
+	 * @param[in] color		The color to use
+	 *
+	 * @note	Anti-aliasing requires a driver that can read pixels. Without it, pixels that
+	 * 			are more than half covered are drawn and the rest are not.
+	 *
+	 * @api
+	 */
+	void gdispGDrawLineAA(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color);
+	#define gdispDrawLineAA(x0,y0,x1,y1,c)					gdispGDrawLineAA(GDISP,x0,y0,x1,y1,c)
+
+	#if GDISP_NEED_CIRCLE || defined(__DOXYGEN__)
+		/**
+		 * @brief	Draw an anti-aliased circle.
+		 * @pre		GDISP_NEED_ANTIALIAS and GDISP_NEED_CIRCLE must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 		The display to use
+		 * @param[in] x,y		The center of the circle
+		 * @param[in] radius	The radius of the circle
+		 * @param[in] color		The color to use
+		 *
+		 * @note	Anti-aliasing requires a driver that can read pixels. Without it, pixels that
+		 * 			are more than half covered are drawn and the rest are not.
+		 *
+		 * @api
+		 */
+		void gdispGDrawCircleAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color);
+		#define gdispDrawCircleAA(x,y,r,c)					gdispGDrawCircleAA(GDISP,x,y,r,c)
+
+		/**
+		 * @brief	Draw an anti-aliased filled circle.
+		 * @pre		GDISP_NEED_ANTIALIAS and GDISP_NEED_CIRCLE must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 		The display to use
+		 * @param[in] x,y		The center of the circle
+		 * @param[in] radius	The radius of the circle
+		 * @param[in] color		The color to use
+		 *
+		 * @note	Anti-aliasing requires a driver that can read pixels. Without it, pixels that
+		 * 			are more than half covered are drawn and the rest are not.
+		 *
+		 * @api
+		 */
+		void gdispGFillCircleAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color);
+		#define gdispFillCircleAA(x,y,r,c)					gdispGFillCircleAA(GDISP,x,y,r,c)
+	#endif
+
+	#if GDISP_NEED_ARC || defined(__DOXYGEN__)
+		/**
+		 * @brief	Draw an anti-aliased arc.
+		 * @pre		GDISP_NEED_ANTIALIAS and GDISP_NEED_ARC must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 			The display to use
+		 * @param[in] x,y			The center point
+		 * @param[in] radius		The radius of the arc
+		 * @param[in] startangle	The start angle (0 to 360)
+		 * @param[in] endangle		The end angle (0 to 360)
+		 * @param[in] color			The color of the arc
+		 *
+		 * @note		The ends of the arc are anti-aliased as well as its sides.
+		 * @note		This routine requires trig support in the same way as gdispGDrawArc().
+		 * @note		Anti-aliasing requires a driver that can read pixels. Without it, pixels that
+		 * 				are more than half covered are drawn and the rest are not.
+		 *
+		 * @api
+		 */
+		void gdispGDrawArcAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gCoord startangle, gCoord endangle, gColor color);
+		#define gdispDrawArcAA(x,y,r,s,e,c)					gdispGDrawArcAA(GDISP,x,y,r,s,e,c)
+
+		/**
+		 * @brief	Draw an anti-aliased thick arc.
+		 * @pre		GDISP_NEED_ANTIALIAS and GDISP_NEED_ARC must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 			The display to use
+		 * @param[in] xc,yc			The center point
+		 * @param[in] startradius	The inner radius of the thick arc
+		 * @param[in] endradius		The outer radius of the thick arc
+		 * @param[in] startangle	The start angle (0 to 360)
+		 * @param[in] endangle		The end angle (0 to 360)
+		 * @param[in] color			The color of the arc
+		 *
+		 * @note		The ends of the arc are anti-aliased as well as its sides.
+		 * @note		This routine requires trig support in the same way as gdispGDrawThickArc().
+		 * @note		Anti-aliasing requires a driver that can read pixels. Without it, pixels that
+		 * 				are more than half covered are drawn and the rest are not.
+		 *
+		 * @api
+		 */
+		void gdispGDrawThickArcAA(GDisplay *g, gCoord xc, gCoord yc, gCoord startradius, gCoord endradius, gCoord startangle, gCoord endangle, gColor color);
+		#define gdispDrawThickArcAA(x,y,rs,re,s,e,c)		gdispGDrawThickArcAA(GDISP,x,y,rs,re,s,e,c)
+	#endif
+#endif
+
 /* Text Functions */
 
 #if GDISP_NEED_TEXT || defined(__DOXYGEN__)
@@ -1227,6 +1428,34 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 #if GDISP_NEED_PIXMAP || defined(__DOXYGEN__)
 	#include "gdisp_pixmap.h"
 #endif
+#if GDISP_NEED_PIXELKERNELS || defined(__DOXYGEN__)
+	#include "gdisp_kernels.h"
+#endif
+#if GDISP_NEED_CMDLIST || defined(__DOXYGEN__)
+	#include "gdisp_cmdlist.h"
+#endif
+#if GDISP_NEED_CLIPREGION || defined(__DOXYGEN__)
+	#include "gdisp_region.h"
+#endif
+#if GDISP_NEED_STATS || defined(__DOXYGEN__)
+	#include "gdisp_stats.h"
+#endif
+#if GDISP_NEED_COMPOSITE || defined(__DOXYGEN__)
+	#include "gdisp_composite.h"
+#endif
+#if GDISP_NEED_TRANSFORM || defined(__DOXYGEN__)
+	#include "gdisp_transform.h"
+#endif
+#if GDISP_NEED_PAINT || defined(__DOXYGEN__)
+	#include "gdisp_paint.h"
+#endif
+#if GDISP_NEED_VIEWS || defined(__DOXYGEN__)
+	#include "gdisp_view.h"
+	#include "gdisp_tiler.h"
+#endif
+#if GDISP_NEED_ASYNC || defined(__DOXYGEN__)
+	#include "gdisp_async.h"
+#endif
 
 /* V2 compatibility */
 #if GFX_COMPAT_V2
@@ -0,0 +1,139 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_async.h
+ *
+ * @defgroup Async Async
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for flushes and blits that complete in the background.
+ *
+ * @details	An asynchronous flush or blit hands the work to the driver and returns straight away.
+ * 			When the driver has finished it calls an optional callback and signals an optional fence
+ * 			that the application can wait on or poll. This lets the application build the next frame
+ * 			while the last one is still being sent to the display.
+ *
+ * @note	Drivers that can't do the work in the background just do it before the function returns.
+ * 			The callback is still called and the fence is still signalled so the same code runs on
+ * 			any display.
+ * @note	A flush in progress does not stop drawing. The driver has already taken what it needs
+ * 			to show. The next flush waits for it to finish.
+ * @note	A blit in progress is still using the application's buffer and may still be drawing.
+ * 			Everything else on the display waits for it to finish. Don't change the buffer until
+ * 			then.
+ * @pre		GDISP_NEED_ASYNC must be GFXON in your gfxconf.h. This turns on GDISP_NEED_MULTITHREAD.
+ * @{
+ */
+
+#ifndef _GDISP_ASYNC_H
+#define _GDISP_ASYNC_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_ASYNC) || defined(__DOXYGEN__)
+
+/**
+ * @brief	A fence that is signalled when an asynchronous operation completes
+ * @note	The members of this structure are private
+ */
+typedef struct gdispFence {
+	gSem			done;					// Signalled when the operation is complete
+} gdispFence;
+
+/**
+ * @brief	A function called when an asynchronous operation completes
+ *
+ * @param[in] g			The display
+ * @param[in] param		The parameter passed when the operation was started
+ *
+ * @note	This may be called on the driver's thread or before the operation function returns.
+ * 			It must not use the display and should return quickly.
+ */
+typedef void (*gdispAsyncCallback)(GDisplay *g, void *param);
+
+/**
+ * @brief	Initialise a fence
+ *
+ * @param[out] f		The fence
+ *
+ * @note	A new fence is signalled. It is not signalled again until an operation using it completes.
+ *
+ * @api
+ */
+void gdispFenceInit(gdispFence *f);
+
+/**
+ * @brief	Free the resources used by a fence
+ *
+ * @param[in] f			The fence
+ *
+ * @note	The fence must not be in use by an operation.
+ *
+ * @api
+ */
+void gdispFenceDeinit(gdispFence *f);
+
+/**
+ * @brief	Wait for the operation using a fence to complete
+ * @return	gTrue if the operation has completed, gFalse if it timed out
+ *
+ * @param[in] f			The fence
+ * @param[in] ms		The maximum time to wait. Use gDelayNone to poll or gDelayForever.
+ *
+ * @note	The fence stays signalled until it is used for another operation so it can be waited
+ * 			on more than once and by more than one thread.
+ * @note	A fence can be passed to the next flush (or blit) of the same display while it is still
+ * 			waiting for the last one. It is then signalled when the newer one completes.
+ *
+ * @api
+ */
+gBool gdispFenceWait(gdispFence *f, gDelay ms);
+#define gdispFencePoll(f)			gdispFenceWait(f, gDelayNone)
+
+/**
+ * @brief	Flush the display without waiting for the driver to finish
+ *
+ * @param[in] g			The display
+ * @param[in] f			A fence to signal when the flush has completed. Can be NULL.
+ * @param[in] fn		A function to call when the flush has completed. Can be NULL.
+ * @param[in] param		The parameter for the function
+ *
+ * @note	Drawing can continue while the flush is in progress. If a flush is already in progress
+ * 			this first waits for it to complete.
+ * @note	A flush of a view just passes the areas drawn on the view to its display and completes
+ * 			straight away.
+ *
+ * @api
+ */
+void gdispGFlushAsync(GDisplay *g, gdispFence *f, gdispAsyncCallback fn, void *param);
+#define gdispFlushAsync(f,fn,param)		gdispGFlushAsync(GDISP,f,fn,param)
+
+/**
+ * @brief	Fill an area using the supplied bitmap without waiting for the driver to finish
+ * @details	This is the same as @p gdispGBlitArea() except for the completion parameters.
+ *
+ * @param[in] g			The display
+ * @param[in] x,y		The start position
+ * @param[in] cx,cy		The size of the filled area
+ * @param[in] srcx,srcy	The bitmap position to start the fill from
+ * @param[in] srccx		The width of a line in the bitmap
+ * @param[in] buffer	The bitmap in the driver's pixel format
+ * @param[in] f			A fence to signal when the blit has completed. Can be NULL.
+ * @param[in] fn		A function to call when the blit has completed. Can be NULL.
+ * @param[in] param		The parameter for the function
+ *
+ * @note	The buffer must not be changed until the blit has completed. Everything else drawn
+ * 			on the display (including a flush) waits for it to complete.
+ * @note	Blits on a view or with a clip region are done before this returns.
+ *
+ * @api
+ */
+void gdispGBlitAreaAsync(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer, gdispFence *f, gdispAsyncCallback fn, void *param);
+#define gdispBlitAreaAsync(x,y,cx,cy,srcx,srcy,srccx,buffer,f,fn,param)		gdispGBlitAreaAsync(GDISP,x,y,cx,cy,srcx,srcy,srccx,buffer,f,fn,param)
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_ASYNC */
+#endif /* _GDISP_ASYNC_H */
+/** @} */
@@ -0,0 +1,244 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_cmdlist.h
+ *
+ * @defgroup CmdList CmdList
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for batching drawing operations.
+ *
+ * @details	A command list records drawing operations into a buffer supplied by the application.
+ * 			When the list is submitted the operations are all drawn while the display is locked
+ * 			just once, and the display is flushed (if auto flushing) just once at the end.
+ * 			This saves the locking and flushing overheads of lots of small drawing operations
+ * 			such as those made when redrawing a widget.
+ *
+ * @note	The result is exactly the same as making the equivalent gdispGxxx calls in the same order.
+ * @note	If the buffer becomes full the operations recorded so far are submitted and the buffer is reused.
+ * 			An operation that can't fit even in an empty buffer is drawn immediately.
+ * @note	Strings are copied into the buffer. Blit buffers, fonts and images are not and so they must
+ * 			remain valid until the list has been submitted.
+ * @pre		GDISP_NEED_CMDLIST must be GFXON in your gfxconf.h
+ * @{
+ */
+
+#ifndef _GDISP_CMDLIST_H
+#define _GDISP_CMDLIST_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_CMDLIST) || defined(__DOXYGEN__)
+
+/**
+ * @brief	A command list
+ * @note	The members of this structure are private
+ */
+typedef struct gdispCmdList {
+	GDisplay *		display;			// The display the list is drawn on
+	gU8 *			buf;				// The command buffer
+	gMemSize		size;				// The size of the command buffer
+	gMemSize		len;				// The number of bytes used so far
+} gdispCmdList;
+
+/**
+ * @brief	Start recording a command list
+ *
+ * @param[in] g			The display the commands will be drawn on
+ * @param[in] cl		The command list
+ * @param[in] buf		The buffer to record the commands in
+ * @param[in] size		The size of the buffer in bytes
+ *
+ * @note	There is no end function. A list can be submitted as often as required and
+ * 			the buffer can be reused for something else as soon as the list has been submitted.
+ * @note	About 32 bytes is needed for most commands (a little more with 32 bit colors and pointers).
+ *
+ * @api
+ */
+void gdispGCmdListBegin(GDisplay *g, gdispCmdList *cl, void *buf, gMemSize size);
+#define gdispCmdListBegin(cl,buf,size)					gdispGCmdListBegin(GDISP,cl,buf,size)
+
+/**
+ * @brief	Draw all the commands recorded so far and empty the list
+ *
+ * @param[in] cl		The command list
+ *
+ * @note	The display is only locked once for all the commands. Images are the exception
+ * 			as they are decoded through the normal drawing functions. The lock is released
+ * 			while an image is drawn.
+ *
+ * @api
+ */
+void gdispCmdListSubmit(gdispCmdList *cl);
+
+/**
+ * @brief	Record a gdispGClear()
+ *
+ * @param[in] cl		The command list
+ * @param[in] color		The color to use
+ *
+ * @api
+ */
+void gdispCmdListClear(gdispCmdList *cl, gColor color);
+
+/**
+ * @brief	Record a gdispGDrawPixel()
+ *
+ * @param[in] cl		The command list
+ * @param[in] x,y		The position
+ * @param[in] color		The color to use
+ *
+ * @api
+ */
+void gdispCmdListDrawPixel(gdispCmdList *cl, gCoord x, gCoord y, gColor color);
+
+/**
+ * @brief	Record a gdispGDrawLine()
+ *
+ * @param[in] cl		The command list
+ * @param[in] x0,y0		The start position
+ * @param[in] x1,y1 	The end position
+ * @param[in] color		The color to use
+ *
+ * @api
+ */
+void gdispCmdListDrawLine(gdispCmdList *cl, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color);
+
+/**
+ * @brief	Record a gdispGFillArea()
+ *
+ * @param[in] cl		The command list
+ * @param[in] x,y		The start position
+ * @param[in] cx,cy		The size of the box (outside dimensions)
+ * @param[in] color		The color to use
+ *
+ * @api
+ */
+void gdispCmdListFillArea(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color);
+
+/**
+ * @brief	Record a gdispGDrawBox()
+ *
+ * @param[in] cl		The command list
+ * @param[in] x,y		The start position
+ * @param[in] cx,cy		The size of the box (outside dimensions)
+ * @param[in] color		The color to use
+ *
+ * @api
+ */
+void gdispCmdListDrawBox(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color);
+
+/**
+ * @brief	Record a gdispGBlitArea()
+ *
+ * @param[in] cl		The command list
+ * @param[in] x,y		The start position
+ * @param[in] cx,cy		The size of the filled area
+ * @param[in] srcx,srcy	The bitmap position to start the fill from
+ * @param[in] srccx		The width of a line in the bitmap
+ * @param[in] buffer	The bitmap in the driver's pixel format
+ *
+ * @note	The bitmap is not copied. It must remain valid until the list has been submitted.
+ *
+ * @api
+ */
+void gdispCmdListBlitArea(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer);
+
+#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION || defined(__DOXYGEN__)
+	/**
+	 * @brief	Record a gdispGSetClip()
+	 *
+	 * @param[in] cl		The command list
+	 * @param[in] x,y		The start position
+	 * @param[in] cx,cy		The size of the clip area
+	 *
+	 * @note	Just like gdispGSetClip() the clip area stays set after the list has been submitted.
+	 *
+	 * @api
+	 */
+	void gdispCmdListSetClip(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy);
+#endif
+
+#if GDISP_NEED_TEXT || defined(__DOXYGEN__)
+	/**
+	 * @brief	Record a gdispGDrawString()
+	 *
+	 * @param[in] cl		The command list
+	 * @param[in] x,y		The position for the text
+	 * @param[in] str		The string to draw. It is copied into the list.
+	 * @param[in] font		The font to use
+	 * @param[in] color		The color to use
+	 *
+	 * @api
+	 */
+	void gdispCmdListDrawString(gdispCmdList *cl, gCoord x, gCoord y, const char *str, gFont font, gColor color);
+
+	/**
+	 * @brief	Record a gdispGFillString()
+	 *
+	 * @param[in] cl		The command list
+	 * @param[in] x,y		The position for the text
+	 * @param[in] str		The string to draw. It is copied into the list.
+	 * @param[in] font		The font to use
+	 * @param[in] color		The color to use
+	 * @param[in] bgcolor	The background color to use
+	 *
+	 * @api
+	 */
+	void gdispCmdListFillString(gdispCmdList *cl, gCoord x, gCoord y, const char *str, gFont font, gColor color, gColor bgcolor);
+
+	/**
+	 * @brief	Record a gdispGDrawStringBox()
+	 *
+	 * @param[in] cl		The command list
+	 * @param[in] x,y		The position for the text box
+	 * @param[in] cx,cy		The size of the text box
+	 * @param[in] str		The string to draw. It is copied into the list.
+	 * @param[in] font		The font to use
+	 * @param[in] color		The color to use
+	 * @param[in] justify	Justify the text left, center or right within the box
+	 *
+	 * @api
+	 */
+	void gdispCmdListDrawStringBox(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gJustify justify);
+
+	/**
+	 * @brief	Record a gdispGFillStringBox()
+	 *
+	 * @param[in] cl		The command list
+	 * @param[in] x,y		The position for the text box
+	 * @param[in] cx,cy		The size of the text box
+	 * @param[in] str		The string to draw. It is copied into the list.
+	 * @param[in] font		The font to use
+	 * @param[in] color		The color to use
+	 * @param[in] bgcolor	The background color to use
+	 * @param[in] justify	Justify the text left, center or right within the box
+	 *
+	 * @api
+	 */
+	void gdispCmdListFillStringBox(gdispCmdList *cl, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgcolor, gJustify justify);
+#endif
+
+#if GDISP_NEED_IMAGE || defined(__DOXYGEN__)
+	/**
+	 * @brief	Record a gdispGImageDraw()
+	 *
+	 * @param[in] cl		The command list
+	 * @param[in] img		The image structure. It must be open and remain open until the list has been submitted.
+	 * @param[in] x,y		The screen location to draw the image
+	 * @param[in] cx,cy		The area on the screen to draw
+	 * @param[in] sx,sy		The image position to start drawing at
+	 *
+	 * @note	Any error from drawing the image is ignored.
+	 *
+	 * @api
+	 */
+	void gdispCmdListImageDraw(gdispCmdList *cl, gImage *img, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord sx, gCoord sy);
+#endif
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_CMDLIST */
+#endif /* _GDISP_CMDLIST_H */
+/** @} */
@@ -0,0 +1,110 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_composite.h
+ *
+ * @defgroup Composite Composite
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for alpha compositing.
+ *
+ * @details	Compositing draws an area of ARGB8888 pixels onto a display using one of the
+ * 			Porter-Duff operators and a global opacity. This is used for fades, translucent overlays
+ * 			and anti-aliased sprites. The source can be a buffer or a pixmap (usually one created
+ * 			with @p gdispPixmapCreateARGB()).
+ *
+ * @note	ARGB8888 pixels are 32 bit words of the form 0xAARRGGBB. An alpha of 255 is opaque.
+ * 			The color values are not pre-multiplied by the alpha.
+ * @note	Displays have no alpha channel so they are treated as being opaque. The exception is
+ * 			a pixmap created with @p gdispPixmapCreateARGB() which keeps the resulting alpha.
+ * @note	The destination pixels are read a row at a time, composited and written back. This needs
+ * 			a driver that can read pixels. Without that only the source-in operator works and the
+ * 			other operators only draw the source pixels that are more than half opaque.
+ * @pre		GDISP_NEED_COMPOSITE must be GFXON in your gfxconf.h
+ * @{
+ */
+
+#ifndef _GDISP_COMPOSITE_H
+#define _GDISP_COMPOSITE_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_COMPOSITE) || defined(__DOXYGEN__)
+
+/**
+ * @brief	The compositing operators
+ */
+typedef enum gdispCompositeOp {
+	gdispCompositeSrcOver,				/**< The source is drawn over the destination */
+	gdispCompositeSrcIn,				/**< The source replaces the destination where the destination is opaque.
+											On a display without an alpha channel the destination is replaced by the
+											source faded to black by its alpha. */
+	gdispCompositeAdd					/**< The source is added to the destination. The result is limited to white. */
+} gdispCompositeOp;
+
+/**
+ * @brief	Composite an area of ARGB8888 pixels onto a display
+ *
+ * @param[in] g			The display
+ * @param[in] x,y		The start position
+ * @param[in] cx,cy		The size of the area to composite
+ * @param[in] srcx,srcy	The position in the buffer to start from
+ * @param[in] srccx		The width of a line in the buffer
+ * @param[in] buffer	The ARGB8888 pixels
+ * @param[in] op		The compositing operator
+ * @param[in] opacity	The global opacity that the alpha of every source pixel is multiplied by (0 to 255)
+ *
+ * @note	An opacity of 255 uses the source alpha as it is. Reducing the opacity fades the whole area.
+ *
+ * @api
+ */
+void gdispGCompositeArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gU32 *buffer, gdispCompositeOp op, gU8 opacity);
+#define gdispCompositeArea(x,y,cx,cy,srcx,srcy,srccx,buffer,op,opacity)	gdispGCompositeArea(GDISP,x,y,cx,cy,srcx,srcy,srccx,buffer,op,opacity)
+
+#if GDISP_NEED_PIXMAP || defined(__DOXYGEN__)
+	/**
+	 * @brief	Composite an area of a pixmap onto a display
+	 * @pre		GDISP_NEED_PIXMAP must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g			The destination display. This can be a normal display or a pixmap.
+	 * @param[in] x,y		The destination position
+	 * @param[in] cx,cy		The size of the area to composite
+	 * @param[in] src		The source pixmap
+	 * @param[in] srcx,srcy	The position of the area in the source pixmap
+	 * @param[in] op		The compositing operator
+	 * @param[in] opacity	The global opacity that the alpha of every source pixel is multiplied by (0 to 255)
+	 *
+	 * @note	The source is normally a pixmap created with @p gdispPixmapCreateARGB(). The pixels of a pixmap
+	 * 			without an alpha channel are treated as opaque which is useful for fading one pixmap onto a display.
+	 * @note	The source and destination must not be the same pixmap.
+	 * @note	If a normal display is passed as the source, nothing is done.
+	 *
+	 * @api
+	 */
+	void gdispGBlendPixmap(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, GDisplay *src, gCoord srcx, gCoord srcy, gdispCompositeOp op, gU8 opacity);
+	#define gdispBlendPixmap(x,y,cx,cy,src,srcx,srcy,op,opacity)	gdispGBlendPixmap(GDISP,x,y,cx,cy,src,srcx,srcy,op,opacity)
+
+	/**
+	 * @brief	Read and write a row of a pixmap as ARGB8888 pixels
+	 * @note	These are used by the compositing routines. They work on any pixmap and in any orientation.
+	 * 			The pixels of a pixmap without an alpha channel are read as opaque.
+	 *
+	 * @param[in] g			The pixmap
+	 * @param[in] x,y		The start of the row
+	 * @param[in] cnt		The number of pixels
+	 * @param[in] buf		The ARGB8888 pixels
+	 *
+	 * @notapi
+	 * @{
+	 */
+	void _gdispPixmapReadARGB(GDisplay *g, gCoord x, gCoord y, gCoord cnt, gU32 *buf);
+	void _gdispPixmapWriteARGB(GDisplay *g, gCoord x, gCoord y, gCoord cnt, const gU32 *buf);
+	/** @} */
+#endif
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_COMPOSITE */
+#endif /* _GDISP_COMPOSITE_H */
+/** @} */
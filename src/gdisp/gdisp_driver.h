@@ -88,6 +88,29 @@
 		#define GDISP_HARDWARE_FLUSH		HARDWARE_DEFAULT
 	#endif
 
+	/**
+	 * @brief   The display hardware can flush just part of the display.
+	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
+	 *
+	 * @note	HARDWARE_AUTODETECT is only meaningful when GDISP_DRIVER_LIST is defined
+	 * @note	Only used when GDISP_NEED_DIRTYRECTS is GFXON. The driver must also support GDISP_HARDWARE_FLUSH
+	 * 			which is called once the dirty areas have been passed to the driver.
+	 */
+	#ifndef GDISP_HARDWARE_FLUSHAREA
+		#define GDISP_HARDWARE_FLUSHAREA	HARDWARE_DEFAULT
+	#endif
+
+	/**
+	 * @brief   The display hardware can flush in the background.
+	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
+	 *
+	 * @note	HARDWARE_AUTODETECT is only meaningful when GDISP_DRIVER_LIST is defined
+	 * @note	Only used when GDISP_NEED_ASYNC is GFXON. The driver must also support GDISP_HARDWARE_FLUSH.
+	 */
+	#ifndef GDISP_HARDWARE_FLUSHASYNC
+		#define GDISP_HARDWARE_FLUSHASYNC	HARDWARE_DEFAULT
+	#endif
+
 	/**
 	 * @brief   Hardware streaming writing is supported.
 	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
@@ -99,6 +122,17 @@
 		#define GDISP_HARDWARE_STREAM_WRITE		HARDWARE_DEFAULT
 	#endif
 
+	/**
+	 * @brief   Hardware streaming can write a whole run of pixels in one call.
+	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
+	 *
+	 * @note	HARDWARE_AUTODETECT is only meaningful when GDISP_DRIVER_LIST is defined
+	 * @note	This is only used if GDISP_HARDWARE_STREAM_WRITE is also supported.
+	 */
+	#ifndef GDISP_HARDWARE_STREAM_WRITECOLORS
+		#define GDISP_HARDWARE_STREAM_WRITECOLORS	HARDWARE_DEFAULT
+	#endif
+
 	/**
 	 * @brief   Hardware streaming reading of the display surface is supported.
 	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
@@ -165,6 +199,17 @@
 		#define GDISP_HARDWARE_BITFILLS			HARDWARE_DEFAULT
 	#endif
 
+	/**
+	 * @brief   Hardware accelerated fills from an image can be done in the background.
+	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
+	 *
+	 * @note	HARDWARE_AUTODETECT is only meaningful when GDISP_DRIVER_LIST is defined
+	 * @note	Only used when GDISP_NEED_ASYNC is GFXON. The driver must also support GDISP_HARDWARE_BITFILLS.
+	 */
+	#ifndef GDISP_HARDWARE_BITFILLSASYNC
+		#define GDISP_HARDWARE_BITFILLSASYNC	HARDWARE_DEFAULT
+	#endif
+
 	/**
 	 * @brief   Hardware accelerated scrolling.
 	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
@@ -175,6 +220,16 @@
 		#define GDISP_HARDWARE_SCROLL			HARDWARE_DEFAULT
 	#endif
 
+	/**
+	 * @brief   Hardware accelerated copying of an area of the display to another position.
+	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
+	 *
+	 * @note	HARDWARE_AUTODETECT is only meaningful when GDISP_DRIVER_LIST is defined
+	 */
+	#ifndef GDISP_HARDWARE_COPY
+		#define GDISP_HARDWARE_COPY				HARDWARE_DEFAULT
+	#endif
+
 	/**
 	 * @brief   Reading back of pixel values.
 	 * @details Can be set to GFXON, GFXOFF or HARDWARE_AUTODETECT
@@ -242,14 +297,30 @@
 		#undef GDISP_HARDWARE_CONTROL
 		#define GDISP_HARDWARE_CONTROL		HARDWARE_AUTODETECT
 	#endif
+	#if !GDISP_HARDWARE_FILLS
+		#undef GDISP_HARDWARE_FILLS
+		#define GDISP_HARDWARE_FILLS		HARDWARE_AUTODETECT
+	#endif
 	#if GDISP_HARDWARE_FLUSH == GFXON
 		#undef GDISP_HARDWARE_FLUSH
 		#define GDISP_HARDWARE_FLUSH		HARDWARE_AUTODETECT
 	#endif
+	#if GDISP_HARDWARE_FLUSHAREA == GFXON
+		#undef GDISP_HARDWARE_FLUSHAREA
+		#define GDISP_HARDWARE_FLUSHAREA	HARDWARE_AUTODETECT
+	#endif
+	#if GDISP_HARDWARE_FLUSHASYNC == GFXON
+		#undef GDISP_HARDWARE_FLUSHASYNC
+		#define GDISP_HARDWARE_FLUSHASYNC	HARDWARE_AUTODETECT
+	#endif
 	#if GDISP_HARDWARE_STREAM_WRITE == GFXON
 		#undef GDISP_HARDWARE_STREAM_WRITE
 		#define GDISP_HARDWARE_STREAM_WRITE	HARDWARE_AUTODETECT
 	#endif
+	#if GDISP_HARDWARE_STREAM_WRITECOLORS == GFXON
+		#undef GDISP_HARDWARE_STREAM_WRITECOLORS
+		#define GDISP_HARDWARE_STREAM_WRITECOLORS	HARDWARE_AUTODETECT
+	#endif
 	#if GDISP_HARDWARE_STREAM_READ == GFXON
 		#undef GDISP_HARDWARE_STREAM_READ
 		#define GDISP_HARDWARE_STREAM_READ	HARDWARE_AUTODETECT
@@ -266,10 +337,18 @@
 		#undef GDISP_HARDWARE_BITFILLS
 		#define GDISP_HARDWARE_BITFILLS		HARDWARE_AUTODETECT
 	#endif
+	#if GDISP_HARDWARE_BITFILLSASYNC == GFXON
+		#undef GDISP_HARDWARE_BITFILLSASYNC
+		#define GDISP_HARDWARE_BITFILLSASYNC	HARDWARE_AUTODETECT
+	#endif
 	#if GDISP_HARDWARE_SCROLL == GFXON
 		#undef GDISP_HARDWARE_SCROLL
 		#define GDISP_HARDWARE_SCROLL		HARDWARE_AUTODETECT
 	#endif
+	#if GDISP_HARDWARE_COPY == GFXON
+		#undef GDISP_HARDWARE_COPY
+		#define GDISP_HARDWARE_COPY			HARDWARE_AUTODETECT
+	#endif
 	#if GDISP_HARDWARE_QUERY == GFXON
 		#undef GDISP_HARDWARE_QUERY
 		#define GDISP_HARDWARE_QUERY		HARDWARE_AUTODETECT
@@ -334,17 +413,66 @@ struct GDisplay {
 	gU16					flags;
 		#define GDISP_FLG_INSTREAM		0x0001		// We are in a user based stream operation
 		#define GDISP_FLG_SCRSTREAM		0x0002		// The stream area currently covers the whole screen
-		#define GDISP_FLG_DRIVER		0x0004		// This flags and above are for use by the driver
+		#define GDISP_FLG_ASYNCFLUSH	0x0004		// The flush being done can complete in the background
+		#define GDISP_FLG_ASYNCBLIT		0x0008		// The blit being done can complete in the background
+		#define GDISP_FLG_DRIVER		0x0010		// This flags and above are for use by the driver
 
 	// Multithread Mutex
 	#if GDISP_NEED_MULTITHREAD
 		gMutex				mutex;
 	#endif
 
+	// The display this is a view of (if any) and the area of the view
+	#if GDISP_NEED_VIEWS
+		struct GDisplay			*parent;
+		gCoord					viewx0, viewy0;
+		gCoord					viewx1, viewy1;		/* not inclusive */
+	#endif
+
 	// Software clipping
 	#if GDISP_HARDWARE_CLIP != GFXON && (GDISP_NEED_CLIP || GDISP_NEED_VALIDATION)
 		gCoord					clipx0, clipy0;
 		gCoord					clipx1, clipy1;		/* not inclusive */
+		#if GDISP_NEED_CLIPREGION
+			const struct gdispRegion	*clipregion;	// The clip region within the clip area (if any)
+		#endif
+	#endif
+
+	// Areas drawn since the last flush
+	#if GDISP_NEED_DIRTYRECTS
+		gCoord					opx0, opy0;			// The area drawn by the current operation
+		gCoord					opx1, opy1;			/* not inclusive */
+		unsigned				dirtycnt;
+		struct GDISPDirtyRect {
+			gCoord		x0, y0;
+			gCoord		x1, y1;						/* not inclusive */
+		} dirty[GDISP_DIRTYRECTS_MAX];
+	#endif
+
+	// Drawing statistics
+	#if GDISP_NEED_STATS
+		struct {
+			gdispStats				s;
+			unsigned				depth;				// The nesting level of drawing operations
+			gdispStatOp				cur;				// The outermost drawing operation
+			gU32					start;				// When it started
+		} stats;
+	#endif
+
+	// The paint for gradient and pattern fills (if any)
+	#if GDISP_NEED_PAINT
+		const struct gdispPaint		*paint;
+	#endif
+
+	// Flushes and blits the driver is doing in the background
+	#if GDISP_NEED_ASYNC
+		struct GDISPAsync {
+			gSem				idle;				// Signalled when the driver has finished
+			gBool				busy;				// The driver has been given an operation. Only changed with the display locked.
+			gdispFence			*fence;				// What to tell when it completes
+			gdispAsyncCallback	fn;
+			void				*param;
+		} asyncflush, asyncblit;
 	#endif
 
 	// Driver call parameters
@@ -373,7 +501,7 @@ struct GDisplay {
 			#endif
 		} t;
 	#endif
-	#if GDISP_LINEBUF_SIZE != 0 && ((GDISP_NEED_SCROLL && !GDISP_HARDWARE_SCROLL) || (!GDISP_HARDWARE_STREAM_WRITE && GDISP_HARDWARE_BITFILLS))
+	#if GDISP_LINEBUF_SIZE != 0 && ((GDISP_NEED_SCROLL && GDISP_HARDWARE_SCROLL != GFXON) || (GDISP_NEED_COPYAREA && GDISP_HARDWARE_COPY != GFXON) || (GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_BITFILLS) || GDISP_NEED_PAINT)
 		// A pixel line buffer
 		gColor		linebuf[GDISP_LINEBUF_SIZE];
 	#endif
@@ -383,11 +511,13 @@ typedef struct GDISPVMT {
 	GDriverVMT	d;
 		#define GDISP_VFLG_DYNAMICONLY		0x0001		// This display should never be statically initialised
 		#define GDISP_VFLG_PIXMAP			0x0002		// This is a pixmap display
+		#define GDISP_VFLG_CONCURRENT		0x0004		// Drawing on separate areas can be done at the same time (the driver just draws into memory)
 	gBool (*init)(GDisplay *g);
 	void (*deinit)(GDisplay *g);
 	void (*writestart)(GDisplay *g);				// Uses p.x,p.y  p.cx,p.cy
 	void (*writepos)(GDisplay *g);					// Uses p.x,p.y
 	void (*writecolor)(GDisplay *g);				// Uses p.color
+	void (*writecolors)(GDisplay *g);				// Uses p.ptr (=colors)  p.x2 (=count)
 	void (*writestop)(GDisplay *g);					// Uses no parameters
 	void (*readstart)(GDisplay *g);					// Uses p.x,p.y  p.cx,p.cy
 	gColor (*readcolor)(GDisplay *g);				// Uses no parameters
@@ -398,14 +528,50 @@ typedef struct GDISPVMT {
 	void (*blit)(GDisplay *g);						// Uses p.x,p.y  p.cx,p.cy  p.x1,p.y1 (=srcx,srcy)  p.x2 (=srccx), p.ptr (=buffer)
 	gColor (*get)(GDisplay *g);					// Uses p.x,p.y
 	void (*vscroll)(GDisplay *g);					// Uses p.x,p.y  p.cx,p.cy, p.y1 (=lines) p.color
+	void (*copy)(GDisplay *g);						// Uses p.x,p.y  p.cx,p.cy  p.x1,p.y1 (=srcx,srcy)
 	void (*control)(GDisplay *g);					// Uses p.x (=what)  p.ptr (=value)
 	void *(*query)(GDisplay *g);					// Uses p.x (=what);
 	void (*setclip)(GDisplay *g);					// Uses p.x,p.y  p.cx,p.cy
 	void (*flush)(GDisplay *g);						// Uses no parameters
+	void (*flusharea)(GDisplay *g);					// Uses p.x,p.y  p.cx,p.cy
+	void (*flushasync)(GDisplay *g);				// Uses no parameters. Calls _gdispFlushDone() when complete.
+	void (*blitasync)(GDisplay *g);					// Uses the same parameters as blit. Calls _gdispBlitDone() when complete.
 } GDISPVMT;
 
 //------------------------------------------------------------------------------------------------------------
 
+#if GDISP_NEED_ASYNC || defined(__DOXYGEN__)
+	#ifdef __cplusplus
+	extern "C" {
+	#endif
+
+	/**
+	 * @brief   Called by the driver when a background flush has completed
+	 *
+	 * @param[in]	g				The driver structure
+	 *
+	 * @note		This can be called from any thread (but not an interrupt) and even from
+	 * 				within @p gdisp_lld_flush_async() itself.
+	 */
+	void _gdispFlushDone(GDisplay *g);
+
+	/**
+	 * @brief   Called by the driver when a background blit has completed
+	 *
+	 * @param[in]	g				The driver structure
+	 *
+	 * @note		This can be called from any thread (but not an interrupt) and even from
+	 * 				within @p gdisp_lld_blit_area_async() itself.
+	 */
+	void _gdispBlitDone(GDisplay *g);
+
+	#ifdef __cplusplus
+	}
+	#endif
+#endif
+
+//------------------------------------------------------------------------------------------------------------
+
 // Do we need function definitions or macro's (via the VMT)
 #if IN_DRIVER || !USE_VMT || defined(__DOXYGEN__)
 	#ifdef __cplusplus
@@ -450,6 +616,38 @@ typedef struct GDISPVMT {
 		LLDSPEC	void gdisp_lld_flush(GDisplay *g);
 	#endif
 
+	#if (GDISP_HARDWARE_FLUSHAREA && GDISP_NEED_DIRTYRECTS) || defined(__DOXYGEN__)
+		/**
+		 * @brief   Flush part of the display
+		 * @pre		GDISP_HARDWARE_FLUSHAREA is GFXON (and the application needs it)
+		 *
+		 * @param[in]	g				The driver structure
+		 * @param[in]	g->p.x,g->p.y	The area position
+		 * @param[in]	g->p.cx,g->p.cy	The area size
+		 *
+		 * @note		This is called for each dirty area and then @p gdisp_lld_flush() is called.
+		 * 				Drawing outside these areas since the last flush does not need to be sent.
+		 * @note		The parameter variables must not be altered by the driver.
+		 */
+		LLDSPEC	void gdisp_lld_flush_area(GDisplay *g);
+	#endif
+
+	#if (GDISP_HARDWARE_FLUSHASYNC && GDISP_NEED_ASYNC) || defined(__DOXYGEN__)
+		/**
+		 * @brief   Start flushing the current drawing operations to the display
+		 * @pre		GDISP_HARDWARE_FLUSHASYNC is GFXON (and the application needs it)
+		 *
+		 * @param[in]	g				The driver structure
+		 *
+		 * @note		This is called instead of @p gdisp_lld_flush(). The driver must take whatever it
+		 * 				needs to show the frame before returning as drawing continues straight away.
+		 * 				It calls @p _gdispFlushDone() when the flush has completed.
+		 * @note		This is not called again until the flush has completed.
+		 * @note		The parameter variables must not be altered by the driver.
+		 */
+		LLDSPEC	void gdisp_lld_flush_async(GDisplay *g);
+	#endif
+
 	#if GDISP_HARDWARE_STREAM_WRITE || defined(__DOXYGEN__)
 		/**
 		 * @brief   Start a streamed write operation
@@ -478,6 +676,22 @@ typedef struct GDISPVMT {
 		 */
 		LLDSPEC	void gdisp_lld_write_color(GDisplay *g);
 
+		#if GDISP_HARDWARE_STREAM_WRITECOLORS || defined(__DOXYGEN__)
+			/**
+			 * @brief   Send a run of pixels to the current streaming position and then move that position past them
+			 * @pre		GDISP_HARDWARE_STREAM_WRITECOLORS is GFXON and GDISP_HARDWARE_STREAM_WRITE is GFXON
+			 *
+			 * @param[in]	g				The driver structure
+			 * @param[in]	g->p.ptr		The colors to display (an array of gColor)
+			 * @param[in]	g->p.x2			The number of colors (always at least 1)
+			 *
+			 * @note		The result must be the same as calling @p gdisp_lld_write_color() for each color.
+			 * 				The run may wrap onto the next line of the stream window.
+			 * @note		The parameter variables must not be altered by the driver.
+			 */
+			LLDSPEC	void gdisp_lld_write_colors(GDisplay *g);
+		#endif
+
 		/**
 		 * @brief   End the current streaming write operation
 		 * @pre		GDISP_HARDWARE_STREAM_WRITE is GFXON
@@ -598,6 +812,25 @@ typedef struct GDISPVMT {
 		LLDSPEC	void gdisp_lld_blit_area(GDisplay *g);
 	#endif
 
+	#if (GDISP_HARDWARE_BITFILLSASYNC && GDISP_NEED_ASYNC) || defined(__DOXYGEN__)
+		/**
+		 * @brief   Start filling an area using a bitmap
+		 * @pre		GDISP_HARDWARE_BITFILLSASYNC is GFXON (and the application needs it)
+		 *
+		 * @param[in]	g				The driver structure
+		 * @param[in]	g->p.x,g->p.y	The area position
+		 * @param[in]	g->p.cx,g->p.cy	The area size
+		 * @param[in]	g->p.x1,g->p.y1	The starting position in the bitmap
+		 * @param[in]	g->p.x2			The width of a bitmap line
+		 * @param[in]	g->p.ptr		The pointer to the bitmap
+		 *
+		 * @note		The driver calls @p _gdispBlitDone() when the area has been filled.
+		 * 				Nothing else is done on the display until then.
+		 * @note		The parameter variables must not be altered by the driver.
+		 */
+		LLDSPEC	void gdisp_lld_blit_area_async(GDisplay *g);
+	#endif
+
 	#if GDISP_HARDWARE_PIXELREAD || defined(__DOXYGEN__)
 		/**
 		 * @brief   Read a pixel from the display
@@ -631,6 +864,23 @@ typedef struct GDISPVMT {
 		LLDSPEC	void gdisp_lld_vertical_scroll(GDisplay *g);
 	#endif
 
+	#if (GDISP_HARDWARE_COPY && GDISP_NEED_COPYAREA) || defined(__DOXYGEN__)
+		/**
+		 * @brief   Copy an area of the screen to another position on the screen
+		 * @pre		GDISP_HARDWARE_COPY is GFXON (and the application needs it)
+		 *
+		 * @param[in]	g				The driver structure
+		 * @param[in]	g->p.x,g->p.y	The destination position
+		 * @param[in]	g->p.cx,g->p.cy	The area size
+		 * @param[in]	g->p.x1,g->p.y1	The source position
+		 *
+		 * @note		The parameter variables must not be altered by the driver.
+		 * @note		The source and destination can overlap. The result must be the same as
+		 * 				if all the source pixels were read before any were written.
+		 */
+		LLDSPEC	void gdisp_lld_copy_area(GDisplay *g);
+	#endif
+
 	#if (GDISP_HARDWARE_CONTROL && GDISP_NEED_CONTROL) || defined(__DOXYGEN__)
 		/**
 		 * @brief   Control some feature of the hardware
@@ -681,9 +931,12 @@ typedef struct GDISPVMT {
 	#define gdisp_lld_init(g)				gvmt(g)->init(g)
 	#define gdisp_lld_deinit(g)				gvmt(g)->deinit(g)
 	#define gdisp_lld_flush(g)				gvmt(g)->flush(g)
+	#define gdisp_lld_flush_area(g)			gvmt(g)->flusharea(g)
+	#define gdisp_lld_flush_async(g)		gvmt(g)->flushasync(g)
 	#define gdisp_lld_write_start(g)		gvmt(g)->writestart(g)
 	#define gdisp_lld_write_pos(g)			gvmt(g)->writepos(g)
 	#define gdisp_lld_write_color(g)		gvmt(g)->writecolor(g)
+	#define gdisp_lld_write_colors(g)		gvmt(g)->writecolors(g)
 	#define gdisp_lld_write_stop(g)			gvmt(g)->writestop(g)
 	#define gdisp_lld_read_start(g)			gvmt(g)->readstart(g)
 	#define gdisp_lld_read_color(g)			gvmt(g)->readcolor(g)
@@ -692,8 +945,10 @@ typedef struct GDISPVMT {
 	#define gdisp_lld_clear(g)				gvmt(g)->clear(g)
 	#define gdisp_lld_fill_area(g)			gvmt(g)->fill(g)
 	#define gdisp_lld_blit_area(g)			gvmt(g)->blit(g)
+	#define gdisp_lld_blit_area_async(g)	gvmt(g)->blitasync(g)
 	#define gdisp_lld_get_pixel_color(g)	gvmt(g)->get(g)
 	#define gdisp_lld_vertical_scroll(g)	gvmt(g)->vscroll(g)
+	#define gdisp_lld_copy_area(g)			gvmt(g)->copy(g)
 	#define gdisp_lld_control(g)			gvmt(g)->control(g)
 	#define gdisp_lld_query(g)				gvmt(g)->query(g)
 	#define gdisp_lld_set_clip(g)			gvmt(g)->setclip(g)
@@ -733,7 +988,7 @@ typedef struct GDISPVMT {
 
 	// Build the VMT
 	const GDISPVMT const GDISP_DRIVER_VMT[1] = {{
-		{ GDRIVER_TYPE_DISPLAY, 0, sizeof(GDisplay), _gdispInitDriver, _gdispPostInitDriver, _gdispDeInitDriver },
+		{ GDRIVER_TYPE_DISPLAY, GDISP_DRIVER_VMT_FLAGS, sizeof(GDisplay), _gdispInitDriver, _gdispPostInitDriver, _gdispDeInitDriver },
 		gdisp_lld_init,
 		#if GDISP_HARDWARE_DEINIT
 			gdisp_lld_deinit,
@@ -748,9 +1003,14 @@ typedef struct GDISPVMT {
 				0,
 			#endif
 			gdisp_lld_write_color,
+			#if GDISP_HARDWARE_STREAM_WRITECOLORS
+				gdisp_lld_write_colors,
+			#else
+				0,
+			#endif
 			gdisp_lld_write_stop,
 		#else
-			0, 0, 0, 0,
+			0, 0, 0, 0, 0,
 		#endif
 		#if GDISP_HARDWARE_STREAM_READ
 			gdisp_lld_read_start,
@@ -789,6 +1049,11 @@ typedef struct GDISPVMT {
 		#else
 			0,
 		#endif
+		#if GDISP_HARDWARE_COPY && GDISP_NEED_COPYAREA
+			gdisp_lld_copy_area,
+		#else
+			0,
+		#endif
 		#if GDISP_HARDWARE_CONTROL && GDISP_NEED_CONTROL
 			gdisp_lld_control,
 		#else
@@ -809,6 +1074,21 @@ typedef struct GDISPVMT {
 		#else
 			0,
 		#endif
+		#if GDISP_HARDWARE_FLUSHAREA && GDISP_NEED_DIRTYRECTS
+			gdisp_lld_flush_area,
+		#else
+			0,
+		#endif
+		#if GDISP_HARDWARE_FLUSHASYNC && GDISP_NEED_ASYNC
+			gdisp_lld_flush_async,
+		#else
+			0,
+		#endif
+		#if GDISP_HARDWARE_BITFILLSASYNC && GDISP_NEED_ASYNC
+			gdisp_lld_blit_area_async,
+		#else
+			0,
+		#endif
 	}};
 
 	//--------------------------------------------------------------------------------------------------------
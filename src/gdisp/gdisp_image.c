@@ -171,6 +171,10 @@ gdispImageError gdispImageCache(gImage *img) {
 }
 
 gdispImageError gdispGImageDraw(GDisplay *g, gImage *img, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord sx, gCoord sy) {
+	#if GDISP_NEED_STATS
+		gdispImageError		err;
+	#endif
+
 	if (!img) return GDISP_IMAGE_ERR_NULLPOINTER;
 	if (!img->fns) return GDISP_IMAGE_ERR_BADFORMAT;
 
@@ -183,7 +187,14 @@ gdispImageError gdispGImageDraw(GDisplay *g, gImage *img, gCoord x, gCoord y, gC
 	if (sy + cy > img->height) cy = img->height - sy;
 
 	// Draw
-	return img->fns->draw(g, img, x, y, cx, cy, sx, sy);
+	#if GDISP_NEED_STATS
+		_gdispStatBegin(g, gdispStatImage);
+		err = img->fns->draw(g, img, x, y, cx, cy, sx, sy);
+		_gdispStatEnd(g);
+		return err;
+	#else
+		return img->fns->draw(g, img, x, y, cx, cy, sx, sy);
+	#endif
 }
 
 gDelay gdispImageNext(gImage *img) {
@@ -0,0 +1,928 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+#include "../../gfx.h"
+
+#if GFX_USE_GDISP && GDISP_NEED_PIXELKERNELS
+
+#include <string.h>				// For memset and memcpy
+
+// Which SIMD kernels can we build?
+//	x86 kernels are compiled with function target attributes so that a single binary can choose at run-time.
+//	NEON kernels are only built if the compiler is already targeting NEON.
+#if GDISP_PIXELKERNELS_SIMD && (GFX_CPU == GFX_CPU_X86 || GFX_CPU == GFX_CPU_X64) \
+		&& (GFX_COMPILER == GFX_COMPILER_GCC || GFX_COMPILER == GFX_COMPILER_CLANG \
+			|| GFX_COMPILER == GFX_COMPILER_MINGW32 || GFX_COMPILER == GFX_COMPILER_MINGW64)
+	#define KERNELS_X86		GFXON
+	#include <immintrin.h>
+	#define SSE2FN			static __attribute__((target("sse2")))
+	#define AVX2FN			static __attribute__((target("avx2")))
+#else
+	#define KERNELS_X86		GFXOFF
+#endif
+#if GDISP_PIXELKERNELS_SIMD && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+	#define KERNELS_NEON	GFXON
+	#include <arm_neon.h>
+#else
+	#define KERNELS_NEON	GFXOFF
+#endif
+
+// Which blend kernels can use SIMD. Other color formats always blend using gdispBlendColor().
+//	RGB888 is excluded as its gdispBlendColor() is the alpha hacked pre-multiplied version.
+#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB565 || GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_BGR565
+	#define BLEND_565		GFXON
+	#define BLEND_888		GFXOFF
+#elif GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_BGR888
+	#define BLEND_565		GFXOFF
+	#define BLEND_888		GFXON
+#else
+	#define BLEND_565		GFXOFF
+	#define BLEND_888		GFXOFF
+#endif
+
+// Single pixel conversions - these must match gdispColor2Native() for the equivalent formats
+#define CONV888TO565(c)		((gU16)((((c) >> 8) & 0xF800) | (((c) >> 5) & 0x07E0) | (((c) >> 3) & 0x001F)))
+#define CONV888TO565SWAP(c)	((gU16)((((c) << 8) & 0xF800) | (((c) >> 5) & 0x07E0) | (((c) >> 19) & 0x001F)))
+#define CONV565TO888(c)		((((gU32)(c) & 0xF800) << 8) | (((gU32)(c) & 0x07E0) << 5) | (((gU32)(c) & 0x001F) << 3))
+#define CONV565TO888SWAP(c)	((((gU32)(c) & 0xF800) >> 8) | (((gU32)(c) & 0x07E0) << 5) | (((gU32)(c) & 0x001F) << 19))
+#define SWAP888(c)			((((c) >> 16) & 0x0000FF) | ((c) & 0x00FF00) | (((c) & 0x0000FF) << 16))
+#define SWAP565(c)			((gU16)(((c) >> 11) | ((c) & 0x07E0) | ((c) << 11)))
+
+/*===========================================================================*/
+/* Portable C kernels.                                                       */
+/*===========================================================================*/
+
+static void c_fill8(gU8 *dst, gU8 c, unsigned cnt) {
+	memset(dst, c, cnt);
+}
+
+static void c_fill16(gU16 *dst, gU16 c, unsigned cnt) {
+	for(; cnt; cnt--)
+		*dst++ = c;
+}
+
+static void c_fill32(gU32 *dst, gU32 c, unsigned cnt) {
+	for(; cnt; cnt--)
+		*dst++ = c;
+}
+
+static void c_conv888to565(void *dst, const void *src, unsigned cnt) {
+	gU16 *		d = (gU16 *)dst;
+	const gU32 *s = (const gU32 *)src;
+
+	for(; cnt; cnt--, s++)
+		*d++ = CONV888TO565(*s);
+}
+
+static void c_conv888to565swap(void *dst, const void *src, unsigned cnt) {
+	gU16 *		d = (gU16 *)dst;
+	const gU32 *s = (const gU32 *)src;
+
+	for(; cnt; cnt--, s++)
+		*d++ = CONV888TO565SWAP(*s);
+}
+
+static void c_conv565to888(void *dst, const void *src, unsigned cnt) {
+	gU32 *		d = (gU32 *)dst;
+	const gU16 *s = (const gU16 *)src;
+
+	for(; cnt; cnt--, s++)
+		*d++ = CONV565TO888(*s);
+}
+
+static void c_conv565to888swap(void *dst, const void *src, unsigned cnt) {
+	gU32 *		d = (gU32 *)dst;
+	const gU16 *s = (const gU16 *)src;
+
+	for(; cnt; cnt--, s++)
+		*d++ = CONV565TO888SWAP(*s);
+}
+
+static void c_swap888(void *dst, const void *src, unsigned cnt) {
+	gU32 *		d = (gU32 *)dst;
+	const gU32 *s = (const gU32 *)src;
+
+	for(; cnt; cnt--, s++)
+		*d++ = SWAP888(*s);
+}
+
+static void c_swap565(void *dst, const void *src, unsigned cnt) {
+	gU16 *		d = (gU16 *)dst;
+	const gU16 *s = (const gU16 *)src;
+
+	for(; cnt; cnt--, s++)
+		*d++ = SWAP565(*s);
+}
+
+static void c_blend(gPixel *dst, gColor fg, gU8 alpha, unsigned cnt) {
+	for(; cnt; cnt--, dst++)
+		*dst = gdispBlendColor(fg, *dst, alpha);
+}
+
+static void c_blendrow(gPixel *dst, const gPixel *fg, const gPixel *bg, gU8 alpha, unsigned cnt) {
+	for(; cnt; cnt--)
+		*dst++ = gdispBlendColor(*fg++, *bg++, alpha);
+}
+
+static void c_blendmask(gPixel *dst, gColor fg, const gU8 *alpha, unsigned cnt) {
+	for(; cnt; cnt--, dst++)
+		*dst = gdispBlendColor(fg, *dst, *alpha++);
+}
+
+static const gdispKernels kernels_c = {
+	"c",
+	c_fill8, c_fill16, c_fill32,
+	c_conv888to565, c_conv888to565swap, c_conv565to888, c_conv565to888swap, c_swap888, c_swap565,
+	c_blend, c_blendrow, c_blendmask
+};
+
+/*===========================================================================*/
+/* x86 SSE2 kernels.                                                         */
+/*===========================================================================*/
+
+#if KERNELS_X86
+	SSE2FN void sse2_fill16(gU16 *dst, gU16 c, unsigned cnt) {
+		__m128i	v = _mm_set1_epi16((short)c);
+
+		for(; cnt >= 8; cnt -= 8, dst += 8)
+			_mm_storeu_si128((__m128i *)dst, v);
+		c_fill16(dst, c, cnt);
+	}
+
+	SSE2FN void sse2_fill32(gU32 *dst, gU32 c, unsigned cnt) {
+		__m128i	v = _mm_set1_epi32((int)c);
+
+		for(; cnt >= 4; cnt -= 4, dst += 4)
+			_mm_storeu_si128((__m128i *)dst, v);
+		c_fill32(dst, c, cnt);
+	}
+
+	// Pack two vectors of 32 bit lanes each holding a 16 bit value into one vector of 16 bit lanes.
+	//	The values are sign extended first so the signed saturating pack keeps all 16 bits.
+	SSE2FN GFXINLINE __m128i sse2_pack32to16(__m128i a, __m128i b) {
+		a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+		b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+		return _mm_packs_epi32(a, b);
+	}
+
+	SSE2FN GFXINLINE __m128i sse2_888to565(__m128i v) {
+		return _mm_or_si128(_mm_or_si128(
+					_mm_and_si128(_mm_srli_epi32(v, 8), _mm_set1_epi32(0xF800)),
+					_mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32(0x07E0))),
+					_mm_and_si128(_mm_srli_epi32(v, 3), _mm_set1_epi32(0x001F)));
+	}
+
+	SSE2FN GFXINLINE __m128i sse2_888to565swap(__m128i v) {
+		return _mm_or_si128(_mm_or_si128(
+					_mm_and_si128(_mm_slli_epi32(v, 8), _mm_set1_epi32(0xF800)),
+					_mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32(0x07E0))),
+					_mm_and_si128(_mm_srli_epi32(v, 19), _mm_set1_epi32(0x001F)));
+	}
+
+	SSE2FN GFXINLINE __m128i sse2_565to888(__m128i v) {
+		return _mm_or_si128(_mm_or_si128(
+					_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF800)), 8),
+					_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x07E0)), 5)),
+					_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x001F)), 3));
+	}
+
+	SSE2FN GFXINLINE __m128i sse2_565to888swap(__m128i v) {
+		return _mm_or_si128(_mm_or_si128(
+					_mm_srli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xF800)), 8),
+					_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x07E0)), 5)),
+					_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x001F)), 19));
+	}
+
+	SSE2FN void sse2_conv888to565(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU32 *s = (const gU32 *)src;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8)
+			_mm_storeu_si128((__m128i *)d, sse2_pack32to16(
+					sse2_888to565(_mm_loadu_si128((const __m128i *)s)),
+					sse2_888to565(_mm_loadu_si128((const __m128i *)(s+4)))));
+		c_conv888to565(d, s, cnt);
+	}
+
+	SSE2FN void sse2_conv888to565swap(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU32 *s = (const gU32 *)src;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8)
+			_mm_storeu_si128((__m128i *)d, sse2_pack32to16(
+					sse2_888to565swap(_mm_loadu_si128((const __m128i *)s)),
+					sse2_888to565swap(_mm_loadu_si128((const __m128i *)(s+4)))));
+		c_conv888to565swap(d, s, cnt);
+	}
+
+	SSE2FN void sse2_conv565to888(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU16 *s = (const gU16 *)src;
+		__m128i		v;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8) {
+			v = _mm_loadu_si128((const __m128i *)s);
+			_mm_storeu_si128((__m128i *)d, sse2_565to888(_mm_unpacklo_epi16(v, _mm_setzero_si128())));
+			_mm_storeu_si128((__m128i *)(d+4), sse2_565to888(_mm_unpackhi_epi16(v, _mm_setzero_si128())));
+		}
+		c_conv565to888(d, s, cnt);
+	}
+
+	SSE2FN void sse2_conv565to888swap(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU16 *s = (const gU16 *)src;
+		__m128i		v;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8) {
+			v = _mm_loadu_si128((const __m128i *)s);
+			_mm_storeu_si128((__m128i *)d, sse2_565to888swap(_mm_unpacklo_epi16(v, _mm_setzero_si128())));
+			_mm_storeu_si128((__m128i *)(d+4), sse2_565to888swap(_mm_unpackhi_epi16(v, _mm_setzero_si128())));
+		}
+		c_conv565to888swap(d, s, cnt);
+	}
+
+	SSE2FN void sse2_swap888(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU32 *s = (const gU32 *)src;
+		__m128i		v;
+
+		for(; cnt >= 4; cnt -= 4, s += 4, d += 4) {
+			v = _mm_loadu_si128((const __m128i *)s);
+			v = _mm_or_si128(_mm_or_si128(
+					_mm_and_si128(_mm_srli_epi32(v, 16), _mm_set1_epi32(0x0000FF)),
+					_mm_and_si128(v, _mm_set1_epi32(0x00FF00))),
+					_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x0000FF)), 16));
+			_mm_storeu_si128((__m128i *)d, v);
+		}
+		c_swap888(d, s, cnt);
+	}
+
+	SSE2FN void sse2_swap565(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU16 *s = (const gU16 *)src;
+		__m128i		v;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8) {
+			v = _mm_loadu_si128((const __m128i *)s);
+			v = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(v, 11), _mm_and_si128(v, _mm_set1_epi16(0x07E0))), _mm_slli_epi16(v, 11));
+			_mm_storeu_si128((__m128i *)d, v);
+		}
+		c_swap565(d, s, cnt);
+	}
+
+	#if BLEND_565
+		// Blend 8 pixels. fa = alpha+1, ba = 256-alpha
+		//	Each channel is expanded to 8 bits exactly as RED_OF() etc do, so the
+		//	sums (at most 252*257) always fit in the unsigned 16 bit lanes.
+		SSE2FN GFXINLINE __m128i sse2_mix(__m128i f, __m128i b, __m128i fa, __m128i ba) {
+			__m128i	r, g, bl;
+
+			r = _mm_add_epi16(
+					_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(f, 8), _mm_set1_epi16(0xF8)), fa),
+					_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(b, 8), _mm_set1_epi16(0xF8)), ba));
+			g = _mm_add_epi16(
+					_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(f, 3), _mm_set1_epi16(0xFC)), fa),
+					_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(b, 3), _mm_set1_epi16(0xFC)), ba));
+			bl = _mm_add_epi16(
+					_mm_mullo_epi16(_mm_and_si128(_mm_slli_epi16(f, 3), _mm_set1_epi16(0xF8)), fa),
+					_mm_mullo_epi16(_mm_and_si128(_mm_slli_epi16(b, 3), _mm_set1_epi16(0xF8)), ba));
+			return _mm_or_si128(_mm_or_si128(
+					_mm_and_si128(r, _mm_set1_epi16((short)0xF800)),
+					_mm_and_si128(_mm_srli_epi16(g, 5), _mm_set1_epi16(0x07E0))),
+					_mm_srli_epi16(bl, 11));
+		}
+		#define SSE2_PIXELS		8
+
+		// As per sse2_mix() but with a separate alpha for each pixel
+		SSE2FN GFXINLINE __m128i sse2_mixa(__m128i f, __m128i b, const gU8 *alpha) {
+			__m128i	a;
+
+			a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)alpha), _mm_setzero_si128());
+			return sse2_mix(f, b, _mm_add_epi16(a, _mm_set1_epi16(1)), _mm_sub_epi16(_mm_set1_epi16(256), a));
+		}
+	#elif BLEND_888
+		// Blend 4 pixels. fa = alpha+1, ba = 256-alpha
+		//	The sums (at most 255*257) always fit in the unsigned 16 bit lanes.
+		SSE2FN GFXINLINE __m128i sse2_mix(__m128i f, __m128i b, __m128i fa, __m128i ba) {
+			__m128i	lo, hi;
+
+			lo = _mm_add_epi16(
+					_mm_mullo_epi16(_mm_unpacklo_epi8(f, _mm_setzero_si128()), fa),
+					_mm_mullo_epi16(_mm_unpacklo_epi8(b, _mm_setzero_si128()), ba));
+			hi = _mm_add_epi16(
+					_mm_mullo_epi16(_mm_unpackhi_epi8(f, _mm_setzero_si128()), fa),
+					_mm_mullo_epi16(_mm_unpackhi_epi8(b, _mm_setzero_si128()), ba));
+			return _mm_and_si128(_mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)), _mm_set1_epi32(0x00FFFFFF));
+		}
+		#define SSE2_PIXELS		4
+
+		// As per sse2_mix() but with a separate alpha for each pixel.
+		//	Each alpha is repeated across the 4 channel lanes of its pixel.
+		SSE2FN GFXINLINE __m128i sse2_mixa(__m128i f, __m128i b, const gU8 *alpha) {
+			__m128i	a, alo, ahi, lo, hi;
+			gU32	a4;
+
+			memcpy(&a4, alpha, 4);
+			a = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)a4), _mm_setzero_si128());
+			a = _mm_unpacklo_epi16(a, a);
+			alo = _mm_unpacklo_epi32(a, a);
+			ahi = _mm_unpackhi_epi32(a, a);
+			lo = _mm_add_epi16(
+					_mm_mullo_epi16(_mm_unpacklo_epi8(f, _mm_setzero_si128()), _mm_add_epi16(alo, _mm_set1_epi16(1))),
+					_mm_mullo_epi16(_mm_unpacklo_epi8(b, _mm_setzero_si128()), _mm_sub_epi16(_mm_set1_epi16(256), alo)));
+			hi = _mm_add_epi16(
+					_mm_mullo_epi16(_mm_unpackhi_epi8(f, _mm_setzero_si128()), _mm_add_epi16(ahi, _mm_set1_epi16(1))),
+					_mm_mullo_epi16(_mm_unpackhi_epi8(b, _mm_setzero_si128()), _mm_sub_epi16(_mm_set1_epi16(256), ahi)));
+			return _mm_and_si128(_mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)), _mm_set1_epi32(0x00FFFFFF));
+		}
+	#endif
+
+	#if BLEND_565 || BLEND_888
+		SSE2FN void sse2_blend(gPixel *dst, gColor fg, gU8 alpha, unsigned cnt) {
+			__m128i	f, b, fa, ba;
+
+			f = SSE2_PIXELS == 8 ? _mm_set1_epi16((short)fg) : _mm_set1_epi32((int)fg);
+			fa = _mm_set1_epi16((short)alpha + 1);
+			ba = _mm_set1_epi16(256 - (short)alpha);
+			for(; cnt >= SSE2_PIXELS; cnt -= SSE2_PIXELS, dst += SSE2_PIXELS) {
+				b = _mm_loadu_si128((const __m128i *)dst);
+				_mm_storeu_si128((__m128i *)dst, sse2_mix(f, b, fa, ba));
+			}
+			c_blend(dst, fg, alpha, cnt);
+		}
+
+		SSE2FN void sse2_blendrow(gPixel *dst, const gPixel *fg, const gPixel *bg, gU8 alpha, unsigned cnt) {
+			__m128i	f, b, fa, ba;
+
+			fa = _mm_set1_epi16((short)alpha + 1);
+			ba = _mm_set1_epi16(256 - (short)alpha);
+			for(; cnt >= SSE2_PIXELS; cnt -= SSE2_PIXELS, dst += SSE2_PIXELS, fg += SSE2_PIXELS, bg += SSE2_PIXELS) {
+				f = _mm_loadu_si128((const __m128i *)fg);
+				b = _mm_loadu_si128((const __m128i *)bg);
+				_mm_storeu_si128((__m128i *)dst, sse2_mix(f, b, fa, ba));
+			}
+			c_blendrow(dst, fg, bg, alpha, cnt);
+		}
+
+		SSE2FN void sse2_blendmask(gPixel *dst, gColor fg, const gU8 *alpha, unsigned cnt) {
+			__m128i	f, b;
+
+			f = SSE2_PIXELS == 8 ? _mm_set1_epi16((short)fg) : _mm_set1_epi32((int)fg);
+			for(; cnt >= SSE2_PIXELS; cnt -= SSE2_PIXELS, dst += SSE2_PIXELS, alpha += SSE2_PIXELS) {
+				b = _mm_loadu_si128((const __m128i *)dst);
+				_mm_storeu_si128((__m128i *)dst, sse2_mixa(f, b, alpha));
+			}
+			c_blendmask(dst, fg, alpha, cnt);
+		}
+	#else
+		#define sse2_blend		c_blend
+		#define sse2_blendrow	c_blendrow
+		#define sse2_blendmask	c_blendmask
+	#endif
+
+	static const gdispKernels kernels_sse2 = {
+		"sse2",
+		c_fill8, sse2_fill16, sse2_fill32,
+		sse2_conv888to565, sse2_conv888to565swap, sse2_conv565to888, sse2_conv565to888swap, sse2_swap888, sse2_swap565,
+		sse2_blend, sse2_blendrow, sse2_blendmask
+	};
+#endif
+
+/*===========================================================================*/
+/* x86 AVX2 kernels.                                                         */
+/*===========================================================================*/
+
+#if KERNELS_X86
+	AVX2FN void avx2_fill16(gU16 *dst, gU16 c, unsigned cnt) {
+		__m256i	v = _mm256_set1_epi16((short)c);
+
+		for(; cnt >= 16; cnt -= 16, dst += 16)
+			_mm256_storeu_si256((__m256i *)dst, v);
+		c_fill16(dst, c, cnt);
+	}
+
+	AVX2FN void avx2_fill32(gU32 *dst, gU32 c, unsigned cnt) {
+		__m256i	v = _mm256_set1_epi32((int)c);
+
+		for(; cnt >= 8; cnt -= 8, dst += 8)
+			_mm256_storeu_si256((__m256i *)dst, v);
+		c_fill32(dst, c, cnt);
+	}
+
+	// As per sse2_pack32to16() but the pack works within each 128 bit lane so the 64 bit quarters need re-ordering.
+	AVX2FN GFXINLINE __m256i avx2_pack32to16(__m256i a, __m256i b) {
+		a = _mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16);
+		b = _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16);
+		return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+	}
+
+	AVX2FN GFXINLINE __m256i avx2_888to565(__m256i v) {
+		return _mm256_or_si256(_mm256_or_si256(
+					_mm256_and_si256(_mm256_srli_epi32(v, 8), _mm256_set1_epi32(0xF800)),
+					_mm256_and_si256(_mm256_srli_epi32(v, 5), _mm256_set1_epi32(0x07E0))),
+					_mm256_and_si256(_mm256_srli_epi32(v, 3), _mm256_set1_epi32(0x001F)));
+	}
+
+	AVX2FN GFXINLINE __m256i avx2_888to565swap(__m256i v) {
+		return _mm256_or_si256(_mm256_or_si256(
+					_mm256_and_si256(_mm256_slli_epi32(v, 8), _mm256_set1_epi32(0xF800)),
+					_mm256_and_si256(_mm256_srli_epi32(v, 5), _mm256_set1_epi32(0x07E0))),
+					_mm256_and_si256(_mm256_srli_epi32(v, 19), _mm256_set1_epi32(0x001F)));
+	}
+
+	AVX2FN GFXINLINE __m256i avx2_565to888(__m256i v) {
+		return _mm256_or_si256(_mm256_or_si256(
+					_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0xF800)), 8),
+					_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0x07E0)), 5)),
+					_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0x001F)), 3));
+	}
+
+	AVX2FN GFXINLINE __m256i avx2_565to888swap(__m256i v) {
+		return _mm256_or_si256(_mm256_or_si256(
+					_mm256_srli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0xF800)), 8),
+					_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0x07E0)), 5)),
+					_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0x001F)), 19));
+	}
+
+	AVX2FN void avx2_conv888to565(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU32 *s = (const gU32 *)src;
+
+		for(; cnt >= 16; cnt -= 16, s += 16, d += 16)
+			_mm256_storeu_si256((__m256i *)d, avx2_pack32to16(
+					avx2_888to565(_mm256_loadu_si256((const __m256i *)s)),
+					avx2_888to565(_mm256_loadu_si256((const __m256i *)(s+8)))));
+		c_conv888to565(d, s, cnt);
+	}
+
+	AVX2FN void avx2_conv888to565swap(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU32 *s = (const gU32 *)src;
+
+		for(; cnt >= 16; cnt -= 16, s += 16, d += 16)
+			_mm256_storeu_si256((__m256i *)d, avx2_pack32to16(
+					avx2_888to565swap(_mm256_loadu_si256((const __m256i *)s)),
+					avx2_888to565swap(_mm256_loadu_si256((const __m256i *)(s+8)))));
+		c_conv888to565swap(d, s, cnt);
+	}
+
+	AVX2FN void avx2_conv565to888(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU16 *s = (const gU16 *)src;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8)
+			_mm256_storeu_si256((__m256i *)d, avx2_565to888(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)s))));
+		c_conv565to888(d, s, cnt);
+	}
+
+	AVX2FN void avx2_conv565to888swap(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU16 *s = (const gU16 *)src;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8)
+			_mm256_storeu_si256((__m256i *)d, avx2_565to888swap(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)s))));
+		c_conv565to888swap(d, s, cnt);
+	}
+
+	AVX2FN void avx2_swap888(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU32 *s = (const gU32 *)src;
+		__m256i		v;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8) {
+			v = _mm256_loadu_si256((const __m256i *)s);
+			v = _mm256_or_si256(_mm256_or_si256(
+					_mm256_and_si256(_mm256_srli_epi32(v, 16), _mm256_set1_epi32(0x0000FF)),
+					_mm256_and_si256(v, _mm256_set1_epi32(0x00FF00))),
+					_mm256_slli_epi32(_mm256_and_si256(v, _mm256_set1_epi32(0x0000FF)), 16));
+			_mm256_storeu_si256((__m256i *)d, v);
+		}
+		c_swap888(d, s, cnt);
+	}
+
+	AVX2FN void avx2_swap565(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU16 *s = (const gU16 *)src;
+		__m256i		v;
+
+		for(; cnt >= 16; cnt -= 16, s += 16, d += 16) {
+			v = _mm256_loadu_si256((const __m256i *)s);
+			v = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi16(v, 11), _mm256_and_si256(v, _mm256_set1_epi16(0x07E0))), _mm256_slli_epi16(v, 11));
+			_mm256_storeu_si256((__m256i *)d, v);
+		}
+		c_swap565(d, s, cnt);
+	}
+
+	#if BLEND_565
+		// As per sse2_mix() but for 16 pixels
+		AVX2FN GFXINLINE __m256i avx2_mix(__m256i f, __m256i b, __m256i fa, __m256i ba) {
+			__m256i	r, g, bl;
+
+			r = _mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(f, 8), _mm256_set1_epi16(0xF8)), fa),
+					_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(b, 8), _mm256_set1_epi16(0xF8)), ba));
+			g = _mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(f, 3), _mm256_set1_epi16(0xFC)), fa),
+					_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi16(b, 3), _mm256_set1_epi16(0xFC)), ba));
+			bl = _mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_and_si256(_mm256_slli_epi16(f, 3), _mm256_set1_epi16(0xF8)), fa),
+					_mm256_mullo_epi16(_mm256_and_si256(_mm256_slli_epi16(b, 3), _mm256_set1_epi16(0xF8)), ba));
+			return _mm256_or_si256(_mm256_or_si256(
+					_mm256_and_si256(r, _mm256_set1_epi16((short)0xF800)),
+					_mm256_and_si256(_mm256_srli_epi16(g, 5), _mm256_set1_epi16(0x07E0))),
+					_mm256_srli_epi16(bl, 11));
+		}
+		#define AVX2_PIXELS		16
+
+		// As per sse2_mixa() but for 16 pixels
+		AVX2FN GFXINLINE __m256i avx2_mixa(__m256i f, __m256i b, const gU8 *alpha) {
+			__m256i	a;
+
+			a = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)alpha));
+			return avx2_mix(f, b, _mm256_add_epi16(a, _mm256_set1_epi16(1)), _mm256_sub_epi16(_mm256_set1_epi16(256), a));
+		}
+	#elif BLEND_888
+		// As per sse2_mix() but for 8 pixels. The unpacks and pack all work within 128 bit lanes so they cancel out.
+		AVX2FN GFXINLINE __m256i avx2_mix(__m256i f, __m256i b, __m256i fa, __m256i ba) {
+			__m256i	lo, hi;
+
+			lo = _mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_unpacklo_epi8(f, _mm256_setzero_si256()), fa),
+					_mm256_mullo_epi16(_mm256_unpacklo_epi8(b, _mm256_setzero_si256()), ba));
+			hi = _mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_unpackhi_epi8(f, _mm256_setzero_si256()), fa),
+					_mm256_mullo_epi16(_mm256_unpackhi_epi8(b, _mm256_setzero_si256()), ba));
+			return _mm256_and_si256(_mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8)), _mm256_set1_epi32(0x00FFFFFF));
+		}
+		#define AVX2_PIXELS		8
+
+		// As per sse2_mixa() but for 8 pixels. Each 128 bit lane gets the alphas for its own 4 pixels.
+		AVX2FN GFXINLINE __m256i avx2_mixa(__m256i f, __m256i b, const gU8 *alpha) {
+			__m256i	a, alo, ahi, lo, hi;
+
+			a = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)alpha));
+			a = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+			alo = _mm256_unpacklo_epi32(a, a);
+			ahi = _mm256_unpackhi_epi32(a, a);
+			lo = _mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_unpacklo_epi8(f, _mm256_setzero_si256()), _mm256_add_epi16(alo, _mm256_set1_epi16(1))),
+					_mm256_mullo_epi16(_mm256_unpacklo_epi8(b, _mm256_setzero_si256()), _mm256_sub_epi16(_mm256_set1_epi16(256), alo)));
+			hi = _mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_unpackhi_epi8(f, _mm256_setzero_si256()), _mm256_add_epi16(ahi, _mm256_set1_epi16(1))),
+					_mm256_mullo_epi16(_mm256_unpackhi_epi8(b, _mm256_setzero_si256()), _mm256_sub_epi16(_mm256_set1_epi16(256), ahi)));
+			return _mm256_and_si256(_mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8)), _mm256_set1_epi32(0x00FFFFFF));
+		}
+	#endif
+
+	#if BLEND_565 || BLEND_888
+		AVX2FN void avx2_blend(gPixel *dst, gColor fg, gU8 alpha, unsigned cnt) {
+			__m256i	f, b, fa, ba;
+
+			f = AVX2_PIXELS == 16 ? _mm256_set1_epi16((short)fg) : _mm256_set1_epi32((int)fg);
+			fa = _mm256_set1_epi16((short)alpha + 1);
+			ba = _mm256_set1_epi16(256 - (short)alpha);
+			for(; cnt >= AVX2_PIXELS; cnt -= AVX2_PIXELS, dst += AVX2_PIXELS) {
+				b = _mm256_loadu_si256((const __m256i *)dst);
+				_mm256_storeu_si256((__m256i *)dst, avx2_mix(f, b, fa, ba));
+			}
+			c_blend(dst, fg, alpha, cnt);
+		}
+
+		AVX2FN void avx2_blendrow(gPixel *dst, const gPixel *fg, const gPixel *bg, gU8 alpha, unsigned cnt) {
+			__m256i	f, b, fa, ba;
+
+			fa = _mm256_set1_epi16((short)alpha + 1);
+			ba = _mm256_set1_epi16(256 - (short)alpha);
+			for(; cnt >= AVX2_PIXELS; cnt -= AVX2_PIXELS, dst += AVX2_PIXELS, fg += AVX2_PIXELS, bg += AVX2_PIXELS) {
+				f = _mm256_loadu_si256((const __m256i *)fg);
+				b = _mm256_loadu_si256((const __m256i *)bg);
+				_mm256_storeu_si256((__m256i *)dst, avx2_mix(f, b, fa, ba));
+			}
+			c_blendrow(dst, fg, bg, alpha, cnt);
+		}
+
+		AVX2FN void avx2_blendmask(gPixel *dst, gColor fg, const gU8 *alpha, unsigned cnt) {
+			__m256i	f, b;
+
+			f = AVX2_PIXELS == 16 ? _mm256_set1_epi16((short)fg) : _mm256_set1_epi32((int)fg);
+			for(; cnt >= AVX2_PIXELS; cnt -= AVX2_PIXELS, dst += AVX2_PIXELS, alpha += AVX2_PIXELS) {
+				b = _mm256_loadu_si256((const __m256i *)dst);
+				_mm256_storeu_si256((__m256i *)dst, avx2_mixa(f, b, alpha));
+			}
+			c_blendmask(dst, fg, alpha, cnt);
+		}
+	#else
+		#define avx2_blend		c_blend
+		#define avx2_blendrow	c_blendrow
+		#define avx2_blendmask	c_blendmask
+	#endif
+
+	static const gdispKernels kernels_avx2 = {
+		"avx2",
+		c_fill8, avx2_fill16, avx2_fill32,
+		avx2_conv888to565, avx2_conv888to565swap, avx2_conv565to888, avx2_conv565to888swap, avx2_swap888, avx2_swap565,
+		avx2_blend, avx2_blendrow, avx2_blendmask
+	};
+#endif
+
+/*===========================================================================*/
+/* ARM NEON kernels.                                                         */
+/*===========================================================================*/
+
+#if KERNELS_NEON
+	static void neon_fill16(gU16 *dst, gU16 c, unsigned cnt) {
+		uint16x8_t	v = vdupq_n_u16(c);
+
+		for(; cnt >= 8; cnt -= 8, dst += 8)
+			vst1q_u16(dst, v);
+		c_fill16(dst, c, cnt);
+	}
+
+	static void neon_fill32(gU32 *dst, gU32 c, unsigned cnt) {
+		uint32x4_t	v = vdupq_n_u32(c);
+
+		for(; cnt >= 4; cnt -= 4, dst += 4)
+			vst1q_u32(dst, v);
+		c_fill32(dst, c, cnt);
+	}
+
+	static GFXINLINE uint16x4_t neon_888to565(uint32x4_t v) {
+		return vmovn_u32(vorrq_u32(vorrq_u32(
+					vandq_u32(vshrq_n_u32(v, 8), vdupq_n_u32(0xF800)),
+					vandq_u32(vshrq_n_u32(v, 5), vdupq_n_u32(0x07E0))),
+					vandq_u32(vshrq_n_u32(v, 3), vdupq_n_u32(0x001F))));
+	}
+
+	static GFXINLINE uint16x4_t neon_888to565swap(uint32x4_t v) {
+		return vmovn_u32(vorrq_u32(vorrq_u32(
+					vandq_u32(vshlq_n_u32(v, 8), vdupq_n_u32(0xF800)),
+					vandq_u32(vshrq_n_u32(v, 5), vdupq_n_u32(0x07E0))),
+					vandq_u32(vshrq_n_u32(v, 19), vdupq_n_u32(0x001F))));
+	}
+
+	static GFXINLINE uint32x4_t neon_565to888(uint16x4_t c) {
+		uint32x4_t	v = vmovl_u16(c);
+
+		return vorrq_u32(vorrq_u32(
+					vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0xF800)), 8),
+					vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0x07E0)), 5)),
+					vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0x001F)), 3));
+	}
+
+	static GFXINLINE uint32x4_t neon_565to888swap(uint16x4_t c) {
+		uint32x4_t	v = vmovl_u16(c);
+
+		return vorrq_u32(vorrq_u32(
+					vshrq_n_u32(vandq_u32(v, vdupq_n_u32(0xF800)), 8),
+					vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0x07E0)), 5)),
+					vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0x001F)), 19));
+	}
+
+	static void neon_conv888to565(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU32 *s = (const gU32 *)src;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8)
+			vst1q_u16(d, vcombine_u16(neon_888to565(vld1q_u32(s)), neon_888to565(vld1q_u32(s+4))));
+		c_conv888to565(d, s, cnt);
+	}
+
+	static void neon_conv888to565swap(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU32 *s = (const gU32 *)src;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8)
+			vst1q_u16(d, vcombine_u16(neon_888to565swap(vld1q_u32(s)), neon_888to565swap(vld1q_u32(s+4))));
+		c_conv888to565swap(d, s, cnt);
+	}
+
+	static void neon_conv565to888(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU16 *s = (const gU16 *)src;
+		uint16x8_t	v;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8) {
+			v = vld1q_u16(s);
+			vst1q_u32(d, neon_565to888(vget_low_u16(v)));
+			vst1q_u32(d+4, neon_565to888(vget_high_u16(v)));
+		}
+		c_conv565to888(d, s, cnt);
+	}
+
+	static void neon_conv565to888swap(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU16 *s = (const gU16 *)src;
+		uint16x8_t	v;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8) {
+			v = vld1q_u16(s);
+			vst1q_u32(d, neon_565to888swap(vget_low_u16(v)));
+			vst1q_u32(d+4, neon_565to888swap(vget_high_u16(v)));
+		}
+		c_conv565to888swap(d, s, cnt);
+	}
+
+	static void neon_swap888(void *dst, const void *src, unsigned cnt) {
+		gU32 *		d = (gU32 *)dst;
+		const gU32 *s = (const gU32 *)src;
+		uint32x4_t	v;
+
+		for(; cnt >= 4; cnt -= 4, s += 4, d += 4) {
+			v = vld1q_u32(s);
+			v = vorrq_u32(vorrq_u32(
+					vandq_u32(vshrq_n_u32(v, 16), vdupq_n_u32(0x0000FF)),
+					vandq_u32(v, vdupq_n_u32(0x00FF00))),
+					vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0x0000FF)), 16));
+			vst1q_u32(d, v);
+		}
+		c_swap888(d, s, cnt);
+	}
+
+	static void neon_swap565(void *dst, const void *src, unsigned cnt) {
+		gU16 *		d = (gU16 *)dst;
+		const gU16 *s = (const gU16 *)src;
+		uint16x8_t	v;
+
+		for(; cnt >= 8; cnt -= 8, s += 8, d += 8) {
+			v = vld1q_u16(s);
+			v = vorrq_u16(vorrq_u16(vshrq_n_u16(v, 11), vandq_u16(v, vdupq_n_u16(0x07E0))), vshlq_n_u16(v, 11));
+			vst1q_u16(d, v);
+		}
+		c_swap565(d, s, cnt);
+	}
+
+	#if BLEND_565
+		// As per sse2_mix()
+		typedef uint16x8_t	neonpix;
+		#define neon_load(p)		vld1q_u16((const gU16 *)(p))
+		#define neon_store(p, v)	vst1q_u16((gU16 *)(p), (v))
+		#define neon_dup(c)			vdupq_n_u16((gU16)(c))
+		#define NEON_PIXELS			8
+		static GFXINLINE neonpix neon_mix(neonpix f, neonpix b, uint16x8_t fa, uint16x8_t ba) {
+			uint16x8_t	r, g, bl;
+
+			r = vmlaq_u16(vmulq_u16(vandq_u16(vshrq_n_u16(f, 8), vdupq_n_u16(0xF8)), fa),
+					vandq_u16(vshrq_n_u16(b, 8), vdupq_n_u16(0xF8)), ba);
+			g = vmlaq_u16(vmulq_u16(vandq_u16(vshrq_n_u16(f, 3), vdupq_n_u16(0xFC)), fa),
+					vandq_u16(vshrq_n_u16(b, 3), vdupq_n_u16(0xFC)), ba);
+			bl = vmlaq_u16(vmulq_u16(vandq_u16(vshlq_n_u16(f, 3), vdupq_n_u16(0xF8)), fa),
+					vandq_u16(vshlq_n_u16(b, 3), vdupq_n_u16(0xF8)), ba);
+			return vorrq_u16(vorrq_u16(
+					vandq_u16(r, vdupq_n_u16(0xF800)),
+					vandq_u16(vshrq_n_u16(g, 5), vdupq_n_u16(0x07E0))),
+					vshrq_n_u16(bl, 11));
+		}
+		// As per neon_mix() but with a separate alpha for each pixel
+		static GFXINLINE neonpix neon_mixa(neonpix f, neonpix b, const gU8 *alpha) {
+			uint16x8_t	a;
+
+			a = vmovl_u8(vld1_u8(alpha));
+			return neon_mix(f, b, vaddq_u16(a, vdupq_n_u16(1)), vsubq_u16(vdupq_n_u16(256), a));
+		}
+	#elif BLEND_888
+		// As per sse2_mix()
+		typedef uint32x4_t	neonpix;
+		#define neon_load(p)		vld1q_u32((const gU32 *)(p))
+		#define neon_store(p, v)	vst1q_u32((gU32 *)(p), (v))
+		#define neon_dup(c)			vdupq_n_u32((gU32)(c))
+		#define NEON_PIXELS			4
+		static GFXINLINE neonpix neon_mix(neonpix f, neonpix b, uint16x8_t fa, uint16x8_t ba) {
+			uint8x16_t	f8, b8;
+			uint16x8_t	lo, hi;
+
+			f8 = vreinterpretq_u8_u32(f);
+			b8 = vreinterpretq_u8_u32(b);
+			lo = vmlaq_u16(vmulq_u16(vmovl_u8(vget_low_u8(f8)), fa), vmovl_u8(vget_low_u8(b8)), ba);
+			hi = vmlaq_u16(vmulq_u16(vmovl_u8(vget_high_u8(f8)), fa), vmovl_u8(vget_high_u8(b8)), ba);
+			return vandq_u32(vreinterpretq_u32_u8(vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8))), vdupq_n_u32(0x00FFFFFF));
+		}
+		// As per neon_mix() but with a separate alpha for each pixel.
+		//	Each alpha is repeated across the 4 channel lanes of its pixel.
+		static GFXINLINE neonpix neon_mixa(neonpix f, neonpix b, const gU8 *alpha) {
+			uint8x16_t	f8, b8;
+			uint16x8_t	alo, ahi, lo, hi;
+
+			f8 = vreinterpretq_u8_u32(f);
+			b8 = vreinterpretq_u8_u32(b);
+			alo = vcombine_u16(vdup_n_u16(alpha[0]), vdup_n_u16(alpha[1]));
+			ahi = vcombine_u16(vdup_n_u16(alpha[2]), vdup_n_u16(alpha[3]));
+			lo = vmlaq_u16(vmulq_u16(vmovl_u8(vget_low_u8(f8)), vaddq_u16(alo, vdupq_n_u16(1))), vmovl_u8(vget_low_u8(b8)), vsubq_u16(vdupq_n_u16(256), alo));
+			hi = vmlaq_u16(vmulq_u16(vmovl_u8(vget_high_u8(f8)), vaddq_u16(ahi, vdupq_n_u16(1))), vmovl_u8(vget_high_u8(b8)), vsubq_u16(vdupq_n_u16(256), ahi));
+			return vandq_u32(vreinterpretq_u32_u8(vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8))), vdupq_n_u32(0x00FFFFFF));
+		}
+	#endif
+
+	#if BLEND_565 || BLEND_888
+		static void neon_blend(gPixel *dst, gColor fg, gU8 alpha, unsigned cnt) {
+			neonpix		f, b;
+			uint16x8_t	fa, ba;
+
+			f = neon_dup(fg);
+			fa = vdupq_n_u16((gU16)alpha + 1);
+			ba = vdupq_n_u16(256 - (gU16)alpha);
+			for(; cnt >= NEON_PIXELS; cnt -= NEON_PIXELS, dst += NEON_PIXELS) {
+				b = neon_load(dst);
+				neon_store(dst, neon_mix(f, b, fa, ba));
+			}
+			c_blend(dst, fg, alpha, cnt);
+		}
+
+		static void neon_blendrow(gPixel *dst, const gPixel *fg, const gPixel *bg, gU8 alpha, unsigned cnt) {
+			neonpix		f, b;
+			uint16x8_t	fa, ba;
+
+			fa = vdupq_n_u16((gU16)alpha + 1);
+			ba = vdupq_n_u16(256 - (gU16)alpha);
+			for(; cnt >= NEON_PIXELS; cnt -= NEON_PIXELS, dst += NEON_PIXELS, fg += NEON_PIXELS, bg += NEON_PIXELS) {
+				f = neon_load(fg);
+				b = neon_load(bg);
+				neon_store(dst, neon_mix(f, b, fa, ba));
+			}
+			c_blendrow(dst, fg, bg, alpha, cnt);
+		}
+
+		static void neon_blendmask(gPixel *dst, gColor fg, const gU8 *alpha, unsigned cnt) {
+			neonpix		f, b;
+
+			f = neon_dup(fg);
+			for(; cnt >= NEON_PIXELS; cnt -= NEON_PIXELS, dst += NEON_PIXELS, alpha += NEON_PIXELS) {
+				b = neon_load(dst);
+				neon_store(dst, neon_mixa(f, b, alpha));
+			}
+			c_blendmask(dst, fg, alpha, cnt);
+		}
+	#else
+		#define neon_blend		c_blend
+		#define neon_blendrow	c_blendrow
+		#define neon_blendmask	c_blendmask
+	#endif
+
+	static const gdispKernels kernels_neon = {
+		"neon",
+		c_fill8, neon_fill16, neon_fill32,
+		neon_conv888to565, neon_conv888to565swap, neon_conv565to888, neon_conv565to888swap, neon_swap888, neon_swap565,
+		neon_blend, neon_blendrow, neon_blendmask
+	};
+#endif
+
+/*===========================================================================*/
+/* Kernel selection.                                                         */
+/*===========================================================================*/
+
+const gdispKernels *gdispKernel = &kernels_c;
+
+void _gdispKernelsInit(void) {
+	#if KERNELS_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+			gdispKernel = &kernels_avx2;
+		else if (__builtin_cpu_supports("sse2"))
+			gdispKernel = &kernels_sse2;
+	#elif KERNELS_NEON
+		gdispKernel = &kernels_neon;
+	#endif
+}
+
+const gdispKernels *gdispKernelGetSet(unsigned n) {
+	if (!n--)
+		return &kernels_c;
+	#if KERNELS_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("sse2") && !n--)
+			return &kernels_sse2;
+		if (__builtin_cpu_supports("avx2") && !n--)
+			return &kernels_avx2;
+	#elif KERNELS_NEON
+		if (!n--)
+			return &kernels_neon;
+	#endif
+	return 0;
+}
+
+gdispKernelConvertFn gdispKernelGetConverter(unsigned dstfmt, unsigned srcfmt) {
+	gBool	swap;
+
+	// Only the RGB and BGR variants of 565 and 888 are supported
+	if (((dstfmt & GDISP_COLORSYSTEM_MASK) != GDISP_COLORSYSTEM_RGB && (dstfmt & GDISP_COLORSYSTEM_MASK) != GDISP_COLORSYSTEM_BGR)
+			|| ((srcfmt & GDISP_COLORSYSTEM_MASK) != GDISP_COLORSYSTEM_RGB && (srcfmt & GDISP_COLORSYSTEM_MASK) != GDISP_COLORSYSTEM_BGR))
+		return 0;
+	swap = (dstfmt & GDISP_COLORSYSTEM_MASK) != (srcfmt & GDISP_COLORSYSTEM_MASK);
+
+	switch(((srcfmt & 0x0FFF) << 12) | (dstfmt & 0x0FFF)) {
+	case 0x888565:
+		return swap ? gdispKernel->conv888to565swap : gdispKernel->conv888to565;
+	case 0x565888:
+		return swap ? gdispKernel->conv565to888swap : gdispKernel->conv565to888;
+	case 0x888888:
+		return swap ? gdispKernel->swap888 : 0;
+	case 0x565565:
+		return swap ? gdispKernel->swap565 : 0;
+	}
+	return 0;
+}
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_PIXELKERNELS */
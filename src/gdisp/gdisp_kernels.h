@@ -0,0 +1,128 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_kernels.h
+ *
+ * @defgroup Kernels Kernels
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for row based pixel operations.
+ *
+ * @details	The pixel kernels are the inner loops used by drivers and by the GDISP software fallbacks
+ * 			to fill, color convert and blend rows of pixels. A portable C version is always available.
+ * 			On x86/x64 with GCC or Clang, SSE2 and AVX2 versions are also built and the best one the
+ * 			CPU supports is selected at run-time during gfxInit(). On ARM a NEON version is used when
+ * 			the compiler is targeting NEON.
+ *
+ * @note	All versions produce identical results.
+ * @note	Pixel counts are in pixels, not bytes. Source and destination rows must not partially overlap.
+ * @note	For the conversion routines, 888 pixels are held in 32 bit words and 565 pixels in 16 bit words.
+ * @pre		GDISP_NEED_PIXELKERNELS must be GFXON in your gfxconf.h
+ * @{
+ */
+
+#ifndef _GDISP_KERNELS_H
+#define _GDISP_KERNELS_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_PIXELKERNELS) || defined(__DOXYGEN__)
+
+/**
+ * @brief	A row color conversion routine
+ *
+ * @param[out] dst		The destination row
+ * @param[in] src		The source row
+ * @param[in] cnt		The number of pixels to convert
+ */
+typedef void (*gdispKernelConvertFn)(void *dst, const void *src, unsigned cnt);
+
+/**
+ * @brief	A set of pixel kernels
+ */
+typedef struct gdispKernels {
+	const char *			name;																	/**< The name of this kernel set eg. "sse2" */
+	void (*fill8)(gU8 *dst, gU8 c, unsigned cnt);													/**< Fill a row of 8 bit pixels */
+	void (*fill16)(gU16 *dst, gU16 c, unsigned cnt);												/**< Fill a row of 16 bit pixels */
+	void (*fill32)(gU32 *dst, gU32 c, unsigned cnt);												/**< Fill a row of 32 bit pixels */
+	gdispKernelConvertFn	conv888to565;															/**< RGB888 to RGB565 (or BGR888 to BGR565) */
+	gdispKernelConvertFn	conv888to565swap;														/**< RGB888 to BGR565 (or BGR888 to RGB565) */
+	gdispKernelConvertFn	conv565to888;															/**< RGB565 to RGB888 (or BGR565 to BGR888) */
+	gdispKernelConvertFn	conv565to888swap;														/**< RGB565 to BGR888 (or BGR565 to RGB888) */
+	gdispKernelConvertFn	swap888;																/**< RGB888 to BGR888 (or the reverse) */
+	gdispKernelConvertFn	swap565;																/**< RGB565 to BGR565 (or the reverse) */
+	void (*blend)(gPixel *dst, gColor fg, gU8 alpha, unsigned cnt);									/**< dst[i] = gdispBlendColor(fg, dst[i], alpha) */
+	void (*blendrow)(gPixel *dst, const gPixel *fg, const gPixel *bg, gU8 alpha, unsigned cnt);		/**< dst[i] = gdispBlendColor(fg[i], bg[i], alpha) */
+	void (*blendmask)(gPixel *dst, gColor fg, const gU8 *alpha, unsigned cnt);						/**< dst[i] = gdispBlendColor(fg, dst[i], alpha[i]) */
+} gdispKernels;
+
+/**
+ * @brief	The pixel kernels in use
+ * @note	This is set to the portable C kernels until gfxInit() selects the best set for the CPU.
+ */
+extern const gdispKernels *gdispKernel;
+
+/**
+ * @brief	Get one of the kernel sets this CPU can run
+ * @return	The kernel set or 0 if there are no more
+ *
+ * @param[in] n			The index of the kernel set. Index 0 is always the portable C kernels.
+ *
+ * @note	This is intended for testing and benchmarking the kernels. Drawing always uses @p gdispKernel.
+ */
+const gdispKernels *gdispKernelGetSet(unsigned n);
+
+/**
+ * @brief	Get the row conversion routine between two pixel formats
+ * @return	The conversion routine or 0 if the conversion is not supported
+ *
+ * @param[in] dstfmt	The destination pixel format eg. GDISP_PIXELFORMAT_RGB565
+ * @param[in] srcfmt	The source pixel format eg. GDISP_PIXELFORMAT_RGB888
+ *
+ * @note	The conversions match gdispColor2Native() and gdispNative2Color() when
+ * 			GDISP_HARDWARE_USE_EXACT_COLOR is GFXOFF.
+ * @note	Identical formats return 0 as the caller can just copy the pixels.
+ */
+gdispKernelConvertFn gdispKernelGetConverter(unsigned dstfmt, unsigned srcfmt);
+
+/**
+ * @brief	Fill a row of pixels with a color
+ *
+ * @param[out] dst		The pixels to fill
+ * @param[in] c			The color
+ * @param[in] cnt		The number of pixels
+ */
+#if COLOR_TYPE_BITS == 8
+	#define gdispKernelFillColor(dst, c, cnt)				gdispKernel->fill8((gU8 *)(dst), (gU8)(c), (cnt))
+#elif COLOR_TYPE_BITS == 16
+	#define gdispKernelFillColor(dst, c, cnt)				gdispKernel->fill16((gU16 *)(dst), (gU16)(c), (cnt))
+#else
+	#define gdispKernelFillColor(dst, c, cnt)				gdispKernel->fill32((gU32 *)(dst), (gU32)(c), (cnt))
+#endif
+
+/**
+ * @brief	Blend a row of foreground colors with a row of background colors
+ * @details	The row equivalent of gdispBlendColor()
+ *
+ * @param[out] dst		The resulting colors. This may be the same as @p fg or @p bg
+ * @param[in] fg		The foreground colors
+ * @param[in] bg		The background colors
+ * @param[in] alpha		The alpha value (0 = all background, 255 = all foreground)
+ * @param[in] cnt		The number of pixels
+ */
+#define gdispBlendColorRow(dst, fg, bg, alpha, cnt)			gdispKernel->blendrow((dst), (fg), (bg), (alpha), (cnt))
+
+/**
+ * @brief	Initialise the pixel kernels
+ * @note	Called by the GDISP module during gfxInit()
+ *
+ * @notapi
+ */
+void _gdispKernelsInit(void);
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_PIXELKERNELS */
+#endif /* _GDISP_KERNELS_H */
+/** @} */
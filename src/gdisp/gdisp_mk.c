@@ -21,6 +21,8 @@
 #include "gdisp.c"
 #include "gdisp_fonts.c"
 #include "gdisp_pixmap.c"
+#include "gdisp_kernels.c"
+#include "gdisp_region.c"
 #include "gdisp_image.c"
 #include "gdisp_image_native.c"
 #include "gdisp_image_gif.c"
@@ -47,6 +47,29 @@
 	#ifndef GDISP_NEED_TIMERFLUSH
 		#define GDISP_NEED_TIMERFLUSH			GFXOFF
 	#endif
+	/**
+	 * @brief   Should the areas drawn since the last flush be tracked.
+	 * @details	Defaults to GFXOFF
+	 * @note	When GFXON, flushing a display with nothing drawn since the last flush does nothing.
+	 * 			Drivers that support partial updates (GDISP_HARDWARE_FLUSHAREA) are
+	 * 			then only sent the areas that have changed.
+	 * @note	Applications that write directly to display memory must call
+	 * 			@p gdispGMarkDirty() for those areas.
+	 */
+	#ifndef GDISP_NEED_DIRTYRECTS
+		#define GDISP_NEED_DIRTYRECTS			GFXOFF
+	#endif
+	/**
+	 * @brief   Should drawing be done off-screen and only shown when the display is flushed.
+	 * @details	Defaults to GFXOFF
+	 * @note	This prevents partly drawn frames and tearing. Each call to @p gdispGFlush()
+	 * 			(or the timer or auto flush) presents a complete frame.
+	 * @note	Only supported by some drivers. Others ignore it.
+	 * @note	GDISP_NEED_DIRTYRECTS reduces the amount of copying needed to present each frame.
+	 */
+	#ifndef GDISP_NEED_DOUBLEBUFFER
+		#define GDISP_NEED_DOUBLEBUFFER			GFXOFF
+	#endif
 	/**
 	 * @brief   Should all operations be clipped to the screen and colors validated.
 	 * @details	Defaults to GFXON.
@@ -141,6 +164,16 @@
 	#ifndef GDISP_NEED_CONVEX_POLYGON
 		#define GDISP_NEED_CONVEX_POLYGON		GFXOFF
 	#endif
+	/**
+	 * @brief   Are general polygon functions needed.
+	 * @details	Defaults to GFXOFF
+	 * @note	These fill any polygon including concave and self-intersecting ones.
+	 * 			They are slower than the convex polygon functions and need
+	 * 			some heap to hold the polygon edges.
+	 */
+	#ifndef GDISP_NEED_POLYGON
+		#define GDISP_NEED_POLYGON				GFXOFF
+	#endif
 	/**
 	 * @brief   Are scrolling functions needed.
 	 * @details	Defaults to GFXOFF
@@ -151,6 +184,15 @@
 	#ifndef GDISP_NEED_SCROLL
 		#define GDISP_NEED_SCROLL				GFXOFF
 	#endif
+	/**
+	 * @brief   Is copying an area of the display to another position needed.
+	 * @details	Defaults to GFXOFF
+	 * @note	Adds gdispGCopyArea(). Drivers that can't copy in hardware use the line buffer
+	 * 			and need to be able to read pixels back.
+	 */
+	#ifndef GDISP_NEED_COPYAREA
+		#define GDISP_NEED_COPYAREA				GFXOFF
+	#endif
 	/**
 	 * @brief   Is the capability to read pixels back needed.
 	 * @details	Defaults to GFXOFF
@@ -192,6 +234,69 @@
 	#ifndef GDISP_NEED_PIXMAP
 		#define GDISP_NEED_PIXMAP				GFXOFF
 	#endif
+	/**
+	 * @brief   Are the optimised pixel kernels required.
+	 * @details	Defaults to GFXOFF
+	 * @note	These are row based fill, color conversion and blending routines used by
+	 * 			some drivers and the GDISP software fallbacks. SIMD versions are selected at run-time.
+	 */
+	#ifndef GDISP_NEED_PIXELKERNELS
+		#define GDISP_NEED_PIXELKERNELS			GFXOFF
+	#endif
+	/**
+	 * @brief   Are command lists required.
+	 * @details	Defaults to GFXOFF
+	 * @note	A command list records drawing operations and then draws them all
+	 * 			while only locking and flushing the display once.
+	 */
+	#ifndef GDISP_NEED_CMDLIST
+		#define GDISP_NEED_CMDLIST				GFXOFF
+	#endif
+	/**
+	 * @brief   Are clip regions required.
+	 * @details	Defaults to GFXOFF
+	 * @note	A clip region is a clip area made up of any number of rectangles.
+	 * 			It turns on GDISP_NEED_CLIP.
+	 */
+	#ifndef GDISP_NEED_CLIPREGION
+		#define GDISP_NEED_CLIPREGION			GFXOFF
+	#endif
+	/**
+	 * @brief   Are drawing statistics required.
+	 * @details	Defaults to GFXOFF
+	 * @note	Counts the calls, pixels and time for each type of drawing operation
+	 * 			and each driver routine. This slows down drawing.
+	 */
+	#ifndef GDISP_NEED_STATS
+		#define GDISP_NEED_STATS				GFXOFF
+	#endif
+	/**
+	 * @brief   Is alpha compositing required.
+	 * @details	Defaults to GFXOFF
+	 * @note	Adds gdispGCompositeArea() and (with pixmaps) gdispGBlendPixmap()
+	 * 			for drawing ARGB8888 pixels with the Porter-Duff operators.
+	 */
+	#ifndef GDISP_NEED_COMPOSITE
+		#define GDISP_NEED_COMPOSITE			GFXOFF
+	#endif
+	/**
+	 * @brief   Are scaled and rotated blits required.
+	 * @details	Defaults to GFXOFF
+	 * @note	Adds gdispGBlitAreaTransformed() for drawing a pixel buffer through a 2D matrix.
+	 * 			This turns on GFX_USE_GMISC and GMISC_NEED_MATRIXFIXED2D.
+	 */
+	#ifndef GDISP_NEED_TRANSFORM
+		#define GDISP_NEED_TRANSFORM			GFXOFF
+	#endif
+	/**
+	 * @brief   Are gradient and pattern fills required.
+	 * @details	Defaults to GFXOFF
+	 * @note	Adds gdispGFillAreaPaint() and the other paint fill functions.
+	 * @note	This requires GDISP_LINEBUF_SIZE to be non-zero.
+	 */
+	#ifndef GDISP_NEED_PAINT
+		#define GDISP_NEED_PAINT				GFXOFF
+	#endif
 /**
  * @}
  *
@@ -205,6 +310,33 @@
 	#ifndef GDISP_NEED_MULTITHREAD
 		#define GDISP_NEED_MULTITHREAD			GFXOFF
 	#endif
+	/**
+	 * @brief   Are views for drawing on separate areas of a display at the same time required.
+	 * @details	Defaults to GFXOFF
+	 * @note	Adds gdispGViewCreate(). This turns on GDISP_NEED_CLIP.
+	 */
+	#ifndef GDISP_NEED_VIEWS
+		#define GDISP_NEED_VIEWS				GFXOFF
+	#endif
+	/**
+	 * @brief   Is a tiler for drawing command lists on several threads at once required.
+	 * @details	Defaults to GFXOFF
+	 * @note	Adds gdispGTilerInit(). This turns on GDISP_NEED_CMDLIST, GDISP_NEED_VIEWS
+	 * 			and GDISP_NEED_MULTITHREAD.
+	 */
+	#ifndef GDISP_NEED_TILER
+		#define GDISP_NEED_TILER				GFXOFF
+	#endif
+	/**
+	 * @brief   Are asynchronous flushes and blits required.
+	 * @details	Defaults to GFXOFF
+	 * @note	Adds gdispGFlushAsync() and gdispGBlitAreaAsync(). These return while the driver is
+	 * 			still working and signal a fence and/or call a callback when it has finished.
+	 * 			This turns on GDISP_NEED_MULTITHREAD.
+	 */
+	#ifndef GDISP_NEED_ASYNC
+		#define GDISP_NEED_ASYNC				GFXOFF
+	#endif
 /**
  * @}
  *
@@ -248,6 +380,55 @@
 	#ifndef GDISP_LINEBUF_SIZE
 		#define GDISP_LINEBUF_SIZE				128
 	#endif
+	/**
+	 * @brief   The maximum number of separate dirty areas tracked for each display.
+	 * @details	Defaults to 8
+	 * @note	Only used when GDISP_NEED_DIRTYRECTS is GFXON.
+	 * @note	Each drawing operation adds its bounding box. Boxes are merged when that wastes
+	 * 			less area than the two boxes themselves, or when the list is full.
+	 */
+	#ifndef GDISP_DIRTYRECTS_MAX
+		#define GDISP_DIRTYRECTS_MAX			8
+	#endif
+	/**
+	 * @brief   The number of display pages to use for double buffering.
+	 * @details	Defaults to 2
+	 * @note	Only used when GDISP_NEED_DOUBLEBUFFER is GFXON.
+	 * @note	Set to 3 for triple buffering. This lets drawing continue while a flushed frame is waiting to
+	 * 			be shown. It only helps on hardware that can flip between display pages.
+	 */
+	#ifndef GDISP_DOUBLEBUFFER_PAGES
+		#define GDISP_DOUBLEBUFFER_PAGES		2
+	#endif
+	/**
+	 * @brief   The clock used to time drawing operations.
+	 * @details	Defaults to gfxSystemTicks()
+	 * @note	Only used when GDISP_NEED_STATS is GFXON.
+	 * @note	Define this as a high resolution counter (eg. a cpu cycle counter) to time short operations.
+	 * 			It must return an unsigned value that wraps at 32 bits.
+	 */
+	#ifndef GDISP_STATS_CLOCK
+		#define GDISP_STATS_CLOCK()				gfxSystemTicks()
+	#endif
+	/**
+	 * @brief   The number of worker threads each tiler starts.
+	 * @details	Defaults to 3
+	 * @note	Only used when GDISP_NEED_TILER is GFXON.
+	 * @note	The thread that submits a list also draws tiles so set this to one less than
+	 * 			the number of cpu cores.
+	 */
+	#ifndef GDISP_TILER_THREADS
+		#define GDISP_TILER_THREADS				3
+	#endif
+	/**
+	 * @brief   The stack size of each tiler worker thread.
+	 * @details	Defaults to 2048
+	 * @note	Only used when GDISP_NEED_TILER is GFXON.
+	 * @note	Drawing images and text on a worker needs more stack.
+	 */
+	#ifndef GDISP_TILER_STACKSIZE
+		#define GDISP_TILER_STACKSIZE			2048
+	#endif
 /**
  * @}
  *
@@ -607,8 +788,10 @@
 		#define GDISP_NEED_TEXT_KERNING			GFXOFF
 	#endif
 	/**
-	 * @brief	Enable antialiased font support
+	 * @brief	Enable antialiased font support and the anti-aliased drawing functions
 	 * @details	Defaults to GFXOFF
+	 * @note	This adds gdispDrawLineAA() and (if their shapes are turned on) the
+	 * 			anti-aliased circle and arc functions.
 	 */
 	#ifndef GDISP_NEED_ANTIALIAS
 		#define GDISP_NEED_ANTIALIAS			GFXOFF
@@ -622,6 +805,24 @@
 	#ifndef GDISP_NEED_PIXMAP_IMAGE
 		#define GDISP_NEED_PIXMAP_IMAGE			GFXOFF
 	#endif
+/**
+ * @}
+ *
+ * @name	GDISP Pixel Kernel Options
+ * @pre		GDISP_NEED_PIXELKERNELS must be GFXON
+ * @{
+ */
+	/**
+	 * @brief	Build the SIMD versions of the pixel kernels.
+	 * @details	Defaults to GFXON
+	 * @note	SSE2 and AVX2 versions are built for x86/x64 when using GCC or Clang and the
+	 * 			best one is selected at run-time. A NEON version is built for ARM when the compiler
+	 * 			is targeting NEON. Otherwise only the portable C versions are built.
+	 * @note	Set this to GFXOFF to always use the portable C versions.
+	 */
+	#ifndef GDISP_PIXELKERNELS_SIMD
+		#define GDISP_PIXELKERNELS_SIMD			GFXON
+	#endif
 /**
  * @}
  *
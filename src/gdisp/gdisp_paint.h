@@ -0,0 +1,169 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_paint.h
+ *
+ * @defgroup Paint Paint
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for gradient and pattern fills.
+ *
+ * @details	A paint describes the color of every pixel of a fill instead of a single color.
+ * 			The colors of each line of the fill are calculated into the line buffer and sent
+ * 			to the driver as a single blit (or stream) so a gradient costs about the same
+ * 			as a blit of the same size.
+ *
+ * @note	Paint positions are display coordinates and are not relative to the shape being filled.
+ * 			This allows several shapes to share one paint (eg. a gradient across a row of buttons).
+ * @note	The paint is only read while a fill is drawing. It can be on the stack.
+ * @note	Gradients are calculated in 8 bit per channel RGB and then converted to the display color format.
+ * @pre		GDISP_NEED_PAINT must be GFXON in your gfxconf.h
+ * @pre		GDISP_LINEBUF_SIZE must not be zero.
+ * @{
+ */
+
+#ifndef _GDISP_PAINT_H
+#define _GDISP_PAINT_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_PAINT) || defined(__DOXYGEN__)
+
+/**
+ * @brief	The type of a paint
+ */
+typedef enum gdispPaintType {
+	gdispPaintLinear,					/**< A gradient between two points */
+	gdispPaintRadial,					/**< A gradient from a center point out to a radius */
+	gdispPaintPattern					/**< A repeating area of pixels */
+} gdispPaintType;
+
+/**
+ * @brief	A paint
+ * @note	Use the gdispPaintSetXXX() functions to initialise it rather than setting the members directly.
+ */
+typedef struct gdispPaint {
+	gdispPaintType	type;				/**< The type of paint */
+	gCoord			x, y;				/**< The start point, the center or the pattern origin */
+	gCoord			cx, cy;				/**< The size of the pattern */
+	const gPixel	*bits;				/**< The pattern pixels */
+	gU32			rgb0, rgb1;			/**< The gradient colors as 8 bit per channel RGB */
+	gI32			kx, ky;				/**< The gradient position change per pixel (24 fractional bits) */
+	gCoord			radius;				/**< The radial gradient radius */
+	gU32			rk;					/**< The radial gradient scale */
+} gdispPaint;
+
+/**
+ * @brief	Initialise a linear gradient
+ *
+ * @param[out] paint	The paint
+ * @param[in] x0,y0		The point with the first color
+ * @param[in] x1,y1		The point with the second color
+ * @param[in] color0	The first color
+ * @param[in] color1	The second color
+ *
+ * @note	The color changes along the line from x0,y0 to x1,y1 and is constant across it.
+ * 			Pixels before x0,y0 have the first color and pixels beyond x1,y1 have the second color.
+ * @note	If the two points are the same the whole fill is the first color.
+ *
+ * @api
+ */
+void gdispPaintSetLinear(gdispPaint *paint, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color0, gColor color1);
+
+/**
+ * @brief	Initialise a radial gradient
+ *
+ * @param[out] paint	The paint
+ * @param[in] x,y		The center
+ * @param[in] radius	The radius
+ * @param[in] color0	The color at the center
+ * @param[in] color1	The color at the radius and beyond
+ *
+ * @api
+ */
+void gdispPaintSetRadial(gdispPaint *paint, gCoord x, gCoord y, gCoord radius, gColor color0, gColor color1);
+
+/**
+ * @brief	Initialise a pattern
+ *
+ * @param[out] paint	The paint
+ * @param[in] x,y		The display position of the top left pixel of the pattern
+ * @param[in] cx,cy		The size of the pattern
+ * @param[in] bits		The pattern pixels. This must stay valid while the paint is used.
+ *
+ * @note	The pattern repeats in both directions to cover the whole fill.
+ *
+ * @api
+ */
+void gdispPaintSetPattern(gdispPaint *paint, gCoord x, gCoord y, gCoord cx, gCoord cy, const gPixel *bits);
+
+/**
+ * @brief	Fill an area with a paint
+ *
+ * @param[in] g			The display
+ * @param[in] x,y		The start position
+ * @param[in] cx,cy		The size of the area
+ * @param[in] paint		The paint
+ *
+ * @api
+ */
+void gdispGFillAreaPaint(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const gdispPaint *paint);
+#define gdispFillAreaPaint(x,y,cx,cy,paint)						gdispGFillAreaPaint(GDISP,x,y,cx,cy,paint)
+
+/**
+ * @brief	Fill a circle with a paint
+ *
+ * @param[in] g			The display
+ * @param[in] x,y		The center of the circle
+ * @param[in] radius	The radius of the circle
+ * @param[in] paint		The paint
+ *
+ * @note	The same pixels are filled as @p gdispGFillCircle() except that nothing is drawn outside
+ * 			the radius of very small circles.
+ *
+ * @api
+ */
+void gdispGFillCirclePaint(GDisplay *g, gCoord x, gCoord y, gCoord radius, const gdispPaint *paint);
+#define gdispFillCirclePaint(x,y,radius,paint)					gdispGFillCirclePaint(GDISP,x,y,radius,paint)
+
+/**
+ * @brief	Fill a rounded box with a paint
+ *
+ * @param[in] g			The display
+ * @param[in] x,y		The start position
+ * @param[in] cx,cy		The size of the box
+ * @param[in] radius	The radius of the rounded corners
+ * @param[in] paint		The paint
+ *
+ * @note	The radius is reduced if the box is too small for it.
+ *
+ * @api
+ */
+void gdispGFillRoundedBoxPaint(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord radius, const gdispPaint *paint);
+#define gdispFillRoundedBoxPaint(x,y,cx,cy,radius,paint)		gdispGFillRoundedBoxPaint(GDISP,x,y,cx,cy,radius,paint)
+
+#if GDISP_NEED_CONVEX_POLYGON || defined(__DOXYGEN__)
+	/**
+	 * @brief	Fill a convex polygon with a paint
+	 * @pre		GDISP_NEED_CONVEX_POLYGON must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g			The display
+	 * @param[in] tx,ty		Transform all points in pntarray by tx, ty
+	 * @param[in] pntarray	An array of points
+	 * @param[in] cnt		The number of points in the array
+	 * @param[in] paint		The paint
+	 *
+	 * @note	The same pixels are filled as @p gdispGFillConvexPoly(). The paint is not moved by tx, ty.
+	 *
+	 * @api
+	 */
+	void gdispGFillConvexPolyPaint(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, const gdispPaint *paint);
+	#define gdispFillConvexPolyPaint(tx,ty,pntarray,cnt,paint)	gdispGFillConvexPolyPaint(GDISP,tx,ty,pntarray,cnt,paint)
+#endif
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_PAINT */
+#endif /* _GDISP_PAINT_H */
+/** @} */
@@ -13,25 +13,35 @@
 //	but the pixmap supports adds another virtual display
 #undef GDISP_HARDWARE_DEINIT
 #undef GDISP_HARDWARE_FLUSH
+#undef GDISP_HARDWARE_FLUSHAREA
+#undef GDISP_HARDWARE_FLUSHASYNC
 #undef GDISP_HARDWARE_STREAM_WRITE
+#undef GDISP_HARDWARE_STREAM_WRITECOLORS
 #undef GDISP_HARDWARE_STREAM_READ
 #undef GDISP_HARDWARE_STREAM_POS
 #undef GDISP_HARDWARE_DRAWPIXEL
 #undef GDISP_HARDWARE_CLEARS
 #undef GDISP_HARDWARE_FILLS
 #undef GDISP_HARDWARE_BITFILLS
+#undef GDISP_HARDWARE_BITFILLSASYNC
 #undef GDISP_HARDWARE_SCROLL
+#undef GDISP_HARDWARE_COPY
 #undef GDISP_HARDWARE_PIXELREAD
 #undef GDISP_HARDWARE_CONTROL
 #undef GDISP_HARDWARE_QUERY
 #undef GDISP_HARDWARE_CLIP
 #define GDISP_HARDWARE_DEINIT			GFXON
 #define GDISP_HARDWARE_DRAWPIXEL		GFXON
+#define GDISP_HARDWARE_CLEARS			GFXON
+#define GDISP_HARDWARE_FILLS			GFXON
+#define GDISP_HARDWARE_BITFILLS			GFXON
+#define GDISP_HARDWARE_SCROLL			GFXON
+#define GDISP_HARDWARE_COPY				GFXON
 #define GDISP_HARDWARE_PIXELREAD		GFXON
 #define GDISP_HARDWARE_CONTROL			GFXON
 #define IN_PIXMAP_DRIVER				GFXON
 #define GDISP_DRIVER_VMT				GDISPVMT_pixmap
-#define GDISP_DRIVER_VMT_FLAGS			(GDISP_VFLG_DYNAMICONLY|GDISP_VFLG_PIXMAP)
+#define GDISP_DRIVER_VMT_FLAGS			(GDISP_VFLG_DYNAMICONLY|GDISP_VFLG_PIXMAP|GDISP_VFLG_CONCURRENT)
 
 // This pseudo driver currently only supports unpacked formats with more than 8 bits per pixel
 //	that is, we only support GRAY_SCALE and PALETTE with 8 bits per pixel or any unpacked TRUE_COLOR format.
@@ -40,28 +50,40 @@
 #endif
 
 #include "gdisp_driver.h"
+#include "gdisp_render.h"
 #include "../gdriver/gdriver.h"
 
+#include <string.h>				// For memcpy
+
 typedef struct pixmap {
+	gU16			flags;				// PIXMAP_FLG_xxx
+	gU16			alpha;				// The alpha given to pixels drawn on an ARGB pixmap
 	#if GDISP_NEED_PIXMAP_IMAGE
 		gU8		imghdr[8];			// This field must come just before the data member.
 	#endif
 	gColor			pixels[1];			// We really want pixels[0] but some compilers don't allow that even though it is C standard.
 	} pixmap;
 
-GDisplay *gdispPixmapCreate(gCoord width, gCoord height) {
+#define PIXMAP_FLG_ARGB		0x0001		// The pixels are 32 bit ARGB8888 words rather than gColor's
+
+// The pixels of an ARGB pixmap. The fields before them keep them 32 bit aligned.
+#define ARGBPIXELS(p)		((gU32 *)(p)->pixels)
+
+static GDisplay *pixmapcreate(gCoord width, gCoord height, gU16 flags) {
 	GDisplay	*g;
 	pixmap		*p;
 	unsigned	i;
 
 	// Calculate the size of the display surface in bytes
-	i = width*height*sizeof(gColor);
+	i = width*height*((flags & PIXMAP_FLG_ARGB) ? sizeof(gU32) : sizeof(gColor));
 	if (i < 2*sizeof(gCoord))
 		i = 2*sizeof(gCoord);
 
 	// Allocate the pixmap
 	if (!(p = gfxAlloc(i+sizeof(pixmap)-sizeof(p->pixels))))
 		return 0;
+	p->flags = flags;
+	p->alpha = 0xFF;
 
 	// Fill in the image header (if required)
 	#if GDISP_NEED_PIXMAP_IMAGE
@@ -86,6 +108,14 @@ GDisplay *gdispPixmapCreate(gCoord width, gCoord height) {
 	return g;
 }
 
+GDisplay *gdispPixmapCreate(gCoord width, gCoord height) {
+	return pixmapcreate(width, height, 0);
+}
+
+GDisplay *gdispPixmapCreateARGB(gCoord width, gCoord height) {
+	return pixmapcreate(width, height, PIXMAP_FLG_ARGB);
+}
+
 void gdispPixmapDelete(GDisplay *g) {
 	if (gvmt(g) != GDISPVMT_pixmap)
 		return;
@@ -93,19 +123,118 @@ void gdispPixmapDelete(GDisplay *g) {
 }
 
 gPixel	*gdispPixmapGetBits(GDisplay *g) {
-	if (gvmt(g) != GDISPVMT_pixmap)
+	if (gvmt(g) != GDISPVMT_pixmap || (((pixmap *)g->priv)->flags & PIXMAP_FLG_ARGB))
 		return 0;
 	return ((pixmap *)g->priv)->pixels;
 }
 
+gU32 *gdispPixmapGetARGBBits(GDisplay *g) {
+	if (gvmt(g) != GDISPVMT_pixmap || !(((pixmap *)g->priv)->flags & PIXMAP_FLG_ARGB))
+		return 0;
+	return ARGBPIXELS((pixmap *)g->priv);
+}
+
+void gdispPixmapSetAlpha(GDisplay *g, gU8 alpha) {
+	if (gvmt(g) != GDISPVMT_pixmap)
+		return;
+	((pixmap *)g->priv)->alpha = alpha;
+}
+
 #if GDISP_NEED_PIXMAP_IMAGE
 	void *gdispPixmapGetMemoryImage(GDisplay *g) {
-		if (gvmt(g) != GDISPVMT_pixmap)
+		if (gvmt(g) != GDISPVMT_pixmap || (((pixmap *)g->priv)->flags & PIXMAP_FLG_ARGB))
 			return 0;
 		return ((pixmap *)g->priv)->imghdr;
 	}
 #endif
 
+/*===========================================================================*/
+/* Driver local functions.                                                   */
+/*===========================================================================*/
+
+// Get the position of a display pixel in the pixmap.
+//	Also returns how far apart the pixels are in the pixmap when moving one pixel across (dx) and down (dy) the display.
+static unsigned pixmappos(GDisplay *g, gCoord x, gCoord y, int *dx, int *dy) {
+	#if GDISP_NEED_CONTROL
+		switch(g->g.Orientation) {
+		case gOrientation0:
+		default:
+			break;
+		case gOrientation90:
+			*dx = -g->g.Height;
+			*dy = 1;
+			return (g->g.Width-x-1) * g->g.Height + y;
+		case gOrientation180:
+			*dx = -1;
+			*dy = -g->g.Width;
+			return (g->g.Height-y-1) * g->g.Width + g->g.Width-x-1;
+		case gOrientation270:
+			*dx = g->g.Height;
+			*dy = -1;
+			return x * g->g.Height + g->g.Height-y-1;
+		}
+	#endif
+	*dx = 1;
+	*dy = g->g.Width;
+	return y * g->g.Width + x;
+}
+
+// Convert between a color and an ARGB8888 pixel
+#define COLOR2ARGB(c, a)	gdispRenderColor2ARGB(c, a)
+#define ARGB2COLOR8888(c)	HTML2COLOR((c) & 0x00FFFFFF)
+
+#if GDISP_NEED_COMPOSITE
+	void _gdispPixmapReadARGB(GDisplay *g, gCoord x, gCoord y, gCoord cnt, gU32 *buf) {
+		pixmap		*p;
+		unsigned	pos;
+		int			dx, dy;
+
+		p = (pixmap *)g->priv;
+		pos = pixmappos(g, x, y, &dx, &dy);
+		if (p->flags & PIXMAP_FLG_ARGB) {
+			const gU32	*s;
+
+			s = ARGBPIXELS(p) + pos;
+			if (dx == 1)
+				memcpy(buf, s, cnt * sizeof(gU32));
+			else {
+				for(; cnt; cnt--, s += dx)
+					*buf++ = *s;
+			}
+		} else {
+			const gColor	*s;
+
+			for(s = p->pixels + pos; cnt; cnt--, s += dx)
+				*buf++ = COLOR2ARGB(*s, 0xFF);
+		}
+	}
+
+	void _gdispPixmapWriteARGB(GDisplay *g, gCoord x, gCoord y, gCoord cnt, const gU32 *buf) {
+		pixmap		*p;
+		unsigned	pos;
+		int			dx, dy;
+
+		p = (pixmap *)g->priv;
+		pos = pixmappos(g, x, y, &dx, &dy);
+		if (p->flags & PIXMAP_FLG_ARGB) {
+			gU32	*d;
+
+			d = ARGBPIXELS(p) + pos;
+			if (dx == 1)
+				memcpy(d, buf, cnt * sizeof(gU32));
+			else {
+				for(; cnt; cnt--, d += dx)
+					*d = *buf++;
+			}
+		} else {
+			gColor	*d;
+
+			for(d = p->pixels + pos; cnt; cnt--, d += dx, buf++)
+				*d = ARGB2COLOR8888(*buf);
+		}
+	}
+#endif
+
 /*===========================================================================*/
 /* Driver exported functions.                                                */
 /*===========================================================================*/
@@ -156,7 +285,119 @@ LLDSPEC void gdisp_lld_draw_pixel(GDisplay *g) {
 		pos = g->p.y * g->g.Width + g->p.x;
 	#endif
 
-	((pixmap *)(g)->priv)->pixels[pos] = g->p.color;
+	if (((pixmap *)(g)->priv)->flags & PIXMAP_FLG_ARGB)
+		ARGBPIXELS((pixmap *)(g)->priv)[pos] = COLOR2ARGB(g->p.color, ((pixmap *)(g)->priv)->alpha);
+	else
+		((pixmap *)(g)->priv)->pixels[pos] = g->p.color;
+}
+
+LLDSPEC void gdisp_lld_clear(GDisplay *g) {
+	pixmap		*pm;
+	unsigned	cnt;
+
+	// The orientation doesn't matter when every pixel is being set
+	pm = (pixmap *)g->priv;
+	cnt = (unsigned)g->g.Width * g->g.Height;
+	if (pm->flags & PIXMAP_FLG_ARGB) {
+		gU32		c;
+
+		c = COLOR2ARGB(g->p.color, pm->alpha);
+		gdispRenderFillARGB(ARGBPIXELS(pm), 0, cnt, c);
+		return;
+	}
+	gdispRenderFill(pm->pixels, 0, cnt, g->p.color);
+}
+
+LLDSPEC void gdisp_lld_fill_area(GDisplay *g) {
+	gColor		*p;
+	gCoord		x, y, cx, cy, t, linelen;
+
+	x = g->p.x; y = g->p.y;
+	cx = g->p.cx; cy = g->p.cy;
+	linelen = g->g.Width;
+
+	// Convert to un-rotated pixmap coordinates
+	#if GDISP_NEED_CONTROL
+		switch(g->g.Orientation) {
+		case gOrientation0:
+		default:
+			break;
+		case gOrientation90:
+			t = x;
+			x = y;
+			y = g->g.Width - t - cx;
+			t = cx; cx = cy; cy = t;
+			linelen = g->g.Height;
+			break;
+		case gOrientation180:
+			x = g->g.Width - x - cx;
+			y = g->g.Height - y - cy;
+			break;
+		case gOrientation270:
+			t = y;
+			y = x;
+			x = g->g.Height - t - cy;
+			t = cx; cx = cy; cy = t;
+			linelen = g->g.Height;
+			break;
+		}
+	#else
+		(void) t;
+	#endif
+
+	if (((pixmap *)(g)->priv)->flags & PIXMAP_FLG_ARGB) {
+		gU32		*p32, c;
+
+		c = COLOR2ARGB(g->p.color, ((pixmap *)(g)->priv)->alpha);
+		for(p32 = ARGBPIXELS((pixmap *)(g)->priv) + y * linelen; cy > 0; cy--, p32 += linelen)
+			gdispRenderFillARGB(p32, x, cx, c);
+		return;
+	}
+
+	for(p = ((pixmap *)(g)->priv)->pixels + y * linelen; cy > 0; cy--, p += linelen)
+		gdispRenderFill(p, x, cx, g->p.color);
+}
+
+LLDSPEC void gdisp_lld_blit_area(GDisplay *g) {
+	gColor			*p;
+	const gPixel	*s;
+	gCoord			x, y;
+	int				dx, dy;
+	unsigned		pos;
+
+	pos = pixmappos(g, g->p.x, g->p.y, &dx, &dy);
+	s = (const gPixel *)g->p.ptr + g->p.y1 * g->p.x2 + g->p.x1;
+
+	// Each pixel of an ARGB pixmap needs converting
+	if (((pixmap *)(g)->priv)->flags & PIXMAP_FLG_ARGB) {
+		gU32		*p32, a;
+
+		a = ((pixmap *)(g)->priv)->alpha;
+		p32 = ARGBPIXELS((pixmap *)(g)->priv) + pos;
+		if (dx == 1) {
+			for(y = 0; y < g->p.cy; y++, p32 += dy, s += g->p.x2)
+				gdispRenderBlitARGB(p32, 0, s, g->p.cx, (gU8)a);
+		} else {
+			for(y = 0; y < g->p.cy; y++, p32 += dy, s += g->p.x2) {
+				for(x = 0; x < g->p.cx; x++)
+					p32[x * dx] = COLOR2ARGB(s[x], a);
+			}
+		}
+		return;
+	}
+
+	p = ((pixmap *)(g)->priv)->pixels + pos;
+
+	// Lines are contiguous in an unrotated pixmap. Otherwise step through the pixmap a pixel at a time.
+	if (dx == 1) {
+		for(y = 0; y < g->p.cy; y++, p += dy, s += g->p.x2)
+			memcpy(p, s, g->p.cx * sizeof(gColor));
+	} else {
+		for(y = 0; y < g->p.cy; y++, p += dy, s += g->p.x2) {
+			for(x = 0; x < g->p.cx; x++)
+				p[x * dx] = s[x];
+		}
+	}
 }
 
 LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
@@ -182,9 +423,115 @@ LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
 		pos = g->p.y * g->g.Width + g->p.x;
 	#endif
 
+	if (((pixmap *)(g)->priv)->flags & PIXMAP_FLG_ARGB)
+		return ARGB2COLOR8888(ARGBPIXELS((pixmap *)(g)->priv)[pos]);
 	return ((pixmap *)(g)->priv)->pixels[pos];
 }
 
+#if GDISP_NEED_SCROLL
+	LLDSPEC void gdisp_lld_vertical_scroll(GDisplay *g) {
+		gColor		*p;
+		gCoord		x, y, cy;
+		int			dx, dy, step, offset;
+		unsigned	pos;
+
+		// Move the lines that stay visible. The high level code fills the gap that is left.
+		if (g->p.y1 > 0) {
+			cy = g->p.cy - g->p.y1;
+			pos = pixmappos(g, g->p.x, g->p.y, &dx, &dy);
+			step = dy;
+		} else {
+			cy = g->p.cy + g->p.y1;
+			pos = pixmappos(g, g->p.x, g->p.y+g->p.cy-1, &dx, &dy);
+			step = -dy;
+		}
+		offset = g->p.y1 * dy;
+
+		// Copy each line from the line it is scrolling from
+		if (((pixmap *)(g)->priv)->flags & PIXMAP_FLG_ARGB) {
+			gU32	*p32;
+
+			p32 = ARGBPIXELS((pixmap *)(g)->priv) + pos;
+			if (dx == 1) {
+				for(y = 0; y < cy; y++, p32 += step)
+					memcpy(p32, p32 + offset, g->p.cx * sizeof(gU32));
+			} else {
+				for(y = 0; y < cy; y++, p32 += step) {
+					for(x = 0; x < g->p.cx; x++)
+						p32[x * dx] = p32[x * dx + offset];
+				}
+			}
+			return;
+		}
+		p = ((pixmap *)(g)->priv)->pixels + pos;
+		if (dx == 1) {
+			for(y = 0; y < cy; y++, p += step)
+				memcpy(p, p + offset, g->p.cx * sizeof(gColor));
+		} else {
+			for(y = 0; y < cy; y++, p += step) {
+				for(x = 0; x < g->p.cx; x++)
+					p[x * dx] = p[x * dx + offset];
+			}
+		}
+	}
+#endif
+
+#if GDISP_NEED_COPYAREA
+	LLDSPEC void gdisp_lld_copy_area(GDisplay *g) {
+		gColor		*p;
+		gCoord		x, y;
+		int			dx, dy, step, offset;
+		unsigned	pos;
+
+		// Copy the lines in an order that reads each source line before it is overwritten
+		if (g->p.y > g->p.y1) {
+			pos = pixmappos(g, g->p.x, g->p.y+g->p.cy-1, &dx, &dy);
+			step = -dy;
+		} else {
+			pos = pixmappos(g, g->p.x, g->p.y, &dx, &dy);
+			step = dy;
+		}
+		offset = (g->p.x1 - g->p.x) * dx + (g->p.y1 - g->p.y) * dy;
+
+		// Pixels across a line are copied backwards when moving right
+		if (((pixmap *)(g)->priv)->flags & PIXMAP_FLG_ARGB) {
+			gU32	*p32;
+
+			p32 = ARGBPIXELS((pixmap *)(g)->priv) + pos;
+			if (dx == 1) {
+				for(y = 0; y < g->p.cy; y++, p32 += step)
+					memmove(p32, p32 + offset, g->p.cx * sizeof(gU32));
+			} else if (g->p.x > g->p.x1) {
+				for(y = 0; y < g->p.cy; y++, p32 += step) {
+					for(x = g->p.cx-1; x >= 0; x--)
+						p32[x * dx] = p32[x * dx + offset];
+				}
+			} else {
+				for(y = 0; y < g->p.cy; y++, p32 += step) {
+					for(x = 0; x < g->p.cx; x++)
+						p32[x * dx] = p32[x * dx + offset];
+				}
+			}
+			return;
+		}
+		p = ((pixmap *)(g)->priv)->pixels + pos;
+		if (dx == 1) {
+			for(y = 0; y < g->p.cy; y++, p += step)
+				memmove(p, p + offset, g->p.cx * sizeof(gColor));
+		} else if (g->p.x > g->p.x1) {
+			for(y = 0; y < g->p.cy; y++, p += step) {
+				for(x = g->p.cx-1; x >= 0; x--)
+					p[x * dx] = p[x * dx + offset];
+			}
+		} else {
+			for(y = 0; y < g->p.cy; y++, p += step) {
+				for(x = 0; x < g->p.cx; x++)
+					p[x * dx] = p[x * dx + offset];
+			}
+		}
+	}
+#endif
+
 #if GDISP_NEED_CONTROL
 	LLDSPEC void gdisp_lld_control(GDisplay *g) {
 		switch(g->p.x) {
@@ -14,7 +14,7 @@
  * @brief   Sub-Module for dynamic framebuffers.
  *
  * @note	A Pixmap is an off-screen virtual display that can be drawn to just like any other
- * 			display. It can then be copied to a real display using the standard gdispGBlitArea() call.
+ * 			display. It can then be copied to a real display using gdispGBlitPixmap() or the standard gdispGBlitArea() call.
  * @pre		GDISP_NEED_PIXMAP must be GFXON in your gfxconf.h
  * @{
  */
@@ -39,6 +39,24 @@
  */
 GDisplay *gdispPixmapCreate(gCoord width, gCoord height);
 
+/**
+ * @brief	Create an off-screen pixmap with an alpha channel
+ * @details	Each pixel is stored as a 32 bit ARGB8888 word (0xAARRGGBB with an alpha of 255 being opaque).
+ *
+ * @param[in] width  	The width of the pixmap to be created
+ * @param[in] height  	The height of the pixmap to be created
+ *
+ * @return 	The created GDisplay representing the pixmap or 0 if the pixmap couldn't be created.
+ *
+ * @note	It is drawn on using the standard gdispGxxxx calls. Pixels that are drawn are given the alpha
+ * 			set by @p gdispPixmapSetAlpha(). Reading a pixel back returns its color without the alpha.
+ * @note	It is drawn onto another display using @p gdispGBlendPixmap() which needs GDISP_NEED_COMPOSITE.
+ * @note	The initial pixels are not set. To start with a transparent pixmap set the alpha to 0, clear it
+ * 			and then set the alpha back to 255.
+ * @note	It must be destroyed using @p gdispPixmapDelete
+ */
+GDisplay *gdispPixmapCreateARGB(gCoord width, gCoord height);
+
 /**
  * @brief	Destroy an off-screen pixmap
  *
@@ -54,6 +72,7 @@ void gdispPixmapDelete(GDisplay *g);
  *
  * @param[in] g  	The pixmap virtual display
  *
+ * @note	A pixmap with an alpha channel returns NULL. Use @p gdispPixmapGetARGBBits() instead.
  * @note	The pointer returned can be used for calls to @p gdispGBlitArea() or can be read or written to directly
  * 			by the application code. For any one particular pixmap the pointer will not change over the life of the pixmap
  * 			(although different pixmaps will have different pixel pointers). Once a pixmap is deleted, the pixel pointer
@@ -61,6 +80,46 @@ void gdispPixmapDelete(GDisplay *g);
  */
 gPixel	*gdispPixmapGetBits(GDisplay *g);
 
+/**
+ * @brief	Get a pointer to the ARGB8888 pixels of a pixmap with an alpha channel.
+ * @return	The pointer to the pixmap display surface or NULL if this display is not an ARGB pixmap.
+ *
+ * @param[in] g  	The pixmap virtual display
+ *
+ * @note	This is the equivalent of @p gdispPixmapGetBits() for a pixmap created with @p gdispPixmapCreateARGB().
+ * 			The application can write the alpha of the pixels directly.
+ */
+gU32 *gdispPixmapGetARGBBits(GDisplay *g);
+
+/**
+ * @brief	Set the alpha given to pixels drawn on a pixmap with an alpha channel.
+ *
+ * @param[in] g  		The pixmap virtual display
+ * @param[in] alpha		The alpha (0 = transparent, 255 = opaque). The default is 255.
+ *
+ * @note	This has no effect on a pixmap without an alpha channel.
+ */
+void gdispPixmapSetAlpha(GDisplay *g, gU8 alpha);
+
+/**
+ * @brief	Copy an area of a pixmap to a display
+ *
+ * @param[in] g			The destination display. This can be a normal display or a pixmap.
+ * @param[in] x,y		The destination position
+ * @param[in] cx,cy		The size of the area to copy
+ * @param[in] src		The source pixmap
+ * @param[in] srcx,srcy	The position of the area in the source pixmap
+ *
+ * @note	The pixels of the source pixmap are read directly. This is much faster than reading
+ * 			the source pixmap a pixel at a time and doesn't need @p gdispPixmapGetBits().
+ * @note	Copying between two unrotated pixmaps is a straight memory copy that doesn't call either driver.
+ * 			The areas can overlap if the source and destination are the same unrotated pixmap.
+ * @note	A rotated source pixmap is read a pixel at a time and needs GDISP_NEED_PIXELREAD.
+ * @note	If a normal display or a pixmap with an alpha channel is passed as the source, nothing is done.
+ */
+void gdispGBlitPixmap(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, GDisplay *src, gCoord srcx, gCoord srcy);
+#define gdispBlitPixmap(x,y,cx,cy,src,srcx,srcy)	gdispGBlitPixmap(GDISP,x,y,cx,cy,src,srcx,srcy)
+
 #if GDISP_NEED_PIXMAP_IMAGE || defined(__DOXYGEN__)
 	/**
 	 * @brief	Get a pointer to a native format gImage.
@@ -74,6 +133,7 @@ gPixel	*gdispPixmapGetBits(GDisplay *g);
 	 * @note	The pointer returned can be passed to @p gdispImageOpenMemory() or to @p gfileOpenMemory().
 	 * @note	If you are just wanting to copy to a real display it is more efficient to use @p gdispGetPixmapBits() and @p gdispGBlitArea().
 	 * @note	Like @p gdispGetPixmapBits(), the pointer returned is valid for the life of the pixmap.
+	 * @note	A pixmap with an alpha channel returns NULL.
 	 */
 	void *gdispPixmapGetMemoryImage(GDisplay *g);
 #endif
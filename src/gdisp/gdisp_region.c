@@ -0,0 +1,329 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+#include "../../gfx.h"
+
+#if GFX_USE_GDISP && GDISP_NEED_CLIPREGION
+
+#include <string.h>				// For memcpy
+
+// The region operations as a truth table indexed by (inA | inB<<1)
+#define REGIONOP_UNION			0x0E
+#define REGIONOP_INTERSECT		0x08
+#define REGIONOP_SUBTRACT		0x02
+
+#define REGION_XMAX				((gCoord)(((unsigned)1 << (sizeof(gCoord)*8-1)) - 1))
+
+static void regionbounds(gdispRegion *rgn) {
+	const gdispRegionRect	*r, *e;
+
+	if (!rgn->cnt) {
+		rgn->bounds.x0 = rgn->bounds.y0 = rgn->bounds.x1 = rgn->bounds.y1 = 0;
+		return;
+	}
+	r = rgn->rects;
+	e = r + rgn->cnt;
+	rgn->bounds.y0 = r->y0;
+	rgn->bounds.y1 = e[-1].y1;
+	rgn->bounds.x0 = r->x0;
+	rgn->bounds.x1 = r->x1;
+	for(r++; r < e; r++) {
+		if (r->x0 < rgn->bounds.x0)	rgn->bounds.x0 = r->x0;
+		if (r->x1 > rgn->bounds.x1)	rgn->bounds.x1 = r->x1;
+	}
+}
+
+// Return the index of the first rectangle after the band starting at rectangle i
+static unsigned regionnextband(const gdispRegion *rgn, unsigned i) {
+	gCoord	y0;
+
+	for(y0 = rgn->rects[i].y0, i++; i < rgn->cnt && rgn->rects[i].y0 == y0; i++)
+		;
+	return i;
+}
+
+// The output of a region operation
+typedef struct regionOut {
+	gdispRegionRect *	rects;
+	unsigned			cnt;
+	unsigned			size;
+} regionOut;
+
+static gBool regionadd(regionOut *out, gCoord x0, gCoord y0, gCoord x1, gCoord y1) {
+	gdispRegionRect	*r;
+
+	if (out->cnt >= out->size) {
+		r = gfxRealloc(out->rects, out->size*sizeof(gdispRegionRect), out->size*2*sizeof(gdispRegionRect));
+		if (!r)
+			return gFalse;
+		out->rects = r;
+		out->size *= 2;
+	}
+	r = &out->rects[out->cnt++];
+	r->x0 = x0; r->y0 = y0;
+	r->x1 = x1; r->y1 = y1;
+	return gTrue;
+}
+
+// Combine the band [pa,ea) of region a and [pb,eb) of region b for the rows y0 to y1 (not inclusive)
+static gBool regionslice(regionOut *out, unsigned op, const gdispRegionRect *pa, const gdispRegionRect *ea,
+							const gdispRegionRect *pb, const gdispRegionRect *eb, gCoord y0, gCoord y1) {
+	gCoord		x, xa, xb, xs;
+	unsigned	ina, inb, on, state;
+
+	ina = inb = on = 0;
+	xs = 0;
+	while(pa < ea || pb < eb) {
+		xa = pa < ea ? (ina ? pa->x1 : pa->x0) : REGION_XMAX;
+		xb = pb < eb ? (inb ? pb->x1 : pb->x0) : REGION_XMAX;
+		x = xa < xb ? xa : xb;
+		if (xa == x) {
+			if (ina) pa++;
+			ina ^= 1;
+		}
+		if (xb == x) {
+			if (inb) pb++;
+			inb ^= 1;
+		}
+
+		// Process every edge at this position before looking at the new state
+		if (pa < ea && (ina ? pa->x1 : pa->x0) == x)
+			continue;
+		if (pb < eb && (inb ? pb->x1 : pb->x0) == x)
+			continue;
+
+		state = (op >> (ina | (inb << 1))) & 1;
+		if (state == on)
+			continue;
+		if (state)
+			xs = x;
+		else if (!regionadd(out, xs, y0, x, y1))
+			return gFalse;
+		on = state;
+	}
+	return gTrue;
+}
+
+static gBool regionop(gdispRegion *dst, const gdispRegion *a, const gdispRegion *b, unsigned op) {
+	regionOut		out;
+	unsigned		ia, ib, ea, eb, band, prevband, i;
+	gCoord			y, ny;
+	gBool			ain, bin;
+
+	out.size = a->cnt + b->cnt + 4;
+	if (!(out.rects = gfxAlloc(out.size*sizeof(gdispRegionRect))))
+		return gFalse;
+	out.cnt = 0;
+
+	// Start at the top of whichever region starts first
+	y = 0;
+	if (a->cnt)				y = a->rects[0].y0;
+	if (b->cnt && (!a->cnt || b->rects[0].y0 < y))	y = b->rects[0].y0;
+
+	// Sweep down through every y where either region starts or ends a band
+	ia = ib = 0;
+	prevband = band = 0;
+	while(1) {
+		while (ia < a->cnt && a->rects[ia].y1 <= y)
+			ia = regionnextband(a, ia);
+		while (ib < b->cnt && b->rects[ib].y1 <= y)
+			ib = regionnextband(b, ib);
+		if (ia >= a->cnt && ib >= b->cnt)
+			break;
+
+		// Find the next y where something changes
+		ny = REGION_XMAX;
+		ain = ia < a->cnt && a->rects[ia].y0 <= y;
+		bin = ib < b->cnt && b->rects[ib].y0 <= y;
+		if (ia < a->cnt)	ny = ain ? a->rects[ia].y1 : a->rects[ia].y0;
+		if (ib < b->cnt) {
+			if (bin) {
+				if (b->rects[ib].y1 < ny)	ny = b->rects[ib].y1;
+			} else {
+				if (b->rects[ib].y0 < ny)	ny = b->rects[ib].y0;
+			}
+		}
+
+		if (ain || bin) {
+			ea = ain ? regionnextband(a, ia) : ia;
+			eb = bin ? regionnextband(b, ib) : ib;
+			band = out.cnt;
+			if (!regionslice(&out, op, a->rects+ia, a->rects+ea, b->rects+ib, b->rects+eb, y, ny)) {
+				gfxFree(out.rects);
+				return gFalse;
+			}
+
+			// Merge the new band with the previous one if they are the same width and touch
+			if (band != out.cnt && band != prevband && out.cnt - band == band - prevband && out.rects[prevband].y1 == y) {
+				for(i = 0; i < band - prevband; i++) {
+					if (out.rects[prevband+i].x0 != out.rects[band+i].x0 || out.rects[prevband+i].x1 != out.rects[band+i].x1)
+						break;
+				}
+				if (i == band - prevband) {
+					for(i = prevband; i < band; i++)
+						out.rects[i].y1 = ny;
+					out.cnt = band;
+					band = prevband;
+				}
+			}
+			if (band != out.cnt)
+				prevband = band;
+		}
+		y = ny;
+	}
+
+	// Replace the destination
+	if (dst->rects)
+		gfxFree(dst->rects);
+	if (!out.cnt) {
+		gfxFree(out.rects);
+		out.rects = 0;
+		out.size = 0;
+	}
+	dst->rects = out.rects;
+	dst->cnt = out.cnt;
+	dst->size = out.size;
+	regionbounds(dst);
+	return gTrue;
+}
+
+// Make a temporary region containing just one rectangle
+static void regionrect(gdispRegion *rgn, gdispRegionRect *r, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+	r->x0 = x; r->y0 = y;
+	r->x1 = x + cx; r->y1 = y + cy;
+	rgn->rects = r;
+	rgn->cnt = rgn->size = (cx > 0 && cy > 0) ? 1 : 0;
+	rgn->bounds = *r;
+}
+
+void gdispRegionInit(gdispRegion *rgn) {
+	rgn->rects = 0;
+	rgn->cnt = rgn->size = 0;
+	regionbounds(rgn);
+}
+
+void gdispRegionDeinit(gdispRegion *rgn) {
+	if (rgn->rects)
+		gfxFree(rgn->rects);
+	gdispRegionInit(rgn);
+}
+
+void gdispRegionClear(gdispRegion *rgn) {
+	rgn->cnt = 0;
+	regionbounds(rgn);
+}
+
+gBool gdispRegionSetRect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+	if (cx <= 0 || cy <= 0) {
+		gdispRegionClear(rgn);
+		return gTrue;
+	}
+	if (!rgn->size) {
+		if (!(rgn->rects = gfxAlloc(sizeof(gdispRegionRect))))
+			return gFalse;
+		rgn->size = 1;
+	}
+	rgn->rects[0].x0 = x; rgn->rects[0].y0 = y;
+	rgn->rects[0].x1 = x + cx; rgn->rects[0].y1 = y + cy;
+	rgn->cnt = 1;
+	rgn->bounds = rgn->rects[0];
+	return gTrue;
+}
+
+gBool gdispRegionCopy(gdispRegion *dst, const gdispRegion *src) {
+	gdispRegionRect	*r;
+
+	if (dst == src)
+		return gTrue;
+	if (dst->size < src->cnt) {
+		if (!(r = gfxAlloc(src->cnt*sizeof(gdispRegionRect))))
+			return gFalse;
+		if (dst->rects)
+			gfxFree(dst->rects);
+		dst->rects = r;
+		dst->size = src->cnt;
+	}
+	if (src->cnt)
+		memcpy(dst->rects, src->rects, src->cnt*sizeof(gdispRegionRect));
+	dst->cnt = src->cnt;
+	dst->bounds = src->bounds;
+	return gTrue;
+}
+
+gBool gdispRegionUnion(gdispRegion *dst, const gdispRegion *a, const gdispRegion *b) {
+	if (!b->cnt)
+		return gdispRegionCopy(dst, a);
+	if (!a->cnt)
+		return gdispRegionCopy(dst, b);
+	return regionop(dst, a, b, REGIONOP_UNION);
+}
+
+gBool gdispRegionIntersect(gdispRegion *dst, const gdispRegion *a, const gdispRegion *b) {
+	if (!a->cnt || !b->cnt
+			|| a->bounds.x0 >= b->bounds.x1 || b->bounds.x0 >= a->bounds.x1
+			|| a->bounds.y0 >= b->bounds.y1 || b->bounds.y0 >= a->bounds.y1) {
+		gdispRegionClear(dst);
+		return gTrue;
+	}
+	return regionop(dst, a, b, REGIONOP_INTERSECT);
+}
+
+gBool gdispRegionSubtract(gdispRegion *dst, const gdispRegion *a, const gdispRegion *b) {
+	if (!a->cnt || !b->cnt
+			|| a->bounds.x0 >= b->bounds.x1 || b->bounds.x0 >= a->bounds.x1
+			|| a->bounds.y0 >= b->bounds.y1 || b->bounds.y0 >= a->bounds.y1)
+		return gdispRegionCopy(dst, a);
+	return regionop(dst, a, b, REGIONOP_SUBTRACT);
+}
+
+gBool gdispRegionUnionRect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+	gdispRegion		tmp;
+	gdispRegionRect	r;
+
+	regionrect(&tmp, &r, x, y, cx, cy);
+	return gdispRegionUnion(rgn, rgn, &tmp);
+}
+
+gBool gdispRegionIntersectRect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+	gdispRegion		tmp;
+	gdispRegionRect	r;
+
+	regionrect(&tmp, &r, x, y, cx, cy);
+	return gdispRegionIntersect(rgn, rgn, &tmp);
+}
+
+gBool gdispRegionSubtractRect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+	gdispRegion		tmp;
+	gdispRegionRect	r;
+
+	regionrect(&tmp, &r, x, y, cx, cy);
+	return gdispRegionSubtract(rgn, rgn, &tmp);
+}
+
+gBool gdispRegionContains(const gdispRegion *rgn, gCoord x, gCoord y) {
+	const gdispRegionRect	*r, *e;
+	unsigned				lo, hi, mid;
+
+	if (x < rgn->bounds.x0 || x >= rgn->bounds.x1 || y < rgn->bounds.y0 || y >= rgn->bounds.y1)
+		return gFalse;
+
+	// Binary search for the band containing y. The bottom edges are in order.
+	for(lo = 0, hi = rgn->cnt; lo < hi;) {
+		mid = (lo + hi) / 2;
+		if (rgn->rects[mid].y1 <= y)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	for(r = rgn->rects+lo, e = rgn->rects+rgn->cnt; r < e && r->y0 <= y && r->x0 <= x; r++) {
+		if (x < r->x1)
+			return gTrue;
+	}
+	return gFalse;
+}
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_CLIPREGION */
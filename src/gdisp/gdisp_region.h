@@ -0,0 +1,193 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_region.h
+ *
+ * @defgroup Region Region
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for clip regions.
+ *
+ * @details	A region is an area of the display made up of any number of rectangles.
+ * 			Regions can be combined using union, intersect and subtract operations and
+ * 			can then be used as the clip area of a display so that a single drawing
+ * 			operation only draws into a non-rectangular visible area.
+ *
+ * @note	The rectangles are stored in y-x banded order. The region is divided into horizontal
+ * 			bands and each band is a list of non-overlapping rectangles of the same height ordered by x.
+ * @note	Regions allocate their rectangles from the heap. The operations return gFalse if there
+ * 			is not enough memory in which case the destination region is not changed.
+ * @pre		GDISP_NEED_CLIPREGION must be GFXON in your gfxconf.h
+ * @{
+ */
+
+#ifndef _GDISP_REGION_H
+#define _GDISP_REGION_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_CLIPREGION) || defined(__DOXYGEN__)
+
+/**
+ * @brief	A rectangle within a region
+ */
+typedef struct gdispRegionRect {
+	gCoord			x0, y0;				/**< The top left corner */
+	gCoord			x1, y1;				/**< The bottom right corner (not inclusive) */
+} gdispRegionRect;
+
+/**
+ * @brief	A region
+ * @note	The members of this structure are private apart from bounds which may be read
+ */
+typedef struct gdispRegion {
+	gdispRegionRect *	rects;			// The rectangles in y-x banded order
+	unsigned			cnt;			// The number of rectangles
+	unsigned			size;			// The number of rectangles allocated
+	gdispRegionRect		bounds;			/**< The bounding box of the region */
+} gdispRegion;
+
+/**
+ * @brief	Initialise a region as empty
+ *
+ * @param[in] rgn		The region
+ *
+ * @api
+ */
+void gdispRegionInit(gdispRegion *rgn);
+
+/**
+ * @brief	Free the memory used by a region
+ * @details	The region is left empty and can be used again
+ *
+ * @param[in] rgn		The region
+ *
+ * @api
+ */
+void gdispRegionDeinit(gdispRegion *rgn);
+
+/**
+ * @brief	Is the region empty
+ *
+ * @param[in] rgn		The region
+ *
+ * @api
+ */
+#define gdispRegionIsEmpty(rgn)		((rgn)->cnt == 0)
+
+/**
+ * @brief	Make a region empty
+ *
+ * @param[in] rgn		The region
+ *
+ * @api
+ */
+void gdispRegionClear(gdispRegion *rgn);
+
+/**
+ * @brief	Set a region to a single rectangle
+ * @return	gFalse if there is not enough memory
+ *
+ * @param[in] rgn		The region
+ * @param[in] x,y		The top left corner of the rectangle
+ * @param[in] cx,cy		The size of the rectangle
+ *
+ * @api
+ */
+gBool gdispRegionSetRect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy);
+
+/**
+ * @brief	Copy a region
+ * @return	gFalse if there is not enough memory
+ *
+ * @param[in] dst		The destination region
+ * @param[in] src		The source region
+ *
+ * @api
+ */
+gBool gdispRegionCopy(gdispRegion *dst, const gdispRegion *src);
+
+/**
+ * @brief	Set a region to the area covered by either of two regions
+ * @return	gFalse if there is not enough memory
+ *
+ * @param[in] dst		The destination region. This can be the same as @p a or @p b
+ * @param[in] a,b		The two regions
+ *
+ * @api
+ */
+gBool gdispRegionUnion(gdispRegion *dst, const gdispRegion *a, const gdispRegion *b);
+
+/**
+ * @brief	Set a region to the area covered by both of two regions
+ * @return	gFalse if there is not enough memory
+ *
+ * @param[in] dst		The destination region. This can be the same as @p a or @p b
+ * @param[in] a,b		The two regions
+ *
+ * @api
+ */
+gBool gdispRegionIntersect(gdispRegion *dst, const gdispRegion *a, const gdispRegion *b);
+
+/**
+ * @brief	Set a region to the area covered by one region but not by another
+ * @return	gFalse if there is not enough memory
+ *
+ * @param[in] dst		The destination region. This can be the same as @p a or @p b
+ * @param[in] a			The region to subtract from
+ * @param[in] b			The region to subtract
+ *
+ * @api
+ */
+gBool gdispRegionSubtract(gdispRegion *dst, const gdispRegion *a, const gdispRegion *b);
+
+/**
+ * @brief	Add, intersect or subtract a rectangle to or from a region
+ * @return	gFalse if there is not enough memory
+ *
+ * @param[in] rgn		The region
+ * @param[in] x,y		The top left corner of the rectangle
+ * @param[in] cx,cy		The size of the rectangle
+ *
+ * @api
+ * @{
+ */
+gBool gdispRegionUnionRect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy);
+gBool gdispRegionIntersectRect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy);
+gBool gdispRegionSubtractRect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy);
+/** @} */
+
+/**
+ * @brief	Is a point inside a region
+ *
+ * @param[in] rgn		The region
+ * @param[in] x,y		The point
+ *
+ * @api
+ */
+gBool gdispRegionContains(const gdispRegion *rgn, gCoord x, gCoord y);
+
+/**
+ * @brief	Set the clip area of a display to a region
+ * @details	Drawing operations only change the pixels inside the region.
+ *
+ * @param[in] g			The display
+ * @param[in] rgn		The region
+ *
+ * @note	The region is not copied. It must not be changed or freed while it is the clip area.
+ * @note	gdispGSetClip() replaces the clip region with a simple clip rectangle again.
+ * @note	The region is honoured by all the drawing, blitting, image and text functions.
+ * 			Streaming and scrolling only use the bounding box of the region.
+ * @note	Drivers that clip in hardware only use the bounding box of the region.
+ *
+ * @api
+ */
+void gdispGSetClipRegion(GDisplay *g, const gdispRegion *rgn);
+#define gdispSetClipRegion(rgn)				gdispGSetClipRegion(GDISP,rgn)
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_CLIPREGION */
+#endif /* _GDISP_REGION_H */
+/** @} */
@@ -0,0 +1,203 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_render.h
+ *
+ * @defgroup Render Render
+ * @ingroup GDISP
+ *
+ * @brief   Row rendering specialised for the driver's pixel format.
+ *
+ * @details	Drivers that draw into memory include this after gdisp_driver.h. Each routine is
+ * 			compiled for GDISP_LLD_PIXELFORMAT only so a build contains just the code for the format
+ * 			in use. The callers convert a color to the native format once and the inner loops
+ * 			only store pixels.
+ *
+ * @note	A row is the address of the first pixel of a display line and pixel positions are
+ * 			relative to it. This lets packed formats start part way through a byte.
+ * @note	Packed formats (fewer than 8 bits per pixel eg. MONO and GRAY4) hold the left-most pixel
+ * 			in the most significant bits of each byte.
+ * @note	The ARGB8888 routines are for memory holding 32 bit ARGB words whatever the driver's
+ * 			pixel format is.
+ * @{
+ */
+
+#ifndef _GDISP_RENDER_H
+#define _GDISP_RENDER_H
+
+#if GFX_USE_GDISP
+
+#if !defined(LLDCOLOR_TYPE) && !defined(__DOXYGEN__)
+	#error "GDISP Render: gdisp_render.h must be included by a driver after gdisp_driver.h"
+#endif
+
+#include <string.h>				// For memset and memcpy
+
+// Packed pixel formats
+#if LLDCOLOR_BITS < 8
+	#define LLDRENDER_PACKED		GFXON
+	#define LLDRENDER_PIXELS		(8/LLDCOLOR_BITS)									// Pixels per byte
+	#define LLDRENDER_SHIFT(x)		((LLDRENDER_PIXELS-1-((x) % LLDRENDER_PIXELS)) * LLDCOLOR_BITS)
+	#define LLDRENDER_BYTE(c)		((gU8)((c) * (0xFF / LLDCOLOR_MASK())))			// A byte of pixels of one color
+#else
+	#define LLDRENDER_PACKED		GFXOFF
+#endif
+
+/**
+ * @brief	Set a pixel in a row
+ *
+ * @param[in] row		The first pixel of the row
+ * @param[in] x			The pixel position
+ * @param[in] c			The color in the driver's pixel format
+ */
+static GFXINLINE void gdispRenderSet(void *row, gCoord x, LLDCOLOR_TYPE c) {
+	#if LLDRENDER_PACKED
+		gU8		*p;
+
+		p = (gU8 *)row + x / LLDRENDER_PIXELS;
+		*p = (gU8)((*p & ~(LLDCOLOR_MASK() << LLDRENDER_SHIFT(x))) | ((c & LLDCOLOR_MASK()) << LLDRENDER_SHIFT(x)));
+	#else
+		((LLDCOLOR_TYPE *)row)[x] = c;
+	#endif
+}
+
+/**
+ * @brief	Get a pixel from a row
+ * @return	The color in the driver's pixel format
+ *
+ * @param[in] row		The first pixel of the row
+ * @param[in] x			The pixel position
+ */
+static GFXINLINE LLDCOLOR_TYPE gdispRenderGet(const void *row, gCoord x) {
+	#if LLDRENDER_PACKED
+		return (LLDCOLOR_TYPE)((((const gU8 *)row)[x / LLDRENDER_PIXELS] >> LLDRENDER_SHIFT(x)) & LLDCOLOR_MASK());
+	#else
+		return ((const LLDCOLOR_TYPE *)row)[x];
+	#endif
+}
+
+/**
+ * @brief	Fill a run of pixels in a row
+ * @note	This is also the horizontal line renderer.
+ *
+ * @param[in] row		The first pixel of the row
+ * @param[in] x			The first pixel to fill
+ * @param[in] cnt		The number of pixels
+ * @param[in] c			The color in the driver's pixel format
+ */
+static GFXINLINE void gdispRenderFill(void *row, gCoord x, unsigned cnt, LLDCOLOR_TYPE c) {
+	#if LLDRENDER_PACKED
+		gU8			*p, cc, m;
+		unsigned	n;
+
+		if (!cnt)
+			return;
+		p = (gU8 *)row + x / LLDRENDER_PIXELS;
+		cc = LLDRENDER_BYTE(c & LLDCOLOR_MASK());
+
+		// Pixels sharing the first byte with pixels to the left
+		if ((x %= LLDRENDER_PIXELS)) {
+			n = LLDRENDER_PIXELS - (unsigned)x;
+			if (n > cnt)
+				n = cnt;
+			m = (gU8)(((1 << (n * LLDCOLOR_BITS)) - 1) << ((LLDRENDER_PIXELS - x - n) * LLDCOLOR_BITS));
+			*p = (gU8)((*p & ~m) | (cc & m));
+			p++;
+			cnt -= n;
+		}
+
+		// Whole bytes and then the pixels sharing the last byte with pixels to the right
+		n = cnt / LLDRENDER_PIXELS;
+		memset(p, cc, n);
+		if ((cnt -= n * LLDRENDER_PIXELS)) {
+			p += n;
+			m = (gU8)(0xFF << ((LLDRENDER_PIXELS - cnt) * LLDCOLOR_BITS));
+			*p = (gU8)((*p & ~m) | (cc & m));
+		}
+	#elif LLDCOLOR_TYPE_BITS == 8
+		memset((gU8 *)row + x, c, cnt);
+	#elif GDISP_NEED_PIXELKERNELS && LLDCOLOR_TYPE_BITS == 16
+		gdispKernel->fill16((gU16 *)row + x, c, cnt);
+	#elif GDISP_NEED_PIXELKERNELS && LLDCOLOR_TYPE_BITS == 32
+		gdispKernel->fill32((gU32 *)row + x, c, cnt);
+	#else
+		LLDCOLOR_TYPE	*p;
+
+		for(p = (LLDCOLOR_TYPE *)row + x; cnt; cnt--)
+			*p++ = c;
+	#endif
+}
+
+/**
+ * @brief	Copy a run of pixels into a row converting them to the driver's pixel format
+ *
+ * @param[in] row		The first pixel of the row
+ * @param[in] x			The first pixel to write
+ * @param[in] src		The pixels in the system pixel format
+ * @param[in] cnt		The number of pixels
+ */
+static GFXINLINE void gdispRenderBlit(void *row, gCoord x, const gPixel *src, unsigned cnt) {
+	#if LLDRENDER_PACKED
+		for(; cnt; cnt--, x++)
+			gdispRenderSet(row, x, gdispColor2Native(*src++));
+	#elif GDISP_PIXELFORMAT == GDISP_LLD_PIXELFORMAT
+		memcpy((LLDCOLOR_TYPE *)row + x, src, cnt * sizeof(LLDCOLOR_TYPE));
+	#else
+		LLDCOLOR_TYPE	*p;
+
+		for(p = (LLDCOLOR_TYPE *)row + x; cnt; cnt--)
+			*p++ = gdispColor2Native(*src++);
+	#endif
+}
+
+/**
+ * @brief	Convert a system color to an ARGB8888 word
+ *
+ * @param[in] c			The color
+ * @param[in] a			The alpha (0 = transparent, 255 = opaque)
+ */
+#if GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB888
+	#define gdispRenderColor2ARGB(c, a)		(((gU32)(a) << 24) | ((gU32)(c) & 0x00FFFFFF))
+#else
+	#define gdispRenderColor2ARGB(c, a)		(((gU32)(a) << 24) | ((gU32)RED_OF(c) << 16) | ((gU32)GREEN_OF(c) << 8) | (gU32)BLUE_OF(c))
+#endif
+
+/**
+ * @brief	Fill a run of ARGB8888 pixels in a row
+ *
+ * @param[in] row		The first pixel of the row
+ * @param[in] x			The first pixel to fill
+ * @param[in] cnt		The number of pixels
+ * @param[in] c			The ARGB8888 color
+ */
+static GFXINLINE void gdispRenderFillARGB(gU32 *row, gCoord x, unsigned cnt, gU32 c) {
+	#if GDISP_NEED_PIXELKERNELS
+		gdispKernel->fill32(row + x, c, cnt);
+	#else
+		for(row += x; cnt; cnt--)
+			*row++ = c;
+	#endif
+}
+
+/**
+ * @brief	Copy a run of pixels into a row of ARGB8888 pixels
+ *
+ * @param[in] row		The first pixel of the row
+ * @param[in] x			The first pixel to write
+ * @param[in] src		The pixels in the system pixel format
+ * @param[in] cnt		The number of pixels
+ * @param[in] a			The alpha given to each pixel
+ */
+static GFXINLINE void gdispRenderBlitARGB(gU32 *row, gCoord x, const gPixel *src, unsigned cnt, gU8 a) {
+	for(row += x; cnt; cnt--, src++)
+		*row++ = gdispRenderColor2ARGB(*src, a);
+}
+
+#endif /* GFX_USE_GDISP */
+#endif /* _GDISP_RENDER_H */
+/** @} */
@@ -65,6 +65,34 @@
 			#define GDISP_NEED_MULTITHREAD		GFXON
 		#endif
 	#endif
+	#if GDISP_NEED_TILER
+		#if !GDISP_NEED_CMDLIST || !GDISP_NEED_VIEWS || !GDISP_NEED_MULTITHREAD
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GDISP: GDISP_NEED_TILER has been set but GDISP_NEED_CMDLIST, GDISP_NEED_VIEWS or GDISP_NEED_MULTITHREAD has not. They have been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GDISP: GDISP_NEED_TILER has been set but GDISP_NEED_CMDLIST, GDISP_NEED_VIEWS or GDISP_NEED_MULTITHREAD has not. They have been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_CMDLIST
+			#define GDISP_NEED_CMDLIST			GFXON
+			#undef GDISP_NEED_VIEWS
+			#define GDISP_NEED_VIEWS			GFXON
+			#undef GDISP_NEED_MULTITHREAD
+			#define GDISP_NEED_MULTITHREAD		GFXON
+		#endif
+	#endif
+	#if GDISP_NEED_ASYNC && !GDISP_NEED_MULTITHREAD
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "GDISP: GDISP_NEED_ASYNC has been set but GDISP_NEED_MULTITHREAD has not. It has been turned on for you."
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("GDISP: GDISP_NEED_ASYNC has been set but GDISP_NEED_MULTITHREAD has not. It has been turned on for you.")
+			#endif
+		#endif
+		#undef GDISP_NEED_MULTITHREAD
+		#define GDISP_NEED_MULTITHREAD		GFXON
+	#endif
 	#if GDISP_NEED_ANTIALIAS && !GDISP_NEED_PIXELREAD
 		#if GDISP_HARDWARE_PIXELREAD
 			#if GFX_DISPLAY_RULE_WARNINGS
@@ -86,6 +114,54 @@
 			#endif
 		#endif
 	#endif
+	#if GDISP_NEED_COMPOSITE && !GDISP_NEED_PIXELREAD && GDISP_HARDWARE_PIXELREAD
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "GDISP: GDISP_NEED_COMPOSITE has been set but GDISP_NEED_PIXELREAD has not. It has been turned on for you."
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("GDISP: GDISP_NEED_COMPOSITE has been set but GDISP_NEED_PIXELREAD has not. It has been turned on for you.")
+			#endif
+		#endif
+		#undef GDISP_NEED_PIXELREAD
+		#define GDISP_NEED_PIXELREAD		GFXON
+	#endif
+	#if GDISP_NEED_TRANSFORM
+		#if !GFX_USE_GMISC || !GMISC_NEED_MATRIXFIXED2D
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GDISP: GDISP_NEED_TRANSFORM has been set but GMISC_NEED_MATRIXFIXED2D has not. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GDISP: GDISP_NEED_TRANSFORM has been set but GMISC_NEED_MATRIXFIXED2D has not. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GFX_USE_GMISC
+			#define GFX_USE_GMISC				GFXON
+			#undef GMISC_NEED_MATRIXFIXED2D
+			#define GMISC_NEED_MATRIXFIXED2D	GFXON
+		#endif
+	#endif
+	#if GDISP_NEED_CLIPREGION && !GDISP_NEED_CLIP
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "GDISP: GDISP_NEED_CLIPREGION has been set but GDISP_NEED_CLIP has not. It has been turned on for you."
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("GDISP: GDISP_NEED_CLIPREGION has been set but GDISP_NEED_CLIP has not. It has been turned on for you.")
+			#endif
+		#endif
+		#undef GDISP_NEED_CLIP
+		#define GDISP_NEED_CLIP					GFXON
+	#endif
+	#if GDISP_NEED_VIEWS && !GDISP_NEED_CLIP
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "GDISP: GDISP_NEED_VIEWS has been set but GDISP_NEED_CLIP has not. It has been turned on for you."
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("GDISP: GDISP_NEED_VIEWS has been set but GDISP_NEED_CLIP has not. It has been turned on for you.")
+			#endif
+		#endif
+		#undef GDISP_NEED_CLIP
+		#define GDISP_NEED_CLIP					GFXON
+	#endif
 	#if (defined(GDISP_INCLUDE_FONT_SMALL) && GDISP_INCLUDE_FONT_SMALL) || (defined(GDISP_INCLUDE_FONT_LARGER) && GDISP_INCLUDE_FONT_LARGER)
 		#if GFX_DISPLAY_RULE_WARNINGS
 			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
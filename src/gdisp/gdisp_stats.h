@@ -0,0 +1,132 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_stats.h
+ *
+ * @defgroup Stats Stats
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for drawing statistics.
+ *
+ * @details	Each display counts the calls, the pixels and the time taken by each type of drawing operation
+ * 			and by each call into the driver. This shows where the drawing time goes. For example, lots of
+ * 			driver pixel calls during text drawing means the driver is missing a fill or blit routine.
+ *
+ * @note	Drawing operations can call other drawing operations (eg. a rounded box draws arcs and lines).
+ * 			All the operations are counted but the time and pixels are only charged to the outermost one.
+ * @note	The pixels of a drawing operation are the pixels sent to or read from the driver while it runs.
+ * @note	Times are in the units of GDISP_STATS_CLOCK(). This is gfxSystemTicks() by default which is too
+ * 			coarse to time short operations. Define it to a high resolution counter for better results.
+ * @note	Timing every driver call has a cost so this is only meant for tuning and not for production.
+ * @pre		GDISP_NEED_STATS must be GFXON in your gfxconf.h
+ * @{
+ */
+
+#ifndef _GDISP_STATS_H
+#define _GDISP_STATS_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_STATS) || defined(__DOXYGEN__)
+
+/**
+ * @brief	The operations that are measured
+ */
+typedef enum gdispStatOp {
+	// Drawing operations
+	gdispStatClear,					/**< gdispGClear() */
+	gdispStatPixel,					/**< gdispGDrawPixel() */
+	gdispStatLine,					/**< gdispGDrawLine() */
+	gdispStatBox,					/**< gdispGDrawBox() */
+	gdispStatFill,					/**< gdispGFillArea() */
+	gdispStatBlit,					/**< gdispGBlitArea() */
+	gdispStatStream,				/**< gdispGStreamStart() to gdispGStreamStop() */
+	gdispStatCircle,				/**< The circle functions */
+	gdispStatEllipse,				/**< The ellipse functions */
+	gdispStatArc,					/**< The arc and arc sector functions */
+	gdispStatRoundedBox,			/**< The rounded box functions */
+	gdispStatPoly,					/**< The polygon and thick line functions */
+	gdispStatAntiAlias,				/**< The anti-aliased drawing functions */
+	gdispStatText,					/**< The character and string functions */
+	gdispStatGetPixel,				/**< gdispGGetPixelColor() */
+	gdispStatScroll,				/**< gdispGVerticalScroll() */
+	gdispStatImage,					/**< gdispGImageDraw() */
+	gdispStatCmdList,				/**< gdispCmdListSubmit() */
+	gdispStatComposite,				/**< gdispGCompositeArea() and gdispGBlendPixmap() */
+	gdispStatTransform,				/**< gdispGBlitAreaTransformed() and gdispGBlitPixmapTransformed() */
+	gdispStatCopy,					/**< gdispGCopyArea() */
+
+	// Driver calls
+	gdispStatLLDPixel,				/**< The driver pixel routine */
+	gdispStatLLDClear,				/**< The driver clear routine */
+	gdispStatLLDFill,				/**< The driver fill routine */
+	gdispStatLLDBlit,				/**< The driver blit routine */
+	gdispStatLLDWriteStart,			/**< The driver stream write start routine */
+	gdispStatLLDWriteColor,			/**< The driver stream write color routine */
+	gdispStatLLDReadColor,			/**< The driver stream read color routine */
+	gdispStatLLDGetPixel,			/**< The driver pixel read routine */
+	gdispStatLLDVScroll,			/**< The driver vertical scroll routine */
+	gdispStatLLDCopy,				/**< The driver copy area routine */
+	gdispStatLLDFlush,				/**< The driver flush routines */
+
+	gdispStatCount					/**< The number of operations */
+} gdispStatOp;
+
+/**
+ * @brief	The statistics for one operation
+ */
+typedef struct gdispStat {
+	gU32		calls;				/**< The number of calls */
+	gU32		pixels;				/**< The number of pixels */
+	gU32		time;				/**< The time taken */
+} gdispStat;
+
+/**
+ * @brief	The statistics for a display
+ */
+typedef struct gdispStats {
+	gdispStat	op[gdispStatCount];	/**< Indexed by gdispStatOp */
+} gdispStats;
+
+/**
+ * @brief	Get the statistics for a display
+ *
+ * @param[in] g			The display
+ * @param[out] stats	The statistics. This can be NULL to just reset them.
+ * @param[in] reset		Reset the statistics after reading them
+ *
+ * @api
+ */
+void gdispGGetStats(GDisplay *g, gdispStats *stats, gBool reset);
+#define gdispGetStats(stats,reset)			gdispGGetStats(GDISP,stats,reset)
+
+/**
+ * @brief	Get the name of an operation
+ * @return	The name
+ *
+ * @param[in] op		The operation
+ *
+ * @api
+ */
+const char *gdispStatName(gdispStatOp op);
+
+/**
+ * @brief	Start and end measuring an operation
+ * @note	These are used by the GDISP sub-modules such as images.
+ *
+ * @param[in] g			The display
+ * @param[in] op		The operation
+ *
+ * @notapi
+ * @{
+ */
+void _gdispStatBegin(GDisplay *g, gdispStatOp op);
+void _gdispStatEnd(GDisplay *g);
+/** @} */
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_STATS */
+#endif /* _GDISP_STATS_H */
+/** @} */
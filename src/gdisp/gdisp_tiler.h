@@ -0,0 +1,110 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_tiler.h
+ *
+ * @defgroup Tiler Tiler
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for drawing command lists on several threads at once.
+ *
+ * @details	A tiler divides a display into tiles and has a pool of worker threads. When a command list
+ * 			is submitted to the tiler each worker takes the next tile that hasn't been drawn yet and draws
+ * 			the whole list through a view clipped to that tile. The submitting thread draws tiles too.
+ * 			Threads that finish their tiles quickly just take more so the work stays balanced even
+ * 			when most of the drawing is in one part of the display.
+ *
+ * @note	The result is exactly the same as @p gdispCmdListSubmit().
+ * @note	Commands that are completely outside a tile are skipped for that tile. Everything else is
+ * 			drawn once for each tile it touches so tiles should not be too small.
+ * @note	Only one tile draws an image at a time as an image can't be decoded by two threads at once.
+ * 			Each tile only decodes the part of the image that is in the tile.
+ * @note	If the list fills up while recording it is submitted normally on the recording thread.
+ * 			Make the buffer big enough to hold everything that is to be drawn in parallel.
+ * @pre		GDISP_NEED_TILER must be GFXON in your gfxconf.h. This turns on GDISP_NEED_CMDLIST,
+ * 			GDISP_NEED_VIEWS and GDISP_NEED_MULTITHREAD.
+ * @{
+ */
+
+#ifndef _GDISP_TILER_H
+#define _GDISP_TILER_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_TILER) || defined(__DOXYGEN__)
+
+/**
+ * @brief	A tiler
+ * @note	The members of this structure are private
+ */
+typedef struct gdispTiler {
+	GDisplay *		display;						// The display the tiler draws on
+	GDisplay *		view;							// The view used by the submitting thread
+	gdispCmdList *	cl;								// The list being drawn
+	gCoord			tilecx, tilecy;					// The tile size
+	gCoord			clipx0, clipy0, clipx1, clipy1;	// The clip of the display when the list was submitted
+	unsigned		across;							// The number of tiles across the display
+	unsigned		tiles;							// The number of tiles
+	unsigned		next;							// The next tile to draw
+	unsigned		busy;							// The number of workers still drawing
+	unsigned		threads;						// The number of workers
+	gBool			quit;							// Tell the workers to exit
+	gMutex			lock;							// Protects next and busy
+	gSem			start;							// Signalled once for each worker to start drawing
+	gSem			done;							// Signalled when the last worker finishes
+	gThread			thread[GDISP_TILER_THREADS];	// The workers
+} gdispTiler;
+
+/**
+ * @brief	Start a tiler
+ * @return	gTrue if the tiler can draw in parallel on this display.
+ *
+ * @param[in] g			The display
+ * @param[out] t		The tiler
+ * @param[in] tilecx	The tile width. 0 gives a default of 64.
+ * @param[in] tilecy	The tile height. 0 gives a default of 64.
+ *
+ * @note	GDISP_TILER_THREADS worker threads are started.
+ * @note	If the display can't have views (see @p gdispGViewCreate()) or no workers can be started
+ * 			gFalse is returned. The tiler can still be used but lists are just drawn with
+ * 			@p gdispCmdListSubmit(). This lets the same code run on any display.
+ *
+ * @api
+ */
+gBool gdispGTilerInit(GDisplay *g, gdispTiler *t, gCoord tilecx, gCoord tilecy);
+#define gdispTilerInit(t,tilecx,tilecy)		gdispGTilerInit(GDISP,t,tilecx,tilecy)
+
+/**
+ * @brief	Stop a tiler
+ *
+ * @param[in] t			The tiler
+ *
+ * @note	The worker threads are stopped. This must not be called while a list is being submitted.
+ *
+ * @api
+ */
+void gdispTilerDeinit(gdispTiler *t);
+
+/**
+ * @brief	Draw all the commands recorded so far on all the tiles and empty the list
+ *
+ * @param[in] t			The tiler
+ * @param[in] cl		The command list. It must have been started for the tiler's display.
+ *
+ * @note	This returns when all the tiles have been drawn. The areas drawn are added to the
+ * 			dirty areas of the display and the display is then flushed if GDISP_NEED_AUTOFLUSH is set.
+ * @note	The display is not locked while the tiles are drawn. Other threads must not draw on the
+ * 			display at the same time.
+ * @note	Only one list can be submitted to a tiler at a time.
+ * @note	If the list is for another display it is just drawn with @p gdispCmdListSubmit().
+ *
+ * @api
+ */
+void gdispTilerSubmit(gdispTiler *t, gdispCmdList *cl);
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_TILER */
+#endif /* _GDISP_TILER_H */
+/** @} */
@@ -0,0 +1,99 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_transform.h
+ *
+ * @defgroup Transform Transform
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for scaled and rotated blits.
+ *
+ * @details	A transformed blit draws an area of pixels through a 2D matrix. This allows one
+ * 			bitmap (eg. an icon) to be drawn at any size and angle instead of storing a copy of
+ * 			it for every size that is needed.
+ *
+ * @note	The matrix maps a position in the source area to a position on the display in the same way
+ * 			as @p gmiscMatrixFixed2DApplyToPoints(). Position 0,0 is the top left corner of the source area.
+ * 			For example, scale then rotate the source and then apply a translation to place it on the display.
+ * @note	Each display pixel that the source area covers is drawn once. The source position of the first
+ * 			pixel of each line is calculated using the inverse of the matrix and is then stepped
+ * 			across the line using fixed point maths.
+ * @note	Only the matrix entries a00, a01, a02, a10, a11 and a12 are used. Perspective is not supported.
+ * @pre		GDISP_NEED_TRANSFORM must be GFXON in your gfxconf.h
+ * @{
+ */
+
+#ifndef _GDISP_TRANSFORM_H
+#define _GDISP_TRANSFORM_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_TRANSFORM) || defined(__DOXYGEN__)
+
+/**
+ * @brief	How the source pixels are sampled
+ */
+typedef enum gdispTransformFilter {
+	gdispFilterNearest,					/**< Use the nearest source pixel. This is the fastest and keeps hard edges. */
+	gdispFilterBilinear					/**< Blend the four nearest source pixels. This is smoother when scaling and rotating. */
+} gdispTransformFilter;
+
+/**
+ * @brief	Blit an area of pixels through a 2D matrix
+ *
+ * @param[in] g			The display
+ * @param[in] srcx,srcy	The top left corner of the source area in the buffer
+ * @param[in] cx,cy		The size of the source area
+ * @param[in] srccx		The width of a line in the buffer
+ * @param[in] buffer	The pixels
+ * @param[in] m			The matrix that maps the source area onto the display
+ * @param[in] filter	How the source pixels are sampled
+ *
+ * @note	Nothing is drawn if the matrix can't be inverted (eg. a scale of zero).
+ *
+ * @api
+ */
+void gdispGBlitAreaTransformed(GDisplay *g, gCoord srcx, gCoord srcy, gCoord cx, gCoord cy, gCoord srccx, const gPixel *buffer, const MatrixFixed2D *m, gdispTransformFilter filter);
+#define gdispBlitAreaTransformed(srcx,srcy,cx,cy,srccx,buffer,m,filter)		gdispGBlitAreaTransformed(GDISP,srcx,srcy,cx,cy,srccx,buffer,m,filter)
+
+#if GMISC_NEED_MATRIXFLOAT2D || defined(__DOXYGEN__)
+	/**
+	 * @brief	Blit an area of pixels through a floating point 2D matrix
+	 * @pre		GMISC_NEED_MATRIXFLOAT2D must be GFXON in your gfxconf.h
+	 * @note	The same as @p gdispGBlitAreaTransformed() except for the matrix type.
+	 * 			The matrix is converted to fixed point.
+	 *
+	 * @api
+	 */
+	void gdispGBlitAreaTransformedFloat(GDisplay *g, gCoord srcx, gCoord srcy, gCoord cx, gCoord cy, gCoord srccx, const gPixel *buffer, const MatrixFloat2D *m, gdispTransformFilter filter);
+	#define gdispBlitAreaTransformedFloat(srcx,srcy,cx,cy,srccx,buffer,m,filter)	gdispGBlitAreaTransformedFloat(GDISP,srcx,srcy,cx,cy,srccx,buffer,m,filter)
+#endif
+
+#if GDISP_NEED_PIXMAP || defined(__DOXYGEN__)
+	/**
+	 * @brief	Blit an area of a pixmap through a 2D matrix
+	 * @pre		GDISP_NEED_PIXMAP must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g			The destination display. This can be a normal display or a pixmap.
+	 * @param[in] src		The source pixmap
+	 * @param[in] srcx,srcy	The top left corner of the source area in the pixmap
+	 * @param[in] cx,cy		The size of the source area
+	 * @param[in] m			The matrix that maps the source area onto the destination
+	 * @param[in] filter	How the source pixels are sampled
+	 *
+	 * @note	The source pixmap can be in any orientation.
+	 * @note	The source and destination must not be the same pixmap.
+	 * @note	If the source is a normal display or a pixmap with an alpha channel, nothing is done.
+	 *
+	 * @api
+	 */
+	void gdispGBlitPixmapTransformed(GDisplay *g, GDisplay *src, gCoord srcx, gCoord srcy, gCoord cx, gCoord cy, const MatrixFixed2D *m, gdispTransformFilter filter);
+	#define gdispBlitPixmapTransformed(src,srcx,srcy,cx,cy,m,filter)		gdispGBlitPixmapTransformed(GDISP,src,srcx,srcy,cx,cy,m,filter)
+#endif
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_TRANSFORM */
+#endif /* _GDISP_TRANSFORM_H */
+/** @} */
@@ -0,0 +1,102 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/**
+ * @file    src/gdisp/gdisp_view.h
+ *
+ * @defgroup View View
+ * @ingroup GDISP
+ *
+ * @brief   Sub-Module for drawing on separate areas of a display from several threads at once.
+ *
+ * @details	With GDISP_NEED_MULTITHREAD every drawing operation on a display holds the display lock
+ * 			so two threads drawing on different areas still wait for each other. A view is a display
+ * 			handle for just one area of a display. Each view has its own lock, clipping area, line
+ * 			buffer and driver parameters so drawing on different views can run at the same time
+ * 			(eg. one thread per window on a multi-core processor).
+ *
+ * @note	A view uses the same coordinates as its display. Drawing is clipped to the area of the view.
+ * 			The clipping area of a view can be set as normal but it is always kept within the view.
+ * @note	gdispGClear() on a view only clears the area of the view. The driver settings
+ * 			(eg. orientation) can't be changed through a view.
+ * @note	Views can only be created for displays whose driver just draws into memory such as the
+ * 			framebuffer driver and pixmaps. Other drivers return NULL. Code that must work with
+ * 			any driver can just draw on the display itself (with a clipping area) when that happens.
+ * @note	The application must make sure that views in use at the same time don't overlap and that
+ * 			nothing else draws on the same area. Don't change the display orientation while a view is
+ * 			being drawn on. Afterwards call @p gdispViewSetArea() for each view to pick up the new size.
+ * @note	Reading pixels through a view (eg. gdispGGetPixelColor() or the source of gdispGCopyArea())
+ * 			is not limited to the area of the view.
+ * @note	A view never flushes the display itself. Flushing a view (including an automatic flush)
+ * 			passes the areas drawn on it to its display. Flush the display once drawing on all its views is
+ * 			complete. With GDISP_NEED_DIRTYRECTS only the areas drawn are then sent to the display.
+ * @pre		GDISP_NEED_VIEWS must be GFXON in your gfxconf.h
+ * @{
+ */
+
+#ifndef _GDISP_VIEW_H
+#define _GDISP_VIEW_H
+
+#if (GFX_USE_GDISP && GDISP_NEED_VIEWS) || defined(__DOXYGEN__)
+
+/**
+ * @brief	Create a view of an area of a display
+ * @return	The view or NULL if the display can't have views or there is no memory
+ *
+ * @param[in] g			The display. If this is a view the new view is of the same display.
+ * @param[in] x,y		The top left corner of the area
+ * @param[in] cx,cy		The size of the area
+ *
+ * @note	The area is clipped to the display.
+ * @note	The view is drawn on using the normal gdispGxxx() functions.
+ *
+ * @api
+ */
+GDisplay *gdispGViewCreate(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy);
+#define gdispViewCreate(x,y,cx,cy)			gdispGViewCreate(GDISP,x,y,cx,cy)
+
+/**
+ * @brief	Change the area of a view
+ *
+ * @param[in] v			The view
+ * @param[in] x,y		The top left corner of the new area
+ * @param[in] cx,cy		The size of the new area
+ *
+ * @note	The areas drawn so far are passed to the display first, as for a flush.
+ * 			The clipping area is reset to the new area of the view.
+ * @note	This allows one view to be reused for lots of areas (eg. a worker thread
+ * 			drawing one tile of the display after another).
+ * @note	The view also picks up the current size and orientation of the display.
+ *
+ * @api
+ */
+void gdispViewSetArea(GDisplay *v, gCoord x, gCoord y, gCoord cx, gCoord cy);
+
+/**
+ * @brief	Delete a view
+ *
+ * @param[in] v			The view
+ *
+ * @note	The areas drawn so far are passed to the display first, as for a flush.
+ *
+ * @api
+ */
+void gdispViewDelete(GDisplay *v);
+
+/**
+ * @brief	Get the display a view is of
+ * @return	The display or NULL if this is not a view
+ *
+ * @param[in] v			The view
+ *
+ * @api
+ */
+GDisplay *gdispViewGetDisplay(GDisplay *v);
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_VIEWS */
+#endif /* _GDISP_VIEW_H */
+/** @} */
@@ -181,9 +181,6 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 #else
 	void gwinButtonDraw_Normal(GWidgetObject *gw, void *param) {
 		const GColorSet *	pcol;
-		fixed				alpha;
-		fixed				dalpha;
-		gCoord				i;
 		gColor				tcol, bcol;
 
 		(void)				param;
@@ -194,9 +191,7 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		/* Fill the box blended from variants of the fill color */
 		tcol = gdispBlendColor(GFX_WHITE, pcol->fill, BTN_TOP_FADE);
 		bcol = gdispBlendColor(GFX_BLACK, pcol->fill, BTN_BOTTOM_FADE);
-		dalpha = FIXED(255)/gw->g.height;
-		for(alpha = 0, i = 0; i < gw->g.height; i++, alpha += dalpha)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+i, gw->g.x+gw->g.width-2, gw->g.y+i, gdispBlendColor(bcol, tcol, NONFIXED(alpha)));
+		_gwidgetFillShaded(gw, 0, 0, gw->g.width-1, gw->g.height, tcol, bcol);
 
 		gdispGDrawStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 		gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
@@ -252,9 +252,6 @@ void gwinCheckboxDraw_CheckOnRight(GWidgetObject *gw, void *param) {
 #else
 	void gwinCheckboxDraw_Button(GWidgetObject *gw, void *param) {
 		const GColorSet *	pcol;
-		fixed				alpha;
-		fixed				dalpha;
-		gCoord				i;
 		gColor				tcol, bcol;
 		(void)				param;
 
@@ -269,9 +266,7 @@ void gwinCheckboxDraw_CheckOnRight(GWidgetObject *gw, void *param) {
 		/* Fill the box blended from variants of the fill color */
 		tcol = gdispBlendColor(GFX_WHITE, pcol->fill, CHK_TOP_FADE);
 		bcol = gdispBlendColor(GFX_BLACK, pcol->fill, CHK_BOTTOM_FADE);
-		dalpha = FIXED(255)/gw->g.height;
-		for(alpha = 0, i = 0; i < gw->g.height; i++, alpha += dalpha)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+i, gw->g.x+gw->g.width-2, gw->g.y+i, gdispBlendColor(bcol, tcol, NONFIXED(alpha)));
+		_gwidgetFillShaded(gw, 0, 0, gw->g.width-1, gw->g.height, tcol, bcol);
 
 		gdispGDrawStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 		gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
@@ -313,6 +313,23 @@ gBool _gwinWMAdd(GHandle gh, const GWindowInit *pInit);
 	 */
 	void _gwinSendEvent(GHandle gh, GEventType type);
 
+	#if !GWIN_FLAT_STYLING || defined(__DOXYGEN__)
+		/**
+		 * @brief	Fill an area of a widget with a vertical shade from one color to another
+		 *
+		 * @param[in]	gw		The widget
+		 * @param[in]	x, y	The start position (relative to the widget)
+		 * @param[in]	cx, cy	The size of the area
+		 * @param[in]	tcol	The color at the top
+		 * @param[in]	bcol	The color at the bottom
+		 *
+		 * @note		This uses a paint fill if GDISP_NEED_PAINT is turned on otherwise it draws one line at a time.
+		 *
+		 * @notapi
+		 */
+		void _gwidgetFillShaded(GWidgetObject *gw, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor tcol, gColor bcol);
+	#endif
+
 	#if (GFX_USE_GINPUT && GINPUT_NEED_KEYBOARD) || GWIN_NEED_KEYBOARD || defined(__DOXYGEN__)
 		/**
 		 * @brief	Move the focus off the current focus window.
@@ -261,9 +261,6 @@ void gwinRadioDraw_Radio(GWidgetObject *gw, void *param) {
 #else
 	void gwinRadioDraw_Button(GWidgetObject *gw, void *param) {
 		const GColorSet *	pcol;
-		fixed				alpha;
-		fixed				dalpha;
-		gCoord				i;
 		gColor				tcol, bcol;
 		(void)				param;
 
@@ -273,9 +270,7 @@ void gwinRadioDraw_Radio(GWidgetObject *gw, void *param) {
 		/* Fill the box blended from variants of the fill color */
 		tcol = gdispBlendColor(GFX_WHITE, pcol->fill, GRADIO_TOP_FADE);
 		bcol = gdispBlendColor(GFX_BLACK, pcol->fill, GRADIO_BOTTOM_FADE);
-		dalpha = FIXED(255)/gw->g.height;
-		for(alpha = 0, i = 0; i < gw->g.height; i++, alpha += dalpha)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+i, gw->g.x+gw->g.width-2, gw->g.y+i, gdispBlendColor(bcol, tcol, NONFIXED(alpha)));
+		_gwidgetFillShaded(gw, 0, 0, gw->g.width-1, gw->g.height, tcol, bcol);
 
 		gdispGDrawStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 		gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
@@ -286,9 +281,6 @@ void gwinRadioDraw_Radio(GWidgetObject *gw, void *param) {
 	}
 	void gwinRadioDraw_Tab(GWidgetObject *gw, void *param) {
 		const GColorSet *	pcol;
-		fixed				alpha;
-		fixed				dalpha;
-		gCoord				i;
 		gColor				tcol, bcol;
 		(void)				param;
 
@@ -305,9 +297,7 @@ void gwinRadioDraw_Radio(GWidgetObject *gw, void *param) {
 			/* Fill the box blended from variants of the fill color */
 			tcol = gdispBlendColor(GFX_WHITE, pcol->fill, GRADIO_TOP_FADE);
 			bcol = gdispBlendColor(GFX_BLACK, pcol->fill, GRADIO_BOTTOM_FADE);
-			dalpha = FIXED(255)/gw->g.height;
-			for(alpha = 0, i = 0; i < gw->g.height; i++, alpha += dalpha)
-				gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+i, gw->g.x+gw->g.width-2, gw->g.y+i, gdispBlendColor(bcol, tcol, NONFIXED(alpha)));
+			_gwidgetFillShaded(gw, 0, 0, gw->g.width-1, gw->g.height, tcol, bcol);
 			gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
 			gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 		}
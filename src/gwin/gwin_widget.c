@@ -747,5 +747,27 @@ gBool gwinAttachListener(GListener *pl) {
 
 #undef gw
 #undef wvmt
+
+#if !GWIN_FLAT_STYLING
+	void _gwidgetFillShaded(GWidgetObject *gw, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor tcol, gColor bcol) {
+		#if GDISP_NEED_PAINT
+			gdispPaint	paint;
+
+			gdispPaintSetLinear(&paint, gw->g.x+x, gw->g.y+y, gw->g.x+x, gw->g.y+y+cy, tcol, bcol);
+			gdispGFillAreaPaint(gw->g.display, gw->g.x+x, gw->g.y+y, cx, cy, &paint);
+		#else
+			fixed	alpha;
+			fixed	dalpha;
+			gCoord	i;
+
+			if (cy <= 0)
+				return;
+			dalpha = FIXED(255)/cy;
+			for(alpha = 0, i = 0; i < cy; i++, alpha += dalpha)
+				gdispGDrawLine(gw->g.display, gw->g.x+x, gw->g.y+y+i, gw->g.x+x+cx-1, gw->g.y+y+i, gdispBlendColor(bcol, tcol, NONFIXED(alpha)));
+		#endif
+	}
+#endif
+
 #endif /* GFX_USE_GWIN && GWIN_NEED_WIDGET */
 /** @} */
@@ -896,6 +896,94 @@ static void WM_Size(GHandle gh, gCoord w, gCoord h) {
 	}
 }
 
+#if GDISP_NEED_COPYAREA
+	#if GWIN_NEED_CONTAINERS
+		static gBool isDescendant(GHandle gx, GHandle gh) {
+			for(gx = gx->parent; gx; gx = gx->parent) {
+				if (gx == gh)
+					return gTrue;
+			}
+			return gFalse;
+		}
+	#else
+		#define isDescendant(gx, gh)	gFalse
+	#endif
+
+	// Move a visible top level window by copying its pixels rather than hiding and redrawing it.
+	//	This is only possible if no other window overlaps either position as the copy would
+	//	take their pixels with it. Returns gFalse if the window was not moved.
+	static gBool WM_MoveCopy(GHandle gh, gCoord x, gCoord y) {
+		GHandle		gx;
+		gCoord		ox, oy, w, h, d;
+
+		#if GWIN_NEED_CONTAINERS
+			if (gh->parent)
+				return gFalse;
+		#endif
+
+		// Make sure what is on the display is up to date
+		_gwinFlushRedraws(REDRAW_WAIT);
+
+		gfxSemWait(&gwinsem, gDelayForever);
+
+		ox = gh->x; oy = gh->y;
+		w = gh->width; h = gh->height;
+		for(gx = gwinGetNextWindow(0); gx; gx = gwinGetNextWindow(gx)) {
+			if (gx == gh || isDescendant(gx, gh)) {
+				if ((gx->flags & GWIN_FLG_NEEDREDRAW))
+					goto cantcopy;
+				continue;
+			}
+			if ((gx->flags & GWIN_FLG_SYSVISIBLE) && gx->display == gh->display
+					&& ((gx->x < ox+w && gx->y < oy+h && gx->x+gx->width > ox && gx->y+gx->height > oy)
+						|| (gx->x < x+w && gx->y < y+h && gx->x+gx->width > x && gx->y+gx->height > y)))
+				goto cantcopy;
+		}
+
+		gdispGCopyArea(gh->display, ox, oy, w, h, x, y);
+
+		// Clear the part of the old area that is no longer covered
+		if (x >= ox+w || x+w <= ox || y >= oy+h || y+h <= oy)
+			gdispGFillArea(gh->display, ox, oy, w, h, gwinGetDefaultBgColor());
+		else {
+			// The strip above or below the new position
+			if (y > oy) {
+				gdispGFillArea(gh->display, ox, oy, w, y-oy, gwinGetDefaultBgColor());
+				d = y;
+				h -= y-oy;
+			} else {
+				if (y < oy)
+					gdispGFillArea(gh->display, ox, y+h, w, oy-y, gwinGetDefaultBgColor());
+				d = oy;
+				h -= oy-y;
+			}
+
+			// The strip to the left or right of the new position
+			if (x > ox)
+				gdispGFillArea(gh->display, ox, d, x-ox, h, gwinGetDefaultBgColor());
+			else if (x < ox)
+				gdispGFillArea(gh->display, x+w, d, ox-x, h, gwinGetDefaultBgColor());
+		}
+
+		// Do the move. Any children keep their position relative to the window.
+		for(gx = gwinGetNextWindow(0); gx; gx = gwinGetNextWindow(gx)) {
+			if (isDescendant(gx, gh)) {
+				gx->x += x - ox;
+				gx->y += y - oy;
+			}
+		}
+		gh->x = x;
+		gh->y = y;
+
+		gfxSemSignal(&gwinsem);
+		return gTrue;
+
+	cantcopy:
+		gfxSemSignal(&gwinsem);
+		return gFalse;
+	}
+#endif
+
 static void WM_Move(GHandle gh, gCoord x, gCoord y) {
 	gCoord		u, v;
 
@@ -938,6 +1026,12 @@ static void WM_Move(GHandle gh, gCoord x, gCoord y) {
 	if (gh->x == x && gh->y == y)
 		return;
 
+	#if GDISP_NEED_COPYAREA
+		// Best is to copy the window to its new position
+		if ((gh->flags & GWIN_FLG_SYSVISIBLE) && WM_MoveCopy(gh, x, y))
+			return;
+	#endif
+
 	// Clear the old area and then redraw
 	if ((gh->flags & GWIN_FLG_SYSVISIBLE)) {
 		// We need to make this window invisible and ensure that has been drawn